@@ -69,13 +69,21 @@
 #include "testing_spgemm_csr.hpp"
 
 // Preconditioner
+#include "testing_bsrdiag_inverse.hpp"
 #include "testing_bsric0.hpp"
 #include "testing_bsrilu0.hpp"
 #include "testing_csric0.hpp"
 #include "testing_csrilu0.hpp"
+#include "testing_csrildl0.hpp"
+#include "testing_csrmcilu0.hpp"
+#include "testing_csrmcsor.hpp"
+#include "testing_csrpoly.hpp"
+#include "testing_csrfsai.hpp"
 #include "testing_gtsv.hpp"
 #include "testing_gtsv_no_pivot.hpp"
 #include "testing_gtsv_no_pivot_strided_batch.hpp"
+#include "testing_gtsv_interleaved_batch.hpp"
+#include "testing_gpsv_interleaved_batch.hpp"
 
 // Conversion
 #include "testing_bsr2csr.hpp"
@@ -116,6 +124,7 @@
 
 // Reordering
 #include "testing_csrcolor.hpp"
+#include "testing_csrrcm.hpp"
 
 #include <iostream>
 #include <rocsparse.h>
@@ -158,6 +167,7 @@ int main(int argc, char* argv[])
     char          diag;
     char          uplo;
     char          apol;
+    char          spol;
     rocsparse_int dir;
     rocsparse_int order;
     rocsparse_int format;
@@ -274,7 +284,7 @@ int main(int argc, char* argv[])
         ("hybpart",
         value<int>(&part)->default_value(0),
         "0 = rocsparse_hyb_partition_auto, 1 = rocsparse_hyb_partition_user,\n"
-        "2 = rocsparse_hyb_partition_max, (default: 0)")
+        "2 = rocsparse_hyb_partition_max, 3 = rocsparse_hyb_partition_histogram, (default: 0)")
 
         ("matrix_type",
         value<int>(&matrix_type)->default_value(0),
@@ -293,6 +303,10 @@ int main(int argc, char* argv[])
         value<char>(&apol)->default_value('R'),
         "R = reuse meta data, F = force re-build, (default = R)")
 
+        ("spolicy",
+        value<char>(&spol)->default_value('A'),
+        "A = auto, L = level set, S = sync-free, (default = A)")
+
         ("function,f",
         value<std::string>(&function)->default_value("axpyi"),
         "SPARSE function to test. Options:\n"
@@ -300,12 +314,13 @@ int main(int argc, char* argv[])
         "  Level2: bsrmv, bsrxmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrsv, coosv, ellmv, hybmv, gebsrmv, gemvi\n"
         "  Level3: bsrmm, bsrsm, gebsrmm, csrmm, coomm, csrsm, coosm, gemmi, sddmm\n"
         "  Extra: csrgeam, csrgemm\n"
-        "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch\n"
+        "  Preconditioner: bsric0, bsrilu0, bsrdiag_inverse, csric0, csrilu0, csrildl0, csrmcsor, csrmcilu0, csrpoly, csrfsai, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_interleaved_batch, gpsv_interleaved_batch\n"
         "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
         "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
         "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
         "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
         "  Sorting: cscsort, csrsort, coosort\n"
+        "  Reordering: csrcolor, csrrcm\n"
         "  Misc: identity, nnz")
 
         ("indextype",
@@ -341,7 +356,27 @@ int main(int argc, char* argv[])
 
         ("denseld",
         value<rocsparse_int>(&arg.denseld)->default_value(128),
-        "Indicates the leading dimension of a dense matrix >= M, assuming a column-oriented storage.");
+        "Indicates the leading dimension of a dense matrix >= M, assuming a column-oriented storage.")
+
+        ("algo",
+        value<uint32_t>(&arg.algo)->default_value(0),
+        "Algorithm to use, e.g. for gtsv_interleaved_batch: default = 0, thomas = 1, pcr = 2, lu = 3, qr = 4 (default: 0)")
+
+        ("deterministic",
+        value<rocsparse_int>(&arg.deterministic)->default_value(0),
+        "Require bitwise reproducible results, i.e. avoid atomic accumulation: 0 = No, 1 = Yes (default: 0)")
+
+        ("graph",
+        value<rocsparse_int>(&arg.graph)->default_value(0),
+        "Capture the computation into a HIP graph and replay it: 0 = No, 1 = Yes (default: 0)")
+
+        ("batch_count",
+        value<rocsparse_int>(&arg.batch_count)->default_value(1),
+        "Number of strided batches of the dense matrices B and C in spmm (default: 1)")
+
+        ("batch_count_A",
+        value<rocsparse_int>(&arg.batch_count_A)->default_value(1),
+        "Number of strided batches of the sparse matrix values in spmm, either 1 or batch_count (default: 1)");
 
     // clang-format on
 
@@ -421,7 +456,8 @@ int main(int argc, char* argv[])
     arg.action      = (action == 0) ? rocsparse_action_numeric : rocsparse_action_symbolic;
     arg.part        = (part == 0)   ? rocsparse_hyb_partition_auto
                       : (part == 1) ? rocsparse_hyb_partition_user
-                                    : rocsparse_hyb_partition_max;
+                      : (part == 2) ? rocsparse_hyb_partition_max
+                                    : rocsparse_hyb_partition_histogram;
     arg.matrix_type = (matrix_type == 0)   ? rocsparse_matrix_type_general
                       : (matrix_type == 1) ? rocsparse_matrix_type_symmetric
                       : (matrix_type == 2) ? rocsparse_matrix_type_hermitian
@@ -429,7 +465,9 @@ int main(int argc, char* argv[])
     arg.diag        = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
     arg.uplo        = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
     arg.apol = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
-    arg.spol = rocsparse_solve_policy_auto;
+    arg.spol = (spol == 'L')   ? rocsparse_solve_policy_level_set
+               : (spol == 'S') ? rocsparse_solve_policy_sync_free
+                               : rocsparse_solve_policy_auto;
     arg.direction
         = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
     arg.order  = (order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
@@ -1242,6 +1280,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_bsrilu0<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrdiag_inverse")
+    {
+        if(precision == 's')
+            testing_bsrdiag_inverse<float>(arg);
+        else if(precision == 'd')
+            testing_bsrdiag_inverse<double>(arg);
+        else if(precision == 'c')
+            testing_bsrdiag_inverse<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrdiag_inverse<rocsparse_double_complex>(arg);
+    }
     else if(function == "csric0")
     {
         if(precision == 's')
@@ -1264,6 +1313,61 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrilu0<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrildl0")
+    {
+        if(precision == 's')
+            testing_csrildl0<float>(arg);
+        else if(precision == 'd')
+            testing_csrildl0<double>(arg);
+        else if(precision == 'c')
+            testing_csrildl0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrildl0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmcsor")
+    {
+        if(precision == 's')
+            testing_csrmcsor<float>(arg);
+        else if(precision == 'd')
+            testing_csrmcsor<double>(arg);
+        else if(precision == 'c')
+            testing_csrmcsor<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmcsor<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrmcilu0")
+    {
+        if(precision == 's')
+            testing_csrmcilu0<float>(arg);
+        else if(precision == 'd')
+            testing_csrmcilu0<double>(arg);
+        else if(precision == 'c')
+            testing_csrmcilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrmcilu0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrpoly")
+    {
+        if(precision == 's')
+            testing_csrpoly<float>(arg);
+        else if(precision == 'd')
+            testing_csrpoly<double>(arg);
+        else if(precision == 'c')
+            testing_csrpoly<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrpoly<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrfsai")
+    {
+        if(precision == 's')
+            testing_csrfsai<float>(arg);
+        else if(precision == 'd')
+            testing_csrfsai<double>(arg);
+        else if(precision == 'c')
+            testing_csrfsai<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrfsai<rocsparse_double_complex>(arg);
+    }
     else if(function == "gtsv")
     {
         if(precision == 's')
@@ -1297,6 +1401,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_gtsv_no_pivot_strided_batch<rocsparse_double_complex>(arg);
     }
+    else if(function == "gtsv_interleaved_batch")
+    {
+        if(precision == 's')
+            testing_gtsv_interleaved_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_interleaved_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_interleaved_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_interleaved_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gpsv_interleaved_batch")
+    {
+        if(precision == 's')
+            testing_gpsv_interleaved_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gpsv_interleaved_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gpsv_interleaved_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gpsv_interleaved_batch<rocsparse_double_complex>(arg);
+    }
     else if(function == "nnz")
     {
         if(precision == 's')
@@ -1771,6 +1897,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrcolor<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrrcm")
+    {
+        if(precision == 's')
+            testing_csrrcm<float>(arg);
+        else if(precision == 'd')
+            testing_csrrcm<double>(arg);
+        else if(precision == 'c')
+            testing_csrrcm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrrcm<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrsort")
     {
         testing_csrsort<float>(arg);
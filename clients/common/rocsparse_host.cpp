@@ -24,6 +24,7 @@
 #include "utility.hpp"
 
 #include <limits>
+#include <map>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -2037,6 +2038,75 @@ void host_csrsv(rocsparse_operation  trans,
     *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
+template <typename I, typename J, typename T>
+void host_csritsv(J                         M,
+                  T                         alpha,
+                  const I*                  csr_row_ptr,
+                  const J*                  csr_col_ind,
+                  const T*                  csr_val,
+                  const T*                  x,
+                  T*                        y,
+                  rocsparse_diag_type       diag_type,
+                  rocsparse_fill_mode       fill_mode,
+                  rocsparse_index_base      base,
+                  rocsparse_int*            sweeps,
+                  const floating_data_t<T>* tol)
+{
+    // Previous iterate, starting with the zero vector
+    std::vector<T> y_old(M, static_cast<T>(0));
+
+    rocsparse_int sweep = 0;
+    while(sweep < *sweeps)
+    {
+        floating_data_t<T> max_update = static_cast<floating_data_t<T>>(0);
+
+        // Jacobi sweep, each row only depends on the previous iterate
+        for(J i = 0; i < M; ++i)
+        {
+            T sum  = alpha * x[i];
+            T diag = static_cast<T>(1);
+
+            for(I j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                J col = csr_col_ind[j] - base;
+
+                if(col == i)
+                {
+                    diag = (csr_val[j] == static_cast<T>(0)) ? static_cast<T>(1) : csr_val[j];
+                }
+                else if((fill_mode == rocsparse_fill_mode_lower && col < i)
+                        || (fill_mode == rocsparse_fill_mode_upper && col > i))
+                {
+                    sum = std::fma(-csr_val[j], y_old[col], sum);
+                }
+            }
+
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                sum = sum / diag;
+            }
+
+            max_update = std::max(max_update, std::abs(sum - y_old[i]));
+
+            y[i] = sum;
+        }
+
+        ++sweep;
+
+        for(J i = 0; i < M; ++i)
+        {
+            y_old[i] = y[i];
+        }
+
+        if(tol != nullptr && max_update <= *tol)
+        {
+            break;
+        }
+    }
+
+    *sweeps = sweep;
+}
+
 template <typename I, typename T>
 void host_coosv(rocsparse_operation   trans,
                 I                     M,
@@ -4349,6 +4419,168 @@ void host_bsrilu0(rocsparse_direction               dir,
     *numeric_pivot = (*numeric_pivot == mb + 1) ? -1 : *numeric_pivot;
 }
 
+template <typename T>
+void host_bsrdiag_inverse(rocsparse_direction               dir,
+                          rocsparse_int                     mb,
+                          const std::vector<rocsparse_int>& bsr_row_ptr,
+                          const std::vector<rocsparse_int>& bsr_col_ind,
+                          const std::vector<T>&             bsr_val,
+                          rocsparse_int                     block_dim,
+                          rocsparse_bsrdiag_inverse_alg     alg,
+                          std::vector<T>&                   inv_val,
+                          std::vector<rocsparse_int>&       inv_row_ptr,
+                          std::vector<rocsparse_int>&       inv_col_ind,
+                          rocsparse_index_base              base,
+                          rocsparse_int*                    zero_pivot)
+{
+    *zero_pivot = -1;
+
+    inv_val.resize(size_t(mb) * block_dim * block_dim);
+    inv_row_ptr.resize(mb + 1);
+    inv_col_ind.resize(mb);
+
+    // Block diagonal structure
+    for(rocsparse_int i = 0; i < mb; ++i)
+    {
+        inv_row_ptr[i] = i + base;
+        inv_col_ind[i] = i + base;
+    }
+
+    inv_row_ptr[mb] = mb + base;
+
+    std::vector<T>             A(block_dim * block_dim);
+    std::vector<rocsparse_int> perm(block_dim);
+
+    for(rocsparse_int i = 0; i < mb; ++i)
+    {
+        // Extract the diagonal block, a missing diagonal block is zero
+        std::fill(A.begin(), A.end(), static_cast<T>(0));
+
+        for(rocsparse_int j = bsr_row_ptr[i] - base; j < bsr_row_ptr[i + 1] - base; ++j)
+        {
+            if(bsr_col_ind[j] - base == i)
+            {
+                for(rocsparse_int r = 0; r < block_dim; ++r)
+                {
+                    for(rocsparse_int c = 0; c < block_dim; ++c)
+                    {
+                        A[block_dim * r + c]
+                            = bsr_val[block_dim * block_dim * j
+                                      + ((dir == rocsparse_direction_row) ? block_dim * r + c
+                                                                          : block_dim * c + r)];
+                    }
+                }
+            }
+        }
+
+        // In-place Gauss-Jordan elimination
+        for(rocsparse_int k = 0; k < block_dim; ++k)
+        {
+            rocsparse_int p = k;
+
+            if(alg != rocsparse_bsrdiag_inverse_alg_no_pivot)
+            {
+                for(rocsparse_int r = k + 1; r < block_dim; ++r)
+                {
+                    if(std::abs(A[block_dim * r + k]) > std::abs(A[block_dim * p + k]))
+                    {
+                        p = r;
+                    }
+                }
+            }
+
+            if(A[block_dim * p + k] == static_cast<T>(0) && *zero_pivot == -1)
+            {
+                *zero_pivot = i + base;
+            }
+
+            perm[k] = p;
+
+            for(rocsparse_int c = 0; c < block_dim; ++c)
+            {
+                std::swap(A[block_dim * k + c], A[block_dim * p + c]);
+            }
+
+            T inv = static_cast<T>(1) / A[block_dim * k + k];
+
+            A[block_dim * k + k] = static_cast<T>(1);
+
+            for(rocsparse_int c = 0; c < block_dim; ++c)
+            {
+                A[block_dim * k + c] *= inv;
+            }
+
+            for(rocsparse_int r = 0; r < block_dim; ++r)
+            {
+                if(r != k)
+                {
+                    T ark = A[block_dim * r + k];
+
+                    A[block_dim * r + k] = static_cast<T>(0);
+
+                    for(rocsparse_int c = 0; c < block_dim; ++c)
+                    {
+                        A[block_dim * r + c] -= ark * A[block_dim * k + c];
+                    }
+                }
+            }
+        }
+
+        // Undo the row interchanges
+        for(rocsparse_int k = block_dim - 1; k >= 0; --k)
+        {
+            for(rocsparse_int r = 0; r < block_dim; ++r)
+            {
+                std::swap(A[block_dim * r + k], A[block_dim * r + perm[k]]);
+            }
+        }
+
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            for(rocsparse_int c = 0; c < block_dim; ++c)
+            {
+                inv_val[block_dim * block_dim * i
+                        + ((dir == rocsparse_direction_row) ? block_dim * r + c
+                                                            : block_dim * c + r)]
+                    = A[block_dim * r + c];
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_bsrdiag_inverse_apply(rocsparse_direction   dir,
+                                rocsparse_int         mb,
+                                T                     alpha,
+                                const std::vector<T>& inv_val,
+                                rocsparse_int         block_dim,
+                                const std::vector<T>& x,
+                                T                     beta,
+                                std::vector<T>&       y)
+{
+    for(rocsparse_int i = 0; i < mb; ++i)
+    {
+        for(rocsparse_int r = 0; r < block_dim; ++r)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int c = 0; c < block_dim; ++c)
+            {
+                sum = std::fma(inv_val[block_dim * block_dim * i
+                                       + ((dir == rocsparse_direction_row) ? block_dim * r + c
+                                                                           : block_dim * c + r)],
+                               x[block_dim * i + c],
+                               sum);
+            }
+
+            rocsparse_int row = block_dim * i + r;
+
+            y[row] = (beta != static_cast<T>(0)) ? std::fma(beta, y[row], alpha * sum)
+                                                 : alpha * sum;
+        }
+    }
+}
+
 template <typename T>
 void host_csric0(rocsparse_int                     M,
                  const std::vector<rocsparse_int>& csr_row_ptr,
@@ -4568,222 +4800,1773 @@ void host_csrilu0(rocsparse_int                     M,
     }
 }
 
-// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
-template <typename T>
-void host_gtsv_no_pivot(rocsparse_int         m,
-                        rocsparse_int         n,
-                        const std::vector<T>& dl,
-                        const std::vector<T>& d,
-                        const std::vector<T>& du,
-                        std::vector<T>&       B,
-                        rocsparse_int         ldb)
+template <typename T, typename U>
+void host_csrildl0(rocsparse_int                     M,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   std::vector<T>&                   csr_val,
+                   rocsparse_index_base              base,
+                   rocsparse_int*                    struct_pivot,
+                   rocsparse_int*                    numeric_pivot,
+                   bool                              boost,
+                   U                                 boost_tol,
+                   T                                 boost_val)
 {
-    rocsparse_int BLOCKSIZE = 0;
-    if((m & (m - 1)) == 0)
-    {
-        BLOCKSIZE = m;
-    }
-    else
-    {
-        BLOCKSIZE = pow(2, static_cast<rocsparse_int>(log2(m)) + 1);
-    }
-
-    for(rocsparse_int col = 0; col < n; col++)
-    {
-        rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
-        rocsparse_int stride = 1;
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
 
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+    // pointer of upper part of each row
+    std::vector<rocsparse_int> diag_offset(M);
+    std::vector<rocsparse_int> nnz_entries(M, -1);
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> x(BLOCKSIZE, static_cast<T>(0));
+    // ai = 0 to N loop over all rows
+    for(rocsparse_int ai = 0; ai < M; ++ai)
+    {
+        // ai-th row entries
+        rocsparse_int row_begin = csr_row_ptr[ai] - base;
+        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+        rocsparse_int j;
 
-        for(rocsparse_int i = 0; i < m; i++)
+        // nnz position of ai-th row in val array
+        for(j = row_begin; j < row_end; ++j)
         {
-            a[i]   = dl[i];
-            b[i]   = d[i];
-            c[i]   = du[i];
-            rhs[i] = B[ldb * col + i];
+            nnz_entries[csr_col_ind[j] - base] = j;
         }
 
-        for(rocsparse_int j = 0; j < iter; j++)
-        {
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                rocsparse_int right = tid + stride;
-                if(right >= m)
-                    right = m - 1;
-
-                rocsparse_int left = tid - stride;
-                if(left < 0)
-                    left = 0;
+        T sum = static_cast<T>(0);
 
-                T k1 = a[tid] / b[left];
-                T k2 = c[tid] / b[right];
+        bool has_diag = false;
 
-                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
-                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
-                T ta   = -a[left] * k1;
-                T tc   = -c[right] * k2;
+        // loop over ai-th row nnz entries, computing W_ij = L_ij * D_jj
+        for(j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col_j = csr_col_ind[j] - base;
 
-                sb[tid]   = tb;
-                srhs[tid] = trhs;
-                sa[tid]   = ta;
-                sc[tid]   = tc;
+            // Mark diagonal and skip row
+            if(col_j == ai)
+            {
+                has_diag = true;
+                break;
             }
 
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            // Skip upper triangular
+            if(col_j > ai)
             {
-                a[tid]   = sa[tid];
-                b[tid]   = sb[tid];
-                c[tid]   = sc[tid];
-                rhs[tid] = srhs[tid];
+                break;
             }
 
-            stride *= 2;
-        }
+            rocsparse_int row_begin_j = csr_row_ptr[col_j] - base;
+            rocsparse_int row_diag_j  = diag_offset[col_j];
 
-        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-        {
-            if(tid < BLOCKSIZE / 2)
+            T local_sum = static_cast<T>(0);
+
+            // loop over lower part of row col_j and do linear combination for nnz entry
+            for(rocsparse_int k = row_begin_j; k < row_diag_j; ++k)
             {
-                rocsparse_int i = tid;
-                rocsparse_int j = tid + stride;
+                rocsparse_int col_k = csr_col_ind[k] - base;
 
-                if(j < m)
-                {
-                    // Solve 2x2 systems
-                    T det = b[j] * b[i] - c[i] * a[j];
-                    x[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
-                    x[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
-                }
-                else
+                // if nnz at this position do linear combination
+                if(nnz_entries[col_k] != -1)
                 {
-                    // Solve 1x1 systems
-                    x[i] = rhs[i] / b[i];
+                    local_sum = std::fma(csr_val[k], csr_val[nnz_entries[col_k]], local_sum);
                 }
             }
+
+            T val_j = csr_val[j] - local_sum;
+            sum     = std::fma(val_j, val_j / csr_val[row_diag_j], sum);
+
+            csr_val[j] = val_j;
+        }
+
+        if(!has_diag)
+        {
+            // Structural (and numerical) zero diagonal
+            *struct_pivot  = ai + base;
+            *numeric_pivot = ai + base;
+            return;
+        }
+
+        // Process diagonal entry
+        T diag_val = csr_val[j] - sum;
+
+        if(boost)
+        {
+            diag_val = (boost_tol >= std::abs(diag_val)) ? boost_val : diag_val;
+        }
+
+        csr_val[j] = diag_val;
+
+        // Store diagonal offset
+        diag_offset[ai] = j;
+
+        // Scale the row by the pivots, L_ij = W_ij / D_jj
+        for(rocsparse_int k = row_begin; k < j; ++k)
+        {
+            csr_val[k] /= csr_val[diag_offset[csr_col_ind[k] - base]];
+        }
+
+        // clear nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - base] = -1;
+        }
+
+        // Check for numeric zero
+        if(diag_val == static_cast<T>(0))
+        {
+            *numeric_pivot = ai + base;
+            return;
+        }
+    }
+}
+
+template <typename T>
+void host_csrildl0_solve(rocsparse_int                     M,
+                         T                                 alpha,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         const std::vector<T>&             csr_val,
+                         const std::vector<T>&             x,
+                         std::vector<T>&                   y,
+                         rocsparse_index_base              base)
+{
+    // Position of the diagonal entry of each row
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    // Forward substitution with unit lower triangular L
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        T sum = alpha * x[i];
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col_j = csr_col_ind[j] - base;
+
+            if(col_j < i)
+            {
+                sum = std::fma(-csr_val[j], y[col_j], sum);
+            }
+            else if(col_j == i)
+            {
+                diag_offset[i] = j;
+            }
+        }
+
+        y[i] = sum;
+    }
+
+    // Diagonal scaling
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        if(diag_offset[i] != -1)
+        {
+            y[i] /= csr_val[diag_offset[i]];
+        }
+    }
+
+    // Backward substitution with unit upper triangular L^T
+    for(rocsparse_int i = M - 1; i >= 0; --i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col_j = csr_col_ind[j] - base;
+
+            if(col_j < i)
+            {
+                y[col_j] = std::fma(-csr_val[j], y[i], y[col_j]);
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_csrilut(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  floating_data_t<T>                tol,
+                  rocsparse_int                     max_fill,
+                  rocsparse_index_base              base_LU,
+                  std::vector<rocsparse_int>&       csr_row_ptr_LU,
+                  std::vector<rocsparse_int>&       csr_col_ind_LU,
+                  std::vector<T>&                   csr_val_LU,
+                  rocsparse_int*                    numeric_pivot,
+                  bool                              boost,
+                  floating_data_t<T>                boost_tol,
+                  T                                 boost_val)
+{
+    // Initialize pivot
+    *numeric_pivot = -1;
+
+    // Position of the diagonal entry of each factorized row
+    std::vector<rocsparse_int> diag_offset(M);
+
+    csr_row_ptr_LU.resize(M + 1);
+    csr_col_ind_LU.clear();
+    csr_val_LU.clear();
+
+    csr_row_ptr_LU[0] = base_LU;
+
+    for(rocsparse_int ai = 0; ai < M; ++ai)
+    {
+        rocsparse_int row_begin = csr_row_ptr[ai] - base;
+        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+
+        // Drop threshold, relative to the average magnitude of the row
+        floating_data_t<T> norm = static_cast<floating_data_t<T>>(0);
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            norm += std::abs(csr_val[j]);
+        }
+
+        if(row_end > row_begin)
+        {
+            norm /= (row_end - row_begin);
+        }
+
+        floating_data_t<T> threshold = tol * norm;
+
+        // Working row
+        std::map<rocsparse_int, T> w;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            w[csr_col_ind[j] - base] = csr_val[j];
+        }
+
+        // Eliminate the strictly lower part in ascending column order, fill-in is always
+        // inserted right of the current column
+        for(auto it = w.begin(); it != w.end() && it->first < ai; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            // Skip the remaining elimination, if row k has a zero pivot
+            if(csr_val_LU[diag_offset[k]] == static_cast<T>(0))
+            {
+                it->second = static_cast<T>(0);
+                break;
+            }
+
+            T mult = it->second / csr_val_LU[diag_offset[k]];
+
+            // Drop small multipliers
+            if(std::abs(mult) < threshold)
+            {
+                mult = static_cast<T>(0);
+            }
+
+            it->second = mult;
+
+            if(mult == static_cast<T>(0))
+            {
+                continue;
+            }
+
+            for(rocsparse_int j = diag_offset[k] + 1; j < csr_row_ptr_LU[k + 1] - base_LU; ++j)
+            {
+                rocsparse_int col = csr_col_ind_LU[j] - base_LU;
+                T             val = -mult * csr_val_LU[j];
+
+                auto wj = w.find(col);
+
+                if(wj != w.end())
+                {
+                    wj->second = wj->second + val;
+                }
+                else if(std::abs(val) >= threshold)
+                {
+                    // Small fill-in entries are dropped immediately
+                    w[col] = val;
+                }
+            }
+        }
+
+        // Keep the max_fill largest entries of the strictly lower and upper part, where ties
+        // are broken by the column index
+        std::vector<std::pair<floating_data_t<T>, rocsparse_int>> lower;
+        std::vector<std::pair<floating_data_t<T>, rocsparse_int>> upper;
+
+        T diag = static_cast<T>(0);
+
+        for(auto it = w.begin(); it != w.end(); ++it)
+        {
+            floating_data_t<T> val = std::abs(it->second);
+
+            if(it->first == ai)
+            {
+                diag = it->second;
+            }
+            else if(val >= threshold && val > static_cast<floating_data_t<T>>(0))
+            {
+                (it->first < ai ? lower : upper).push_back(std::make_pair(-val, it->first));
+            }
+        }
+
+        std::sort(lower.begin(), lower.end());
+        std::sort(upper.begin(), upper.end());
+
+        lower.resize(std::min(lower.size(), static_cast<size_t>(max_fill)));
+        upper.resize(std::min(upper.size(), static_cast<size_t>(max_fill)));
+
+        // The diagonal entry is always kept
+        if(boost)
+        {
+            diag = (boost_tol >= std::abs(diag)) ? boost_val : diag;
+        }
+        else if(diag == static_cast<T>(0))
+        {
+            // Numerical or structural zero pivot
+            *numeric_pivot = (*numeric_pivot == -1) ? ai + base : *numeric_pivot;
+        }
+
+        // Store the row, sorted by column index
+        std::vector<rocsparse_int> cols;
+
+        for(size_t j = 0; j < lower.size(); ++j)
+        {
+            cols.push_back(lower[j].second);
+        }
+
+        for(size_t j = 0; j < upper.size(); ++j)
+        {
+            cols.push_back(upper[j].second);
+        }
+
+        std::sort(cols.begin(), cols.end());
+
+        for(size_t j = 0; j < cols.size(); ++j)
+        {
+            if(j == lower.size())
+            {
+                diag_offset[ai] = csr_col_ind_LU.size();
+                csr_col_ind_LU.push_back(ai + base_LU);
+                csr_val_LU.push_back(diag);
+            }
+
+            csr_col_ind_LU.push_back(cols[j] + base_LU);
+            csr_val_LU.push_back(w[cols[j]]);
+        }
+
+        if(cols.size() == lower.size())
+        {
+            diag_offset[ai] = csr_col_ind_LU.size();
+            csr_col_ind_LU.push_back(ai + base_LU);
+            csr_val_LU.push_back(diag);
+        }
+
+        csr_row_ptr_LU[ai + 1] = csr_col_ind_LU.size() + base_LU;
+    }
+}
+
+template <typename T>
+void host_csrilu0_iterative(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            std::vector<T>&                   csr_val,
+                            rocsparse_index_base              base,
+                            rocsparse_int                     sweeps,
+                            floating_data_t<T>*               residual,
+                            rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *numeric_pivot = -1;
+
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    // Position of the diagonal entry of each row, -1 if not present
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base == i)
+            {
+                diag_offset[i] = j;
+                break;
+            }
+        }
+    }
+
+    // (LU)_ij restricted to k < min(i, j)
+    auto lu_sum = [&](rocsparse_int i, rocsparse_int col, const std::vector<T>& x) {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+        {
+            rocsparse_int col_k = csr_col_ind[k] - base;
+
+            if(col_k >= std::min(i, col))
+            {
+                break;
+            }
+
+            for(rocsparse_int l = csr_row_ptr[col_k] - base; l < csr_row_ptr[col_k + 1] - base;
+                ++l)
+            {
+                if(csr_col_ind[l] - base == col)
+                {
+                    sum = std::fma(x[k], x[l], sum);
+                    break;
+                }
+            }
+        }
+
+        return sum;
+    };
+
+    std::vector<T> a(csr_val);
+    std::vector<T> x(nnz);
+    std::vector<T> x_new(nnz);
+
+    // Initial guess
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            x[j] = a[j];
+
+            if(col < i && diag_offset[col] != -1 && a[diag_offset[col]] != static_cast<T>(0))
+            {
+                x[j] = a[j] / a[diag_offset[col]];
+            }
+        }
+    }
+
+    // Fixed-point sweeps
+    for(rocsparse_int s = 0; s < sweeps; ++s)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+                T             sum = a[j] - lu_sum(i, col, x);
+
+                if(col < i)
+                {
+                    T pivot = (diag_offset[col] == -1) ? static_cast<T>(0) : x[diag_offset[col]];
+
+                    x_new[j] = (pivot != static_cast<T>(0)) ? sum / pivot : x[j];
+                }
+                else
+                {
+                    x_new[j] = sum;
+                }
+            }
+        }
+
+        x.swap(x_new);
+    }
+
+    // Frobenius norm of A - LU on the sparsity pattern
+    floating_data_t<T> res = static_cast<floating_data_t<T>>(0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+            T             sum = lu_sum(i, col, x);
+
+            if(col < i)
+            {
+                if(diag_offset[col] != -1)
+                {
+                    sum = std::fma(x[j], x[diag_offset[col]], sum);
+                }
+            }
+            else
+            {
+                sum = sum + x[j];
+
+                if(col == i && x[j] == static_cast<T>(0))
+                {
+                    *numeric_pivot = (*numeric_pivot == -1) ? i + base
+                                                            : std::min(*numeric_pivot, i + base);
+                }
+            }
+
+            floating_data_t<T> abs_res = std::abs(a[j] - sum);
+
+            res += abs_res * abs_res;
+        }
+    }
+
+    *residual = std::sqrt(res);
+
+    csr_val = x;
+}
+
+template <typename T>
+void host_csric0_iterative(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           std::vector<T>&                   csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     sweeps,
+                           floating_data_t<T>*               residual,
+                           rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *numeric_pivot = -1;
+
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    // Position of the diagonal entry of each row, -1 if not present
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base == i)
+            {
+                diag_offset[i] = j;
+                break;
+            }
+        }
+    }
+
+    // (LL^H)_ij restricted to k < j
+    auto ll_sum = [&](rocsparse_int i, rocsparse_int col, const std::vector<T>& x) {
+        T sum = static_cast<T>(0);
+
+        rocsparse_int k     = csr_row_ptr[i] - base;
+        rocsparse_int k_end = csr_row_ptr[i + 1] - base;
+        rocsparse_int l     = csr_row_ptr[col] - base;
+        rocsparse_int l_end = csr_row_ptr[col + 1] - base;
+
+        while(k < k_end && l < l_end)
+        {
+            rocsparse_int col_k = csr_col_ind[k] - base;
+            rocsparse_int col_l = csr_col_ind[l] - base;
+
+            if(col_k >= col || col_l >= col)
+            {
+                break;
+            }
+
+            if(col_k == col_l)
+            {
+                sum = std::fma(x[k], rocsparse_conj(x[l]), sum);
+
+                ++k;
+                ++l;
+            }
+            else if(col_k < col_l)
+            {
+                ++k;
+            }
+            else
+            {
+                ++l;
+            }
+        }
+
+        return sum;
+    };
+
+    std::vector<T> a(csr_val);
+    std::vector<T> x(nnz);
+    std::vector<T> x_new(nnz);
+
+    // Initial guess
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            x[j] = a[j];
+
+            if(col == i)
+            {
+                x[j] = static_cast<T>(std::sqrt(std::abs(a[j])));
+            }
+            else if(col < i && diag_offset[col] != -1
+                    && a[diag_offset[col]] != static_cast<T>(0))
+            {
+                x[j] = a[j] / static_cast<T>(std::sqrt(std::abs(a[diag_offset[col]])));
+            }
+        }
+    }
+
+    // Fixed-point sweeps, the strictly upper part is not modified
+    for(rocsparse_int s = 0; s < sweeps; ++s)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col > i)
+                {
+                    x_new[j] = x[j];
+                    continue;
+                }
+
+                T sum = a[j] - ll_sum(i, col, x);
+
+                if(col == i)
+                {
+                    x_new[j] = static_cast<T>(std::sqrt(std::abs(sum)));
+                }
+                else
+                {
+                    T pivot = (diag_offset[col] == -1) ? static_cast<T>(0) : x[diag_offset[col]];
+
+                    x_new[j] = (pivot != static_cast<T>(0)) ? sum / pivot : x[j];
+                }
+            }
+        }
+
+        x.swap(x_new);
+    }
+
+    // Frobenius norm of A - LL^H on the lower part of the sparsity pattern
+    floating_data_t<T> res = static_cast<floating_data_t<T>>(0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            if(col > i)
+            {
+                continue;
+            }
+
+            T sum = ll_sum(i, col, x);
+
+            if(diag_offset[col] != -1)
+            {
+                sum = std::fma(x[j], rocsparse_conj(x[diag_offset[col]]), sum);
+            }
+
+            if(col == i && x[j] == static_cast<T>(0))
+            {
+                *numeric_pivot = (*numeric_pivot == -1) ? i + base
+                                                        : std::min(*numeric_pivot, i + base);
+            }
+
+            floating_data_t<T> abs_res = std::abs(a[j] - sum);
+
+            res += abs_res * abs_res;
+        }
+    }
+
+    *residual = std::sqrt(res);
+
+    csr_val = x;
+}
+
+// Entries of each row sorted by the position of their column in the color reordering,
+// and the position of the diagonal entry within the sorted entries, -1 if not present
+static void host_csrmc_sort(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            const std::vector<rocsparse_int>& reordering,
+                            rocsparse_index_base              base,
+                            std::vector<rocsparse_int>&       entry_map,
+                            std::vector<rocsparse_int>&       diag_ind,
+                            rocsparse_int*                    zero_pivot)
+{
+    std::vector<rocsparse_int> pos(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        pos[reordering[i]] = i;
+    }
+
+    entry_map.resize(csr_row_ptr[M] - base);
+    diag_ind.assign(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr[i] - base;
+        rocsparse_int row_end   = csr_row_ptr[i + 1] - base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            entry_map[j] = j;
+        }
+
+        std::sort(entry_map.begin() + row_begin,
+                  entry_map.begin() + row_end,
+                  [&](rocsparse_int a, rocsparse_int b) {
+                      return pos[csr_col_ind[a] - base] < pos[csr_col_ind[b] - base];
+                  });
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            if(csr_col_ind[entry_map[j]] - base == i)
+            {
+                diag_ind[i] = j;
+                break;
+            }
+        }
+
+        if(diag_ind[i] == -1)
+        {
+            *zero_pivot = (*zero_pivot == -1) ? i + base : std::min(*zero_pivot, i + base);
+        }
+    }
+}
+
+template <typename T>
+void host_csrmcsor(rocsparse_int                     M,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   const std::vector<T>&             csr_val,
+                   const std::vector<rocsparse_int>& reordering,
+                   rocsparse_sor_sweep               sweep,
+                   T                                 omega,
+                   const std::vector<T>&             b,
+                   std::vector<T>&                   x,
+                   rocsparse_index_base              base,
+                   rocsparse_int*                    zero_pivot)
+{
+    // Initialize pivot
+    *zero_pivot = -1;
+
+    auto update = [&](rocsparse_int row) {
+        T sum  = static_cast<T>(0);
+        T diag = static_cast<T>(0);
+
+        for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            if(col == row)
+            {
+                diag = csr_val[j];
+            }
+            else
+            {
+                sum = std::fma(csr_val[j], x[col], sum);
+            }
+        }
+
+        if(diag == static_cast<T>(0))
+        {
+            *zero_pivot = (*zero_pivot == -1) ? row + base : std::min(*zero_pivot, row + base);
+        }
+        else
+        {
+            x[row] = std::fma(omega, (b[row] - sum) / diag - x[row], x[row]);
+        }
+    };
+
+    if(sweep != rocsparse_sor_sweep_backward)
+    {
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            update(reordering[i]);
+        }
+    }
+
+    if(sweep != rocsparse_sor_sweep_forward)
+    {
+        for(rocsparse_int i = M - 1; i >= 0; --i)
+        {
+            update(reordering[i]);
+        }
+    }
+}
+
+template <typename T>
+void host_csrmcilu0(rocsparse_int                     M,
+                    const std::vector<rocsparse_int>& csr_row_ptr,
+                    const std::vector<rocsparse_int>& csr_col_ind,
+                    std::vector<T>&                   csr_val,
+                    const std::vector<rocsparse_int>& reordering,
+                    rocsparse_index_base              base,
+                    rocsparse_int*                    zero_pivot)
+{
+    // Initialize pivot
+    *zero_pivot = -1;
+
+    std::vector<rocsparse_int> entry_map;
+    std::vector<rocsparse_int> diag_ind;
+
+    host_csrmc_sort(
+        M, csr_row_ptr, csr_col_ind, reordering, base, entry_map, diag_ind, zero_pivot);
+
+    // Column to entry map of the current row
+    std::vector<rocsparse_int> nnz_entries(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row       = reordering[i];
+        rocsparse_int row_begin = csr_row_ptr[row] - base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - base;
+
+        if(diag_ind[row] == -1)
+        {
+            continue;
+        }
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - base] = j;
+        }
+
+        for(rocsparse_int s = row_begin; s < diag_ind[row]; ++s)
+        {
+            rocsparse_int j          = entry_map[s];
+            rocsparse_int local_col  = csr_col_ind[j] - base;
+            rocsparse_int local_diag = diag_ind[local_col];
+
+            if(local_diag == -1)
+            {
+                break;
+            }
+
+            T diag_val = csr_val[entry_map[local_diag]];
+
+            if(diag_val == static_cast<T>(0))
+            {
+                *zero_pivot = (*zero_pivot == -1) ? local_col + base
+                                                  : std::min(*zero_pivot, local_col + base);
+                break;
+            }
+
+            csr_val[j] = csr_val[j] / diag_val;
+
+            for(rocsparse_int t = local_diag + 1; t < csr_row_ptr[local_col + 1] - base; ++t)
+            {
+                rocsparse_int k   = entry_map[t];
+                rocsparse_int idx = nnz_entries[csr_col_ind[k] - base];
+
+                if(idx != -1)
+                {
+                    csr_val[idx] = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
+                }
+            }
+        }
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - base] = -1;
+        }
+    }
+}
+
+template <typename T>
+void host_csrmcilu0_solve(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          const std::vector<rocsparse_int>& csr_col_ind,
+                          const std::vector<T>&             csr_val,
+                          const std::vector<rocsparse_int>& reordering,
+                          const std::vector<T>&             x,
+                          std::vector<T>&                   y,
+                          rocsparse_index_base              base,
+                          rocsparse_int*                    zero_pivot)
+{
+    // Initialize pivot
+    *zero_pivot = -1;
+
+    std::vector<rocsparse_int> entry_map;
+    std::vector<rocsparse_int> diag_ind;
+
+    host_csrmc_sort(
+        M, csr_row_ptr, csr_col_ind, reordering, base, entry_map, diag_ind, zero_pivot);
+
+    // Forward substitution with unit lower factor
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row = reordering[i];
+
+        if(diag_ind[row] == -1)
+        {
+            continue;
+        }
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int s = csr_row_ptr[row] - base; s < diag_ind[row]; ++s)
+        {
+            rocsparse_int j = entry_map[s];
+
+            sum = std::fma(csr_val[j], y[csr_col_ind[j] - base], sum);
+        }
+
+        y[row] = x[row] - sum;
+    }
+
+    // Backward substitution with upper factor
+    for(rocsparse_int i = M - 1; i >= 0; --i)
+    {
+        rocsparse_int row = reordering[i];
+
+        if(diag_ind[row] == -1)
+        {
+            continue;
+        }
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int s = diag_ind[row] + 1; s < csr_row_ptr[row + 1] - base; ++s)
+        {
+            rocsparse_int j = entry_map[s];
+
+            sum = std::fma(csr_val[j], y[csr_col_ind[j] - base], sum);
+        }
+
+        T diag_val = csr_val[entry_map[diag_ind[row]]];
+
+        if(diag_val == static_cast<T>(0))
+        {
+            *zero_pivot = (*zero_pivot == -1) ? row + base : std::min(*zero_pivot, row + base);
+        }
+        else
+        {
+            y[row] = (y[row] - sum) / diag_val;
+        }
+    }
+}
+
+template <typename T>
+static void host_csrpoly_spmv(rocsparse_int                     M,
+                              const std::vector<rocsparse_int>& csr_row_ptr,
+                              const std::vector<rocsparse_int>& csr_col_ind,
+                              const std::vector<T>&             csr_val,
+                              const std::vector<T>&             x,
+                              std::vector<T>&                   y,
+                              rocsparse_index_base              base)
+{
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            sum = std::fma(csr_val[j], x[csr_col_ind[j] - base], sum);
+        }
+
+        y[i] = sum;
+    }
+}
+
+template <typename T>
+void host_csrpoly(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_int                     degree,
+                  const std::vector<T>&             coeff,
+                  const std::vector<T>&             x,
+                  std::vector<T>&                   y,
+                  rocsparse_index_base              base)
+{
+    // Sum of monomials, A^i x is computed from A^{i-1} x
+    std::vector<T> p(x.begin(), x.begin() + M);
+    std::vector<T> q(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        y[i] = coeff[0] * p[i];
+    }
+
+    for(rocsparse_int k = 1; k <= degree; ++k)
+    {
+        host_csrpoly_spmv(M, csr_row_ptr, csr_col_ind, csr_val, p, q, base);
+        p.swap(q);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            y[i] = std::fma(coeff[k], p[i], y[i]);
+        }
+    }
+}
+
+template <typename T>
+void host_csrpoly_chebyshev(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            const std::vector<T>&             csr_val,
+                            rocsparse_int                     degree,
+                            floating_data_t<T>                lambda_min,
+                            floating_data_t<T>                lambda_max,
+                            const std::vector<T>&             x,
+                            std::vector<T>&                   y,
+                            rocsparse_index_base              base)
+{
+    // Chebyshev iteration with search direction d, starting from z_0 = 0
+    floating_data_t<T> theta = (lambda_max + lambda_min) / 2;
+    floating_data_t<T> delta = (lambda_max - lambda_min) / 2;
+    floating_data_t<T> sigma = theta / delta;
+    floating_data_t<T> rho   = 1 / sigma;
+
+    std::vector<T> d(M);
+    std::vector<T> r(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        d[i] = x[i] / static_cast<T>(theta);
+        y[i] = d[i];
+    }
+
+    for(rocsparse_int k = 0; k < degree; ++k)
+    {
+        host_csrpoly_spmv(M, csr_row_ptr, csr_col_ind, csr_val, y, r, base);
+
+        floating_data_t<T> rho_new = 1 / (2 * sigma - rho);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            d[i] = static_cast<T>(rho_new * rho) * d[i]
+                   + static_cast<T>(2 * rho_new / delta) * (x[i] - r[i]);
+            y[i] += d[i];
+        }
+
+        rho = rho_new;
+    }
+}
+
+template <typename T>
+void host_csrfsai(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr_A,
+                  const std::vector<rocsparse_int>& csr_col_ind_A,
+                  const std::vector<T>&             csr_val_A,
+                  const std::vector<rocsparse_int>& csr_row_ptr_S,
+                  const std::vector<rocsparse_int>& csr_col_ind_S,
+                  std::vector<rocsparse_int>&       csr_row_ptr_G,
+                  std::vector<rocsparse_int>&       csr_col_ind_G,
+                  std::vector<T>&                   csr_val_G,
+                  rocsparse_int*                    zero_pivot,
+                  rocsparse_int*                    truncated_rows,
+                  rocsparse_index_base              base_A,
+                  rocsparse_index_base              base_S,
+                  rocsparse_index_base              base_G)
+{
+    // Maximum number of entries per row of G
+    static constexpr rocsparse_int max_dim = 32;
+
+    *zero_pivot     = -1;
+    *truncated_rows = 0;
+
+    // Position of the diagonal in each row of S, all entries before are strictly lower
+    std::vector<rocsparse_int> S_diag(M);
+
+    csr_row_ptr_G.resize(M + 1);
+    csr_row_ptr_G[0] = base_G;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr_S[i] - base_S;
+        rocsparse_int row_end   = csr_row_ptr_S[i + 1] - base_S;
+
+        S_diag[i] = row_begin;
+
+        while(S_diag[i] < row_end && csr_col_ind_S[S_diag[i]] - base_S < i)
+        {
+            ++S_diag[i];
+        }
+
+        if(S_diag[i] - row_begin >= max_dim)
+        {
+            ++*truncated_rows;
+        }
+
+        csr_row_ptr_G[i + 1] = csr_row_ptr_G[i] + std::min(S_diag[i] - row_begin, max_dim - 1) + 1;
+    }
+
+    rocsparse_int nnz_G = csr_row_ptr_G[M] - base_G;
+
+    csr_col_ind_G.resize(nnz_G);
+    csr_val_G.resize(nnz_G);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int G_begin = csr_row_ptr_G[i] - base_G;
+        rocsparse_int n       = csr_row_ptr_G[i + 1] - base_G - G_begin;
+
+        // Sparsity pattern J of row i
+        std::vector<rocsparse_int> J(n);
+
+        for(rocsparse_int k = 0; k < n - 1; ++k)
+        {
+            J[k] = csr_col_ind_S[S_diag[i] - n + 1 + k] - base_S;
+        }
+
+        J[n - 1] = i;
+
+        // Gather A(J,J)
+        std::vector<T> A(n * n, static_cast<T>(0));
+
+        for(rocsparse_int r = 0; r < n; ++r)
+        {
+            for(rocsparse_int j = csr_row_ptr_A[J[r]] - base_A;
+                j < csr_row_ptr_A[J[r] + 1] - base_A;
+                ++j)
+            {
+                auto it = std::lower_bound(J.begin(), J.end(), csr_col_ind_A[j] - base_A);
+
+                if(it != J.end() && *it == csr_col_ind_A[j] - base_A)
+                {
+                    A[n * r + (it - J.begin())] = csr_val_A[j];
+                }
+            }
+        }
+
+        // Solve A(J,J) g = e_i by Gaussian elimination without pivoting
+        bool singular = false;
+
+        for(rocsparse_int k = 0; k < n; ++k)
+        {
+            if(A[n * k + k] == static_cast<T>(0))
+            {
+                singular = true;
+                break;
+            }
+
+            for(rocsparse_int r = k + 1; r < n; ++r)
+            {
+                T f = A[n * r + k] / A[n * k + k];
+
+                for(rocsparse_int c = k + 1; c < n; ++c)
+                {
+                    A[n * r + c] -= f * A[n * k + c];
+                }
+            }
+        }
+
+        std::vector<T> g(n, static_cast<T>(0));
+        g[n - 1] = static_cast<T>(1);
+
+        if(!singular)
+        {
+            for(rocsparse_int k = n - 1; k >= 0; --k)
+            {
+                g[k] /= A[n * k + k];
+
+                for(rocsparse_int r = 0; r < k; ++r)
+                {
+                    g[r] -= A[n * r + k] * g[k];
+                }
+            }
+        }
+
+        floating_data_t<T> gii = std::real(g[n - 1]);
+
+        // Rows that cannot be computed fall back to the unit row
+        if(singular || !(gii > 0))
+        {
+            if(*zero_pivot == -1)
+            {
+                *zero_pivot = i + base_A;
+            }
+
+            std::fill(g.begin(), g.end(), static_cast<T>(0));
+
+            g[n - 1] = static_cast<T>(1);
+            gii      = 1;
+        }
+
+        for(rocsparse_int k = 0; k < n; ++k)
+        {
+            csr_col_ind_G[G_begin + k] = J[k] + base_G;
+            csr_val_G[G_begin + k]     = rocsparse_conj(g[k]) / static_cast<T>(std::sqrt(gii));
+        }
+    }
+}
+
+// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
+template <typename T>
+void host_gtsv_no_pivot(rocsparse_int         m,
+                        rocsparse_int         n,
+                        const std::vector<T>& dl,
+                        const std::vector<T>& d,
+                        const std::vector<T>& du,
+                        std::vector<T>&       B,
+                        rocsparse_int         ldb)
+{
+    rocsparse_int BLOCKSIZE = 0;
+    if((m & (m - 1)) == 0)
+    {
+        BLOCKSIZE = m;
+    }
+    else
+    {
+        BLOCKSIZE = pow(2, static_cast<rocsparse_int>(log2(m)) + 1);
+    }
+
+    for(rocsparse_int col = 0; col < n; col++)
+    {
+        rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
+        rocsparse_int stride = 1;
+
+        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+
+        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> x(BLOCKSIZE, static_cast<T>(0));
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
+            a[i]   = dl[i];
+            b[i]   = d[i];
+            c[i]   = du[i];
+            rhs[i] = B[ldb * col + i];
+        }
+
+        for(rocsparse_int j = 0; j < iter; j++)
+        {
+            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            {
+                rocsparse_int right = tid + stride;
+                if(right >= m)
+                    right = m - 1;
+
+                rocsparse_int left = tid - stride;
+                if(left < 0)
+                    left = 0;
+
+                T k1 = a[tid] / b[left];
+                T k2 = c[tid] / b[right];
+
+                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
+                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
+                T ta   = -a[left] * k1;
+                T tc   = -c[right] * k2;
+
+                sb[tid]   = tb;
+                srhs[tid] = trhs;
+                sa[tid]   = ta;
+                sc[tid]   = tc;
+            }
+
+            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            {
+                a[tid]   = sa[tid];
+                b[tid]   = sb[tid];
+                c[tid]   = sc[tid];
+                rhs[tid] = srhs[tid];
+            }
+
+            stride *= 2;
+        }
+
+        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+        {
+            if(tid < BLOCKSIZE / 2)
+            {
+                rocsparse_int i = tid;
+                rocsparse_int j = tid + stride;
+
+                if(j < m)
+                {
+                    // Solve 2x2 systems
+                    T det = b[j] * b[i] - c[i] * a[j];
+                    x[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
+                    x[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
+                }
+                else
+                {
+                    // Solve 1x1 systems
+                    x[i] = rhs[i] / b[i];
+                }
+            }
+        }
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
+            B[ldb * col + i] = x[i];
+        }
+    }
+}
+
+// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
+template <typename T>
+void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
+                                      const std::vector<T>& dl,
+                                      const std::vector<T>& d,
+                                      const std::vector<T>& du,
+                                      std::vector<T>&       x,
+                                      rocsparse_int         batch_count,
+                                      rocsparse_int         batch_stride)
+{
+    rocsparse_int BLOCKSIZE = 0;
+    if((m & (m - 1)) == 0)
+    {
+        BLOCKSIZE = m;
+    }
+    else
+    {
+        BLOCKSIZE = pow(2, static_cast<rocsparse_int>(log2(m)) + 1);
+    }
+
+    for(rocsparse_int col = 0; col < batch_count; col++)
+    {
+        rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
+        rocsparse_int stride = 1;
+
+        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+
+        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> y(BLOCKSIZE, static_cast<T>(0));
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
+            a[i]   = dl[batch_stride * col + i];
+            b[i]   = d[batch_stride * col + i];
+            c[i]   = du[batch_stride * col + i];
+            rhs[i] = x[batch_stride * col + i];
+        }
+
+        for(rocsparse_int j = 0; j < iter; j++)
+        {
+            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            {
+                rocsparse_int right = tid + stride;
+                if(right >= m)
+                    right = m - 1;
+
+                rocsparse_int left = tid - stride;
+                if(left < 0)
+                    left = 0;
+
+                T k1 = a[tid] / b[left];
+                T k2 = c[tid] / b[right];
+
+                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
+                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
+                T ta   = -a[left] * k1;
+                T tc   = -c[right] * k2;
+
+                sb[tid]   = tb;
+                srhs[tid] = trhs;
+                sa[tid]   = ta;
+                sc[tid]   = tc;
+            }
+
+            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            {
+                a[tid]   = sa[tid];
+                b[tid]   = sb[tid];
+                c[tid]   = sc[tid];
+                rhs[tid] = srhs[tid];
+            }
+
+            stride *= 2;
+        }
+
+        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+        {
+            if(tid < BLOCKSIZE / 2)
+            {
+                rocsparse_int i = tid;
+                rocsparse_int j = tid + stride;
+
+                if(j < m)
+                {
+                    // Solve 2x2 systems
+                    T det = b[j] * b[i] - c[i] * a[j];
+                    y[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
+                    y[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
+                }
+                else
+                {
+                    // Solve 1x1 systems
+                    y[i] = rhs[i] / b[i];
+                }
+            }
+        }
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
+            x[batch_stride * col + i] = y[i];
+        }
+    }
+}
+
+template <typename T>
+static inline void host_interleaved_batch_givens(T a, T b, T& c, T& s)
+{
+    floating_data_t<T> norm = std::hypot(std::abs(a), std::abs(b));
+
+    if(norm == 0)
+    {
+        c = static_cast<T>(1);
+        s = static_cast<T>(0);
+    }
+    else
+    {
+        c = a / static_cast<T>(norm);
+        s = b / static_cast<T>(norm);
+    }
+}
+
+template <typename T>
+void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                 rocsparse_int                  m,
+                                 std::vector<T>&                dl,
+                                 std::vector<T>&                d,
+                                 std::vector<T>&                du,
+                                 std::vector<T>&                x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride)
+{
+    if(alg == rocsparse_gtsv_interleaved_alg_pcr)
+    {
+        // Parallel cyclic reduction, all equations are reduced simultaneously
+        std::vector<T> a(m * batch_count);
+        std::vector<T> b(m * batch_count);
+        std::vector<T> c(m * batch_count);
+        std::vector<T> rhs(m * batch_count);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            for(rocsparse_int j = 0; j < batch_count; ++j)
+            {
+                a[batch_count * i + j]   = dl[batch_stride * i + j];
+                b[batch_count * i + j]   = d[batch_stride * i + j];
+                c[batch_count * i + j]   = du[batch_stride * i + j];
+                rhs[batch_count * i + j] = x[batch_stride * i + j];
+            }
+        }
+
+        std::vector<T> sa(m * batch_count);
+        std::vector<T> sb(m * batch_count);
+        std::vector<T> sc(m * batch_count);
+        std::vector<T> srhs(m * batch_count);
+
+        for(rocsparse_int stride = 1; stride < m; stride <<= 1)
+        {
+            for(rocsparse_int i = 0; i < m; ++i)
+            {
+                for(rocsparse_int j = 0; j < batch_count; ++j)
+                {
+                    rocsparse_int idx = batch_count * i + j;
+
+                    T ai = a[idx];
+                    T bi = b[idx];
+                    T ci = c[idx];
+                    T ri = rhs[idx];
+                    T an = static_cast<T>(0);
+                    T cn = static_cast<T>(0);
+
+                    if(i - stride >= 0)
+                    {
+                        rocsparse_int left  = idx - batch_count * stride;
+                        T             alpha = -ai / b[left];
+
+                        an = alpha * a[left];
+                        bi = bi + alpha * c[left];
+                        ri = ri + alpha * rhs[left];
+                    }
+
+                    if(i + stride < m)
+                    {
+                        rocsparse_int right = idx + batch_count * stride;
+                        T             gamma = -ci / b[right];
+
+                        cn = gamma * c[right];
+                        bi = bi + gamma * a[right];
+                        ri = ri + gamma * rhs[right];
+                    }
+
+                    sa[idx]   = an;
+                    sb[idx]   = bi;
+                    sc[idx]   = cn;
+                    srhs[idx] = ri;
+                }
+            }
+
+            a.swap(sa);
+            b.swap(sb);
+            c.swap(sc);
+            rhs.swap(srhs);
+        }
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            for(rocsparse_int j = 0; j < batch_count; ++j)
+            {
+                x[batch_stride * i + j] = rhs[batch_count * i + j] / b[batch_count * i + j];
+            }
+        }
+
+        return;
+    }
+
+    for(rocsparse_int j = 0; j < batch_count; ++j)
+    {
+        if(alg == rocsparse_gtsv_interleaved_alg_thomas)
+        {
+            // Thomas algorithm without pivoting
+            T cp = du[j] / d[j];
+            T xp = x[j] / d[j];
+
+            du[j] = cp;
+            x[j]  = xp;
+
+            for(rocsparse_int i = 1; i < m; ++i)
+            {
+                rocsparse_int idx = batch_stride * i + j;
+
+                T a     = dl[idx];
+                T denom = d[idx] - a * cp;
+
+                cp = (i < m - 1) ? du[idx] / denom : static_cast<T>(0);
+                xp = (x[idx] - a * xp) / denom;
+
+                du[idx] = cp;
+                x[idx]  = xp;
+            }
+
+            for(rocsparse_int i = m - 2; i >= 0; --i)
+            {
+                rocsparse_int idx = batch_stride * i + j;
+
+                xp     = x[idx] - du[idx] * xp;
+                x[idx] = xp;
+            }
+
+            continue;
+        }
+
+        // LU with partial pivoting or QR, the second super diagonal is stored in dl
+        T di  = d[j];
+        T dui = du[j];
+        T bi  = x[j];
+
+        for(rocsparse_int i = 0; i < m - 1; ++i)
+        {
+            rocsparse_int idx  = batch_stride * i + j;
+            rocsparse_int idx1 = idx + batch_stride;
+
+            T dl1 = dl[idx1];
+            T d1  = d[idx1];
+            T du1 = (i < m - 2) ? du[idx1] : static_cast<T>(0);
+            T b1  = x[idx1];
+
+            if(alg == rocsparse_gtsv_interleaved_alg_lu)
+            {
+                if(std::abs(di) >= std::abs(dl1))
+                {
+                    T fact = (di != static_cast<T>(0)) ? dl1 / di : static_cast<T>(0);
+
+                    d[idx]  = di;
+                    du[idx] = dui;
+                    dl[idx] = static_cast<T>(0);
+                    x[idx]  = bi;
+
+                    di  = d1 - fact * dui;
+                    dui = du1;
+                    bi  = b1 - fact * bi;
+                }
+                else
+                {
+                    T fact = di / dl1;
+
+                    d[idx]  = dl1;
+                    du[idx] = d1;
+                    dl[idx] = du1;
+                    x[idx]  = b1;
+
+                    di  = dui - fact * d1;
+                    dui = -fact * du1;
+                    bi  = bi - fact * b1;
+                }
+            }
+            else
+            {
+                T c;
+                T s;
+                host_interleaved_batch_givens(di, dl1, c, s);
+
+                d[idx]  = rocsparse_conj(c) * di + rocsparse_conj(s) * dl1;
+                du[idx] = rocsparse_conj(c) * dui + rocsparse_conj(s) * d1;
+                dl[idx] = rocsparse_conj(s) * du1;
+                x[idx]  = rocsparse_conj(c) * bi + rocsparse_conj(s) * b1;
+
+                di  = c * d1 - s * dui;
+                dui = c * du1;
+                bi  = c * b1 - s * bi;
+            }
+        }
+
+        // Back substitution
+        T xp1 = bi / di;
+        T xp2 = static_cast<T>(0);
+
+        d[batch_stride * (m - 1) + j] = di;
+        x[batch_stride * (m - 1) + j] = xp1;
+
+        for(rocsparse_int i = m - 2; i >= 0; --i)
+        {
+            rocsparse_int idx = batch_stride * i + j;
+
+            T xi = (x[idx] - du[idx] * xp1 - dl[idx] * xp2) / d[idx];
+
+            x[idx] = xi;
+            xp2    = xp1;
+            xp1    = xi;
+        }
+    }
+}
+
+template <typename T>
+void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg alg,
+                                 rocsparse_int                  m,
+                                 std::vector<T>&                ds,
+                                 std::vector<T>&                dl,
+                                 std::vector<T>&                d,
+                                 std::vector<T>&                du,
+                                 std::vector<T>&                dw,
+                                 std::vector<T>&                x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride)
+{
+    // QR using Givens rotations, rows i, i + 1 and i + 2 are windows over the columns
+    // i, ..., i + 4
+    auto load = [&](rocsparse_int k, rocsparse_int j, T* v, T& b) {
+        if(k >= m)
+        {
+            for(int l = 0; l < 5; ++l)
+            {
+                v[l] = static_cast<T>(0);
+            }
+
+            b = static_cast<T>(0);
+
+            return;
         }
 
-        for(rocsparse_int i = 0; i < m; i++)
+        rocsparse_int idx = batch_stride * k + j;
+
+        v[0] = (k >= 2) ? ds[idx] : static_cast<T>(0);
+        v[1] = (k >= 1) ? dl[idx] : static_cast<T>(0);
+        v[2] = d[idx];
+        v[3] = (k + 1 < m) ? du[idx] : static_cast<T>(0);
+        v[4] = (k + 2 < m) ? dw[idx] : static_cast<T>(0);
+        b    = x[idx];
+    };
+
+    auto rotate = [](T c, T s, T* v, T* w, T& bv, T& bw) {
+        for(int k = 0; k < 5; ++k)
         {
-            B[ldb * col + i] = x[i];
+            T vk = v[k];
+            T wk = w[k];
+
+            v[k] = rocsparse_conj(c) * vk + rocsparse_conj(s) * wk;
+            w[k] = c * wk - s * vk;
         }
-    }
-}
 
-// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
-template <typename T>
-void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
-                                      const std::vector<T>& dl,
-                                      const std::vector<T>& d,
-                                      const std::vector<T>& du,
-                                      std::vector<T>&       x,
-                                      rocsparse_int         batch_count,
-                                      rocsparse_int         batch_stride)
-{
-    rocsparse_int BLOCKSIZE = 0;
-    if((m & (m - 1)) == 0)
-    {
-        BLOCKSIZE = m;
-    }
-    else
-    {
-        BLOCKSIZE = pow(2, static_cast<rocsparse_int>(log2(m)) + 1);
-    }
+        T tv = bv;
+        T tw = bw;
 
-    for(rocsparse_int col = 0; col < batch_count; col++)
-    {
-        rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
-        rocsparse_int stride = 1;
+        bv = rocsparse_conj(c) * tv + rocsparse_conj(s) * tw;
+        bw = c * tw - s * tv;
+    };
 
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+    for(rocsparse_int j = 0; j < batch_count; ++j)
+    {
+        T v0[5];
+        T v1[5];
+        T v2[5];
+        T b0;
+        T b1;
+        T b2;
+        T row[5];
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> y(BLOCKSIZE, static_cast<T>(0));
+        load(0, j, row, b0);
 
-        for(rocsparse_int i = 0; i < m; i++)
-        {
-            a[i]   = dl[batch_stride * col + i];
-            b[i]   = d[batch_stride * col + i];
-            c[i]   = du[batch_stride * col + i];
-            rhs[i] = x[batch_stride * col + i];
-        }
+        v0[0] = row[2];
+        v0[1] = row[3];
+        v0[2] = row[4];
+        v0[3] = static_cast<T>(0);
+        v0[4] = static_cast<T>(0);
 
-        for(rocsparse_int j = 0; j < iter; j++)
-        {
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                rocsparse_int right = tid + stride;
-                if(right >= m)
-                    right = m - 1;
+        load(1, j, row, b1);
 
-                rocsparse_int left = tid - stride;
-                if(left < 0)
-                    left = 0;
+        v1[0] = row[1];
+        v1[1] = row[2];
+        v1[2] = row[3];
+        v1[3] = row[4];
+        v1[4] = static_cast<T>(0);
 
-                T k1 = a[tid] / b[left];
-                T k2 = c[tid] / b[right];
+        load(2, j, v2, b2);
 
-                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
-                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
-                T ta   = -a[left] * k1;
-                T tc   = -c[right] * k2;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            T c;
+            T s;
 
-                sb[tid]   = tb;
-                srhs[tid] = trhs;
-                sa[tid]   = ta;
-                sc[tid]   = tc;
+            if(i + 2 < m)
+            {
+                host_interleaved_batch_givens(v1[0], v2[0], c, s);
+                rotate(c, s, v1, v2, b1, b2);
             }
 
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            if(i + 1 < m)
             {
-                a[tid]   = sa[tid];
-                b[tid]   = sb[tid];
-                c[tid]   = sc[tid];
-                rhs[tid] = srhs[tid];
+                host_interleaved_batch_givens(v0[0], v1[0], c, s);
+                rotate(c, s, v0, v1, b0, b1);
             }
 
-            stride *= 2;
-        }
+            rocsparse_int idx = batch_stride * i + j;
 
-        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-        {
-            if(tid < BLOCKSIZE / 2)
-            {
-                rocsparse_int i = tid;
-                rocsparse_int j = tid + stride;
+            d[idx]  = v0[0];
+            du[idx] = v0[1];
+            dw[idx] = v0[2];
+            dl[idx] = v0[3];
+            ds[idx] = v0[4];
+            x[idx]  = b0;
 
-                if(j < m)
-                {
-                    // Solve 2x2 systems
-                    T det = b[j] * b[i] - c[i] * a[j];
-                    y[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
-                    y[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
-                }
-                else
-                {
-                    // Solve 1x1 systems
-                    y[i] = rhs[i] / b[i];
-                }
+            for(int k = 0; k < 4; ++k)
+            {
+                v0[k] = v1[k + 1];
+                v1[k] = v2[k + 1];
             }
+
+            v0[4] = static_cast<T>(0);
+            v1[4] = static_cast<T>(0);
+            b0    = b1;
+            b1    = b2;
+
+            load(i + 3, j, v2, b2);
         }
 
-        for(rocsparse_int i = 0; i < m; i++)
+        // Back substitution
+        T xp1 = static_cast<T>(0);
+        T xp2 = static_cast<T>(0);
+        T xp3 = static_cast<T>(0);
+        T xp4 = static_cast<T>(0);
+
+        for(rocsparse_int i = m - 1; i >= 0; --i)
         {
-            x[batch_stride * col + i] = y[i];
+            rocsparse_int idx = batch_stride * i + j;
+
+            T xi = (x[idx] - du[idx] * xp1 - dw[idx] * xp2 - dl[idx] * xp3 - ds[idx] * xp4)
+                   / d[idx];
+
+            x[idx] = xi;
+            xp4    = xp3;
+            xp3    = xp2;
+            xp2    = xp1;
+            xp1    = xi;
         }
     }
 }
@@ -5679,6 +7462,41 @@ void host_csr_to_hyb(rocsparse_int                     M,
             ell_width             = std::max(ell_width, row_nnz);
         }
     }
+    else if(part == rocsparse_hyb_partition_histogram)
+    {
+        // Modelled hybmv cost in bytes
+        auto cost = [&](rocsparse_int width, rocsparse_int nnz_coo) {
+            return static_cast<int64_t>(M) * width * (sizeof(rocsparse_int) + sizeof(T))
+                   + static_cast<int64_t>(nnz_coo) * (2 * sizeof(rocsparse_int) + sizeof(T));
+        };
+
+        rocsparse_int width_limit = 2 * (nnz - 1) / M + 1;
+
+        ell_width        = 0;
+        int64_t min_cost = cost(0, nnz);
+
+        // Pick the ELL width with minimal modelled cost
+        for(rocsparse_int width = 1; width <= width_limit; ++width)
+        {
+            rocsparse_int nnz_coo = 0;
+            for(rocsparse_int i = 0; i < M; ++i)
+            {
+                nnz_coo += std::max(csr_row_ptr[i + 1] - csr_row_ptr[i] - width, 0);
+            }
+
+            if(cost(width, nnz_coo) < min_cost)
+            {
+                min_cost  = cost(width, nnz_coo);
+                ell_width = width;
+            }
+        }
+
+        // Determine COO nnz
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            coo_nnz += std::max(csr_row_ptr[i + 1] - csr_row_ptr[i] - ell_width, 0);
+        }
+    }
 
     // ELL nnz
     ell_nnz = ell_width * M;
@@ -6047,6 +7865,168 @@ void host_coosort_by_column(rocsparse_int               M,
     }
 }
 
+void host_csrrcm(rocsparse_int                     M,
+                 const std::vector<rocsparse_int>& csr_row_ptr,
+                 const std::vector<rocsparse_int>& csr_col_ind,
+                 std::vector<rocsparse_int>&       perm,
+                 rocsparse_index_base              base)
+{
+    perm.resize(M);
+
+    // Vertex degrees, self loops are not counted
+    std::vector<rocsparse_int> degree(M, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base != i)
+            {
+                ++degree[i];
+            }
+        }
+    }
+
+    // Vertices sorted by degree
+    std::vector<rocsparse_int> sorted(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        sorted[i] = i;
+    }
+
+    std::stable_sort(sorted.begin(), sorted.end(), [&](rocsparse_int a, rocsparse_int b) {
+        return degree[a] < degree[b];
+    });
+
+    std::vector<bool> numbered(M, false);
+
+    rocsparse_int pos = 0;
+
+    // Isolated vertices are numbered first
+    while(pos < M && degree[sorted[pos]] == 0)
+    {
+        numbered[sorted[pos]] = true;
+        perm[pos]             = sorted[pos];
+        ++pos;
+    }
+
+    // Level structure of all vertices that have not been numbered and can be
+    // reached from root
+    auto level_structure = [&](rocsparse_int                            root,
+                               std::vector<std::vector<rocsparse_int>>& levels) {
+        std::vector<bool> visited(M, false);
+
+        levels.assign(1, std::vector<rocsparse_int>(1, root));
+        visited[root] = true;
+
+        while(true)
+        {
+            std::vector<rocsparse_int> next;
+
+            for(rocsparse_int row : levels.back())
+            {
+                for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base;
+                    ++j)
+                {
+                    rocsparse_int col = csr_col_ind[j] - base;
+
+                    if(!visited[col] && !numbered[col])
+                    {
+                        visited[col] = true;
+                        next.push_back(col);
+                    }
+                }
+            }
+
+            if(next.empty())
+            {
+                break;
+            }
+
+            levels.push_back(next);
+        }
+    };
+
+    rocsparse_int start = pos;
+
+    while(pos < M)
+    {
+        // Unnumbered vertex of minimum degree
+        while(numbered[sorted[start]])
+        {
+            ++start;
+        }
+
+        rocsparse_int root = sorted[start];
+
+        // Pseudo-peripheral node (George and Liu)
+        std::vector<std::vector<rocsparse_int>> levels;
+        level_structure(root, levels);
+
+        while(levels.size() > 1)
+        {
+            // Vertex of minimum degree in the last level
+            rocsparse_int candidate = M;
+
+            for(rocsparse_int v : levels.back())
+            {
+                if(candidate == M || degree[v] < degree[candidate]
+                   || (degree[v] == degree[candidate] && v < candidate))
+                {
+                    candidate = v;
+                }
+            }
+
+            std::vector<std::vector<rocsparse_int>> candidate_levels;
+            level_structure(candidate, candidate_levels);
+
+            if(candidate_levels.size() <= levels.size())
+            {
+                break;
+            }
+
+            root = candidate;
+            levels.swap(candidate_levels);
+        }
+
+        // Cuthill-McKee numbering
+        numbered[root] = true;
+        perm[pos]      = root;
+
+        rocsparse_int end = pos + 1;
+
+        for(rocsparse_int k = pos; k < end; ++k)
+        {
+            rocsparse_int row   = perm[k];
+            rocsparse_int first = end;
+
+            for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(!numbered[col])
+                {
+                    numbered[col] = true;
+                    perm[end++]   = col;
+                }
+            }
+
+            // Neighbors are numbered by increasing degree
+            std::sort(perm.begin() + first,
+                      perm.begin() + end,
+                      [&](rocsparse_int a, rocsparse_int b) {
+                          return degree[a] < degree[b] || (degree[a] == degree[b] && a < b);
+                      });
+        }
+
+        pos = end;
+    }
+
+    // Reverse Cuthill-McKee ordering
+    std::reverse(perm.begin(), perm.end());
+}
+
 // INSTANTIATE
 
 template struct rocsparse_host<float, int32_t, int32_t>;
@@ -6371,6 +8351,28 @@ template void host_bsrilu0(rocsparse_direction               dir,
                            float                             boost_tol,
                            float                             boost_val);
 
+template void host_bsrdiag_inverse(rocsparse_direction               dir,
+                                   rocsparse_int                     mb,
+                                   const std::vector<rocsparse_int>& bsr_row_ptr,
+                                   const std::vector<rocsparse_int>& bsr_col_ind,
+                                   const std::vector<float>&         bsr_val,
+                                   rocsparse_int                     block_dim,
+                                   rocsparse_bsrdiag_inverse_alg     alg,
+                                   std::vector<float>&               inv_val,
+                                   std::vector<rocsparse_int>&       inv_row_ptr,
+                                   std::vector<rocsparse_int>&       inv_col_ind,
+                                   rocsparse_index_base              base,
+                                   rocsparse_int*                    zero_pivot);
+
+template void host_bsrdiag_inverse_apply(rocsparse_direction       dir,
+                                         rocsparse_int             mb,
+                                         float                     alpha,
+                                         const std::vector<float>& inv_val,
+                                         rocsparse_int             block_dim,
+                                         const std::vector<float>& x,
+                                         float                     beta,
+                                         std::vector<float>&       y);
+
 template void host_csric0(rocsparse_int                     M,
                           const std::vector<rocsparse_int>& csr_row_ptr,
                           const std::vector<rocsparse_int>& csr_col_ind,
@@ -6390,6 +8392,126 @@ template void host_csrilu0(rocsparse_int                     M,
                            float                             boost_tol,
                            float                             boost_val);
 
+template void host_csrildl0(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            std::vector<float>&               csr_val,
+                            rocsparse_index_base              base,
+                            rocsparse_int*                    struct_pivot,
+                            rocsparse_int*                    numeric_pivot,
+                            bool                              boost,
+                            float                             boost_tol,
+                            float                             boost_val);
+
+template void host_csrildl0_solve(rocsparse_int                     M,
+                                  float                             alpha,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  const std::vector<float>&         csr_val,
+                                  const std::vector<float>&         x,
+                                  std::vector<float>&               y,
+                                  rocsparse_index_base              base);
+
+template void host_csrilut(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<float>&         csr_val,
+                           rocsparse_index_base              base,
+                           float                             tol,
+                           rocsparse_int                     max_fill,
+                           rocsparse_index_base              base_LU,
+                           std::vector<rocsparse_int>&       csr_row_ptr_LU,
+                           std::vector<rocsparse_int>&       csr_col_ind_LU,
+                           std::vector<float>&               csr_val_LU,
+                           rocsparse_int*                    numeric_pivot,
+                           bool                              boost,
+                           float                             boost_tol,
+                           float                             boost_val);
+
+template void host_csrilu0_iterative(rocsparse_int                     M,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     std::vector<float>&               csr_val,
+                                     rocsparse_index_base              base,
+                                     rocsparse_int                     sweeps,
+                                     float*                            residual,
+                                     rocsparse_int*                    numeric_pivot);
+
+template void host_csric0_iterative(rocsparse_int                     M,
+                                    const std::vector<rocsparse_int>& csr_row_ptr,
+                                    const std::vector<rocsparse_int>& csr_col_ind,
+                                    std::vector<float>&               csr_val,
+                                    rocsparse_index_base              base,
+                                    rocsparse_int                     sweeps,
+                                    float*                            residual,
+                                    rocsparse_int*                    numeric_pivot);
+
+template void host_csrmcsor(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            const std::vector<float>&         csr_val,
+                            const std::vector<rocsparse_int>& reordering,
+                            rocsparse_sor_sweep               sweep,
+                            float                             omega,
+                            const std::vector<float>&         b,
+                            std::vector<float>&               x,
+                            rocsparse_index_base              base,
+                            rocsparse_int*                    zero_pivot);
+
+template void host_csrmcilu0(rocsparse_int                     M,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             std::vector<float>&               csr_val,
+                             const std::vector<rocsparse_int>& reordering,
+                             rocsparse_index_base              base,
+                             rocsparse_int*                    zero_pivot);
+
+template void host_csrmcilu0_solve(rocsparse_int                     M,
+                                   const std::vector<rocsparse_int>& csr_row_ptr,
+                                   const std::vector<rocsparse_int>& csr_col_ind,
+                                   const std::vector<float>&         csr_val,
+                                   const std::vector<rocsparse_int>& reordering,
+                                   const std::vector<float>&         x,
+                                   std::vector<float>&               y,
+                                   rocsparse_index_base              base,
+                                   rocsparse_int*                    zero_pivot);
+
+template void host_csrpoly(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<float>&         csr_val,
+                           rocsparse_int                     degree,
+                           const std::vector<float>&         coeff,
+                           const std::vector<float>&         x,
+                           std::vector<float>&               y,
+                           rocsparse_index_base              base);
+
+template void host_csrpoly_chebyshev(rocsparse_int                     M,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     const std::vector<float>&         csr_val,
+                                     rocsparse_int                     degree,
+                                     float                             lambda_min,
+                                     float                             lambda_max,
+                                     const std::vector<float>&         x,
+                                     std::vector<float>&               y,
+                                     rocsparse_index_base              base);
+
+template void host_csrfsai(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr_A,
+                           const std::vector<rocsparse_int>& csr_col_ind_A,
+                           const std::vector<float>&         csr_val_A,
+                           const std::vector<rocsparse_int>& csr_row_ptr_S,
+                           const std::vector<rocsparse_int>& csr_col_ind_S,
+                           std::vector<rocsparse_int>&       csr_row_ptr_G,
+                           std::vector<rocsparse_int>&       csr_col_ind_G,
+                           std::vector<float>&               csr_val_G,
+                           rocsparse_int*                    zero_pivot,
+                           rocsparse_int*                    truncated_rows,
+                           rocsparse_index_base              base_A,
+                           rocsparse_index_base              base_S,
+                           rocsparse_index_base              base_G);
+
 template void host_gtsv_no_pivot(rocsparse_int             m,
                                  rocsparse_int             n,
                                  const std::vector<float>& dl,
@@ -6406,6 +8528,26 @@ template void host_gtsv_no_pivot_strided_batch(rocsparse_int             m,
                                                rocsparse_int             batch_count,
                                                rocsparse_int             batch_stride);
 
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                          rocsparse_int                  m,
+                                          std::vector<float>&            dl,
+                                          std::vector<float>&            d,
+                                          std::vector<float>&            du,
+                                          std::vector<float>&            x,
+                                          rocsparse_int                  batch_count,
+                                          rocsparse_int                  batch_stride);
+
+template void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg alg,
+                                          rocsparse_int                  m,
+                                          std::vector<float>&            ds,
+                                          std::vector<float>&            dl,
+                                          std::vector<float>&            d,
+                                          std::vector<float>&            du,
+                                          std::vector<float>&            dw,
+                                          std::vector<float>&            x,
+                                          rocsparse_int                  batch_count,
+                                          rocsparse_int                  batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -6813,6 +8955,28 @@ template void host_bsrilu0(rocsparse_direction               dir,
                            double                            boost_tol,
                            double                            boost_val);
 
+template void host_bsrdiag_inverse(rocsparse_direction               dir,
+                                   rocsparse_int                     mb,
+                                   const std::vector<rocsparse_int>& bsr_row_ptr,
+                                   const std::vector<rocsparse_int>& bsr_col_ind,
+                                   const std::vector<double>&        bsr_val,
+                                   rocsparse_int                     block_dim,
+                                   rocsparse_bsrdiag_inverse_alg     alg,
+                                   std::vector<double>&              inv_val,
+                                   std::vector<rocsparse_int>&       inv_row_ptr,
+                                   std::vector<rocsparse_int>&       inv_col_ind,
+                                   rocsparse_index_base              base,
+                                   rocsparse_int*                    zero_pivot);
+
+template void host_bsrdiag_inverse_apply(rocsparse_direction        dir,
+                                         rocsparse_int              mb,
+                                         double                     alpha,
+                                         const std::vector<double>& inv_val,
+                                         rocsparse_int              block_dim,
+                                         const std::vector<double>& x,
+                                         double                     beta,
+                                         std::vector<double>&       y);
+
 template void host_csric0(rocsparse_int                     M,
                           const std::vector<rocsparse_int>& csr_row_ptr,
                           const std::vector<rocsparse_int>& csr_col_ind,
@@ -6832,6 +8996,126 @@ template void host_csrilu0(rocsparse_int                     M,
                            double                            boost_tol,
                            double                            boost_val);
 
+template void host_csrildl0(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            std::vector<double>&              csr_val,
+                            rocsparse_index_base              base,
+                            rocsparse_int*                    struct_pivot,
+                            rocsparse_int*                    numeric_pivot,
+                            bool                              boost,
+                            double                            boost_tol,
+                            double                            boost_val);
+
+template void host_csrildl0_solve(rocsparse_int                     M,
+                                  double                            alpha,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  const std::vector<double>&        csr_val,
+                                  const std::vector<double>&        x,
+                                  std::vector<double>&              y,
+                                  rocsparse_index_base              base);
+
+template void host_csrilut(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<double>&        csr_val,
+                           rocsparse_index_base              base,
+                           double                            tol,
+                           rocsparse_int                     max_fill,
+                           rocsparse_index_base              base_LU,
+                           std::vector<rocsparse_int>&       csr_row_ptr_LU,
+                           std::vector<rocsparse_int>&       csr_col_ind_LU,
+                           std::vector<double>&              csr_val_LU,
+                           rocsparse_int*                    numeric_pivot,
+                           bool                              boost,
+                           double                            boost_tol,
+                           double                            boost_val);
+
+template void host_csrilu0_iterative(rocsparse_int                     M,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     std::vector<double>&              csr_val,
+                                     rocsparse_index_base              base,
+                                     rocsparse_int                     sweeps,
+                                     double*                           residual,
+                                     rocsparse_int*                    numeric_pivot);
+
+template void host_csric0_iterative(rocsparse_int                     M,
+                                    const std::vector<rocsparse_int>& csr_row_ptr,
+                                    const std::vector<rocsparse_int>& csr_col_ind,
+                                    std::vector<double>&              csr_val,
+                                    rocsparse_index_base              base,
+                                    rocsparse_int                     sweeps,
+                                    double*                           residual,
+                                    rocsparse_int*                    numeric_pivot);
+
+template void host_csrmcsor(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            const std::vector<double>&        csr_val,
+                            const std::vector<rocsparse_int>& reordering,
+                            rocsparse_sor_sweep               sweep,
+                            double                            omega,
+                            const std::vector<double>&        b,
+                            std::vector<double>&              x,
+                            rocsparse_index_base              base,
+                            rocsparse_int*                    zero_pivot);
+
+template void host_csrmcilu0(rocsparse_int                     M,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             std::vector<double>&              csr_val,
+                             const std::vector<rocsparse_int>& reordering,
+                             rocsparse_index_base              base,
+                             rocsparse_int*                    zero_pivot);
+
+template void host_csrmcilu0_solve(rocsparse_int                     M,
+                                   const std::vector<rocsparse_int>& csr_row_ptr,
+                                   const std::vector<rocsparse_int>& csr_col_ind,
+                                   const std::vector<double>&        csr_val,
+                                   const std::vector<rocsparse_int>& reordering,
+                                   const std::vector<double>&        x,
+                                   std::vector<double>&              y,
+                                   rocsparse_index_base              base,
+                                   rocsparse_int*                    zero_pivot);
+
+template void host_csrpoly(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<double>&        csr_val,
+                           rocsparse_int                     degree,
+                           const std::vector<double>&        coeff,
+                           const std::vector<double>&        x,
+                           std::vector<double>&              y,
+                           rocsparse_index_base              base);
+
+template void host_csrpoly_chebyshev(rocsparse_int                     M,
+                                     const std::vector<rocsparse_int>& csr_row_ptr,
+                                     const std::vector<rocsparse_int>& csr_col_ind,
+                                     const std::vector<double>&        csr_val,
+                                     rocsparse_int                     degree,
+                                     double                            lambda_min,
+                                     double                            lambda_max,
+                                     const std::vector<double>&        x,
+                                     std::vector<double>&              y,
+                                     rocsparse_index_base              base);
+
+template void host_csrfsai(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr_A,
+                           const std::vector<rocsparse_int>& csr_col_ind_A,
+                           const std::vector<double>&        csr_val_A,
+                           const std::vector<rocsparse_int>& csr_row_ptr_S,
+                           const std::vector<rocsparse_int>& csr_col_ind_S,
+                           std::vector<rocsparse_int>&       csr_row_ptr_G,
+                           std::vector<rocsparse_int>&       csr_col_ind_G,
+                           std::vector<double>&              csr_val_G,
+                           rocsparse_int*                    zero_pivot,
+                           rocsparse_int*                    truncated_rows,
+                           rocsparse_index_base              base_A,
+                           rocsparse_index_base              base_S,
+                           rocsparse_index_base              base_G);
+
 template void host_gtsv_no_pivot(rocsparse_int              m,
                                  rocsparse_int              n,
                                  const std::vector<double>& dl,
@@ -6848,6 +9132,26 @@ template void host_gtsv_no_pivot_strided_batch(rocsparse_int              m,
                                                rocsparse_int              batch_count,
                                                rocsparse_int              batch_stride);
 
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                          rocsparse_int                  m,
+                                          std::vector<double>&           dl,
+                                          std::vector<double>&           d,
+                                          std::vector<double>&           du,
+                                          std::vector<double>&           x,
+                                          rocsparse_int                  batch_count,
+                                          rocsparse_int                  batch_stride);
+
+template void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg alg,
+                                          rocsparse_int                  m,
+                                          std::vector<double>&           ds,
+                                          std::vector<double>&           dl,
+                                          std::vector<double>&           d,
+                                          std::vector<double>&           du,
+                                          std::vector<double>&           dw,
+                                          std::vector<double>&           x,
+                                          rocsparse_int                  batch_count,
+                                          rocsparse_int                  batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -7256,6 +9560,28 @@ template void host_bsrilu0(rocsparse_direction                    dir,
                            double                                 boost_tol,
                            rocsparse_double_complex               boost_val);
 
+template void host_bsrdiag_inverse(rocsparse_direction                          dir,
+                                   rocsparse_int                                mb,
+                                   const std::vector<rocsparse_int>&            bsr_row_ptr,
+                                   const std::vector<rocsparse_int>&            bsr_col_ind,
+                                   const std::vector<rocsparse_double_complex>& bsr_val,
+                                   rocsparse_int                                block_dim,
+                                   rocsparse_bsrdiag_inverse_alg                alg,
+                                   std::vector<rocsparse_double_complex>&       inv_val,
+                                   std::vector<rocsparse_int>&                  inv_row_ptr,
+                                   std::vector<rocsparse_int>&                  inv_col_ind,
+                                   rocsparse_index_base                         base,
+                                   rocsparse_int*                               zero_pivot);
+
+template void host_bsrdiag_inverse_apply(rocsparse_direction                          dir,
+                                         rocsparse_int                                mb,
+                                         rocsparse_double_complex                     alpha,
+                                         const std::vector<rocsparse_double_complex>& inv_val,
+                                         rocsparse_int                                block_dim,
+                                         const std::vector<rocsparse_double_complex>& x,
+                                         rocsparse_double_complex                     beta,
+                                         std::vector<rocsparse_double_complex>&       y);
+
 template void host_csric0(rocsparse_int                          M,
                           const std::vector<rocsparse_int>&      csr_row_ptr,
                           const std::vector<rocsparse_int>&      csr_col_ind,
@@ -7275,6 +9601,126 @@ template void host_csrilu0(rocsparse_int                          M,
                            double                                 boost_tol,
                            rocsparse_double_complex               boost_val);
 
+template void host_csrildl0(rocsparse_int                               M,
+                            const std::vector<rocsparse_int>&           csr_row_ptr,
+                            const std::vector<rocsparse_int>&           csr_col_ind,
+                            std::vector<rocsparse_float_complex>&       csr_val,
+                            rocsparse_index_base                        base,
+                            rocsparse_int*                              struct_pivot,
+                            rocsparse_int*                              numeric_pivot,
+                            bool                                        boost,
+                            float                                       boost_tol,
+                            rocsparse_float_complex                     boost_val);
+
+template void host_csrildl0_solve(rocsparse_int                               M,
+                                  rocsparse_float_complex                     alpha,
+                                  const std::vector<rocsparse_int>&           csr_row_ptr,
+                                  const std::vector<rocsparse_int>&           csr_col_ind,
+                                  const std::vector<rocsparse_float_complex>& csr_val,
+                                  const std::vector<rocsparse_float_complex>& x,
+                                  std::vector<rocsparse_float_complex>&       y,
+                                  rocsparse_index_base                        base);
+
+template void host_csrilut(rocsparse_int                                M,
+                           const std::vector<rocsparse_int>&            csr_row_ptr,
+                           const std::vector<rocsparse_int>&            csr_col_ind,
+                           const std::vector<rocsparse_double_complex>& csr_val,
+                           rocsparse_index_base                         base,
+                           double                                       tol,
+                           rocsparse_int                                max_fill,
+                           rocsparse_index_base                         base_LU,
+                           std::vector<rocsparse_int>&                  csr_row_ptr_LU,
+                           std::vector<rocsparse_int>&                  csr_col_ind_LU,
+                           std::vector<rocsparse_double_complex>&       csr_val_LU,
+                           rocsparse_int*                               numeric_pivot,
+                           bool                                         boost,
+                           double                                       boost_tol,
+                           rocsparse_double_complex                     boost_val);
+
+template void host_csrilu0_iterative(rocsparse_int                          M,
+                                     const std::vector<rocsparse_int>&      csr_row_ptr,
+                                     const std::vector<rocsparse_int>&      csr_col_ind,
+                                     std::vector<rocsparse_double_complex>& csr_val,
+                                     rocsparse_index_base                   base,
+                                     rocsparse_int                          sweeps,
+                                     double*                                residual,
+                                     rocsparse_int*                         numeric_pivot);
+
+template void host_csric0_iterative(rocsparse_int                          M,
+                                    const std::vector<rocsparse_int>&      csr_row_ptr,
+                                    const std::vector<rocsparse_int>&      csr_col_ind,
+                                    std::vector<rocsparse_double_complex>& csr_val,
+                                    rocsparse_index_base                   base,
+                                    rocsparse_int                          sweeps,
+                                    double*                                residual,
+                                    rocsparse_int*                         numeric_pivot);
+
+template void host_csrmcsor(rocsparse_int                               M,
+                            const std::vector<rocsparse_int>&           csr_row_ptr,
+                            const std::vector<rocsparse_int>&           csr_col_ind,
+                            const std::vector<rocsparse_float_complex>& csr_val,
+                            const std::vector<rocsparse_int>&           reordering,
+                            rocsparse_sor_sweep                         sweep,
+                            rocsparse_float_complex                     omega,
+                            const std::vector<rocsparse_float_complex>& b,
+                            std::vector<rocsparse_float_complex>&       x,
+                            rocsparse_index_base                        base,
+                            rocsparse_int*                              zero_pivot);
+
+template void host_csrmcilu0(rocsparse_int                         M,
+                             const std::vector<rocsparse_int>&     csr_row_ptr,
+                             const std::vector<rocsparse_int>&     csr_col_ind,
+                             std::vector<rocsparse_float_complex>& csr_val,
+                             const std::vector<rocsparse_int>&     reordering,
+                             rocsparse_index_base                  base,
+                             rocsparse_int*                        zero_pivot);
+
+template void host_csrmcilu0_solve(rocsparse_int                               M,
+                                   const std::vector<rocsparse_int>&           csr_row_ptr,
+                                   const std::vector<rocsparse_int>&           csr_col_ind,
+                                   const std::vector<rocsparse_float_complex>& csr_val,
+                                   const std::vector<rocsparse_int>&           reordering,
+                                   const std::vector<rocsparse_float_complex>& x,
+                                   std::vector<rocsparse_float_complex>&       y,
+                                   rocsparse_index_base                        base,
+                                   rocsparse_int*                              zero_pivot);
+
+template void host_csrpoly(rocsparse_int                               M,
+                           const std::vector<rocsparse_int>&           csr_row_ptr,
+                           const std::vector<rocsparse_int>&           csr_col_ind,
+                           const std::vector<rocsparse_float_complex>& csr_val,
+                           rocsparse_int                               degree,
+                           const std::vector<rocsparse_float_complex>& coeff,
+                           const std::vector<rocsparse_float_complex>& x,
+                           std::vector<rocsparse_float_complex>&       y,
+                           rocsparse_index_base                        base);
+
+template void host_csrpoly_chebyshev(rocsparse_int                               M,
+                                     const std::vector<rocsparse_int>&           csr_row_ptr,
+                                     const std::vector<rocsparse_int>&           csr_col_ind,
+                                     const std::vector<rocsparse_float_complex>& csr_val,
+                                     rocsparse_int                               degree,
+                                     float                                       lambda_min,
+                                     float                                       lambda_max,
+                                     const std::vector<rocsparse_float_complex>& x,
+                                     std::vector<rocsparse_float_complex>&       y,
+                                     rocsparse_index_base                        base);
+
+template void host_csrfsai(rocsparse_int                               M,
+                           const std::vector<rocsparse_int>&           csr_row_ptr_A,
+                           const std::vector<rocsparse_int>&           csr_col_ind_A,
+                           const std::vector<rocsparse_float_complex>& csr_val_A,
+                           const std::vector<rocsparse_int>&           csr_row_ptr_S,
+                           const std::vector<rocsparse_int>&           csr_col_ind_S,
+                           std::vector<rocsparse_int>&                 csr_row_ptr_G,
+                           std::vector<rocsparse_int>&                 csr_col_ind_G,
+                           std::vector<rocsparse_float_complex>&       csr_val_G,
+                           rocsparse_int*                              zero_pivot,
+                           rocsparse_int*                              truncated_rows,
+                           rocsparse_index_base                        base_A,
+                           rocsparse_index_base                        base_S,
+                           rocsparse_index_base                        base_G);
+
 template void host_gtsv_no_pivot(rocsparse_int                                m,
                                  rocsparse_int                                n,
                                  const std::vector<rocsparse_double_complex>& dl,
@@ -7291,6 +9737,26 @@ template void host_gtsv_no_pivot_strided_batch(rocsparse_int
                                                rocsparse_int batch_count,
                                                rocsparse_int batch_stride);
 
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg         alg,
+                                          rocsparse_int                          m,
+                                          std::vector<rocsparse_double_complex>& dl,
+                                          std::vector<rocsparse_double_complex>& d,
+                                          std::vector<rocsparse_double_complex>& du,
+                                          std::vector<rocsparse_double_complex>& x,
+                                          rocsparse_int                          batch_count,
+                                          rocsparse_int                          batch_stride);
+
+template void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg         alg,
+                                          rocsparse_int                          m,
+                                          std::vector<rocsparse_double_complex>& ds,
+                                          std::vector<rocsparse_double_complex>& dl,
+                                          std::vector<rocsparse_double_complex>& d,
+                                          std::vector<rocsparse_double_complex>& du,
+                                          std::vector<rocsparse_double_complex>& dw,
+                                          std::vector<rocsparse_double_complex>& x,
+                                          rocsparse_int                          batch_count,
+                                          rocsparse_int                          batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -7650,6 +10116,28 @@ template void host_bsrilu0(rocsparse_direction                   dir,
                            float                                 boost_tol,
                            rocsparse_float_complex               boost_val);
 
+template void host_bsrdiag_inverse(rocsparse_direction                         dir,
+                                   rocsparse_int                               mb,
+                                   const std::vector<rocsparse_int>&           bsr_row_ptr,
+                                   const std::vector<rocsparse_int>&           bsr_col_ind,
+                                   const std::vector<rocsparse_float_complex>& bsr_val,
+                                   rocsparse_int                               block_dim,
+                                   rocsparse_bsrdiag_inverse_alg               alg,
+                                   std::vector<rocsparse_float_complex>&       inv_val,
+                                   std::vector<rocsparse_int>&                 inv_row_ptr,
+                                   std::vector<rocsparse_int>&                 inv_col_ind,
+                                   rocsparse_index_base                        base,
+                                   rocsparse_int*                              zero_pivot);
+
+template void host_bsrdiag_inverse_apply(rocsparse_direction                         dir,
+                                         rocsparse_int                               mb,
+                                         rocsparse_float_complex                     alpha,
+                                         const std::vector<rocsparse_float_complex>& inv_val,
+                                         rocsparse_int                               block_dim,
+                                         const std::vector<rocsparse_float_complex>& x,
+                                         rocsparse_float_complex                     beta,
+                                         std::vector<rocsparse_float_complex>&       y);
+
 template void host_csric0(rocsparse_int                         M,
                           const std::vector<rocsparse_int>&     csr_row_ptr,
                           const std::vector<rocsparse_int>&     csr_col_ind,
@@ -7669,6 +10157,126 @@ template void host_csrilu0(rocsparse_int                         M,
                            float                                 boost_tol,
                            rocsparse_float_complex               boost_val);
 
+template void host_csrildl0(rocsparse_int                                M,
+                            const std::vector<rocsparse_int>&            csr_row_ptr,
+                            const std::vector<rocsparse_int>&            csr_col_ind,
+                            std::vector<rocsparse_double_complex>&       csr_val,
+                            rocsparse_index_base                         base,
+                            rocsparse_int*                               struct_pivot,
+                            rocsparse_int*                               numeric_pivot,
+                            bool                                         boost,
+                            double                                       boost_tol,
+                            rocsparse_double_complex                     boost_val);
+
+template void host_csrildl0_solve(rocsparse_int                                M,
+                                  rocsparse_double_complex                     alpha,
+                                  const std::vector<rocsparse_int>&            csr_row_ptr,
+                                  const std::vector<rocsparse_int>&            csr_col_ind,
+                                  const std::vector<rocsparse_double_complex>& csr_val,
+                                  const std::vector<rocsparse_double_complex>& x,
+                                  std::vector<rocsparse_double_complex>&       y,
+                                  rocsparse_index_base                         base);
+
+template void host_csrilut(rocsparse_int                               M,
+                           const std::vector<rocsparse_int>&           csr_row_ptr,
+                           const std::vector<rocsparse_int>&           csr_col_ind,
+                           const std::vector<rocsparse_float_complex>& csr_val,
+                           rocsparse_index_base                        base,
+                           float                                       tol,
+                           rocsparse_int                               max_fill,
+                           rocsparse_index_base                        base_LU,
+                           std::vector<rocsparse_int>&                 csr_row_ptr_LU,
+                           std::vector<rocsparse_int>&                 csr_col_ind_LU,
+                           std::vector<rocsparse_float_complex>&       csr_val_LU,
+                           rocsparse_int*                              numeric_pivot,
+                           bool                                        boost,
+                           float                                       boost_tol,
+                           rocsparse_float_complex                     boost_val);
+
+template void host_csrilu0_iterative(rocsparse_int                         M,
+                                     const std::vector<rocsparse_int>&     csr_row_ptr,
+                                     const std::vector<rocsparse_int>&     csr_col_ind,
+                                     std::vector<rocsparse_float_complex>& csr_val,
+                                     rocsparse_index_base                  base,
+                                     rocsparse_int                         sweeps,
+                                     float*                                residual,
+                                     rocsparse_int*                        numeric_pivot);
+
+template void host_csric0_iterative(rocsparse_int                         M,
+                                    const std::vector<rocsparse_int>&     csr_row_ptr,
+                                    const std::vector<rocsparse_int>&     csr_col_ind,
+                                    std::vector<rocsparse_float_complex>& csr_val,
+                                    rocsparse_index_base                  base,
+                                    rocsparse_int                         sweeps,
+                                    float*                                residual,
+                                    rocsparse_int*                        numeric_pivot);
+
+template void host_csrmcsor(rocsparse_int                                M,
+                            const std::vector<rocsparse_int>&            csr_row_ptr,
+                            const std::vector<rocsparse_int>&            csr_col_ind,
+                            const std::vector<rocsparse_double_complex>& csr_val,
+                            const std::vector<rocsparse_int>&            reordering,
+                            rocsparse_sor_sweep                          sweep,
+                            rocsparse_double_complex                     omega,
+                            const std::vector<rocsparse_double_complex>& b,
+                            std::vector<rocsparse_double_complex>&       x,
+                            rocsparse_index_base                         base,
+                            rocsparse_int*                               zero_pivot);
+
+template void host_csrmcilu0(rocsparse_int                          M,
+                             const std::vector<rocsparse_int>&      csr_row_ptr,
+                             const std::vector<rocsparse_int>&      csr_col_ind,
+                             std::vector<rocsparse_double_complex>& csr_val,
+                             const std::vector<rocsparse_int>&      reordering,
+                             rocsparse_index_base                   base,
+                             rocsparse_int*                         zero_pivot);
+
+template void host_csrmcilu0_solve(rocsparse_int                                M,
+                                   const std::vector<rocsparse_int>&            csr_row_ptr,
+                                   const std::vector<rocsparse_int>&            csr_col_ind,
+                                   const std::vector<rocsparse_double_complex>& csr_val,
+                                   const std::vector<rocsparse_int>&            reordering,
+                                   const std::vector<rocsparse_double_complex>& x,
+                                   std::vector<rocsparse_double_complex>&       y,
+                                   rocsparse_index_base                         base,
+                                   rocsparse_int*                               zero_pivot);
+
+template void host_csrpoly(rocsparse_int                                M,
+                           const std::vector<rocsparse_int>&            csr_row_ptr,
+                           const std::vector<rocsparse_int>&            csr_col_ind,
+                           const std::vector<rocsparse_double_complex>& csr_val,
+                           rocsparse_int                                degree,
+                           const std::vector<rocsparse_double_complex>& coeff,
+                           const std::vector<rocsparse_double_complex>& x,
+                           std::vector<rocsparse_double_complex>&       y,
+                           rocsparse_index_base                         base);
+
+template void host_csrpoly_chebyshev(rocsparse_int                                M,
+                                     const std::vector<rocsparse_int>&            csr_row_ptr,
+                                     const std::vector<rocsparse_int>&            csr_col_ind,
+                                     const std::vector<rocsparse_double_complex>& csr_val,
+                                     rocsparse_int                                degree,
+                                     double                                       lambda_min,
+                                     double                                       lambda_max,
+                                     const std::vector<rocsparse_double_complex>& x,
+                                     std::vector<rocsparse_double_complex>&       y,
+                                     rocsparse_index_base                         base);
+
+template void host_csrfsai(rocsparse_int                                M,
+                           const std::vector<rocsparse_int>&            csr_row_ptr_A,
+                           const std::vector<rocsparse_int>&            csr_col_ind_A,
+                           const std::vector<rocsparse_double_complex>& csr_val_A,
+                           const std::vector<rocsparse_int>&            csr_row_ptr_S,
+                           const std::vector<rocsparse_int>&            csr_col_ind_S,
+                           std::vector<rocsparse_int>&                  csr_row_ptr_G,
+                           std::vector<rocsparse_int>&                  csr_col_ind_G,
+                           std::vector<rocsparse_double_complex>&       csr_val_G,
+                           rocsparse_int*                               zero_pivot,
+                           rocsparse_int*                               truncated_rows,
+                           rocsparse_index_base                         base_A,
+                           rocsparse_index_base                         base_S,
+                           rocsparse_index_base                         base_G);
+
 template void host_gtsv_no_pivot(rocsparse_int                               m,
                                  rocsparse_int                               n,
                                  const std::vector<rocsparse_float_complex>& dl,
@@ -7685,6 +10293,26 @@ template void host_gtsv_no_pivot_strided_batch(rocsparse_int
                                                rocsparse_int batch_count,
                                                rocsparse_int batch_stride);
 
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg        alg,
+                                          rocsparse_int                         m,
+                                          std::vector<rocsparse_float_complex>& dl,
+                                          std::vector<rocsparse_float_complex>& d,
+                                          std::vector<rocsparse_float_complex>& du,
+                                          std::vector<rocsparse_float_complex>& x,
+                                          rocsparse_int                         batch_count,
+                                          rocsparse_int                         batch_stride);
+
+template void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg        alg,
+                                          rocsparse_int                         m,
+                                          std::vector<rocsparse_float_complex>& ds,
+                                          std::vector<rocsparse_float_complex>& dl,
+                                          std::vector<rocsparse_float_complex>& d,
+                                          std::vector<rocsparse_float_complex>& du,
+                                          std::vector<rocsparse_float_complex>& dw,
+                                          std::vector<rocsparse_float_complex>& x,
+                                          rocsparse_int                         batch_count,
+                                          rocsparse_int                         batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -7988,6 +10616,18 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                                   rocsparse_index_base base,                     \
                                                   JTYPE*               struct_pivot,             \
                                                   JTYPE*               numeric_pivot);                         \
+    template void host_csritsv<ITYPE, JTYPE, TTYPE>(JTYPE                         M,             \
+                                                    TTYPE                         alpha,         \
+                                                    const ITYPE*                  csr_row_ptr,   \
+                                                    const JTYPE*                  csr_col_ind,   \
+                                                    const TTYPE*                  csr_val,       \
+                                                    const TTYPE*                  x,             \
+                                                    TTYPE*                        y,             \
+                                                    rocsparse_diag_type           diag_type,     \
+                                                    rocsparse_fill_mode           fill_mode,     \
+                                                    rocsparse_index_base          base,          \
+                                                    rocsparse_int*                sweeps,        \
+                                                    const floating_data_t<TTYPE>* tol);          \
     template void host_csrmv<ITYPE, JTYPE, TTYPE>(rocsparse_operation   trans,                   \
                                                   JTYPE                 M,                       \
                                                   JTYPE                 N,                       \
@@ -203,6 +203,30 @@ inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_spgemm_alg& p)
     return rocsparse_status_invalid_value;
 }
 
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_gtsv_interleaved_alg& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_gpsv_interleaved_alg& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_bsrdiag_inverse_alg& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
+template <>
+inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_sor_sweep& p)
+{
+    return rocsparse_status_invalid_value;
+}
+
 template <>
 inline rocsparse_status auto_testing_bad_arg_get_status(rocsparse_indextype& p)
 {
@@ -335,6 +359,30 @@ inline void auto_testing_bad_arg_set_invalid(rocsparse_spgemm_alg& p)
     p = (rocsparse_spgemm_alg)-1;
 }
 
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_gtsv_interleaved_alg& p)
+{
+    p = (rocsparse_gtsv_interleaved_alg)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_gpsv_interleaved_alg& p)
+{
+    p = (rocsparse_gpsv_interleaved_alg)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_bsrdiag_inverse_alg& p)
+{
+    p = (rocsparse_bsrdiag_inverse_alg)-1;
+}
+
+template <>
+inline void auto_testing_bad_arg_set_invalid(rocsparse_sor_sweep& p)
+{
+    p = (rocsparse_sor_sweep)-1;
+}
+
 template <>
 inline void auto_testing_bad_arg_set_invalid(rocsparse_indextype& p)
 {
@@ -322,6 +322,16 @@ constexpr double bsrilu0_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim,
            / 1e9;
 }
 
+template <typename T>
+constexpr double
+    bsrdiag_inverse_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim, rocsparse_int nnzb)
+{
+    // Read structure and diagonal blocks, write block diagonal matrix
+    return ((Mb + 1 + nnzb + Mb + 1 + Mb) * sizeof(rocsparse_int)
+            + 2.0 * block_dim * block_dim * Mb * sizeof(T))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double csric0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
 {
@@ -334,6 +344,47 @@ constexpr double csrilu0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
     return ((M + 1 + nnz) * sizeof(rocsparse_int) + 2.0 * nnz * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csrildl0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + 2.0 * nnz * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrmcsor_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    // Read reordering, structure, values and b, read and write x
+    return ((M + M + 1 + nnz) * sizeof(rocsparse_int) + (nnz + 3.0 * M) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrmcilu0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    // Read reordering, diagonal and sorted entry map in addition to csrilu0
+    return ((M + M + M + 1 + nnz + nnz) * sizeof(rocsparse_int) + 2.0 * nnz * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrpoly_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int degree)
+{
+    // Per degree, read structure, values, v, x and the previous output, write output
+    return (degree * ((M + 1 + nnz) * sizeof(rocsparse_int) + (nnz + 4.0 * M) * sizeof(T))
+            + 2.0 * M * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrfsai_gbyte_count(rocsparse_int M,
+                                     rocsparse_int nnz_A,
+                                     rocsparse_int nnz_S,
+                                     rocsparse_int nnz_G)
+{
+    // Read structure of S and G, write G, each entry of G gathers a row of A
+    return ((2.0 * (M + 1) + nnz_S + nnz_G) * sizeof(rocsparse_int) + nnz_G * sizeof(T)
+            + (M > 0 ? 1.0 * nnz_G * nnz_A / M : 0.0) * (sizeof(rocsparse_int) + sizeof(T)))
+           / 1e9;
+}
+
 template <typename T>
 constexpr double gtsv_gbyte_count(rocsparse_int M, rocsparse_int N)
 {
@@ -346,6 +397,12 @@ constexpr double gtsv_strided_batch_gbyte_count(rocsparse_int M, rocsparse_int N
     return ((3 * M * N + 2 * M * N) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double gpsv_interleaved_batch_gbyte_count(rocsparse_int M, rocsparse_int N)
+{
+    return ((5 * M * N + 2 * M * N) * sizeof(T)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -316,6 +316,36 @@ REAL_COMPLEX_TEMPLATE(csrsv_solve,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+// csritsv
+REAL_COMPLEX_TEMPLATE(csritsv_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_operation       trans,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csritsv_solve,
+                      rocsparse_handle          handle,
+                      rocsparse_operation       trans,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const T*                  alpha,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      const T*                  x,
+                      T*                        y,
+                      rocsparse_int*            sweeps,
+                      const floating_data_t<T>* tol,
+                      void*                     temp_buffer);
+
 // ellmv
 REAL_COMPLEX_TEMPLATE(ellmv,
                       rocsparse_handle          handle,
@@ -672,6 +702,183 @@ REAL_COMPLEX_TEMPLATE(csrgemm,
                       const rocsparse_mat_info  info_C,
                       void*                     temp_buffer);
 
+REAL_COMPLEX_TEMPLATE(csrgemm_chunked,
+                      rocsparse_handle                 handle,
+                      rocsparse_operation              trans_A,
+                      rocsparse_operation              trans_B,
+                      rocsparse_int                    m,
+                      rocsparse_int                    n,
+                      rocsparse_int                    k,
+                      const T*                         alpha,
+                      const rocsparse_mat_descr        descr_A,
+                      rocsparse_int                    nnz_A,
+                      const T*                         csr_val_A,
+                      const rocsparse_int*             csr_row_ptr_A,
+                      const rocsparse_int*             csr_col_ind_A,
+                      const rocsparse_mat_descr        descr_B,
+                      rocsparse_int                    nnz_B,
+                      const T*                         csr_val_B,
+                      const rocsparse_int*             csr_row_ptr_B,
+                      const rocsparse_int*             csr_col_ind_B,
+                      const T*                         beta,
+                      const rocsparse_mat_descr        descr_D,
+                      rocsparse_int                    nnz_D,
+                      const T*                         csr_val_D,
+                      const rocsparse_int*             csr_row_ptr_D,
+                      const rocsparse_int*             csr_col_ind_D,
+                      const rocsparse_mat_descr        descr_C,
+                      rocsparse_mat_info               info_C,
+                      size_t                           memory_budget,
+                      rocsparse_csrgemm_chunk_callback callback,
+                      void*                            user_data);
+
+REAL_COMPLEX_TEMPLATE(csrgemm_masked_buffer_size,
+                      rocsparse_handle             handle,
+                      rocsparse_operation          trans_A,
+                      rocsparse_operation          trans_B,
+                      rocsparse_csrgemm_mask       mask,
+                      rocsparse_csrgemm_masked_alg alg,
+                      rocsparse_int                m,
+                      rocsparse_int                n,
+                      rocsparse_int                k,
+                      const rocsparse_mat_descr    descr_A,
+                      rocsparse_int                nnz_A,
+                      const rocsparse_int*         csr_row_ptr_A,
+                      const rocsparse_int*         csr_col_ind_A,
+                      const rocsparse_mat_descr    descr_B,
+                      rocsparse_int                nnz_B,
+                      const rocsparse_int*         csr_row_ptr_B,
+                      const rocsparse_int*         csr_col_ind_B,
+                      const rocsparse_mat_descr    descr_M,
+                      rocsparse_int                nnz_M,
+                      const rocsparse_int*         csr_row_ptr_M,
+                      const rocsparse_int*         csr_col_ind_M,
+                      size_t*                      buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csrgemm_masked,
+                      rocsparse_handle             handle,
+                      rocsparse_operation          trans_A,
+                      rocsparse_operation          trans_B,
+                      rocsparse_csrgemm_mask       mask,
+                      rocsparse_csrgemm_masked_alg alg,
+                      rocsparse_int                m,
+                      rocsparse_int                n,
+                      rocsparse_int                k,
+                      const T*                     alpha,
+                      const rocsparse_mat_descr    descr_A,
+                      rocsparse_int                nnz_A,
+                      const T*                     csr_val_A,
+                      const rocsparse_int*         csr_row_ptr_A,
+                      const rocsparse_int*         csr_col_ind_A,
+                      const rocsparse_mat_descr    descr_B,
+                      rocsparse_int                nnz_B,
+                      const T*                     csr_val_B,
+                      const rocsparse_int*         csr_row_ptr_B,
+                      const rocsparse_int*         csr_col_ind_B,
+                      const rocsparse_mat_descr    descr_M,
+                      rocsparse_int                nnz_M,
+                      const rocsparse_int*         csr_row_ptr_M,
+                      const rocsparse_int*         csr_col_ind_M,
+                      const rocsparse_mat_descr    descr_C,
+                      T*                           csr_val_C,
+                      const rocsparse_int*         csr_row_ptr_C,
+                      rocsparse_int*               csr_col_ind_C,
+                      void*                        temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrrap_numeric,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             n,
+                      rocsparse_int             k,
+                      const rocsparse_mat_descr descr_R,
+                      rocsparse_int             nnz_R,
+                      const T*                  csr_val_R,
+                      const rocsparse_int*      csr_row_ptr_R,
+                      const rocsparse_int*      csr_col_ind_R,
+                      const rocsparse_mat_descr descr_A,
+                      rocsparse_int             nnz_A,
+                      const T*                  csr_val_A,
+                      const rocsparse_int*      csr_row_ptr_A,
+                      const rocsparse_int*      csr_col_ind_A,
+                      const rocsparse_mat_descr descr_P,
+                      rocsparse_int             nnz_P,
+                      const T*                  csr_val_P,
+                      const rocsparse_int*      csr_row_ptr_P,
+                      const rocsparse_int*      csr_col_ind_P,
+                      const rocsparse_mat_descr descr_C,
+                      T*                        csr_val_C,
+                      const rocsparse_int*      csr_row_ptr_C,
+                      const rocsparse_int*      csr_col_ind_C);
+
+REAL_COMPLEX_TEMPLATE(bsrgeam,
+                      rocsparse_handle          handle,
+                      rocsparse_direction       dir,
+                      rocsparse_int             mb,
+                      rocsparse_int             nb,
+                      rocsparse_int             block_dim,
+                      const T*                  alpha,
+                      const rocsparse_mat_descr descr_A,
+                      rocsparse_int             nnzb_A,
+                      const T*                  bsr_val_A,
+                      const rocsparse_int*      bsr_row_ptr_A,
+                      const rocsparse_int*      bsr_col_ind_A,
+                      const T*                  beta,
+                      const rocsparse_mat_descr descr_B,
+                      rocsparse_int             nnzb_B,
+                      const T*                  bsr_val_B,
+                      const rocsparse_int*      bsr_row_ptr_B,
+                      const rocsparse_int*      bsr_col_ind_B,
+                      const rocsparse_mat_descr descr_C,
+                      T*                        bsr_val_C,
+                      const rocsparse_int*      bsr_row_ptr_C,
+                      rocsparse_int*            bsr_col_ind_C);
+
+REAL_COMPLEX_TEMPLATE(bsrgemm,
+                      rocsparse_handle          handle,
+                      rocsparse_direction       dir,
+                      rocsparse_int             mb,
+                      rocsparse_int             nb,
+                      rocsparse_int             kb,
+                      rocsparse_int             block_dim,
+                      const T*                  alpha,
+                      const rocsparse_mat_descr descr_A,
+                      rocsparse_int             nnzb_A,
+                      const T*                  bsr_val_A,
+                      const rocsparse_int*      bsr_row_ptr_A,
+                      const rocsparse_int*      bsr_col_ind_A,
+                      const rocsparse_mat_descr descr_B,
+                      rocsparse_int             nnzb_B,
+                      const T*                  bsr_val_B,
+                      const rocsparse_int*      bsr_row_ptr_B,
+                      const rocsparse_int*      bsr_col_ind_B,
+                      const rocsparse_mat_descr descr_C,
+                      T*                        bsr_val_C,
+                      const rocsparse_int*      bsr_row_ptr_C,
+                      rocsparse_int*            bsr_col_ind_C);
+
+REAL_COMPLEX_TEMPLATE(csrgemm_nnz_estimate,
+                      rocsparse_handle          handle,
+                      rocsparse_operation       trans_A,
+                      rocsparse_operation       trans_B,
+                      rocsparse_int             m,
+                      rocsparse_int             n,
+                      rocsparse_int             k,
+                      const rocsparse_mat_descr descr_A,
+                      rocsparse_int             nnz_A,
+                      const rocsparse_int*      csr_row_ptr_A,
+                      const rocsparse_int*      csr_col_ind_A,
+                      const rocsparse_mat_descr descr_B,
+                      rocsparse_int             nnz_B,
+                      const rocsparse_int*      csr_row_ptr_B,
+                      const rocsparse_int*      csr_col_ind_B,
+                      rocsparse_int             sample_size,
+                      int64_t*                  nnz_C,
+                      int64_t*                  nnz_C_lower,
+                      int64_t*                  nnz_C_upper,
+                      rocsparse_int*            group_rows,
+                      int64_t*                  group_nnz,
+                      size_t*                   group_workspace);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -771,6 +978,34 @@ REAL_COMPLEX_TEMPLATE(bsrilu0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+// bsrdiag_inverse
+REAL_COMPLEX_TEMPLATE(bsrdiag_inverse,
+                      rocsparse_handle              handle,
+                      rocsparse_direction           dir,
+                      rocsparse_int                 mb,
+                      rocsparse_int                 nnzb,
+                      const rocsparse_mat_descr     descr,
+                      const T*                      bsr_val,
+                      const rocsparse_int*          bsr_row_ptr,
+                      const rocsparse_int*          bsr_col_ind,
+                      rocsparse_int                 block_dim,
+                      rocsparse_mat_info            info,
+                      rocsparse_bsrdiag_inverse_alg alg,
+                      T*                            inv_val,
+                      rocsparse_int*                inv_row_ptr,
+                      rocsparse_int*                inv_col_ind);
+
+REAL_COMPLEX_TEMPLATE(bsrdiag_inverse_apply,
+                      rocsparse_handle    handle,
+                      rocsparse_direction dir,
+                      rocsparse_int       mb,
+                      const T*            alpha,
+                      const T*            inv_val,
+                      rocsparse_int       block_dim,
+                      const T*            x,
+                      const T*            beta,
+                      T*                  y);
+
 // csric0
 REAL_COMPLEX_TEMPLATE(csric0_buffer_size,
                       rocsparse_handle          handle,
@@ -808,6 +1043,30 @@ REAL_COMPLEX_TEMPLATE(csric0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+// csric0_iterative
+REAL_COMPLEX_TEMPLATE(csric0_iterative_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csric0_iterative,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_int             sweeps,
+                      floating_data_t<T>*       residual,
+                      void*                     temp_buffer);
+
 // csrilu0
 REAL_COMPLEX_TEMPLATE(csrilu0_buffer_size,
                       rocsparse_handle          handle,
@@ -852,6 +1111,251 @@ REAL_COMPLEX_TEMPLATE(csrilu0,
                       rocsparse_solve_policy    policy,
                       void*                     temp_buffer);
 
+// csrildl0
+REAL_COMPLEX_TEMPLATE(csrildl0_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csrildl0_numeric_boost,
+                      rocsparse_handle          handle,
+                      rocsparse_mat_info        info,
+                      int                       enable_boost,
+                      const floating_data_t<T>* boost_tol,
+                      const T*                  boost_val);
+
+REAL_COMPLEX_TEMPLATE(csrildl0_analysis,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_analysis_policy analysis,
+                      rocsparse_solve_policy    solve,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrildl0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrildl0_solve,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const T*                  alpha,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      const T*                  x,
+                      T*                        y,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+// csriluk
+REAL_COMPLEX_TEMPLATE(csriluk,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             nnz_LU,
+                      const rocsparse_mat_descr descr_LU,
+                      T*                        csr_val_LU,
+                      const rocsparse_int*      csr_row_ptr_LU,
+                      const rocsparse_int*      csr_col_ind_LU,
+                      rocsparse_mat_info        info,
+                      rocsparse_solve_policy    policy,
+                      void*                     temp_buffer);
+
+// csrilut
+REAL_COMPLEX_TEMPLATE(csrilut_numeric_boost,
+                      rocsparse_handle          handle,
+                      rocsparse_mat_info        info,
+                      int                       enable_boost,
+                      const floating_data_t<T>* boost_tol,
+                      const T*                  boost_val);
+
+REAL_COMPLEX_TEMPLATE(csrilut_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_int             max_fill,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csrilut_nnz,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      const floating_data_t<T>* tol,
+                      rocsparse_int             max_fill,
+                      const rocsparse_mat_descr descr_LU,
+                      rocsparse_int*            csr_row_ptr_LU,
+                      rocsparse_int*            nnz_LU,
+                      rocsparse_mat_info        info,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrilut,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             max_fill,
+                      rocsparse_int             nnz_LU,
+                      const rocsparse_mat_descr descr_LU,
+                      T*                        csr_val_LU,
+                      const rocsparse_int*      csr_row_ptr_LU,
+                      rocsparse_int*            csr_col_ind_LU,
+                      void*                     temp_buffer);
+
+// csrilu0_iterative
+REAL_COMPLEX_TEMPLATE(csrilu0_iterative_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csrilu0_iterative,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_int             sweeps,
+                      floating_data_t<T>*       residual,
+                      void*                     temp_buffer);
+
+// csrmc
+REAL_COMPLEX_TEMPLATE(csrmcsor,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_sor_sweep       sweep,
+                      const T*                  omega,
+                      const T*                  b,
+                      T*                        x);
+
+REAL_COMPLEX_TEMPLATE(csrmcilu0,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      T*                        csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info);
+
+REAL_COMPLEX_TEMPLATE(csrmcilu0_solve,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      const T*                  x,
+                      T*                        y);
+
+// csrpoly
+REAL_COMPLEX_TEMPLATE(csrpoly_buffer_size,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      size_t*                   buffer_size);
+
+REAL_COMPLEX_TEMPLATE(csrpoly,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_int             degree,
+                      const T*                  coeff,
+                      const T*                  x,
+                      T*                        y,
+                      void*                     temp_buffer);
+
+REAL_COMPLEX_TEMPLATE(csrpoly_chebyshev,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      rocsparse_int             nnz,
+                      const rocsparse_mat_descr descr,
+                      const T*                  csr_val,
+                      const rocsparse_int*      csr_row_ptr,
+                      const rocsparse_int*      csr_col_ind,
+                      rocsparse_mat_info        info,
+                      rocsparse_int             degree,
+                      floating_data_t<T>        lambda_min,
+                      floating_data_t<T>        lambda_max,
+                      const T*                  x,
+                      T*                        y,
+                      void*                     temp_buffer);
+
+// csrfsai
+REAL_COMPLEX_TEMPLATE(csrfsai,
+                      rocsparse_handle          handle,
+                      rocsparse_int             m,
+                      const rocsparse_mat_descr descr_A,
+                      rocsparse_int             nnz_A,
+                      const T*                  csr_val_A,
+                      const rocsparse_int*      csr_row_ptr_A,
+                      const rocsparse_int*      csr_col_ind_A,
+                      const rocsparse_mat_descr descr_S,
+                      rocsparse_int             nnz_S,
+                      const rocsparse_int*      csr_row_ptr_S,
+                      const rocsparse_int*      csr_col_ind_S,
+                      rocsparse_mat_info        info,
+                      const rocsparse_mat_descr descr_G,
+                      T*                        csr_val_G,
+                      const rocsparse_int*      csr_row_ptr_G,
+                      rocsparse_int*            csr_col_ind_G);
+
 REAL_COMPLEX_TEMPLATE(gtsv_buffer_size,
                       rocsparse_handle handle,
                       rocsparse_int    m,
@@ -920,6 +1424,60 @@ REAL_COMPLEX_TEMPLATE(gtsv_no_pivot_strided_batch,
                       rocsparse_int    batch_stride,
                       void*            temp_buffer);
 
+// gtsv_interleaved_batch
+REAL_COMPLEX_TEMPLATE(gtsv_interleaved_batch_buffer_size,
+                      rocsparse_handle               handle,
+                      rocsparse_gtsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      const T*                       dl,
+                      const T*                       d,
+                      const T*                       du,
+                      const T*                       x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      size_t*                        buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gtsv_interleaved_batch,
+                      rocsparse_handle               handle,
+                      rocsparse_gtsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      T*                             dl,
+                      T*                             d,
+                      T*                             du,
+                      T*                             x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      void*                          temp_buffer);
+
+// gpsv_interleaved_batch
+REAL_COMPLEX_TEMPLATE(gpsv_interleaved_batch_buffer_size,
+                      rocsparse_handle               handle,
+                      rocsparse_gpsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      const T*                       ds,
+                      const T*                       dl,
+                      const T*                       d,
+                      const T*                       du,
+                      const T*                       dw,
+                      const T*                       x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      size_t*                        buffer_size);
+
+REAL_COMPLEX_TEMPLATE(gpsv_interleaved_batch,
+                      rocsparse_handle               handle,
+                      rocsparse_gpsv_interleaved_alg alg,
+                      rocsparse_int                  m,
+                      T*                             ds,
+                      T*                             dl,
+                      T*                             d,
+                      T*                             du,
+                      T*                             dw,
+                      T*                             x,
+                      rocsparse_int                  batch_count,
+                      rocsparse_int                  batch_stride,
+                      void*                          temp_buffer);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -100,6 +100,13 @@ struct Arguments
 
     rocsparse_int denseld;
 
+    rocsparse_int deterministic;
+
+    rocsparse_int graph;
+
+    rocsparse_int batch_count;
+    rocsparse_int batch_count_A;
+
     uint32_t algo;
 
     int    numericboost;
@@ -202,6 +209,10 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(timing);
         ROCSPARSE_FORMAT_CHECK(iters);
         ROCSPARSE_FORMAT_CHECK(denseld);
+        ROCSPARSE_FORMAT_CHECK(deterministic);
+        ROCSPARSE_FORMAT_CHECK(graph);
+        ROCSPARSE_FORMAT_CHECK(batch_count);
+        ROCSPARSE_FORMAT_CHECK(batch_count_A);
         ROCSPARSE_FORMAT_CHECK(algo);
         ROCSPARSE_FORMAT_CHECK(numericboost);
         ROCSPARSE_FORMAT_CHECK(boosttol);
@@ -396,6 +407,10 @@ private:
         print("timing", arg.timing);
         print("iters", arg.iters);
         print("denseld", arg.denseld);
+        print("deterministic", arg.deterministic);
+        print("graph", arg.graph);
+        print("batch_count", arg.batch_count);
+        print("batch_count_A", arg.batch_count_A);
         return str << " }\n";
     }
 };
@@ -197,6 +197,8 @@ constexpr auto rocsparse_partition2string(rocsparse_hyb_partition part)
         return "user";
     case rocsparse_hyb_partition_max:
         return "max";
+    case rocsparse_hyb_partition_histogram:
+        return "histogram";
     }
     return "invalid";
 }
@@ -219,6 +221,10 @@ constexpr auto rocsparse_solve2string(rocsparse_solve_policy policy)
     {
     case rocsparse_solve_policy_auto:
         return "auto";
+    case rocsparse_solve_policy_level_set:
+        return "level_set";
+    case rocsparse_solve_policy_sync_free:
+        return "sync_free";
     }
     return "invalid";
 }
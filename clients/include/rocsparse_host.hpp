@@ -27,6 +27,7 @@
 #define ROCSPARSE_HOST_HPP
 
 #include "rocsparse_test.hpp"
+#include "rocsparse_traits.hpp"
 
 #include <hip/hip_runtime_api.h>
 #include <limits>
@@ -636,6 +637,30 @@ void host_bsrilu0(rocsparse_direction               dir,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T>
+void host_bsrdiag_inverse(rocsparse_direction               dir,
+                          rocsparse_int                     mb,
+                          const std::vector<rocsparse_int>& bsr_row_ptr,
+                          const std::vector<rocsparse_int>& bsr_col_ind,
+                          const std::vector<T>&             bsr_val,
+                          rocsparse_int                     block_dim,
+                          rocsparse_bsrdiag_inverse_alg     alg,
+                          std::vector<T>&                   inv_val,
+                          std::vector<rocsparse_int>&       inv_row_ptr,
+                          std::vector<rocsparse_int>&       inv_col_ind,
+                          rocsparse_index_base              base,
+                          rocsparse_int*                    zero_pivot);
+
+template <typename T>
+void host_bsrdiag_inverse_apply(rocsparse_direction   dir,
+                                rocsparse_int         mb,
+                                T                     alpha,
+                                const std::vector<T>& inv_val,
+                                rocsparse_int         block_dim,
+                                const std::vector<T>& x,
+                                T                     beta,
+                                std::vector<T>&       y);
+
 template <typename T>
 void host_csric0(rocsparse_int                     M,
                  const std::vector<rocsparse_int>& csr_row_ptr,
@@ -657,6 +682,137 @@ void host_csrilu0(rocsparse_int                     M,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T, typename U>
+void host_csrildl0(rocsparse_int                     M,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   std::vector<T>&                   csr_val,
+                   rocsparse_index_base              base,
+                   rocsparse_int*                    struct_pivot,
+                   rocsparse_int*                    numeric_pivot,
+                   bool                              boost,
+                   U                                 boost_tol,
+                   T                                 boost_val);
+
+template <typename T>
+void host_csrildl0_solve(rocsparse_int                     M,
+                         T                                 alpha,
+                         const std::vector<rocsparse_int>& csr_row_ptr,
+                         const std::vector<rocsparse_int>& csr_col_ind,
+                         const std::vector<T>&             csr_val,
+                         const std::vector<T>&             x,
+                         std::vector<T>&                   y,
+                         rocsparse_index_base              base);
+
+template <typename T>
+void host_csrilut(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  floating_data_t<T>                tol,
+                  rocsparse_int                     max_fill,
+                  rocsparse_index_base              base_LU,
+                  std::vector<rocsparse_int>&       csr_row_ptr_LU,
+                  std::vector<rocsparse_int>&       csr_col_ind_LU,
+                  std::vector<T>&                   csr_val_LU,
+                  rocsparse_int*                    numeric_pivot,
+                  bool                              boost,
+                  floating_data_t<T>                boost_tol,
+                  T                                 boost_val);
+
+template <typename T>
+void host_csrilu0_iterative(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            std::vector<T>&                   csr_val,
+                            rocsparse_index_base              base,
+                            rocsparse_int                     sweeps,
+                            floating_data_t<T>*               residual,
+                            rocsparse_int*                    numeric_pivot);
+
+template <typename T>
+void host_csric0_iterative(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           std::vector<T>&                   csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     sweeps,
+                           floating_data_t<T>*               residual,
+                           rocsparse_int*                    numeric_pivot);
+
+template <typename T>
+void host_csrmcsor(rocsparse_int                     M,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   const std::vector<T>&             csr_val,
+                   const std::vector<rocsparse_int>& reordering,
+                   rocsparse_sor_sweep               sweep,
+                   T                                 omega,
+                   const std::vector<T>&             b,
+                   std::vector<T>&                   x,
+                   rocsparse_index_base              base,
+                   rocsparse_int*                    zero_pivot);
+
+template <typename T>
+void host_csrmcilu0(rocsparse_int                     M,
+                    const std::vector<rocsparse_int>& csr_row_ptr,
+                    const std::vector<rocsparse_int>& csr_col_ind,
+                    std::vector<T>&                   csr_val,
+                    const std::vector<rocsparse_int>& reordering,
+                    rocsparse_index_base              base,
+                    rocsparse_int*                    zero_pivot);
+
+template <typename T>
+void host_csrmcilu0_solve(rocsparse_int                     M,
+                          const std::vector<rocsparse_int>& csr_row_ptr,
+                          const std::vector<rocsparse_int>& csr_col_ind,
+                          const std::vector<T>&             csr_val,
+                          const std::vector<rocsparse_int>& reordering,
+                          const std::vector<T>&             x,
+                          std::vector<T>&                   y,
+                          rocsparse_index_base              base,
+                          rocsparse_int*                    zero_pivot);
+
+template <typename T>
+void host_csrpoly(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_int                     degree,
+                  const std::vector<T>&             coeff,
+                  const std::vector<T>&             x,
+                  std::vector<T>&                   y,
+                  rocsparse_index_base              base);
+
+template <typename T>
+void host_csrpoly_chebyshev(rocsparse_int                     M,
+                            const std::vector<rocsparse_int>& csr_row_ptr,
+                            const std::vector<rocsparse_int>& csr_col_ind,
+                            const std::vector<T>&             csr_val,
+                            rocsparse_int                     degree,
+                            floating_data_t<T>                lambda_min,
+                            floating_data_t<T>                lambda_max,
+                            const std::vector<T>&             x,
+                            std::vector<T>&                   y,
+                            rocsparse_index_base              base);
+
+template <typename T>
+void host_csrfsai(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr_A,
+                  const std::vector<rocsparse_int>& csr_col_ind_A,
+                  const std::vector<T>&             csr_val_A,
+                  const std::vector<rocsparse_int>& csr_row_ptr_S,
+                  const std::vector<rocsparse_int>& csr_col_ind_S,
+                  std::vector<rocsparse_int>&       csr_row_ptr_G,
+                  std::vector<rocsparse_int>&       csr_col_ind_G,
+                  std::vector<T>&                   csr_val_G,
+                  rocsparse_int*                    zero_pivot,
+                  rocsparse_int*                    truncated_rows,
+                  rocsparse_index_base              base_A,
+                  rocsparse_index_base              base_S,
+                  rocsparse_index_base              base_G);
+
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
@@ -675,6 +831,28 @@ void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
                                       rocsparse_int         batch_count,
                                       rocsparse_int         batch_stride);
 
+template <typename T>
+void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                 rocsparse_int                  m,
+                                 std::vector<T>&                dl,
+                                 std::vector<T>&                d,
+                                 std::vector<T>&                du,
+                                 std::vector<T>&                x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride);
+
+template <typename T>
+void host_gpsv_interleaved_batch(rocsparse_gpsv_interleaved_alg alg,
+                                 rocsparse_int                  m,
+                                 std::vector<T>&                ds,
+                                 std::vector<T>&                dl,
+                                 std::vector<T>&                d,
+                                 std::vector<T>&                du,
+                                 std::vector<T>&                dw,
+                                 std::vector<T>&                x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -961,4 +1139,10 @@ void host_coosort_by_column(rocsparse_int               M,
                             std::vector<rocsparse_int>& coo_col_ind,
                             std::vector<T>&             coo_val);
 
+void host_csrrcm(rocsparse_int                     M,
+                 const std::vector<rocsparse_int>& csr_row_ptr,
+                 const std::vector<rocsparse_int>& csr_col_ind,
+                 std::vector<rocsparse_int>&       perm,
+                 rocsparse_index_base              base);
+
 #endif // ROCSPARSE_HOST_HPP
@@ -0,0 +1,374 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_bsrdiag_inverse_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+    const T             h_alpha   = static_cast<T>(1);
+    const T             h_beta    = static_cast<T>(1);
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle              handle      = local_handle;
+    rocsparse_direction           dir         = rocsparse_direction_row;
+    rocsparse_int                 mb          = safe_size;
+    rocsparse_int                 nnzb        = safe_size;
+    const rocsparse_mat_descr     descr       = local_descr;
+    const T*                      bsr_val     = (const T*)0x4;
+    const rocsparse_int*          bsr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*          bsr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int                 block_dim   = 4;
+    rocsparse_mat_info            info        = local_info;
+    rocsparse_bsrdiag_inverse_alg alg         = rocsparse_bsrdiag_inverse_alg_default;
+    T*                            inv_val     = (T*)0x4;
+    rocsparse_int*                inv_row_ptr = (rocsparse_int*)0x4;
+    rocsparse_int*                inv_col_ind = (rocsparse_int*)0x4;
+    const T*                      alpha       = (const T*)&h_alpha;
+    const T*                      x           = (const T*)0x4;
+    const T*                      beta        = (const T*)&h_beta;
+    T*                            y           = (T*)0x4;
+
+#define PARAMS                                                                             \
+    handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, alg, \
+        inv_val, inv_row_ptr, inv_col_ind
+#define PARAMS_APPLY handle, dir, mb, alpha, inv_val, block_dim, x, beta, y
+
+    auto_testing_bad_arg(rocsparse_bsrdiag_inverse<T>, PARAMS);
+    auto_testing_bad_arg(rocsparse_bsrdiag_inverse_apply<T>, PARAMS_APPLY);
+
+#undef PARAMS
+#undef PARAMS_APPLY
+
+    // Test rocsparse_bsrdiag_inverse_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Block dimensions exceeding 32 are not supported
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse<T>(handle,
+                                                         dir,
+                                                         mb,
+                                                         nnzb,
+                                                         descr,
+                                                         bsr_val,
+                                                         bsr_row_ptr,
+                                                         bsr_col_ind,
+                                                         33,
+                                                         info,
+                                                         alg,
+                                                         inv_val,
+                                                         inv_row_ptr,
+                                                         inv_col_ind),
+                            rocsparse_status_not_implemented);
+}
+
+template <typename T>
+void testing_bsrdiag_inverse(const Arguments& arg)
+{
+    static constexpr bool       to_int    = false;
+    static constexpr bool       full_rank = false;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    rocsparse_int                 M         = arg.M;
+    rocsparse_int                 N         = arg.N;
+    rocsparse_int                 block_dim = arg.block_dim;
+    rocsparse_bsrdiag_inverse_alg alg       = (rocsparse_bsrdiag_inverse_alg)arg.algo;
+    rocsparse_index_base          base      = arg.baseA;
+    rocsparse_direction           direction = arg.direction;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>()), h_beta(arg.get_beta<T>());
+
+    rocsparse_int Mb = -1;
+    rocsparse_int Nb = -1;
+    if(block_dim > 0)
+    {
+        Mb = (M + block_dim - 1) / block_dim;
+        Nb = (N + block_dim - 1) / block_dim;
+    }
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(Mb <= 0 || block_dim <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       pivot;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse<T>(handle,
+                                                             direction,
+                                                             Mb,
+                                                             safe_size,
+                                                             descr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             block_dim,
+                                                             info,
+                                                             alg,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr),
+                                (Mb < 0 || block_dim <= 0) ? rocsparse_status_invalid_size
+                                                           : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_bsrdiag_inverse_apply<T>(
+                handle, direction, Mb, h_alpha, nullptr, block_dim, nullptr, h_beta, nullptr),
+            (Mb < 0 || block_dim <= 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse_zero_pivot(handle, info, &pivot),
+                                rocsparse_status_success);
+        return;
+    }
+
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate host memory for BSR matrix
+    host_vector<rocsparse_int> hbsr_row_ptr;
+    host_vector<rocsparse_int> hbsr_col_ind;
+    host_vector<T>             hbsr_val;
+
+    // Generate BSR matrix on host (or read from file)
+    rocsparse_int nnzb;
+    matrix_factory.init_bsr(
+        hbsr_row_ptr, hbsr_col_ind, hbsr_val, direction, Mb, Nb, nnzb, block_dim, base);
+
+    M = Mb * block_dim;
+
+    // Host dense vectors
+    host_vector<T> hx(M);
+    host_vector<T> hy_1(M);
+    host_vector<T> hy_2(M);
+
+    rocsparse_init<T>(hx, 1, M, 1);
+    rocsparse_init<T>(hy_1, 1, M, 1);
+
+    hy_2 = hy_1;
+
+    host_vector<T> hy_gold(hy_1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dbsr_row_ptr(Mb + 1);
+    device_vector<rocsparse_int> dbsr_col_ind(nnzb);
+    device_vector<T>             dbsr_val(size_t(nnzb) * block_dim * block_dim);
+    device_vector<rocsparse_int> dinv_row_ptr(Mb + 1);
+    device_vector<rocsparse_int> dinv_col_ind(Mb);
+    device_vector<T>             dinv_val(size_t(Mb) * block_dim * block_dim);
+    device_vector<T>             dx(M);
+    device_vector<T>             dy_1(M);
+    device_vector<T>             dy_2(M);
+    device_vector<rocsparse_int> dpivot_2(1);
+
+    // Copy data from host to device
+    dbsr_row_ptr.transfer_from(hbsr_row_ptr);
+    dbsr_col_ind.transfer_from(hbsr_col_ind);
+    dbsr_val.transfer_from(hbsr_val);
+    dx.transfer_from(hx);
+    dy_1.transfer_from(hy_1);
+    dy_2.transfer_from(hy_2);
+
+#define PARAMS                                                                           \
+    handle, direction, Mb, nnzb, descr, dbsr_val, dbsr_row_ptr, dbsr_col_ind, block_dim, \
+        info, alg, dinv_val, dinv_row_ptr, dinv_col_ind
+
+    if(block_dim > 32)
+    {
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse<T>(PARAMS),
+                                rocsparse_status_not_implemented);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hpivot_1(1);
+        host_vector<rocsparse_int> hpivot_2(1);
+        host_vector<rocsparse_int> hpivot_gold(1);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse<T>(PARAMS));
+        {
+            auto st = rocsparse_bsrdiag_inverse_zero_pivot(handle, info, hpivot_1);
+            EXPECT_ROCSPARSE_STATUS(st,
+                                    (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                        : rocsparse_status_success);
+        }
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse_apply<T>(
+            handle, direction, Mb, h_alpha, dinv_val, block_dim, dx, h_beta, dy_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrdiag_inverse_zero_pivot(handle, info, dpivot_2),
+                                (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                    : rocsparse_status_success);
+
+        device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse_apply<T>(
+            handle, direction, Mb, d_alpha, dinv_val, block_dim, dx, d_beta, dy_2));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hinv_row_ptr(Mb + 1);
+        host_vector<rocsparse_int> hinv_col_ind(Mb);
+        host_vector<T>             hinv_val(size_t(Mb) * block_dim * block_dim);
+
+        hinv_row_ptr.transfer_from(dinv_row_ptr);
+        hinv_col_ind.transfer_from(dinv_col_ind);
+        hinv_val.transfer_from(dinv_val);
+        hy_1.transfer_from(dy_1);
+        hy_2.transfer_from(dy_2);
+        hpivot_2.transfer_from(dpivot_2);
+
+        // CPU bsrdiag_inverse
+        host_vector<rocsparse_int> hinv_row_ptr_gold;
+        host_vector<rocsparse_int> hinv_col_ind_gold;
+        host_vector<T>             hinv_val_gold;
+
+        host_bsrdiag_inverse<T>(direction,
+                                Mb,
+                                hbsr_row_ptr,
+                                hbsr_col_ind,
+                                hbsr_val,
+                                block_dim,
+                                alg,
+                                hinv_val_gold,
+                                hinv_row_ptr_gold,
+                                hinv_col_ind_gold,
+                                base,
+                                hpivot_gold);
+
+        host_bsrdiag_inverse_apply<T>(
+            direction, Mb, *h_alpha, hinv_val_gold, block_dim, hx, *h_beta, hy_gold);
+
+        // Check pivots and the block diagonal structure
+        hpivot_gold.unit_check(hpivot_1);
+        hpivot_gold.unit_check(hpivot_2);
+        hinv_row_ptr_gold.unit_check(hinv_row_ptr);
+        hinv_col_ind_gold.unit_check(hinv_col_ind);
+
+        // Check inverse and its application if no pivot has been found
+        if(hpivot_gold[0] == -1)
+        {
+            hinv_val_gold.near_check(hinv_val);
+            hy_gold.near_check(hy_1);
+            hy_gold.near_check(hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse<T>(PARAMS));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse_apply<T>(
+                handle, direction, Mb, h_alpha, dinv_val, block_dim, dx, h_beta, dy_1));
+        }
+
+        double gpu_inverse_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse<T>(PARAMS));
+        }
+
+        gpu_inverse_time_used = (get_time_us() - gpu_inverse_time_used) / number_hot_calls;
+
+        double gpu_apply_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrdiag_inverse_apply<T>(
+                handle, direction, Mb, h_alpha, dinv_val, block_dim, dx, h_beta, dy_1));
+        }
+
+        gpu_apply_time_used = (get_time_us() - gpu_apply_time_used) / number_hot_calls;
+
+        double gbyte_count = bsrdiag_inverse_gbyte_count<T>(Mb, block_dim, nnzb);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_inverse_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            M,
+                            "nnzb",
+                            nnzb,
+                            "BSR dim",
+                            block_dim,
+                            "dir",
+                            rocsparse_direction2string(direction),
+                            "algorithm",
+                            alg,
+                            "GB/s",
+                            gpu_gbyte,
+                            "inverse msec",
+                            get_gpu_time_msec(gpu_inverse_time_used),
+                            "apply msec",
+                            get_gpu_time_msec(gpu_apply_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(TYPE)                                                      \
+    template void testing_bsrdiag_inverse_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_bsrdiag_inverse<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -93,6 +93,12 @@ void testing_coomv(const Arguments& arg)
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set deterministic mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_deterministic_mode(
+        handle,
+        arg.deterministic ? rocsparse_deterministic_mode_enabled
+                          : rocsparse_deterministic_mode_disabled));
+
 #define PARAMS(alpha_, A_, x_, beta_, y_) \
     handle, trans, A_.m, A_.n, A_.nnz, alpha_, descr, A_.val, A_.row_ind, A_.col_ind, x_, beta_, y_
 
@@ -132,6 +138,8 @@ void testing_coomv(const Arguments& arg)
 
     if(arg.unit_check)
     {
+        host_dense_matrix<T> hy_init(hy);
+
         // Pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
         CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(PARAMS(h_alpha, dA, dx, h_beta, dy)));
@@ -160,6 +168,15 @@ void testing_coomv(const Arguments& arg)
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
         CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
         hy.near_check(dy);
+
+        if(arg.deterministic)
+        {
+            // Results of repeated runs need to be bitwise identical
+            host_dense_matrix<T> hy_first(dy);
+            dy = hy_init;
+            CHECK_ROCSPARSE_ERROR(rocsparse_coomv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
+            hy_first.unit_check(dy);
+        }
     }
 
     if(arg.timing)
@@ -209,6 +226,8 @@ void testing_coomv(const Arguments& arg)
                             get_gpu_time_msec(gpu_time_used),
                             "iter",
                             number_hot_calls,
+                            "deterministic",
+                            (arg.deterministic ? "yes" : "no"),
                             "verified",
                             (arg.unit_check ? "yes" : "no"));
     }
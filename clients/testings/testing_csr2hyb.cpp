@@ -271,6 +271,18 @@ void testing_csr2hyb(const Arguments& arg)
         hhyb_coo_row_ind_gold.unit_check(hhyb_coo_row_ind);
         hhyb_coo_col_ind_gold.unit_check(hhyb_coo_col_ind);
         hhyb_coo_val_gold.unit_check(hhyb_coo_val);
+
+        // Check the chosen partitioning and its modelled cost
+        rocsparse_int ell_width;
+        int64_t       predicted_cost;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_hyb_mat_partition(hyb, &ell_width, &predicted_cost));
+
+        int64_t predicted_cost_gold
+            = static_cast<int64_t>(ell_nnz_gold) * (sizeof(rocsparse_int) + sizeof(T))
+              + static_cast<int64_t>(coo_nnz_gold) * (2 * sizeof(rocsparse_int) + sizeof(T));
+
+        unit_check_scalar<rocsparse_int>(ell_width_gold, ell_width);
+        unit_check_scalar<int64_t>(predicted_cost_gold, predicted_cost);
     }
 
     if(arg.timing)
@@ -320,16 +332,25 @@ void testing_csr2hyb(const Arguments& arg)
 
         double gpu_gbyte = csr2hyb_gbyte_count<T>(M, nnz, ell_nnz, coo_nnz) / gpu_time_used * 1e6;
 
+        // Chosen partitioning and its modelled hybmv cost
+        rocsparse_int ell_width;
+        int64_t       predicted_cost;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_hyb_mat_partition(hyb, &ell_width, &predicted_cost));
+
         std::cout.precision(2);
         std::cout.setf(std::ios::fixed);
         std::cout.setf(std::ios::left);
 
-        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "ELL nnz"
-                  << std::setw(12) << "COO nnz" << std::setw(12) << "GB/s" << std::setw(12)
-                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "partition"
+                  << std::setw(12) << "ELL width" << std::setw(12) << "ELL nnz" << std::setw(12)
+                  << "COO nnz" << std::setw(12) << "cost MB" << std::setw(12) << "GB/s"
+                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
 
-        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << ell_nnz
-                  << std::setw(12) << coo_nnz << std::setw(12) << gpu_gbyte << std::setw(12)
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12)
+                  << rocsparse_partition2string(part) << std::setw(12) << ell_width
+                  << std::setw(12) << ell_nnz << std::setw(12) << coo_nnz << std::setw(12)
+                  << predicted_cost / 1e6 << std::setw(12) << gpu_gbyte << std::setw(12)
                   << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
     }
@@ -0,0 +1,428 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "rocsparse_enum.hpp"
+
+template <typename T>
+void testing_csrfsai_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descr_A;
+    rocsparse_local_mat_descr local_descr_S;
+    rocsparse_local_mat_descr local_descr_G;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle         = local_handle;
+    rocsparse_int             m              = safe_size;
+    const rocsparse_mat_descr descr_A        = local_descr_A;
+    rocsparse_int             nnz_A          = safe_size;
+    const T*                  csr_val_A      = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr_A  = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_A  = (const rocsparse_int*)0x4;
+    const rocsparse_mat_descr descr_S        = local_descr_S;
+    rocsparse_int             nnz_S          = safe_size;
+    const rocsparse_int*      csr_row_ptr_S  = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_S  = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info           = local_info;
+    const rocsparse_mat_descr descr_G        = local_descr_G;
+    T*                        csr_val_G      = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_G  = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_G  = (rocsparse_int*)0x4;
+    rocsparse_int*            nnz_G          = (rocsparse_int*)0x4;
+    rocsparse_int*            truncated_rows = (rocsparse_int*)0x4;
+
+#define PARAMS_NNZ                                                                          \
+    handle, m, descr_S, nnz_S, csr_row_ptr_S, csr_col_ind_S, descr_G, csr_row_ptr_G, nnz_G, \
+        truncated_rows
+#define PARAMS                                                                          \
+    handle, m, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_S, nnz_S, \
+        csr_row_ptr_S, csr_col_ind_S, info, descr_G, csr_val_G, csr_row_ptr_G, csr_col_ind_G
+
+    auto_testing_bad_arg(rocsparse_csrfsai_nnz, PARAMS_NNZ);
+    auto_testing_bad_arg(rocsparse_csrfsai<T>, PARAMS);
+
+    //
+    // Not implemented cases.
+    //
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr_A, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+
+#undef PARAMS
+#undef PARAMS_NNZ
+
+    // Test rocsparse_csrfsai_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrfsai(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descr_A;
+    rocsparse_local_mat_descr descr_S;
+    rocsparse_local_mat_descr descr_G;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_A, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_S, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_G, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       nnz_G;
+        rocsparse_int       truncated_rows;
+        rocsparse_int       pivot;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_nnz(handle,
+                                                      M,
+                                                      descr_S,
+                                                      safe_size,
+                                                      nullptr,
+                                                      nullptr,
+                                                      descr_G,
+                                                      nullptr,
+                                                      &nnz_G,
+                                                      &truncated_rows),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai<T>(handle,
+                                                     M,
+                                                     descr_A,
+                                                     safe_size,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     descr_S,
+                                                     safe_size,
+                                                     nullptr,
+                                                     nullptr,
+                                                     info,
+                                                     descr_G,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, info, &pivot),
+                                rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR square matrix
+    host_csr_matrix<T> hA;
+    matrix_factory.init_csr(hA, M, M, base);
+
+    M = hA.m;
+
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+
+    hA.ptr.transfer_to(hcsr_row_ptr_A);
+    hA.ind.transfer_to(hcsr_col_ind_A);
+    hA.val.transfer_to(hcsr_val_A);
+
+    // The denser pattern of A^2
+    host_vector<rocsparse_int> hcsr_row_ptr_A2;
+    host_vector<rocsparse_int> hcsr_col_ind_A2;
+    host_vector<T>             hcsr_val_A2;
+
+    T             h_one = static_cast<T>(1);
+    rocsparse_int nnz_A2;
+
+    host_csrgemm_nnz<rocsparse_int, rocsparse_int, T>(M,
+                                                      M,
+                                                      M,
+                                                      &h_one,
+                                                      hcsr_row_ptr_A,
+                                                      hcsr_col_ind_A,
+                                                      hcsr_row_ptr_A,
+                                                      hcsr_col_ind_A,
+                                                      nullptr,
+                                                      hcsr_row_ptr_A,
+                                                      hcsr_col_ind_A,
+                                                      hcsr_row_ptr_A2,
+                                                      &nnz_A2,
+                                                      base,
+                                                      base,
+                                                      base,
+                                                      base);
+
+    hcsr_col_ind_A2.resize(nnz_A2);
+    hcsr_val_A2.resize(nnz_A2);
+
+    host_csrgemm<rocsparse_int, rocsparse_int, T>(M,
+                                                  M,
+                                                  M,
+                                                  &h_one,
+                                                  hcsr_row_ptr_A,
+                                                  hcsr_col_ind_A,
+                                                  hcsr_val_A,
+                                                  hcsr_row_ptr_A,
+                                                  hcsr_col_ind_A,
+                                                  hcsr_val_A,
+                                                  nullptr,
+                                                  hcsr_row_ptr_A,
+                                                  hcsr_col_ind_A,
+                                                  hcsr_val_A,
+                                                  hcsr_row_ptr_A2,
+                                                  hcsr_col_ind_A2,
+                                                  hcsr_val_A2,
+                                                  base,
+                                                  base,
+                                                  base,
+                                                  base);
+
+    // Allocate device memory
+    device_csr_matrix<T>         dA(hA);
+    device_vector<rocsparse_int> dcsr_row_ptr_A2(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A2(nnz_A2);
+    device_vector<rocsparse_int> dcsr_row_ptr_G(M + 1);
+    device_vector<rocsparse_int> dnnz_G(1);
+    device_vector<rocsparse_int> dtruncated_rows(1);
+    device_vector<rocsparse_int> dpivot(1);
+
+    dcsr_row_ptr_A2.transfer_from(hcsr_row_ptr_A2);
+    dcsr_col_ind_A2.transfer_from(hcsr_col_ind_A2);
+
+    // Sparsity patterns S = A and S = A^2
+    const rocsparse_int  nnz_S[2]          = {dA.nnz, nnz_A2};
+    const rocsparse_int* dcsr_row_ptr_S[2] = {dA.ptr, dcsr_row_ptr_A2};
+    const rocsparse_int* dcsr_col_ind_S[2] = {dA.ind, dcsr_col_ind_A2};
+
+    const host_vector<rocsparse_int>* hcsr_row_ptr_S[2] = {&hcsr_row_ptr_A, &hcsr_row_ptr_A2};
+    const host_vector<rocsparse_int>* hcsr_col_ind_S[2] = {&hcsr_col_ind_A, &hcsr_col_ind_A2};
+
+#define PARAMS_NNZ(p_, nnz_G_, truncated_rows_)                                        \
+    handle, dA.m, descr_S, nnz_S[p_], dcsr_row_ptr_S[p_], dcsr_col_ind_S[p_], descr_G, \
+        dcsr_row_ptr_G, nnz_G_, truncated_rows_
+#define PARAMS(p_)                                                                         \
+    handle, dA.m, descr_A, dA.nnz, dA.val, dA.ptr, dA.ind, descr_S, nnz_S[p_],             \
+        dcsr_row_ptr_S[p_], dcsr_col_ind_S[p_], info, descr_G, dcsr_val_G, dcsr_row_ptr_G, \
+        dcsr_col_ind_G
+
+    if(arg.unit_check)
+    {
+        for(int p = 0; p < 2; ++p)
+        {
+            rocsparse_int hnnz_G_1;
+            rocsparse_int hnnz_G_2;
+            rocsparse_int htruncated_rows_1;
+            rocsparse_int htruncated_rows_2;
+            rocsparse_int hpivot_1;
+            rocsparse_int hpivot_2;
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrfsai_nnz(PARAMS_NNZ(p, &hnnz_G_1, &htruncated_rows_1)));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai_nnz(PARAMS_NNZ(p, dnnz_G, dtruncated_rows)));
+            CHECK_HIP_ERROR(
+                hipMemcpy(&hnnz_G_2, dnnz_G, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(&htruncated_rows_2,
+                                      dtruncated_rows,
+                                      sizeof(rocsparse_int),
+                                      hipMemcpyDeviceToHost));
+
+            device_vector<rocsparse_int> dcsr_col_ind_G(hnnz_G_1);
+            device_vector<T>             dcsr_val_G(hnnz_G_1);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai<T>(PARAMS(p)));
+
+            // Zero pivot in host and device pointer mode
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            {
+                auto st = rocsparse_csrfsai_zero_pivot(handle, info, &hpivot_1);
+                EXPECT_ROCSPARSE_STATUS(st,
+                                        (hpivot_1 != -1) ? rocsparse_status_zero_pivot
+                                                         : rocsparse_status_success);
+            }
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, info, dpivot),
+                                    (hpivot_1 != -1) ? rocsparse_status_zero_pivot
+                                                     : rocsparse_status_success);
+            CHECK_HIP_ERROR(
+                hipMemcpy(&hpivot_2, dpivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            // Copy output to host
+            host_vector<rocsparse_int> hcsr_row_ptr_G(M + 1);
+            host_vector<rocsparse_int> hcsr_col_ind_G(hnnz_G_1);
+            host_vector<T>             hcsr_val_G(hnnz_G_1);
+
+            hcsr_row_ptr_G.transfer_from(dcsr_row_ptr_G);
+            hcsr_col_ind_G.transfer_from(dcsr_col_ind_G);
+            hcsr_val_G.transfer_from(dcsr_val_G);
+
+            // CPU csrfsai
+            host_vector<rocsparse_int> hcsr_row_ptr_G_gold;
+            host_vector<rocsparse_int> hcsr_col_ind_G_gold;
+            host_vector<T>             hcsr_val_G_gold;
+            rocsparse_int              hpivot_gold;
+            rocsparse_int              htruncated_rows_gold;
+
+            host_csrfsai<T>(M,
+                            hcsr_row_ptr_A,
+                            hcsr_col_ind_A,
+                            hcsr_val_A,
+                            *hcsr_row_ptr_S[p],
+                            *hcsr_col_ind_S[p],
+                            hcsr_row_ptr_G_gold,
+                            hcsr_col_ind_G_gold,
+                            hcsr_val_G_gold,
+                            &hpivot_gold,
+                            &htruncated_rows_gold,
+                            base,
+                            base,
+                            base);
+
+            // Check pivots and the sparsity pattern of G
+            unit_check_scalar(hpivot_gold, hpivot_1);
+            unit_check_scalar(hpivot_gold, hpivot_2);
+            unit_check_scalar(hcsr_row_ptr_G_gold[M] - base, hnnz_G_1);
+            unit_check_scalar(hcsr_row_ptr_G_gold[M] - base, hnnz_G_2);
+            unit_check_scalar(htruncated_rows_gold, htruncated_rows_1);
+            unit_check_scalar(htruncated_rows_gold, htruncated_rows_2);
+            hcsr_row_ptr_G_gold.unit_check(hcsr_row_ptr_G);
+            hcsr_col_ind_G_gold.unit_check(hcsr_col_ind_G);
+
+            // Check G if no pivot has been found
+            if(hpivot_gold == -1)
+            {
+                hcsr_val_G_gold.near_check(hcsr_val_G);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int nnz_G[2];
+        rocsparse_int truncated_rows[2];
+        double        gpu_time_used[2];
+        double        gpu_gbyte[2];
+
+        for(int p = 0; p < 2; ++p)
+        {
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_csrfsai_nnz(PARAMS_NNZ(p, &nnz_G[p], &truncated_rows[p])));
+
+            device_vector<rocsparse_int> dcsr_col_ind_G(nnz_G[p]);
+            device_vector<T>             dcsr_val_G(nnz_G[p]);
+
+            // Warm up
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai<T>(PARAMS(p)));
+            }
+
+            gpu_time_used[p] = get_time_us();
+
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai<T>(PARAMS(p)));
+            }
+
+            gpu_time_used[p] = (get_time_us() - gpu_time_used[p]) / number_hot_calls;
+
+            double gbyte_count = csrfsai_gbyte_count<T>(dA.m, dA.nnz, nnz_S[p], nnz_G[p]);
+            gpu_gbyte[p]       = get_gpu_gbyte(gpu_time_used[p], gbyte_count);
+        }
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "nnz_G(A)",
+                            nnz_G[0],
+                            "nnz_G(A^2)",
+                            nnz_G[1],
+                            "GB/s(A)",
+                            gpu_gbyte[0],
+                            "GB/s(A^2)",
+                            gpu_gbyte[1],
+                            "msec(A)",
+                            get_gpu_time_msec(gpu_time_used[0]),
+                            "msec(A^2)",
+                            get_gpu_time_msec(gpu_time_used[1]),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS
+#undef PARAMS_NNZ
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrfsai_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrfsai<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
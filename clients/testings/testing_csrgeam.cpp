@@ -76,6 +76,302 @@ void testing_csrgeam_bad_arg(const Arguments& arg)
 #undef PARAMS_NNZ
 }
 
+// Block matrix addition, using the sparsity patterns of A and B as block sparsity patterns
+template <typename T>
+static void testing_bsrgeam(rocsparse_handle                  handle,
+                            rocsparse_int                     MB,
+                            rocsparse_int                     NB,
+                            T                                 h_alpha,
+                            T                                 h_beta,
+                            const rocsparse_mat_descr         descrA,
+                            rocsparse_int                     nnzb_A,
+                            const host_vector<rocsparse_int>& hbsr_row_ptr_A,
+                            const host_vector<rocsparse_int>& hbsr_col_ind_A,
+                            const rocsparse_mat_descr         descrB,
+                            rocsparse_int                     nnzb_B,
+                            const host_vector<rocsparse_int>& hbsr_row_ptr_B,
+                            const host_vector<rocsparse_int>& hbsr_col_ind_B,
+                            const rocsparse_mat_descr         descrC)
+{
+    rocsparse_index_base baseA = rocsparse_get_mat_index_base(descrA);
+    rocsparse_index_base baseB = rocsparse_get_mat_index_base(descrB);
+    rocsparse_index_base baseC = rocsparse_get_mat_index_base(descrC);
+
+    static constexpr rocsparse_int block_dim = 3;
+    static constexpr rocsparse_int bsize     = block_dim * block_dim;
+
+    // CPU block sparsity pattern of C
+    rocsparse_int              hnnzb_C_gold;
+    host_vector<rocsparse_int> hbsr_row_ptr_C_gold(MB + 1);
+    host_csrgeam_nnz<T>(MB,
+                        NB,
+                        h_alpha,
+                        hbsr_row_ptr_A,
+                        hbsr_col_ind_A,
+                        h_beta,
+                        hbsr_row_ptr_B,
+                        hbsr_col_ind_B,
+                        hbsr_row_ptr_C_gold,
+                        &hnnzb_C_gold,
+                        baseA,
+                        baseB,
+                        baseC);
+
+    host_vector<rocsparse_int> hbsr_col_ind_C_gold(hnnzb_C_gold);
+    host_vector<T>             hpattern_A(nnzb_A);
+    host_vector<T>             hpattern_B(nnzb_B);
+    host_vector<T>             hpattern_C(hnnzb_C_gold);
+    host_csrgeam<T>(MB,
+                    NB,
+                    h_alpha,
+                    hbsr_row_ptr_A,
+                    hbsr_col_ind_A,
+                    hpattern_A,
+                    h_beta,
+                    hbsr_row_ptr_B,
+                    hbsr_col_ind_B,
+                    hpattern_B,
+                    hbsr_row_ptr_C_gold,
+                    hbsr_col_ind_C_gold,
+                    hpattern_C,
+                    baseA,
+                    baseB,
+                    baseC);
+
+    // Random blocks of A and B
+    host_vector<T> hbsr_val_A(nnzb_A * bsize);
+    host_vector<T> hbsr_val_B(nnzb_B * bsize);
+
+    for(rocsparse_int i = 0; i < nnzb_A * bsize; ++i)
+    {
+        hbsr_val_A[i] = random_generator<T>();
+    }
+
+    for(rocsparse_int i = 0; i < nnzb_B * bsize; ++i)
+    {
+        hbsr_val_B[i] = random_generator<T>();
+    }
+
+    // CPU blocks of C, blocks share the storage direction such that they can be added
+    // entry by entry
+    host_vector<T> hbsr_val_C_gold(hnnzb_C_gold * bsize);
+
+    for(rocsparse_int i = 0; i < MB; ++i)
+    {
+        for(rocsparse_int j = hbsr_row_ptr_C_gold[i] - baseC;
+            j < hbsr_row_ptr_C_gold[i + 1] - baseC;
+            ++j)
+        {
+            rocsparse_int col = hbsr_col_ind_C_gold[j] - baseC;
+
+            for(rocsparse_int e = 0; e < bsize; ++e)
+            {
+                hbsr_val_C_gold[j * bsize + e] = static_cast<T>(0);
+            }
+
+            for(rocsparse_int k = hbsr_row_ptr_A[i] - baseA; k < hbsr_row_ptr_A[i + 1] - baseA;
+                ++k)
+            {
+                if(hbsr_col_ind_A[k] - baseA == col)
+                {
+                    for(rocsparse_int e = 0; e < bsize; ++e)
+                    {
+                        hbsr_val_C_gold[j * bsize + e] += h_alpha * hbsr_val_A[k * bsize + e];
+                    }
+                }
+            }
+
+            for(rocsparse_int k = hbsr_row_ptr_B[i] - baseB; k < hbsr_row_ptr_B[i + 1] - baseB;
+                ++k)
+            {
+                if(hbsr_col_ind_B[k] - baseB == col)
+                {
+                    for(rocsparse_int e = 0; e < bsize; ++e)
+                    {
+                        hbsr_val_C_gold[j * bsize + e] += h_beta * hbsr_val_B[k * bsize + e];
+                    }
+                }
+            }
+        }
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dbsr_row_ptr_A(MB + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_A(nnzb_A);
+    device_vector<T>             dbsr_val_A(nnzb_A * bsize);
+    device_vector<rocsparse_int> dbsr_row_ptr_B(MB + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_B(nnzb_B);
+    device_vector<T>             dbsr_val_B(nnzb_B * bsize);
+    device_vector<rocsparse_int> dbsr_row_ptr_C(MB + 1);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_A, hbsr_row_ptr_A, sizeof(rocsparse_int) * (MB + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_A, hbsr_col_ind_A, sizeof(rocsparse_int) * nnzb_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val_A, hbsr_val_A, sizeof(T) * nnzb_A * bsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_B, hbsr_row_ptr_B, sizeof(rocsparse_int) * (MB + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_B, hbsr_col_ind_B, sizeof(rocsparse_int) * nnzb_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val_B, hbsr_val_B, sizeof(T) * nnzb_B * bsize, hipMemcpyHostToDevice));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // The storage direction does not affect the result
+    for(rocsparse_direction dir : {rocsparse_direction_row, rocsparse_direction_column})
+    {
+        rocsparse_int hnnzb_C;
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgeam_nnz(handle,
+                                                    dir,
+                                                    MB,
+                                                    NB,
+                                                    block_dim,
+                                                    descrA,
+                                                    nnzb_A,
+                                                    dbsr_row_ptr_A,
+                                                    dbsr_col_ind_A,
+                                                    descrB,
+                                                    nnzb_B,
+                                                    dbsr_row_ptr_B,
+                                                    dbsr_col_ind_B,
+                                                    descrC,
+                                                    dbsr_row_ptr_C,
+                                                    &hnnzb_C));
+
+        unit_check_scalar(hnnzb_C_gold, hnnzb_C);
+
+        device_vector<rocsparse_int> dbsr_col_ind_C(hnnzb_C);
+        device_vector<T>             dbsr_val_C(hnnzb_C * bsize);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgeam<T>(handle,
+                                                   dir,
+                                                   MB,
+                                                   NB,
+                                                   block_dim,
+                                                   &h_alpha,
+                                                   descrA,
+                                                   nnzb_A,
+                                                   dbsr_val_A,
+                                                   dbsr_row_ptr_A,
+                                                   dbsr_col_ind_A,
+                                                   &h_beta,
+                                                   descrB,
+                                                   nnzb_B,
+                                                   dbsr_val_B,
+                                                   dbsr_row_ptr_B,
+                                                   dbsr_col_ind_B,
+                                                   descrC,
+                                                   dbsr_val_C,
+                                                   dbsr_row_ptr_C,
+                                                   dbsr_col_ind_C));
+
+        host_vector<rocsparse_int> hbsr_row_ptr_C(MB + 1);
+        host_vector<rocsparse_int> hbsr_col_ind_C(hnnzb_C);
+        host_vector<T>             hbsr_val_C(hnnzb_C * bsize);
+
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr_C,
+                                  dbsr_row_ptr_C,
+                                  sizeof(rocsparse_int) * (MB + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind_C,
+                                  dbsr_col_ind_C,
+                                  sizeof(rocsparse_int) * hnnzb_C,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_val_C, dbsr_val_C, sizeof(T) * hnnzb_C * bsize, hipMemcpyDeviceToHost));
+
+        unit_check_segments<rocsparse_int>(MB + 1, hbsr_row_ptr_C_gold, hbsr_row_ptr_C);
+        unit_check_segments<rocsparse_int>(hnnzb_C_gold, hbsr_col_ind_C_gold, hbsr_col_ind_C);
+        near_check_segments<T>(hnnzb_C_gold * bsize, hbsr_val_C_gold, hbsr_val_C);
+    }
+}
+
+// Block matrix addition, where A and B share several block columns within a block row, and
+// the block rows span several chunks of block columns
+template <typename T>
+static void testing_bsrgeam_shared(rocsparse_handle          handle,
+                                   T                         h_alpha,
+                                   T                         h_beta,
+                                   const rocsparse_mat_descr descrA,
+                                   const rocsparse_mat_descr descrB,
+                                   const rocsparse_mat_descr descrC)
+{
+    static constexpr rocsparse_int MB = 4;
+    static constexpr rocsparse_int NB = 150;
+
+    rocsparse_index_base baseA = rocsparse_get_mat_index_base(descrA);
+    rocsparse_index_base baseB = rocsparse_get_mat_index_base(descrB);
+
+    // Block columns of A and B per block row
+    std::vector<std::vector<rocsparse_int>> cols_A(MB);
+    std::vector<std::vector<rocsparse_int>> cols_B(MB);
+
+    // Block row 0: shared block columns 2, 5, 7 and 70
+    cols_A[0] = {0, 2, 5, 7, 70};
+    cols_B[0] = {2, 3, 5, 7, 70, 99};
+
+    // Block row 1: B only
+    cols_B[1] = {1, 50};
+
+    // Block row 2: every sixth block column is shared
+    for(rocsparse_int j = 0; j < NB; ++j)
+    {
+        if(j % 2 == 0)
+        {
+            cols_A[2].push_back(j);
+        }
+
+        if(j % 3 == 0)
+        {
+            cols_B[2].push_back(j);
+        }
+    }
+
+    // Block row 3: A only
+    cols_A[3] = {4};
+
+    host_vector<rocsparse_int> hbsr_row_ptr_A(MB + 1);
+    host_vector<rocsparse_int> hbsr_row_ptr_B(MB + 1);
+    host_vector<rocsparse_int> hbsr_col_ind_A;
+    host_vector<rocsparse_int> hbsr_col_ind_B;
+
+    hbsr_row_ptr_A[0] = baseA;
+    hbsr_row_ptr_B[0] = baseB;
+
+    for(rocsparse_int i = 0; i < MB; ++i)
+    {
+        for(rocsparse_int col : cols_A[i])
+        {
+            hbsr_col_ind_A.push_back(col + baseA);
+        }
+
+        for(rocsparse_int col : cols_B[i])
+        {
+            hbsr_col_ind_B.push_back(col + baseB);
+        }
+
+        hbsr_row_ptr_A[i + 1] = hbsr_col_ind_A.size() + baseA;
+        hbsr_row_ptr_B[i + 1] = hbsr_col_ind_B.size() + baseB;
+    }
+
+    testing_bsrgeam<T>(handle,
+                       MB,
+                       NB,
+                       h_alpha,
+                       h_beta,
+                       descrA,
+                       hbsr_col_ind_A.size(),
+                       hbsr_row_ptr_A,
+                       hbsr_col_ind_A,
+                       descrB,
+                       hbsr_col_ind_B.size(),
+                       hbsr_row_ptr_B,
+                       hbsr_col_ind_B,
+                       descrC);
+}
+
 template <typename T>
 void testing_csrgeam(const Arguments& arg)
 {
@@ -389,6 +685,25 @@ void testing_csrgeam(const Arguments& arg)
 
         near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C_1);
         near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C_2);
+
+        // BSR matrix addition
+        testing_bsrgeam<T>(handle,
+                           M,
+                           N,
+                           h_alpha,
+                           h_beta,
+                           descrA,
+                           nnz_A,
+                           hcsr_row_ptr_A,
+                           hcsr_col_ind_A,
+                           descrB,
+                           nnz_B,
+                           hcsr_row_ptr_B,
+                           hcsr_col_ind_B,
+                           descrC);
+
+        // BSR matrix addition with shared block columns
+        testing_bsrgeam_shared<T>(handle, h_alpha, h_beta, descrA, descrB, descrC);
     }
 
     if(arg.timing)
@@ -368,6 +368,903 @@ void testing_csrgemm_bad_arg(const Arguments& arg)
 #undef PARAMS_BUFFER_SIZE
 }
 
+// Host CSR matrix, that is assembled from the chunks of rocsparse_csrgemm_chunked
+template <typename T>
+struct csrgemm_chunked_data
+{
+    rocsparse_index_base       base;
+    host_vector<rocsparse_int> row_ptr;
+    host_vector<rocsparse_int> col_ind;
+    host_vector<T>             val;
+};
+
+template <typename T>
+static void csrgemm_chunked_append(rocsparse_int        row_begin,
+                                   rocsparse_int        row_end,
+                                   rocsparse_int        nnz,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const void*          csr_val,
+                                   void*                user_data)
+{
+    csrgemm_chunked_data<T>* C = static_cast<csrgemm_chunked_data<T>*>(user_data);
+
+    // Row pointers of the chunk start at the index base
+    rocsparse_int offset = C->row_ptr[row_begin] - C->base;
+
+    for(rocsparse_int i = 1; i <= row_end - row_begin; ++i)
+    {
+        C->row_ptr[row_begin + i] = csr_row_ptr[i] + offset;
+    }
+
+    const T* val = static_cast<const T*>(csr_val);
+
+    C->col_ind.insert(C->col_ind.end(), csr_col_ind, csr_col_ind + nnz);
+    C->val.insert(C->val.end(), val, val + nnz);
+}
+
+// Masked csrgemm, using the sparsity pattern of D as mask
+template <typename T>
+static void testing_csrgemm_masked(rocsparse_handle                  handle,
+                                   rocsparse_int                     M,
+                                   rocsparse_int                     N,
+                                   rocsparse_int                     K,
+                                   T                                 h_alpha,
+                                   const rocsparse_mat_descr         descrA,
+                                   rocsparse_int                     nnz_A,
+                                   const host_vector<rocsparse_int>& hcsr_row_ptr_A,
+                                   const host_vector<rocsparse_int>& hcsr_col_ind_A,
+                                   const host_vector<T>&             hcsr_val_A,
+                                   const rocsparse_int*              dcsr_row_ptr_A,
+                                   const rocsparse_int*              dcsr_col_ind_A,
+                                   const T*                          dcsr_val_A,
+                                   const rocsparse_mat_descr         descrB,
+                                   rocsparse_int                     nnz_B,
+                                   const host_vector<rocsparse_int>& hcsr_row_ptr_B,
+                                   const host_vector<rocsparse_int>& hcsr_col_ind_B,
+                                   const host_vector<T>&             hcsr_val_B,
+                                   const rocsparse_int*              dcsr_row_ptr_B,
+                                   const rocsparse_int*              dcsr_col_ind_B,
+                                   const T*                          dcsr_val_B,
+                                   const rocsparse_mat_descr         descrM,
+                                   rocsparse_int                     nnz_M,
+                                   const host_vector<rocsparse_int>& hcsr_row_ptr_M,
+                                   const host_vector<rocsparse_int>& hcsr_col_ind_M,
+                                   const rocsparse_int*              dcsr_row_ptr_M,
+                                   const rocsparse_int*              dcsr_col_ind_M,
+                                   const rocsparse_mat_descr         descrC)
+{
+    rocsparse_index_base baseA = rocsparse_get_mat_index_base(descrA);
+    rocsparse_index_base baseB = rocsparse_get_mat_index_base(descrB);
+    rocsparse_index_base baseM = rocsparse_get_mat_index_base(descrM);
+    rocsparse_index_base baseC = rocsparse_get_mat_index_base(descrC);
+
+    // CPU csrgemm without mask
+    rocsparse_int              hnnz_P;
+    host_vector<rocsparse_int> hcsr_row_ptr_P(M + 1);
+    host_csrgemm_nnz(M,
+                     N,
+                     K,
+                     &h_alpha,
+                     hcsr_row_ptr_A,
+                     hcsr_col_ind_A,
+                     hcsr_row_ptr_B,
+                     hcsr_col_ind_B,
+                     (const T*)nullptr,
+                     hcsr_row_ptr_M,
+                     hcsr_col_ind_M,
+                     hcsr_row_ptr_P,
+                     &hnnz_P,
+                     baseA,
+                     baseB,
+                     rocsparse_index_base_zero,
+                     baseM);
+
+    host_vector<rocsparse_int> hcsr_col_ind_P(hnnz_P);
+    host_vector<T>             hcsr_val_P(hnnz_P);
+    host_vector<T>             hcsr_val_M;
+    host_csrgemm(M,
+                 N,
+                 K,
+                 &h_alpha,
+                 hcsr_row_ptr_A,
+                 hcsr_col_ind_A,
+                 hcsr_val_A,
+                 hcsr_row_ptr_B,
+                 hcsr_col_ind_B,
+                 hcsr_val_B,
+                 (const T*)nullptr,
+                 hcsr_row_ptr_M,
+                 hcsr_col_ind_M,
+                 hcsr_val_M,
+                 hcsr_row_ptr_P,
+                 hcsr_col_ind_P,
+                 hcsr_val_P,
+                 baseA,
+                 baseB,
+                 rocsparse_index_base_zero,
+                 baseM);
+
+    rocsparse_csrgemm_mask       masks[] = {rocsparse_csrgemm_mask_keep,
+                                            rocsparse_csrgemm_mask_complement};
+    rocsparse_csrgemm_masked_alg algs[]  = {rocsparse_csrgemm_masked_alg_default,
+                                           rocsparse_csrgemm_masked_alg_dot,
+                                           rocsparse_csrgemm_masked_alg_row};
+
+    for(rocsparse_csrgemm_mask mask : masks)
+    {
+        // CPU masked csrgemm, obtained by filtering the product with the mask
+        host_vector<rocsparse_int> hcsr_row_ptr_C_gold(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind_C_gold;
+        host_vector<T>             hcsr_val_C_gold;
+
+        hcsr_row_ptr_C_gold[0] = baseC;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int p     = hcsr_row_ptr_P[i];
+            rocsparse_int p_end = hcsr_row_ptr_P[i + 1];
+
+            if(mask == rocsparse_csrgemm_mask_keep)
+            {
+                rocsparse_int j_begin = hcsr_row_ptr_M[i] - baseM;
+                rocsparse_int j_end   = hcsr_row_ptr_M[i + 1] - baseM;
+
+                for(rocsparse_int j = j_begin; j < j_end; ++j)
+                {
+                    rocsparse_int col = hcsr_col_ind_M[j] - baseM;
+
+                    while(p < p_end && hcsr_col_ind_P[p] < col)
+                    {
+                        ++p;
+                    }
+
+                    hcsr_col_ind_C_gold.push_back(col + baseC);
+                    hcsr_val_C_gold.push_back((p < p_end && hcsr_col_ind_P[p] == col)
+                                                  ? hcsr_val_P[p]
+                                                  : static_cast<T>(0));
+                }
+            }
+            else
+            {
+                rocsparse_int j     = hcsr_row_ptr_M[i] - baseM;
+                rocsparse_int j_end = hcsr_row_ptr_M[i + 1] - baseM;
+
+                for(; p < p_end; ++p)
+                {
+                    while(j < j_end && hcsr_col_ind_M[j] - baseM < hcsr_col_ind_P[p])
+                    {
+                        ++j;
+                    }
+
+                    if(j < j_end && hcsr_col_ind_M[j] - baseM == hcsr_col_ind_P[p])
+                    {
+                        continue;
+                    }
+
+                    hcsr_col_ind_C_gold.push_back(hcsr_col_ind_P[p] + baseC);
+                    hcsr_val_C_gold.push_back(hcsr_val_P[p]);
+                }
+            }
+
+            hcsr_row_ptr_C_gold[i + 1] = hcsr_col_ind_C_gold.size() + baseC;
+        }
+
+        rocsparse_int hnnz_C_gold = hcsr_col_ind_C_gold.size();
+
+        for(rocsparse_csrgemm_masked_alg alg : algs)
+        {
+            size_t buffer_size;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked_buffer_size<T>(handle,
+                                                                          rocsparse_operation_none,
+                                                                          rocsparse_operation_none,
+                                                                          mask,
+                                                                          alg,
+                                                                          M,
+                                                                          N,
+                                                                          K,
+                                                                          descrA,
+                                                                          nnz_A,
+                                                                          dcsr_row_ptr_A,
+                                                                          dcsr_col_ind_A,
+                                                                          descrB,
+                                                                          nnz_B,
+                                                                          dcsr_row_ptr_B,
+                                                                          dcsr_col_ind_B,
+                                                                          descrM,
+                                                                          nnz_M,
+                                                                          dcsr_row_ptr_M,
+                                                                          dcsr_col_ind_M,
+                                                                          &buffer_size));
+
+            void* dbuffer;
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+            // Pointer mode host for nnz and values, pointer mode device for nnz
+            device_vector<rocsparse_int> dcsr_row_ptr_C(M + 1);
+            device_vector<rocsparse_int> dnnz_C(1);
+            rocsparse_int                hnnz_C_1;
+            rocsparse_int                hnnz_C_2;
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked_nnz(handle,
+                                                               rocsparse_operation_none,
+                                                               rocsparse_operation_none,
+                                                               mask,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               descrA,
+                                                               nnz_A,
+                                                               dcsr_row_ptr_A,
+                                                               dcsr_col_ind_A,
+                                                               descrB,
+                                                               nnz_B,
+                                                               dcsr_row_ptr_B,
+                                                               dcsr_col_ind_B,
+                                                               descrM,
+                                                               nnz_M,
+                                                               dcsr_row_ptr_M,
+                                                               dcsr_col_ind_M,
+                                                               descrC,
+                                                               dcsr_row_ptr_C,
+                                                               dnnz_C,
+                                                               dbuffer));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked_nnz(handle,
+                                                               rocsparse_operation_none,
+                                                               rocsparse_operation_none,
+                                                               mask,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               descrA,
+                                                               nnz_A,
+                                                               dcsr_row_ptr_A,
+                                                               dcsr_col_ind_A,
+                                                               descrB,
+                                                               nnz_B,
+                                                               dcsr_row_ptr_B,
+                                                               dcsr_col_ind_B,
+                                                               descrM,
+                                                               nnz_M,
+                                                               dcsr_row_ptr_M,
+                                                               dcsr_col_ind_M,
+                                                               descrC,
+                                                               dcsr_row_ptr_C,
+                                                               &hnnz_C_1,
+                                                               dbuffer));
+
+            CHECK_HIP_ERROR(
+                hipMemcpy(&hnnz_C_2, dnnz_C, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            unit_check_scalar(hnnz_C_gold, hnnz_C_1);
+            unit_check_scalar(hnnz_C_gold, hnnz_C_2);
+
+            device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
+            device_vector<T>             dcsr_val_C(hnnz_C_1);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              rocsparse_operation_none,
+                                                              mask,
+                                                              alg,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              &h_alpha,
+                                                              descrA,
+                                                              nnz_A,
+                                                              dcsr_val_A,
+                                                              dcsr_row_ptr_A,
+                                                              dcsr_col_ind_A,
+                                                              descrB,
+                                                              nnz_B,
+                                                              dcsr_val_B,
+                                                              dcsr_row_ptr_B,
+                                                              dcsr_col_ind_B,
+                                                              descrM,
+                                                              nnz_M,
+                                                              dcsr_row_ptr_M,
+                                                              dcsr_col_ind_M,
+                                                              descrC,
+                                                              dcsr_val_C,
+                                                              dcsr_row_ptr_C,
+                                                              dcsr_col_ind_C,
+                                                              dbuffer));
+
+            host_vector<rocsparse_int> hcsr_row_ptr_C(M + 1);
+            host_vector<rocsparse_int> hcsr_col_ind_C(hnnz_C_1);
+            host_vector<T>             hcsr_val_C(hnnz_C_1);
+
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C,
+                                      dcsr_row_ptr_C,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                      dcsr_col_ind_C,
+                                      sizeof(rocsparse_int) * hnnz_C_1,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+
+            unit_check_segments<rocsparse_int>(M + 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C);
+            unit_check_segments<rocsparse_int>(hnnz_C_gold, hcsr_col_ind_C_gold, hcsr_col_ind_C);
+            near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C);
+
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+    }
+}
+
+// Galerkin triple product C = R * S * P, using A as R, B as P and a random K x K matrix S
+template <typename T>
+static void testing_csrrap(rocsparse_handle                  handle,
+                           rocsparse_int                     M,
+                           rocsparse_int                     N,
+                           rocsparse_int                     K,
+                           const rocsparse_mat_descr         descrR,
+                           rocsparse_int                     nnz_R,
+                           const host_vector<rocsparse_int>& hcsr_row_ptr_R,
+                           const host_vector<rocsparse_int>& hcsr_col_ind_R,
+                           const host_vector<T>&             hcsr_val_R,
+                           const rocsparse_int*              dcsr_row_ptr_R,
+                           const rocsparse_int*              dcsr_col_ind_R,
+                           const T*                          dcsr_val_R,
+                           const rocsparse_mat_descr         descrP,
+                           rocsparse_int                     nnz_P,
+                           const host_vector<rocsparse_int>& hcsr_row_ptr_P,
+                           const host_vector<rocsparse_int>& hcsr_col_ind_P,
+                           const host_vector<T>&             hcsr_val_P,
+                           const rocsparse_int*              dcsr_row_ptr_P,
+                           const rocsparse_int*              dcsr_col_ind_P,
+                           const T*                          dcsr_val_P,
+                           const rocsparse_mat_descr         descrC)
+{
+    rocsparse_index_base baseR = rocsparse_get_mat_index_base(descrR);
+    rocsparse_index_base baseP = rocsparse_get_mat_index_base(descrP);
+    rocsparse_index_base baseC = rocsparse_get_mat_index_base(descrC);
+    rocsparse_index_base baseS = baseP;
+
+    // Square matrix S
+    host_vector<rocsparse_int> hcsr_row_ptr_S;
+    host_vector<rocsparse_int> hcsr_col_ind_S;
+    host_vector<T>             hcsr_val_S;
+
+    rocsparse_int                      MS = K;
+    rocsparse_int                      NS = K;
+    rocsparse_int                      nnz_S;
+    rocsparse_matrix_factory_random<T> matrix_factory_random(false);
+    matrix_factory_random.init_csr(
+        hcsr_row_ptr_S, hcsr_col_ind_S, hcsr_val_S, MS, NS, nnz_S, baseS);
+
+    rocsparse_local_mat_descr descrS;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrS, baseS));
+
+    device_vector<rocsparse_int> dcsr_row_ptr_S(K + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_S(nnz_S);
+    device_vector<T>             dcsr_val_S(nnz_S);
+
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_S,
+                              hcsr_row_ptr_S,
+                              sizeof(rocsparse_int) * (K + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_S, hcsr_col_ind_S, sizeof(rocsparse_int) * nnz_S, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_S, hcsr_val_S, sizeof(T) * nnz_S, hipMemcpyHostToDevice));
+
+    // CPU triple product, computed by two chained csrgemm
+    T                          h_one = static_cast<T>(1);
+    host_vector<rocsparse_int> hcsr_row_ptr_D;
+    host_vector<rocsparse_int> hcsr_col_ind_D;
+    host_vector<T>             hcsr_val_D;
+
+    rocsparse_int              hnnz_RS;
+    host_vector<rocsparse_int> hcsr_row_ptr_RS(M + 1);
+    host_csrgemm_nnz(M,
+                     K,
+                     K,
+                     &h_one,
+                     hcsr_row_ptr_R,
+                     hcsr_col_ind_R,
+                     hcsr_row_ptr_S,
+                     hcsr_col_ind_S,
+                     (const T*)nullptr,
+                     hcsr_row_ptr_D,
+                     hcsr_col_ind_D,
+                     hcsr_row_ptr_RS,
+                     &hnnz_RS,
+                     baseR,
+                     baseS,
+                     rocsparse_index_base_zero,
+                     rocsparse_index_base_zero);
+
+    host_vector<rocsparse_int> hcsr_col_ind_RS(hnnz_RS);
+    host_vector<T>             hcsr_val_RS(hnnz_RS);
+    host_csrgemm(M,
+                 K,
+                 K,
+                 &h_one,
+                 hcsr_row_ptr_R,
+                 hcsr_col_ind_R,
+                 hcsr_val_R,
+                 hcsr_row_ptr_S,
+                 hcsr_col_ind_S,
+                 hcsr_val_S,
+                 (const T*)nullptr,
+                 hcsr_row_ptr_D,
+                 hcsr_col_ind_D,
+                 hcsr_val_D,
+                 hcsr_row_ptr_RS,
+                 hcsr_col_ind_RS,
+                 hcsr_val_RS,
+                 baseR,
+                 baseS,
+                 rocsparse_index_base_zero,
+                 rocsparse_index_base_zero);
+
+    rocsparse_int              hnnz_C_gold;
+    host_vector<rocsparse_int> hcsr_row_ptr_C_gold(M + 1);
+    host_csrgemm_nnz(M,
+                     N,
+                     K,
+                     &h_one,
+                     hcsr_row_ptr_RS,
+                     hcsr_col_ind_RS,
+                     hcsr_row_ptr_P,
+                     hcsr_col_ind_P,
+                     (const T*)nullptr,
+                     hcsr_row_ptr_D,
+                     hcsr_col_ind_D,
+                     hcsr_row_ptr_C_gold,
+                     &hnnz_C_gold,
+                     rocsparse_index_base_zero,
+                     baseP,
+                     baseC,
+                     rocsparse_index_base_zero);
+
+    host_vector<rocsparse_int> hcsr_col_ind_C_gold(hnnz_C_gold);
+    host_vector<T>             hcsr_val_C_gold(hnnz_C_gold);
+    host_csrgemm(M,
+                 N,
+                 K,
+                 &h_one,
+                 hcsr_row_ptr_RS,
+                 hcsr_col_ind_RS,
+                 hcsr_val_RS,
+                 hcsr_row_ptr_P,
+                 hcsr_col_ind_P,
+                 hcsr_val_P,
+                 (const T*)nullptr,
+                 hcsr_row_ptr_D,
+                 hcsr_col_ind_D,
+                 hcsr_val_D,
+                 hcsr_row_ptr_C_gold,
+                 hcsr_col_ind_C_gold,
+                 hcsr_val_C_gold,
+                 rocsparse_index_base_zero,
+                 baseP,
+                 baseC,
+                 rocsparse_index_base_zero);
+
+#define PARAMS_SYMBOLIC                                                            \
+    handle, M, K, N, descrR, nnz_R, dcsr_row_ptr_R, dcsr_col_ind_R, descrS, nnz_S, \
+        dcsr_row_ptr_S, dcsr_col_ind_S, descrP, nnz_P, dcsr_row_ptr_P, dcsr_col_ind_P
+#define PARAMS_NUMERIC                                                                  \
+    handle, M, K, N, descrR, nnz_R, dcsr_val_R, dcsr_row_ptr_R, dcsr_col_ind_R, descrS, \
+        nnz_S, dcsr_val_S, dcsr_row_ptr_S, dcsr_col_ind_S, descrP, nnz_P, dcsr_val_P,   \
+        dcsr_row_ptr_P, dcsr_col_ind_P, descrC, dcsr_val_C, dcsr_row_ptr_C, dcsr_col_ind_C
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_buffer_size(PARAMS_SYMBOLIC, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    // Symbolic stages
+    rocsparse_int                hnnz_C;
+    device_vector<rocsparse_int> dcsr_row_ptr_C(M + 1);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrrap_nnz(PARAMS_SYMBOLIC, descrC, dcsr_row_ptr_C, &hnnz_C, dbuffer));
+
+    unit_check_scalar(hnnz_C_gold, hnnz_C);
+
+    device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C);
+    device_vector<T>             dcsr_val_C(hnnz_C);
+
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrrap_symbolic(PARAMS_SYMBOLIC, descrC, dcsr_row_ptr_C, dcsr_col_ind_C));
+
+    // Numeric stage
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_numeric<T>(PARAMS_NUMERIC));
+
+    host_vector<rocsparse_int> hcsr_row_ptr_C(M + 1);
+    host_vector<rocsparse_int> hcsr_col_ind_C(hnnz_C);
+    host_vector<T>             hcsr_val_C(hnnz_C);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C,
+                              dcsr_row_ptr_C,
+                              sizeof(rocsparse_int) * (M + 1),
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_C, dcsr_col_ind_C, sizeof(rocsparse_int) * hnnz_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C, hipMemcpyDeviceToHost));
+
+    unit_check_segments<rocsparse_int>(M + 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C);
+    unit_check_segments<rocsparse_int>(hnnz_C_gold, hcsr_col_ind_C_gold, hcsr_col_ind_C);
+    near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C);
+
+    // Numeric stage with updated values of S, reusing the sparsity pattern of C
+    for(rocsparse_int i = 0; i < nnz_S; ++i)
+    {
+        hcsr_val_S[i] *= static_cast<T>(2);
+    }
+
+    for(rocsparse_int i = 0; i < hnnz_C_gold; ++i)
+    {
+        hcsr_val_C_gold[i] *= static_cast<T>(2);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_S, hcsr_val_S, sizeof(T) * nnz_S, hipMemcpyHostToDevice));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_numeric<T>(PARAMS_NUMERIC));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C, hipMemcpyDeviceToHost));
+
+    near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C);
+
+#undef PARAMS_NUMERIC
+#undef PARAMS_SYMBOLIC
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+// Block matrix multiplication, using the sparsity patterns of A and B as block sparsity
+// patterns
+template <typename T>
+static void testing_bsrgemm(rocsparse_handle                  handle,
+                            rocsparse_int                     MB,
+                            rocsparse_int                     NB,
+                            rocsparse_int                     KB,
+                            T                                 h_alpha,
+                            const rocsparse_mat_descr         descrA,
+                            rocsparse_int                     nnzb_A,
+                            const host_vector<rocsparse_int>& hbsr_row_ptr_A,
+                            const host_vector<rocsparse_int>& hbsr_col_ind_A,
+                            const rocsparse_mat_descr         descrB,
+                            rocsparse_int                     nnzb_B,
+                            const host_vector<rocsparse_int>& hbsr_row_ptr_B,
+                            const host_vector<rocsparse_int>& hbsr_col_ind_B,
+                            const rocsparse_mat_descr         descrC)
+{
+    rocsparse_index_base baseA = rocsparse_get_mat_index_base(descrA);
+    rocsparse_index_base baseB = rocsparse_get_mat_index_base(descrB);
+    rocsparse_index_base baseC = rocsparse_get_mat_index_base(descrC);
+
+    // CPU block sparsity pattern of C
+    T                          h_one = static_cast<T>(1);
+    host_vector<rocsparse_int> hbsr_row_ptr_D;
+    host_vector<rocsparse_int> hbsr_col_ind_D;
+    host_vector<T>             hpattern_D;
+
+    rocsparse_int              hnnzb_C_gold;
+    host_vector<rocsparse_int> hbsr_row_ptr_C_gold(MB + 1);
+    host_csrgemm_nnz(MB,
+                     NB,
+                     KB,
+                     &h_one,
+                     hbsr_row_ptr_A,
+                     hbsr_col_ind_A,
+                     hbsr_row_ptr_B,
+                     hbsr_col_ind_B,
+                     (const T*)nullptr,
+                     hbsr_row_ptr_D,
+                     hbsr_col_ind_D,
+                     hbsr_row_ptr_C_gold,
+                     &hnnzb_C_gold,
+                     baseA,
+                     baseB,
+                     baseC,
+                     rocsparse_index_base_zero);
+
+    host_vector<rocsparse_int> hbsr_col_ind_C_gold(hnnzb_C_gold);
+    host_vector<T>             hpattern_A(nnzb_A);
+    host_vector<T>             hpattern_B(nnzb_B);
+    host_vector<T>             hpattern_C(hnnzb_C_gold);
+    host_csrgemm(MB,
+                 NB,
+                 KB,
+                 &h_one,
+                 hbsr_row_ptr_A,
+                 hbsr_col_ind_A,
+                 hpattern_A,
+                 hbsr_row_ptr_B,
+                 hbsr_col_ind_B,
+                 hpattern_B,
+                 (const T*)nullptr,
+                 hbsr_row_ptr_D,
+                 hbsr_col_ind_D,
+                 hpattern_D,
+                 hbsr_row_ptr_C_gold,
+                 hbsr_col_ind_C_gold,
+                 hpattern_C,
+                 baseA,
+                 baseB,
+                 baseC,
+                 rocsparse_index_base_zero);
+
+    device_vector<rocsparse_int> dbsr_row_ptr_A(MB + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_A(nnzb_A);
+    device_vector<rocsparse_int> dbsr_row_ptr_B(KB + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_B(nnzb_B);
+    device_vector<rocsparse_int> dbsr_row_ptr_C(MB + 1);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_A, hbsr_row_ptr_A, sizeof(rocsparse_int) * (MB + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_A, hbsr_col_ind_A, sizeof(rocsparse_int) * nnzb_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_B, hbsr_row_ptr_B, sizeof(rocsparse_int) * (KB + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_B, hbsr_col_ind_B, sizeof(rocsparse_int) * nnzb_B, hipMemcpyHostToDevice));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Block dimension 2 uses the register accumulated kernel, block dimension 7 the
+    // general kernel
+    for(rocsparse_int bsr_dim : {2, 7})
+    {
+        rocsparse_int bsize = bsr_dim * bsr_dim;
+
+        // Random blocks of A and B
+        host_vector<T> hbsr_val_A(nnzb_A * bsize);
+        host_vector<T> hbsr_val_B(nnzb_B * bsize);
+
+        for(rocsparse_int i = 0; i < nnzb_A * bsize; ++i)
+        {
+            hbsr_val_A[i] = random_generator<T>();
+        }
+
+        for(rocsparse_int i = 0; i < nnzb_B * bsize; ++i)
+        {
+            hbsr_val_B[i] = random_generator<T>();
+        }
+
+        device_vector<T> dbsr_val_A(nnzb_A * bsize);
+        device_vector<T> dbsr_val_B(nnzb_B * bsize);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dbsr_val_A, hbsr_val_A, sizeof(T) * nnzb_A * bsize, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dbsr_val_B, hbsr_val_B, sizeof(T) * nnzb_B * bsize, hipMemcpyHostToDevice));
+
+        for(rocsparse_direction dir : {rocsparse_direction_row, rocsparse_direction_column})
+        {
+            // CPU blocks of C
+            host_vector<T> hbsr_val_C_gold(hnnzb_C_gold * bsize);
+
+            for(rocsparse_int i = 0; i < MB; ++i)
+            {
+                for(rocsparse_int j = hbsr_row_ptr_C_gold[i] - baseC;
+                    j < hbsr_row_ptr_C_gold[i + 1] - baseC;
+                    ++j)
+                {
+                    rocsparse_int col = hbsr_col_ind_C_gold[j] - baseC;
+
+                    for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                    {
+                        for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                        {
+                            T sum = static_cast<T>(0);
+
+                            for(rocsparse_int k = hbsr_row_ptr_A[i] - baseA;
+                                k < hbsr_row_ptr_A[i + 1] - baseA;
+                                ++k)
+                            {
+                                rocsparse_int col_A = hbsr_col_ind_A[k] - baseA;
+
+                                for(rocsparse_int l = hbsr_row_ptr_B[col_A] - baseB;
+                                    l < hbsr_row_ptr_B[col_A + 1] - baseB;
+                                    ++l)
+                                {
+                                    if(hbsr_col_ind_B[l] - baseB != col)
+                                    {
+                                        continue;
+                                    }
+
+                                    for(rocsparse_int bk = 0; bk < bsr_dim; ++bk)
+                                    {
+                                        sum += hbsr_val_A[BSR_IND(k, bi, bk, dir)]
+                                               * hbsr_val_B[BSR_IND(l, bk, bj, dir)];
+                                    }
+                                }
+                            }
+
+                            hbsr_val_C_gold[BSR_IND(j, bi, bj, dir)] = h_alpha * sum;
+                        }
+                    }
+                }
+            }
+
+            rocsparse_int hnnzb_C;
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm_nnz(handle,
+                                                        dir,
+                                                        MB,
+                                                        NB,
+                                                        KB,
+                                                        bsr_dim,
+                                                        descrA,
+                                                        nnzb_A,
+                                                        dbsr_row_ptr_A,
+                                                        dbsr_col_ind_A,
+                                                        descrB,
+                                                        nnzb_B,
+                                                        dbsr_row_ptr_B,
+                                                        dbsr_col_ind_B,
+                                                        descrC,
+                                                        dbsr_row_ptr_C,
+                                                        &hnnzb_C));
+
+            unit_check_scalar(hnnzb_C_gold, hnnzb_C);
+
+            device_vector<rocsparse_int> dbsr_col_ind_C(hnnzb_C);
+            device_vector<T>             dbsr_val_C(hnnzb_C * bsize);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm<T>(handle,
+                                                       dir,
+                                                       MB,
+                                                       NB,
+                                                       KB,
+                                                       bsr_dim,
+                                                       &h_alpha,
+                                                       descrA,
+                                                       nnzb_A,
+                                                       dbsr_val_A,
+                                                       dbsr_row_ptr_A,
+                                                       dbsr_col_ind_A,
+                                                       descrB,
+                                                       nnzb_B,
+                                                       dbsr_val_B,
+                                                       dbsr_row_ptr_B,
+                                                       dbsr_col_ind_B,
+                                                       descrC,
+                                                       dbsr_val_C,
+                                                       dbsr_row_ptr_C,
+                                                       dbsr_col_ind_C));
+
+            host_vector<rocsparse_int> hbsr_row_ptr_C(MB + 1);
+            host_vector<rocsparse_int> hbsr_col_ind_C(hnnzb_C);
+            host_vector<T>             hbsr_val_C(hnnzb_C * bsize);
+
+            CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr_C,
+                                      dbsr_row_ptr_C,
+                                      sizeof(rocsparse_int) * (MB + 1),
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind_C,
+                                      dbsr_col_ind_C,
+                                      sizeof(rocsparse_int) * hnnzb_C,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(
+                hbsr_val_C, dbsr_val_C, sizeof(T) * hnnzb_C * bsize, hipMemcpyDeviceToHost));
+
+            unit_check_segments<rocsparse_int>(MB + 1, hbsr_row_ptr_C_gold, hbsr_row_ptr_C);
+            unit_check_segments<rocsparse_int>(hnnzb_C_gold, hbsr_col_ind_C_gold, hbsr_col_ind_C);
+            near_check_segments<T>(hnnzb_C_gold * bsize, hbsr_val_C_gold, hbsr_val_C);
+        }
+    }
+}
+
+// Estimate of the number of non-zero entries of A * B, which is exact if all rows are
+// sampled
+template <typename T>
+static void testing_csrgemm_nnz_estimate(rocsparse_handle                  handle,
+                                         rocsparse_int                     M,
+                                         rocsparse_int                     N,
+                                         rocsparse_int                     K,
+                                         const rocsparse_mat_descr         descrA,
+                                         rocsparse_int                     nnz_A,
+                                         const host_vector<rocsparse_int>& hcsr_row_ptr_A,
+                                         const host_vector<rocsparse_int>& hcsr_col_ind_A,
+                                         const rocsparse_int*              dcsr_row_ptr_A,
+                                         const rocsparse_int*              dcsr_col_ind_A,
+                                         const rocsparse_mat_descr         descrB,
+                                         rocsparse_int                     nnz_B,
+                                         const host_vector<rocsparse_int>& hcsr_row_ptr_B,
+                                         const rocsparse_int*              dcsr_row_ptr_B,
+                                         const rocsparse_int*              dcsr_col_ind_B,
+                                         rocsparse_int                     hnnz_C_gold)
+{
+    rocsparse_index_base baseA = rocsparse_get_mat_index_base(descrA);
+
+    // Rows per group and upper bound of the non-zero entries of C
+    static constexpr rocsparse_int bound[7] = {32, 64, 512, 1024, 2048, 4096, 8192};
+
+    rocsparse_int hgroup_rows_gold[8] = {};
+    int64_t       hnnz_C_bound        = 0;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int nprod = 0;
+
+        for(rocsparse_int j = hcsr_row_ptr_A[i] - baseA; j < hcsr_row_ptr_A[i + 1] - baseA; ++j)
+        {
+            rocsparse_int col = hcsr_col_ind_A[j] - baseA;
+
+            nprod += hcsr_row_ptr_B[col + 1] - hcsr_row_ptr_B[col];
+        }
+
+        int group = 0;
+        while(group < 7 && nprod > bound[group])
+        {
+            ++group;
+        }
+
+        ++hgroup_rows_gold[group];
+        hnnz_C_bound += std::min(nprod, N);
+    }
+
+    for(rocsparse_int sample_size : {M, 4})
+    {
+        int64_t       hnnz_C;
+        int64_t       hnnz_C_lower;
+        int64_t       hnnz_C_upper;
+        rocsparse_int hgroup_rows[8];
+        int64_t       hgroup_nnz[8];
+        size_t        hgroup_workspace[8];
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz_estimate<T>(handle,
+                                                                rocsparse_operation_none,
+                                                                rocsparse_operation_none,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                descrA,
+                                                                nnz_A,
+                                                                dcsr_row_ptr_A,
+                                                                dcsr_col_ind_A,
+                                                                descrB,
+                                                                nnz_B,
+                                                                dcsr_row_ptr_B,
+                                                                dcsr_col_ind_B,
+                                                                sample_size,
+                                                                &hnnz_C,
+                                                                &hnnz_C_lower,
+                                                                &hnnz_C_upper,
+                                                                hgroup_rows,
+                                                                hgroup_nnz,
+                                                                hgroup_workspace));
+
+        int64_t hnnz_C_groups = 0;
+
+        for(int i = 0; i < 8; ++i)
+        {
+            hnnz_C_groups += hgroup_nnz[i];
+
+            // Non-empty groups require workspace
+            unit_check_scalar<size_t>(hgroup_rows[i] > 0 ? 1 : 0, hgroup_workspace[i] > 0 ? 1 : 0);
+        }
+
+        unit_check_segments<rocsparse_int>(8, hgroup_rows_gold, hgroup_rows);
+        unit_check_scalar<int64_t>(hnnz_C_groups, hnnz_C);
+
+        // The estimate is enclosed by its confidence bound, which cannot exceed the number of
+        // intermediate products
+        unit_check_scalar<int64_t>(std::min(hnnz_C_lower, hnnz_C), hnnz_C_lower);
+        unit_check_scalar<int64_t>(std::max(hnnz_C_upper, hnnz_C), hnnz_C_upper);
+        unit_check_scalar<int64_t>(std::min(hnnz_C_upper, hnnz_C_bound), hnnz_C_upper);
+
+        // If all rows are sampled, the estimate is exact
+        if(sample_size == M)
+        {
+            unit_check_scalar<int64_t>(hnnz_C_gold, hnnz_C);
+            unit_check_scalar<int64_t>(hnnz_C_gold, hnnz_C_lower);
+            unit_check_scalar<int64_t>(hnnz_C_gold, hnnz_C_upper);
+        }
+    }
+}
+
 template <typename T>
 void testing_csrgemm(const Arguments& arg)
 {
@@ -443,6 +1340,12 @@ void testing_csrgemm(const Arguments& arg)
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrD, baseD));
 
+    // Set deterministic mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_deterministic_mode(
+        handle,
+        arg.deterministic ? rocsparse_deterministic_mode_enabled
+                          : rocsparse_deterministic_mode_disabled));
+
     // Argument sanity check before allocating invalid memory
     if((M <= 0 || N <= 0 || K <= 0) || scenario == 1)
     {
@@ -934,6 +1837,197 @@ void testing_csrgemm(const Arguments& arg)
         unit_check_segments<rocsparse_int>(hnnz_C_gold, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
         near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C_1);
         near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hcsr_val_C_2);
+
+        if(arg.deterministic)
+        {
+            // Results of repeated runs need to be bitwise identical
+            device_vector<rocsparse_int> dcsr_col_ind_C_3(hnnz_C_1);
+            device_vector<T>             dcsr_val_C_3(hnnz_C_1);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       halpha_ptr,
+                                                       descrA,
+                                                       nnz_A,
+                                                       dcsr_val_A,
+                                                       dcsr_row_ptr_A,
+                                                       dcsr_col_ind_A,
+                                                       descrB,
+                                                       nnz_B,
+                                                       dcsr_val_B,
+                                                       dcsr_row_ptr_B,
+                                                       dcsr_col_ind_B,
+                                                       hbeta_ptr,
+                                                       descrD,
+                                                       nnz_D,
+                                                       dcsr_val_D,
+                                                       dcsr_row_ptr_D,
+                                                       dcsr_col_ind_D,
+                                                       descrC,
+                                                       dcsr_val_C_3,
+                                                       dcsr_row_ptr_C_1,
+                                                       dcsr_col_ind_C_3,
+                                                       info,
+                                                       dbuffer));
+
+            host_vector<rocsparse_int> hcsr_col_ind_C_3(hnnz_C_1);
+            host_vector<T>             hcsr_val_C_3(hnnz_C_1);
+
+            hcsr_col_ind_C_3.transfer_from(dcsr_col_ind_C_3);
+            hcsr_val_C_3.transfer_from(dcsr_val_C_3);
+
+            hcsr_col_ind_C_1.unit_check(hcsr_col_ind_C_3);
+            hcsr_val_C_1.unit_check(hcsr_val_C_3);
+            hcsr_val_C_1.unit_check(hcsr_val_C_2);
+        }
+
+        // Chunked csrgemm, with a memory budget that is too small to hold C at once
+        csrgemm_chunked_data<T> hC_3;
+        hC_3.base = baseC;
+        hC_3.row_ptr.resize(M + 1);
+        hC_3.row_ptr[0] = baseC;
+
+        size_t memory_budget = buffer_size + sizeof(rocsparse_int) * (M + 1) + 4096
+                               + (sizeof(rocsparse_int) + sizeof(T)) * (hnnz_C_gold + 2 * N);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_chunked<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           halpha_ptr,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_val_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_val_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           hbeta_ptr,
+                                                           descrD,
+                                                           nnz_D,
+                                                           dcsr_val_D,
+                                                           dcsr_row_ptr_D,
+                                                           dcsr_col_ind_D,
+                                                           descrC,
+                                                           info,
+                                                           memory_budget,
+                                                           csrgemm_chunked_append<T>,
+                                                           &hC_3));
+
+        unit_check_scalar(hnnz_C_gold, hC_3.row_ptr[M] - baseC);
+        unit_check_segments<rocsparse_int>(M + 1, hcsr_row_ptr_C_gold, hC_3.row_ptr);
+        unit_check_segments<rocsparse_int>(hnnz_C_gold, hcsr_col_ind_C_gold, hC_3.col_ind);
+        near_check_segments<T>(hnnz_C_gold, hcsr_val_C_gold, hC_3.val);
+
+        // Masked csrgemm
+        if(scenario == 4)
+        {
+            testing_csrgemm_masked<T>(handle,
+                                      M,
+                                      N,
+                                      K,
+                                      h_alpha,
+                                      descrA,
+                                      nnz_A,
+                                      hcsr_row_ptr_A,
+                                      hcsr_col_ind_A,
+                                      hcsr_val_A,
+                                      dcsr_row_ptr_A,
+                                      dcsr_col_ind_A,
+                                      dcsr_val_A,
+                                      descrB,
+                                      nnz_B,
+                                      hcsr_row_ptr_B,
+                                      hcsr_col_ind_B,
+                                      hcsr_val_B,
+                                      dcsr_row_ptr_B,
+                                      dcsr_col_ind_B,
+                                      dcsr_val_B,
+                                      descrD,
+                                      nnz_D,
+                                      hcsr_row_ptr_D,
+                                      hcsr_col_ind_D,
+                                      dcsr_row_ptr_D,
+                                      dcsr_col_ind_D,
+                                      descrC);
+        }
+
+        // Galerkin triple product
+        if(scenario == 2 || scenario == 4)
+        {
+            testing_csrrap<T>(handle,
+                              M,
+                              N,
+                              K,
+                              descrA,
+                              nnz_A,
+                              hcsr_row_ptr_A,
+                              hcsr_col_ind_A,
+                              hcsr_val_A,
+                              dcsr_row_ptr_A,
+                              dcsr_col_ind_A,
+                              dcsr_val_A,
+                              descrB,
+                              nnz_B,
+                              hcsr_row_ptr_B,
+                              hcsr_col_ind_B,
+                              hcsr_val_B,
+                              dcsr_row_ptr_B,
+                              dcsr_col_ind_B,
+                              dcsr_val_B,
+                              descrC);
+        }
+
+        // Output size estimate
+        if(scenario == 2)
+        {
+            testing_csrgemm_nnz_estimate<T>(handle,
+                                            M,
+                                            N,
+                                            K,
+                                            descrA,
+                                            nnz_A,
+                                            hcsr_row_ptr_A,
+                                            hcsr_col_ind_A,
+                                            dcsr_row_ptr_A,
+                                            dcsr_col_ind_A,
+                                            descrB,
+                                            nnz_B,
+                                            hcsr_row_ptr_B,
+                                            dcsr_row_ptr_B,
+                                            dcsr_col_ind_B,
+                                            hnnz_C_gold);
+        }
+
+        // BSR matrix multiplication
+        if(scenario == 2)
+        {
+            testing_bsrgemm<T>(handle,
+                               M,
+                               N,
+                               K,
+                               h_alpha,
+                               descrA,
+                               nnz_A,
+                               hcsr_row_ptr_A,
+                               hcsr_col_ind_A,
+                               descrB,
+                               nnz_B,
+                               hcsr_row_ptr_B,
+                               hcsr_col_ind_B,
+                               descrC);
+        }
     }
 
     if(arg.timing)
@@ -1095,8 +2189,8 @@ void testing_csrgemm(const Arguments& arg)
                   << std::setw(12) << "nnz_B" << std::setw(12) << "nnz_C" << std::setw(12)
                   << "nnz_D" << std::setw(12) << "alpha" << std::setw(12) << "beta" << std::setw(12)
                   << "GFlop/s" << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec"
-                  << std::setw(16) << "gemm msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << std::setw(16) << "gemm msec" << std::setw(12) << "iter" << std::setw(14)
+                  << "deterministic" << std::setw(12) << "verified" << std::endl;
 
         std::cout << std::setw(12) << rocsparse_operation2string(transA) << std::setw(12)
                   << rocsparse_operation2string(transB) << std::setw(12) << M << std::setw(12) << N
@@ -1120,7 +2214,8 @@ void testing_csrgemm(const Arguments& arg)
         }
         std::cout << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte << std::setw(16)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
-                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << std::setw(12) << number_hot_calls << std::setw(14)
+                  << (arg.deterministic ? "yes" : "no") << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
     }
 
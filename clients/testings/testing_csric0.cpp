@@ -26,6 +26,112 @@
 
 #include "auto_testing_bad_arg.hpp"
 
+// Compute the fixed-point iterative incomplete Cholesky factorization on the device, using
+// the analysis data of info, and compare against the host fixed-point iteration
+template <typename T>
+static void testing_csric0_iterative_sweeps(rocsparse_handle                  handle,
+                                            const rocsparse_mat_descr         descr,
+                                            rocsparse_mat_info                info,
+                                            rocsparse_int                     M,
+                                            rocsparse_int                     nnz,
+                                            const host_vector<rocsparse_int>& hcsr_row_ptr,
+                                            const host_vector<rocsparse_int>& hcsr_col_ind,
+                                            const host_vector<T>&             hcsr_val,
+                                            rocsparse_int                     sweeps)
+{
+    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
+
+    // Host fixed-point iteration
+    host_vector<T>                  hcsr_val_gold(hcsr_val);
+    host_vector<floating_data_t<T>> h_residual_gold(1);
+    rocsparse_int                   h_pivot_gold;
+
+    host_csric0_iterative<T>(M,
+                             hcsr_row_ptr,
+                             hcsr_col_ind,
+                             hcsr_val_gold,
+                             base,
+                             sweeps,
+                             h_residual_gold,
+                             &h_pivot_gold);
+
+    // Iterates of non-convergent fixed-point iterations may overflow
+    if(h_pivot_gold != -1 || !std::isfinite(h_residual_gold[0]))
+    {
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int>      dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int>      dcsr_col_ind(nnz);
+    device_vector<T>                  dcsr_val_1(nnz);
+    device_vector<T>                  dcsr_val_2(nnz);
+    device_vector<floating_data_t<T>> d_residual_2(1);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_2, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_iterative_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val_1, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    // Pointer mode host
+    host_vector<floating_data_t<T>> h_residual_1(1);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_iterative<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val_1,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        sweeps,
+                                                        h_residual_1,
+                                                        dbuffer));
+
+    // Pointer mode device
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_iterative<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val_2,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info,
+                                                        sweeps,
+                                                        d_residual_2,
+                                                        dbuffer));
+
+    // Copy output to host
+    host_vector<T>                  hcsr_val_1(nnz);
+    host_vector<T>                  hcsr_val_2(nnz);
+    host_vector<floating_data_t<T>> h_residual_2(1);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_1, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_2, dcsr_val_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        h_residual_2, d_residual_2, sizeof(floating_data_t<T>), hipMemcpyDeviceToHost));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+    hcsr_val_gold.near_check(hcsr_val_1);
+    hcsr_val_gold.near_check(hcsr_val_2);
+    h_residual_gold.near_check(h_residual_1);
+    h_residual_gold.near_check(h_residual_2);
+}
+
 template <typename T>
 void testing_csric0_bad_arg(const Arguments& arg)
 {
@@ -65,6 +171,20 @@ void testing_csric0_bad_arg(const Arguments& arg)
 
 #undef PARAMS_BUFFER_SIZE
 #undef PARAMS_ANALYSIS
+#undef PARAMS
+
+    // Test rocsparse_csric0_iterative_buffer_size() and rocsparse_csric0_iterative()
+    rocsparse_int       sweeps   = 1;
+    floating_data_t<T>* residual = (floating_data_t<T>*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, sweeps, residual, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csric0_iterative_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csric0_iterative<T>, PARAMS);
+
+#undef PARAMS_BUFFER_SIZE
 #undef PARAMS
 
     // Test rocsparse_csric0_zero_pivot()
@@ -337,6 +457,20 @@ void testing_csric0(const Arguments& arg)
         {
             hcsr_val_gold.near_check(hcsr_val_1);
             hcsr_val_gold.near_check(hcsr_val_2);
+
+            // Fixed-point iterative incomplete Cholesky, reusing the analysis data
+            for(rocsparse_int sweeps = 0; sweeps <= 3; sweeps += 3)
+            {
+                testing_csric0_iterative_sweeps<T>(handle,
+                                                   descr,
+                                                   info,
+                                                   M,
+                                                   nnz,
+                                                   hcsr_row_ptr,
+                                                   hcsr_col_ind,
+                                                   hcsr_val,
+                                                   sweeps);
+            }
         }
     }
 
@@ -426,6 +560,64 @@ void testing_csric0(const Arguments& arg)
 
         gpu_solve_time_used = gpu_solve_time_used / number_hot_calls;
 
+        // Fixed-point iterative factorization, reusing the analysis data
+        static constexpr rocsparse_int sweeps = 3;
+
+        size_t iterative_buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csric0_iterative_buffer_size<T>(
+            handle, M, nnz, descr, dcsr_val_1, dcsr_row_ptr, dcsr_col_ind, &iterative_buffer_size));
+
+        void* diterative_buffer;
+        CHECK_HIP_ERROR(hipMalloc(&diterative_buffer, iterative_buffer_size));
+
+        floating_data_t<T> residual;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csric0_iterative<T>(handle,
+                                                                M,
+                                                                nnz,
+                                                                descr,
+                                                                dcsr_val_1,
+                                                                dcsr_row_ptr,
+                                                                dcsr_col_ind,
+                                                                info,
+                                                                sweeps,
+                                                                &residual,
+                                                                diterative_buffer));
+        }
+
+        double gpu_iterative_time_used = 0;
+
+        // Iterative run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+            double temp = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csric0_iterative<T>(handle,
+                                                                M,
+                                                                nnz,
+                                                                descr,
+                                                                dcsr_val_1,
+                                                                dcsr_row_ptr,
+                                                                dcsr_col_ind,
+                                                                info,
+                                                                sweeps,
+                                                                &residual,
+                                                                diterative_buffer));
+            gpu_iterative_time_used += (get_time_us() - temp);
+        }
+
+        gpu_iterative_time_used = gpu_iterative_time_used / number_hot_calls;
+
+        CHECK_HIP_ERROR(hipFree(diterative_buffer));
+
         double gpu_gbyte = csric0_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6;
 
         rocsparse_int pivot = -1;
@@ -449,13 +641,15 @@ void testing_csric0(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "pivot"
                   << std::setw(16) << "analysis policy" << std::setw(16) << "solve policy"
                   << std::setw(12) << "GB/s" << std::setw(16) << "analysis msec" << std::setw(16)
-                  << "solve msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << "solve msec" << std::setw(16) << "iterative msec" << std::setw(12)
+                  << "residual" << std::setw(12) << "iter" << std::setw(12) << "verified"
                   << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << pivot
                   << std::setw(16) << rocsparse_analysis2string(apol) << std::setw(16)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
+                  << std::setw(16) << gpu_iterative_time_used / 1e3 << std::setw(12) << residual
                   << std::setw(12) << number_hot_calls << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
     }
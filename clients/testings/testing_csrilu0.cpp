@@ -28,6 +28,530 @@
 
 #include "auto_testing_bad_arg.hpp"
 
+#include <map>
+
+// Host reference of the ILU(k) sparsity pattern, using the classical level of fill
+// recursion lev(i,j) = min(lev(i,j), lev(i,k) + lev(k,j) + 1) over the rows k < i
+static void csriluk_symbolic_host(rocsparse_int                     M,
+                                  const std::vector<rocsparse_int>& csr_row_ptr,
+                                  const std::vector<rocsparse_int>& csr_col_ind,
+                                  rocsparse_int                     lfil,
+                                  rocsparse_index_base              base,
+                                  std::vector<rocsparse_int>&       csr_row_ptr_LU,
+                                  std::vector<rocsparse_int>&       csr_col_ind_LU)
+{
+    std::vector<std::map<rocsparse_int, rocsparse_int>> rows(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        std::map<rocsparse_int, rocsparse_int>& row = rows[i];
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            row[csr_col_ind[j] - base] = 0;
+        }
+
+        // Fill-ins of row i are always inserted right of k, thus they are visited later
+        for(auto ik = row.begin(); ik != row.end() && ik->first < i; ++ik)
+        {
+            rocsparse_int k = ik->first;
+
+            for(auto kj = rows[k].upper_bound(k); kj != rows[k].end(); ++kj)
+            {
+                rocsparse_int lev = ik->second + kj->second + 1;
+
+                if(lev <= lfil)
+                {
+                    auto ij = row.find(kj->first);
+
+                    if(ij == row.end())
+                    {
+                        row[kj->first] = lev;
+                    }
+                    else
+                    {
+                        ij->second = std::min(ij->second, lev);
+                    }
+                }
+            }
+        }
+    }
+
+    csr_row_ptr_LU.resize(M + 1);
+    csr_col_ind_LU.clear();
+
+    csr_row_ptr_LU[0] = base;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(auto ij = rows[i].begin(); ij != rows[i].end(); ++ij)
+        {
+            csr_col_ind_LU.push_back(ij->first + base);
+        }
+
+        csr_row_ptr_LU[i + 1] = csr_col_ind_LU.size() + base;
+    }
+}
+
+// Compute the ILU(k) factorization on the device and compare against the host ILU(0)
+// factorization of the host ILU(k) pattern
+template <typename T>
+static void testing_csriluk_lfil(rocsparse_handle                  handle,
+                                 const rocsparse_mat_descr         descr,
+                                 rocsparse_int                     M,
+                                 rocsparse_int                     nnz,
+                                 const host_vector<rocsparse_int>& hcsr_row_ptr,
+                                 const host_vector<rocsparse_int>& hcsr_col_ind,
+                                 const host_vector<T>&             hcsr_val,
+                                 rocsparse_int                     lfil,
+                                 rocsparse_analysis_policy         apol,
+                                 rocsparse_solve_policy            spol)
+{
+    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
+
+    // Create matrix descriptor and info of the ILU(k) pattern
+    rocsparse_local_mat_descr descr_LU;
+    rocsparse_local_mat_info  info_LU;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_LU, base));
+
+    // Host ILU(k) pattern
+    host_vector<rocsparse_int> hcsr_row_ptr_LU_gold;
+    host_vector<rocsparse_int> hcsr_col_ind_LU_gold;
+
+    csriluk_symbolic_host(
+        M, hcsr_row_ptr, hcsr_col_ind, lfil, base, hcsr_row_ptr_LU_gold, hcsr_col_ind_LU_gold);
+
+    rocsparse_int nnz_LU_gold = hcsr_row_ptr_LU_gold[M] - base;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcsr_row_ptr_LU(M + 1);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Symbolic stage
+    size_t buffer_size_LU;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_buffer_size(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, lfil, &buffer_size_LU));
+
+    void* dbuffer_LU;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer_LU, buffer_size_LU));
+
+    rocsparse_int nnz_LU;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                M,
+                                                nnz,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                lfil,
+                                                descr_LU,
+                                                dcsr_row_ptr_LU,
+                                                &nnz_LU,
+                                                info_LU,
+                                                dbuffer_LU));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer_LU));
+
+    unit_check_scalar(nnz_LU_gold, nnz_LU);
+
+    device_vector<rocsparse_int> dcsr_col_ind_LU(nnz_LU);
+    device_vector<T>             dcsr_val_LU(nnz_LU);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(handle,
+                                                     M,
+                                                     nnz,
+                                                     descr,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     lfil,
+                                                     descr_LU,
+                                                     dcsr_row_ptr_LU,
+                                                     dcsr_col_ind_LU,
+                                                     info_LU));
+
+    host_vector<rocsparse_int> hcsr_row_ptr_LU(M + 1);
+    host_vector<rocsparse_int> hcsr_col_ind_LU(nnz_LU);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_LU, dcsr_row_ptr_LU, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_LU, dcsr_col_ind_LU, sizeof(rocsparse_int) * nnz_LU, hipMemcpyDeviceToHost));
+
+    hcsr_row_ptr_LU_gold.unit_check(hcsr_row_ptr_LU);
+    hcsr_col_ind_LU_gold.unit_check(hcsr_col_ind_LU);
+
+    // Numeric stage, using the csrilu0 analysis of the ILU(k) pattern
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(handle,
+                                                           M,
+                                                           nnz_LU,
+                                                           descr_LU,
+                                                           dcsr_val_LU,
+                                                           dcsr_row_ptr_LU,
+                                                           dcsr_col_ind_LU,
+                                                           info_LU,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        M,
+                                                        nnz_LU,
+                                                        descr_LU,
+                                                        dcsr_val_LU,
+                                                        dcsr_row_ptr_LU,
+                                                        dcsr_col_ind_LU,
+                                                        info_LU,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                               M,
+                                               nnz,
+                                               descr,
+                                               dcsr_val,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               nnz_LU,
+                                               descr_LU,
+                                               dcsr_val_LU,
+                                               dcsr_row_ptr_LU,
+                                               dcsr_col_ind_LU,
+                                               info_LU,
+                                               spol,
+                                               dbuffer));
+
+    host_vector<T> hcsr_val_LU(nnz_LU);
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_LU, dcsr_val_LU, sizeof(T) * nnz_LU, hipMemcpyDeviceToHost));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+    // Scatter A into the ILU(k) pattern, fill-in entries are zero
+    host_vector<T> hcsr_val_LU_gold(nnz_LU, static_cast<T>(0));
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int k = hcsr_row_ptr_LU_gold[i] - base;
+
+        for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+        {
+            while(hcsr_col_ind_LU_gold[k] != hcsr_col_ind[j])
+            {
+                ++k;
+            }
+
+            hcsr_val_LU_gold[k] = hcsr_val[j];
+        }
+    }
+
+    // CPU csrilu0 on the ILU(k) pattern
+    host_vector<rocsparse_int> h_analysis_pivot_gold(1);
+    host_vector<rocsparse_int> h_solve_pivot_gold(1);
+
+    host_csrilu0<T>(M,
+                    hcsr_row_ptr_LU_gold,
+                    hcsr_col_ind_LU_gold,
+                    hcsr_val_LU_gold,
+                    base,
+                    h_analysis_pivot_gold,
+                    h_solve_pivot_gold,
+                    0,
+                    static_cast<floating_data_t<T>>(0),
+                    static_cast<T>(0));
+
+    // Fill-ins may introduce zero pivots, that are not present in ILU(0)
+    if(h_solve_pivot_gold[0] == -1)
+    {
+        hcsr_val_LU_gold.near_check(hcsr_val_LU);
+    }
+}
+
+// Compute the ILUT factorization on the device and compare against the host ILUT
+// factorization, including the zero pivot
+template <typename T>
+static void testing_csrilut_tol(rocsparse_handle                  handle,
+                                const rocsparse_mat_descr         descr,
+                                rocsparse_int                     M,
+                                rocsparse_int                     nnz,
+                                const host_vector<rocsparse_int>& hcsr_row_ptr,
+                                const host_vector<rocsparse_int>& hcsr_col_ind,
+                                const host_vector<T>&             hcsr_val,
+                                floating_data_t<T>                tol,
+                                rocsparse_int                     max_fill,
+                                int                               boost     = 0,
+                                floating_data_t<T>                boost_tol = 0,
+                                T                                 boost_val = static_cast<T>(0))
+{
+    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
+
+    // Create matrix descriptor and info of the factorization
+    rocsparse_local_mat_descr descr_LU;
+    rocsparse_local_mat_info  info_LU;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_LU, base));
+
+    // Host ILUT
+    host_vector<rocsparse_int> hcsr_row_ptr_LU_gold;
+    host_vector<rocsparse_int> hcsr_col_ind_LU_gold;
+    host_vector<T>             hcsr_val_LU_gold;
+    rocsparse_int              h_pivot_gold;
+
+    host_csrilut<T>(M,
+                    hcsr_row_ptr,
+                    hcsr_col_ind,
+                    hcsr_val,
+                    base,
+                    tol,
+                    max_fill,
+                    base,
+                    hcsr_row_ptr_LU_gold,
+                    hcsr_col_ind_LU_gold,
+                    hcsr_val_LU_gold,
+                    &h_pivot_gold,
+                    boost != 0,
+                    boost_tol,
+                    boost_val);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcsr_row_ptr_LU(M + 1);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, max_fill, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    // Factorization and row pointers
+    rocsparse_int nnz_LU;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrilut_numeric_boost<T>(handle, info_LU, boost, &boost_tol, &boost_val));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_nnz<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   &tol,
+                                                   max_fill,
+                                                   descr_LU,
+                                                   dcsr_row_ptr_LU,
+                                                   &nnz_LU,
+                                                   info_LU,
+                                                   dbuffer));
+
+    unit_check_scalar(hcsr_row_ptr_LU_gold[M] - base, nnz_LU);
+
+    // Check zero pivot
+    rocsparse_int h_pivot;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_zero_pivot(handle, info_LU, &h_pivot),
+                            (h_pivot_gold != -1) ? rocsparse_status_zero_pivot
+                                                 : rocsparse_status_success);
+    unit_check_scalar(h_pivot_gold, h_pivot);
+
+    device_vector<rocsparse_int> dcsr_col_ind_LU(nnz_LU);
+    device_vector<T>             dcsr_val_LU(nnz_LU);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                               M,
+                                               max_fill,
+                                               nnz_LU,
+                                               descr_LU,
+                                               dcsr_val_LU,
+                                               dcsr_row_ptr_LU,
+                                               dcsr_col_ind_LU,
+                                               dbuffer));
+
+    host_vector<rocsparse_int> hcsr_row_ptr_LU(M + 1);
+    host_vector<rocsparse_int> hcsr_col_ind_LU(nnz_LU);
+    host_vector<T>             hcsr_val_LU(nnz_LU);
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_row_ptr_LU, dcsr_row_ptr_LU, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcsr_col_ind_LU, dcsr_col_ind_LU, sizeof(rocsparse_int) * nnz_LU, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_LU, dcsr_val_LU, sizeof(T) * nnz_LU, hipMemcpyDeviceToHost));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+    hcsr_row_ptr_LU_gold.unit_check(hcsr_row_ptr_LU);
+    hcsr_col_ind_LU_gold.unit_check(hcsr_col_ind_LU);
+    hcsr_val_LU_gold.near_check(hcsr_val_LU);
+}
+
+// Compute the ILUT factorization of a matrix, where row 1 has a structural zero pivot and
+// row 2 depends on it, with and without numeric boost
+template <typename T>
+static void testing_csrilut_zero_pivot(rocsparse_handle handle, const rocsparse_mat_descr descr)
+{
+    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
+
+    // A = [2 0 0]
+    //     [1 0 1]
+    //     [0 1 3]
+    host_vector<rocsparse_int> hcsr_row_ptr = {0, 1, 3, 5};
+    host_vector<rocsparse_int> hcsr_col_ind = {0, 0, 2, 1, 2};
+    host_vector<T>             hcsr_val     = {static_cast<T>(2),
+                                               static_cast<T>(1),
+                                               static_cast<T>(1),
+                                               static_cast<T>(1),
+                                               static_cast<T>(3)};
+
+    for(size_t i = 0; i < hcsr_row_ptr.size(); ++i)
+    {
+        hcsr_row_ptr[i] += base;
+    }
+
+    for(size_t i = 0; i < hcsr_col_ind.size(); ++i)
+    {
+        hcsr_col_ind[i] += base;
+    }
+
+    testing_csrilut_tol<T>(handle, descr, 3, 5, hcsr_row_ptr, hcsr_col_ind, hcsr_val, 0, 2);
+    testing_csrilut_tol<T>(handle,
+                           descr,
+                           3,
+                           5,
+                           hcsr_row_ptr,
+                           hcsr_col_ind,
+                           hcsr_val,
+                           0,
+                           2,
+                           1,
+                           static_cast<floating_data_t<T>>(0.5),
+                           static_cast<T>(1));
+}
+
+// Compute the fixed-point iterative ILU(0) factorization on the device, using the analysis
+// data of info, and compare against the host fixed-point iteration
+template <typename T>
+static void testing_csrilu0_iterative_sweeps(rocsparse_handle                  handle,
+                                             const rocsparse_mat_descr         descr,
+                                             rocsparse_mat_info                info,
+                                             rocsparse_int                     M,
+                                             rocsparse_int                     nnz,
+                                             const host_vector<rocsparse_int>& hcsr_row_ptr,
+                                             const host_vector<rocsparse_int>& hcsr_col_ind,
+                                             const host_vector<T>&             hcsr_val,
+                                             rocsparse_int                     sweeps)
+{
+    rocsparse_index_base base = rocsparse_get_mat_index_base(descr);
+
+    // Host fixed-point iteration
+    host_vector<T>                  hcsr_val_gold(hcsr_val);
+    host_vector<floating_data_t<T>> h_residual_gold(1);
+    rocsparse_int                   h_pivot_gold;
+
+    host_csrilu0_iterative<T>(M,
+                              hcsr_row_ptr,
+                              hcsr_col_ind,
+                              hcsr_val_gold,
+                              base,
+                              sweeps,
+                              h_residual_gold,
+                              &h_pivot_gold);
+
+    // Iterates of non-convergent fixed-point iterations may overflow
+    if(h_pivot_gold != -1 || !std::isfinite(h_residual_gold[0]))
+    {
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int>      dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int>      dcsr_col_ind(nnz);
+    device_vector<T>                  dcsr_val_1(nnz);
+    device_vector<T>                  dcsr_val_2(nnz);
+    device_vector<floating_data_t<T>> d_residual_2(1);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_1, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_2, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val_1, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    // Pointer mode host
+    host_vector<floating_data_t<T>> h_residual_1(1);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val_1,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         sweeps,
+                                                         h_residual_1,
+                                                         dbuffer));
+
+    // Pointer mode device
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val_2,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         sweeps,
+                                                         d_residual_2,
+                                                         dbuffer));
+
+    // Copy output to host
+    host_vector<T>                  hcsr_val_1(nnz);
+    host_vector<T>                  hcsr_val_2(nnz);
+    host_vector<floating_data_t<T>> h_residual_2(1);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_1, dcsr_val_1, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hcsr_val_2, dcsr_val_2, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        h_residual_2, d_residual_2, sizeof(floating_data_t<T>), hipMemcpyDeviceToHost));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+    hcsr_val_gold.near_check(hcsr_val_1);
+    hcsr_val_gold.near_check(hcsr_val_2);
+    h_residual_gold.near_check(h_residual_1);
+    h_residual_gold.near_check(h_residual_2);
+}
+
 template <typename T>
 void testing_csrilu0_bad_arg(const Arguments& arg)
 {
@@ -72,6 +596,145 @@ void testing_csrilu0_bad_arg(const Arguments& arg)
 #undef PARAMS_ANALYSIS
 #undef PARAMS
 
+    // Test rocsparse_csriluk_buffer_size(), rocsparse_csriluk_nnz(),
+    // rocsparse_csriluk_symbolic() and rocsparse_csriluk()
+    rocsparse_int             lfil           = 1;
+    rocsparse_int             nnz_LU         = safe_size;
+    const rocsparse_mat_descr descr_LU       = local_descr;
+    T*                        csr_val_LU     = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_LU = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_LU = (rocsparse_int*)0x4;
+    rocsparse_int*            nnz_LU_ptr     = (rocsparse_int*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_row_ptr, csr_col_ind, lfil, buffer_size
+#define PARAMS_NNZ                                                                              \
+    handle, m, nnz, descr, csr_row_ptr, csr_col_ind, lfil, descr_LU, csr_row_ptr_LU, nnz_LU_ptr, \
+        info, temp_buffer
+#define PARAMS_SYMBOLIC                                                              \
+    handle, m, nnz, descr, csr_row_ptr, csr_col_ind, lfil, descr_LU, csr_row_ptr_LU, \
+        csr_col_ind_LU, info
+#define PARAMS_NUMERIC                                                                      \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, nnz_LU, descr_LU, csr_val_LU, \
+        csr_row_ptr_LU, csr_col_ind_LU, info, solve, temp_buffer
+
+    // The level of fill is tested separately, as it returns rocsparse_status_invalid_value
+    int       nargs_to_exclude   = 1;
+    const int args_to_exclude[1] = {6};
+
+    auto_testing_bad_arg(
+        rocsparse_csriluk_buffer_size, nargs_to_exclude, args_to_exclude, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csriluk_nnz, nargs_to_exclude, args_to_exclude, PARAMS_NNZ);
+    auto_testing_bad_arg(
+        rocsparse_csriluk_symbolic, nargs_to_exclude, args_to_exclude, PARAMS_SYMBOLIC);
+    auto_testing_bad_arg(rocsparse_csriluk<T>, PARAMS_NUMERIC);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_NNZ
+#undef PARAMS_SYMBOLIC
+#undef PARAMS_NUMERIC
+
+    // Test invalid level of fill
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_buffer_size(
+                                handle, m, nnz, descr, csr_row_ptr, csr_col_ind, -1, buffer_size),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                  m,
+                                                  nnz,
+                                                  descr,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  -1,
+                                                  descr_LU,
+                                                  csr_row_ptr_LU,
+                                                  nnz_LU_ptr,
+                                                  info,
+                                                  temp_buffer),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       -1,
+                                                       descr_LU,
+                                                       csr_row_ptr_LU,
+                                                       csr_col_ind_LU,
+                                                       info),
+                            rocsparse_status_invalid_value);
+
+    // Test rocsparse_csrilut_buffer_size(), rocsparse_csrilut_nnz() and rocsparse_csrilut()
+    rocsparse_int             max_fill = 2;
+    const floating_data_t<T>* tol      = (const floating_data_t<T>*)0x4;
+
+#define PARAMS_BUFFER_SIZE \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size
+#define PARAMS_NNZ                                                                     \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, tol, max_fill, descr_LU, \
+        csr_row_ptr_LU, nnz_LU_ptr, info, temp_buffer
+#define PARAMS \
+    handle, m, max_fill, nnz_LU, descr_LU, csr_val_LU, csr_row_ptr_LU, csr_col_ind_LU, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrilut_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrilut_nnz<T>, PARAMS_NNZ);
+    auto_testing_bad_arg(rocsparse_csrilut<T>, PARAMS);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_NNZ
+#undef PARAMS
+
+    // Test rocsparse_csrilu0_iterative_buffer_size() and rocsparse_csrilu0_iterative()
+    rocsparse_int       sweeps   = 1;
+    floating_data_t<T>* residual = (floating_data_t<T>*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, sweeps, residual, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrilu0_iterative_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrilu0_iterative<T>, PARAMS);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS
+
+    // Test negative drop tolerance
+    floating_data_t<T> neg_tol = static_cast<floating_data_t<T>>(-1);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_nnz<T>(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     &neg_tol,
+                                                     max_fill,
+                                                     descr_LU,
+                                                     csr_row_ptr_LU,
+                                                     nnz_LU_ptr,
+                                                     info,
+                                                     temp_buffer),
+                            rocsparse_status_invalid_value);
+
+    // Test rocsparse_csrilut_numeric_boost() and rocsparse_csrilut_zero_pivot()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilut_numeric_boost<T>(nullptr, info, 1, get_boost_tol(boost_tol), boost_val),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilut_numeric_boost<T>(handle, nullptr, 1, get_boost_tol(boost_tol), boost_val),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilut_numeric_boost<T>(handle, info, 1, get_boost_tol((T*)nullptr), boost_val),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrilut_numeric_boost<T>(handle, info, 1, get_boost_tol(boost_tol), nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_zero_pivot(nullptr, info, nnz_LU_ptr),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_zero_pivot(handle, nullptr, nnz_LU_ptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
     // Test rocsparse_csrilu0_numeric_boost()
     EXPECT_ROCSPARSE_STATUS(
         rocsparse_csrilu0_numeric_boost<T>(nullptr, info, 1, get_boost_tol(boost_tol), boost_val),
@@ -246,6 +909,7 @@ void testing_csrilu0(const Arguments& arg)
     device_vector<rocsparse_int> dcsr_col_ind(nnz);
     device_vector<T>             dcsr_val_1(nnz);
     device_vector<T>             dcsr_val_2(nnz);
+    device_vector<T>             dcsr_val_A(nnz);
     device_vector<rocsparse_int> d_analysis_pivot_2(1);
     device_vector<rocsparse_int> d_solve_pivot_2(1);
     device_vector<T>             d_boost_tol(1);
@@ -257,6 +921,7 @@ void testing_csrilu0(const Arguments& arg)
     CHECK_HIP_ERROR(
         hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dcsr_val_1, hcsr_val_gold, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_A, hcsr_val_gold, sizeof(T) * nnz, hipMemcpyHostToDevice));
 
     // Obtain required buffer size
     size_t buffer_size;
@@ -358,6 +1023,9 @@ void testing_csrilu0(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(
             h_solve_pivot_2, d_solve_pivot_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
+        // Values of A, required by the ILU(k) tests
+        host_vector<T> hcsr_val_A(hcsr_val_gold);
+
         // CPU csrilu0
         host_csrilu0<T>(M,
                         hcsr_row_ptr,
@@ -382,6 +1050,61 @@ void testing_csrilu0(const Arguments& arg)
             hcsr_val_gold.near_check(hcsr_val_1);
             hcsr_val_gold.near_check(hcsr_val_2);
         }
+
+        // ILU(k) for small levels of fill and ILUT, if ILU(0) is well defined
+        if(boost == 0 && h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
+        {
+            for(rocsparse_int lfil = 1; lfil <= 2; ++lfil)
+            {
+                testing_csriluk_lfil<T>(handle,
+                                        descr,
+                                        M,
+                                        nnz,
+                                        hcsr_row_ptr,
+                                        hcsr_col_ind,
+                                        hcsr_val_A,
+                                        lfil,
+                                        apol,
+                                        spol);
+            }
+
+            // ILUT with dropping and with fill limit only
+            testing_csrilut_tol<T>(handle,
+                                   descr,
+                                   M,
+                                   nnz,
+                                   hcsr_row_ptr,
+                                   hcsr_col_ind,
+                                   hcsr_val_A,
+                                   static_cast<floating_data_t<T>>(0.01),
+                                   2);
+            testing_csrilut_tol<T>(handle,
+                                   descr,
+                                   M,
+                                   nnz,
+                                   hcsr_row_ptr,
+                                   hcsr_col_ind,
+                                   hcsr_val_A,
+                                   static_cast<floating_data_t<T>>(0),
+                                   5);
+
+            // Fixed-point iterative ILU(0), reusing the analysis data
+            for(rocsparse_int sweeps = 0; sweeps <= 3; sweeps += 3)
+            {
+                testing_csrilu0_iterative_sweeps<T>(handle,
+                                                    descr,
+                                                    info,
+                                                    M,
+                                                    nnz,
+                                                    hcsr_row_ptr,
+                                                    hcsr_col_ind,
+                                                    hcsr_val_A,
+                                                    sweeps);
+            }
+        }
+
+        // ILUT of a matrix with a zero pivot
+        testing_csrilut_zero_pivot<T>(handle, descr);
     }
 
     if(arg.timing)
@@ -453,6 +1176,73 @@ void testing_csrilu0(const Arguments& arg)
 
         gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
 
+        // Fixed-point iterative factorization, reusing the analysis data
+        static constexpr rocsparse_int sweeps = 3;
+
+        size_t iterative_buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative_buffer_size<T>(
+            handle, M, nnz, descr, dcsr_val_1, dcsr_row_ptr, dcsr_col_ind, &iterative_buffer_size));
+
+        void* diterative_buffer;
+        CHECK_HIP_ERROR(hipMalloc(&diterative_buffer, iterative_buffer_size));
+
+        floating_data_t<T> residual;
+
+        // The factorization is computed in place, thus the timed runs operate on a copy of A
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val_2, dcsr_val_A, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative<T>(handle,
+                                                                 M,
+                                                                 nnz,
+                                                                 descr,
+                                                                 dcsr_val_2,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 info,
+                                                                 sweeps,
+                                                                 &residual,
+                                                                 diterative_buffer));
+        }
+
+        double gpu_iterative_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative<T>(handle,
+                                                                 M,
+                                                                 nnz,
+                                                                 descr,
+                                                                 dcsr_val_2,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 info,
+                                                                 sweeps,
+                                                                 &residual,
+                                                                 diterative_buffer));
+        }
+
+        gpu_iterative_time_used = (get_time_us() - gpu_iterative_time_used) / number_hot_calls;
+
+        // Residual of a single run on A
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_iterative<T>(handle,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val_A,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             info,
+                                                             sweeps,
+                                                             &residual,
+                                                             diterative_buffer));
+
+        CHECK_HIP_ERROR(hipFree(diterative_buffer));
+
         double gpu_gbyte = csrilu0_gbyte_count<T>(M, nnz) / gpu_solve_time_used * 1e6;
 
         std::cout.precision(2);
@@ -462,7 +1252,8 @@ void testing_csrilu0(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "pivot"
                   << std::setw(16) << "analysis policy" << std::setw(16) << "solve policy"
                   << std::setw(12) << "GB/s" << std::setw(16) << "analysis msec" << std::setw(16)
-                  << "solve msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << "solve msec" << std::setw(16) << "iterative msec" << std::setw(12)
+                  << "residual" << std::setw(12) << "iter" << std::setw(12) << "verified"
                   << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12)
@@ -470,6 +1261,7 @@ void testing_csrilu0(const Arguments& arg)
                   << rocsparse_analysis2string(apol) << std::setw(16)
                   << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
                   << gpu_analysis_time_used / 1e3 << std::setw(16) << gpu_solve_time_used / 1e3
+                  << std::setw(16) << gpu_iterative_time_used / 1e3 << std::setw(12) << residual
                   << std::setw(12) << number_hot_calls << std::setw(12)
                   << (arg.unit_check ? "yes" : "no") << std::endl;
     }
@@ -0,0 +1,343 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "rocsparse_enum.hpp"
+
+template <typename T>
+void testing_csrmcilu0_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    T*                        csr_val     = (T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    const T*                  x           = (const T*)0x4;
+    T*                        y           = (T*)0x4;
+
+#define PARAMS handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info
+#define PARAMS_SOLVE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, y
+
+    auto_testing_bad_arg(rocsparse_csrmcilu0<T>, PARAMS);
+    auto_testing_bad_arg(rocsparse_csrmcilu0_solve<T>, PARAMS_SOLVE);
+
+    //
+    // Not implemented cases.
+    //
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0_solve<T>(PARAMS_SOLVE),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+    // Factorization and solve require analysis
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0<T>(PARAMS), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0_solve<T>(PARAMS_SOLVE),
+                            rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+#undef PARAMS_SOLVE
+}
+
+template <typename T>
+void testing_csrmcilu0(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    const floating_data_t<T> fraction_to_color = static_cast<floating_data_t<T>>(1);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       pivot;
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrmcilu0<T>(handle, M, safe_size, descr, nullptr, nullptr, nullptr, info),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcilu0_solve<T>(handle,
+                                                             M,
+                                                             safe_size,
+                                                             descr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             info,
+                                                             nullptr,
+                                                             nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, &pivot),
+                                rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR symmetric matrix, the coloring requires a symmetric sparsity pattern
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    M = hA.m;
+
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    hA.ptr.transfer_to(hcsr_row_ptr);
+    hA.ind.transfer_to(hcsr_col_ind);
+    hA.val.transfer_to(hcsr_val);
+
+    // Host dense vectors
+    host_vector<T> hx(M);
+
+    rocsparse_init<T>(hx, 1, M, 1);
+
+    // Allocate device memory
+    device_csr_matrix<T>         dA(hA);
+    device_vector<rocsparse_int> dcoloring(M);
+    device_vector<rocsparse_int> dreordering(M);
+    device_vector<T>             dcsr_val(hA.nnz);
+    device_vector<T>             dx(M);
+    device_vector<T>             dy(M);
+    device_vector<rocsparse_int> dpivot_2(1);
+
+    dx.transfer_from(hx);
+
+    // Multicolor ordering
+    rocsparse_int ncolors;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                dA.m,
+                                                dA.nnz,
+                                                descr,
+                                                dA.val,
+                                                dA.ptr,
+                                                dA.ind,
+                                                &fraction_to_color,
+                                                &ncolors,
+                                                dcoloring,
+                                                dreordering,
+                                                info));
+
+#define PARAMS_ANALYSIS \
+    handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, ncolors, dcoloring, dreordering, info
+#define PARAMS handle, dA.m, dA.nnz, descr, dcsr_val, dA.ptr, dA.ind, info
+#define PARAMS_SOLVE handle, dA.m, dA.nnz, descr, dcsr_val, dA.ptr, dA.ind, info, dx, dy
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_analysis(PARAMS_ANALYSIS));
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hreordering(M);
+        host_vector<rocsparse_int> hpivot_1(1);
+        host_vector<rocsparse_int> hpivot_2(1);
+        host_vector<rocsparse_int> hpivot_gold(1);
+        host_vector<T>             hcsr_val_1(hA.nnz);
+        host_vector<T>             hy_1(M);
+        host_vector<T>             hy_gold(M);
+
+        hreordering.transfer_from(dreordering);
+
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_val, dA.val, sizeof(T) * hA.nnz, hipMemcpyDeviceToDevice));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0<T>(PARAMS));
+        {
+            auto st = rocsparse_csrmc_zero_pivot(handle, info, hpivot_1);
+            EXPECT_ROCSPARSE_STATUS(st,
+                                    (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                        : rocsparse_status_success);
+        }
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, dpivot_2),
+                                (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                    : rocsparse_status_success);
+
+        // Copy output to host
+        hcsr_val_1.transfer_from(dcsr_val);
+        hpivot_2.transfer_from(dpivot_2);
+
+        // CPU csrmcilu0
+        host_csrmcilu0<T>(M, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hreordering, base, hpivot_gold);
+
+        hpivot_gold.unit_check(hpivot_1);
+        hpivot_gold.unit_check(hpivot_2);
+
+        // Check factors and their application if no pivot has been found
+        if(hpivot_gold[0] == -1)
+        {
+            hcsr_val.near_check(hcsr_val_1);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0_solve<T>(PARAMS_SOLVE));
+
+            hy_1.transfer_from(dy);
+
+            // CPU csrmcilu0_solve
+            host_csrmcilu0_solve<T>(M,
+                                    hcsr_row_ptr,
+                                    hcsr_col_ind,
+                                    hcsr_val,
+                                    hreordering,
+                                    hx,
+                                    hy_gold,
+                                    base,
+                                    hpivot_gold);
+
+            hy_gold.near_check(hy_1);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val, dA.val, sizeof(T) * hA.nnz, hipMemcpyDeviceToDevice));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_analysis(PARAMS_ANALYSIS));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0<T>(PARAMS));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0_solve<T>(PARAMS_SOLVE));
+        }
+
+        double gpu_analysis_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_analysis(PARAMS_ANALYSIS));
+        }
+
+        gpu_analysis_time_used = (get_time_us() - gpu_analysis_time_used) / number_hot_calls;
+
+        double gpu_time_used = 0;
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(dcsr_val, dA.val, sizeof(T) * hA.nnz, hipMemcpyDeviceToDevice));
+
+            double temp = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0<T>(PARAMS));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used += (get_time_us() - temp);
+        }
+
+        gpu_time_used = gpu_time_used / number_hot_calls;
+
+        double gpu_solve_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcilu0_solve<T>(PARAMS_SOLVE));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gbyte_count = csrmcilu0_gbyte_count<T>(dA.m, dA.nnz);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "colors",
+                            ncolors,
+                            "GB/s",
+                            gpu_gbyte,
+                            "analysis msec",
+                            get_gpu_time_msec(gpu_analysis_time_used),
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "solve msec",
+                            get_gpu_time_msec(gpu_solve_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS_ANALYSIS
+#undef PARAMS
+#undef PARAMS_SOLVE
+
+    // Clear csrmc meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_clear(handle, info));
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_csrmcilu0_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrmcilu0<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,397 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "rocsparse_enum.hpp"
+
+template <typename T>
+void testing_csrmcsor_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+    const T             h_omega   = static_cast<T>(1);
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const T*                  csr_val     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int             ncolors     = safe_size;
+    const rocsparse_int*      coloring    = (const rocsparse_int*)0x4;
+    const rocsparse_int*      reordering  = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    rocsparse_sor_sweep       sweep       = rocsparse_sor_sweep_symmetric;
+    const T*                  omega       = (const T*)&h_omega;
+    const T*                  b           = (const T*)0x4;
+    T*                        x           = (T*)0x4;
+
+#define PARAMS_ANALYSIS \
+    handle, m, nnz, descr, csr_row_ptr, csr_col_ind, ncolors, coloring, reordering, info
+#define PARAMS handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, sweep, omega, b, x
+
+    auto_testing_bad_arg(rocsparse_csrmc_analysis, PARAMS_ANALYSIS);
+    auto_testing_bad_arg(rocsparse_csrmcsor<T>, PARAMS);
+
+    //
+    // Not implemented cases.
+    //
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_analysis(PARAMS_ANALYSIS),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcsor<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+    // Each row has to be colored
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     0,
+                                                     coloring,
+                                                     reordering,
+                                                     info),
+                            rocsparse_status_invalid_size);
+
+    // Sweep requires analysis
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcsor<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+#undef PARAMS_ANALYSIS
+
+    // Test rocsparse_csrmc_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrmc_clear()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_clear(nullptr, info),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_clear(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrmcsor(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M     = arg.M;
+    rocsparse_index_base base  = arg.baseA;
+    const T              omega = arg.get_alpha<T>();
+
+    const floating_data_t<T> fraction_to_color = static_cast<floating_data_t<T>>(1);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       pivot;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_analysis(handle,
+                                                         M,
+                                                         safe_size,
+                                                         descr,
+                                                         nullptr,
+                                                         nullptr,
+                                                         safe_size,
+                                                         nullptr,
+                                                         nullptr,
+                                                         info),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmcsor<T>(handle,
+                                                      M,
+                                                      safe_size,
+                                                      descr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      nullptr,
+                                                      info,
+                                                      rocsparse_sor_sweep_symmetric,
+                                                      &omega,
+                                                      nullptr,
+                                                      nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, &pivot),
+                                rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR symmetric matrix, the coloring requires a symmetric sparsity pattern
+    host_csr_matrix<T> hA;
+    {
+        host_csr_matrix<T> nonsymA;
+        matrix_factory.init_csr(nonsymA, M, M, base);
+        CHECK_ROCSPARSE_ERROR(rocsparse_matrix_utils::host_csrsym(nonsymA, hA));
+    }
+
+    M = hA.m;
+
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    hA.ptr.transfer_to(hcsr_row_ptr);
+    hA.ind.transfer_to(hcsr_col_ind);
+    hA.val.transfer_to(hcsr_val);
+
+    // Host dense vectors
+    host_vector<T> hb(M);
+    host_vector<T> hx(M);
+
+    rocsparse_init<T>(hb, 1, M, 1);
+    rocsparse_init<T>(hx, 1, M, 1);
+
+    // Allocate device memory
+    device_csr_matrix<T>         dA(hA);
+    device_vector<rocsparse_int> dcoloring(M);
+    device_vector<rocsparse_int> dreordering(M);
+    device_vector<T>             db(M);
+    device_vector<T>             dx_1(M);
+    device_vector<T>             dx_2(M);
+    device_vector<rocsparse_int> dpivot_2(1);
+
+    db.transfer_from(hb);
+
+    // Multicolor ordering
+    rocsparse_int ncolors;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor<T>(handle,
+                                                dA.m,
+                                                dA.nnz,
+                                                descr,
+                                                dA.val,
+                                                dA.ptr,
+                                                dA.ind,
+                                                &fraction_to_color,
+                                                &ncolors,
+                                                dcoloring,
+                                                dreordering,
+                                                info));
+
+#define PARAMS_ANALYSIS \
+    handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, ncolors, dcoloring, dreordering, info
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_analysis(PARAMS_ANALYSIS));
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hreordering(M);
+        hreordering.transfer_from(dreordering);
+
+        device_scalar<T> domega(omega);
+
+        for(auto sweep : {rocsparse_sor_sweep_forward,
+                          rocsparse_sor_sweep_backward,
+                          rocsparse_sor_sweep_symmetric})
+        {
+            host_vector<rocsparse_int> hpivot_1(1);
+            host_vector<rocsparse_int> hpivot_2(1);
+            host_vector<rocsparse_int> hpivot_gold(1);
+            host_vector<T>             hx_1(M);
+            host_vector<T>             hx_2(M);
+            host_vector<T>             hx_gold(hx);
+
+            dx_1.transfer_from(hx);
+            dx_2.transfer_from(hx);
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcsor<T>(handle,
+                                                        dA.m,
+                                                        dA.nnz,
+                                                        descr,
+                                                        dA.val,
+                                                        dA.ptr,
+                                                        dA.ind,
+                                                        info,
+                                                        sweep,
+                                                        &omega,
+                                                        db,
+                                                        dx_1));
+            {
+                auto st = rocsparse_csrmc_zero_pivot(handle, info, hpivot_1);
+                EXPECT_ROCSPARSE_STATUS(st,
+                                        (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                            : rocsparse_status_success);
+            }
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcsor<T>(handle,
+                                                        dA.m,
+                                                        dA.nnz,
+                                                        descr,
+                                                        dA.val,
+                                                        dA.ptr,
+                                                        dA.ind,
+                                                        info,
+                                                        sweep,
+                                                        domega,
+                                                        db,
+                                                        dx_2));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrmc_zero_pivot(handle, info, dpivot_2),
+                                    (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                        : rocsparse_status_success);
+
+            // Copy output to host
+            hx_1.transfer_from(dx_1);
+            hx_2.transfer_from(dx_2);
+            hpivot_2.transfer_from(dpivot_2);
+
+            // CPU csrmcsor
+            host_csrmcsor<T>(M,
+                             hcsr_row_ptr,
+                             hcsr_col_ind,
+                             hcsr_val,
+                             hreordering,
+                             sweep,
+                             omega,
+                             hb,
+                             hx_gold,
+                             base,
+                             hpivot_gold);
+
+            hpivot_gold.unit_check(hpivot_1);
+            hpivot_gold.unit_check(hpivot_2);
+            hx_gold.near_check(hx_1);
+            hx_gold.near_check(hx_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        dx_1.transfer_from(hx);
+
+#define PARAMS                                                                              \
+    handle, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info, rocsparse_sor_sweep_forward, \
+        &omega, db, dx_1
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_analysis(PARAMS_ANALYSIS));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcsor<T>(PARAMS));
+        }
+
+        double gpu_analysis_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_analysis(PARAMS_ANALYSIS));
+        }
+
+        gpu_analysis_time_used = (get_time_us() - gpu_analysis_time_used) / number_hot_calls;
+
+        double gpu_solve_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmcsor<T>(PARAMS));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+#undef PARAMS
+
+        double gbyte_count = csrmcsor_gbyte_count<T>(dA.m, dA.nnz);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "colors",
+                            ncolors,
+                            "omega",
+                            arg.alpha,
+                            "GB/s",
+                            gpu_gbyte,
+                            "analysis msec",
+                            get_gpu_time_msec(gpu_analysis_time_used),
+                            "sweep msec",
+                            get_gpu_time_msec(gpu_solve_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS_ANALYSIS
+
+    // Clear csrmc meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmc_clear(handle, info));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csrmcsor_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrmcsor<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
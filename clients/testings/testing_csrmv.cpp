@@ -123,6 +123,12 @@ void testing_csrmv(const Arguments& arg)
     // Set matrix index base
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
 
+    // Set deterministic mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_deterministic_mode(
+        handle,
+        arg.deterministic ? rocsparse_deterministic_mode_enabled
+                          : rocsparse_deterministic_mode_disabled));
+
     // Set matrix type
     CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
 
@@ -249,6 +255,48 @@ void testing_csrmv(const Arguments& arg)
         CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
 
         hy.near_check(dy, tol);
+
+        // Symmetric csrmv is not covered by the deterministic mode
+        if(arg.deterministic && matrix_type != rocsparse_matrix_type_symmetric)
+        {
+            // Results of repeated runs need to be bitwise identical
+            host_dense_matrix<T> hy_first(dy);
+            dy = hy_copy;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
+            hy_first.unit_check(dy);
+        }
+
+        if(arg.graph)
+        {
+            // Capture csrmv into a HIP graph and replay it
+            hipStream_t stream;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_graph_mode(handle, rocsparse_graph_mode_enabled));
+
+            hipGraph_t     graph;
+            hipGraphExec_t graph_exec;
+            CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(PARAMS(d_alpha, dA, dx, d_beta, dy)));
+            CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+            CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+
+            // Replay twice, each launch has to match the reference
+            for(int i = 0; i < 2; ++i)
+            {
+                dy = hy_copy;
+                CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+                hy.near_check(dy, tol);
+            }
+
+            CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+            CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_graph_mode(handle, rocsparse_graph_mode_disabled));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, nullptr));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
     }
 
     if(arg.timing)
@@ -300,6 +348,8 @@ void testing_csrmv(const Arguments& arg)
                             get_gpu_time_msec(gpu_time_used),
                             "iter",
                             number_hot_calls,
+                            "deterministic",
+                            (arg.deterministic ? "yes" : "no"),
                             "verified",
                             (arg.unit_check ? "yes" : "no"));
     }
@@ -0,0 +1,483 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "rocsparse_enum.hpp"
+
+template <typename T>
+void testing_csrpoly_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+    const T             h_coeff[] = {static_cast<T>(1)};
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const T*                  csr_val     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    rocsparse_int             degree      = safe_size;
+    const T*                  coeff       = h_coeff;
+    floating_data_t<T>        lambda_min  = static_cast<floating_data_t<T>>(1);
+    floating_data_t<T>        lambda_max  = static_cast<floating_data_t<T>>(2);
+    const T*                  x           = (const T*)0x4;
+    T*                        y           = (T*)0x4;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, degree, coeff, x, y, temp_buffer
+#define PARAMS_CHEBYSHEV                                                                \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, degree, lambda_min, \
+        lambda_max, x, y, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrpoly_buffer_size<T>, PARAMS_BUFFER_SIZE);
+
+    // info is optional
+    {
+        static constexpr int num_exclusions  = 1;
+        static constexpr int exclude_args[1] = {7};
+        auto_testing_bad_arg(rocsparse_csrpoly<T>, num_exclusions, exclude_args, PARAMS);
+    }
+
+    // info is optional, the spectral bounds are checked below
+    {
+        static constexpr int num_exclusions  = 3;
+        static constexpr int exclude_args[3] = {7, 9, 10};
+        auto_testing_bad_arg(
+            rocsparse_csrpoly_chebyshev<T>, num_exclusions, exclude_args, PARAMS_CHEBYSHEV);
+    }
+
+    //
+    // Not implemented cases.
+    //
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general && val != rocsparse_matrix_type_triangular)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_general));
+
+    // The interval of the spectral bounds must not contain zero
+    lambda_min = static_cast<floating_data_t<T>>(0);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV),
+                            rocsparse_status_invalid_value);
+
+    lambda_min = static_cast<floating_data_t<T>>(2);
+    lambda_max = static_cast<floating_data_t<T>>(1);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV),
+                            rocsparse_status_invalid_value);
+
+#undef PARAMS_CHEBYSHEV
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+}
+
+// Apply the polynomial to a matrix with a dense first row, that is processed by several
+// workgroups of the adaptive csrmv, where the output vector and the buffer are filled
+// with NaN beforehand
+template <typename T>
+static void testing_csrpoly_long_row(rocsparse_handle handle, rocsparse_index_base base)
+{
+    static constexpr rocsparse_int M      = 4096;
+    static constexpr rocsparse_int degree = 3;
+
+    rocsparse_local_mat_descr descr;
+    rocsparse_local_mat_info  info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Dense first row, all other rows only hold the diagonal
+    host_vector<rocsparse_int> hcsr_row_ptr(M + 1);
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    hcsr_row_ptr[0] = base;
+
+    for(rocsparse_int j = 0; j < M; ++j)
+    {
+        hcsr_col_ind.push_back(j + base);
+        hcsr_val.push_back((j == 0) ? static_cast<T>(1) : static_cast<T>(1.0 / M));
+    }
+
+    hcsr_row_ptr[1] = M + base;
+
+    for(rocsparse_int i = 1; i < M; ++i)
+    {
+        hcsr_col_ind.push_back(i + base);
+        hcsr_val.push_back(static_cast<T>(1));
+
+        hcsr_row_ptr[i + 1] = hcsr_col_ind.size() + base;
+    }
+
+    rocsparse_int nnz = hcsr_col_ind.size();
+
+    host_vector<T> hcoeff(degree + 1);
+    host_vector<T> hx(M);
+    host_vector<T> hy(M);
+    host_vector<T> hy_gold(M);
+
+    rocsparse_init<T>(hcoeff, 1, degree + 1, 1);
+    rocsparse_init<T>(hx, 1, M, 1);
+
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<T>             dx(M);
+    device_vector<T>             dy(M);
+
+    dcsr_row_ptr.transfer_from(hcsr_row_ptr);
+    dcsr_col_ind.transfer_from(hcsr_col_ind);
+    dcsr_val.transfer_from(hcsr_val);
+    dx.transfer_from(hx);
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    // All bits set is NaN for all floating point types
+    CHECK_HIP_ERROR(hipMemset(dbuffer, 0xFF, buffer_size));
+    CHECK_HIP_ERROR(hipMemset(dy, 0xFF, sizeof(T) * M));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                      rocsparse_operation_none,
+                                                      M,
+                                                      M,
+                                                      nnz,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly<T>(handle,
+                                               M,
+                                               nnz,
+                                               descr,
+                                               dcsr_val,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               info,
+                                               degree,
+                                               hcoeff,
+                                               dx,
+                                               dy,
+                                               dbuffer));
+
+    hy.transfer_from(dy);
+
+    host_csrpoly<T>(M, hcsr_row_ptr, hcsr_col_ind, hcsr_val, degree, hcoeff, hx, hy_gold, base);
+
+    hy_gold.near_check(hy);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+template <typename T>
+void testing_csrpoly(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M      = arg.M;
+    rocsparse_int        degree = arg.K;
+    rocsparse_index_base base   = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrpoly_buffer_size<T>(
+                handle, M, safe_size, descr, nullptr, nullptr, nullptr, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     degree,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrpoly_chebyshev<T>(handle,
+                                                               M,
+                                                               safe_size,
+                                                               descr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               degree,
+                                                               1,
+                                                               2,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        return;
+    }
+
+    // Init a CSR square matrix
+    host_csr_matrix<T> hA;
+    matrix_factory.init_csr(hA, M, M, base);
+
+    M = hA.m;
+
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    hA.ptr.transfer_to(hcsr_row_ptr);
+    hA.ind.transfer_to(hcsr_col_ind);
+    hA.val.transfer_to(hcsr_val);
+
+    // Polynomial coefficients
+    host_vector<T> hcoeff(degree + 1);
+    rocsparse_init<T>(hcoeff, 1, degree + 1, 1);
+
+    // Spectral bounds, the upper bound is taken from the Gershgorin circles
+    floating_data_t<T> lambda_max = static_cast<floating_data_t<T>>(1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        floating_data_t<T> sum = static_cast<floating_data_t<T>>(0);
+
+        for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+        {
+            sum += std::abs(hcsr_val[j]);
+        }
+
+        lambda_max = std::max(lambda_max, sum);
+    }
+
+    floating_data_t<T> lambda_min = lambda_max / 10;
+
+    // Host dense vectors
+    host_vector<T> hx(M);
+    rocsparse_init<T>(hx, 1, M, 1);
+
+    // Allocate device memory
+    device_csr_matrix<T> dA(hA);
+    device_vector<T>     dx(M);
+    device_vector<T>     dy_1(M);
+    device_vector<T>     dy_2(M);
+
+    dx.transfer_from(hx);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly_buffer_size<T>(
+        handle, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+#define PARAMS(info_, y_) \
+    handle, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_, degree, hcoeff, dx, y_, dbuffer
+#define PARAMS_CHEBYSHEV(info_, y_)                                                             \
+    handle, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info_, degree, lambda_min, lambda_max, \
+        dx, y_, dbuffer
+
+    if(arg.unit_check)
+    {
+        host_vector<T> hy_1(M);
+        host_vector<T> hy_2(M);
+        host_vector<T> hy_gold(M);
+
+        // Without csrmv analysis data
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly<T>(PARAMS(nullptr, dy_1)));
+
+        // Using the csrmv adaptive row blocks
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                          rocsparse_operation_none,
+                                                          dA.m,
+                                                          dA.n,
+                                                          dA.nnz,
+                                                          descr,
+                                                          dA.val,
+                                                          dA.ptr,
+                                                          dA.ind,
+                                                          info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly<T>(PARAMS(info, dy_2)));
+
+        hy_1.transfer_from(dy_1);
+        hy_2.transfer_from(dy_2);
+
+        // CPU csrpoly
+        host_csrpoly<T>(
+            M, hcsr_row_ptr, hcsr_col_ind, hcsr_val, degree, hcoeff, hx, hy_gold, base);
+
+        hy_gold.near_check(hy_1);
+        hy_gold.near_check(hy_2);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV(nullptr, dy_1)));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV(info, dy_2)));
+
+        hy_1.transfer_from(dy_1);
+        hy_2.transfer_from(dy_2);
+
+        // CPU csrpoly_chebyshev
+        host_csrpoly_chebyshev<T>(M,
+                                  hcsr_row_ptr,
+                                  hcsr_col_ind,
+                                  hcsr_val,
+                                  degree,
+                                  lambda_min,
+                                  lambda_max,
+                                  hx,
+                                  hy_gold,
+                                  base);
+
+        hy_gold.near_check(hy_1);
+        hy_gold.near_check(hy_2);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+
+        // Row spanning several workgroups, with NaN in the output and the buffer
+        testing_csrpoly_long_row<T>(handle, base);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis<T>(handle,
+                                                          rocsparse_operation_none,
+                                                          dA.m,
+                                                          dA.n,
+                                                          dA.nnz,
+                                                          descr,
+                                                          dA.val,
+                                                          dA.ptr,
+                                                          dA.ind,
+                                                          info));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly<T>(PARAMS(info, dy_1)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV(info, dy_2)));
+        }
+
+        double gpu_poly_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly<T>(PARAMS(info, dy_1)));
+        }
+
+        gpu_poly_time_used = (get_time_us() - gpu_poly_time_used) / number_hot_calls;
+
+        double gpu_chebyshev_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrpoly_chebyshev<T>(PARAMS_CHEBYSHEV(info, dy_2)));
+        }
+
+        gpu_chebyshev_time_used = (get_time_us() - gpu_chebyshev_time_used) / number_hot_calls;
+
+        double gbyte_count = csrpoly_gbyte_count<T>(dA.m, dA.nnz, degree);
+        double gpu_gbyte   = get_gpu_gbyte(gpu_poly_time_used, gbyte_count);
+
+        display_timing_info("M",
+                            dA.m,
+                            "nnz",
+                            dA.nnz,
+                            "degree",
+                            degree,
+                            "GB/s",
+                            gpu_gbyte,
+                            "poly msec",
+                            get_gpu_time_msec(gpu_poly_time_used),
+                            "chebyshev msec",
+                            get_gpu_time_msec(gpu_chebyshev_time_used),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+    }
+
+#undef PARAMS_CHEBYSHEV
+#undef PARAMS
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrpoly_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrpoly<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
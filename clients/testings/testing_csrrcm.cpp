@@ -0,0 +1,452 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "rocsparse_enum.hpp"
+
+// Maximum distance of a non-zero entry to the diagonal
+static rocsparse_int testing_csrrcm_bandwidth(rocsparse_int                     M,
+                                              const host_vector<rocsparse_int>& csr_row_ptr,
+                                              const host_vector<rocsparse_int>& csr_col_ind,
+                                              rocsparse_index_base              base)
+{
+    rocsparse_int bandwidth = 0;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            bandwidth = std::max(bandwidth, std::abs(csr_col_ind[j] - base - i));
+        }
+    }
+
+    return bandwidth;
+}
+
+// Reordered matrix B = P A P^T with B(i, j) = A(perm[i], perm[j])
+template <typename T>
+static void testing_csrrcm_permute(rocsparse_int                     M,
+                                   const host_vector<rocsparse_int>& csr_row_ptr_A,
+                                   const host_vector<rocsparse_int>& csr_col_ind_A,
+                                   const host_vector<T>&             csr_val_A,
+                                   const host_vector<rocsparse_int>& perm,
+                                   host_vector<rocsparse_int>&       csr_row_ptr_B,
+                                   host_vector<rocsparse_int>&       csr_col_ind_B,
+                                   host_vector<T>&                   csr_val_B,
+                                   rocsparse_index_base              base)
+{
+    host_vector<rocsparse_int> inv_perm(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        inv_perm[perm[i]] = i;
+    }
+
+    csr_row_ptr_B.resize(M + 1);
+    csr_col_ind_B.resize(csr_col_ind_A.size());
+    csr_val_B.resize(csr_val_A.size());
+
+    csr_row_ptr_B[0] = base;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr_A[perm[i]] - base;
+        rocsparse_int row_end   = csr_row_ptr_A[perm[i] + 1] - base;
+        rocsparse_int offset    = csr_row_ptr_B[i] - base;
+
+        std::vector<std::pair<rocsparse_int, T>> row;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            row.push_back(std::make_pair(inv_perm[csr_col_ind_A[j] - base], csr_val_A[j]));
+        }
+
+        std::sort(row.begin(),
+                  row.end(),
+                  [](const std::pair<rocsparse_int, T>& a, const std::pair<rocsparse_int, T>& b) {
+                      return a.first < b.first;
+                  });
+
+        for(size_t k = 0; k < row.size(); ++k)
+        {
+            csr_col_ind_B[offset + k] = row[k].first + base;
+            csr_val_B[offset + k]     = row[k].second;
+        }
+
+        csr_row_ptr_B[i + 1] = csr_row_ptr_B[i] + (row_end - row_begin);
+    }
+}
+
+template <typename T>
+void testing_csrrcm_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int*            perm        = (rocsparse_int*)0x4;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, csr_row_ptr, csr_col_ind, buffer_size
+#define PARAMS handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm, temp_buffer
+    auto_testing_bad_arg(rocsparse_csrrcm_buffer_size, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrrcm, PARAMS);
+
+    //
+    // Not implemented cases.
+    //
+    for(auto val : rocsparse_matrix_type_t::values)
+    {
+        if(val != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, val));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrrcm(PARAMS), rocsparse_status_not_implemented);
+        }
+    }
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename T>
+void testing_csrrcm(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+
+    rocsparse_int        M    = arg.M;
+    rocsparse_index_base base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<rocsparse_int> dperm(safe_size);
+        device_vector<rocsparse_int> dbuffer(safe_size);
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrcm_buffer_size(handle, M, 0, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrcm(handle, M, 0, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Init a CSR square matrix
+    host_csr_matrix<T> hA;
+    matrix_factory.init_csr(hA, M, M, base);
+
+    M = hA.m;
+
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    hA.ptr.transfer_to(hcsr_row_ptr);
+    hA.ind.transfer_to(hcsr_col_ind);
+    hA.val.transfer_to(hcsr_val);
+
+    // Allocate device memory
+    device_csr_matrix<T>         dA(hA);
+    device_vector<rocsparse_int> dperm(M);
+
+    // Obtain buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrrcm_buffer_size(handle, dA.m, dA.nnz, dA.ptr, dA.ind, &buffer_size));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+#define PARAMS handle, dA.m, dA.nnz, descr, dA.ptr, dA.ind, dperm, dbuffer
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrcm(PARAMS));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hperm(M);
+        hperm.transfer_from(dperm);
+
+        // CPU csrrcm
+        host_vector<rocsparse_int> hperm_gold;
+        host_csrrcm(M, hcsr_row_ptr, hcsr_col_ind, hperm_gold, base);
+
+        hperm_gold.unit_check(hperm);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrcm(PARAMS));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrcm(PARAMS));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        // Reordered matrix
+        host_vector<rocsparse_int> hperm(M);
+        host_vector<rocsparse_int> hcsr_row_ptr_B;
+        host_vector<rocsparse_int> hcsr_col_ind_B;
+        host_vector<T>             hcsr_val_B;
+
+        hperm.transfer_from(dperm);
+
+        testing_csrrcm_permute(M,
+                               hcsr_row_ptr,
+                               hcsr_col_ind,
+                               hcsr_val,
+                               hperm,
+                               hcsr_row_ptr_B,
+                               hcsr_col_ind_B,
+                               hcsr_val_B,
+                               base);
+
+        device_vector<rocsparse_int> dcsr_row_ptr_B(M + 1);
+        device_vector<rocsparse_int> dcsr_col_ind_B(dA.nnz);
+        device_vector<T>             dcsr_val_B(dA.nnz);
+
+        dcsr_row_ptr_B.transfer_from(hcsr_row_ptr_B);
+        dcsr_col_ind_B.transfer_from(hcsr_col_ind_B);
+        dcsr_val_B.transfer_from(hcsr_val_B);
+
+        rocsparse_int bandwidth[2]
+            = {testing_csrrcm_bandwidth(M, hcsr_row_ptr, hcsr_col_ind, base),
+               testing_csrrcm_bandwidth(M, hcsr_row_ptr_B, hcsr_col_ind_B, base)};
+
+        // Compare csrmv and csrsv on the original and on the reordered matrix
+        const T*             dcsr_val[2]     = {dA.val, dcsr_val_B};
+        const rocsparse_int* dcsr_row_ptr[2] = {dA.ptr, dcsr_row_ptr_B};
+        const rocsparse_int* dcsr_col_ind[2] = {dA.ind, dcsr_col_ind_B};
+
+        host_vector<T> hx(M);
+        rocsparse_init<T>(hx, 1, M, 1);
+
+        device_vector<T> dx(M);
+        device_vector<T> dy(M);
+
+        dx.transfer_from(hx);
+
+        T h_alpha = static_cast<T>(1);
+        T h_beta  = static_cast<T>(0);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        double csrmv_time_used[2];
+        double csrsv_time_used[2];
+
+        for(int p = 0; p < 2; ++p)
+        {
+            rocsparse_local_mat_info info;
+
+            // csrmv
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         M,
+                                                         M,
+                                                         dA.nnz,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val[p],
+                                                         dcsr_row_ptr[p],
+                                                         dcsr_col_ind[p],
+                                                         nullptr,
+                                                         dx,
+                                                         &h_beta,
+                                                         dy));
+            }
+
+            csrmv_time_used[p] = get_time_us();
+
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrmv<T>(handle,
+                                                         rocsparse_operation_none,
+                                                         M,
+                                                         M,
+                                                         dA.nnz,
+                                                         &h_alpha,
+                                                         descr,
+                                                         dcsr_val[p],
+                                                         dcsr_row_ptr[p],
+                                                         dcsr_col_ind[p],
+                                                         nullptr,
+                                                         dx,
+                                                         &h_beta,
+                                                         dy));
+            }
+
+            csrmv_time_used[p] = (get_time_us() - csrmv_time_used[p]) / number_hot_calls;
+
+            // csrsv on the lower triangular part
+            size_t csrsv_buffer_size;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                                 rocsparse_operation_none,
+                                                                 M,
+                                                                 dA.nnz,
+                                                                 descr,
+                                                                 dcsr_val[p],
+                                                                 dcsr_row_ptr[p],
+                                                                 dcsr_col_ind[p],
+                                                                 info,
+                                                                 &csrsv_buffer_size));
+
+            void* dcsrsv_buffer;
+            CHECK_HIP_ERROR(hipMalloc(&dcsrsv_buffer, csrsv_buffer_size));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              M,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dcsr_val[p],
+                                                              dcsr_row_ptr[p],
+                                                              dcsr_col_ind[p],
+                                                              info,
+                                                              rocsparse_analysis_policy_reuse,
+                                                              rocsparse_solve_policy_auto,
+                                                              dcsrsv_buffer));
+
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               M,
+                                                               dA.nnz,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val[p],
+                                                               dcsr_row_ptr[p],
+                                                               dcsr_col_ind[p],
+                                                               info,
+                                                               dx,
+                                                               dy,
+                                                               rocsparse_solve_policy_auto,
+                                                               dcsrsv_buffer));
+            }
+
+            csrsv_time_used[p] = get_time_us();
+
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                               rocsparse_operation_none,
+                                                               M,
+                                                               dA.nnz,
+                                                               &h_alpha,
+                                                               descr,
+                                                               dcsr_val[p],
+                                                               dcsr_row_ptr[p],
+                                                               dcsr_col_ind[p],
+                                                               info,
+                                                               dx,
+                                                               dy,
+                                                               rocsparse_solve_policy_auto,
+                                                               dcsrsv_buffer));
+            }
+
+            csrsv_time_used[p] = (get_time_us() - csrsv_time_used[p]) / number_hot_calls;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+            CHECK_HIP_ERROR(hipFree(dcsrsv_buffer));
+        }
+
+        display_timing_info("M",
+                            M,
+                            "nnz",
+                            dA.nnz,
+                            "bandwidth",
+                            bandwidth[0],
+                            "bandwidth(RCM)",
+                            bandwidth[1],
+                            "msec",
+                            get_gpu_time_msec(gpu_time_used),
+                            "csrmv msec",
+                            get_gpu_time_msec(csrmv_time_used[0]),
+                            "csrmv msec(RCM)",
+                            get_gpu_time_msec(csrmv_time_used[1]),
+                            "csrsv msec",
+                            get_gpu_time_msec(csrsv_time_used[0]),
+                            "csrsv msec(RCM)",
+                            get_gpu_time_msec(csrsv_time_used[1]),
+                            "iter",
+                            number_hot_calls,
+                            "verified",
+                            (arg.unit_check ? "yes" : "no"));
+    }
+
+#undef PARAMS
+
+    // Clear buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_csrrcm_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrrcm<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -93,6 +93,67 @@ void testing_csrsv_bad_arg(const Arguments& arg)
 #undef PARAMS_ANALYSIS
 #undef PARAMS_SOLVE
 
+    // Test rocsparse_csritsv_buffer_size() and rocsparse_csritsv_solve()
+    {
+        rocsparse_int             h_sweeps = 1;
+        rocsparse_int*            sweeps   = &h_sweeps;
+        const floating_data_t<T>* tol      = nullptr;
+
+        auto_testing_bad_arg(rocsparse_csritsv_buffer_size<T>,
+                             handle,
+                             trans,
+                             m,
+                             nnz,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             buffer_size);
+
+        //
+        // Exclude tol since this is an optional argument.
+        //
+        static constexpr int nargs_to_exclude                  = 1;
+        static constexpr int args_to_exclude[nargs_to_exclude] = {13};
+
+        auto_testing_bad_arg(rocsparse_csritsv_solve<T>,
+                             nargs_to_exclude,
+                             args_to_exclude,
+                             handle,
+                             trans,
+                             m,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             x,
+                             y,
+                             sweeps,
+                             tol,
+                             temp_buffer);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csritsv_solve<T>(handle,
+                                                           rocsparse_operation_transpose,
+                                                           m,
+                                                           nnz,
+                                                           alpha,
+                                                           descr,
+                                                           csr_val,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           info,
+                                                           x,
+                                                           y,
+                                                           sweeps,
+                                                           tol,
+                                                           temp_buffer),
+                                rocsparse_status_not_implemented);
+    }
+
     // Test rocsparse_csrsv_zero_pivot()
     rocsparse_int position;
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(nullptr, descr, info, &position),
@@ -109,6 +170,231 @@ void testing_csrsv_bad_arg(const Arguments& arg)
                             rocsparse_status_invalid_pointer);
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_clear(handle, descr, nullptr),
                             rocsparse_status_invalid_pointer);
+
+    // Test rocsparse_csrsv_level_info()
+    int64_t nlevels, max_width, critical_path;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(
+            nullptr, trans, descr, info, &nlevels, &max_width, &critical_path),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(
+            handle, trans, nullptr, info, &nlevels, &max_width, &critical_path),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(
+            handle, trans, descr, nullptr, &nlevels, &max_width, &critical_path),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, trans, descr, info, nullptr, &max_width, &critical_path),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, trans, descr, info, &nlevels, nullptr, &critical_path),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, trans, descr, info, &nlevels, &max_width, nullptr),
+        rocsparse_status_invalid_pointer);
+}
+
+// Host reference of the level schedule statistics, that are collected during csrsv
+// analysis. Each row is placed one level behind its deepest dependency.
+static void csrsv_level_info_host(rocsparse_operation  trans,
+                                  rocsparse_int        M,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_fill_mode  fill_mode,
+                                  rocsparse_index_base base,
+                                  int64_t*             nlevels,
+                                  int64_t*             max_width,
+                                  int64_t*             critical_path)
+{
+    std::vector<int64_t> depth(M, 1);
+    std::vector<int64_t> row_nnz(M, 0);
+
+    // Rows are visited in the order of their dependencies. For the transposed matrix,
+    // row i is a dependency of row col, if there is an entry (i, col).
+    bool forward = (fill_mode == rocsparse_fill_mode_lower) == (trans == rocsparse_operation_none);
+
+    for(rocsparse_int k = 0; k < M; ++k)
+    {
+        rocsparse_int i = forward ? k : M - 1 - k;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            bool strict = (fill_mode == rocsparse_fill_mode_lower) ? (col < i) : (col > i);
+
+            if(trans == rocsparse_operation_none)
+            {
+                ++row_nnz[i];
+
+                if(strict)
+                {
+                    depth[i] = std::max(depth[i], depth[col] + 1);
+                }
+            }
+            else
+            {
+                ++row_nnz[col];
+
+                if(strict)
+                {
+                    depth[col] = std::max(depth[col], depth[i] + 1);
+                }
+            }
+        }
+    }
+
+    *nlevels = (M > 0) ? *std::max_element(depth.begin(), depth.end()) : 0;
+
+    std::vector<int64_t> level_width(*nlevels, 0);
+    std::vector<int64_t> level_max_nnz(*nlevels, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ++level_width[depth[i] - 1];
+        level_max_nnz[depth[i] - 1] = std::max(level_max_nnz[depth[i] - 1], row_nnz[i]);
+    }
+
+    *max_width     = 0;
+    *critical_path = 0;
+
+    for(int64_t i = 0; i < *nlevels; ++i)
+    {
+        *max_width = std::max(*max_width, level_width[i]);
+        *critical_path += level_max_nnz[i];
+    }
+}
+
+// Solve a block-dense triangular matrix, where each diagonal block is a dense triangle and
+// all rows outside of the first (last) block couple to the first (last) row. Each diagonal
+// block forms a supernode, such that the supernodal sync-free solve is used.
+template <typename T>
+static void testing_csrsv_supernode(const Arguments& arg)
+{
+    static constexpr rocsparse_int M     = 100;
+    static constexpr rocsparse_int BLOCK = 24;
+
+    auto tol = get_near_check_tol<T>(arg);
+
+    rocsparse_operation    trans = arg.transA;
+    rocsparse_diag_type    diag  = arg.diag;
+    rocsparse_fill_mode    uplo  = arg.uplo;
+    rocsparse_solve_policy spol  = arg.spol;
+    rocsparse_index_base   base  = arg.baseA;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+
+    rocsparse_local_handle    handle;
+    rocsparse_local_mat_descr descr;
+    rocsparse_local_mat_info  info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, diag));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, uplo));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Sample matrix
+    std::vector<rocsparse_int> ptr(M + 1, base);
+    std::vector<rocsparse_int> ind;
+    std::vector<T>             val;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int block_begin = (i / BLOCK) * BLOCK;
+        rocsparse_int block_end   = std::min(block_begin + BLOCK, M);
+
+        rocsparse_int col_begin = (uplo == rocsparse_fill_mode_lower) ? block_begin : i;
+        rocsparse_int col_end   = (uplo == rocsparse_fill_mode_lower) ? i + 1 : block_end;
+
+        if(uplo == rocsparse_fill_mode_lower && block_begin > 0)
+        {
+            ind.push_back(base);
+            val.push_back(static_cast<T>(-0.1));
+        }
+
+        for(rocsparse_int j = col_begin; j < col_end; ++j)
+        {
+            ind.push_back(j + base);
+            val.push_back((j == i) ? static_cast<T>(2) : static_cast<T>(-0.1));
+        }
+
+        if(uplo == rocsparse_fill_mode_upper && block_end < M)
+        {
+            ind.push_back(M - 1 + base);
+            val.push_back(static_cast<T>(-0.1));
+        }
+
+        ptr[i + 1] = ind.size() + base;
+    }
+
+    host_csr_matrix<T> hA(M, M, ind.size(), base);
+
+    std::copy(ptr.begin(), ptr.end(), hA.ptr.begin());
+    std::copy(ind.begin(), ind.end(), hA.ind.begin());
+    std::copy(val.begin(), val.end(), hA.val.begin());
+
+    host_dense_matrix<T> hx(M, 1), hy(M, 1);
+    rocsparse_matrix_utils::init(hx);
+
+    device_csr_matrix<T>   dA(hA);
+    device_dense_matrix<T> dx(hx), dy(M, 1);
+
+    host_scalar<rocsparse_int> h_analysis_pivot, h_solve_pivot;
+
+    host_csrsv<rocsparse_int, rocsparse_int, T>(trans,
+                                                hA.m,
+                                                hA.nnz,
+                                                *h_alpha,
+                                                hA.ptr,
+                                                hA.ind,
+                                                hA.val,
+                                                hx,
+                                                hy,
+                                                diag,
+                                                uplo,
+                                                base,
+                                                h_analysis_pivot,
+                                                h_solve_pivot);
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(
+        handle, trans, dA.m, dA.nnz, descr, dA.val, dA.ptr, dA.ind, info, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                      trans,
+                                                      dA.m,
+                                                      dA.nnz,
+                                                      descr,
+                                                      dA.val,
+                                                      dA.ptr,
+                                                      dA.ind,
+                                                      info,
+                                                      rocsparse_analysis_policy_force,
+                                                      spol,
+                                                      dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                   trans,
+                                                   dA.m,
+                                                   dA.nnz,
+                                                   h_alpha,
+                                                   descr,
+                                                   dA.val,
+                                                   dA.ptr,
+                                                   dA.ind,
+                                                   info,
+                                                   dx,
+                                                   dy,
+                                                   spol,
+                                                   dbuffer));
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+    hy.near_check(dy, tol);
 }
 
 template <typename T>
@@ -253,9 +539,33 @@ void testing_csrsv(const Arguments& arg)
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)),
                                     rocsparse_status_invalid_pointer);
 
+            int64_t nlevels, max_width, critical_path;
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_csrsv_level_info(
+                    handle, trans, descr, info, &nlevels, &max_width, &critical_path),
+                rocsparse_status_invalid_pointer);
+
             // Call it twice.
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(PARAMS_ANALYSIS(dA)));
+
+            // Level schedule statistics
+            int64_t h_nlevels, h_max_width, h_critical_path;
+            csrsv_level_info_host(trans,
+                                  hA.m,
+                                  hA.ptr,
+                                  hA.ind,
+                                  uplo,
+                                  base,
+                                  &h_nlevels,
+                                  &h_max_width,
+                                  &h_critical_path);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(
+                handle, trans, descr, info, &nlevels, &max_width, &critical_path));
+            unit_check_scalar(h_nlevels, nlevels);
+            unit_check_scalar(h_max_width, max_width);
+            unit_check_scalar(h_critical_path, critical_path);
             {
                 auto st = rocsparse_csrsv_zero_pivot(handle, descr, info, analysis_pivot);
                 EXPECT_ROCSPARSE_STATUS(st,
@@ -281,6 +591,96 @@ void testing_csrsv(const Arguments& arg)
             hy.near_check(dy, tol);
         }
 
+        //
+        // SUPERNODAL SYNC-FREE SOLVE OF A BLOCK-DENSE MATRIX.
+        //
+        if(spol != rocsparse_solve_policy_level_set)
+        {
+            testing_csrsv_supernode<T>(arg);
+        }
+
+        //
+        // JACOBI-ITERATIVE SOLVE, REUSING THE ANALYSIS META DATA.
+        //
+        if(trans == rocsparse_operation_none && *h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            size_t itsv_buffer_size;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritsv_buffer_size<T>(handle,
+                                                                   trans,
+                                                                   dA.m,
+                                                                   dA.nnz,
+                                                                   descr,
+                                                                   dA.val,
+                                                                   dA.ptr,
+                                                                   dA.ind,
+                                                                   info,
+                                                                   &itsv_buffer_size));
+
+            void* itsv_buffer;
+            CHECK_HIP_ERROR(hipMalloc(&itsv_buffer, itsv_buffer_size));
+
+            // A fixed number of sweeps has to match the host sweeps
+            rocsparse_int        h_sweeps = 3;
+            host_dense_matrix<T> hy_itsv(M, 1);
+            host_csritsv<rocsparse_int, rocsparse_int, T>(hA.m,
+                                                          *h_alpha,
+                                                          hA.ptr,
+                                                          hA.ind,
+                                                          hA.val,
+                                                          hx,
+                                                          hy_itsv,
+                                                          diag,
+                                                          uplo,
+                                                          base,
+                                                          &h_sweeps,
+                                                          nullptr);
+
+            rocsparse_int d_sweeps = 3;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritsv_solve<T>(handle,
+                                                             trans,
+                                                             dA.m,
+                                                             dA.nnz,
+                                                             h_alpha,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.ptr,
+                                                             dA.ind,
+                                                             info,
+                                                             dx,
+                                                             dy,
+                                                             &d_sweeps,
+                                                             nullptr,
+                                                             itsv_buffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            unit_check_scalar(h_sweeps, d_sweeps);
+            hy_itsv.near_check(dy, tol);
+
+            // With a zero tolerance, the sweeps have to converge to the exact solution,
+            // which is reached after at most M sweeps
+            floating_data_t<T> itsv_tol = static_cast<floating_data_t<T>>(0);
+
+            d_sweeps = M;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritsv_solve<T>(handle,
+                                                             trans,
+                                                             dA.m,
+                                                             dA.nnz,
+                                                             h_alpha,
+                                                             descr,
+                                                             dA.val,
+                                                             dA.ptr,
+                                                             dA.ind,
+                                                             info,
+                                                             dx,
+                                                             dy,
+                                                             &d_sweeps,
+                                                             &itsv_tol,
+                                                             itsv_buffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            hy.near_check(dy, tol);
+
+            CHECK_HIP_ERROR(hipFree(itsv_buffer));
+        }
+
         //
         // RESET MAT INFO.
         //
@@ -330,6 +730,48 @@ void testing_csrsv(const Arguments& arg)
             hy.near_check(dy, tol);
         }
 
+        if(arg.graph)
+        {
+            // Capture the solve and the zero pivot query into a HIP graph and replay it
+            hipStream_t stream;
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, stream));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_graph_mode(handle, rocsparse_graph_mode_enabled));
+
+            device_scalar<rocsparse_int> d_solve_pivot;
+            device_scalar<T>             d_alpha(h_alpha);
+
+            hipGraph_t     graph;
+            hipGraphExec_t graph_exec;
+            CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(d_alpha, dA, dx, dy)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_zero_pivot(handle, descr, info, d_solve_pivot));
+            CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+            CHECK_HIP_ERROR(hipGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+
+            // Replay twice, each launch has to recompute the solution
+            for(int i = 0; i < 2; ++i)
+            {
+                CHECK_HIP_ERROR(hipMemsetAsync(dy.data(), 0, sizeof(T) * M, stream));
+                CHECK_HIP_ERROR(hipGraphLaunch(graph_exec, stream));
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+                h_solve_pivot.unit_check(d_solve_pivot);
+                if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+                {
+                    hy.near_check(dy, tol);
+                }
+            }
+
+            CHECK_HIP_ERROR(hipGraphExecDestroy(graph_exec));
+            CHECK_HIP_ERROR(hipGraphDestroy(graph));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_graph_mode(handle, rocsparse_graph_mode_disabled));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, nullptr));
+            CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        }
+
         //
         // A BIT MORE FOR CODE COVERAGE, WE ONLY DO ANALYSIS FOR INFO ASSIGNMENT.
         //
@@ -0,0 +1,340 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_gtsv_interleaved_batch_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle               handle       = local_handle;
+    rocsparse_gtsv_interleaved_alg alg          = rocsparse_gtsv_interleaved_alg_default;
+    rocsparse_int                  m            = safe_size;
+    rocsparse_int                  batch_count  = safe_size;
+    rocsparse_int                  batch_stride = safe_size;
+    const T*                       dl1          = (const T*)0x4;
+    const T*                       d1           = (const T*)0x4;
+    const T*                       du1          = (const T*)0x4;
+    const T*                       x1           = (const T*)0x4;
+    T*                             dl2          = (T*)0x4;
+    T*                             d2           = (T*)0x4;
+    T*                             du2          = (T*)0x4;
+    T*                             x2           = (T*)0x4;
+    size_t*                        buffer_size  = (size_t*)0x4;
+    void*                          temp_buffer  = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, alg, m, dl1, d1, du1, x1, batch_count, batch_stride, buffer_size
+#define PARAMS_SOLVE handle, alg, m, dl2, d2, du2, x2, batch_count, batch_stride, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_gtsv_interleaved_batch_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_gtsv_interleaved_batch<T>, PARAMS_SOLVE);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_SOLVE
+}
+
+// Solve systems with a zero diagonal, where each pair of rows forms an anti-diagonal block
+// that is weakly coupled to its neighbours. Every elimination step requires a row
+// interchange (LU) or a rotation with a zero leading entry (QR).
+template <typename T>
+static void testing_gtsv_interleaved_batch_pivot(rocsparse_handle               handle,
+                                                 rocsparse_gtsv_interleaved_alg alg,
+                                                 rocsparse_int                  m,
+                                                 rocsparse_int                  batch_count,
+                                                 rocsparse_int                  batch_stride)
+{
+    host_vector<T> hdl(batch_stride * m, static_cast<T>(7));
+    host_vector<T> hd(batch_stride * m, static_cast<T>(7));
+    host_vector<T> hdu(batch_stride * m, static_cast<T>(7));
+    host_vector<T> hx(batch_stride * m, static_cast<T>(7));
+    host_vector<T> hb(batch_stride * m, static_cast<T>(7));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = 0; j < batch_count; ++j)
+        {
+            rocsparse_int idx = batch_stride * i + j;
+
+            bool first = (i % 2 == 0);
+
+            hdl[idx] = first ? static_cast<T>(1) : static_cast<T>(4);
+            hd[idx]  = static_cast<T>(0);
+            hdu[idx] = first ? static_cast<T>(4) : static_cast<T>(1);
+            hx[idx]  = random_generator<T>(-10, 10);
+        }
+    }
+
+    for(rocsparse_int j = 0; j < batch_count; ++j)
+    {
+        hdl[j]                          = static_cast<T>(0);
+        hdu[batch_stride * (m - 1) + j] = static_cast<T>(0);
+
+        // Odd sized systems close with a single diagonal entry
+        if(m % 2 == 1)
+        {
+            hd[batch_stride * (m - 1) + j] = static_cast<T>(4);
+        }
+    }
+
+    // Right hand side of the known solution
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = 0; j < batch_count; ++j)
+        {
+            rocsparse_int idx = batch_stride * i + j;
+
+            hb[idx] = hd[idx] * hx[idx];
+
+            if(i > 0)
+            {
+                hb[idx] += hdl[idx] * hx[idx - batch_stride];
+            }
+
+            if(i < m - 1)
+            {
+                hb[idx] += hdu[idx] * hx[idx + batch_stride];
+            }
+        }
+    }
+
+    device_vector<T> ddl(batch_stride * m);
+    device_vector<T> dd(batch_stride * m);
+    device_vector<T> ddu(batch_stride * m);
+    device_vector<T> db(batch_stride * m);
+
+    ddl.transfer_from(hdl);
+    dd.transfer_from(hd);
+    ddu.transfer_from(hdu);
+    db.transfer_from(hb);
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch_buffer_size<T>(
+        handle, alg, m, ddl, dd, ddu, db, batch_count, batch_stride, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(
+        handle, alg, m, ddl, dd, ddu, db, batch_count, batch_stride, dbuffer));
+
+    hb.transfer_from(db);
+
+    // Check against the known solution
+    near_check_general<T>(batch_count, m, hx, batch_stride, hb, batch_stride);
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+template <typename T>
+void testing_gtsv_interleaved_batch(const Arguments& arg)
+{
+    rocsparse_gtsv_interleaved_alg alg          = (rocsparse_gtsv_interleaved_alg)arg.algo;
+    rocsparse_int                  m            = arg.M;
+    rocsparse_int                  batch_count  = arg.N;
+    rocsparse_int                  batch_stride = arg.denseld;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+#define PARAMS_BUFFER_SIZE handle, alg, m, ddl, dd, ddu, dx, batch_count, batch_stride, &buffer_size
+#define PARAMS_SOLVE handle, alg, m, ddl, dd, ddu, dx, batch_count, batch_stride, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 1 || batch_count <= 0 || batch_stride < batch_count)
+    {
+        size_t buffer_size;
+        T*     ddl     = nullptr;
+        T*     dd      = nullptr;
+        T*     ddu     = nullptr;
+        T*     dx      = nullptr;
+        void*  dbuffer = nullptr;
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_gtsv_interleaved_batch_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                (m <= 1 || batch_count < 0 || batch_stride < batch_count)
+                                    ? rocsparse_status_invalid_size
+                                    : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE),
+                                (m <= 1 || batch_count < 0 || batch_stride < batch_count)
+                                    ? rocsparse_status_invalid_size
+                                    : rocsparse_status_success);
+
+        return;
+    }
+
+    rocsparse_seedrand();
+
+    // Host tri-diagonal matrix, entry i of system j is located at batch_stride * i + j
+    host_vector<T> hdl(batch_stride * m, static_cast<T>(7));
+    host_vector<T> hd(batch_stride * m, static_cast<T>(7));
+    host_vector<T> hdu(batch_stride * m, static_cast<T>(7));
+
+    // initialize tri-diagonal matrix
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = 0; j < batch_count; ++j)
+        {
+            hdl[batch_stride * i + j] = random_generator<T>(1, 8);
+            hd[batch_stride * i + j]  = random_generator<T>(17, 32);
+            hdu[batch_stride * i + j] = random_generator<T>(1, 8);
+        }
+    }
+
+    for(rocsparse_int j = 0; j < batch_count; ++j)
+    {
+        hdl[j]                          = static_cast<T>(0);
+        hdu[batch_stride * (m - 1) + j] = static_cast<T>(0);
+    }
+
+    // Host dense rhs
+    host_vector<T> hx(batch_stride * m, static_cast<T>(7));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = 0; j < batch_count; ++j)
+        {
+            hx[batch_stride * i + j] = random_generator<T>(-10, 10);
+        }
+    }
+
+    // Device tri-diagonal matrix
+    device_vector<T> ddl(batch_stride * m);
+    device_vector<T> dd(batch_stride * m);
+    device_vector<T> ddu(batch_stride * m);
+
+    // Device dense rhs
+    device_vector<T> dx(batch_stride * m);
+
+    // Copy to device
+    ddl.transfer_from(hdl);
+    dd.transfer_from(hd);
+    ddu.transfer_from(hdu);
+    dx.transfer_from(hx);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch_buffer_size<T>(PARAMS_BUFFER_SIZE));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE));
+
+        host_vector<T> hx_gold = hx;
+
+        hx.transfer_from(dx);
+
+        // CPU gtsv_interleaved_batch, the matrix arrays are overwritten
+        host_vector<T> hdl_gold = hdl;
+        host_vector<T> hd_gold  = hd;
+        host_vector<T> hdu_gold = hdu;
+
+        host_gtsv_interleaved_batch(
+            alg, m, hdl_gold, hd_gold, hdu_gold, hx_gold, batch_count, batch_stride);
+
+        // Check
+        near_check_general<T>(batch_count, m, hx_gold, batch_stride, hx, batch_stride);
+
+        // Zero diagonal, that can only be solved with pivoting
+        if(alg != rocsparse_gtsv_interleaved_alg_thomas
+           && alg != rocsparse_gtsv_interleaved_alg_pcr)
+        {
+            testing_gtsv_interleaved_batch_pivot<T>(handle, alg, m, batch_count, batch_stride);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            ddl.transfer_from(hdl);
+            dd.transfer_from(hd);
+            ddu.transfer_from(hdu);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE));
+        }
+
+        double gpu_solve_time_used = 0;
+
+        // Performance run, the matrix is overwritten by each call
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            ddl.transfer_from(hdl);
+            dd.transfer_from(hd);
+            ddu.transfer_from(hdu);
+
+            double gpu_time_used = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_gtsv_interleaved_batch<T>(PARAMS_SOLVE));
+            gpu_solve_time_used += get_time_us() - gpu_time_used;
+        }
+
+        gpu_solve_time_used /= number_hot_calls;
+
+        double gbyte_count = gtsv_strided_batch_gbyte_count<T>(m, batch_count);
+
+        double gpu_gbyte = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "batch_count" << std::setw(12)
+                  << "batch_stride" << std::setw(12) << "algorithm" << std::setw(12) << "GB/s"
+                  << std::setw(12) << "solve_msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << m << std::setw(12) << batch_count << std::setw(12)
+                  << batch_stride << std::setw(12) << alg << std::setw(12) << gpu_gbyte
+                  << std::setw(12) << gpu_solve_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_SOLVE
+}
+
+#define INSTANTIATE(TYPE)                                                             \
+    template void testing_gtsv_interleaved_batch_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_gtsv_interleaved_batch<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
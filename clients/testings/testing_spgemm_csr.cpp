@@ -499,6 +499,35 @@ void testing_spgemm_csr(const Arguments& arg)
                 hC.near_check(dC);
             }
 
+            //
+            // Reuse the sparsity pattern of C, the numeric stage recomputes the values only.
+            //
+            {
+                size_t buffer_size;
+                void*  dbuffer = nullptr;
+
+                stage = rocsparse_spgemm_stage_buffer_size;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+                CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                stage = rocsparse_spgemm_stage_symbolic;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+                CHECK_HIP_ERROR(hipFree(dbuffer));
+                dbuffer = nullptr;
+
+                CHECK_HIP_ERROR(hipMemset(dC.val, 0, sizeof(T) * dC.nnz));
+
+                stage = rocsparse_spgemm_stage_numeric;
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm(PARAMS(h_alpha_ptr, A, B, D, h_beta_ptr, C, dbuffer)));
+
+                stage = rocsparse_spgemm_stage_auto;
+            }
+
+            hC.near_check(dC);
+
             {
                 device_vector<T> d_alpha(1);
                 device_vector<T> d_beta(1);
@@ -138,6 +138,12 @@ void testing_spmm_coo(const Arguments& arg)
     // Create rocsparse handle
     rocsparse_local_handle handle;
 
+    // Set deterministic mode
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_deterministic_mode(
+        handle,
+        arg.deterministic ? rocsparse_deterministic_mode_enabled
+                          : rocsparse_deterministic_mode_disabled));
+
     // Argument sanity check before allocating invalid memory
     if(M <= 0 || N <= 0 || K <= 0)
     {
@@ -263,18 +269,32 @@ void testing_spmm_coo(const Arguments& arg)
     I nrow_C = M;
     I ncol_C = N;
 
+    // Strided batches, A is either batched alike or shared by all batches
+    I batch_count   = arg.batch_count;
+    I batch_count_A = arg.batch_count_A;
+
+    // Every batch of A shares the sparsity pattern but gets its own values
+    hcoo_val.resize(nnz_A * batch_count_A);
+    for(I batch = 1; batch < batch_count_A; ++batch)
+    {
+        for(I i = 0; i < nnz_A; ++i)
+        {
+            hcoo_val[nnz_A * batch + i] = hcoo_val[i] * static_cast<T>(batch + 1);
+        }
+    }
+
     I nnz_B = order == rocsparse_order_column ? ldb * ncol_B : nrow_B * ldb;
     I nnz_C = order == rocsparse_order_column ? ldc * ncol_C : nrow_C * ldc;
 
     // Allocate host memory for vectors
-    host_vector<T> hB(nnz_B);
-    host_vector<T> hC_1(nnz_C, 0);
-    host_vector<T> hC_2(nnz_C, 0);
-    host_vector<T> hC_gold(nnz_C, 0);
+    host_vector<T> hB(nnz_B * batch_count);
+    host_vector<T> hC_1(nnz_C * batch_count, 0);
+    host_vector<T> hC_2(nnz_C * batch_count, 0);
+    host_vector<T> hC_gold(nnz_C * batch_count, 0);
 
     // Initialize data on CPU
-    rocsparse_init<T>(hB, nnz_B, 1, 1);
-    rocsparse_init<T>(hC_1, nnz_C, 1, 1);
+    rocsparse_init<T>(hB, nnz_B * batch_count, 1, 1);
+    rocsparse_init<T>(hC_1, nnz_C * batch_count, 1, 1);
 
     hC_2    = hC_1;
     hC_gold = hC_1;
@@ -282,10 +302,10 @@ void testing_spmm_coo(const Arguments& arg)
     // Allocate device memory
     device_vector<I> dcoo_row_ind(nnz_A);
     device_vector<I> dcoo_col_ind(nnz_A);
-    device_vector<T> dcoo_val(nnz_A);
-    device_vector<T> dB(nnz_B);
-    device_vector<T> dC_1(nnz_C);
-    device_vector<T> dC_2(nnz_C);
+    device_vector<T> dcoo_val(nnz_A * batch_count_A);
+    device_vector<T> dB(nnz_B * batch_count);
+    device_vector<T> dC_1(nnz_C * batch_count);
+    device_vector<T> dC_2(nnz_C * batch_count);
     device_vector<T> dalpha(1);
     device_vector<T> dbeta(1);
 
@@ -294,10 +314,11 @@ void testing_spmm_coo(const Arguments& arg)
         hipMemcpy(dcoo_row_ind, hcoo_row_ind.data(), sizeof(I) * nnz_A, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(
         hipMemcpy(dcoo_col_ind, hcoo_col_ind.data(), sizeof(I) * nnz_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dcoo_val, hcoo_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcoo_val, hcoo_val.data(), sizeof(T) * nnz_A * batch_count_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C * batch_count, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -308,6 +329,11 @@ void testing_spmm_coo(const Arguments& arg)
     rocsparse_local_dnmat C1(nrow_C, ncol_C, ldc, dC_1, ttype, order);
     rocsparse_local_dnmat C2(nrow_C, ncol_C, ldc, dC_2, ttype, order);
 
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_strided_batch(A, batch_count_A, nnz_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(B, batch_count, nnz_B));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C1, batch_count, nnz_C));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C2, batch_count, nnz_C));
+
     // Query SpMM buffer
     size_t buffer_size;
     CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
@@ -379,26 +405,31 @@ void testing_spmm_coo(const Arguments& arg)
                                              dbuffer));
 
         // Copy output to host
-        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C * batch_count, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C * batch_count, hipMemcpyDeviceToHost));
 
         // CPU coomm
-        host_coomm(alg,
-                   nrow_A,
-                   ncol_C,
-                   nnz_A,
-                   trans_B,
-                   halpha,
-                   hcoo_row_ind.data(),
-                   hcoo_col_ind.data(),
-                   hcoo_val.data(),
-                   hB.data(),
-                   ldb,
-                   hbeta,
-                   hC_gold.data(),
-                   ldc,
-                   order,
-                   base);
+        for(I batch = 0; batch < batch_count; ++batch)
+        {
+            host_coomm(alg,
+                       nrow_A,
+                       ncol_C,
+                       nnz_A,
+                       trans_B,
+                       halpha,
+                       hcoo_row_ind.data(),
+                       hcoo_col_ind.data(),
+                       hcoo_val.data() + (batch_count_A == 1 ? 0 : nnz_A * batch),
+                       hB.data() + nnz_B * batch,
+                       ldb,
+                       hbeta,
+                       hC_gold.data() + nnz_C * batch,
+                       ldc,
+                       order,
+                       base);
+        }
 
         hC_gold.near_check(hC_1, tol);
         hC_gold.near_check(hC_2, tol);
@@ -451,9 +482,11 @@ void testing_spmm_coo(const Arguments& arg)
 
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
 
-        double gpu_gflops
-            = spmm_gflop_count(N, nnz_A, nnz_C, hbeta != static_cast<T>(0)) / gpu_time_used * 1e6;
-        double gpu_gbyte = coomm_gbyte_count<T>(nnz_A, nnz_B, nnz_C, hbeta != static_cast<T>(0))
+        double gpu_gflops = batch_count
+                            * spmm_gflop_count(N, nnz_A, nnz_C, hbeta != static_cast<T>(0))
+                            / gpu_time_used * 1e6;
+        double gpu_gbyte = batch_count
+                           * coomm_gbyte_count<T>(nnz_A, nnz_B, nnz_C, hbeta != static_cast<T>(0))
                            / gpu_time_used * 1e6;
 
         std::cout.precision(2);
@@ -463,15 +496,15 @@ void testing_spmm_coo(const Arguments& arg)
         std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "K"
                   << std::setw(12) << "nnz_A" << std::setw(12) << "alpha" << std::setw(12) << "beta"
                   << std::setw(12) << "Algorithm" << std::setw(12) << "GFlop/s" << std::setw(12)
-                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
-                  << "verified" << std::endl;
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(14)
+                  << "deterministic" << std::setw(12) << "verified" << std::endl;
 
         std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << K << std::setw(12)
                   << nnz_A << std::setw(12) << halpha << std::setw(12) << hbeta << std::setw(12)
                   << rocsparse_spmmalg2string(alg) << std::setw(12) << gpu_gflops << std::setw(12)
                   << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
-                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
-                  << std::endl;
+                  << number_hot_calls << std::setw(14) << (arg.deterministic ? "yes" : "no")
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
     }
 
     CHECK_HIP_ERROR(hipFree(dbuffer));
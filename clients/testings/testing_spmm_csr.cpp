@@ -121,6 +121,23 @@ void testing_spmm_csr_bad_arg(const Arguments& arg)
                                            nullptr,
                                            nullptr),
                             rocsparse_status_invalid_pointer);
+
+    // The batch count of C exceeds the grid z limit
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(mat_C, 65536, (int64_t)m * n));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmm(handle,
+                                           trans_A,
+                                           trans_B,
+                                           alpha,
+                                           mat_A,
+                                           mat_B,
+                                           beta,
+                                           mat_C,
+                                           ttype,
+                                           alg,
+                                           stage,
+                                           (size_t*)0x4,
+                                           (void*)0x4),
+                            rocsparse_status_invalid_size);
 }
 
 template <typename I, typename J, typename T>
@@ -275,6 +292,20 @@ void testing_spmm_csr(const Arguments& arg)
     J C_m = M;
     J C_n = N;
 
+    // Strided batches, A is either batched alike or shared by all batches
+    J batch_count   = arg.batch_count;
+    J batch_count_A = arg.batch_count_A;
+
+    // Every batch of A shares the sparsity pattern but gets its own values
+    hcsr_val.resize(nnz_A * batch_count_A);
+    for(J batch = 1; batch < batch_count_A; ++batch)
+    {
+        for(I i = 0; i < nnz_A; ++i)
+        {
+            hcsr_val[nnz_A * batch + i] = hcsr_val[i] * static_cast<T>(batch + 1);
+        }
+    }
+
     J ldb = order == rocsparse_order_column ? (trans_B == rocsparse_operation_none ? 2 * K : 2 * N)
                                             : (trans_B == rocsparse_operation_none ? 2 * N : 2 * K);
     J ldc = order == rocsparse_order_column ? 2 * M : 2 * N;
@@ -288,14 +319,14 @@ void testing_spmm_csr(const Arguments& arg)
     I nnz_C = nrowC * ncolC;
 
     // Allocate host memory for vectors
-    host_vector<T> hB(nnz_B);
-    host_vector<T> hC_1(nnz_C);
-    host_vector<T> hC_2(nnz_C);
-    host_vector<T> hC_gold(nnz_C);
+    host_vector<T> hB(nnz_B * batch_count);
+    host_vector<T> hC_1(nnz_C * batch_count);
+    host_vector<T> hC_2(nnz_C * batch_count);
+    host_vector<T> hC_gold(nnz_C * batch_count);
 
     // Initialize data on CPU
-    rocsparse_init<T>(hB, nnz_B, 1, 1);
-    rocsparse_init<T>(hC_1, nnz_C, 1, 1);
+    rocsparse_init<T>(hB, nnz_B * batch_count, 1, 1);
+    rocsparse_init<T>(hC_1, nnz_C * batch_count, 1, 1);
 
     hC_2    = hC_1;
     hC_gold = hC_1;
@@ -303,10 +334,10 @@ void testing_spmm_csr(const Arguments& arg)
     // Allocate device memory
     device_vector<I> dcsr_row_ptr(A_m + 1);
     device_vector<J> dcsr_col_ind(nnz_A);
-    device_vector<T> dcsr_val(nnz_A);
-    device_vector<T> dB(nnz_B);
-    device_vector<T> dC_1(nnz_C);
-    device_vector<T> dC_2(nnz_C);
+    device_vector<T> dcsr_val(nnz_A * batch_count_A);
+    device_vector<T> dB(nnz_B * batch_count);
+    device_vector<T> dC_1(nnz_C * batch_count);
+    device_vector<T> dC_2(nnz_C * batch_count);
     device_vector<T> dalpha(1);
     device_vector<T> dbeta(1);
 
@@ -315,10 +346,11 @@ void testing_spmm_csr(const Arguments& arg)
         hipMemcpy(dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(I) * (A_m + 1), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(
         hipMemcpy(dcsr_col_ind, hcsr_col_ind.data(), sizeof(J) * nnz_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz_A, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_val, hcsr_val.data(), sizeof(T) * nnz_A * batch_count_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * nnz_B * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_1, hC_1, sizeof(T) * nnz_C * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_2, hC_2, sizeof(T) * nnz_C * batch_count, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dalpha, &halpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dbeta, &hbeta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -338,6 +370,11 @@ void testing_spmm_csr(const Arguments& arg)
     rocsparse_local_dnmat C1(C_m, C_n, ldc, dC_1, ttype, order);
     rocsparse_local_dnmat C2(C_m, C_n, ldc, dC_2, ttype, order);
 
+    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_set_strided_batch(A, batch_count_A, nnz_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(B, batch_count, nnz_B));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C1, batch_count, nnz_C));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dnmat_set_strided_batch(C2, batch_count, nnz_C));
+
     // Query SpMM buffer
     size_t buffer_size;
     CHECK_ROCSPARSE_ERROR(rocsparse_spmm(handle,
@@ -409,26 +446,31 @@ void testing_spmm_csr(const Arguments& arg)
                                              dbuffer));
 
         // Copy output to host
-        CHECK_HIP_ERROR(hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_1, dC_1, sizeof(T) * nnz_C * batch_count, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_2, dC_2, sizeof(T) * nnz_C * batch_count, hipMemcpyDeviceToHost));
 
         // CPU csrmm
-        host_csrmm<T, I, J>(A_m,
-                            N,
-                            A_n,
-                            trans_A,
-                            trans_B,
-                            halpha,
-                            hcsr_row_ptr,
-                            hcsr_col_ind,
-                            hcsr_val,
-                            hB,
-                            ldb,
-                            hbeta,
-                            hC_gold,
-                            ldc,
-                            order,
-                            base);
+        for(J batch = 0; batch < batch_count; ++batch)
+        {
+            host_csrmm<T, I, J>(A_m,
+                                N,
+                                A_n,
+                                trans_A,
+                                trans_B,
+                                halpha,
+                                hcsr_row_ptr,
+                                hcsr_col_ind,
+                                hcsr_val.data() + (batch_count_A == 1 ? 0 : nnz_A * batch),
+                                hB.data() + nnz_B * batch,
+                                ldb,
+                                hbeta,
+                                hC_gold.data() + nnz_C * batch,
+                                ldc,
+                                order,
+                                base);
+        }
 
         hC_gold.near_check(hC_1);
         hC_gold.near_check(hC_2);
@@ -482,11 +524,15 @@ void testing_spmm_csr(const Arguments& arg)
         gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
 
         double gflop_count
-            = spmm_gflop_count(N, nnz_A, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+            = batch_count * spmm_gflop_count(N, nnz_A, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
         double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
 
-        double gbyte_count = csrmm_gbyte_count<T>(
-            A_m, nnz_A, (I)B_m * (I)B_n, (I)C_m * (I)C_n, hbeta != static_cast<T>(0));
+        double gbyte_count = batch_count
+                             * csrmm_gbyte_count<T>(A_m,
+                                                    nnz_A,
+                                                    (I)B_m * (I)B_n,
+                                                    (I)C_m * (I)C_n,
+                                                    hbeta != static_cast<T>(0));
         double gpu_gbyte = get_gpu_gbyte(gpu_time_used, gbyte_count);
 
         std::cout.precision(2);
@@ -173,6 +173,106 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify deterministic mode
+ *
+ *  \details
+ *  \p rocsparse_set_deterministic_mode specifies the deterministic mode to be used by
+ *  the rocSPARSE library context and all subsequent function calls. By default,
+ *  routines are allowed to accumulate with atomics, which can produce results that
+ *  differ in the last bits from run to run. If \ref rocsparse_deterministic_mode_enabled
+ *  is set, coomv, csrmv and the COO SpMM algorithms with (conjugate) transposed or
+ *  atomic accumulation, as well as csrgemm, switch to variants with a fixed summation
+ *  order.
+ *
+ *  \note
+ *  The deterministic variants may be slower and can allocate temporary device memory.
+ *
+ *  @param[in]
+ *  handle              the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  deterministic_mode  the deterministic mode to be used by the rocSPARSE library
+ *                      context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p deterministic_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_deterministic_mode(rocsparse_handle             handle,
+                                                  rocsparse_deterministic_mode deterministic_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current deterministic mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_deterministic_mode gets the rocSPARSE library context deterministic
+ *  mode which is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle              the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  deterministic_mode  the deterministic mode that is currently used by the rocSPARSE
+ *                      library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p deterministic_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_deterministic_mode(rocsparse_handle              handle,
+                                                  rocsparse_deterministic_mode* deterministic_mode);
+
+/*! \ingroup aux_module
+ *  \brief Specify graph mode
+ *
+ *  \details
+ *  \p rocsparse_set_graph_mode specifies the graph mode to be used by the rocSPARSE
+ *  library context and all subsequent function calls. By default, some compute stages
+ *  synchronize the stream, e.g. to return a scalar result to the host. If
+ *  \ref rocsparse_graph_mode_enabled is set, graph-safe routines only enqueue
+ *  asynchronous work into the stream and can be captured into a HIP graph. Scalar
+ *  results stay in device memory and require \ref rocsparse_pointer_mode_device.
+ *  Routines that cannot avoid a synchronization or a device memory allocation return
+ *  \ref rocsparse_status_not_implemented in this mode.
+ *
+ *  \note
+ *  In graph mode, the zero pivot functions write the position to device memory but
+ *  cannot report \ref rocsparse_status_zero_pivot, as this would require reading
+ *  the result on the host.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  graph_mode  the graph mode to be used by the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p graph_mode is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_graph_mode(rocsparse_handle handle, rocsparse_graph_mode graph_mode);
+
+/*! \ingroup aux_module
+ *  \brief Get current graph mode from library context
+ *
+ *  \details
+ *  \p rocsparse_get_graph_mode gets the rocSPARSE library context graph mode which
+ *  is currently used for all subsequent function calls.
+ *
+ *  @param[in]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  graph_mode  the graph mode that is currently used by the rocSPARSE library
+ *              context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p graph_mode pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_graph_mode(rocsparse_handle handle, rocsparse_graph_mode* graph_mode);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -435,6 +535,33 @@ rocsparse_status rocsparse_create_hyb_mat(rocsparse_hyb_mat* hyb);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb);
 
+/*! \ingroup aux_module
+ *  \brief Get the partitioning of a \p HYB matrix structure
+ *
+ *  \details
+ *  \p rocsparse_get_hyb_mat_partition returns the ELL width that has been chosen by
+ *  rocsparse_csr2hyb(), together with the predicted cost of the partitioning. The cost
+ *  is modelled as the number of bytes of matrix data that are read by hybmv, i.e.
+ *  the padded ELL part plus the COO part. This can be used to inspect the choice made
+ *  by \ref rocsparse_hyb_partition_histogram, or to compare it against other
+ *  partition types.
+ *
+ *  @param[in]
+ *  hyb             the hybrid matrix structure.
+ *  @param[out]
+ *  ell_width       the number of non-zero entries per row stored in the ELL part.
+ *  @param[out]
+ *  predicted_cost  the modelled hybmv cost in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p hyb, \p ell_width or
+ *              \p predicted_cost pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_hyb_mat_partition(const rocsparse_hyb_mat hyb,
+                                                 rocsparse_int*          ell_width,
+                                                 int64_t*                predicted_cost);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix info structure
  *
@@ -720,6 +847,16 @@ rocsparse_status rocsparse_spmat_get_values(rocsparse_spmat_descr descr, void**
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_spmat_set_values(rocsparse_spmat_descr descr, void* values);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_get_strided_batch(const rocsparse_spmat_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmat_set_strided_batch(rocsparse_spmat_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_spmat_get_attribute(rocsparse_spmat_descr     descr,
                                                rocsparse_spmat_attribute attribute,
@@ -782,6 +919,16 @@ rocsparse_status rocsparse_dnmat_get_values(const rocsparse_dnmat_descr descr, v
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_dnmat_set_values(rocsparse_dnmat_descr descr, void* values);
 
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnmat_get_strided_batch(const rocsparse_dnmat_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dnmat_set_strided_batch(rocsparse_dnmat_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1616,6 +1616,13 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle                handle,
 *  this function will be executed only once for a given matrix and particular operation
 *  type. The gathered analysis meta data can be cleared by rocsparse_csrmv_clear().
 *
+*  If \p trans is \ref rocsparse_operation_transpose or
+*  \ref rocsparse_operation_conjugate_transpose and the matrix is not symmetric, the
+*  analysis step additionally stores the transposed (CSC) sparsity pattern together with
+*  a permutation into \p csr_val. Subsequent transposed \p csrmv calls then gather
+*  instead of scattering with atomics, which makes the result bitwise reproducible.
+*  Matrix values may change between calls without repeating the analysis.
+*
 *  \note
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
 *
@@ -2234,6 +2241,56 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
                                        const rocsparse_mat_descr descr,
                                        rocsparse_mat_info        info);
 
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_level_info returns statistics of the level schedule that has been
+*  computed by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis() or rocsparse_zcsrsv_analysis(). Rows of the same level
+*  can be solved in parallel, while the levels have to be processed one after another.
+*  Thus, the number of levels and the critical path length, i.e. the sum of the maximum
+*  number of non-zero entries per row of each level, are a measure for the sequential
+*  work of the triangular solve, while the maximum width indicates the available
+*  parallelism. This can be used to decide, whether a triangular solve is worth it, or
+*  whether e.g. rocsparse_scsritsv_solve() should be used instead.
+*
+*  \note
+*  \p rocsparse_csrsv_level_info is a non blocking function. The statistics are stored
+*  on the host during the analysis step.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans           matrix operation type.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis
+*                  step.
+*  @param[out]
+*  nlevels         number of levels of the triangular matrix.
+*  @param[out]
+*  max_width       maximum number of rows of a single level.
+*  @param[out]
+*  critical_path   sum of the maximum number of non-zero entries per row of each level.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p info, \p nlevels,
+*              \p max_width or \p critical_path pointer is invalid, or the analysis has
+*              not been performed for the given operation and fill mode.
+*  \retval     rocsparse_status_invalid_value \p trans is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_level_info(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            int64_t*                  nlevels,
+                                            int64_t*                  max_width,
+                                            int64_t*                  critical_path);
+
 /*! \ingroup level2_module
 *  \brief Sparse triangular solve using CSR storage format
 *
@@ -2271,6 +2328,19 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *  rocsparse_csrsort().
 *
 *  \note
+*  With \ref rocsparse_solve_policy_level_set, each level of the matrix is solved by a
+*  separate kernel launch, while \ref rocsparse_solve_policy_sync_free solves all rows
+*  with a single kernel launch, where each row waits for its dependencies. With
+*  \ref rocsparse_solve_policy_auto, the level set solve is chosen, if the analysis
+*  found few and wide levels. The sync-free solve processes supernodes, i.e. groups of
+*  consecutive rows that share their sparsity pattern outside of a dense triangular
+*  diagonal block, with a single wavefront, if the analysis found wide enough
+*  supernodes. Supernodes are only detected by rocsparse_scsrsv_analysis(),
+*  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() and
+*  rocsparse_zcsrsv_analysis(), if its solve policy is not
+*  \ref rocsparse_solve_policy_level_set.
+*
+*  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
@@ -2305,7 +2375,8 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
 *  @param[out]
 *  y           array of \p m elements, holding the solution.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  policy      \ref rocsparse_solve_policy_auto, \ref rocsparse_solve_policy_level_set
+*              or \ref rocsparse_solve_policy_sync_free.
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
@@ -2460,6 +2531,267 @@ rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle                handle,
                                         void*                           temp_buffer);
 /**@}*/
 
+/*! \ingroup level2_module
+*  \brief Iterative sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csritsv_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_scsritsv_solve(), rocsparse_dcsritsv_solve(),
+*  rocsparse_ccsritsv_solve() and rocsparse_zcsritsv_solve(). The temporary storage
+*  buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans       matrix operation type.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsritsv_solve(), rocsparse_dcsritsv_solve(),
+*              rocsparse_ccsritsv_solve() and rocsparse_zcsritsv_solve().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritsv_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritsv_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_operation       trans,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritsv_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_operation            trans,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritsv_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_operation             trans,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup level2_module
+*  \brief Iterative sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csritsv_solve approximates the solution of a sparse triangular linear
+*  system of a sparse \f$m \times m\f$ matrix \f$A = D + T\f$, defined in CSR storage
+*  format, where \f$D\f$ is the diagonal and \f$T\f$ the strictly lower or upper
+*  triangular part of \f$A\f$, such that
+*  \f[
+*    A \cdot y = \alpha \cdot x,
+*  \f]
+*  using Jacobi sweeps
+*  \f[
+*    y^{(k+1)} = D^{-1} \cdot \left(\alpha \cdot x - T \cdot y^{(k)}\right),
+*  \f]
+*  starting with \f$y^{(0)} = 0\f$. In contrast to rocsparse_scsrsv_solve(),
+*  rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve(), all
+*  rows are independent within each sweep, such that long dependency chains do not
+*  serialize the computation. This is useful, if only an approximate solution is
+*  required, e.g. when applying an incomplete factorization as preconditioner. For a
+*  triangular matrix, the iteration yields the exact solution after at most \f$m\f$
+*  sweeps.
+*
+*  The iteration stops after \p sweeps sweeps, or, if \p tol is not a null pointer,
+*  as soon as \f$\|y^{(k+1)} - y^{(k)}\|_{\infty} \leq tol\f$. On exit, \p sweeps holds
+*  the number of performed sweeps.
+*
+*  \p rocsparse_csritsv_solve requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsritsv_buffer_size(), rocsparse_dcsritsv_buffer_size(),
+*  rocsparse_ccsritsv_buffer_size() or rocsparse_zcsritsv_buffer_size(). Furthermore,
+*  the diagonal entry of each row is obtained from the analysis meta data of
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis() or rocsparse_zcsrsv_analysis(), which has to be
+*  performed with the same \p descr fill mode. Numerical zero pivots are reported
+*  in the same way as for rocsparse_csrsv_solve() and can be checked calling
+*  rocsparse_csrsv_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  If \p tol is a null pointer, this function is non blocking and executed
+*  asynchronously with respect to the host. Otherwise, the host is synchronized after
+*  each sweep, in order to test for convergence.
+*
+*  \note
+*  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans       matrix operation type.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  x           array of \p m elements, holding the right-hand side.
+*  @param[out]
+*  y           array of \p m elements, holding the approximate solution.
+*  @param[inout]
+*  sweeps      maximum number of sweeps on input, number of performed sweeps on
+*              output (host pointer).
+*  @param[in]
+*  tol         tolerance of the maximum update of a sweep (host pointer). If \p tol is
+*              a null pointer, exactly \p sweeps sweeps are performed.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p sweeps is invalid.
+*  \retval     rocsparse_status_invalid_value \p tol is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p info, \p x, \p y, \p sweeps or
+*              \p temp_buffer pointer is invalid, or the analysis has not been performed.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none,
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or \p tol
+*              is valid and the \ref rocsparse_graph_mode is
+*              \ref rocsparse_graph_mode_enabled.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritsv_solve(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const float*              alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info,
+                                          const float*              x,
+                                          float*                    y,
+                                          rocsparse_int*            sweeps,
+                                          const float*              tol,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritsv_solve(rocsparse_handle          handle,
+                                          rocsparse_operation       trans,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const double*             alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_mat_info        info,
+                                          const double*             x,
+                                          double*                   y,
+                                          rocsparse_int*            sweeps,
+                                          const double*             tol,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritsv_solve(rocsparse_handle               handle,
+                                          rocsparse_operation            trans,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  nnz,
+                                          const rocsparse_float_complex* alpha,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int*           csr_row_ptr,
+                                          const rocsparse_int*           csr_col_ind,
+                                          rocsparse_mat_info             info,
+                                          const rocsparse_float_complex* x,
+                                          rocsparse_float_complex*       y,
+                                          rocsparse_int*                 sweeps,
+                                          const float*                   tol,
+                                          void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritsv_solve(rocsparse_handle                handle,
+                                          rocsparse_operation             trans,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   nnz,
+                                          const rocsparse_double_complex* alpha,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int*            csr_row_ptr,
+                                          const rocsparse_int*            csr_col_ind,
+                                          rocsparse_mat_info              info,
+                                          const rocsparse_double_complex* x,
+                                          rocsparse_double_complex*       y,
+                                          rocsparse_int*                  sweeps,
+                                          const double*                   tol,
+                                          void*                           temp_buffer);
+/**@}*/
+
 /*! \ingroup level2_module
 *  \brief Sparse matrix vector multiplication using ELL storage format
 *
@@ -6209,875 +6541,2281 @@ rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                handle,
                                     void*                           temp_buffer);
 /**@}*/
 
-/*
-* ===========================================================================
-*    preconditioner SPARSE
-* ===========================================================================
-*/
-
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_sbsric0(),
- *  rocsparse_dbsric0(), rocsparse_cbsric0() or rocsparse_zbsric0() computation.
- *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
- *  index base as the BSR matrix.
- *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
- *
- *  \note
- *  If a zero pivot is found, \p position=j means that either the diagonal block \p A(j,j)
- *  is missing (structural zero) or the diagonal block \p A(j,j) is not positive definite
- *  (numerical zero).
- *
- *  \note \p rocsparse_bsric0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
-                                             rocsparse_mat_info info,
-                                             rocsparse_int*     position);
-
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(), rocsparse_sbsric0(),
- *  rocsparse_dbsric0(), rocsparse_sbsric0() and rocsparse_dbsric0(). The temporary
- *  storage buffer must be allocated by the user. The size of the temporary storage
- *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
- *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
- *  rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(), rocsparse_cbsrilu0_buffer_size()
- *  and rocsparse_zbsrilu0_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir             direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *              rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
- *              rocsparse_sbsric0(), rocsparse_dbsric0(), rocsparse_cbsric0()
- *              and rocsparse_zbsric0().
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format, computed in
+*  chunks of rows
+*
+*  \details
+*  \p rocsparse_csrgemm_chunked multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
+*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$, such
+*  that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
+*  \f]
+*  similar to rocsparse_scsrgemm(), rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and
+*  rocsparse_zcsrgemm(). In contrast, the sparse CSR matrix \f$C\f$ is never stored on
+*  the device as a whole. Instead, an upper bound of the number of non-zero entries of
+*  each row of \f$C\f$ is estimated from the number of intermediate products, and the
+*  rows of \f$C\f$ are split into chunks, such that the device memory that is required
+*  to compute a chunk does not exceed \p memory_budget. The chunks are computed one after
+*  another and each chunk is copied to pinned host memory on a second stream, while the
+*  next chunk is computed. Once the copy of a chunk has finished, \p callback is invoked
+*  with the chunk, see \ref rocsparse_csrgemm_chunk_callback.
+*
+*  This allows the computation of products, which exceed the available device memory,
+*  e.g. squaring the adjacency matrix of a large graph. To assemble \f$C\f$ in host
+*  memory, the callback can append each chunk to a host CSR matrix.
+*
+*  \note \p memory_budget covers the chunks of \f$C\f$ and the temporary storage
+*  buffer of the multiplication. The per row estimate of \p m integers is allocated
+*  temporarily, before the chunks are computed.
+*  \note If no product has to be computed, i.e. \f$C = \beta \cdot D\f$, the matrix is
+*  not split and has to fit \p memory_budget.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is blocking with respect to the host.
+*  \note Please note, that for matrix products with more than 4096 non-zero entries per
+*  row, additional temporary storage buffer is allocated by the algorithm, that is not
+*  covered by \p memory_budget.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[inout]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  memory_budget   number of bytes of device memory that may be used to compute the
+*                  chunks of \f$C\f$.
+*  @param[in]
+*  callback        function that is invoked for each chunk of \f$C\f$.
+*  @param[in]
+*  user_data       pointer that is passed to \p callback.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
+*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
+*          invalid if \p beta is valid, \p descr_C, \p info_C or \p callback is invalid.
+*  \retval rocsparse_status_memory_error a single row of \f$C\f$ does not fit
+*          \p memory_budget, or the workspace could not be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none,
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*          \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled.
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_direction            dir,
-                                               rocsparse_int                  mb,
-                                               rocsparse_int                  nnzb,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* bsr_val,
-                                               const rocsparse_int*           bsr_row_ptr,
-                                               const rocsparse_int*           bsr_col_ind,
-                                               rocsparse_int                  block_dim,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size);
+rocsparse_status rocsparse_scsrgemm_chunked(rocsparse_handle                 handle,
+                                            rocsparse_operation              trans_A,
+                                            rocsparse_operation              trans_B,
+                                            rocsparse_int                    m,
+                                            rocsparse_int                    n,
+                                            rocsparse_int                    k,
+                                            const float*                     alpha,
+                                            const rocsparse_mat_descr        descr_A,
+                                            rocsparse_int                    nnz_A,
+                                            const float*                     csr_val_A,
+                                            const rocsparse_int*             csr_row_ptr_A,
+                                            const rocsparse_int*             csr_col_ind_A,
+                                            const rocsparse_mat_descr        descr_B,
+                                            rocsparse_int                    nnz_B,
+                                            const float*                     csr_val_B,
+                                            const rocsparse_int*             csr_row_ptr_B,
+                                            const rocsparse_int*             csr_col_ind_B,
+                                            const float*                     beta,
+                                            const rocsparse_mat_descr        descr_D,
+                                            rocsparse_int                    nnz_D,
+                                            const float*                     csr_val_D,
+                                            const rocsparse_int*             csr_row_ptr_D,
+                                            const rocsparse_int*             csr_col_ind_D,
+                                            const rocsparse_mat_descr        descr_C,
+                                            rocsparse_mat_info               info_C,
+                                            size_t                           memory_budget,
+                                            rocsparse_csrgemm_chunk_callback callback,
+                                            void*                            user_data);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_chunked(rocsparse_handle                 handle,
+                                            rocsparse_operation              trans_A,
+                                            rocsparse_operation              trans_B,
+                                            rocsparse_int                    m,
+                                            rocsparse_int                    n,
+                                            rocsparse_int                    k,
+                                            const double*                    alpha,
+                                            const rocsparse_mat_descr        descr_A,
+                                            rocsparse_int                    nnz_A,
+                                            const double*                    csr_val_A,
+                                            const rocsparse_int*             csr_row_ptr_A,
+                                            const rocsparse_int*             csr_col_ind_A,
+                                            const rocsparse_mat_descr        descr_B,
+                                            rocsparse_int                    nnz_B,
+                                            const double*                    csr_val_B,
+                                            const rocsparse_int*             csr_row_ptr_B,
+                                            const rocsparse_int*             csr_col_ind_B,
+                                            const double*                    beta,
+                                            const rocsparse_mat_descr        descr_D,
+                                            rocsparse_int                    nnz_D,
+                                            const double*                    csr_val_D,
+                                            const rocsparse_int*             csr_row_ptr_D,
+                                            const rocsparse_int*             csr_col_ind_D,
+                                            const rocsparse_mat_descr        descr_C,
+                                            rocsparse_mat_info               info_C,
+                                            size_t                           memory_budget,
+                                            rocsparse_csrgemm_chunk_callback callback,
+                                            void*                            user_data);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_chunked(rocsparse_handle                 handle,
+                                            rocsparse_operation              trans_A,
+                                            rocsparse_operation              trans_B,
+                                            rocsparse_int                    m,
+                                            rocsparse_int                    n,
+                                            rocsparse_int                    k,
+                                            const rocsparse_float_complex*   alpha,
+                                            const rocsparse_mat_descr        descr_A,
+                                            rocsparse_int                    nnz_A,
+                                            const rocsparse_float_complex*   csr_val_A,
+                                            const rocsparse_int*             csr_row_ptr_A,
+                                            const rocsparse_int*             csr_col_ind_A,
+                                            const rocsparse_mat_descr        descr_B,
+                                            rocsparse_int                    nnz_B,
+                                            const rocsparse_float_complex*   csr_val_B,
+                                            const rocsparse_int*             csr_row_ptr_B,
+                                            const rocsparse_int*             csr_col_ind_B,
+                                            const rocsparse_float_complex*   beta,
+                                            const rocsparse_mat_descr        descr_D,
+                                            rocsparse_int                    nnz_D,
+                                            const rocsparse_float_complex*   csr_val_D,
+                                            const rocsparse_int*             csr_row_ptr_D,
+                                            const rocsparse_int*             csr_col_ind_D,
+                                            const rocsparse_mat_descr        descr_C,
+                                            rocsparse_mat_info               info_C,
+                                            size_t                           memory_budget,
+                                            rocsparse_csrgemm_chunk_callback callback,
+                                            void*                            user_data);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_chunked(rocsparse_handle                 handle,
+                                            rocsparse_operation              trans_A,
+                                            rocsparse_operation              trans_B,
+                                            rocsparse_int                    m,
+                                            rocsparse_int                    n,
+                                            rocsparse_int                    k,
+                                            const rocsparse_double_complex*  alpha,
+                                            const rocsparse_mat_descr        descr_A,
+                                            rocsparse_int                    nnz_A,
+                                            const rocsparse_double_complex*  csr_val_A,
+                                            const rocsparse_int*             csr_row_ptr_A,
+                                            const rocsparse_int*             csr_col_ind_A,
+                                            const rocsparse_mat_descr        descr_B,
+                                            rocsparse_int                    nnz_B,
+                                            const rocsparse_double_complex*  csr_val_B,
+                                            const rocsparse_int*             csr_row_ptr_B,
+                                            const rocsparse_int*             csr_col_ind_B,
+                                            const rocsparse_double_complex*  beta,
+                                            const rocsparse_mat_descr        descr_D,
+                                            rocsparse_int                    nnz_D,
+                                            const rocsparse_double_complex*  csr_val_D,
+                                            const rocsparse_int*             csr_row_ptr_D,
+                                            const rocsparse_int*             csr_col_ind_D,
+                                            const rocsparse_mat_descr        descr_C,
+                                            rocsparse_mat_info               info_C,
+                                            size_t                           memory_budget,
+                                            rocsparse_csrgemm_chunk_callback callback,
+                                            void*                            user_data);
+/**@}*/
 
+/*! \ingroup extra_module
+*  \brief Masked sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  The masked sparse matrix sparse matrix multiplication computes only those entries of
+*  the product of the sparse \f$m \times k\f$ matrix \f$A\f$ and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, that are part of the sparsity pattern of the
+*  sparse \f$m \times n\f$ mask \f$M\f$, such that
+*  \f[
+*    C := M \circ (\alpha \cdot op(A) \cdot op(B)),
+*  \f]
+*  or, with \ref rocsparse_csrgemm_mask_complement, that are not part of the sparsity
+*  pattern of \f$M\f$, such that
+*  \f[
+*    C := \lnot M \circ (\alpha \cdot op(A) \cdot op(B)).
+*  \f]
+*  Only the sparsity pattern of \f$M\f$ is accessed. Products that are dropped by the
+*  mask are never accumulated, which avoids computing the full product, e.g. when
+*  counting triangles or computing products restricted to a known pattern.
+*
+*  \p rocsparse_csrgemm_masked_buffer_size returns the size of the temporary storage
+*  buffer that is required by rocsparse_csrgemm_masked_nnz(),
+*  rocsparse_scsrgemm_masked(), rocsparse_dcsrgemm_masked(), rocsparse_ccsrgemm_masked()
+*  and rocsparse_zcsrgemm_masked(). The temporary storage buffer must be allocated by the
+*  user.
+*
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  mask            whether the entries inside or outside of the mask are computed.
+*  @param[in]
+*  alg             algorithm that is used to compute the values of \f$C\f$.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$, \f$M\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$, \f$M\f$
+*                  and \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_M         descriptor of the sparse CSR matrix \f$M\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_M           number of non-zero entries of the sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  csr_row_ptr_M   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  csr_col_ind_M   array of \p nnz_M elements containing the column indices of the
+*                  sparse CSR matrix \f$M\f$.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrgemm_masked_nnz() and rocsparse_Xcsrgemm_masked().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_value \p trans_A, \p trans_B, \p mask or \p alg is
+*          invalid.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_M is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_M, \p csr_row_ptr_M, \p csr_col_ind_M or \p buffer_size is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none or
+*          \p trans_B != \ref rocsparse_operation_none.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_direction             dir,
-                                               rocsparse_int                   mb,
-                                               rocsparse_int                   nnzb,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* bsr_val,
-                                               const rocsparse_int*            bsr_row_ptr,
-                                               const rocsparse_int*            bsr_col_ind,
-                                               rocsparse_int                   block_dim,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size);
+rocsparse_status rocsparse_scsrgemm_masked_buffer_size(rocsparse_handle             handle,
+                                                       rocsparse_operation          trans_A,
+                                                       rocsparse_operation          trans_B,
+                                                       rocsparse_csrgemm_mask       mask,
+                                                       rocsparse_csrgemm_masked_alg alg,
+                                                       rocsparse_int                m,
+                                                       rocsparse_int                n,
+                                                       rocsparse_int                k,
+                                                       const rocsparse_mat_descr    descr_A,
+                                                       rocsparse_int                nnz_A,
+                                                       const rocsparse_int*         csr_row_ptr_A,
+                                                       const rocsparse_int*         csr_col_ind_A,
+                                                       const rocsparse_mat_descr    descr_B,
+                                                       rocsparse_int                nnz_B,
+                                                       const rocsparse_int*         csr_row_ptr_B,
+                                                       const rocsparse_int*         csr_col_ind_B,
+                                                       const rocsparse_mat_descr    descr_M,
+                                                       rocsparse_int                nnz_M,
+                                                       const rocsparse_int*         csr_row_ptr_M,
+                                                       const rocsparse_int*         csr_col_ind_M,
+                                                       size_t*                      buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_masked_buffer_size(rocsparse_handle             handle,
+                                                       rocsparse_operation          trans_A,
+                                                       rocsparse_operation          trans_B,
+                                                       rocsparse_csrgemm_mask       mask,
+                                                       rocsparse_csrgemm_masked_alg alg,
+                                                       rocsparse_int                m,
+                                                       rocsparse_int                n,
+                                                       rocsparse_int                k,
+                                                       const rocsparse_mat_descr    descr_A,
+                                                       rocsparse_int                nnz_A,
+                                                       const rocsparse_int*         csr_row_ptr_A,
+                                                       const rocsparse_int*         csr_col_ind_A,
+                                                       const rocsparse_mat_descr    descr_B,
+                                                       rocsparse_int                nnz_B,
+                                                       const rocsparse_int*         csr_row_ptr_B,
+                                                       const rocsparse_int*         csr_col_ind_B,
+                                                       const rocsparse_mat_descr    descr_M,
+                                                       rocsparse_int                nnz_M,
+                                                       const rocsparse_int*         csr_row_ptr_M,
+                                                       const rocsparse_int*         csr_col_ind_M,
+                                                       size_t*                      buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_masked_buffer_size(rocsparse_handle             handle,
+                                                       rocsparse_operation          trans_A,
+                                                       rocsparse_operation          trans_B,
+                                                       rocsparse_csrgemm_mask       mask,
+                                                       rocsparse_csrgemm_masked_alg alg,
+                                                       rocsparse_int                m,
+                                                       rocsparse_int                n,
+                                                       rocsparse_int                k,
+                                                       const rocsparse_mat_descr    descr_A,
+                                                       rocsparse_int                nnz_A,
+                                                       const rocsparse_int*         csr_row_ptr_A,
+                                                       const rocsparse_int*         csr_col_ind_A,
+                                                       const rocsparse_mat_descr    descr_B,
+                                                       rocsparse_int                nnz_B,
+                                                       const rocsparse_int*         csr_row_ptr_B,
+                                                       const rocsparse_int*         csr_col_ind_B,
+                                                       const rocsparse_mat_descr    descr_M,
+                                                       rocsparse_int                nnz_M,
+                                                       const rocsparse_int*         csr_row_ptr_M,
+                                                       const rocsparse_int*         csr_col_ind_M,
+                                                       size_t*                      buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_masked_buffer_size(rocsparse_handle             handle,
+                                                       rocsparse_operation          trans_A,
+                                                       rocsparse_operation          trans_B,
+                                                       rocsparse_csrgemm_mask       mask,
+                                                       rocsparse_csrgemm_masked_alg alg,
+                                                       rocsparse_int                m,
+                                                       rocsparse_int                n,
+                                                       rocsparse_int                k,
+                                                       const rocsparse_mat_descr    descr_A,
+                                                       rocsparse_int                nnz_A,
+                                                       const rocsparse_int*         csr_row_ptr_A,
+                                                       const rocsparse_int*         csr_col_ind_A,
+                                                       const rocsparse_mat_descr    descr_B,
+                                                       rocsparse_int                nnz_B,
+                                                       const rocsparse_int*         csr_row_ptr_B,
+                                                       const rocsparse_int*         csr_col_ind_B,
+                                                       const rocsparse_mat_descr    descr_M,
+                                                       rocsparse_int                nnz_M,
+                                                       const rocsparse_int*         csr_row_ptr_M,
+                                                       const rocsparse_int*         csr_col_ind_M,
+                                                       size_t*                      buffer_size);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_analysis performs the analysis step for rocsparse_sbsric0()
- *  rocsparse_dbsric0(), rocsparse_cbsric0(), and rocsparse_zbsric0(). It is expected
- *  that this function will be executed only once for a given matrix and particular
- *  operation type. The analysis meta data can be cleared by rocsparse_bsric0_clear().
- *
- *  \p rocsparse_bsric0_analysis can share its meta data with
- *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
- *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
- *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
- *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
- *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
- *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir             direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
- *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
- *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
-
+/*! \ingroup extra_module
+*  \brief Masked sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_masked_nnz computes the total CSR non-zero elements and the CSR
+*  row offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting masked product \f$C\f$, see rocsparse_scsrgemm_masked(). With
+*  \ref rocsparse_csrgemm_mask_keep, \f$C\f$ inherits the sparsity pattern of
+*  \f$M\f$. With \ref rocsparse_csrgemm_mask_complement, \f$C\f$ holds all entries of
+*  the sparsity pattern of \f$op(A) \cdot op(B)\f$ that are not part of \f$M\f$. It
+*  is assumed that \p csr_row_ptr_C has been allocated with size \p m+1. The required
+*  buffer size can be obtained by rocsparse_scsrgemm_masked_buffer_size(),
+*  rocsparse_dcsrgemm_masked_buffer_size(), rocsparse_ccsrgemm_masked_buffer_size() and
+*  rocsparse_zcsrgemm_masked_buffer_size(), respectively.
+*
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note The column indices of \f$B\f$ and \f$M\f$ need to be sorted.
+*  \note This function is blocking with respect to the host, if
+*        \ref rocsparse_pointer_mode_host is used.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  mask            whether the entries inside or outside of the mask are computed.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$, \f$M\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$, \f$M\f$
+*                  and \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_M         descriptor of the sparse CSR matrix \f$M\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_M           number of non-zero entries of the sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  csr_row_ptr_M   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  csr_col_ind_M   array of \p nnz_M elements containing the column indices of the
+*                  sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_Xcsrgemm_masked_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_value \p trans_A, \p trans_B or \p mask is invalid.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_M is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_M, \p csr_row_ptr_M, \p csr_col_ind_M, \p descr_C,
+*          \p csr_row_ptr_C, \p nnz_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none,
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or \p mask
+*          is \ref rocsparse_csrgemm_mask_complement, the pointer mode is
+*          \ref rocsparse_pointer_mode_host and the \ref rocsparse_graph_mode is
+*          \ref rocsparse_graph_mode_enabled.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_csrgemm_masked_nnz(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_csrgemm_mask    mask,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_B,
+                                              rocsparse_int             nnz_B,
+                                              const rocsparse_int*      csr_row_ptr_B,
+                                              const rocsparse_int*      csr_col_ind_B,
+                                              const rocsparse_mat_descr descr_M,
+                                              rocsparse_int             nnz_M,
+                                              const rocsparse_int*      csr_row_ptr_M,
+                                              const rocsparse_int*      csr_col_ind_M,
+                                              const rocsparse_mat_descr descr_C,
+                                              rocsparse_int*            csr_row_ptr_C,
+                                              rocsparse_int*            nnz_C,
+                                              void*                     temp_buffer);
 
+/*! \ingroup extra_module
+*  \brief Masked sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  The masked sparse matrix sparse matrix multiplication computes only those entries of
+*  the product of the sparse \f$m \times k\f$ matrix \f$A\f$ and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, that are part of the sparsity pattern of the
+*  sparse \f$m \times n\f$ mask \f$M\f$, such that
+*  \f[
+*    C := M \circ (\alpha \cdot op(A) \cdot op(B)),
+*  \f]
+*  or, with \ref rocsparse_csrgemm_mask_complement, that are not part of the sparsity
+*  pattern of \f$M\f$, such that
+*  \f[
+*    C := \lnot M \circ (\alpha \cdot op(A) \cdot op(B)).
+*  \f]
+*  Only the sparsity pattern of \f$M\f$ is accessed. Products that are dropped by the
+*  mask are never accumulated, which avoids computing the full product, e.g. when
+*  counting triangles or computing products restricted to a known pattern.
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled by
+*  rocsparse_csrgemm_masked_nnz() and that \p csr_val_C and \p csr_col_ind_C are
+*  allocated by the user. The values of \f$C\f$ are computed by one of the following
+*  algorithms
+*  - \ref rocsparse_csrgemm_masked_alg_dot computes each entry of \f$C\f$ as dot
+*    product of a row of \f$A\f$ and a column of \f$B\f$. This requires a transposed
+*    copy of \f$B\f$ in the temporary storage buffer, and is efficient if the mask is
+*    sparse compared to the product.
+*  - \ref rocsparse_csrgemm_masked_alg_row accumulates the rows of \f$B\f$ into the rows
+*    of \f$C\f$, where the position of each product is looked up in the sparsity
+*    pattern of \f$C\f$ and products outside of the pattern are dropped.
+*  - \ref rocsparse_csrgemm_masked_alg_default selects the dot product algorithm, if the
+*    estimated number of operations is lower than the number of intermediate products,
+*    and the row-wise algorithm otherwise. The row-wise algorithm is always selected
+*    with \ref rocsparse_csrgemm_mask_complement.
+*
+*  \p alg has to match the algorithm that has been passed to
+*  rocsparse_Xcsrgemm_masked_buffer_size(). Both algorithms do not use atomics and
+*  always produce bitwise reproducible results.
+*
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note The column indices of \f$A\f$, \f$B\f$ and \f$M\f$ need to be sorted.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  mask            whether the entries inside or outside of the mask are computed.
+*  @param[in]
+*  alg             algorithm that is used to compute the values of \f$C\f$.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$, \f$M\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$, \f$M\f$
+*                  and \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_M         descriptor of the sparse CSR matrix \f$M\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_M           number of non-zero entries of the sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  csr_row_ptr_M   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  csr_col_ind_M   array of \p nnz_M elements containing the column indices of the
+*                  sparse CSR matrix \f$M\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_Xcsrgemm_masked_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_value \p trans_A, \p trans_B, \p mask or \p alg is
+*          invalid.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_M is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
+*          \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B, \p csr_val_B,
+*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_M, \p csr_row_ptr_M,
+*          \p csr_col_ind_M, \p descr_C, \p csr_val_C, \p csr_row_ptr_C,
+*          \p csr_col_ind_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0_analysis(rocsparse_handle               handle,
-                                            rocsparse_direction            dir,
-                                            rocsparse_int                  mb,
-                                            rocsparse_int                  nnzb,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* bsr_val,
-                                            const rocsparse_int*           bsr_row_ptr,
-                                            const rocsparse_int*           bsr_col_ind,
-                                            rocsparse_int                  block_dim,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer);
+rocsparse_status rocsparse_scsrgemm_masked(rocsparse_handle             handle,
+                                           rocsparse_operation          trans_A,
+                                           rocsparse_operation          trans_B,
+                                           rocsparse_csrgemm_mask       mask,
+                                           rocsparse_csrgemm_masked_alg alg,
+                                           rocsparse_int                m,
+                                           rocsparse_int                n,
+                                           rocsparse_int                k,
+                                           const float*                 alpha,
+                                           const rocsparse_mat_descr    descr_A,
+                                           rocsparse_int                nnz_A,
+                                           const float*                 csr_val_A,
+                                           const rocsparse_int*         csr_row_ptr_A,
+                                           const rocsparse_int*         csr_col_ind_A,
+                                           const rocsparse_mat_descr    descr_B,
+                                           rocsparse_int                nnz_B,
+                                           const float*                 csr_val_B,
+                                           const rocsparse_int*         csr_row_ptr_B,
+                                           const rocsparse_int*         csr_col_ind_B,
+                                           const rocsparse_mat_descr    descr_M,
+                                           rocsparse_int                nnz_M,
+                                           const rocsparse_int*         csr_row_ptr_M,
+                                           const rocsparse_int*         csr_col_ind_M,
+                                           const rocsparse_mat_descr    descr_C,
+                                           float*                       csr_val_C,
+                                           const rocsparse_int*         csr_row_ptr_C,
+                                           rocsparse_int*               csr_col_ind_C,
+                                           void*                        temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_masked(rocsparse_handle             handle,
+                                           rocsparse_operation          trans_A,
+                                           rocsparse_operation          trans_B,
+                                           rocsparse_csrgemm_mask       mask,
+                                           rocsparse_csrgemm_masked_alg alg,
+                                           rocsparse_int                m,
+                                           rocsparse_int                n,
+                                           rocsparse_int                k,
+                                           const double*                alpha,
+                                           const rocsparse_mat_descr    descr_A,
+                                           rocsparse_int                nnz_A,
+                                           const double*                csr_val_A,
+                                           const rocsparse_int*         csr_row_ptr_A,
+                                           const rocsparse_int*         csr_col_ind_A,
+                                           const rocsparse_mat_descr    descr_B,
+                                           rocsparse_int                nnz_B,
+                                           const double*                csr_val_B,
+                                           const rocsparse_int*         csr_row_ptr_B,
+                                           const rocsparse_int*         csr_col_ind_B,
+                                           const rocsparse_mat_descr    descr_M,
+                                           rocsparse_int                nnz_M,
+                                           const rocsparse_int*         csr_row_ptr_M,
+                                           const rocsparse_int*         csr_col_ind_M,
+                                           const rocsparse_mat_descr    descr_C,
+                                           double*                      csr_val_C,
+                                           const rocsparse_int*         csr_row_ptr_C,
+                                           rocsparse_int*               csr_col_ind_C,
+                                           void*                        temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_masked(rocsparse_handle               handle,
+                                           rocsparse_operation            trans_A,
+                                           rocsparse_operation            trans_B,
+                                           rocsparse_csrgemm_mask         mask,
+                                           rocsparse_csrgemm_masked_alg   alg,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  n,
+                                           rocsparse_int                  k,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr_A,
+                                           rocsparse_int                  nnz_A,
+                                           const rocsparse_float_complex* csr_val_A,
+                                           const rocsparse_int*           csr_row_ptr_A,
+                                           const rocsparse_int*           csr_col_ind_A,
+                                           const rocsparse_mat_descr      descr_B,
+                                           rocsparse_int                  nnz_B,
+                                           const rocsparse_float_complex* csr_val_B,
+                                           const rocsparse_int*           csr_row_ptr_B,
+                                           const rocsparse_int*           csr_col_ind_B,
+                                           const rocsparse_mat_descr      descr_M,
+                                           rocsparse_int                  nnz_M,
+                                           const rocsparse_int*           csr_row_ptr_M,
+                                           const rocsparse_int*           csr_col_ind_M,
+                                           const rocsparse_mat_descr      descr_C,
+                                           rocsparse_float_complex*       csr_val_C,
+                                           const rocsparse_int*           csr_row_ptr_C,
+                                           rocsparse_int*                 csr_col_ind_C,
+                                           void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                handle,
-                                            rocsparse_direction             dir,
-                                            rocsparse_int                   mb,
-                                            rocsparse_int                   nnzb,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* bsr_val,
-                                            const rocsparse_int*            bsr_row_ptr,
-                                            const rocsparse_int*            bsr_col_ind,
-                                            rocsparse_int                   block_dim,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer);
+rocsparse_status rocsparse_zcsrgemm_masked(rocsparse_handle                handle,
+                                           rocsparse_operation             trans_A,
+                                           rocsparse_operation             trans_B,
+                                           rocsparse_csrgemm_mask          mask,
+                                           rocsparse_csrgemm_masked_alg    alg,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   n,
+                                           rocsparse_int                   k,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr_A,
+                                           rocsparse_int                   nnz_A,
+                                           const rocsparse_double_complex* csr_val_A,
+                                           const rocsparse_int*            csr_row_ptr_A,
+                                           const rocsparse_int*            csr_col_ind_A,
+                                           const rocsparse_mat_descr       descr_B,
+                                           rocsparse_int                   nnz_B,
+                                           const rocsparse_double_complex* csr_val_B,
+                                           const rocsparse_int*            csr_row_ptr_B,
+                                           const rocsparse_int*            csr_col_ind_B,
+                                           const rocsparse_mat_descr       descr_M,
+                                           rocsparse_int                   nnz_M,
+                                           const rocsparse_int*            csr_row_ptr_M,
+                                           const rocsparse_int*            csr_col_ind_M,
+                                           const rocsparse_mat_descr       descr_C,
+                                           rocsparse_double_complex*       csr_val_C,
+                                           const rocsparse_int*            csr_row_ptr_C,
+                                           rocsparse_int*                  csr_col_ind_C,
+                                           void*                           temp_buffer);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_clear deallocates all memory that was allocated by
- *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis()
- *  or rocsparse_zbsric0_analysis(). This is especially useful, if memory is an issue and
- *  the analysis data is not required for further computation.
- *
- *  \note
- *  Calling \p rocsparse_bsric0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
+/*! \ingroup extra_module
+*  \brief Galerkin triple product using CSR storage format
+*
+*  \details
+*  The Galerkin triple product computes the coarse operator
+*  \f[
+*    C := R \cdot A \cdot P,
+*  \f]
+*  of the sparse \f$m \times n\f$ restriction matrix \f$R\f$, the sparse
+*  \f$n \times n\f$ matrix \f$A\f$ and the sparse \f$n \times k\f$ prolongation
+*  matrix \f$P\f$, all defined in CSR storage format, as it is required to set up the
+*  levels of an algebraic multigrid hierarchy. In contrast to two chained calls to
+*  rocsparse_scsrgemm(), the intermediate product \f$A \cdot P\f$ is never stored.
+*  Instead, each row of \f$C\f$ expands the rows of \f$A \cdot P\f$ that it requires on
+*  the fly.
+*
+*  The computation is split into the stages rocsparse_csrrap_buffer_size(),
+*  rocsparse_csrrap_nnz(), rocsparse_csrrap_symbolic() and rocsparse_Xcsrrap_numeric().
+*  The symbolic stages only depend on the sparsity patterns of \f$R\f$, \f$A\f$ and
+*  \f$P\f$. If only the values change, e.g. in a time dependent simulation, the
+*  coarse operator can be recomputed by rocsparse_Xcsrrap_numeric() only.
+*
+*  \p rocsparse_csrrap_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_csrrap_nnz(). The temporary storage buffer must be allocated
+*  by the user.
+*
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$, number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of
+*                  the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrrap_nnz().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_row_ptr_R, \p csr_col_ind_R,
+*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_P, \p csr_row_ptr_P,
+*          \p csr_col_ind_P or \p buffer_size is invalid.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
-
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0 computes the incomplete Cholesky factorization with 0 fill-ins
- *  and no pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
- *  \f[
- *    A \approx LL^T
- *  \f]
- *
- *  \p rocsparse_bsric0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(),
- *  rocsparse_cbsric0_buffer_size() or rocsparse_zbsric0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_sbsric0_analysis(),
- *  rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis() or rocsparse_zbsric0_analysis().
- *  \p rocsparse_bsric0 reports the first zero pivot (either numerical or structural zero).
- *  The zero pivot status can be obtained by calling rocsparse_bsric0_zero_pivot().
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir             direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[inout]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
- *              or \p bsr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
- *  storage format. The following example computes the incomplete Cholesky factorization
- *  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
- *
- *      // Create matrix descriptor for L
- *      rocsparse_mat_descr descr_L;
- *      rocsparse_create_mat_descr(&descr_L);
- *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
- *
- *      // Create matrix descriptor for L'
- *      rocsparse_mat_descr descr_Lt;
- *      rocsparse_create_mat_descr(&descr_Lt);
- *      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_Lt;
- *      rocsparse_dbsric0_buffer_size(handle,
- *                                     rocsparse_direction_row,
- *                                     mb,
- *                                     nnzb,
- *                                     descr_M,
- *                                     bsr_val,
- *                                     bsr_row_ptr,
- *                                     bsr_col_ind,
- *                                     block_dim,
- *                                     info,
- *                                     &buffer_size_M);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_none,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_L,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_transpose,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_Lt,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_Lt);
- *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dbsric0_analysis(handle,
- *                                  rocsparse_direction_row,
- *                                  mb,
- *                                  nnzb,
- *                                  descr_M,
- *                                  bsr_val,
- *                                  bsr_row_ptr,
- *                                  bsr_col_ind,
- *                                  block_dim,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_none,
- *                                mb,
- *                                nnzb,
- *                                descr_L,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
- *                                block_dim,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_transpose,
- *                                mb,
- *                                nnzb,
- *                                descr_Lt,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
- *                                block_dim,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *
- *      // Check for zero pivot
- *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
- *                                                                    info,
- *                                                                    &position))
- *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
- *      }
- *
- *      // Compute incomplete Cholesky factorization M = LL'
- *      rocsparse_dbsric0(handle,
- *                         rocsparse_direction_row,
- *                         mb,
- *                         nnzb,
- *                         descr_M,
- *                         bsr_val,
- *                         bsr_row_ptr,
- *                         bsr_col_ind,
- *                         block_dim,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
- *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
- *
- *      // Solve Lz = x
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_none,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_L,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
- *
- *      // Solve L'y = z
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_transpose,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_Lt,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
- *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_Lt);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              size_t*                   buffer_size);
 
+/*! \ingroup extra_module
+*  \brief Galerkin triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting triple product \f$C := R \cdot A \cdot P\f$, see
+*  rocsparse_scsrrap_numeric(). It is assumed that \p csr_row_ptr_C has been allocated
+*  with size \p m+1. The required buffer size can be obtained by
+*  rocsparse_csrrap_buffer_size().
+*
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note The column indices of \f$P\f$ need to be sorted.
+*  \note This function is blocking with respect to the host, if
+*        \ref rocsparse_pointer_mode_host is used.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$, number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of
+*                  the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_csrrap_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_row_ptr_R, \p csr_col_ind_R,
+*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_P, \p csr_row_ptr_P,
+*          \p csr_col_ind_P, \p descr_C, \p csr_row_ptr_C, \p nnz_C or \p temp_buffer is
+*          invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*          pointer mode is \ref rocsparse_pointer_mode_host and the
+*          \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             k,
+                                      const rocsparse_mat_descr descr_R,
+                                      rocsparse_int             nnz_R,
+                                      const rocsparse_int*      csr_row_ptr_R,
+                                      const rocsparse_int*      csr_col_ind_R,
+                                      const rocsparse_mat_descr descr_A,
+                                      rocsparse_int             nnz_A,
+                                      const rocsparse_int*      csr_row_ptr_A,
+                                      const rocsparse_int*      csr_col_ind_A,
+                                      const rocsparse_mat_descr descr_P,
+                                      rocsparse_int             nnz_P,
+                                      const rocsparse_int*      csr_row_ptr_P,
+                                      const rocsparse_int*      csr_col_ind_P,
+                                      const rocsparse_mat_descr descr_C,
+                                      rocsparse_int*            csr_row_ptr_C,
+                                      rocsparse_int*            nnz_C,
+                                      void*                     temp_buffer);
 
+/*! \ingroup extra_module
+*  \brief Galerkin triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap_symbolic computes the column indices of the resulting triple
+*  product \f$C := R \cdot A \cdot P\f$, see rocsparse_scsrrap_numeric(). It is assumed
+*  that \p csr_row_ptr_C has already been filled by rocsparse_csrrap_nnz() and that
+*  \p csr_col_ind_C has been allocated by the user. The column indices of each row of
+*  \f$C\f$ are sorted.
+*
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note The column indices of \f$P\f$ need to be sorted.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$, number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of
+*                  the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_row_ptr_R, \p csr_col_ind_R,
+*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_P, \p csr_row_ptr_P,
+*          \p csr_col_ind_P, \p descr_C, \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csrrap_symbolic(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const rocsparse_mat_descr descr_R,
+                                           rocsparse_int             nnz_R,
+                                           const rocsparse_int*      csr_row_ptr_R,
+                                           const rocsparse_int*      csr_col_ind_R,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_P,
+                                           rocsparse_int             nnz_P,
+                                           const rocsparse_int*      csr_row_ptr_P,
+                                           const rocsparse_int*      csr_col_ind_P,
+                                           const rocsparse_mat_descr descr_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_sbsrilu0(),
- *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0() or rocsparse_zbsrilu0() computation.
- *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
- *  index base as the BSR matrix.
- *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
- *
- *  \note
- *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
- *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
- *  invertible (numerical zero).
- *
- *  \note \p rocsparse_bsrilu0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
+/*! \ingroup extra_module
+*  \brief Galerkin triple product using CSR storage format
+*
+*  \details
+*  The Galerkin triple product computes the coarse operator
+*  \f[
+*    C := R \cdot A \cdot P,
+*  \f]
+*  of the sparse \f$m \times n\f$ restriction matrix \f$R\f$, the sparse
+*  \f$n \times n\f$ matrix \f$A\f$ and the sparse \f$n \times k\f$ prolongation
+*  matrix \f$P\f$, all defined in CSR storage format, as it is required to set up the
+*  levels of an algebraic multigrid hierarchy. In contrast to two chained calls to
+*  rocsparse_scsrgemm(), the intermediate product \f$A \cdot P\f$ is never stored.
+*  Instead, each row of \f$C\f$ expands the rows of \f$A \cdot P\f$ that it requires on
+*  the fly.
+*
+*  The computation is split into the stages rocsparse_csrrap_buffer_size(),
+*  rocsparse_csrrap_nnz(), rocsparse_csrrap_symbolic() and rocsparse_Xcsrrap_numeric().
+*  The symbolic stages only depend on the sparsity patterns of \f$R\f$, \f$A\f$ and
+*  \f$P\f$. If only the values change, e.g. in a time dependent simulation, the
+*  coarse operator can be recomputed by rocsparse_Xcsrrap_numeric() only.
+*
+*  \p rocsparse_csrrap_numeric computes the values of \f$C\f$ for the sparsity pattern
+*  that has been computed by rocsparse_csrrap_nnz() and rocsparse_csrrap_symbolic().
+*  Each row of \f$C\f$ is accumulated in a fixed order without atomics, such that the
+*  result is bitwise reproducible.
+*
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*  \note This function supports \ref rocsparse_graph_mode_enabled.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$R\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$R\f$, number of rows
+*                  and columns of the sparse CSR matrix \f$A\f$ and number of rows of
+*                  the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_val_R       array of \p nnz_R elements of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_val_P       array of \p nnz_P elements of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p n+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_val_R, \p csr_row_ptr_R,
+*          \p csr_col_ind_R, \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A,
+*          \p descr_P, \p csr_val_P, \p csr_row_ptr_P, \p csr_col_ind_P, \p descr_C,
+*          \p csr_val_C, \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
+rocsparse_status rocsparse_scsrrap_numeric(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const rocsparse_mat_descr descr_R,
+                                           rocsparse_int             nnz_R,
+                                           const float*              csr_val_R,
+                                           const rocsparse_int*      csr_row_ptr_R,
+                                           const rocsparse_int*      csr_col_ind_R,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const float*              csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_P,
+                                           rocsparse_int             nnz_P,
+                                           const float*              csr_val_P,
+                                           const rocsparse_int*      csr_row_ptr_P,
+                                           const rocsparse_int*      csr_col_ind_P,
+                                           const rocsparse_mat_descr descr_C,
+                                           float*                    csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           const rocsparse_int*      csr_col_ind_C);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_numeric_boost enables the user to replace a numerical value in
- *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
- *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
- *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
- *
- *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
- *  setting \p enable_boost to 0.
- *
- *  \note \p tol and \p boost_val can be in host or device memory.
- *
- *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  info            structure that holds the information collected during the analysis step.
- *  @param[in]
- *  enable_boost    enable/disable numeric boost.
- *  @param[in]
- *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
- *  @param[in]
- *  boost_val       boost value to replace a numerical value.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
- *              is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
-/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const float*       boost_tol,
-                                                  const float*       boost_val);
+rocsparse_status rocsparse_dcsrrap_numeric(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const rocsparse_mat_descr descr_R,
+                                           rocsparse_int             nnz_R,
+                                           const double*             csr_val_R,
+                                           const rocsparse_int*      csr_row_ptr_R,
+                                           const rocsparse_int*      csr_col_ind_R,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const double*             csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_P,
+                                           rocsparse_int             nnz_P,
+                                           const double*             csr_val_P,
+                                           const rocsparse_int*      csr_row_ptr_P,
+                                           const rocsparse_int*      csr_col_ind_P,
+                                           const rocsparse_mat_descr descr_C,
+                                           double*                   csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           const rocsparse_int*      csr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const double*      boost_tol,
-                                                  const double*      boost_val);
+rocsparse_status rocsparse_ccsrrap_numeric(rocsparse_handle               handle,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  n,
+                                           rocsparse_int                  k,
+                                           const rocsparse_mat_descr      descr_R,
+                                           rocsparse_int                  nnz_R,
+                                           const rocsparse_float_complex* csr_val_R,
+                                           const rocsparse_int*           csr_row_ptr_R,
+                                           const rocsparse_int*           csr_col_ind_R,
+                                           const rocsparse_mat_descr      descr_A,
+                                           rocsparse_int                  nnz_A,
+                                           const rocsparse_float_complex* csr_val_A,
+                                           const rocsparse_int*           csr_row_ptr_A,
+                                           const rocsparse_int*           csr_col_ind_A,
+                                           const rocsparse_mat_descr      descr_P,
+                                           rocsparse_int                  nnz_P,
+                                           const rocsparse_float_complex* csr_val_P,
+                                           const rocsparse_int*           csr_row_ptr_P,
+                                           const rocsparse_int*           csr_col_ind_P,
+                                           const rocsparse_mat_descr      descr_C,
+                                           rocsparse_float_complex*       csr_val_C,
+                                           const rocsparse_int*           csr_row_ptr_C,
+                                           const rocsparse_int*           csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrrap_numeric(rocsparse_handle                handle,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   n,
+                                           rocsparse_int                   k,
+                                           const rocsparse_mat_descr       descr_R,
+                                           rocsparse_int                   nnz_R,
+                                           const rocsparse_double_complex* csr_val_R,
+                                           const rocsparse_int*            csr_row_ptr_R,
+                                           const rocsparse_int*            csr_col_ind_R,
+                                           const rocsparse_mat_descr       descr_A,
+                                           rocsparse_int                   nnz_A,
+                                           const rocsparse_double_complex* csr_val_A,
+                                           const rocsparse_int*            csr_row_ptr_A,
+                                           const rocsparse_int*            csr_col_ind_A,
+                                           const rocsparse_mat_descr       descr_P,
+                                           rocsparse_int                   nnz_P,
+                                           const rocsparse_double_complex* csr_val_P,
+                                           const rocsparse_int*            csr_row_ptr_P,
+                                           const rocsparse_int*            csr_col_ind_P,
+                                           const rocsparse_mat_descr       descr_C,
+                                           rocsparse_double_complex*       csr_val_C,
+                                           const rocsparse_int*            csr_row_ptr_C,
+                                           const rocsparse_int*            csr_col_ind_C);
+/**@}*/
 
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix addition using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrgeam_nnz computes the total BSR non-zero blocks and the BSR block row
+*  offsets, that point to the start of every block row of the sparse BSR matrix, of the
+*  resulting matrix C. It is assumed that \p bsr_row_ptr_C has been allocated with
+*  size \p mb + 1.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             matrix storage of BSR blocks.
+*  @param[in]
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_row_ptr_B   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
+*  @param[out]
+*  nnzb_C          pointer to the number of non-zero blocks of the sparse BSR
+*                  matrix \f$C\f$. \p nnzb_C can be a host or device pointer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p block_dim, \p nnzb_A or
+*          \p nnzb_B is invalid.
+*  \retval rocsparse_status_invalid_value \p dir is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p bsr_row_ptr_A,
+*          \p bsr_col_ind_A, \p descr_B, \p bsr_row_ptr_B, \p bsr_col_ind_B,
+*          \p descr_C, \p bsr_row_ptr_C or \p nnzb_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                  rocsparse_mat_info             info,
-                                                  int                            enable_boost,
-                                                  const float*                   boost_tol,
-                                                  const rocsparse_float_complex* boost_val);
+rocsparse_status rocsparse_bsrgeam_nnz(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nb,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnzb_A,
+                                       const rocsparse_int*      bsr_row_ptr_A,
+                                       const rocsparse_int*      bsr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnzb_B,
+                                       const rocsparse_int*      bsr_row_ptr_B,
+                                       const rocsparse_int*      bsr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            bsr_row_ptr_C,
+                                       rocsparse_int*            nnzb_C);
 
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix addition using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrgeam multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$mb \times nb\f$ block matrix \f$A\f$, defined in BSR storage format, multiplies the
+*  scalar \f$\beta\f$ with the sparse \f$mb \times nb\f$ block matrix \f$B\f$, defined in
+*  BSR storage format, and adds both resulting matrices to obtain the sparse
+*  \f$mb \times nb\f$ block matrix \f$C\f$, defined in BSR storage format, such that
+*  \f[
+*    C := \alpha \cdot A + \beta \cdot B.
+*  \f]
+*
+*  It is assumed that \p bsr_row_ptr_C has already been filled and that \p bsr_val_C and
+*  \p bsr_col_ind_C are allocated by the user. \p bsr_row_ptr_C and allocation size of
+*  \p bsr_col_ind_C and \p bsr_val_C is defined by the number of non-zero blocks of
+*  the sparse BSR matrix C. Both can be obtained by rocsparse_bsrgeam_nnz(). Blocks are
+*  added as a whole, thus a block of \f$C\f$ is stored, if the corresponding block
+*  exists in \f$A\f$ or \f$B\f$.
+*
+*  \note Both scalars \f$\alpha\f$ and \f$beta\f$ have to be valid.
+*  \note \f$A\f$, \f$B\f$ and \f$C\f$ need to share the same block storage direction
+*        \p dir and block dimension \p block_dim.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             matrix storage of BSR blocks.
+*  @param[in]
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_val_A       array of \p nnzb_A blocks of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_val_B       array of \p nnzb_B blocks of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_row_ptr_B   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_val_C       array of blocks of the sparse BSR matrix \f$C\f$.
+*  @param[in]
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
+*  @param[out]
+*  bsr_col_ind_C   array of elements containing the block column indices of the
+*                  sparse BSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p block_dim, \p nnzb_A or
+*          \p nnzb_B is invalid.
+*  \retval rocsparse_status_invalid_value \p dir is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p bsr_val_A,
+*          \p bsr_row_ptr_A, \p bsr_col_ind_A, \p beta, \p descr_B, \p bsr_val_B,
+*          \p bsr_row_ptr_B, \p bsr_col_ind_B, \p descr_C, \p bsr_val_C,
+*          \p bsr_row_ptr_C or \p bsr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                  rocsparse_mat_info              info,
-                                                  int                             enable_boost,
-                                                  const double*                   boost_tol,
-                                                  const rocsparse_double_complex* boost_val);
+rocsparse_status rocsparse_sbsrgeam(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             block_dim,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnzb_A,
+                                    const float*              bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnzb_B,
+                                    const float*              bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dsbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                   rocsparse_mat_info info,
-                                                   int                enable_boost,
-                                                   const double*      boost_tol,
-                                                   const float*       boost_val);
+rocsparse_status rocsparse_dbsrgeam(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             block_dim,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnzb_A,
+                                    const double*             bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnzb_B,
+                                    const double*             bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcbsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                   rocsparse_mat_info             info,
-                                                   int                            enable_boost,
-                                                   const double*                  boost_tol,
-                                                   const rocsparse_float_complex* boost_val);
+rocsparse_status rocsparse_cbsrgeam(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
+                                    rocsparse_int                  mb,
+                                    rocsparse_int                  nb,
+                                    rocsparse_int                  block_dim,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnzb_A,
+                                    const rocsparse_float_complex* bsr_val_A,
+                                    const rocsparse_int*           bsr_row_ptr_A,
+                                    const rocsparse_int*           bsr_col_ind_A,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnzb_B,
+                                    const rocsparse_float_complex* bsr_val_B,
+                                    const rocsparse_int*           bsr_row_ptr_B,
+                                    const rocsparse_int*           bsr_col_ind_B,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       bsr_val_C,
+                                    const rocsparse_int*           bsr_row_ptr_C,
+                                    rocsparse_int*                 bsr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrgeam(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
+                                    rocsparse_int                   mb,
+                                    rocsparse_int                   nb,
+                                    rocsparse_int                   block_dim,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnzb_A,
+                                    const rocsparse_double_complex* bsr_val_A,
+                                    const rocsparse_int*            bsr_row_ptr_A,
+                                    const rocsparse_int*            bsr_col_ind_A,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnzb_B,
+                                    const rocsparse_double_complex* bsr_val_B,
+                                    const rocsparse_int*            bsr_row_ptr_B,
+                                    const rocsparse_int*            bsr_col_ind_B,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       bsr_val_C,
+                                    const rocsparse_int*            bsr_row_ptr_C,
+                                    rocsparse_int*                  bsr_col_ind_C);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(), rocsparse_sbsrilu0(),
- *  rocsparse_dbsrilu0(), rocsparse_sbsrilu0() and rocsparse_dbsrilu0(). The temporary
- *  storage buffer must be allocated by the user. The size of the temporary storage
- *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
- *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
- *  rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(), rocsparse_cbsric0_buffer_size()
- *  and rocsparse_zbsric0_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *              rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
- *              rocsparse_sbsrilu0(), rocsparse_dbsrilu0(), rocsparse_cbsrilu0()
- *              and rocsparse_zbsrilu0().
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
-/**@{*/
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrgemm_nnz computes the total BSR non-zero blocks and the BSR block row
+*  offsets, that point to the start of every block row of the sparse BSR matrix, of the
+*  resulting multiplied matrix C. It is assumed that \p bsr_row_ptr_C has been allocated
+*  with size \p mb + 1.
+*
+*  \note
+*  This function is blocking with respect to the host, if \p nnzb_C is a host pointer.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note
+*  The block column indices of \f$B\f$ need to be sorted.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             matrix storage of BSR blocks.
+*  @param[in]
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$ and \f$C\f$.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrix \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  kb              number of block columns of the sparse BSR matrix \f$A\f$ and number of
+*                  block rows of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_row_ptr_B   array of \p kb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
+*  @param[out]
+*  nnzb_C          pointer to the number of non-zero blocks of the sparse BSR
+*                  matrix \f$C\f$. \p nnzb_C can be a host or device pointer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p kb, \p block_dim, \p nnzb_A or
+*          \p nnzb_B is invalid.
+*  \retval rocsparse_status_invalid_value \p dir is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p bsr_row_ptr_A,
+*          \p bsr_col_ind_A, \p descr_B, \p bsr_row_ptr_B, \p bsr_col_ind_B,
+*          \p descr_C, \p bsr_row_ptr_C or \p nnzb_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*          \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled and either
+*          the pointer mode is \ref rocsparse_pointer_mode_host or the scan of the
+*          block row pointers does not fit the internal workspace of the handle.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_direction       dir,
-                                                rocsparse_int             mb,
-                                                rocsparse_int             nnzb,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              bsr_val,
-                                                const rocsparse_int*      bsr_row_ptr,
-                                                const rocsparse_int*      bsr_col_ind,
-                                                rocsparse_int             block_dim,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_bsrgemm_nnz(rocsparse_handle          handle,
+                                       rocsparse_direction       dir,
+                                       rocsparse_int             mb,
+                                       rocsparse_int             nb,
+                                       rocsparse_int             kb,
+                                       rocsparse_int             block_dim,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnzb_A,
+                                       const rocsparse_int*      bsr_row_ptr_A,
+                                       const rocsparse_int*      bsr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnzb_B,
+                                       const rocsparse_int*      bsr_row_ptr_B,
+                                       const rocsparse_int*      bsr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            bsr_row_ptr_C,
+                                       rocsparse_int*            nnzb_C);
 
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using BSR storage format
+*
+*  \details
+*  \p rocsparse_bsrgemm multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$mb \times kb\f$ block matrix \f$A\f$, defined in BSR storage format, and the sparse
+*  \f$kb \times nb\f$ block matrix \f$B\f$, defined in BSR storage format, to obtain the
+*  sparse \f$mb \times nb\f$ block matrix \f$C\f$, defined in BSR storage format, such
+*  that
+*  \f[
+*    C := \alpha \cdot A \cdot B.
+*  \f]
+*
+*  It is assumed that \p bsr_row_ptr_C has already been filled and that \p bsr_val_C and
+*  \p bsr_col_ind_C are allocated by the user. \p bsr_row_ptr_C and allocation size of
+*  \p bsr_col_ind_C and \p bsr_val_C is defined by the number of non-zero blocks of
+*  the sparse BSR matrix C. Both can be obtained by rocsparse_bsrgemm_nnz(). The block
+*  column indices of each block row of \f$C\f$ are sorted.
+*
+*  Each block of \f$C\f$ is computed by a sequence of dense block times block products.
+*  For the block dimensions 2, 3, 4, 5, 8 and 16, the rows of the blocks of \f$C\f$ are
+*  accumulated in registers. Blocks are multiplied in a fixed order, such that the
+*  results are deterministic.
+*
+*  \note \f$A\f$, \f$B\f$ and \f$C\f$ need to share the same block storage direction
+*        \p dir and block dimension \p block_dim.
+*  \note The block column indices of \f$B\f$ need to be sorted.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  dir             matrix storage of BSR blocks.
+*  @param[in]
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$ and \f$C\f$.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrix \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  kb              number of block columns of the sparse BSR matrix \f$A\f$ and number of
+*                  block rows of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_val_A       array of \p nnzb_A blocks of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_val_B       array of \p nnzb_B blocks of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_row_ptr_B   array of \p kb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  bsr_val_C       array of blocks of the sparse BSR matrix \f$C\f$.
+*  @param[in]
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
+*  @param[out]
+*  bsr_col_ind_C   array of elements containing the block column indices of the
+*                  sparse BSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p kb, \p block_dim, \p nnzb_A or
+*          \p nnzb_B is invalid.
+*  \retval rocsparse_status_invalid_value \p dir is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p bsr_val_A,
+*          \p bsr_row_ptr_A, \p bsr_col_ind_A, \p descr_B, \p bsr_val_B,
+*          \p bsr_row_ptr_B, \p bsr_col_ind_B, \p descr_C, \p bsr_val_C,
+*          \p bsr_row_ptr_C or \p bsr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_direction       dir,
-                                                rocsparse_int             mb,
-                                                rocsparse_int             nnzb,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             bsr_val,
-                                                const rocsparse_int*      bsr_row_ptr,
-                                                const rocsparse_int*      bsr_col_ind,
-                                                rocsparse_int             block_dim,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_sbsrgemm(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             block_dim,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnzb_A,
+                                    const float*              bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnzb_B,
+                                    const float*              bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_direction            dir,
-                                                rocsparse_int                  mb,
-                                                rocsparse_int                  nnzb,
-                                                const rocsparse_mat_descr      descr,
-                                                const rocsparse_float_complex* bsr_val,
-                                                const rocsparse_int*           bsr_row_ptr,
-                                                const rocsparse_int*           bsr_col_ind,
-                                                rocsparse_int                  block_dim,
-                                                rocsparse_mat_info             info,
-                                                size_t*                        buffer_size);
+rocsparse_status rocsparse_dbsrgemm(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             block_dim,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnzb_A,
+                                    const double*             bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnzb_B,
+                                    const double*             bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_direction             dir,
-                                                rocsparse_int                   mb,
-                                                rocsparse_int                   nnzb,
-                                                const rocsparse_mat_descr       descr,
-                                                const rocsparse_double_complex* bsr_val,
-                                                const rocsparse_int*            bsr_row_ptr,
-                                                const rocsparse_int*            bsr_col_ind,
-                                                rocsparse_int                   block_dim,
-                                                rocsparse_mat_info              info,
-                                                size_t*                         buffer_size);
-/**@}*/
+rocsparse_status rocsparse_cbsrgemm(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
+                                    rocsparse_int                  mb,
+                                    rocsparse_int                  nb,
+                                    rocsparse_int                  kb,
+                                    rocsparse_int                  block_dim,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnzb_A,
+                                    const rocsparse_float_complex* bsr_val_A,
+                                    const rocsparse_int*           bsr_row_ptr_A,
+                                    const rocsparse_int*           bsr_col_ind_A,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnzb_B,
+                                    const rocsparse_float_complex* bsr_val_B,
+                                    const rocsparse_int*           bsr_row_ptr_B,
+                                    const rocsparse_int*           bsr_col_ind_B,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       bsr_val_C,
+                                    const rocsparse_int*           bsr_row_ptr_C,
+                                    rocsparse_int*                 bsr_col_ind_C);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_analysis performs the analysis step for rocsparse_sbsrilu0()
- *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0(), and rocsparse_zbsrilu0(). It is expected
- *  that this function will be executed only once for a given matrix. The analysis meta
- *  data can be cleared by rocsparse_bsrilu0_clear().
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrgemm(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
+                                    rocsparse_int                   mb,
+                                    rocsparse_int                   nb,
+                                    rocsparse_int                   kb,
+                                    rocsparse_int                   block_dim,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnzb_A,
+                                    const rocsparse_double_complex* bsr_val_A,
+                                    const rocsparse_int*            bsr_row_ptr_A,
+                                    const rocsparse_int*            bsr_col_ind_A,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnzb_B,
+                                    const rocsparse_double_complex* bsr_val_B,
+                                    const rocsparse_int*            bsr_row_ptr_B,
+                                    const rocsparse_int*            bsr_col_ind_B,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       bsr_val_C,
+                                    const rocsparse_int*            bsr_row_ptr_C,
+                                    rocsparse_int*                  bsr_col_ind_C);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Estimate the number of non-zero entries of a sparse matrix sparse matrix
+*  multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_nnz_estimate estimates the number of non-zero entries of the
+*  sparse \f$m \times n\f$ matrix \f$C\f$, that is the product of the sparse
+*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, such that
+*  \f[
+*    C := op(A) \cdot op(B),
+*  \f]
+*  without computing the sparsity pattern of \f$C\f$, see rocsparse_csrgemm_nnz().
+*
+*  The rows of \f$C\f$ are split into the 8 groups that are used by the csrgemm
+*  algorithm, i.e. rows with at most 32, 64, 512, 1024, 2048, 4096, 8192 and more than
+*  8192 intermediate products. From each group, up to \p sample_size rows are sampled
+*  evenly, and their exact number of non-zero entries is computed. The number of
+*  non-zero entries of the remaining rows is estimated from the ratio of non-zero
+*  entries and intermediate products of the sampled rows. The confidence bound
+*  \p nnz_C_lower and \p nnz_C_upper covers three standard deviations of the estimate
+*  of each group, and is limited by the non-zero entries of the sampled rows and the
+*  number of intermediate products, respectively. Groups with at most \p sample_size
+*  rows are computed exactly.
+*
+*  For each group, the number of rows, the estimated number of non-zero entries and the
+*  device memory in bytes that is required to hold the row pointers, column indices and
+*  values of the rows of the group, sized for the upper bound of the group, are returned.
+*  This allows to plan the memory that is required by the multiplication without the cost
+*  of rocsparse_csrgemm_nnz().
+*
+*  \note If \p sample_size exceeds the number of rows of each group, the estimate is
+*  exact.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note The column indices of \f$B\f$ are expected to be sorted.
+*  \note This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  sample_size     maximum number of rows that are sampled from each group.
+*  @param[out]
+*  nnz_C           estimated number of non-zero entries of the sparse CSR matrix
+*                  \f$C\f$ (host pointer).
+*  @param[out]
+*  nnz_C_lower     lower confidence bound of the number of non-zero entries of the
+*                  sparse CSR matrix \f$C\f$ (host pointer).
+*  @param[out]
+*  nnz_C_upper     upper confidence bound of the number of non-zero entries of the
+*                  sparse CSR matrix \f$C\f$ (host pointer).
+*  @param[out]
+*  group_rows      array of 8 elements containing the number of rows of each group
+*                  (host pointer).
+*  @param[out]
+*  group_nnz       array of 8 elements containing the estimated number of non-zero
+*                  entries of each group (host pointer).
+*  @param[out]
+*  group_workspace array of 8 elements containing the device memory in bytes that is
+*                  required by each group (host pointer).
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p sample_size is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B, \p nnz_C,
+*          \p nnz_C_lower, \p nnz_C_upper, \p group_rows, \p group_nnz or
+*          \p group_workspace pointer is invalid.
+*  \retval rocsparse_status_memory_error the temporary storage could not be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none,
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*          \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm_nnz_estimate(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_A,
+                                                 rocsparse_operation       trans_B,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_B,
+                                                 rocsparse_int             nnz_B,
+                                                 const rocsparse_int*      csr_row_ptr_B,
+                                                 const rocsparse_int*      csr_col_ind_B,
+                                                 rocsparse_int             sample_size,
+                                                 int64_t*                  nnz_C,
+                                                 int64_t*                  nnz_C_lower,
+                                                 int64_t*                  nnz_C_upper,
+                                                 rocsparse_int*            group_rows,
+                                                 int64_t*                  group_nnz,
+                                                 size_t*                   group_workspace);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_nnz_estimate(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_A,
+                                                 rocsparse_operation       trans_B,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_B,
+                                                 rocsparse_int             nnz_B,
+                                                 const rocsparse_int*      csr_row_ptr_B,
+                                                 const rocsparse_int*      csr_col_ind_B,
+                                                 rocsparse_int             sample_size,
+                                                 int64_t*                  nnz_C,
+                                                 int64_t*                  nnz_C_lower,
+                                                 int64_t*                  nnz_C_upper,
+                                                 rocsparse_int*            group_rows,
+                                                 int64_t*                  group_nnz,
+                                                 size_t*                   group_workspace);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_nnz_estimate(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_A,
+                                                 rocsparse_operation       trans_B,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_B,
+                                                 rocsparse_int             nnz_B,
+                                                 const rocsparse_int*      csr_row_ptr_B,
+                                                 const rocsparse_int*      csr_col_ind_B,
+                                                 rocsparse_int             sample_size,
+                                                 int64_t*                  nnz_C,
+                                                 int64_t*                  nnz_C_lower,
+                                                 int64_t*                  nnz_C_upper,
+                                                 rocsparse_int*            group_rows,
+                                                 int64_t*                  group_nnz,
+                                                 size_t*                   group_workspace);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_nnz_estimate(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_A,
+                                                 rocsparse_operation       trans_B,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_B,
+                                                 rocsparse_int             nnz_B,
+                                                 const rocsparse_int*      csr_row_ptr_B,
+                                                 const rocsparse_int*      csr_col_ind_B,
+                                                 rocsparse_int             sample_size,
+                                                 int64_t*                  nnz_C,
+                                                 int64_t*                  nnz_C_lower,
+                                                 int64_t*                  nnz_C_upper,
+                                                 rocsparse_int*            group_rows,
+                                                 int64_t*                  group_nnz,
+                                                 size_t*                   group_workspace);
+/**@}*/
+
+/*
+* ===========================================================================
+*    preconditioner SPARSE
+* ===========================================================================
+*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
  *
- *  \p rocsparse_bsrilu0_analysis can share its meta data with
- *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+ *  \details
+ *  \p rocsparse_bsric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsric0(),
+ *  rocsparse_dbsric0(), rocsparse_cbsric0() or rocsparse_zbsric0() computation.
+ *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
+ *  index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position=j means that either the diagonal block \p A(j,j)
+ *  is missing (structural zero) or the diagonal block \p A(j,j) is not positive definite
+ *  (numerical zero).
+ *
+ *  \note \p rocsparse_bsric0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(), rocsparse_sbsric0(),
+ *  rocsparse_dbsric0(), rocsparse_sbsric0() and rocsparse_dbsric0(). The temporary
+ *  storage buffer must be allocated by the user. The size of the temporary storage
+ *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
+ *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
+ *  rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(), rocsparse_cbsrilu0_buffer_size()
+ *  and rocsparse_zbsrilu0_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir             direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *              rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+ *              rocsparse_sbsric0(), rocsparse_dbsric0(), rocsparse_cbsric0()
+ *              and rocsparse_zbsric0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nnzb,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* bsr_val,
+                                               const rocsparse_int*           bsr_row_ptr,
+                                               const rocsparse_int*           bsr_col_ind,
+                                               rocsparse_int                  block_dim,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nnzb,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* bsr_val,
+                                               const rocsparse_int*            bsr_row_ptr,
+                                               const rocsparse_int*            bsr_col_ind,
+                                               rocsparse_int                   block_dim,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_analysis performs the analysis step for rocsparse_sbsric0()
+ *  rocsparse_dbsric0(), rocsparse_cbsric0(), and rocsparse_zbsric0(). It is expected
+ *  that this function will be executed only once for a given matrix and particular
+ *  operation type. The analysis meta data can be cleared by rocsparse_bsric0_clear().
+ *
+ *  \p rocsparse_bsric0_analysis can share its meta data with
+ *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
  *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
  *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
  *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
@@ -7097,8 +8835,8 @@ rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  dir         direction that specified whether to count nonzero elements by
- *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+ *  dir             direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
  *  @param[in]
  *  mb          number of block rows in the sparse BSR matrix.
  *  @param[in]
@@ -7136,78 +8874,78 @@ rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_direction       dir,
-                                             rocsparse_int             mb,
-                                             rocsparse_int             nnzb,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              bsr_val,
-                                             const rocsparse_int*      bsr_row_ptr,
-                                             const rocsparse_int*      bsr_col_ind,
-                                             rocsparse_int             block_dim,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_sbsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_direction       dir,
-                                             rocsparse_int             mb,
-                                             rocsparse_int             nnzb,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             bsr_val,
-                                             const rocsparse_int*      bsr_row_ptr,
-                                             const rocsparse_int*      bsr_col_ind,
-                                             rocsparse_int             block_dim,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_dbsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_analysis(rocsparse_handle               handle,
-                                             rocsparse_direction            dir,
-                                             rocsparse_int                  mb,
-                                             rocsparse_int                  nnzb,
-                                             const rocsparse_mat_descr      descr,
-                                             const rocsparse_float_complex* bsr_val,
-                                             const rocsparse_int*           bsr_row_ptr,
-                                             const rocsparse_int*           bsr_col_ind,
-                                             rocsparse_int                  block_dim,
-                                             rocsparse_mat_info             info,
-                                             rocsparse_analysis_policy      analysis,
-                                             rocsparse_solve_policy         solve,
-                                             void*                          temp_buffer);
+rocsparse_status rocsparse_cbsric0_analysis(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                handle,
-                                             rocsparse_direction             dir,
-                                             rocsparse_int                   mb,
-                                             rocsparse_int                   nnzb,
-                                             const rocsparse_mat_descr       descr,
-                                             const rocsparse_double_complex* bsr_val,
-                                             const rocsparse_int*            bsr_row_ptr,
-                                             const rocsparse_int*            bsr_col_ind,
-                                             rocsparse_int                   block_dim,
-                                             rocsparse_mat_info              info,
-                                             rocsparse_analysis_policy       analysis,
-                                             rocsparse_solve_policy          solve,
-                                             void*                           temp_buffer);
+rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
  *
  *  \details
- *  \p rocsparse_bsrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis()
- *  or rocsparse_zbsrilu0_analysis(). This is especially useful, if memory is an issue and
+ *  \p rocsparse_bsric0_clear deallocates all memory that was allocated by
+ *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis()
+ *  or rocsparse_zbsric0_analysis(). This is especially useful, if memory is an issue and
  *  the analysis data is not required for further computation.
  *
  *  \note
- *  Calling \p rocsparse_bsrilu0_clear is optional. All allocated resources will be
+ *  Calling \p rocsparse_bsric0_clear is optional. All allocated resources will be
  *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
  *  rocsparse_destroy_mat_info().
  *
@@ -7224,27 +8962,26 @@ rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                han
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
  *
  *  \details
- *  \p rocsparse_bsrilu0 computes the incomplete LU factorization with 0 fill-ins and no
- *  pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \p rocsparse_bsric0 computes the incomplete Cholesky factorization with 0 fill-ins
+ *  and no pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
  *  \f[
- *    A \approx LU
+ *    A \approx LL^T
  *  \f]
  *
- *  \p rocsparse_bsrilu0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(),
- *  rocsparse_cbsrilu0_buffer_size() or rocsparse_zbsrilu0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_sbsrilu0_analysis(),
- *  rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis() or
- *  rocsparse_zbsrilu0_analysis(). \p rocsparse_bsrilu0 reports the first zero pivot
- *  (either numerical or structural zero). The zero pivot status can be obtained by
- *  calling rocsparse_bsrilu0_zero_pivot().
+ *  \p rocsparse_bsric0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(),
+ *  rocsparse_cbsric0_buffer_size() or rocsparse_zbsric0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_sbsric0_analysis(),
+ *  rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis() or rocsparse_zbsric0_analysis().
+ *  \p rocsparse_bsric0 reports the first zero pivot (either numerical or structural zero).
+ *  The zero pivot status can be obtained by calling rocsparse_bsric0_zero_pivot().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -7253,8 +8990,8 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
- *  dir         direction that specified whether to count nonzero elements by
- *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+ *  dir             direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
  *  @param[in]
  *  mb          number of block rows in the sparse BSR matrix.
  *  @param[in]
@@ -7289,8 +9026,8 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *
  *  \par Example
  *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
- *  storage format. The following example computes the incomplete LU factorization
- *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  storage format. The following example computes the incomplete Cholesky factorization
+ *  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
  *  \code{.c}
  *      // Create rocSPARSE handle
  *      rocsparse_handle handle;
@@ -7306,11 +9043,11 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
  *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
  *
- *      // Create matrix descriptor for U
- *      rocsparse_mat_descr descr_U;
- *      rocsparse_create_mat_descr(&descr_U);
- *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *      // Create matrix descriptor for L'
+ *      rocsparse_mat_descr descr_Lt;
+ *      rocsparse_create_mat_descr(&descr_Lt);
+ *      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
  *
  *      // Create matrix info structure
  *      rocsparse_mat_info info;
@@ -7319,8 +9056,8 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *      // Obtain required buffer size
  *      size_t buffer_size_M;
  *      size_t buffer_size_L;
- *      size_t buffer_size_U;
- *      rocsparse_dbsrilu0_buffer_size(handle,
+ *      size_t buffer_size_Lt;
+ *      rocsparse_dbsric0_buffer_size(handle,
  *                                     rocsparse_direction_row,
  *                                     mb,
  *                                     nnzb,
@@ -7348,15 +9085,15 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *                                   rocsparse_operation_transpose,
  *                                   mb,
  *                                   nnzb,
- *                                   descr_U,
+ *                                   descr_Lt,
  *                                   bsr_val,
  *                                   bsr_row_ptr,
  *                                   bsr_col_ind,
  *                                   block_dim,
  *                                   info,
- *                                   &buffer_size_U);
+ *                                   &buffer_size_Lt);
  *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
  *
  *      // Allocate temporary buffer
  *      void* temp_buffer;
@@ -7364,7 +9101,7 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *
  *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
  *      // computation performance
- *      rocsparse_dbsrilu0_analysis(handle,
+ *      rocsparse_dbsric0_analysis(handle,
  *                                  rocsparse_direction_row,
  *                                  mb,
  *                                  nnzb,
@@ -7396,7 +9133,7 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *                                rocsparse_operation_transpose,
  *                                mb,
  *                                nnzb,
- *                                descr_U,
+ *                                descr_Lt,
  *                                bsr_val,
  *                                bsr_row_ptr,
  *                                bsr_col_ind,
@@ -7408,15 +9145,15 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *
  *      // Check for zero pivot
  *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
  *                                                                    info,
  *                                                                    &position))
  *      {
  *          printf("A has structural zero at A(%d,%d)\n", position, position);
  *      }
  *
- *      // Compute incomplete LU factorization M = LU
- *      rocsparse_dbsrilu0(handle,
+ *      // Compute incomplete Cholesky factorization M = LL'
+ *      rocsparse_dbsric0(handle,
  *                         rocsparse_direction_row,
  *                         mb,
  *                         nnzb,
@@ -7430,7 +9167,7 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *                         temp_buffer);
  *
  *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
  *                                                                     info,
  *                                                                     &position))
  *      {
@@ -7457,14 +9194,14 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *                             rocsparse_solve_policy_auto,
  *                             temp_buffer);
  *
- *      // Solve Uy = z
+ *      // Solve L'y = z
  *      rocsparse_dbsrsv_solve(handle,
  *                             rocsparse_direction_row,
  *                             rocsparse_operation_transpose,
  *                             mb,
  *                             nnzb,
  *                             &alpha,
- *                             descr_U,
+ *                             descr_Lt,
  *                             bsr_val,
  *                             bsr_row_ptr,
  *                             bsr_col_ind,
@@ -7480,82 +9217,3614 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *      rocsparse_destroy_mat_info(info);
  *      rocsparse_destroy_mat_descr(descr_M);
  *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_U);
+ *      rocsparse_destroy_mat_descr(descr_Lt);
  *      rocsparse_destroy_handle(handle);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_sbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsrilu0(),
+ *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0() or rocsparse_zbsrilu0() computation.
+ *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
+ *  index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
+ *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
+ *  invertible (numerical zero).
+ *
+ *  \note \p rocsparse_bsrilu0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_numeric_boost enables the user to replace a numerical value in
+ *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
+ *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
+ *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
+ *
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
+ *
+ *  \note \p tol and \p boost_val can be in host or device memory.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info            structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dsbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                   rocsparse_mat_info info,
+                                                   int                enable_boost,
+                                                   const double*      boost_tol,
+                                                   const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcbsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                   rocsparse_mat_info             info,
+                                                   int                            enable_boost,
+                                                   const double*                  boost_tol,
+                                                   const rocsparse_float_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(), rocsparse_sbsrilu0(),
+ *  rocsparse_dbsrilu0(), rocsparse_sbsrilu0() and rocsparse_dbsrilu0(). The temporary
+ *  storage buffer must be allocated by the user. The size of the temporary storage
+ *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
+ *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
+ *  rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(), rocsparse_cbsric0_buffer_size()
+ *  and rocsparse_zbsric0_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *              rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+ *              rocsparse_sbsrilu0(), rocsparse_dbsrilu0(), rocsparse_cbsrilu0()
+ *              and rocsparse_zbsrilu0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_direction            dir,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  nnzb,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* bsr_val,
+                                                const rocsparse_int*           bsr_row_ptr,
+                                                const rocsparse_int*           bsr_col_ind,
+                                                rocsparse_int                  block_dim,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_direction             dir,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   nnzb,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* bsr_val,
+                                                const rocsparse_int*            bsr_row_ptr,
+                                                const rocsparse_int*            bsr_col_ind,
+                                                rocsparse_int                   block_dim,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_analysis performs the analysis step for rocsparse_sbsrilu0()
+ *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0(), and rocsparse_zbsrilu0(). It is expected
+ *  that this function will be executed only once for a given matrix. The analysis meta
+ *  data can be cleared by rocsparse_bsrilu0_clear().
+ *
+ *  \p rocsparse_bsrilu0_analysis can share its meta data with
+ *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+ *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
+ *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
+ *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
+ *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specified whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse or
+ *              \ref rocsparse_analysis_policy_force.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_analysis(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  block_dim,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   block_dim,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_clear deallocates all memory that was allocated by
+ *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis()
+ *  or rocsparse_zbsrilu0_analysis(). This is especially useful, if memory is an issue and
+ *  the analysis data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_bsrilu0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+ *  pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *
+ *  \p rocsparse_bsrilu0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(),
+ *  rocsparse_cbsrilu0_buffer_size() or rocsparse_zbsrilu0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_sbsrilu0_analysis(),
+ *  rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis() or
+ *  rocsparse_zbsrilu0_analysis(). \p rocsparse_bsrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_bsrilu0_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specified whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[inout]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
+ *              or \p bsr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
+ *  storage format. The following example computes the incomplete LU factorization
+ *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix descriptor for U
+ *      rocsparse_mat_descr descr_U;
+ *      rocsparse_create_mat_descr(&descr_U);
+ *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_U;
+ *      rocsparse_dbsrilu0_buffer_size(handle,
+ *                                     rocsparse_direction_row,
+ *                                     mb,
+ *                                     nnzb,
+ *                                     descr_M,
+ *                                     bsr_val,
+ *                                     bsr_row_ptr,
+ *                                     bsr_col_ind,
+ *                                     block_dim,
+ *                                     info,
+ *                                     &buffer_size_M);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_none,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_L,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_transpose,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_U,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_U);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dbsrilu0_analysis(handle,
+ *                                  rocsparse_direction_row,
+ *                                  mb,
+ *                                  nnzb,
+ *                                  descr_M,
+ *                                  bsr_val,
+ *                                  bsr_row_ptr,
+ *                                  bsr_col_ind,
+ *                                  block_dim,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_none,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_L,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
+ *                                block_dim,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_transpose,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_U,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
+ *                                block_dim,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete LU factorization M = LU
+ *      rocsparse_dbsrilu0(handle,
+ *                         rocsparse_direction_row,
+ *                         mb,
+ *                         nnzb,
+ *                         descr_M,
+ *                         bsr_val,
+ *                         bsr_row_ptr,
+ *                         bsr_col_ind,
+ *                         block_dim,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_none,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_L,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve Uy = z
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_transpose,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_U,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_U);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Inversion of the diagonal blocks of a sparse BSR matrix
+ *
+ *  \details
+ *  \p rocsparse_bsrdiag_inverse_zero_pivot returns \ref rocsparse_status_zero_pivot, if
+ *  either a structural or numerical zero has been found during rocsparse_sbsrdiag_inverse(),
+ *  rocsparse_dbsrdiag_inverse(), rocsparse_cbsrdiag_inverse() or rocsparse_zbsrdiag_inverse()
+ *  computation. The first block row \f$j\f$ with a singular diagonal block \f$A_{j,j}\f$ is
+ *  stored in \p position, using same index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
+ *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
+ *  invertible (numerical zero).
+ *
+ *  \note \p rocsparse_bsrdiag_inverse_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the zero pivot information.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrdiag_inverse_zero_pivot(rocsparse_handle   handle,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Inversion of the diagonal blocks of a sparse BSR matrix
+ *
+ *  \details
+ *  \p rocsparse_bsrdiag_inverse computes the inverse of each diagonal block of a sparse
+ *  \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \f[
+ *    D^{-1} = \text{diag}\left(A_{0,0}^{-1}, A_{1,1}^{-1}, \ldots, A_{mb-1,mb-1}^{-1}\right)
+ *  \f]
+ *  is the block Jacobi preconditioner of \f$A\f$. \f$D^{-1}\f$ is returned as a block
+ *  diagonal BSR matrix with \p mb blocks, using the same storage direction and index base
+ *  as \f$A\f$. Thus, it can be applied by rocsparse_sbsrmv(), rocsparse_dbsrmv(),
+ *  rocsparse_cbsrmv() or rocsparse_zbsrmv(), or by rocsparse_sbsrdiag_inverse_apply(),
+ *  rocsparse_dbsrdiag_inverse_apply(), rocsparse_cbsrdiag_inverse_apply() or
+ *  rocsparse_zbsrdiag_inverse_apply(), which exploit the block diagonal structure.
+ *
+ *  Each diagonal block is inverted by Gauss-Jordan elimination, using partial pivoting
+ *  unless \ref rocsparse_bsrdiag_inverse_alg_no_pivot is selected. \p rocsparse_bsrdiag_inverse
+ *  reports the first block row with a missing or singular diagonal block. The zero pivot
+ *  status can be obtained by calling rocsparse_bsrdiag_inverse_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Only block dimensions up to 32 are supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specifies whether the BSR blocks are stored by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_column.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse
+ *              BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and 32.
+ *  @param[inout]
+ *  info        structure that holds the zero pivot information.
+ *  @param[in]
+ *  alg         algorithm to use, see \ref rocsparse_bsrdiag_inverse_alg.
+ *  @param[out]
+ *  inv_val     array of length \p mb*block_dim*block_dim containing the inverted diagonal
+ *              blocks.
+ *  @param[out]
+ *  inv_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              block diagonal BSR matrix.
+ *  @param[out]
+ *  inv_col_ind array of \p mb elements containing the block column indices of the block
+ *              diagonal BSR matrix.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_value \p dir or \p alg is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info, \p inv_val, \p inv_row_ptr or \p inv_col_ind
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p block_dim \f$> 32\f$ or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrdiag_inverse(rocsparse_handle              handle,
+                                            rocsparse_direction           dir,
+                                            rocsparse_int                 mb,
+                                            rocsparse_int                 nnzb,
+                                            const rocsparse_mat_descr     descr,
+                                            const float*                  bsr_val,
+                                            const rocsparse_int*          bsr_row_ptr,
+                                            const rocsparse_int*          bsr_col_ind,
+                                            rocsparse_int                 block_dim,
+                                            rocsparse_mat_info            info,
+                                            rocsparse_bsrdiag_inverse_alg alg,
+                                            float*                        inv_val,
+                                            rocsparse_int*                inv_row_ptr,
+                                            rocsparse_int*                inv_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrdiag_inverse(rocsparse_handle              handle,
+                                            rocsparse_direction           dir,
+                                            rocsparse_int                 mb,
+                                            rocsparse_int                 nnzb,
+                                            const rocsparse_mat_descr     descr,
+                                            const double*                 bsr_val,
+                                            const rocsparse_int*          bsr_row_ptr,
+                                            const rocsparse_int*          bsr_col_ind,
+                                            rocsparse_int                 block_dim,
+                                            rocsparse_mat_info            info,
+                                            rocsparse_bsrdiag_inverse_alg alg,
+                                            double*                       inv_val,
+                                            rocsparse_int*                inv_row_ptr,
+                                            rocsparse_int*                inv_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrdiag_inverse(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_bsrdiag_inverse_alg  alg,
+                                            rocsparse_float_complex*       inv_val,
+                                            rocsparse_int*                 inv_row_ptr,
+                                            rocsparse_int*                 inv_col_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrdiag_inverse(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_bsrdiag_inverse_alg   alg,
+                                            rocsparse_double_complex*       inv_val,
+                                            rocsparse_int*                  inv_row_ptr,
+                                            rocsparse_int*                  inv_col_ind);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Application of the inverted diagonal blocks of a sparse BSR matrix
+ *
+ *  \details
+ *  \p rocsparse_bsrdiag_inverse_apply multiplies the scalar \f$\alpha\f$ with the block
+ *  diagonal matrix \f$D^{-1}\f$, computed by rocsparse_sbsrdiag_inverse(),
+ *  rocsparse_dbsrdiag_inverse(), rocsparse_cbsrdiag_inverse() or
+ *  rocsparse_zbsrdiag_inverse(), and the dense vector \f$x\f$ and adds the result to the
+ *  dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot D^{-1} \cdot x + \beta \cdot y.
+ *  \f]
+ *
+ *  Unlike rocsparse_sbsrmv(), rocsparse_dbsrmv(), rocsparse_cbsrmv() and rocsparse_zbsrmv(),
+ *  the block diagonal structure of \f$D^{-1}\f$ is implicit, such that only the inverted
+ *  diagonal blocks are accessed.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specifies whether the blocks are stored by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_column.
+ *  @param[in]
+ *  mb          number of diagonal blocks.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  inv_val     array of length \p mb*block_dim*block_dim containing the inverted diagonal
+ *              blocks.
+ *  @param[in]
+ *  block_dim   the block dimension of the diagonal blocks.
+ *  @param[in]
+ *  x           array of \p mb*block_dim elements (\f$x\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p mb*block_dim elements (\f$y\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_value \p dir is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p alpha, \p inv_val, \p x, \p beta or
+ *              \p y pointer is invalid.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrdiag_inverse_apply(rocsparse_handle    handle,
+                                                  rocsparse_direction dir,
+                                                  rocsparse_int       mb,
+                                                  const float*        alpha,
+                                                  const float*        inv_val,
+                                                  rocsparse_int       block_dim,
+                                                  const float*        x,
+                                                  const float*        beta,
+                                                  float*              y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrdiag_inverse_apply(rocsparse_handle    handle,
+                                                  rocsparse_direction dir,
+                                                  rocsparse_int       mb,
+                                                  const double*       alpha,
+                                                  const double*       inv_val,
+                                                  rocsparse_int       block_dim,
+                                                  const double*       x,
+                                                  const double*       beta,
+                                                  double*             y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrdiag_inverse_apply(rocsparse_handle               handle,
+                                                  rocsparse_direction            dir,
+                                                  rocsparse_int                  mb,
+                                                  const rocsparse_float_complex* alpha,
+                                                  const rocsparse_float_complex* inv_val,
+                                                  rocsparse_int                  block_dim,
+                                                  const rocsparse_float_complex* x,
+                                                  const rocsparse_float_complex* beta,
+                                                  rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrdiag_inverse_apply(rocsparse_handle                handle,
+                                                  rocsparse_direction             dir,
+                                                  rocsparse_int                   mb,
+                                                  const rocsparse_double_complex* alpha,
+                                                  const rocsparse_double_complex* inv_val,
+                                                  rocsparse_int                   block_dim,
+                                                  const rocsparse_double_complex* x,
+                                                  const rocsparse_double_complex* beta,
+                                                  rocsparse_double_complex*       y);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsric0() or
+*  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+*  is stored in \p position, using same index base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
+*  be allocated by the user. The size of the temporary storage buffer is identical to
+*  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
+*  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
+*  sparsity pattern is identical. The user allocated buffer can thus be shared between
+*  subsequent calls to those functions.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*              rocsparse_scsric0() and rocsparse_dcsric0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
+*  and rocsparse_dcsric0(). It is expected that this function will be executed only
+*  once for a given matrix and particular operation type. The analysis meta data can be
+*  cleared by rocsparse_csric0_clear().
+*
+*  \p rocsparse_csric0_analysis can share its meta data with
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_clear deallocates all memory that was allocated by
+*  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
+*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LL^T
+*  \f]
+*
+*  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
+*  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be obtained by
+*  calling rocsparse_csric0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+*  storage format. The following example computes the incomplete Cholesky factorization
+*  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+*  \code{.c}
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
+*
+*      // Create matrix descriptor for M
+*      rocsparse_mat_descr descr_M;
+*      rocsparse_create_mat_descr(&descr_M);
+*
+*      // Create matrix descriptor for L
+*      rocsparse_mat_descr descr_L;
+*      rocsparse_create_mat_descr(&descr_L);
+*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*
+*      // Create matrix descriptor for L'
+*      rocsparse_mat_descr descr_Lt;
+*      rocsparse_create_mat_descr(&descr_Lt);
+*      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
+*      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+*
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size_M;
+*      size_t buffer_size_L;
+*      size_t buffer_size_Lt;
+*      rocsparse_dcsric0_buffer_size(handle,
+*                                    m,
+*                                    nnz,
+*                                    descr_M,
+*                                    csr_val,
+*                                    csr_row_ptr,
+*                                    csr_col_ind,
+*                                    info,
+*                                    &buffer_size_M);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_L,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_L);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_transpose,
+*                                   m,
+*                                   nnz,
+*                                   descr_Lt,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_Lt);
+*
+*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+*      // computation performance
+*      rocsparse_dcsric0_analysis(handle,
+*                                 m,
+*                                 nnz,
+*                                 descr_M,
+*                                 csr_val,
+*                                 csr_row_ptr,
+*                                 csr_col_ind,
+*                                 info,
+*                                 rocsparse_analysis_policy_reuse,
+*                                 rocsparse_solve_policy_auto,
+*                                 temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_L,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_transpose,
+*                                m,
+*                                nnz,
+*                                descr_Lt,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+*                                                                    info,
+*                                                                    &position))
+*      {
+*          printf("A has structural zero at A(%d,%d)\n", position, position);
+*      }
+*
+*      // Compute incomplete Cholesky factorization M = LL'
+*      rocsparse_dcsric0(handle,
+*                        m,
+*                        nnz,
+*                        descr_M,
+*                        csr_val,
+*                        csr_row_ptr,
+*                        csr_col_ind,
+*                        info,
+*                        rocsparse_solve_policy_auto,
+*                        temp_buffer);
+*
+*      // Check for zero pivot
+*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+*                                                                    info,
+*                                                                    &position))
+*      {
+*          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // Solve Lz = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_L,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             z,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Solve L'y = z
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_transpose,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_Lt,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             z,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr_M);
+*      rocsparse_destroy_mat_descr(descr_L);
+*      rocsparse_destroy_mat_descr(descr_Lt);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete Cholesky factorization with 0 fill-ins and no pivoting using
+*  CSR storage format
+*
+*  \details
+*  \p rocsparse_csric0_iterative_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsric0_iterative(), rocsparse_dcsric0_iterative(),
+*  rocsparse_ccsric0_iterative() and rocsparse_zcsric0_iterative(). The temporary storage
+*  buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsric0_iterative(), rocsparse_dcsric0_iterative(),
+*              rocsparse_ccsric0_iterative() and rocsparse_zcsric0_iterative().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_iterative_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const float*              csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_iterative_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const double*             csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0_iterative_buffer_size(rocsparse_handle               handle,
+                                                         rocsparse_int                  m,
+                                                         rocsparse_int                  nnz,
+                                                         const rocsparse_mat_descr      descr,
+                                                         const rocsparse_float_complex* csr_val,
+                                                         const rocsparse_int*           csr_row_ptr,
+                                                         const rocsparse_int*           csr_col_ind,
+                                                         size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0_iterative_buffer_size(rocsparse_handle                handle,
+                                                         rocsparse_int                   m,
+                                                         rocsparse_int                   nnz,
+                                                         const rocsparse_mat_descr       descr,
+                                                         const rocsparse_double_complex* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         size_t*              buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete Cholesky factorization with 0 fill-ins and no pivoting using
+*  CSR storage format
+*
+*  \details
+*  \p rocsparse_csric0_iterative computes the incomplete Cholesky factorization with 0
+*  fill-ins and no pivoting of a sparse Hermitian positive definite \f$m \times m\f$
+*  CSR matrix \f$A\f$ by fixed-point iteration, such that
+*  \f[
+*    A \approx LL^H
+*  \f]
+*  Each sweep updates all entries of the lower part of the sparsity pattern of \f$A\f$
+*  in parallel, using the factor of the previous sweep,
+*  \f[
+*    l_{ij} = \frac{1}{l_{jj}} \left(a_{ij} - \sum_{k < j} l_{ik} \bar{l}_{jk}\right),
+*    \quad i > j,
+*    \qquad
+*    l_{ii} = \sqrt{\left|a_{ii} - \sum_{k < i} l_{ik} \bar{l}_{ik}\right|}.
+*  \f]
+*  The iteration starts from the lower part of \f$A\f$ scaled by the square root of the
+*  diagonal of \f$A\f$. Afterwards, the Frobenius norm of \f$A - LL^H\f$, restricted
+*  to the lower part of the sparsity pattern of \f$A\f$, is returned in \p residual.
+*  The factor is stored in the lower part of \p csr_val, in the same format as computed
+*  by rocsparse_scsric0(), rocsparse_dcsric0(), rocsparse_ccsric0() and
+*  rocsparse_zcsric0().
+*
+*  In contrast to the level scheduled factorization, all entries are computed in
+*  parallel. The factorization approaches the exact incomplete Cholesky factorization
+*  with increasing number of sweeps, where a few sweeps are usually sufficient for use
+*  as a preconditioner.
+*
+*  \p rocsparse_csric0_iterative requires the analysis meta data, that has been obtained by
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis() or rocsparse_zcsric0_analysis(), as well as a user allocated
+*  temporary storage buffer, which size is returned by
+*  rocsparse_scsric0_iterative_buffer_size(), rocsparse_dcsric0_iterative_buffer_size(),
+*  rocsparse_ccsric0_iterative_buffer_size() or rocsparse_zcsric0_iterative_buffer_size().
+*  A numerical zero pivot of the resulting factorization is reported by
+*  rocsparse_csric0_zero_pivot().
+*
+*  \note
+*  The residual norm is returned in host or device memory, depending on the pointer
+*  mode of the handle.
+*
+*  \note
+*  This function is blocking with respect to the host, if the pointer mode is
+*  \ref rocsparse_pointer_mode_host.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  sweeps      number of fixed-point sweeps.
+*  @param[out]
+*  residual    Frobenius norm of \f$A - LL^H\f$ on the lower part of the sparsity
+*              pattern of \f$A\f$.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p sweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info, \p residual or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*              \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled and the
+*              pointer mode is \ref rocsparse_pointer_mode_host.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_iterative(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             float*                    csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             sweeps,
+                                             float*                    residual,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_iterative(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             double*                   csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             sweeps,
+                                             double*                   residual,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0_iterative(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_float_complex*  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             sweeps,
+                                             float*                    residual,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0_iterative(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_int             sweeps,
+                                             double*                   residual,
+                                             void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() or rocsparse_zcsrilu0() computation. The
+*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
+*  base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value in
+ *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
+ *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
+ *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
+ *
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
+ *
+ *  \note \p tol and \p boost_val can be in host or device memory.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info            structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dscsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                   rocsparse_mat_info info,
+                                                   int                enable_boost,
+                                                   const double*      boost_tol,
+                                                   const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dccsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                   rocsparse_mat_info             info,
+                                                   int                            enable_boost,
+                                                   const double*                  boost_tol,
+                                                   const rocsparse_float_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(), rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). The temporary
+*  storage buffer must be allocated by the user. The size of the temporary storage
+*  buffer is identical to the size returned by rocsparse_scsrsv_buffer_size(),
+*  rocsparse_dcsrsv_buffer_size(), rocsparse_ccsrsv_buffer_size() and
+*  rocsparse_zcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+*  allocated buffer can thus be shared between subsequent calls to those functions.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*              rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*              rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
+*              rocsparse_zcsrilu0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). It is expected
+*  that this function will be executed only once for a given matrix and particular
+*  operation type. The analysis meta data can be cleared by rocsparse_csrilu0_clear().
+*
+*  \p rocsparse_csrilu0_analysis can share its meta data with
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse or
+*              \ref rocsparse_analysis_policy_force.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_level_info returns statistics of the level schedule that has
+*  been computed by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). Rows of the same
+*  level can be factorized in parallel, while the levels have to be processed one after
+*  another. The critical path length is the sum of the maximum number of non-zero
+*  entries per row of each level.
+*
+*  \note
+*  \p rocsparse_csrilu0_level_info is a non blocking function. The statistics are
+*  stored on the host during the analysis step.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis
+*                  step.
+*  @param[out]
+*  nlevels         number of levels of the matrix.
+*  @param[out]
+*  max_width       maximum number of rows of a single level.
+*  @param[out]
+*  critical_path   sum of the maximum number of non-zero entries per row of each level.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info, \p nlevels, \p max_width or
+*              \p critical_path pointer is invalid, or the analysis has not been
+*              performed.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_level_info(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              int64_t*           nlevels,
+                                              int64_t*           max_width,
+                                              int64_t*           critical_path);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*
+*  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
+*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be obtained by
+*  calling rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+*  storage format. The following example computes the incomplete LU factorization
+*  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+*  \code{.c}
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
+*
+*      // Create matrix descriptor for M
+*      rocsparse_mat_descr descr_M;
+*      rocsparse_create_mat_descr(&descr_M);
+*
+*      // Create matrix descriptor for L
+*      rocsparse_mat_descr descr_L;
+*      rocsparse_create_mat_descr(&descr_L);
+*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*
+*      // Create matrix descriptor for U
+*      rocsparse_mat_descr descr_U;
+*      rocsparse_create_mat_descr(&descr_U);
+*      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+*      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+*
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size_M;
+*      size_t buffer_size_L;
+*      size_t buffer_size_U;
+*      rocsparse_dcsrilu0_buffer_size(handle,
+*                                    m,
+*                                    nnz,
+*                                    descr_M,
+*                                    csr_val,
+*                                    csr_row_ptr,
+*                                    csr_col_ind,
+*                                    info,
+*                                    &buffer_size_M);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_L,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_L);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_U,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_U);
+*
+*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+*      // computation performance
+*      rocsparse_dcsrilu0_analysis(handle,
+*                                  m,
+*                                  nnz,
+*                                  descr_M,
+*                                  csr_val,
+*                                  csr_row_ptr,
+*                                  csr_col_ind,
+*                                  info,
+*                                  rocsparse_analysis_policy_reuse,
+*                                  rocsparse_solve_policy_auto,
+*                                  temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_L,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_U,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("A has structural zero at A(%d,%d)\n", position, position);
+*      }
+*
+*      // Compute incomplete LU factorization
+*      rocsparse_dcsrilu0(handle,
+*                         m,
+*                         nnz,
+*                         descr_M,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         info,
+*                         rocsparse_solve_policy_auto,
+*                         temp_buffer);
+*
+*      // Check for zero pivot
+*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("U has structural and/or numerical zero at U(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // Solve Lz = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_L,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             z,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Solve Uy = z
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_U,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             z,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr_M);
+*      rocsparse_destroy_mat_descr(descr_L);
+*      rocsparse_destroy_mat_descr(descr_U);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csriluk_nnz(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  lfil            level of fill of the incomplete LU factorization.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csriluk_nnz().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p lfil is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             lfil,
+                                               size_t*                   buffer_size);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_nnz computes the row pointers and the total number of non-zero
+*  entries of the sparsity pattern of the incomplete LU factorization with level of fill
+*  \p lfil of a sparse \f$m \times m\f$ CSR matrix \f$A\f$. An entry \f$(i,j)\f$ is part
+*  of the pattern, if it is part of \f$A\f$ or if there exists a path
+*  \f$i \rightarrow k_1 \rightarrow \ldots \rightarrow k_l \rightarrow j\f$ in the graph
+*  of \f$A\f$ with \f$l \leq\f$ \p lfil intermediate nodes that are all smaller than
+*  \f$\min(i,j)\f$. The pattern of level of fill 0 is the pattern of \f$A\f$.
+*
+*  The column indices of the pattern are kept in \p info, until they are obtained by
+*  rocsparse_csriluk_symbolic().
+*
+*  \p rocsparse_csriluk_nnz requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_csriluk_buffer_size().
+*
+*  \note
+*  The sparsity pattern of \f$A\f$ has to be sorted and must contain all diagonal
+*  entries.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  lfil            level of fill of the incomplete LU factorization.
+*  @param[in]
+*  descr_LU        descriptor of the sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  csr_row_ptr_LU  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  nnz_LU          pointer to the number of non-zero entries of the sparse CSR matrix
+*                  \f$LU\f$.
+*  @param[inout]
+*  info            structure that holds the ILU(k) pattern for
+*                  rocsparse_csriluk_symbolic().
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csriluk_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p lfil is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p descr_LU, \p csr_row_ptr_LU, \p nnz_LU, \p info or
+*              \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_memory_error the storage of the pattern in \p info
+*              could not be allocated.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*              \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             lfil,
+                                       const rocsparse_mat_descr descr_LU,
+                                       rocsparse_int*            csr_row_ptr_LU,
+                                       rocsparse_int*            nnz_LU,
+                                       rocsparse_mat_info        info,
+                                       void*                     temp_buffer);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_symbolic computes the column indices of the sparsity pattern of
+*  the incomplete LU factorization with level of fill \p lfil of a sparse
+*  \f$m \times m\f$ CSR matrix \f$A\f$. The pattern has to be computed by
+*  rocsparse_csriluk_nnz() first, such that the column indices are copied from \p info.
+*  The column indices of each row are sorted.
+*
+*  The sparsity pattern only depends on the sparsity pattern of \f$A\f$. Thus, it can be
+*  reused for subsequent factorizations of matrices with identical sparsity pattern,
+*  together with the meta data of rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis() that has been performed on the \f$LU\f$ pattern.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  lfil            level of fill of the incomplete LU factorization.
+*  @param[in]
+*  descr_LU        descriptor of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_row_ptr_LU  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$, as computed by rocsparse_csriluk_nnz().
+*  @param[out]
+*  csr_col_ind_LU  array of \p nnz_LU elements containing the column indices of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  info            structure that holds the ILU(k) pattern computed by
+*                  rocsparse_csriluk_nnz().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p lfil is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+*              \p csr_col_ind, \p descr_LU, \p csr_row_ptr_LU, \p csr_col_ind_LU or
+*              \p info pointer is invalid, or rocsparse_csriluk_nnz() has not been
+*              performed.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             lfil,
+                                            const rocsparse_mat_descr descr_LU,
+                                            const rocsparse_int*      csr_row_ptr_LU,
+                                            rocsparse_int*            csr_col_ind_LU,
+                                            rocsparse_mat_info        info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk computes the incomplete LU factorization with level of fill k
+*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$ on the sparsity
+*  pattern that has been computed by rocsparse_csriluk_nnz() and
+*  rocsparse_csriluk_symbolic(). The values of \f$A\f$ are scattered into the \f$LU\f$
+*  pattern, where fill-in entries are initialized with zero, and the factorization is
+*  performed in place on \p csr_val_LU, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*
+*  \p rocsparse_csriluk requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
+*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size() of the \f$LU\f$
+*  pattern. Furthermore, the analysis meta data is required. It can be obtained by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis() of the \f$LU\f$
+*  pattern. Structural and numerical zero pivots, as well as the level statistics, can
+*  be queried by rocsparse_csrilu0_zero_pivot() and rocsparse_csrilu0_level_info(),
+*  respectively.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz_LU          number of non-zero entries of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  descr_LU        descriptor of the sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  csr_val_LU      array of \p nnz_LU elements of the incomplete factorization.
+*  @param[in]
+*  csr_row_ptr_LU  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_col_ind_LU  array of \p nnz_LU elements containing the column indices of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis
+*                  step of the \f$LU\f$ pattern.
+*  @param[in]
+*  policy          \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nnz_LU is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p descr_LU, \p csr_val_LU, \p csr_row_ptr_LU,
+*              \p csr_col_ind_LU, \p info or \p temp_buffer pointer is invalid, or the
+*              analysis has not been performed.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             nnz_LU,
+                                    const rocsparse_mat_descr descr_LU,
+                                    float*                    csr_val_LU,
+                                    const rocsparse_int*      csr_row_ptr_LU,
+                                    const rocsparse_int*      csr_col_ind_LU,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             nnz_LU,
+                                    const rocsparse_mat_descr descr_LU,
+                                    double*                   csr_val_LU,
+                                    const rocsparse_int*      csr_row_ptr_LU,
+                                    const rocsparse_int*      csr_col_ind_LU,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsriluk(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_int                  nnz_LU,
+                                    const rocsparse_mat_descr      descr_LU,
+                                    rocsparse_float_complex*       csr_val_LU,
+                                    const rocsparse_int*           csr_row_ptr_LU,
+                                    const rocsparse_int*           csr_col_ind_LU,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_solve_policy         policy,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsriluk(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_int                   nnz_LU,
+                                    const rocsparse_mat_descr       descr_LU,
+                                    rocsparse_double_complex*       csr_val_LU,
+                                    const rocsparse_int*            csr_row_ptr_LU,
+                                    const rocsparse_int*            csr_col_ind_LU,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_solve_policy          policy,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with threshold dropping using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrilut_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrilut_nnz(),
+*  rocsparse_dcsrilut_nnz(), rocsparse_ccsrilut_nnz() or rocsparse_zcsrilut_nnz()
+*  computation. The first zero pivot \f$j\f$ at \f$U_{j,j}\f$ is stored in \p position,
+*  using same index base as the CSR matrix \f$A\f$.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrilut_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the factorization.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilut_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with threshold dropping using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilut_numeric_boost enables the user to replace a diagonal entry of
+ *  \f$U\f$ in an incomplete LU factorization with threshold dropping. \p tol is used to
+ *  determine whether a diagonal entry is replaced by \p boost_val, such that
+ *  \f$U_{j,j} = \text{boost_val}\f$ if \f$\text{tol} \ge \left|U_{j,j}\right|\f$.
+ *
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
+ *
+ *  \note \p tol and \p boost_val can be in host or device memory.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info            structure that holds the information collected during the factorization.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilut_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilut_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with threshold dropping using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrilut_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrilut_nnz(), rocsparse_dcsrilut_nnz(),
+*  rocsparse_ccsrilut_nnz(), rocsparse_zcsrilut_nnz(), rocsparse_scsrilut(),
+*  rocsparse_dcsrilut(), rocsparse_ccsrilut() and rocsparse_zcsrilut(). The temporary
+*  storage buffer must be allocated by the user. It holds the padded factorization with
+*  up to \f$2 \cdot\f$ \p max_fill \f$+ 1\f$ entries per row.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  max_fill    maximum number of entries of the strictly lower and of the strictly
+*              upper part of each row of the factorization.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrilut_nnz(), rocsparse_dcsrilut_nnz(),
+*              rocsparse_ccsrilut_nnz(), rocsparse_zcsrilut_nnz(), rocsparse_scsrilut(),
+*              rocsparse_dcsrilut(), rocsparse_ccsrilut() and rocsparse_zcsrilut().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             max_fill,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             max_fill,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilut_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_int                  max_fill,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilut_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_int                   max_fill,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with threshold dropping using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrilut_nnz computes the incomplete LU factorization with threshold
+*  dropping (ILUT) of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*  Each row is eliminated in ascending column order. Multipliers and fill-in entries
+*  with magnitude below \p tol times the average magnitude of the corresponding row of
+*  \f$A\f$ are dropped. Afterwards, only the \p max_fill largest entries of the strictly
+*  lower and of the strictly upper part of each row are kept, together with the
+*  diagonal entry.
+*
+*  \p rocsparse_csrilut_nnz reports the first zero pivot \f$j\f$, where \f$U_{jj}\f$ is
+*  zero, which can be obtained by rocsparse_csrilut_zero_pivot(). Rows depending on a
+*  zero pivot skip their remaining elimination. Zero pivots can be avoided by enabling
+*  the numeric boost, see rocsparse_scsrilut_numeric_boost().
+*
+*  The factorization is stored in the temporary storage buffer, while the row pointers
+*  and the total number of non-zero entries of \f$LU\f$ are returned. The factorization
+*  can then be copied into the user allocated matrix \f$LU\f$ by rocsparse_scsrilut(),
+*  rocsparse_dcsrilut(), rocsparse_ccsrilut() or rocsparse_zcsrilut(). The strictly
+*  lower part of \f$LU\f$ holds the unit lower triangular factor \f$L\f$, the upper part
+*  holds \f$U\f$, similar to rocsparse_scsrilu0().
+*
+*  \note
+*  Rows are factorized in parallel, where each row waits for the rows it depends on.
+*  The working row of each row is limited to 512 entries. Each row of \f$A\f$ must not
+*  exceed 512 entries, while further fill-in is dropped.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  tol             relative drop tolerance (host pointer).
+*  @param[in]
+*  max_fill        maximum number of entries of the strictly lower and of the strictly
+*                  upper part of each row of \f$LU\f$.
+*  @param[in]
+*  descr_LU        descriptor of the sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  csr_row_ptr_LU  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  nnz_LU          pointer to the number of non-zero entries of the sparse CSR matrix
+*                  \f$LU\f$.
+*  @param[out]
+*  info            structure that holds the zero pivot and the numeric boost settings.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_scsrilut_buffer_size(), rocsparse_dcsrilut_buffer_size(),
+*                  rocsparse_ccsrilut_buffer_size() or rocsparse_zcsrilut_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_fill is invalid.
+*  \retval     rocsparse_status_invalid_value \p tol is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p tol, \p descr_LU, \p csr_row_ptr_LU, \p nnz_LU, \p info
+*              or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, a row of
+*              \f$A\f$ exceeds 512 entries, or the \ref rocsparse_graph_mode is
+*              \ref rocsparse_graph_mode_enabled.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_nnz(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const float*              csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        const float*              tol,
+                                        rocsparse_int             max_fill,
+                                        const rocsparse_mat_descr descr_LU,
+                                        rocsparse_int*            csr_row_ptr_LU,
+                                        rocsparse_int*            nnz_LU,
+                                        rocsparse_mat_info        info,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_nnz(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const double*             csr_val,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        const double*             tol,
+                                        rocsparse_int             max_fill,
+                                        const rocsparse_mat_descr descr_LU,
+                                        rocsparse_int*            csr_row_ptr_LU,
+                                        rocsparse_int*            nnz_LU,
+                                        rocsparse_mat_info        info,
+                                        void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilut_nnz(rocsparse_handle               handle,
+                                        rocsparse_int                  m,
+                                        rocsparse_int                  nnz,
+                                        const rocsparse_mat_descr      descr,
+                                        const rocsparse_float_complex* csr_val,
+                                        const rocsparse_int*           csr_row_ptr,
+                                        const rocsparse_int*           csr_col_ind,
+                                        const float*                   tol,
+                                        rocsparse_int                  max_fill,
+                                        const rocsparse_mat_descr      descr_LU,
+                                        rocsparse_int*                 csr_row_ptr_LU,
+                                        rocsparse_int*                 nnz_LU,
+                                        rocsparse_mat_info             info,
+                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilut_nnz(rocsparse_handle                handle,
+                                        rocsparse_int                   m,
+                                        rocsparse_int                   nnz,
+                                        const rocsparse_mat_descr       descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        const rocsparse_int*            csr_row_ptr,
+                                        const rocsparse_int*            csr_col_ind,
+                                        const double*                   tol,
+                                        rocsparse_int                   max_fill,
+                                        const rocsparse_mat_descr       descr_LU,
+                                        rocsparse_int*                  csr_row_ptr_LU,
+                                        rocsparse_int*                  nnz_LU,
+                                        rocsparse_mat_info              info,
+                                        void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with threshold dropping using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrilut copies the incomplete LU factorization with threshold dropping,
+*  that has been computed by rocsparse_scsrilut_nnz(), rocsparse_dcsrilut_nnz(),
+*  rocsparse_ccsrilut_nnz() or rocsparse_zcsrilut_nnz(), from the temporary storage
+*  buffer into the sparse CSR matrix \f$LU\f$. The column indices of each row are sorted.
+*
+*  \note
+*  The temporary storage buffer and \p max_fill have to be identical to the ones passed
+*  to rocsparse_csrilut_nnz().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  max_fill        maximum number of entries of the strictly lower and of the strictly
+*                  upper part of each row of \f$LU\f$.
+*  @param[in]
+*  nnz_LU          number of non-zero entries of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  descr_LU        descriptor of the sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  csr_val_LU      array of \p nnz_LU elements of the sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  csr_row_ptr_LU  array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[out]
+*  csr_col_ind_LU  array of \p nnz_LU elements containing the column indices of the
+*                  sparse CSR matrix \f$LU\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer that holds the factorization.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p max_fill or \p nnz_LU is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr_LU, \p csr_val_LU,
+*              \p csr_row_ptr_LU, \p csr_col_ind_LU or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int             nnz_LU,
+                                    const rocsparse_mat_descr descr_LU,
+                                    float*                    csr_val_LU,
+                                    const rocsparse_int*      csr_row_ptr_LU,
+                                    rocsparse_int*            csr_col_ind_LU,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int             nnz_LU,
+                                    const rocsparse_mat_descr descr_LU,
+                                    double*                   csr_val_LU,
+                                    const rocsparse_int*      csr_row_ptr_LU,
+                                    rocsparse_int*            csr_col_ind_LU,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int             nnz_LU,
+                                    const rocsparse_mat_descr descr_LU,
+                                    rocsparse_float_complex*  csr_val_LU,
+                                    const rocsparse_int*      csr_row_ptr_LU,
+                                    rocsparse_int*            csr_col_ind_LU,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int             nnz_LU,
+                                    const rocsparse_mat_descr descr_LU,
+                                    rocsparse_double_complex* csr_val_LU,
+                                    const rocsparse_int*      csr_row_ptr_LU,
+                                    rocsparse_int*            csr_col_ind_LU,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_iterative_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrilu0_iterative(), rocsparse_dcsrilu0_iterative(),
+*  rocsparse_ccsrilu0_iterative() and rocsparse_zcsrilu0_iterative(). The temporary storage
+*  buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrilu0_iterative(), rocsparse_dcsrilu0_iterative(),
+*              rocsparse_ccsrilu0_iterative() and rocsparse_zcsrilu0_iterative().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_iterative_buffer_size(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const float*              csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_iterative_buffer_size(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const double*             csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_iterative_buffer_size(rocsparse_handle               handle,
+                                                          rocsparse_int                  m,
+                                                          rocsparse_int                  nnz,
+                                                          const rocsparse_mat_descr      descr,
+                                                          const rocsparse_float_complex* csr_val,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          const rocsparse_int* csr_col_ind,
+                                                          size_t*              buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_iterative_buffer_size(rocsparse_handle                handle,
+                                                          rocsparse_int                   m,
+                                                          rocsparse_int                   nnz,
+                                                          const rocsparse_mat_descr       descr,
+                                                          const rocsparse_double_complex* csr_val,
+                                                          const rocsparse_int* csr_row_ptr,
+                                                          const rocsparse_int* csr_col_ind,
+                                                          size_t*              buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_iterative computes the incomplete LU factorization with 0 fill-ins
+*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$ by fixed-point
+*  iteration, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*  Each sweep updates all entries of the sparsity pattern of \f$A\f$ in parallel,
+*  using the factors of the previous sweep,
+*  \f[
+*    l_{ij} = \frac{1}{u_{jj}} \left(a_{ij} - \sum_{k < j} l_{ik} u_{kj}\right), \quad i > j,
+*    \qquad
+*    u_{ij} = a_{ij} - \sum_{k < i} l_{ik} u_{kj}, \quad i \leq j.
+*  \f]
+*  The iteration starts from the strictly lower part of \f$A\f$ scaled by the diagonal
+*  of \f$A\f$, and the upper part of \f$A\f$. Afterwards, the Frobenius norm of
+*  \f$A - LU\f$, restricted to the sparsity pattern of \f$A\f$, is returned in
+*  \p residual. The factors are stored in \p csr_val, in the same format as computed by
+*  rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
+*  rocsparse_zcsrilu0().
+*
+*  In contrast to the level scheduled factorization, all entries are computed in
+*  parallel. The factorization approaches the exact incomplete LU factorization with
+*  increasing number of sweeps, where a few sweeps are usually sufficient for use as a
+*  preconditioner.
+*
+*  \p rocsparse_csrilu0_iterative requires the analysis meta data, that has been obtained by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(), as well as a user allocated
+*  temporary storage buffer, which size is returned by
+*  rocsparse_scsrilu0_iterative_buffer_size(), rocsparse_dcsrilu0_iterative_buffer_size(),
+*  rocsparse_ccsrilu0_iterative_buffer_size() or rocsparse_zcsrilu0_iterative_buffer_size().
+*  A numerical zero pivot of the resulting factorization is reported by
+*  rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  The residual norm is returned in host or device memory, depending on the pointer
+*  mode of the handle.
+*
+*  \note
+*  This function is blocking with respect to the host, if the pointer mode is
+*  \ref rocsparse_pointer_mode_host.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  sweeps      number of fixed-point sweeps.
+*  @param[out]
+*  residual    Frobenius norm of \f$A - LU\f$ on the sparsity pattern of \f$A\f$.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p sweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info, \p residual or \p temp_buffer pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*              \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled and the
+*              pointer mode is \ref rocsparse_pointer_mode_host.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_iterative(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              float*                    csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             sweeps,
+                                              float*                    residual,
+                                              void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrilu0_iterative(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              double*                   csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             sweeps,
+                                              double*                   residual,
+                                              void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_float_complex*  bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_ccsrilu0_iterative(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              rocsparse_float_complex*  csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             sweeps,
+                                              float*                    residual,
+                                              void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_double_complex* bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_zcsrilu0_iterative(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              rocsparse_double_complex* csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             sweeps,
+                                              double*                   residual,
+                                              void*                     temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Multicolor analysis of a sparse CSR matrix
 *
 *  \details
-*  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsric0() or
-*  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
-*  is stored in \p position, using same index base as the CSR matrix.
+*  \p rocsparse_csrmc_analysis performs the analysis step for rocsparse_scsrmcsor(),
+*  rocsparse_dcsrmcsor(), rocsparse_ccsrmcsor(), rocsparse_zcsrmcsor(),
+*  rocsparse_scsrmcilu0(), rocsparse_dcsrmcilu0(), rocsparse_ccsrmcilu0(),
+*  rocsparse_zcsrmcilu0(), rocsparse_scsrmcilu0_solve(), rocsparse_dcsrmcilu0_solve(),
+*  rocsparse_ccsrmcilu0_solve() and rocsparse_zcsrmcilu0_solve(). The coloring of the
+*  sparse \f$m \times m\f$ CSR matrix \f$A\f$ has to be computed by rocsparse_scsrcolor(),
+*  rocsparse_dcsrcolor(), rocsparse_ccsrcolor() or rocsparse_zcsrcolor(), including the
+*  \p reordering array.
+*
+*  Rows of the same color are not coupled and are processed in parallel, while the colors
+*  are processed one after another. The reordering is not applied to \f$A\f$. Instead,
+*  the analysis stores the rows of each color together with the entries of each row,
+*  sorted by the color of their column. Thus, the computation requires one kernel launch
+*  per color, independent of the number of levels of \f$A\f$.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  ncolors     number of colors, as returned by rocsparse_Xcsrcolor().
+*  @param[in]
+*  coloring    array of \p m elements containing the color of each row.
+*  @param[in]
+*  reordering  array of \p m elements containing the rows, sorted by their color.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p ncolors is invalid.
+*  \retval     rocsparse_status_invalid_value \p coloring and \p reordering are not
+*              consistent.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p coloring, \p reordering or \p info pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrmc_analysis(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          rocsparse_int             ncolors,
+                                          const rocsparse_int*      coloring,
+                                          const rocsparse_int*      reordering,
+                                          rocsparse_mat_info        info);
+
+/*! \ingroup precond_module
+*  \brief Multicolor SOR and ILU0 zero pivot
+*
+*  \details
+*  \p rocsparse_csrmc_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_csrmc_analysis(),
+*  rocsparse_Xcsrmcsor(), rocsparse_Xcsrmcilu0() or rocsparse_Xcsrmcilu0_solve()
+*  computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position,
+*  using same index base as the CSR matrix.
 *
 *  \p position can be in host or device memory. If no zero pivot has been found,
 *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
 *
-*  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+*  \note \p rocsparse_csrmc_zero_pivot is a blocking function. It might influence
 *  performance negatively.
 *
 *  @param[in]
@@ -7573,23 +12842,61 @@ rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
 *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
-                                             rocsparse_mat_info info,
-                                             rocsparse_int*     position);
+rocsparse_status rocsparse_csrmc_zero_pivot(rocsparse_handle   handle,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int*     position);
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Multicolor analysis of a sparse CSR matrix
 *
 *  \details
-*  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
-*  be allocated by the user. The size of the temporary storage buffer is identical to
-*  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
-*  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
-*  sparsity pattern is identical. The user allocated buffer can thus be shared between
-*  subsequent calls to those functions.
+*  \p rocsparse_csrmc_clear deallocates all memory that was allocated by
+*  rocsparse_csrmc_analysis(). This is especially useful, if memory is an issue and the
+*  analysis data is not required anymore for further computation.
+*
+*  \note
+*  Calling \p rocsparse_csrmc_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrmc_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Multicolor SOR sweep using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrmcsor performs a successive over-relaxation sweep of the sparse
+*  \f$m \times m\f$ CSR matrix \f$A\f$ on the dense vector \f$x\f$, such that each row
+*  \f$i\f$ is updated as
+*  \f[
+*    x_i := x_i + \omega \left(\frac{1}{a_{ii}} \left(b_i - \sum_{j \neq i} a_{ij} x_j\right)
+*           - x_i\right),
+*  \f]
+*  using the colors, collected by rocsparse_csrmc_analysis(), as ordering of the rows. A
+*  \ref rocsparse_sor_sweep_forward sweep processes the colors in ascending order, a
+*  \ref rocsparse_sor_sweep_backward sweep in descending order and a
+*  \ref rocsparse_sor_sweep_symmetric sweep performs a forward followed by a backward sweep.
+*  With \f$\omega = 1\f$, this is a multicolor Gauss-Seidel smoother.
+*
+*  A numerical or structural zero diagonal entry is reported by
+*  rocsparse_csrmc_zero_pivot().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -7607,93 +12914,202 @@ rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
-*  @param[out]
+*  @param[in]
 *  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*              rocsparse_scsric0() and rocsparse_dcsric0().
+*  sweep       direction of the sweep, see \ref rocsparse_sor_sweep.
+*  @param[in]
+*  omega       relaxation factor \f$\omega\f$.
+*  @param[in]
+*  b           array of \p m elements (\f$b\f$).
+*  @param[inout]
+*  x           array of \p m elements (\f$x\f$).
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_value \p sweep is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info, \p omega, \p b or \p x pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmcsor(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const float*              csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_sor_sweep       sweep,
+                                     const float*              omega,
+                                     const float*              b,
+                                     float*                    x);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmcsor(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double*             csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_sor_sweep       sweep,
+                                     const double*             omega,
+                                     const double*             b,
+                                     double*                   x);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrmcsor(rocsparse_handle               handle,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  nnz,
+                                     const rocsparse_mat_descr      descr,
+                                     const rocsparse_float_complex* csr_val,
+                                     const rocsparse_int*           csr_row_ptr,
+                                     const rocsparse_int*           csr_col_ind,
+                                     rocsparse_mat_info             info,
+                                     rocsparse_sor_sweep            sweep,
+                                     const rocsparse_float_complex* omega,
+                                     const rocsparse_float_complex* b,
+                                     rocsparse_float_complex*       x);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrmcsor(rocsparse_handle                handle,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   nnz,
+                                     const rocsparse_mat_descr       descr,
+                                     const rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*            csr_row_ptr,
+                                     const rocsparse_int*            csr_col_ind,
+                                     rocsparse_mat_info              info,
+                                     rocsparse_sor_sweep             sweep,
+                                     const rocsparse_double_complex* omega,
+                                     const rocsparse_double_complex* b,
+                                     rocsparse_double_complex*       x);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Multicolor incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrmcilu0 computes the incomplete LU factorization with 0 fill-ins and no
+*  pivoting of the symmetrically reordered sparse \f$m \times m\f$ CSR matrix
+*  \f$PAP^T\f$, where \f$P\f$ is the permutation given by the reordering that was
+*  passed to rocsparse_csrmc_analysis(), such that
+*  \f[
+*    PAP^T \approx LU.
+*  \f]
+*  The factors are computed in place, one color at a time. \f$PAP^T\f$ is not formed.
+*  Instead, \p csr_val keeps the original row order of \f$A\f$, while the factorization
+*  follows the reordered positions of the rows and columns. The factors can therefore only
+*  be applied by rocsparse_scsrmcilu0_solve(), rocsparse_dcsrmcilu0_solve(),
+*  rocsparse_ccsrmcilu0_solve() or rocsparse_zcsrmcilu0_solve().
+*
+*  Since rows of the same color are not coupled, the multicolor ordering typically has
+*  far fewer levels than the natural ordering, at the price of a different incomplete
+*  factorization.
+*
+*  A numerical or structural zero pivot is reported by rocsparse_csrmc_zero_pivot().
+*
+*  \note
+*  The column indices of each row of the sparse CSR matrix have to be sorted.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*              \p csr_col_ind or \p info pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_scsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_int                  m,
-                                               rocsparse_int                  nnz,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* csr_val,
-                                               const rocsparse_int*           csr_row_ptr,
-                                               const rocsparse_int*           csr_col_ind,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_float_complex*  csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_int                   m,
-                                               rocsparse_int                   nnz,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* csr_val,
-                                               const rocsparse_int*            csr_row_ptr,
-                                               const rocsparse_int*            csr_col_ind,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsrmcilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Application of the multicolor incomplete LU factorization using CSR storage
+*  format
 *
 *  \details
-*  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
-*  and rocsparse_dcsric0(). It is expected that this function will be executed only
-*  once for a given matrix and particular operation type. The analysis meta data can be
-*  cleared by rocsparse_csric0_clear().
-*
-*  \p rocsparse_csric0_analysis can share its meta data with
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
+*  \p rocsparse_csrmcilu0_solve applies the incomplete LU factorization, computed by
+*  rocsparse_scsrmcilu0(), rocsparse_dcsrmcilu0(), rocsparse_ccsrmcilu0() or
+*  rocsparse_zcsrmcilu0(), to the dense vector \f$x\f$, such that
+*  \f[
+*    y := P^T U^{-1} L^{-1} P x,
+*  \f]
+*  where \f$L\f$ has unit diagonal. The forward substitution processes the colors in
+*  ascending order and the backward substitution in descending order, with one kernel
+*  launch per color each. \f$x\f$ and \f$y\f$ are in the original ordering of \f$A\f$.
 *
-*  \note
-*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*  A numerical or structural zero pivot is reported by rocsparse_csrmc_zero_pivot().
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -7708,37 +13124,32 @@ rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                h
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  csr_val     array of \p nnz elements of the factorized sparse CSR matrix.
 *  @param[in]
 *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
 *              sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
-*  @param[out]
-*  info        structure that holds the information collected during
-*              the analysis step.
-*  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
 *  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  x           array of \p m elements (\f$x\f$).
+*  @param[out]
+*  y           array of \p m elements (\f$y\f$).
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*              \p csr_col_ind, \p info, \p x or \p y pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
+rocsparse_status rocsparse_scsrmcilu0_solve(rocsparse_handle          handle,
                                             rocsparse_int             m,
                                             rocsparse_int             nnz,
                                             const rocsparse_mat_descr descr,
@@ -7746,12 +13157,11 @@ rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
                                             const rocsparse_int*      csr_row_ptr,
                                             const rocsparse_int*      csr_col_ind,
                                             rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+                                            const float*              x,
+                                            float*                    y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
+rocsparse_status rocsparse_dcsrmcilu0_solve(rocsparse_handle          handle,
                                             rocsparse_int             m,
                                             rocsparse_int             nnz,
                                             const rocsparse_mat_descr descr,
@@ -7759,12 +13169,11 @@ rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
                                             const rocsparse_int*      csr_row_ptr,
                                             const rocsparse_int*      csr_col_ind,
                                             rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+                                            const double*             x,
+                                            double*                   y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handle,
+rocsparse_status rocsparse_ccsrmcilu0_solve(rocsparse_handle               handle,
                                             rocsparse_int                  m,
                                             rocsparse_int                  nnz,
                                             const rocsparse_mat_descr      descr,
@@ -7772,12 +13181,11 @@ rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handl
                                             const rocsparse_int*           csr_row_ptr,
                                             const rocsparse_int*           csr_col_ind,
                                             rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer);
+                                            const rocsparse_float_complex* x,
+                                            rocsparse_float_complex*       y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                handle,
+rocsparse_status rocsparse_zcsrmcilu0_solve(rocsparse_handle                handle,
                                             rocsparse_int                   m,
                                             rocsparse_int                   nnz,
                                             const rocsparse_mat_descr       descr,
@@ -7785,345 +13193,668 @@ rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                hand
                                             const rocsparse_int*            csr_row_ptr,
                                             const rocsparse_int*            csr_col_ind,
                                             rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer);
+                                            const rocsparse_double_complex* x,
+                                            rocsparse_double_complex*       y);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Polynomial preconditioner using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrpoly_buffer_size returns the size of the temporary storage buffer that
+*  is required by rocsparse_scsrpoly(), rocsparse_dcsrpoly(), rocsparse_ccsrpoly(),
+*  rocsparse_zcsrpoly(), rocsparse_scsrpoly_chebyshev(), rocsparse_dcsrpoly_chebyshev(),
+*  rocsparse_ccsrpoly_chebyshev() and rocsparse_zcsrpoly_chebyshev(). The temporary
+*  storage buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+*              \ref rocsparse_matrix_type_triangular.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrpoly_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrpoly_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrpoly_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrpoly_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
-*
-*  \details
-*  \p rocsparse_csric0_clear deallocates all memory that was allocated by
-*  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
-*  useful, if memory is an issue and the analysis data is not required for further
-*  computation.
-*
-*  \note
-*  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
-*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
-*  rocsparse_destroy_mat_info().
-*
-*  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
-*
-*  \retval     rocsparse_status_success the operation completed successfully.
-*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*/
+/*! \ingroup precond_module
+*  \brief Polynomial preconditioner using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrpoly evaluates the matrix polynomial with coefficients \f$c_i\f$ of the
+*  sparse \f$m \times m\f$ matrix \f$A\f$, defined in CSR storage format, applied to the
+*  dense vector \f$x\f$, such that
+*  \f[
+*    y := p(A) \cdot x = \sum_{i=0}^{degree} c_i \cdot A^i \cdot x.
+*  \f]
+*  A truncated Neumann series, for instance, is obtained by \f$c_i = \omega^{i+1}\f$ for
+*  \f$A := I - \omega \cdot M\f$.
+*
+*  The polynomial is evaluated by the Horner scheme. Each of the \p degree sparse matrix
+*  vector multiplications is fused with the vector update of the previous degree, such
+*  that a single kernel is launched per degree. If \p info holds the data of
+*  rocsparse_scsrmv_analysis(), rocsparse_dcsrmv_analysis(), rocsparse_ccsrmv_analysis()
+*  or rocsparse_zcsrmv_analysis() for the same matrix and
+*  \ref rocsparse_operation_none, the adaptive row blocks of csrmv are used.
+*
+*  rocsparse_csrpoly requires a temporary storage buffer of size returned by
+*  rocsparse_scsrpoly_buffer_size(), rocsparse_dcsrpoly_buffer_size(),
+*  rocsparse_ccsrpoly_buffer_size() or rocsparse_zcsrpoly_buffer_size(), if \p degree is
+*  larger than one.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  \note
+*  \p x and \p y must not overlap.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected by csrmv analysis. Can
+*              be \p nullptr.
+*  @param[in]
+*  degree      degree of the polynomial.
+*  @param[in]
+*  coeff       array of \p degree+1 polynomial coefficients \f$c_0, \ldots, c_{degree}\f$
+*              in host memory.
+*  @param[in]
+*  x           array of \p m elements (\f$x\f$).
+*  @param[out]
+*  y           array of \p m elements (\f$y\f$).
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p degree is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p coeff, \p x, \p y or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+*              \ref rocsparse_matrix_type_triangular.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrpoly(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             degree,
+                                    const float*              coeff,
+                                    const float*              x,
+                                    float*                    y,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrpoly(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             degree,
+                                    const double*             coeff,
+                                    const double*             x,
+                                    double*                   y,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrpoly(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_int                  degree,
+                                    const rocsparse_float_complex* coeff,
+                                    const rocsparse_float_complex* x,
+                                    rocsparse_float_complex*       y,
+                                    void*                          temp_buffer);
+
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_zcsrpoly(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_int                   degree,
+                                    const rocsparse_double_complex* coeff,
+                                    const rocsparse_double_complex* x,
+                                    rocsparse_double_complex*       y,
+                                    void*                           temp_buffer);
+/**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Chebyshev polynomial preconditioner using CSR storage format
 *
 *  \details
-*  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
-*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \p rocsparse_csrpoly_chebyshev applies \p degree steps of the Chebyshev iteration for
+*  \f$A \cdot z = x\f$, starting from \f$z_0 = 0\f$, to the dense vector \f$x\f$, where
+*  \f$A\f$ is a sparse \f$m \times m\f$ matrix, defined in CSR storage format, with
+*  eigenvalues in \f$[\lambda_{min}, \lambda_{max}]\f$. The result is
 *  \f[
-*    A \approx LL^T
+*    y := p(A) \cdot x \approx A^{-1} \cdot x,
 *  \f]
+*  where \f$p\f$ is the polynomial of degree \p degree, derived from the scaled and shifted
+*  Chebyshev polynomials on \f$[\lambda_{min}, \lambda_{max}]\f$.
 *
-*  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
-*  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
-*  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be obtained by
-*  calling rocsparse_csric0_zero_pivot().
+*  Each Chebyshev step is written as a three-term recurrence of the iterates, such that
+*  the sparse matrix vector multiplication and the vector updates are fused into a single
+*  kernel launch per degree. If \p info holds the data of rocsparse_scsrmv_analysis(),
+*  rocsparse_dcsrmv_analysis(), rocsparse_ccsrmv_analysis() or rocsparse_zcsrmv_analysis()
+*  for the same matrix and \ref rocsparse_operation_none, the adaptive row blocks of csrmv
+*  are used.
 *
-*  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
+*  rocsparse_csrpoly_chebyshev requires a temporary storage buffer of size returned by
+*  rocsparse_scsrpoly_buffer_size(), rocsparse_dcsrpoly_buffer_size(),
+*  rocsparse_ccsrpoly_buffer_size() or rocsparse_zcsrpoly_buffer_size(), if \p degree is
+*  larger than one.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
+*  \note
+*  \p x and \p y must not overlap.
+*
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           number of rows and columns of the sparse CSR matrix.
 *  @param[in]
 *  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
-*  @param[inout]
+*  @param[in]
 *  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start
-*              of every row of the sparse CSR matrix.
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  info        structure that holds the information collected by csrmv analysis. Can
+*              be \p nullptr.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  degree      number of Chebyshev steps.
+*  @param[in]
+*  lambda_min  lower bound \f$\lambda_{min} > 0\f$ of the eigenvalues of \f$A\f$.
+*  @param[in]
+*  lambda_max  upper bound \f$\lambda_{max} > \lambda_{min}\f$ of the eigenvalues of
+*              \f$A\f$.
+*  @param[in]
+*  x           array of \p m elements (\f$x\f$).
+*  @param[out]
+*  y           array of \p m elements (\f$y\f$).
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
-*              or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p degree is invalid.
+*  \retval     rocsparse_status_invalid_value \p lambda_min or \p lambda_max is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p x, \p y or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \ref rocsparse_matrix_type is not \ref rocsparse_matrix_type_general or
+*              \ref rocsparse_matrix_type_triangular.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrpoly_chebyshev(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             degree,
+                                              float                     lambda_min,
+                                              float                     lambda_max,
+                                              const float*              x,
+                                              float*                    y,
+                                              void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrpoly_chebyshev(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             degree,
+                                              double                    lambda_min,
+                                              double                    lambda_max,
+                                              const double*             x,
+                                              double*                   y,
+                                              void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrpoly_chebyshev(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  nnz,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const rocsparse_int*           csr_row_ptr,
+                                              const rocsparse_int*           csr_col_ind,
+                                              rocsparse_mat_info             info,
+                                              rocsparse_int                  degree,
+                                              float                          lambda_min,
+                                              float                          lambda_max,
+                                              const rocsparse_float_complex* x,
+                                              rocsparse_float_complex*       y,
+                                              void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrpoly_chebyshev(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   nnz,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const rocsparse_int*            csr_row_ptr,
+                                              const rocsparse_int*            csr_col_ind,
+                                              rocsparse_mat_info              info,
+                                              rocsparse_int                   degree,
+                                              double                          lambda_min,
+                                              double                          lambda_max,
+                                              const rocsparse_double_complex* x,
+                                              rocsparse_double_complex*       y,
+                                              void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Factorized sparse approximate inverse using CSR storage format
 *
-*  \par Example
-*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
-*  storage format. The following example computes the incomplete Cholesky factorization
-*  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
+*  \details
+*  \p rocsparse_csrfsai_zero_pivot returns \ref rocsparse_status_zero_pivot, if a row
+*  of the factorized sparse approximate inverse could not be computed during
+*  rocsparse_scsrfsai(), rocsparse_dcsrfsai(), rocsparse_ccsrfsai() or rocsparse_zcsrfsai()
+*  computation. The first such row \f$j\f$ is stored in \p position, using same index base
+*  as the CSR matrix \f$A\f$.
 *
-*      // Create matrix descriptor for M
-*      rocsparse_mat_descr descr_M;
-*      rocsparse_create_mat_descr(&descr_M);
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
 *
-*      // Create matrix descriptor for L
-*      rocsparse_mat_descr descr_L;
-*      rocsparse_create_mat_descr(&descr_L);
-*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*  \note
+*  If a zero pivot is found, \p position \f$=j\f$ means that the local system of row
+*  \f$j\f$ is either singular or not positive definite.
 *
-*      // Create matrix descriptor for L'
-*      rocsparse_mat_descr descr_Lt;
-*      rocsparse_create_mat_descr(&descr_Lt);
-*      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
-*      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+*  \note \p rocsparse_csrfsai_zero_pivot is a blocking function. It might influence
+*  performance negatively.
 *
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the zero pivot information.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
 *
-*      // Obtain required buffer size
-*      size_t buffer_size_M;
-*      size_t buffer_size_L;
-*      size_t buffer_size_Lt;
-*      rocsparse_dcsric0_buffer_size(handle,
-*                                    m,
-*                                    nnz,
-*                                    descr_M,
-*                                    csr_val,
-*                                    csr_row_ptr,
-*                                    csr_col_ind,
-*                                    info,
-*                                    &buffer_size_M);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_L,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_L);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_transpose,
-*                                   m,
-*                                   nnz,
-*                                   descr_Lt,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_Lt);
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrfsai_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Factorized sparse approximate inverse using CSR storage format
 *
-*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+*  \details
+*  \p rocsparse_csrfsai_nnz computes the sparsity pattern of the lower triangular factor
+*  \f$G\f$ of the factorized sparse approximate inverse, that is computed by
+*  rocsparse_scsrfsai(), rocsparse_dcsrfsai(), rocsparse_ccsrfsai() or
+*  rocsparse_zcsrfsai(). The pattern of \f$G\f$ is obtained from the lower triangular
+*  part of a given sparse CSR pattern \f$S\f$. Row \f$i\f$ of \f$G\f$ holds the diagonal
+*  entry and the strictly lower entries of row \f$i\f$ of \f$S\f$ with the largest column
+*  indices, such that each row of \f$G\f$ has at most 32 entries. Rows of \f$S\f$ with
+*  more than 31 strictly lower entries are truncated to the 31 entries closest to the
+*  diagonal, and the number of such rows is returned in \p truncated_rows.
+*
+*  Typically, \f$S\f$ is the sparse matrix \f$A\f$ itself. A denser pattern, that results
+*  in a more accurate approximation, is the pattern of \f$A^2\f$, which can be computed by
+*  rocsparse_csrgemm_nnz().
+*
+*  \p rocsparse_csrfsai_nnz fills \p csr_row_ptr_G and returns the total number of
+*  entries of \f$G\f$ in \p nnz_G, which can be used to allocate \p csr_col_ind_G and
+*  \p csr_val_G.
 *
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
+*  \note
+*  The maximum number of 32 entries per row of \f$G\f$ is the size of the local systems,
+*  that can be solved by a single wavefront. If \p truncated_rows is non-zero, the
+*  approximation can be improved by a sparser pattern \f$S\f$, e.g. \f$A\f$ instead of
+*  \f$A^2\f$.
 *
-*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
-*      // computation performance
-*      rocsparse_dcsric0_analysis(handle,
-*                                 m,
-*                                 nnz,
-*                                 descr_M,
-*                                 csr_val,
-*                                 csr_row_ptr,
-*                                 csr_col_ind,
-*                                 info,
-*                                 rocsparse_analysis_policy_reuse,
-*                                 rocsparse_solve_policy_auto,
-*                                 temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_L,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_transpose,
-*                                m,
-*                                nnz,
-*                                descr_Lt,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
+*  \note
+*  The column indices of each row of \f$S\f$ are expected to be sorted.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_S         descriptor of the sparse CSR pattern \f$S\f$.
+*  @param[in]
+*  nnz_S           number of non-zero entries of the sparse CSR pattern \f$S\f$.
+*  @param[in]
+*  csr_row_ptr_S   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR pattern \f$S\f$.
+*  @param[in]
+*  csr_col_ind_S   array of \p nnz_S elements containing the column indices of the sparse
+*                  CSR pattern \f$S\f$.
+*  @param[in]
+*  descr_G         descriptor of the sparse CSR matrix \f$G\f$.
+*  @param[out]
+*  csr_row_ptr_G   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$G\f$.
+*  @param[out]
+*  nnz_G           pointer to the number of non-zero entries of the sparse CSR matrix
+*                  \f$G\f$, can be in host or device memory.
+*  @param[out]
+*  truncated_rows  pointer to the number of rows of \f$S\f$, that have been truncated to
+*                  32 entries, can be in host or device memory.
 *
-*      // Check for zero pivot
-*      rocsparse_int position;
-*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
-*                                                                    info,
-*                                                                    &position))
-*      {
-*          printf("A has structural zero at A(%d,%d)\n", position, position);
-*      }
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz_S is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr_S, \p csr_row_ptr_S,
+*              \p csr_col_ind_S, \p descr_G, \p csr_row_ptr_G, \p nnz_G or
+*              \p truncated_rows pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled and either
+*              the pointer mode is \ref rocsparse_pointer_mode_host or the handle buffer
+*              is too small for the temporary storage.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrfsai_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       const rocsparse_mat_descr descr_S,
+                                       rocsparse_int             nnz_S,
+                                       const rocsparse_int*      csr_row_ptr_S,
+                                       const rocsparse_int*      csr_col_ind_S,
+                                       const rocsparse_mat_descr descr_G,
+                                       rocsparse_int*            csr_row_ptr_G,
+                                       rocsparse_int*            nnz_G,
+                                       rocsparse_int*            truncated_rows);
+
+/*! \ingroup precond_module
+*  \brief Factorized sparse approximate inverse using CSR storage format
 *
-*      // Compute incomplete Cholesky factorization M = LL'
-*      rocsparse_dcsric0(handle,
-*                        m,
-*                        nnz,
-*                        descr_M,
-*                        csr_val,
-*                        csr_row_ptr,
-*                        csr_col_ind,
-*                        info,
-*                        rocsparse_solve_policy_auto,
-*                        temp_buffer);
+*  \details
+*  \p rocsparse_csrfsai computes the lower triangular factor \f$G\f$ of the factorized
+*  sparse approximate inverse (FSAI) of a symmetric (hermitian) positive definite sparse
+*  \f$m \times m\f$ matrix \f$A\f$, defined in CSR storage format, such that
+*  \f[
+*    G^H G \approx A^{-1}.
+*  \f]
+*  The sparsity pattern of \f$G\f$ is static and has to be computed by
+*  rocsparse_csrfsai_nnz() beforehand. For each row \f$i\f$ of \f$G\f$ with sparsity
+*  pattern \f$J\f$, the small dense system
+*  \f[
+*    A_{J,J} \cdot g = e_i
+*  \f]
+*  is solved, where \f$A_{J,J}\f$ is gathered from \f$A\f$, and
+*  \f$G_{i,J} = \overline{g}^T / \sqrt{g_i}\f$. Thus, \f$G A G^H\f$ has a unit
+*  diagonal. All rows are computed in parallel, where each row is processed by a single
+*  wavefront. \p csr_col_ind_G is filled with the column indices of \f$G\f$.
 *
-*      // Check for zero pivot
-*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
-*                                                                    info,
-*                                                                    &position))
-*      {
-*          printf("L has structural and/or numerical zero at L(%d,%d)\n",
-*                 position,
-*                 position);
-*      }
+*  The preconditioner \f$G^H G\f$ is applied by two sparse matrix vector multiplications,
+*  rocsparse_scsrmv(), rocsparse_dcsrmv(), rocsparse_ccsrmv() or rocsparse_zcsrmv() with
+*  \f$G\f$ and \ref rocsparse_operation_none followed by
+*  \ref rocsparse_operation_conjugate_transpose.
 *
-*      // Solve Lz = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_L,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             z,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  \p rocsparse_csrfsai reports the first row of \f$G\f$, for which the local system is
+*  singular or not positive definite. This row of \f$G\f$ is set to the unit row
+*  \f$e_i^T\f$. The zero pivot status can be obtained by calling
+*  rocsparse_csrfsai_zero_pivot().
 *
-*      // Solve L'y = z
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_transpose,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_Lt,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             z,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  \note
+*  The pattern \f$S\f$ must be identical to the pattern, that has been passed to
+*  rocsparse_csrfsai_nnz().
 *
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr_M);
-*      rocsparse_destroy_mat_descr(descr_L);
-*      rocsparse_destroy_mat_descr(descr_Lt);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the sparse
+*                  CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_S         descriptor of the sparse CSR pattern \f$S\f$.
+*  @param[in]
+*  nnz_S           number of non-zero entries of the sparse CSR pattern \f$S\f$.
+*  @param[in]
+*  csr_row_ptr_S   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR pattern \f$S\f$.
+*  @param[in]
+*  csr_col_ind_S   array of \p nnz_S elements containing the column indices of the sparse
+*                  CSR pattern \f$S\f$.
+*  @param[inout]
+*  info            structure that holds the zero pivot information.
+*  @param[in]
+*  descr_G         descriptor of the sparse CSR matrix \f$G\f$.
+*  @param[out]
+*  csr_val_G       array of \p nnz_G elements of the sparse CSR matrix \f$G\f$.
+*  @param[in]
+*  csr_row_ptr_G   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$G\f$, as computed by rocsparse_csrfsai_nnz().
+*  @param[out]
+*  csr_col_ind_G   array of \p nnz_G elements containing the column indices of the sparse
+*                  CSR matrix \f$G\f$.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz_A or \p nnz_S is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_val_A,
+*              \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_S, \p csr_row_ptr_S,
+*              \p csr_col_ind_S, \p info, \p descr_G, \p csr_val_G, \p csr_row_ptr_G or
+*              \p csr_col_ind_G pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_scsrfsai(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_S,
+                                    rocsparse_int             nnz_S,
+                                    const rocsparse_int*      csr_row_ptr_S,
+                                    const rocsparse_int*      csr_col_ind_S,
+                                    rocsparse_mat_info        info,
+                                    const rocsparse_mat_descr descr_G,
+                                    float*                    csr_val_G,
+                                    const rocsparse_int*      csr_row_ptr_G,
+                                    rocsparse_int*            csr_col_ind_G);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrfsai(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_S,
+                                    rocsparse_int             nnz_S,
+                                    const rocsparse_int*      csr_row_ptr_S,
+                                    const rocsparse_int*      csr_col_ind_S,
+                                    rocsparse_mat_info        info,
+                                    const rocsparse_mat_descr descr_G,
+                                    double*                   csr_val_G,
+                                    const rocsparse_int*      csr_row_ptr_G,
+                                    rocsparse_int*            csr_col_ind_G);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_ccsrfsai(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    const rocsparse_mat_descr      descr_S,
+                                    rocsparse_int                  nnz_S,
+                                    const rocsparse_int*           csr_row_ptr_S,
+                                    const rocsparse_int*           csr_col_ind_S,
+                                    rocsparse_mat_info             info,
+                                    const rocsparse_mat_descr      descr_G,
+                                    rocsparse_float_complex*       csr_val_G,
+                                    const rocsparse_int*           csr_row_ptr_G,
+                                    rocsparse_int*                 csr_col_ind_G);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrfsai(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    const rocsparse_mat_descr       descr_S,
+                                    rocsparse_int                   nnz_S,
+                                    const rocsparse_int*            csr_row_ptr_S,
+                                    const rocsparse_int*            csr_col_ind_S,
+                                    rocsparse_mat_info              info,
+                                    const rocsparse_mat_descr       descr_G,
+                                    rocsparse_double_complex*       csr_val_G,
+                                    const rocsparse_int*            csr_row_ptr_G,
+                                    rocsparse_int*                  csr_col_ind_G);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() or rocsparse_zcsrilu0() computation. The
-*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
+*  \p rocsparse_csrildl0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrildl0(),
+*  rocsparse_dcsrildl0(), rocsparse_ccsrildl0() or rocsparse_zcsrildl0() computation. The
+*  first zero pivot \f$j\f$ at \f$D_{j,j}\f$ is stored in \p position, using same index
 *  base as the CSR matrix.
 *
 *  \p position can be in host or device memory. If no zero pivot has been found,
 *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
 *
-*  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+*  \note \p rocsparse_csrildl0_zero_pivot is a blocking function. It might influence
 *  performance negatively.
 *
 *  @param[in]
@@ -8141,100 +13872,90 @@ rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
 *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
+rocsparse_status rocsparse_csrildl0_zero_pivot(rocsparse_handle   handle,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int*     position);
 
 /*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value in
- *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
- *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
- *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
- *
- *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
- *  setting \p enable_boost to 0.
- *
- *  \note \p tol and \p boost_val can be in host or device memory.
- *
- *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  info            structure that holds the information collected during the analysis step.
- *  @param[in]
- *  enable_boost    enable/disable numeric boost.
- *  @param[in]
- *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
- *  @param[in]
- *  boost_val       boost value to replace a numerical value.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
- *              is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const float*       boost_tol,
-                                                  const float*       boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const double*      boost_tol,
-                                                  const double*      boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                  rocsparse_mat_info             info,
-                                                  int                            enable_boost,
-                                                  const float*                   boost_tol,
-                                                  const rocsparse_float_complex* boost_val);
-
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrildl0_numeric_boost enables the user to replace a numerical value in
+*  an incomplete LDL^T factorization. \p tol is used to determine whether a pivot is
+*  replaced by \p boost_val, such that \f$D_{j,j} = \text{boost_val}\f$ if
+*  \f$\text{tol} \ge \left|D_{j,j}\right|\f$.
+*
+*  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+*  setting \p enable_boost to 0.
+*
+*  \note \p tol and \p boost_val can be in host or device memory.
+*
+*  \note The numeric boost settings are shared with rocsparse_scsrilu0_numeric_boost(),
+*  rocsparse_dcsrilu0_numeric_boost(), rocsparse_ccsrilu0_numeric_boost() and
+*  rocsparse_zcsrilu0_numeric_boost().
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis step.
+*  @param[in]
+*  enable_boost    enable/disable numeric boost.
+*  @param[in]
+*  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+*  @param[in]
+*  boost_val       boost value to replace a numerical value.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+*              is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                  rocsparse_mat_info              info,
-                                                  int                             enable_boost,
-                                                  const double*                   boost_tol,
-                                                  const rocsparse_double_complex* boost_val);
+rocsparse_status rocsparse_scsrildl0_numeric_boost(rocsparse_handle   handle,
+                                                   rocsparse_mat_info info,
+                                                   int                enable_boost,
+                                                   const float*       boost_tol,
+                                                   const float*       boost_val);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dscsrilu0_numeric_boost(rocsparse_handle   handle,
+rocsparse_status rocsparse_dcsrildl0_numeric_boost(rocsparse_handle   handle,
                                                    rocsparse_mat_info info,
                                                    int                enable_boost,
                                                    const double*      boost_tol,
-                                                   const float*       boost_val);
+                                                   const double*      boost_val);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dccsrilu0_numeric_boost(rocsparse_handle               handle,
+rocsparse_status rocsparse_ccsrildl0_numeric_boost(rocsparse_handle               handle,
                                                    rocsparse_mat_info             info,
                                                    int                            enable_boost,
-                                                   const double*                  boost_tol,
+                                                   const float*                   boost_tol,
                                                    const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrildl0_numeric_boost(rocsparse_handle                handle,
+                                                   rocsparse_mat_info              info,
+                                                   int                             enable_boost,
+                                                   const double*                   boost_tol,
+                                                   const rocsparse_double_complex* boost_val);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(), rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). The temporary
-*  storage buffer must be allocated by the user. The size of the temporary storage
-*  buffer is identical to the size returned by rocsparse_scsrsv_buffer_size(),
-*  rocsparse_dcsrsv_buffer_size(), rocsparse_ccsrsv_buffer_size() and
-*  rocsparse_zcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
-*  allocated buffer can thus be shared between subsequent calls to those functions.
+*  \p rocsparse_csrildl0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrildl0_analysis(), rocsparse_dcsrildl0_analysis(),
+*  rocsparse_ccsrildl0_analysis(), rocsparse_zcsrildl0_analysis(), rocsparse_scsrildl0(),
+*  rocsparse_dcsrildl0(), rocsparse_ccsrildl0(), rocsparse_zcsrildl0(),
+*  rocsparse_scsrildl0_solve(), rocsparse_dcsrildl0_solve(), rocsparse_ccsrildl0_solve()
+*  and rocsparse_zcsrildl0_solve(). The temporary storage buffer must be allocated by the
+*  user. It is also sufficiently large for the csrsv analysis of the factor \f$L\f$ and
+*  \f$L^T\f$ that is required by rocsparse_scsrildl0_solve(), rocsparse_dcsrildl0_solve(),
+*  rocsparse_ccsrildl0_solve() and rocsparse_zcsrildl0_solve().
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
@@ -8254,12 +13975,8 @@ rocsparse_status rocsparse_dccsrilu0_numeric_boost(rocsparse_handle
 *              CSR matrix.
 *  @param[out]
 *  info        structure that holds the information collected during the analysis step.
-*  @param[in]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*              rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*              rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
-*              rocsparse_zcsrilu0().
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
@@ -8268,72 +13985,73 @@ rocsparse_status rocsparse_dccsrilu0_numeric_boost(rocsparse_handle
 *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_int                  m,
-                                                rocsparse_int                  nnz,
-                                                const rocsparse_mat_descr      descr,
-                                                const rocsparse_float_complex* csr_val,
-                                                const rocsparse_int*           csr_row_ptr,
-                                                const rocsparse_int*           csr_col_ind,
-                                                rocsparse_mat_info             info,
-                                                size_t*                        buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_int                   m,
-                                                rocsparse_int                   nnz,
-                                                const rocsparse_mat_descr       descr,
-                                                const rocsparse_double_complex* csr_val,
-                                                const rocsparse_int*            csr_row_ptr,
-                                                const rocsparse_int*            csr_col_ind,
-                                                rocsparse_mat_info              info,
-                                                size_t*                         buffer_size);
+rocsparse_status rocsparse_scsrildl0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrildl0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 rocsparse_mat_info        info,
+                                                 size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrildl0_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_int                  m,
+                                                 rocsparse_int                  nnz,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 const rocsparse_int*           csr_row_ptr,
+                                                 const rocsparse_int*           csr_col_ind,
+                                                 rocsparse_mat_info             info,
+                                                 size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrildl0_buffer_size(rocsparse_handle                handle,
+                                                 rocsparse_int                   m,
+                                                 rocsparse_int                   nnz,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 const rocsparse_int*            csr_row_ptr,
+                                                 const rocsparse_int*            csr_col_ind,
+                                                 rocsparse_mat_info              info,
+                                                 size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). It is expected
-*  that this function will be executed only once for a given matrix and particular
-*  operation type. The analysis meta data can be cleared by rocsparse_csrilu0_clear().
+*  \p rocsparse_csrildl0_analysis performs the analysis step for rocsparse_scsrildl0(),
+*  rocsparse_dcsrildl0(), rocsparse_ccsrildl0() and rocsparse_zcsrildl0(). It is expected
+*  that this function will be executed only once for a given matrix. The analysis meta
+*  data can be cleared by rocsparse_csrildl0_clear().
 *
-*  \p rocsparse_csrilu0_analysis can share its meta data with
+*  \p rocsparse_csrildl0_analysis can share its meta data with
 *  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
 *  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
 *  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
 *  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
 *  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  rocsparse_ccsrsm_analysis() and rocsparse_zcsrsm_analysis(). Selecting
 *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
 *  performance of meta data. However, the user need to make sure that the sparsity
 *  pattern remains unchanged. If this cannot be assured,
@@ -8380,76 +14098,75 @@ rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle
 *              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_scsrildl0_analysis(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_analysis_policy analysis,
+                                              rocsparse_solve_policy    solve,
+                                              void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrildl0_analysis(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_analysis_policy analysis,
+                                              rocsparse_solve_policy    solve,
+                                              void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle               handle,
-                                             rocsparse_int                  m,
-                                             rocsparse_int                  nnz,
-                                             const rocsparse_mat_descr      descr,
-                                             const rocsparse_float_complex* csr_val,
-                                             const rocsparse_int*           csr_row_ptr,
-                                             const rocsparse_int*           csr_col_ind,
-                                             rocsparse_mat_info             info,
-                                             rocsparse_analysis_policy      analysis,
-                                             rocsparse_solve_policy         solve,
-                                             void*                          temp_buffer);
+rocsparse_status rocsparse_ccsrildl0_analysis(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  nnz,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const rocsparse_int*           csr_row_ptr,
+                                              const rocsparse_int*           csr_col_ind,
+                                              rocsparse_mat_info             info,
+                                              rocsparse_analysis_policy      analysis,
+                                              rocsparse_solve_policy         solve,
+                                              void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                handle,
-                                             rocsparse_int                   m,
-                                             rocsparse_int                   nnz,
-                                             const rocsparse_mat_descr       descr,
-                                             const rocsparse_double_complex* csr_val,
-                                             const rocsparse_int*            csr_row_ptr,
-                                             const rocsparse_int*            csr_col_ind,
-                                             rocsparse_mat_info              info,
-                                             rocsparse_analysis_policy       analysis,
-                                             rocsparse_solve_policy          solve,
-                                             void*                           temp_buffer);
+rocsparse_status rocsparse_zcsrildl0_analysis(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   nnz,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const rocsparse_int*            csr_row_ptr,
+                                              const rocsparse_int*            csr_col_ind,
+                                              rocsparse_mat_info              info,
+                                              rocsparse_analysis_policy       analysis,
+                                              rocsparse_solve_policy          solve,
+                                              void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). This is especially
+*  \p rocsparse_csrildl0_clear deallocates all memory that was allocated by
+*  rocsparse_scsrildl0_analysis(), rocsparse_dcsrildl0_analysis(),
+*  rocsparse_ccsrildl0_analysis() or rocsparse_zcsrildl0_analysis(). This is especially
 *  useful, if memory is an issue and the analysis data is not required for further
 *  computation.
 *
 *  \note
-*  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+*  Calling \p rocsparse_csrildl0_clear is optional. All allocated resources will be
 *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
 *  rocsparse_destroy_mat_info().
 *
@@ -8466,31 +14183,160 @@ rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                han
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_csrildl0_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
 *  storage format
 *
 *  \details
-*  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
-*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \p rocsparse_csrildl0 computes the incomplete LDL^T factorization with 0 fill-ins and
+*  no pivoting of a sparse symmetric \f$m \times m\f$ CSR matrix \f$A\f$, such that
 *  \f[
-*    A \approx LU
+*    A \approx L D L^T
 *  \f]
-*
-*  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
-*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
-*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis(),
-*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
-*  rocsparse_zcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+*  where \f$L\f$ is unit lower triangular and \f$D\f$ is diagonal. Only the lower
+*  triangular part of \f$A\f$ is referenced, and the strictly lower part of \f$L\f$ and
+*  the diagonal of \f$D\f$ overwrite it. Unlike rocsparse_scsric0(), rocsparse_dcsric0(),
+*  rocsparse_ccsric0() and rocsparse_zcsric0(), \f$A\f$ is not required to be positive
+*  definite, such that symmetric indefinite systems, e.g. saddle point problems, can be
+*  factorized. For complex matrices, \f$A\f$ is assumed to be complex symmetric, i.e.
+*  \f$A = A^T\f$, and the transpose is not conjugated.
+*
+*  \p rocsparse_csrildl0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsrildl0_buffer_size(), rocsparse_dcsrildl0_buffer_size(),
+*  rocsparse_ccsrildl0_buffer_size() or rocsparse_zcsrildl0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsrildl0_analysis(),
+*  rocsparse_dcsrildl0_analysis(), rocsparse_ccsrildl0_analysis() or
+*  rocsparse_zcsrildl0_analysis(). \p rocsparse_csrildl0 reports the first zero pivot
 *  (either numerical or structural zero). The zero pivot status can be obtained by
-*  calling rocsparse_csrilu0_zero_pivot().
+*  calling rocsparse_csrildl0_zero_pivot(). Small pivots can be replaced by enabling the
+*  numeric boost with rocsparse_scsrildl0_numeric_boost(),
+*  rocsparse_dcsrildl0_numeric_boost(), rocsparse_ccsrildl0_numeric_boost() or
+*  rocsparse_zcsrildl0_numeric_boost().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrildl0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_solve_policy    policy,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrildl0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_solve_policy    policy,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrildl0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_float_complex*  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_solve_policy    policy,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrildl0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_solve_policy    policy,
+                                     void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LDL^T factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrildl0_solve applies the incomplete LDL^T factorization, computed by
+*  rocsparse_scsrildl0(), rocsparse_dcsrildl0(), rocsparse_ccsrildl0() or
+*  rocsparse_zcsrildl0(), to a dense vector \f$x\f$, such that
+*  \f[
+*    y := \alpha \cdot \left(L D L^T\right)^{-1} \cdot x.
+*  \f]
+*  The solve is carried out by a forward substitution with the unit lower triangular
+*  factor \f$L\f$, a diagonal scaling with \f$D^{-1}\f$ and a backward substitution with
+*  \f$L^T\f$, using the csrsv triangular solver.
+*
+*  \p rocsparse_csrildl0_solve requires the csrsv analysis meta data of \f$L\f$ and
+*  \f$L^T\f$. It can be obtained by calling rocsparse_scsrsv_analysis(),
+*  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() or
+*  rocsparse_zcsrsv_analysis() on the factorized matrix, with
+*  \ref rocsparse_operation_none and \ref rocsparse_operation_transpose, and a descriptor
+*  of \ref rocsparse_fill_mode_lower and \ref rocsparse_diag_type_unit. The analysis of
+*  \f$L\f$ can reuse the meta data of rocsparse_scsrildl0_analysis(),
+*  rocsparse_dcsrildl0_analysis(), rocsparse_ccsrildl0_analysis() or
+*  rocsparse_zcsrildl0_analysis(). The temporary buffer must be at least of the size
+*  returned by rocsparse_scsrildl0_buffer_size(), rocsparse_dcsrildl0_buffer_size(),
+*  rocsparse_ccsrildl0_buffer_size() or rocsparse_zcsrildl0_buffer_size().
 *
 *  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
+*  The zero pivot of the factorization should be queried by
+*  rocsparse_csrildl0_zero_pivot() prior to the solve, since the unit triangular solves
+*  reset it.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -8503,18 +14349,24 @@ rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_
 *  @param[in]
 *  nnz         number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
+*  alpha       scalar \f$\alpha\f$.
+*  @param[in]
 *  descr       descriptor of the sparse CSR matrix.
-*  @param[inout]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start
-*              of every row of the sparse CSR matrix.
+*  csr_val     array of \p nnz elements of the factorized sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
 *  @param[in]
 *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
 *              CSR matrix.
 *  @param[in]
 *  info        structure that holds the information collected during the analysis step.
 *  @param[in]
+*  x           array of \p m elements, holding the right-hand side.
+*  @param[out]
+*  y           array of \p m elements, holding the solution.
+*  @param[in]
 *  policy      \ref rocsparse_solve_policy_auto.
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
@@ -8522,241 +14374,74 @@ rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
-*              or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+*              \p csr_row_ptr, \p csr_col_ind, \p info, \p x, \p y or \p temp_buffer
+*              pointer is invalid, or the csrsv analysis of \f$L\f$ or \f$L^T\f$ has not
+*              been performed.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*
-*  \par Example
-*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
-*  storage format. The following example computes the incomplete LU factorization
-*  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
-*
-*      // Create matrix descriptor for M
-*      rocsparse_mat_descr descr_M;
-*      rocsparse_create_mat_descr(&descr_M);
-*
-*      // Create matrix descriptor for L
-*      rocsparse_mat_descr descr_L;
-*      rocsparse_create_mat_descr(&descr_L);
-*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
-*
-*      // Create matrix descriptor for U
-*      rocsparse_mat_descr descr_U;
-*      rocsparse_create_mat_descr(&descr_U);
-*      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
-*      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
-*
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
-*
-*      // Obtain required buffer size
-*      size_t buffer_size_M;
-*      size_t buffer_size_L;
-*      size_t buffer_size_U;
-*      rocsparse_dcsrilu0_buffer_size(handle,
-*                                    m,
-*                                    nnz,
-*                                    descr_M,
-*                                    csr_val,
-*                                    csr_row_ptr,
-*                                    csr_col_ind,
-*                                    info,
-*                                    &buffer_size_M);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_L,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_L);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_U,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_U);
-*
-*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
-*
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
-*
-*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
-*      // computation performance
-*      rocsparse_dcsrilu0_analysis(handle,
-*                                  m,
-*                                  nnz,
-*                                  descr_M,
-*                                  csr_val,
-*                                  csr_row_ptr,
-*                                  csr_col_ind,
-*                                  info,
-*                                  rocsparse_analysis_policy_reuse,
-*                                  rocsparse_solve_policy_auto,
-*                                  temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_L,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_U,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*
-*      // Check for zero pivot
-*      rocsparse_int position;
-*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
-*                                                                     info,
-*                                                                     &position))
-*      {
-*          printf("A has structural zero at A(%d,%d)\n", position, position);
-*      }
-*
-*      // Compute incomplete LU factorization
-*      rocsparse_dcsrilu0(handle,
-*                         m,
-*                         nnz,
-*                         descr_M,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         info,
-*                         rocsparse_solve_policy_auto,
-*                         temp_buffer);
-*
-*      // Check for zero pivot
-*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
-*                                                                     info,
-*                                                                     &position))
-*      {
-*          printf("U has structural and/or numerical zero at U(%d,%d)\n",
-*                 position,
-*                 position);
-*      }
-*
-*      // Solve Lz = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_L,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             z,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
-*
-*      // Solve Uy = z
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_U,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             z,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
-*
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr_M);
-*      rocsparse_destroy_mat_descr(descr_L);
-*      rocsparse_destroy_mat_descr(descr_U);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_scsrildl0_solve(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const float*              x,
+                                           float*                    y,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrildl0_solve(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           const double*             x,
+                                           double*                   y,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_float_complex*  csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_ccsrildl0_solve(rocsparse_handle               handle,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  nnz,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int*           csr_row_ptr,
+                                           const rocsparse_int*           csr_col_ind,
+                                           rocsparse_mat_info             info,
+                                           const rocsparse_float_complex* x,
+                                           rocsparse_float_complex*       y,
+                                           rocsparse_solve_policy         policy,
+                                           void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_zcsrildl0_solve(rocsparse_handle                handle,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   nnz,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int*            csr_row_ptr,
+                                           const rocsparse_int*            csr_col_ind,
+                                           rocsparse_mat_info              info,
+                                           const rocsparse_double_complex* x,
+                                           rocsparse_double_complex*       y,
+                                           rocsparse_solve_policy          policy,
+                                           void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
@@ -9078,107 +14763,497 @@ rocsparse_status rocsparse_cgtsv_no_pivot(rocsparse_handle               handle,
                                           void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot(rocsparse_handle                handle,
-                                          rocsparse_int                   m,
-                                          rocsparse_int                   n,
-                                          const rocsparse_double_complex* dl,
-                                          const rocsparse_double_complex* d,
-                                          const rocsparse_double_complex* du,
-                                          rocsparse_double_complex*       B,
-                                          rocsparse_int                   ldb,
-                                          void*                           temp_buffer);
+rocsparse_status rocsparse_zgtsv_no_pivot(rocsparse_handle                handle,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   n,
+                                          const rocsparse_double_complex* dl,
+                                          const rocsparse_double_complex* d,
+                                          const rocsparse_double_complex* du,
+                                          rocsparse_double_complex*       B,
+                                          rocsparse_int                   ldb,
+                                          void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p rocsparse_gtsv_no_pivot_strided_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(),
+*  rocsparse_cgtsv_no_pivot_strided_batch() and rocsparse_zgtsv_no_pivot_strided_batch(). The temporary
+*  storage buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           size of the tri-diagonal linear system.
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(), rocsparse_cgtsv_no_pivot_strided_batch()
+*              and rocsparse_zgtsv_no_pivot_strided_batch().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const float*     dl,
+                                                                    const float*     d,
+                                                                    const float*     du,
+                                                                    const float*     x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const double*    dl,
+                                                                    const double*    d,
+                                                                    const double*    du,
+                                                                    const double*    x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
+                                                       rocsparse_int                  m,
+                                                       const rocsparse_float_complex* dl,
+                                                       const rocsparse_float_complex* d,
+                                                       const rocsparse_float_complex* du,
+                                                       const rocsparse_float_complex* x,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_int                  batch_stride,
+                                                       size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
+                                                       rocsparse_int                   m,
+                                                       const rocsparse_double_complex* dl,
+                                                       const rocsparse_double_complex* d,
+                                                       const rocsparse_double_complex* du,
+                                                       const rocsparse_double_complex* x,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_int                   batch_stride,
+                                                       size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided Batch tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p rocsparse_gtsv_no_pivot_strided_batch  solves a batched tridiagonal linear system
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           size of the tri-diagonal linear system (must be >= 2).
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const float*     dl,
+                                                        const float*     d,
+                                                        const float*     du,
+                                                        float*           x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const double*    dl,
+                                                        const double*    d,
+                                                        const double*    du,
+                                                        double*          x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_no_pivot_strided_batch(rocsparse_handle               handle,
+                                                        rocsparse_int                  m,
+                                                        const rocsparse_float_complex* dl,
+                                                        const rocsparse_float_complex* d,
+                                                        const rocsparse_float_complex* du,
+                                                        rocsparse_float_complex*       x,
+                                                        rocsparse_int                  batch_count,
+                                                        rocsparse_int                  batch_stride,
+                                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_no_pivot_strided_batch(rocsparse_handle                handle,
+                                                        rocsparse_int                   m,
+                                                        const rocsparse_double_complex* dl,
+                                                        const rocsparse_double_complex* d,
+                                                        const rocsparse_double_complex* du,
+                                                        rocsparse_double_complex*       x,
+                                                        rocsparse_int                   batch_count,
+                                                        rocsparse_int batch_stride,
+                                                        void*         temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Interleaved Batch tridiagonal solver
+*
+*  \details
+*  \p rocsparse_gtsv_interleaved_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_interleaved_batch(), rocsparse_dgtsv_interleaved_batch(),
+*  rocsparse_cgtsv_interleaved_batch() and rocsparse_zgtsv_interleaved_batch(). The temporary
+*  storage buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  alg         algorithm used to solve the tri-diagonal systems, see \ref rocsparse_gtsv_interleaved_alg.
+*  @param[in]
+*  m           size of the tri-diagonal linear system.
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system where the ith entry of the jth system is located at \p dl+batch_stride*i+j.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system where the ith entry of the jth system is located at \p d+batch_stride*i+j.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system where the ith entry of the jth system is located at \p du+batch_stride*i+j.
+*  @param[in]
+*  x           Dense array of righthand-sides where the ith entry of the jth righthand-side is located at \p x+batch_stride*i+j.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate consecutive entries of a system. Must satisfy \p batch_stride >= batch_count.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv_interleaved_batch(), rocsparse_dgtsv_interleaved_batch(), rocsparse_cgtsv_interleaved_batch()
+*              and rocsparse_zgtsv_interleaved_batch().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_sgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const float*                   dl,
+                                                  const float*                   d,
+                                                  const float*                   du,
+                                                  const float*                   x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_dgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const double*                  dl,
+                                                  const double*                  d,
+                                                  const double*                  du,
+                                                  const double*                  x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_cgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const rocsparse_float_complex* dl,
+                                                  const rocsparse_float_complex* d,
+                                                  const rocsparse_float_complex* du,
+                                                  const rocsparse_float_complex* x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgtsv_interleaved_batch_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_gtsv_interleaved_alg  alg,
+                                                  rocsparse_int                   m,
+                                                  const rocsparse_double_complex* dl,
+                                                  const rocsparse_double_complex* d,
+                                                  const rocsparse_double_complex* du,
+                                                  const rocsparse_double_complex* x,
+                                                  rocsparse_int                   batch_count,
+                                                  rocsparse_int                   batch_stride,
+                                                  size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Interleaved Batch tridiagonal solver
+*
+*  \details
+*  \p rocsparse_gtsv_interleaved_batch solves a batch of tridiagonal linear systems, where the
+*  entries of the systems are interleaved, i.e. the ith entry of the jth system is located at
+*  position \p batch_stride*i+j. Consecutive systems are thus processed by consecutive threads.
+*  The solver algorithm can be selected by \p alg, where
+*  \ref rocsparse_gtsv_interleaved_alg_thomas performs Gaussian elimination without pivoting,
+*  \ref rocsparse_gtsv_interleaved_alg_pcr uses parallel cyclic reduction, which exposes more
+*  parallelism for small batch counts, \ref rocsparse_gtsv_interleaved_alg_lu performs
+*  Gaussian elimination with partial pivoting and \ref rocsparse_gtsv_interleaved_alg_qr
+*  factorizes the systems using Givens rotations. The pivoting variants are stable for systems
+*  that are not diagonally dominant.
+*
+*  \note
+*  The arrays \p dl, \p d and \p du are overwritten by intermediate results.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  alg         algorithm used to solve the tri-diagonal systems, see \ref rocsparse_gtsv_interleaved_alg.
+*  @param[in]
+*  m           size of the tri-diagonal linear system (must be >= 2).
+*  @param[inout]
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  @param[inout]
+*  d           main diagonal of tri-diagonal system.
+*  @param[inout]
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith entry of the jth righthand-side is located at \p x+batch_stride*i+j.
+*              On exit, \p x is overwritten with the solution.
+*  @param[in]
+*  batch_count The number of systems to solve.
+*  @param[in]
+*  batch_stride The number of elements that separate consecutive entries of a system. Must satisfy \p batch_stride >= batch_count.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   float*                         dl,
+                                                   float*                         d,
+                                                   float*                         du,
+                                                   float*                         x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   double*                        dl,
+                                                   double*                        d,
+                                                   double*                        du,
+                                                   double*                        x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_float_complex*       dl,
+                                                   rocsparse_float_complex*       d,
+                                                   rocsparse_float_complex*       du,
+                                                   rocsparse_float_complex*       x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_double_complex*      dl,
+                                                   rocsparse_double_complex*      d,
+                                                   rocsparse_double_complex*      du,
+                                                   rocsparse_double_complex*      x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Strided Batch tridiagonal solver (no pivoting)
+*  \brief Interleaved Batch pentadiagonal solver
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot_strided_batch_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(),
-*  rocsparse_cgtsv_no_pivot_strided_batch() and rocsparse_zgtsv_no_pivot_strided_batch(). The temporary
+*  \p rocsparse_gpsv_interleaved_batch_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgpsv_interleaved_batch(), rocsparse_dgpsv_interleaved_batch(),
+*  rocsparse_cgpsv_interleaved_batch() and rocsparse_zgpsv_interleaved_batch(). The temporary
 *  storage buffer must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           size of the tri-diagonal linear system.
+*  alg         algorithm used to solve the penta-diagonal systems, see \ref rocsparse_gpsv_interleaved_alg.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system where the ith system lower diagonal starts at \p dl+batch_stride*i.
+*  m           size of the penta-diagonal linear system.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system where the ith system diagonal starts at \p d+batch_stride*i.
+*  ds          second lower diagonal of penta-diagonal system where the ith entry of the jth system is located at \p ds+batch_stride*i+j.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system where the ith system upper diagonal starts at \p du+batch_stride*i.
-*  @param[inout]
-*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  dl          lower diagonal of penta-diagonal system where the ith entry of the jth system is located at \p dl+batch_stride*i+j.
+*  @param[in]
+*  d           main diagonal of penta-diagonal system where the ith entry of the jth system is located at \p d+batch_stride*i+j.
+*  @param[in]
+*  du          upper diagonal of penta-diagonal system where the ith entry of the jth system is located at \p du+batch_stride*i+j.
+*  @param[in]
+*  dw          second upper diagonal of penta-diagonal system where the ith entry of the jth system is located at \p dw+batch_stride*i+j.
+*  @param[in]
+*  x           Dense array of righthand-sides where the ith entry of the jth righthand-side is located at \p x+batch_stride*i+j.
 *  @param[in]
 *  batch_count The number of systems to solve.
 *  @param[in]
-*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  batch_stride The number of elements that separate consecutive entries of a system. Must satisfy \p batch_stride >= batch_count.
 *  @param[out]
 *  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(), rocsparse_cgtsv_no_pivot_strided_batch()
-*              and rocsparse_zgtsv_no_pivot_strided_batch().
+*              rocsparse_sgpsv_interleaved_batch(), rocsparse_dgpsv_interleaved_batch(), rocsparse_cgpsv_interleaved_batch()
+*              and rocsparse_zgpsv_interleaved_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
 *              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
-                                                                    rocsparse_int    m,
-                                                                    const float*     dl,
-                                                                    const float*     d,
-                                                                    const float*     du,
-                                                                    const float*     x,
-                                                                    rocsparse_int    batch_count,
-                                                                    rocsparse_int    batch_stride,
-                                                                    size_t*          buffer_size);
+rocsparse_status
+    rocsparse_sgpsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gpsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const float*                   ds,
+                                                  const float*                   dl,
+                                                  const float*                   d,
+                                                  const float*                   du,
+                                                  const float*                   dw,
+                                                  const float*                   x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
-                                                                    rocsparse_int    m,
-                                                                    const double*    dl,
-                                                                    const double*    d,
-                                                                    const double*    du,
-                                                                    const double*    x,
-                                                                    rocsparse_int    batch_count,
-                                                                    rocsparse_int    batch_stride,
-                                                                    size_t*          buffer_size);
+rocsparse_status
+    rocsparse_dgpsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gpsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const double*                  ds,
+                                                  const double*                  dl,
+                                                  const double*                  d,
+                                                  const double*                  du,
+                                                  const double*                  dw,
+                                                  const double*                  x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
 rocsparse_status
-    rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
-                                                       rocsparse_int                  m,
-                                                       const rocsparse_float_complex* dl,
-                                                       const rocsparse_float_complex* d,
-                                                       const rocsparse_float_complex* du,
-                                                       const rocsparse_float_complex* x,
-                                                       rocsparse_int                  batch_count,
-                                                       rocsparse_int                  batch_stride,
-                                                       size_t*                        buffer_size);
+    rocsparse_cgpsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gpsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const rocsparse_float_complex* ds,
+                                                  const rocsparse_float_complex* dl,
+                                                  const rocsparse_float_complex* d,
+                                                  const rocsparse_float_complex* du,
+                                                  const rocsparse_float_complex* dw,
+                                                  const rocsparse_float_complex* x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
 rocsparse_status
-    rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
-                                                       rocsparse_int                   m,
-                                                       const rocsparse_double_complex* dl,
-                                                       const rocsparse_double_complex* d,
-                                                       const rocsparse_double_complex* du,
-                                                       const rocsparse_double_complex* x,
-                                                       rocsparse_int                   batch_count,
-                                                       rocsparse_int                   batch_stride,
-                                                       size_t*                         buffer_size);
+    rocsparse_zgpsv_interleaved_batch_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_gpsv_interleaved_alg  alg,
+                                                  rocsparse_int                   m,
+                                                  const rocsparse_double_complex* ds,
+                                                  const rocsparse_double_complex* dl,
+                                                  const rocsparse_double_complex* d,
+                                                  const rocsparse_double_complex* du,
+                                                  const rocsparse_double_complex* dw,
+                                                  const rocsparse_double_complex* x,
+                                                  rocsparse_int                   batch_count,
+                                                  rocsparse_int                   batch_stride,
+                                                  size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Strided Batch tridiagonal solver (no pivoting)
+*  \brief Interleaved Batch pentadiagonal solver
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot_strided_batch  solves a batched tridiagonal linear system
+*  \p rocsparse_gpsv_interleaved_batch solves a batch of pentadiagonal linear systems, where
+*  the entries of the systems are interleaved, i.e. the ith entry of the jth system is located
+*  at position \p batch_stride*i+j. The systems are factorized using Givens rotations, thus
+*  no diagonal dominance is required.
+*
+*  \note
+*  The arrays \p ds, \p dl, \p d, \p du and \p dw are overwritten by intermediate results.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -9187,73 +15262,93 @@ rocsparse_status
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           size of the tri-diagonal linear system (must be >= 2).
-*  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
-*  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  alg         algorithm used to solve the penta-diagonal systems, see \ref rocsparse_gpsv_interleaved_alg.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  m           size of the penta-diagonal linear system (must be >= 3).
 *  @param[inout]
-*  x           Dense array of righthand-sides where the ith righthand-side starts at \p x+batch_stride*i.
+*  ds          second lower diagonal of penta-diagonal system. First two entries must be zero.
+*  @param[inout]
+*  dl          lower diagonal of penta-diagonal system. First entry must be zero.
+*  @param[inout]
+*  d           main diagonal of penta-diagonal system.
+*  @param[inout]
+*  du          upper diagonal of penta-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  dw          second upper diagonal of penta-diagonal system. Last two entries must be zero.
+*  @param[inout]
+*  x           Dense array of righthand-sides where the ith entry of the jth righthand-side is located at \p x+batch_stride*i+j.
+*              On exit, \p x is overwritten with the solution.
 *  @param[in]
 *  batch_count The number of systems to solve.
 *  @param[in]
-*  batch_stride The number of elements that separate each system. Must satisfy \p batch_stride >= m.
+*  batch_stride The number of elements that separate consecutive entries of a system. Must satisfy \p batch_stride >= batch_count.
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
-*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch(rocsparse_handle handle,
-                                                        rocsparse_int    m,
-                                                        const float*     dl,
-                                                        const float*     d,
-                                                        const float*     du,
-                                                        float*           x,
-                                                        rocsparse_int    batch_count,
-                                                        rocsparse_int    batch_stride,
-                                                        void*            temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch(rocsparse_handle handle,
-                                                        rocsparse_int    m,
-                                                        const double*    dl,
-                                                        const double*    d,
-                                                        const double*    du,
-                                                        double*          x,
-                                                        rocsparse_int    batch_count,
-                                                        rocsparse_int    batch_stride,
-                                                        void*            temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_no_pivot_strided_batch(rocsparse_handle               handle,
-                                                        rocsparse_int                  m,
-                                                        const rocsparse_float_complex* dl,
-                                                        const rocsparse_float_complex* d,
-                                                        const rocsparse_float_complex* du,
-                                                        rocsparse_float_complex*       x,
-                                                        rocsparse_int                  batch_count,
-                                                        rocsparse_int                  batch_stride,
-                                                        void*                          temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot_strided_batch(rocsparse_handle                handle,
-                                                        rocsparse_int                   m,
-                                                        const rocsparse_double_complex* dl,
-                                                        const rocsparse_double_complex* d,
-                                                        const rocsparse_double_complex* du,
-                                                        rocsparse_double_complex*       x,
-                                                        rocsparse_int                   batch_count,
-                                                        rocsparse_int batch_stride,
-                                                        void*         temp_buffer);
+rocsparse_status rocsparse_sgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   float*                         ds,
+                                                   float*                         dl,
+                                                   float*                         d,
+                                                   float*                         du,
+                                                   float*                         dw,
+                                                   float*                         x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   double*                        ds,
+                                                   double*                        dl,
+                                                   double*                        d,
+                                                   double*                        du,
+                                                   double*                        dw,
+                                                   double*                        x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_float_complex*       ds,
+                                                   rocsparse_float_complex*       dl,
+                                                   rocsparse_float_complex*       d,
+                                                   rocsparse_float_complex*       du,
+                                                   rocsparse_float_complex*       dw,
+                                                   rocsparse_float_complex*       x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgpsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gpsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   rocsparse_double_complex*      ds,
+                                                   rocsparse_double_complex*      dl,
+                                                   rocsparse_double_complex*      d,
+                                                   rocsparse_double_complex*      du,
+                                                   rocsparse_double_complex*      dw,
+                                                   rocsparse_double_complex*      x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
 /**@}*/
 
 /*
@@ -11281,6 +17376,11 @@ rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
 *  \p rocsparse_csr2hyb converts a CSR matrix into a HYB matrix. It is assumed
 *  that \p hyb has been initialized with rocsparse_create_hyb_mat().
 *
+*  With \ref rocsparse_hyb_partition_histogram, a histogram of the row lengths is
+*  computed and the ELL width is chosen to minimize the modelled hybmv cost, i.e. the
+*  bytes of ELL padding and COO entries. The chosen width and its predicted cost can be
+*  obtained by rocsparse_get_hyb_mat_partition().
+*
 *  \note
 *  This function requires a significant amount of storage for the HYB matrix,
 *  depending on the matrix structure.
@@ -11312,8 +17412,9 @@ rocsparse_status rocsparse_zcsr2ell(rocsparse_handle                handle,
 *                  \p partition_type == \ref rocsparse_hyb_partition_user).
 *  @param[in]
 *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
-*                  \ref rocsparse_hyb_partition_user or
-*                  \ref rocsparse_hyb_partition_max.
+*                  \ref rocsparse_hyb_partition_user,
+*                  \ref rocsparse_hyb_partition_max or
+*                  \ref rocsparse_hyb_partition_histogram.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
@@ -15086,6 +21187,15 @@ rocsparse_status rocsparse_spsm(rocsparse_handle            handle,
 *  rocsparse_spmm_alg_coo_atomic.
 *
 *  \note
+*  Strided batches are computed in a single call when the batch count of \p mat_C, set with
+*  \ref rocsparse_dnmat_set_strided_batch, is larger than one. \p mat_B can either hold the
+*  same number of batches or a single matrix that is shared by all batches. Similarly,
+*  \p mat_A can either hold a single matrix or, set with \ref rocsparse_spmat_set_strided_batch,
+*  one batch of values per batch of \p mat_C with all batches sharing the sparsity pattern.
+*  The batches are launched through the z dimension of the grid, such that the batch count
+*  is limited to 65535.
+*
+*  \note
 *  This function writes the required allocation size (in bytes) to \p buffer_size and
 *  returns without performing the SpMM operation, when a nullptr is passed for
 *  \p temp_buffer.
@@ -15134,6 +21244,9 @@ rocsparse_status rocsparse_spsm(rocsparse_handle            handle,
 *  \retval      rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat_A, \p mat_B, \p mat_C, \p beta, or
 *               \p buffer_size pointer is invalid.
+*  \retval      rocsparse_status_invalid_size the batch count of \p mat_C exceeds 65535.
+*  \retval      rocsparse_status_invalid_value the batch count of \p mat_A or \p mat_B is neither
+*               one nor the batch count of \p mat_C.
 *  \retval      rocsparse_status_not_implemented \p trans_A, \p trans_B, \p compute_type or \p alg is
 *               currently not supported.
 */
@@ -15207,6 +21320,13 @@ rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
 *  resulting \f$C\f$ matrix. If the sparsity pattern of \f$C\f$ is already known, this
 *  stage can be skipped. In the final stage \ref rocsparse_spgemm_stage_compute, the actual
 *  computation is performed.
+*  \note If only the values of \f$A\f$, \f$B\f$ and \f$D\f$ change between calls, the
+*  final stage can be replaced by \ref rocsparse_spgemm_stage_symbolic, which performs the
+*  computation and additionally stores a symbolic plan of \f$C\f$. Subsequent calls with
+*  \ref rocsparse_spgemm_stage_numeric only recompute the values of \f$C\f$, skipping the
+*  row analysis and the hash based accumulation. The numeric stage does not access
+*  \p temp_buffer, does not synchronize with the host and computes bitwise reproducible
+*  results. The plan is released by the next \ref rocsparse_spgemm_stage_buffer_size stage.
 *  \note If \ref rocsparse_spgemm_stage_auto is selected, rocSPARSE will automatically detect
 *  which stage is required based on the following indicators:
 *  If \p temp_buffer is equal to \p nullptr, the required buffer size will be returned.
@@ -15567,6 +21687,154 @@ rocsparse_status rocsparse_zcsrcolor(rocsparse_handle                handle,
 
 /**@}*/
 
+/*! \ingroup reordering_module
+*  \brief Reverse Cuthill-McKee reordering of the adjacency graph of the matrix \f$A\f$
+*  stored in the CSR format.
+*
+*  \details
+*  \p rocsparse_csrrcm_buffer_size returns the size of the temporary storage buffer
+*  required by rocsparse_csrrcm(). The temporary storage buffer must be allocated by
+*  the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrrcm().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+*              \p buffer_size pointer is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrcm_buffer_size(rocsparse_handle     handle,
+                                              rocsparse_int        m,
+                                              rocsparse_int        nnz,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              size_t*              buffer_size);
+
+/*! \ingroup reordering_module
+*  \brief Reverse Cuthill-McKee reordering of the adjacency graph of the matrix \f$A\f$
+*  stored in the CSR format.
+*
+*  \details
+*  \p rocsparse_csrrcm computes a bandwidth reducing permutation of the undirected graph
+*  represented by the (symmetric) sparsity pattern of the \f$m \times m\f$ matrix \f$A\f$
+*  stored in CSR format. The permutation is returned in \p perm, such that row and column
+*  \f$i\f$ of the reordered matrix \f$B = P A P^T\f$ are row and column \p perm[i] of
+*  \f$A\f$, i.e.
+*  \f[
+*    B_{ij} = A_{perm[i], perm[j]}.
+*  \f]
+*  \p perm is zero based, independent of the index base of \f$A\f$.
+*
+*  Each connected component of the graph is numbered by a breadth first search, starting
+*  from a pseudo-peripheral vertex found by the algorithm of George and Liu. The vertices
+*  of each level are numbered in order of their first numbered neighbor in the previous
+*  level and then by increasing degree, which gives the sequential Cuthill-McKee ordering.
+*  Isolated vertices are numbered first. The resulting ordering is reversed.
+*
+*  The matrix \f$A\f$ must be stored as a general matrix with a symmetric sparsity
+*  pattern. If the sparsity pattern of \f$A\f$ is non-symmetric, then the user is
+*  responsible to provide the sparsity pattern of \f$A+A^T\f$. Diagonal entries are
+*  ignored.
+*
+*  \note
+*  This function is blocking with respect to the host, as each level of the breadth first
+*  search requires the size of the previous level to be known on the host.
+*
+*  \note
+*  This function requires a temporary storage buffer, which size is returned by
+*  rocsparse_csrrcm_buffer_size().
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  perm            array of \p m integers containing the reverse Cuthill-McKee
+*                  permutation.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csrrcm_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p perm or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or the
+*              \ref rocsparse_graph_mode is \ref rocsparse_graph_mode_enabled.
+*
+*  \par Example
+*  The following example reorders a sparse matrix and permutes its rows and columns.
+*  \code{.c}
+*      // Obtain the temporary buffer size
+*      size_t buffer_size;
+*      rocsparse_csrrcm_buffer_size(handle,
+*                                   m,
+*                                   nnz,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Compute the reverse Cuthill-McKee permutation
+*      rocsparse_int* perm;
+*      hipMalloc((void**)&perm, sizeof(rocsparse_int) * m);
+*
+*      rocsparse_csrrcm(handle,
+*                       m,
+*                       nnz,
+*                       descr,
+*                       csr_row_ptr,
+*                       csr_col_ind,
+*                       perm,
+*                       temp_buffer);
+*
+*      // The rows of B = P A P^T can now be gathered from the rows perm[i] of A,
+*      // the columns of B are obtained by the inverse permutation and re-sorted
+*      // using rocsparse_csrsort().
+*  \endcode
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_int*            perm,
+                                  void*                     temp_buffer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -107,6 +107,26 @@ typedef struct _rocsparse_dnmat_descr* rocsparse_dnmat_descr;
 
 typedef struct _rocsparse_color_info* rocsparse_color_info;
 
+/*! \ingroup types_module
+ *  \brief Callback that receives a chunk of rows of a sparse CSR matrix.
+ *
+ *  \details
+ *  The \ref rocsparse_csrgemm_chunk_callback is invoked by rocsparse_scsrgemm_chunked(),
+ *  rocsparse_dcsrgemm_chunked(), rocsparse_ccsrgemm_chunked() and
+ *  rocsparse_zcsrgemm_chunked() for each chunk of rows \p row_begin to \p row_end of
+ *  the sparse CSR matrix \f$C\f$, in ascending order. The \p row_end - \p row_begin + 1
+ *  row pointers of the chunk start at the index base of \f$C\f$. \p csr_row_ptr,
+ *  \p csr_col_ind and \p csr_val point to host memory, that is only valid until the
+ *  callback returns.
+ */
+typedef void (*rocsparse_csrgemm_chunk_callback)(rocsparse_int        row_begin,
+                                                 rocsparse_int        row_end,
+                                                 rocsparse_int        nnz,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 const void*          csr_val,
+                                                 void*                user_data);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -224,9 +244,11 @@ typedef enum rocsparse_direction_
  */
 typedef enum rocsparse_hyb_partition_
 {
-    rocsparse_hyb_partition_auto = 0, /**< automatically decide on ELL nnz per row. */
-    rocsparse_hyb_partition_user = 1, /**< user given ELL nnz per row. */
-    rocsparse_hyb_partition_max  = 2 /**< max ELL nnz per row, no COO part. */
+    rocsparse_hyb_partition_auto      = 0, /**< automatically decide on ELL nnz per row. */
+    rocsparse_hyb_partition_user      = 1, /**< user given ELL nnz per row. */
+    rocsparse_hyb_partition_max       = 2, /**< max ELL nnz per row, no COO part. */
+    rocsparse_hyb_partition_histogram = 3 /**< ELL nnz per row from a row length histogram,
+                                               minimizing the modelled hybmv cost. */
 } rocsparse_hyb_partition;
 
 /*! \ingroup types_module
@@ -248,13 +270,37 @@ typedef enum rocsparse_analysis_policy_
  *  \brief Specify policy in triangular solvers and factorizations.
  *
  *  \details
- *  This is a placeholder.
+ *  The \ref rocsparse_solve_policy specifies how the dependencies between the rows of a
+ *  triangular system are resolved. The sync-free solve launches all rows at once and
+ *  each row waits until its dependencies have been solved. The level set solve uses the
+ *  levels that have been determined during the analysis, and solves all rows of a level
+ *  with a single kernel launch, such that no row has to wait for its dependencies. With
+ *  \ref rocsparse_solve_policy_auto, the solve is chosen from the number of levels and
+ *  their width. Currently, only rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(),
+ *  rocsparse_ccsrsv_solve() and rocsparse_zcsrsv_solve() take the policy into account.
  */
 typedef enum rocsparse_solve_policy_
 {
-    rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
+    rocsparse_solve_policy_auto      = 0, /**< automatically decide on level information. */
+    rocsparse_solve_policy_level_set = 1, /**< one kernel launch per level. */
+    rocsparse_solve_policy_sync_free = 2 /**< single kernel launch, rows wait for dependencies. */
 } rocsparse_solve_policy;
 
+/*! \ingroup types_module
+ *  \brief Specify the sweep direction of the multicolor SOR smoother.
+ *
+ *  \details
+ *  The \ref rocsparse_sor_sweep specifies the order in which the colors are processed
+ *  by the multicolor SOR smoother. A symmetric sweep performs a forward sweep, followed
+ *  by a backward sweep.
+ */
+typedef enum rocsparse_sor_sweep_
+{
+    rocsparse_sor_sweep_forward   = 0, /**< process the colors in ascending order. */
+    rocsparse_sor_sweep_backward  = 1, /**< process the colors in descending order. */
+    rocsparse_sor_sweep_symmetric = 2 /**< forward sweep followed by a backward sweep. */
+} rocsparse_sor_sweep;
+
 /*! \ingroup types_module
  *  \brief Indicates if the pointer is device pointer or host pointer.
  *
@@ -270,6 +316,42 @@ typedef enum rocsparse_pointer_mode_
     rocsparse_pointer_mode_device = 1 /**< scalar pointers are in device memory. */
 } rocsparse_pointer_mode;
 
+/*! \ingroup types_module
+ *  \brief Indicates if bitwise reproducible results are required.
+ *
+ *  \details
+ *  The \ref rocsparse_deterministic_mode indicates whether routines that accumulate
+ *  with atomics should switch to variants with a fixed summation order, such that
+ *  repeated runs produce bitwise identical results. The
+ *  \ref rocsparse_deterministic_mode can be changed by rocsparse_set_deterministic_mode().
+ *  The currently used deterministic mode can be obtained by
+ *  rocsparse_get_deterministic_mode().
+ */
+typedef enum rocsparse_deterministic_mode_
+{
+    rocsparse_deterministic_mode_disabled = 0, /**< results may vary between runs. */
+    rocsparse_deterministic_mode_enabled  = 1 /**< results are bitwise reproducible. */
+} rocsparse_deterministic_mode;
+
+/*! \ingroup types_module
+ *  \brief Indicates if only asynchronous work may be enqueued.
+ *
+ *  \details
+ *  The \ref rocsparse_graph_mode indicates whether compute stages are allowed to
+ *  synchronize the stream, e.g. to read scalar results back to the host. If
+ *  \ref rocsparse_graph_mode_enabled is set, graph-safe routines enqueue only
+ *  asynchronous work, such that they can be captured into a HIP graph, and
+ *  routines that cannot avoid a synchronization return
+ *  \ref rocsparse_status_not_implemented. The \ref rocsparse_graph_mode can be
+ *  changed by rocsparse_set_graph_mode(). The currently used graph mode can be
+ *  obtained by rocsparse_get_graph_mode().
+ */
+typedef enum rocsparse_graph_mode_
+{
+    rocsparse_graph_mode_disabled = 0, /**< routines may synchronize the stream. */
+    rocsparse_graph_mode_enabled  = 1 /**< routines enqueue asynchronous work only. */
+} rocsparse_graph_mode;
+
 /*! \ingroup types_module
  *  \brief Indicates if layer is active with bitmask.
  *
@@ -521,13 +603,20 @@ typedef enum rocsparse_spmm_stage_
  *  \details
  *  This is a list of possible stages during SpGEMM computation. Typical order is
  *  rocsparse_spgemm_buffer_size, rocsparse_spgemm_nnz, rocsparse_spgemm_compute.
+ *  If the sparsity pattern of the product does not change, rocsparse_spgemm_compute
+ *  can be replaced by rocsparse_spgemm_symbolic once, followed by any number of
+ *  rocsparse_spgemm_numeric stages.
  */
 typedef enum rocsparse_spgemm_stage_
 {
     rocsparse_spgemm_stage_auto        = 0, /**< Automatic stage detection. */
     rocsparse_spgemm_stage_buffer_size = 1, /**< Returns the required buffer size. */
     rocsparse_spgemm_stage_nnz         = 2, /**< Computes number of non-zero entries. */
-    rocsparse_spgemm_stage_compute     = 3 /**< Performs the actual SpGEMM computation. */
+    rocsparse_spgemm_stage_compute     = 3, /**< Performs the actual SpGEMM computation. */
+    rocsparse_spgemm_stage_symbolic    = 4, /**< Performs the SpGEMM computation and stores
+                                                 the symbolic plan for numeric stages. */
+    rocsparse_spgemm_stage_numeric     = 5 /**< Recomputes the values of C using the symbolic
+                                                plan. */
 } rocsparse_spgemm_stage;
 
 /*! \ingroup types_module
@@ -542,6 +631,76 @@ typedef enum rocsparse_spgemm_alg_
     rocsparse_spgemm_alg_default = 0 /**< Default SpGEMM algorithm for the given format. */
 } rocsparse_spgemm_alg;
 
+/*! \ingroup types_module
+ *  \brief Specify how the mask is applied in masked SpGEMM.
+ *
+ *  \details
+ *  The \ref rocsparse_csrgemm_mask indicates whether the sparsity pattern of the product
+ *  is restricted to the sparsity pattern of the mask, or to its complement.
+ */
+typedef enum rocsparse_csrgemm_mask_
+{
+    rocsparse_csrgemm_mask_keep       = 0, /**< keep entries inside the mask. */
+    rocsparse_csrgemm_mask_complement = 1 /**< keep entries outside the mask. */
+} rocsparse_csrgemm_mask;
+
+/*! \ingroup types_module
+ *  \brief List of masked SpGEMM algorithms.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_csrgemm_masked_alg types that are used to
+ *  compute the values of a masked sparse matrix sparse matrix product.
+ */
+typedef enum rocsparse_csrgemm_masked_alg_
+{
+    rocsparse_csrgemm_masked_alg_default = 0, /**< selected from the density of the operands. */
+    rocsparse_csrgemm_masked_alg_dot     = 1, /**< dot products of rows of A and columns of B. */
+    rocsparse_csrgemm_masked_alg_row     = 2 /**< row-wise products, dropped outside the mask. */
+} rocsparse_csrgemm_masked_alg;
+
+/*! \ingroup types_module
+ *  \brief List of interleaved batched tridiagonal solver algorithms.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_gtsv_interleaved_alg types that are used
+ *  to solve batches of tridiagonal systems stored in interleaved format.
+ */
+typedef enum rocsparse_gtsv_interleaved_alg_
+{
+    rocsparse_gtsv_interleaved_alg_default = 0, /**< same as QR. */
+    rocsparse_gtsv_interleaved_alg_thomas  = 1, /**< Thomas algorithm without pivoting. */
+    rocsparse_gtsv_interleaved_alg_pcr     = 2, /**< parallel cyclic reduction. */
+    rocsparse_gtsv_interleaved_alg_lu      = 3, /**< LU with partial pivoting. */
+    rocsparse_gtsv_interleaved_alg_qr      = 4 /**< QR using Givens rotations. */
+} rocsparse_gtsv_interleaved_alg;
+
+/*! \ingroup types_module
+ *  \brief List of interleaved batched pentadiagonal solver algorithms.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_gpsv_interleaved_alg types that are used
+ *  to solve batches of pentadiagonal systems stored in interleaved format.
+ */
+typedef enum rocsparse_gpsv_interleaved_alg_
+{
+    rocsparse_gpsv_interleaved_alg_default = 0, /**< same as QR. */
+    rocsparse_gpsv_interleaved_alg_qr      = 1 /**< QR using Givens rotations. */
+} rocsparse_gpsv_interleaved_alg;
+
+/*! \ingroup types_module
+ *  \brief List of bsrdiag_inverse algorithms.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_bsrdiag_inverse_alg types that are used
+ *  to invert the diagonal blocks of a sparse BSR matrix.
+ */
+typedef enum rocsparse_bsrdiag_inverse_alg_
+{
+    rocsparse_bsrdiag_inverse_alg_default       = 0, /**< same as partial pivoting. */
+    rocsparse_bsrdiag_inverse_alg_no_pivot      = 1, /**< Gauss-Jordan without pivoting. */
+    rocsparse_bsrdiag_inverse_alg_partial_pivot = 2 /**< Gauss-Jordan with partial pivoting. */
+} rocsparse_bsrdiag_inverse_alg;
+
 #ifdef __cplusplus
 }
 #endif
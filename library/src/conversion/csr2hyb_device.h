@@ -59,6 +59,29 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void hyb_coo_nnz(rocsparse_int
     }
 }
 
+// Histogram of CSR row lengths, rows exceeding max_width are skipped.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void hyb_row_nnz_histogram(rocsparse_int        m,
+                               rocsparse_int        max_width,
+                               const rocsparse_int* csr_row_ptr,
+                               rocsparse_int*       histogram)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_nnz = csr_row_ptr[gid + 1] - csr_row_ptr[gid];
+
+    if(row_nnz <= max_width)
+    {
+        atomicAdd(&histogram[row_nnz], 1);
+    }
+}
+
 // CSR to HYB format conversion kernel
 template <unsigned int BLOCKSIZE, typename T>
 __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void csr2hyb_kernel(rocsparse_int        m,
@@ -31,6 +31,16 @@
 
 #include <rocprim/rocprim.hpp>
 
+// Modelled hybmv cost in bytes of matrix data. Each (padded) ELL entry reads a column
+// index and a value, each COO entry additionally reads its row index.
+template <typename T>
+static inline int64_t
+    rocsparse_hyb_partition_cost(rocsparse_int m, rocsparse_int ell_width, rocsparse_int coo_nnz)
+{
+    return static_cast<int64_t>(m) * ell_width * (sizeof(rocsparse_int) + sizeof(T))
+           + static_cast<int64_t>(coo_nnz) * (2 * sizeof(rocsparse_int) + sizeof(T));
+}
+
 template <typename T>
 rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
                                             rocsparse_int             m,
@@ -125,8 +135,8 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     // Correct by index base
     csr_nnz -= descr->base;
 
-    // Maximum ELL row width allowed
-    rocsparse_int max_row_nnz = 2 * (csr_nnz - 1) / m + 1;
+    // Maximum ELL row width allowed, which is zero for a single empty row
+    rocsparse_int max_row_nnz = std::max(2 * (csr_nnz - 1) / m + 1, 0);
 
     // Check user_ell_width
     if(partition_type == rocsparse_hyb_partition_user)
@@ -151,6 +161,8 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
     hyb->ell_width = 0;
     hyb->coo_nnz   = 0;
 
+    hyb->predicted_cost = 0;
+
     if(hyb->ell_col_ind)
     {
         RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
@@ -188,6 +200,63 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         // ELL width determined by average nnz per row
         hyb->ell_width = (csr_nnz - 1) / m + 1;
     }
+    else if(partition_type == rocsparse_hyb_partition_histogram && csr_nnz == 0)
+    {
+        // Without non-zero entries, there is no row length to build a histogram from
+        hyb->ell_width = 0;
+    }
+    else if(partition_type == rocsparse_hyb_partition_histogram)
+    {
+        // Allocate histogram of row lengths
+        rocsparse_int* histogram = nullptr;
+        RETURN_IF_HIP_ERROR(
+            hipMalloc((void**)&histogram, sizeof(rocsparse_int) * (max_row_nnz + 1)));
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(histogram, 0, sizeof(rocsparse_int) * (max_row_nnz + 1), stream));
+
+        hipLaunchKernelGGL((hyb_row_nnz_histogram<CSR2ELL_DIM>),
+                           dim3(blocks),
+                           dim3(CSR2ELL_DIM),
+                           0,
+                           stream,
+                           m,
+                           max_row_nnz,
+                           csr_row_ptr,
+                           histogram);
+
+        // Copy histogram back to host
+        std::vector<rocsparse_int> hist(max_row_nnz + 1);
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(hist.data(),
+                                           histogram,
+                                           sizeof(rocsparse_int) * (max_row_nnz + 1),
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        RETURN_IF_HIP_ERROR(hipFree(histogram));
+
+        // Pick the ELL width with minimal modelled cost. Increasing the width by one
+        // moves one entry of each longer row from COO to ELL, while padding all others.
+        rocsparse_int coo_nnz     = csr_nnz;
+        rocsparse_int rows_longer = m - hist[0];
+        int64_t       min_cost    = rocsparse_hyb_partition_cost<T>(m, 0, coo_nnz);
+
+        for(rocsparse_int width = 1; width <= max_row_nnz; ++width)
+        {
+            coo_nnz -= rows_longer;
+            rows_longer -= hist[width];
+
+            int64_t cost = rocsparse_hyb_partition_cost<T>(m, width, coo_nnz);
+
+            if(cost < min_cost)
+            {
+                min_cost       = cost;
+                hyb->ell_width = width;
+            }
+        }
+    }
     else
     {
         // Allocate workspace
@@ -310,6 +379,9 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle          handle,
         }
     }
 
+    // Modelled hybmv cost of the chosen partitioning
+    hyb->predicted_cost = rocsparse_hyb_partition_cost<T>(m, hyb->ell_width, hyb->coo_nnz);
+
     // Allocate COO part
     if(hyb->coo_nnz > 0)
     {
@@ -0,0 +1,262 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRGEAM_DEVICE_H
+#define BSRGEAM_DEVICE_H
+
+#include "common.h"
+
+// Determine the number of entries in a sorted array that are smaller than key
+static __device__ __forceinline__ rocsparse_int bsrgeam_lower_bound(
+    const rocsparse_int* __restrict__ data, rocsparse_int size, rocsparse_int key)
+{
+    rocsparse_int lo = 0;
+    rocsparse_int hi = size;
+
+    while(lo < hi)
+    {
+        rocsparse_int mid = (lo + hi) >> 1;
+
+        if(data[mid] < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// Compute matrix addition of BSR matrices, where each block row is processed by a single
+// block. First, the block column indices of A and B are merged into the block row of C by
+// the first wavefront, chunk by chunk, as in the csrgeam fill. Then, the position of each
+// block of A and B within the block row of C is obtained by binary search, where blocks
+// that exist in A and B are accumulated. Each thread processes a single entry of a block,
+// such that the storage direction of the blocks is irrelevant.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void bsrgeam_fill_block_per_row_device(rocsparse_int nb,
+                                                  rocsparse_int block_dim,
+                                                  T             alpha,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                                  const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                                  const T* __restrict__ bsr_val_A,
+                                                  T beta,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                                  const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                                  const T* __restrict__ bsr_val_B,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                                  rocsparse_int* __restrict__ bsr_col_ind_C,
+                                                  T* __restrict__ bsr_val_C,
+                                                  rocsparse_index_base idx_base_A,
+                                                  rocsparse_index_base idx_base_B,
+                                                  rocsparse_index_base idx_base_C)
+{
+    // Each block processes a block row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Number of entries per block
+    rocsparse_int bsize = block_dim * block_dim;
+
+    // Get block row entry and exit point of A
+    rocsparse_int row_begin_A = bsr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_nnzb_A  = bsr_row_ptr_A[row + 1] - idx_base_A - row_begin_A;
+
+    // Get block row entry and exit point of B
+    rocsparse_int row_begin_B = bsr_row_ptr_B[row] - idx_base_B;
+    rocsparse_int row_nnzb_B  = bsr_row_ptr_B[row + 1] - idx_base_B - row_begin_B;
+
+    // Get block row entry and exit point of C
+    rocsparse_int row_begin_C = bsr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_nnzb_C  = bsr_row_ptr_C[row + 1] - idx_base_C - row_begin_C;
+
+    // Block column marker of the current chunk
+    __shared__ bool table[WFSIZE];
+
+    // The first wavefront merges the block column indices of A and B
+    if(hipThreadIdx_x < WFSIZE)
+    {
+        rocsparse_int lid = hipThreadIdx_x;
+
+        rocsparse_int row_end_A = row_begin_A + row_nnzb_A;
+        rocsparse_int row_end_B = row_begin_B + row_nnzb_B;
+
+        // Load the first block column of A and B to set the starting point for the first
+        // chunk
+        rocsparse_int col_A = (row_nnzb_A > 0) ? bsr_col_ind_A[row_begin_A] - idx_base_A : nb;
+        rocsparse_int col_B = (row_nnzb_B > 0) ? bsr_col_ind_B[row_begin_B] - idx_base_B : nb;
+
+        // Begin of the current row chunk
+        rocsparse_int chunk_begin = min(col_A, col_B);
+
+        // Initialize the index for block column access into A, B and C
+        rocsparse_int idx_A = row_begin_A + lid;
+        rocsparse_int idx_B = row_begin_B + lid;
+        rocsparse_int idx_C = row_begin_C;
+
+        // Loop over the chunks until the end of both block rows has been reached
+        while(chunk_begin < nb)
+        {
+            // Initialize block column marker
+            table[lid] = false;
+
+            __threadfence_block();
+
+            // Initialize the beginning of the next chunk
+            rocsparse_int min_col = nb;
+
+            // Loop over all block columns of A, starting with the first entry that did
+            // not fit into the previous chunk
+            for(; idx_A < row_end_A; idx_A += WFSIZE)
+            {
+                rocsparse_int shf_A = bsr_col_ind_A[idx_A] - idx_base_A - chunk_begin;
+
+                if(shf_A < WFSIZE)
+                {
+                    table[shf_A] = true;
+                }
+                else
+                {
+                    min_col = min(min_col, shf_A + chunk_begin);
+                    break;
+                }
+            }
+
+            // Loop over all block columns of B, starting with the first entry that did
+            // not fit into the previous chunk
+            for(; idx_B < row_end_B; idx_B += WFSIZE)
+            {
+                rocsparse_int shf_B = bsr_col_ind_B[idx_B] - idx_base_B - chunk_begin;
+
+                if(shf_B < WFSIZE)
+                {
+                    table[shf_B] = true;
+                }
+                else
+                {
+                    min_col = min(min_col, shf_B + chunk_begin);
+                    break;
+                }
+            }
+
+            __threadfence_block();
+
+            // Each lane checks whether its block column is populated or not
+            bool has_nnzb = table[lid];
+
+            // Obtain the bitmask that marks the position of each populated block column
+            unsigned long long mask = __ballot(has_nnzb);
+
+            if(has_nnzb)
+            {
+                rocsparse_int offset;
+
+                // Compute the lane's fill position in C
+                if(WFSIZE == 32)
+                {
+                    offset = __popc(mask & (0xffffffff >> (WFSIZE - 1 - lid)));
+                }
+                else
+                {
+                    offset = __popcll(mask & (0xffffffffffffffff >> (WFSIZE - 1 - lid)));
+                }
+
+                bsr_col_ind_C[idx_C + offset - 1] = lid + chunk_begin + idx_base_C;
+            }
+
+            // Shift the block row entry to C by the number of blocks of the current chunk
+            idx_C += __popcll(mask);
+
+            // Gather wavefront-wide minimum for the next chunks starting block column
+            for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+            {
+                min_col = min(min_col, __shfl_xor(min_col, i));
+            }
+
+            chunk_begin = min_col;
+        }
+    }
+
+    // Wait for the block column indices of C to be written
+    __syncthreads();
+
+    // Loop over all entries of the blocks of A
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnzb_A * bsize; i += BLOCKSIZE)
+    {
+        // Block and entry within the block
+        rocsparse_int j = i / bsize;
+        rocsparse_int e = i % bsize;
+
+        // Block column of A
+        rocsparse_int col = bsr_col_ind_A[row_begin_A + j] - idx_base_A;
+
+        // Position of the block in C
+        rocsparse_int idx
+            = row_begin_C
+              + bsrgeam_lower_bound(&bsr_col_ind_C[row_begin_C], row_nnzb_C, col + idx_base_C);
+
+        bsr_val_C[bsize * idx + e] = alpha * bsr_val_A[bsize * (row_begin_A + j) + e];
+    }
+
+    // Wait for all blocks of A to be written
+    __syncthreads();
+
+    // Loop over all entries of the blocks of B
+    for(rocsparse_int i = hipThreadIdx_x; i < row_nnzb_B * bsize; i += BLOCKSIZE)
+    {
+        // Block and entry within the block
+        rocsparse_int j = i / bsize;
+        rocsparse_int e = i % bsize;
+
+        // Block column of B
+        rocsparse_int col = bsr_col_ind_B[row_begin_B + j] - idx_base_B;
+
+        // Number of blocks of A with smaller block column index
+        rocsparse_int k
+            = bsrgeam_lower_bound(&bsr_col_ind_A[row_begin_A], row_nnzb_A, col + idx_base_A);
+
+        // Position of the block in C
+        rocsparse_int idx
+            = row_begin_C
+              + bsrgeam_lower_bound(&bsr_col_ind_C[row_begin_C], row_nnzb_C, col + idx_base_C);
+
+        // Value of B
+        T val_B = bsr_val_B[bsize * (row_begin_B + j) + e];
+
+        if(k < row_nnzb_A && bsr_col_ind_A[row_begin_A + k] - idx_base_A == col)
+        {
+            // Block exists in A, add values of B
+            bsr_val_C[bsize * idx + e] = rocsparse_fma(beta, val_B, bsr_val_C[bsize * idx + e]);
+        }
+        else
+        {
+            bsr_val_C[bsize * idx + e] = beta * val_B;
+        }
+    }
+}
+
+#endif // BSRGEAM_DEVICE_H
@@ -0,0 +1,322 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRGEMM_DEVICE_H
+#define BSRGEMM_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+
+// Compute the block sparsity pattern of A * B, where each block row of C is processed by
+// a single block, see csrgemm_symbolic_chunked_block_per_row_device().
+// If FILL is false, the number of non-zero blocks of each block row is written to
+// bsr_row_ptr_C, otherwise the block column indices of C are written.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE, bool FILL>
+__device__ void
+    bsrgemm_symbolic_block_per_row_device(rocsparse_int nb,
+                                          const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                          const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                          const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                          const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                          rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                          rocsparse_int* __restrict__ bsr_col_ind_C,
+                                          rocsparse_index_base idx_base_A,
+                                          rocsparse_index_base idx_base_B,
+                                          rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a block row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Get block row boundaries of the current block row in A
+    rocsparse_int row_begin_A = bsr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = bsr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Offset into C
+    rocsparse_int row_begin_C = (FILL == true) ? bsr_row_ptr_C[row] - idx_base_C : 0;
+
+    // Mark the block products of the current chunk
+    auto mark = [&](rocsparse_int  chunk_begin,
+                    rocsparse_int  chunk_end,
+                    bool*          table,
+                    rocsparse_int& min_col) {
+        // Loop over block columns of A in current block row
+        for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Block column of A in current block row
+            rocsparse_int col_A = bsr_col_ind_A[j] - idx_base_A;
+
+            // Loop over block columns of B in block row col_A
+            rocsparse_int row_begin_B = bsr_row_ptr_B[col_A] - idx_base_B;
+            rocsparse_int row_end_B   = bsr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            for(rocsparse_int k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            {
+                // Block column of B in block row col_A
+                rocsparse_int col_B = bsr_col_ind_B[k] - idx_base_B;
+
+                if(col_B >= chunk_end)
+                {
+                    // Block columns of B are sorted, thus the remaining block columns
+                    // are part of subsequent chunks
+                    min_col = min(min_col, col_B);
+                    break;
+                }
+
+                if(col_B >= chunk_begin)
+                {
+                    // Mark nnz table if entry at col_B
+                    table[col_B - chunk_begin] = true;
+                }
+            }
+        }
+    };
+
+    // Write the block column indices of C
+    auto write = [&](rocsparse_int pos, rocsparse_int col, bool) {
+        bsr_col_ind_C[row_begin_C + pos] = col + idx_base_C;
+    };
+
+    rocsparse_int row_nnzb
+        = csrgemm_symbolic_chunked_block_per_row_device<BLOCKSIZE, CHUNKSIZE, FILL, rocsparse_int>(
+            nb, false, mark, write);
+
+    // Write block row nnzb to global memory
+    if(FILL == false && hipThreadIdx_x == 0)
+    {
+        bsr_row_ptr_C[row] = row_nnzb;
+    }
+}
+
+// Determine the position of key within a sorted array, or -1 if key is not present
+static __device__ __forceinline__ rocsparse_int
+    bsrgemm_binary_search(const rocsparse_int* __restrict__ data,
+                          rocsparse_int begin,
+                          rocsparse_int end,
+                          rocsparse_int key)
+{
+    rocsparse_int lo = begin;
+    rocsparse_int hi = end;
+
+    while(lo < hi)
+    {
+        rocsparse_int mid = (lo + hi) >> 1;
+
+        if(data[mid] < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return (lo < end && data[lo] == key) ? lo : -1;
+}
+
+// Compute the blocks of C = alpha * A * B for the given block sparsity pattern of C,
+// where each block row of C is processed by a single block. Each block of C is computed
+// by a group of BSRDIM threads, where each thread accumulates a row of the block in
+// registers. Blocks of A are processed sequentially and the matching block of B is
+// determined by binary search. Thus, the summation order is fixed and no atomics are
+// required.
+template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T>
+__device__ void bsrgemm_fill_block_per_row_device(rocsparse_direction dir,
+                                                  T                   alpha,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                                  const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                                  const T* __restrict__ bsr_val_A,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                                  const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                                  const T* __restrict__ bsr_val_B,
+                                                  const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                                  const rocsparse_int* __restrict__ bsr_col_ind_C,
+                                                  T* __restrict__ bsr_val_C,
+                                                  rocsparse_index_base idx_base_A,
+                                                  rocsparse_index_base idx_base_B,
+                                                  rocsparse_index_base idx_base_C)
+{
+    // BSR block dimension
+    static constexpr rocsparse_int block_dim = BSRDIM;
+
+    // Number of blocks of C that are processed simultaneously
+    static constexpr unsigned int GROUPS = BLOCKSIZE / BSRDIM;
+
+    // Group id
+    rocsparse_int gid = hipThreadIdx_x / BSRDIM;
+
+    // Row of the block, that is processed by this thread
+    rocsparse_int bi = hipThreadIdx_x % BSRDIM;
+
+    // Do not run out of bounds
+    if(gid >= GROUPS)
+    {
+        return;
+    }
+
+    // Each block processes a block row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Get block row boundaries of the current block row in A
+    rocsparse_int row_begin_A = bsr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = bsr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Get block row boundaries of the current block row in C
+    rocsparse_int row_begin_C = bsr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_end_C   = bsr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Loop over the blocks of C in current block row
+    for(rocsparse_int j = row_begin_C + gid; j < row_end_C; j += GROUPS)
+    {
+        // Block column of C, shifted into the index base of B
+        rocsparse_int col_C = bsr_col_ind_C[j] - idx_base_C + idx_base_B;
+
+        // Row of the block of C
+        T sum[BSRDIM];
+
+        for(unsigned int bj = 0; bj < BSRDIM; ++bj)
+        {
+            sum[bj] = static_cast<T>(0);
+        }
+
+        // Loop over the blocks of A in current block row
+        for(rocsparse_int k = row_begin_A; k < row_end_A; ++k)
+        {
+            // Block column of A
+            rocsparse_int col_A = bsr_col_ind_A[k] - idx_base_A;
+
+            // Search for the block of B that contributes to the block of C
+            rocsparse_int l = bsrgemm_binary_search(bsr_col_ind_B,
+                                                    bsr_row_ptr_B[col_A] - idx_base_B,
+                                                    bsr_row_ptr_B[col_A + 1] - idx_base_B,
+                                                    col_C);
+
+            if(l == -1)
+            {
+                continue;
+            }
+
+            // Multiply the row of the block of A with the block of B
+            for(unsigned int bk = 0; bk < BSRDIM; ++bk)
+            {
+                T val_A = bsr_val_A[BSR_IND(k, bi, bk, dir)];
+
+                for(unsigned int bj = 0; bj < BSRDIM; ++bj)
+                {
+                    sum[bj] = rocsparse_fma(val_A, bsr_val_B[BSR_IND(l, bk, bj, dir)], sum[bj]);
+                }
+            }
+        }
+
+        // Write the row of the block of C
+        for(unsigned int bj = 0; bj < BSRDIM; ++bj)
+        {
+            bsr_val_C[BSR_IND(j, bi, bj, dir)] = alpha * sum[bj];
+        }
+    }
+}
+
+// Compute the blocks of C = alpha * A * B for the given block sparsity pattern of C and
+// arbitrary block dimension, where each block row of C is processed by a single block and
+// each thread computes a single entry of a block of C.
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void
+    bsrgemm_fill_general_block_per_row_device(rocsparse_direction dir,
+                                              rocsparse_int       block_dim,
+                                              T                   alpha,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                              const T* __restrict__ bsr_val_A,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                              const T* __restrict__ bsr_val_B,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_C,
+                                              T* __restrict__ bsr_val_C,
+                                              rocsparse_index_base idx_base_A,
+                                              rocsparse_index_base idx_base_B,
+                                              rocsparse_index_base idx_base_C)
+{
+    // Each block processes a block row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Number of entries per block
+    rocsparse_int bsize = block_dim * block_dim;
+
+    // Get block row boundaries of the current block row in A
+    rocsparse_int row_begin_A = bsr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = bsr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Get block row boundaries of the current block row in C
+    rocsparse_int row_begin_C = bsr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_end_C   = bsr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Loop over all entries of the blocks of C in current block row
+    for(rocsparse_int i = hipThreadIdx_x; i < (row_end_C - row_begin_C) * bsize; i += BLOCKSIZE)
+    {
+        // Block and entry within the block
+        rocsparse_int j  = row_begin_C + i / bsize;
+        rocsparse_int bi = (i % bsize) / block_dim;
+        rocsparse_int bj = (i % bsize) % block_dim;
+
+        // Block column of C, shifted into the index base of B
+        rocsparse_int col_C = bsr_col_ind_C[j] - idx_base_C + idx_base_B;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over the blocks of A in current block row
+        for(rocsparse_int k = row_begin_A; k < row_end_A; ++k)
+        {
+            // Block column of A
+            rocsparse_int col_A = bsr_col_ind_A[k] - idx_base_A;
+
+            // Search for the block of B that contributes to the block of C
+            rocsparse_int l = bsrgemm_binary_search(bsr_col_ind_B,
+                                                    bsr_row_ptr_B[col_A] - idx_base_B,
+                                                    bsr_row_ptr_B[col_A + 1] - idx_base_B,
+                                                    col_C);
+
+            if(l == -1)
+            {
+                continue;
+            }
+
+            for(rocsparse_int bk = 0; bk < block_dim; ++bk)
+            {
+                sum = rocsparse_fma(
+                    bsr_val_A[BSR_IND(k, bi, bk, dir)], bsr_val_B[BSR_IND(l, bk, bj, dir)], sum);
+            }
+        }
+
+        bsr_val_C[BSR_IND(j, bi, bj, dir)] = alpha * sum;
+    }
+}
+
+#endif // BSRGEMM_DEVICE_H
@@ -364,6 +364,37 @@ static __device__ __forceinline__ bool insert_key(I key, I* __restrict__ table)
     return false;
 }
 
+// Hash operation to insert key into hash table, where empty entries are marked by empty
+template <unsigned int HASHVAL, unsigned int HASHSIZE, typename I>
+static __device__ __forceinline__ void insert_key(I key, I* __restrict__ table, I empty)
+{
+    // Compute hash
+    I hash = (key * HASHVAL) & (HASHSIZE - 1);
+
+    // Loop until key has been inserted
+    while(true)
+    {
+        if(table[hash] == key)
+        {
+            // Element already present
+            break;
+        }
+        else if(table[hash] == empty)
+        {
+            // If empty, add element with atomic
+            if(atomicCAS(&table[hash], empty, key) == empty)
+            {
+                break;
+            }
+        }
+        else
+        {
+            // Linear probing, when hash is collided, try next entry
+            hash = (hash + 1) & (HASHSIZE - 1);
+        }
+    }
+}
+
 // Hash operation to insert pair into hash table
 template <unsigned int HASHVAL, unsigned int HASHSIZE, typename I, typename T>
 static __device__ __forceinline__ void
@@ -835,7 +866,132 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
     }
 }
 
+// Compute the sparsity pattern of a single row, where the row is processed by a single
+// block. Columns in [0, n) are processed in chunks, such that shared memory can be used to
+// hold a value for each column of the current chunk, where empty marks an unpopulated
+// column. For each chunk, all threads of the block call
+//     mark(chunk_begin, chunk_end, table, min_col)
+// which populates the entries of table that belong to [chunk_begin, chunk_end) and lowers
+// min_col to the smallest candidate column that is part of a subsequent chunk. mark may
+// synchronize the block, e.g. to remove entries after all candidates have been marked.
+// Each thread compacts a contiguous segment of the chunk, such that, if FILL is true,
+//     write(pos, col, val)
+// is called for each populated column in ascending order, where pos is the position of
+// the entry within the row. Returns the number of non-zero entries of the row.
+template <unsigned int BLOCKSIZE,
+          unsigned int CHUNKSIZE,
+          bool         FILL,
+          typename I,
+          typename J,
+          typename V,
+          typename MARK,
+          typename WRITE>
+__device__ I csrgemm_symbolic_chunked_block_per_row_device(J n, V empty, MARK mark, WRITE write)
+{
+    // Number of chunk entries that are compacted by each thread
+    static constexpr unsigned int SEGSIZE = CHUNKSIZE / BLOCKSIZE;
+
+    // Value of each chunk entry
+    __shared__ V table[CHUNKSIZE];
+
+    // Segment offsets of the current chunk
+    __shared__ I scan[BLOCKSIZE];
+
+    // Shared memory to determine the minimum of all candidate column indices that exceed
+    // the current chunk
+    __shared__ J next_chunk;
+
+    // Number of non-zero entries of the row, that have been processed so far
+    I row_nnz = 0;
+
+    // Begin of the current row chunk
+    J chunk_begin = 0;
+
+    // Loop over the row chunks until the end of the row has been reached
+    while(chunk_begin < n)
+    {
+        J chunk_end = chunk_begin + CHUNKSIZE;
+
+        // Initialize chunk table
+        for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            table[i] = empty;
+        }
+
+        // Initialize next chunk column index
+        if(hipThreadIdx_x == 0)
+        {
+            next_chunk = n;
+        }
+
+        // Wait for all threads to finish initialization
+        __syncthreads();
+
+        // Initialize the beginning of the next chunk
+        J min_col = n;
+
+        // Populate the chunk
+        mark(chunk_begin, chunk_end, table, min_col);
+
+        // Atomically determine the new chunks beginning
+        atomicMin(&next_chunk, min_col);
+
+        // Wait for all threads to finish populating the chunk
+        __syncthreads();
+
+        // Number of non-zero entries in the segment of this thread
+        I seg_nnz = 0;
+
+        for(unsigned int i = 0; i < SEGSIZE; ++i)
+        {
+            seg_nnz += (table[hipThreadIdx_x * SEGSIZE + i] != empty) ? 1 : 0;
+        }
+
+        scan[hipThreadIdx_x] = seg_nnz;
+
+        __syncthreads();
+
+        // Inclusive scan of the segment nnz
+        for(unsigned int s = 1; s < BLOCKSIZE; s <<= 1)
+        {
+            I val = (hipThreadIdx_x >= s) ? scan[hipThreadIdx_x - s] : 0;
+
+            __syncthreads();
+
+            scan[hipThreadIdx_x] += val;
+
+            __syncthreads();
+        }
+
+        if(FILL == true)
+        {
+            // Position of the first entry of this segment
+            I pos = row_nnz + scan[hipThreadIdx_x] - seg_nnz;
+
+            for(unsigned int i = 0; i < SEGSIZE; ++i)
+            {
+                V val = table[hipThreadIdx_x * SEGSIZE + i];
+
+                if(val != empty)
+                {
+                    write(pos++, chunk_begin + hipThreadIdx_x * SEGSIZE + i, val);
+                }
+            }
+        }
+
+        // Accumulate the chunk nnz and load the new chunk beginning
+        row_nnz += scan[BLOCKSIZE - 1];
+        chunk_begin = next_chunk;
+
+        // Wait for all threads to finish load from shared memory
+        __syncthreads();
+    }
+
+    return row_nnz;
+}
+
 // Compute column entries and accumulate values, where each row is processed by a single wavefront
+// If csr_val_C is a null pointer, only the column entries are computed
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -924,9 +1080,17 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
             // Insert all columns of B into hash table
             for(I k = row_begin_B; k < row_end_B; ++k)
             {
-                // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                if(csr_val_C != nullptr)
+                {
+                    // Insert key value pair into hash table
+                    insert_pair<HASHVAL, HASHSIZE>(
+                        csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                }
+                else
+                {
+                    // Insert key into hash table
+                    insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table, nk);
+                }
             }
         }
     }
@@ -988,11 +1152,16 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
 
         // Write column and accumulated value to the obtained position in C
         csr_col_ind_C[idx_C] = col_C + idx_base_C;
-        csr_val_C[idx_C]     = data[i];
+
+        if(csr_val_C != nullptr)
+        {
+            csr_val_C[idx_C] = data[i];
+        }
     }
 }
 
 // Compute column entries and accumulate values, where each row is processed by a single block
+// If csr_val_C is a null pointer, only the column entries are computed
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
@@ -1067,9 +1236,17 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
 
             for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
             {
-                // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                if(csr_val_C != nullptr)
+                {
+                    // Insert key value pair into hash table
+                    insert_pair<HASHVAL, HASHSIZE>(
+                        csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                }
+                else
+                {
+                    // Insert key into hash table
+                    insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table, nk);
+                }
             }
         }
     }
@@ -1196,7 +1373,11 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
 
         // Write column and accumulated value to the obtain position in C
         csr_col_ind_C[idx_C] = col_C + idx_base_C;
-        csr_val_C[idx_C]     = val_C;
+
+        if(csr_val_C != nullptr)
+        {
+            csr_val_C[idx_C] = val_C;
+        }
     }
 }
 
@@ -1204,6 +1385,7 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
 // block. Splitting row into several chunks such that we can use shared memory to store
 // whether a column index is populated or not. Each row has at least 4097 non-zero
 // entries to compute.
+// If csr_val_C is a null pointer, only the column entries are computed
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int CHUNKSIZE,
@@ -1318,7 +1500,10 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
                         table[col_B - chunk_begin] = 1;
 
                         // Atomically accumulate the intermediate products
-                        atomicAdd(&data[col_B - chunk_begin], val_A * csr_val_B[k]);
+                        if(csr_val_C != nullptr)
+                        {
+                            atomicAdd(&data[col_B - chunk_begin], val_A * csr_val_B[k]);
+                        }
                     }
                     else if(col_B >= chunk_end)
                     {
@@ -1448,7 +1633,11 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
             if(has_nnz)
             {
                 csr_col_ind_C[idx] = i + chunk_begin + idx_base_C;
-                csr_val_C[idx]     = value;
+
+                if(csr_val_C != nullptr)
+                {
+                    csr_val_C[idx] = value;
+                }
             }
 
             // Last thread in block writes the block-wide offset into C such that all subsequent
@@ -1474,4 +1663,147 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
     }
 }
 
+// Recompute the values of C with a fixed summation order, where each row is processed by
+// a single (sub)wavefront. Entries of A are processed sequentially, while the lanes
+// accumulate the (distinct) columns of the corresponding row of B into C. Thus, no atomics
+// are required and results are bitwise reproducible. The sparsity pattern of C is
+// read only, such that this also serves as the numeric SpGEMM stage, where the rows
+// are accessed through the permutation of the symbolic plan, if available.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__device__ void csrgemm_fill_deterministic_wf_per_row_device(J m,
+                                                             J offset,
+                                                             const J* __restrict__ perm,
+                                                             T alpha,
+                                                             const I* __restrict__ csr_row_ptr_A,
+                                                             const J* __restrict__ csr_col_ind_A,
+                                                             const T* __restrict__ csr_val_A,
+                                                             const I* __restrict__ csr_row_ptr_B,
+                                                             const J* __restrict__ csr_col_ind_B,
+                                                             const T* __restrict__ csr_val_B,
+                                                             T beta,
+                                                             const I* __restrict__ csr_row_ptr_D,
+                                                             const J* __restrict__ csr_col_ind_D,
+                                                             const T* __restrict__ csr_val_D,
+                                                             const I* __restrict__ csr_row_ptr_C,
+                                                             const J* __restrict__ csr_col_ind_C,
+                                                             T* __restrict__ csr_val_C,
+                                                             rocsparse_index_base idx_base_A,
+                                                             rocsparse_index_base idx_base_B,
+                                                             rocsparse_index_base idx_base_C,
+                                                             rocsparse_index_base idx_base_D,
+                                                             bool                 mul,
+                                                             bool                 add)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Apply permutation, if available
+    row = perm ? perm[row + offset] : row;
+
+    // Get row boundaries of the current row in C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Initialize current row of C with zero
+    for(I j = row_begin_C + lid; j < row_end_C; j += WFSIZE)
+    {
+        csr_val_C[j] = static_cast<T>(0);
+    }
+
+    __threadfence_block();
+
+    // alpha * A * B part, entries of A are processed in order
+    if(mul == true)
+    {
+        // Get row boundaries of the current row in A
+        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        for(I j = row_begin_A; j < row_end_A; ++j)
+        {
+            // Column of A in current row
+            J col_A = csr_col_ind_A[j] - idx_base_A;
+            // Value of A in current row
+            T val_A = alpha * csr_val_A[j];
+
+            // Loop over columns of B in row col_A
+            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            {
+                // Column of B, shifted into the index base of C
+                J col_B = csr_col_ind_B[k] - idx_base_B + idx_base_C;
+
+                // Binary search for the position of col_B in the (sorted) row of C
+                I l = row_begin_C;
+                I r = row_end_C - 1;
+
+                while(l < r)
+                {
+                    I mid = (l + r) >> 1;
+
+                    if(csr_col_ind_C[mid] < col_B)
+                    {
+                        l = mid + 1;
+                    }
+                    else
+                    {
+                        r = mid;
+                    }
+                }
+
+                csr_val_C[l] += val_A * csr_val_B[k];
+            }
+
+            __threadfence_block();
+        }
+    }
+
+    // beta * D part
+    if(add == true)
+    {
+        // Get row boundaries of the current row in D
+        I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+        I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+        for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
+        {
+            // Column of D, shifted into the index base of C
+            J col_D = csr_col_ind_D[j] - idx_base_D + idx_base_C;
+
+            // Binary search for the position of col_D in the (sorted) row of C
+            I l = row_begin_C;
+            I r = row_end_C - 1;
+
+            while(l < r)
+            {
+                I mid = (l + r) >> 1;
+
+                if(csr_col_ind_C[mid] < col_D)
+                {
+                    l = mid + 1;
+                }
+                else
+                {
+                    r = mid;
+                }
+            }
+
+            csr_val_C[l] += beta * csr_val_D[j];
+        }
+    }
+}
+
 #endif // CSRGEMM_DEVICE_H
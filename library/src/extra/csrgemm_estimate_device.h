@@ -0,0 +1,270 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEMM_ESTIMATE_DEVICE_H
+#define CSRGEMM_ESTIMATE_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+
+// Compute the exact number of non-zero entries of the sampled rows of C = A * B, where
+// each sampled row is processed by a single block, see
+// csrgemm_symbolic_chunked_block_per_row_device().
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE,
+          typename I,
+          typename J>
+__device__ void csrgemm_estimate_sample_nnz_device(J n,
+                                                   const J* __restrict__ sample,
+                                                   const I* __restrict__ csr_row_ptr_A,
+                                                   const J* __restrict__ csr_col_ind_A,
+                                                   const I* __restrict__ csr_row_ptr_B,
+                                                   const J* __restrict__ csr_col_ind_B,
+                                                   I* __restrict__ sample_nnz,
+                                                   rocsparse_index_base idx_base_A,
+                                                   rocsparse_index_base idx_base_B)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a sampled row
+    J row = sample[hipBlockIdx_x];
+
+    // Get row boundaries of the current row in A
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Mark the products of the current chunk
+    auto mark = [&](J chunk_begin, J chunk_end, bool* table, J& min_col) {
+        // Loop over columns of A in current row
+        for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of A in current row
+            J col_A = csr_col_ind_A[j] - idx_base_A;
+
+            // Loop over columns of B in row col_A
+            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            {
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                if(col_B >= chunk_end)
+                {
+                    // Columns of B are sorted, thus the remaining columns are part
+                    // of subsequent chunks
+                    min_col = min(min_col, col_B);
+                    break;
+                }
+
+                if(col_B >= chunk_begin)
+                {
+                    // Mark nnz table if entry at col_B
+                    table[col_B - chunk_begin] = true;
+                }
+            }
+        }
+    };
+
+    // Only the number of non-zero entries is required
+    auto write = [](I, J, bool) {};
+
+    I row_nnz = csrgemm_symbolic_chunked_block_per_row_device<BLOCKSIZE, CHUNKSIZE, false, I>(
+        n, false, mark, write);
+
+    // Write row nnz to global memory
+    if(hipThreadIdx_x == 0)
+    {
+        sample_nnz[hipBlockIdx_x] = row_nnz;
+    }
+}
+
+// Sum of the product bounds min(nprod, n) of the rows of each group, where group holds
+// the group of each row, see csrgemm_group_reduce_part1(). The partial sums of each
+// block are reduced by csrgemm_group_reduce_part3().
+template <unsigned int BLOCKSIZE, unsigned int GROUPS, typename I, typename J>
+__device__ void csrgemm_estimate_group_bound_device(J n,
+                                                    J m,
+                                                    const I* __restrict__ int_prod,
+                                                    const I* __restrict__ group,
+                                                    int64_t* __restrict__ group_bound)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Shared memory for block reduction
+    __shared__ int64_t sdata[BLOCKSIZE * GROUPS];
+
+    // Initialize shared memory
+    for(unsigned int i = 0; i < GROUPS; ++i)
+    {
+        sdata[hipThreadIdx_x * GROUPS + i] = 0;
+    }
+
+    __threadfence_block();
+
+    // Loop over rows
+    for(; row < m; row += hipGridDim_x * BLOCKSIZE)
+    {
+        // A row of C cannot hold more entries than intermediate products or columns
+        sdata[hipThreadIdx_x * GROUPS + group[row]] += min(int_prod[row], static_cast<I>(n));
+    }
+
+    // Wait for all threads to finish
+    __syncthreads();
+
+    // Reduce block
+    csrgemm_group_reduce<BLOCKSIZE, GROUPS>(hipThreadIdx_x, sdata);
+
+    // Write result
+    if(hipThreadIdx_x < GROUPS)
+    {
+        group_bound[hipBlockIdx_x * GROUPS + hipThreadIdx_x] = sdata[hipThreadIdx_x];
+    }
+}
+
+// Systematic sampling of each group, such that up to sample_size samples are spread
+// evenly across the rows of the group. The rows are sorted by their group, thus the
+// i-th row of group g is perm[offset_g + i]. Samples are stored group by group.
+template <unsigned int BLOCKSIZE, unsigned int GROUPS, typename J>
+__device__ void csrgemm_estimate_sample_rows_device(J nsample,
+                                                    J sample_size,
+                                                    const J* __restrict__ group_size,
+                                                    const J* __restrict__ perm,
+                                                    J* __restrict__ sample)
+{
+    J s = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(s >= nsample)
+    {
+        return;
+    }
+
+    J row_offset    = 0;
+    J sample_offset = 0;
+
+    for(unsigned int g = 0; g < GROUPS; ++g)
+    {
+        J rows = group_size[g];
+        J size = min(sample_size, rows);
+
+        if(s < sample_offset + size)
+        {
+            // Position of the sample within the group
+            int64_t t   = s - sample_offset;
+            int64_t pos = ((2 * t + 1) * rows) / (2 * static_cast<int64_t>(size));
+
+            sample[s] = perm[row_offset + pos];
+
+            return;
+        }
+
+        row_offset += rows;
+        sample_offset += size;
+    }
+}
+
+// Ratio estimate of a group, using the product bound of each row as auxiliary variable.
+// Each block processes the samples of a group and stores the sum of the sampled non-zero
+// entries, the sum of their product bounds and the sum of squared residuals.
+template <unsigned int BLOCKSIZE, unsigned int GROUPS, typename I, typename J>
+__device__ void csrgemm_estimate_group_stats_device(J n,
+                                                    J sample_size,
+                                                    const J* __restrict__ group_size,
+                                                    const I* __restrict__ int_prod,
+                                                    const J* __restrict__ sample,
+                                                    const I* __restrict__ sample_nnz,
+                                                    double* __restrict__ stats)
+{
+    unsigned int g = hipBlockIdx_x;
+
+    // Range of the samples of the group
+    J begin = 0;
+
+    for(unsigned int i = 0; i < g; ++i)
+    {
+        begin += min(sample_size, group_size[i]);
+    }
+
+    J end = begin + min(sample_size, group_size[g]);
+
+    // Shared memory for block reduction
+    __shared__ double snnz[BLOCKSIZE];
+    __shared__ double sbound[BLOCKSIZE];
+
+    double sum_nnz   = 0.0;
+    double sum_bound = 0.0;
+
+    for(J s = begin + hipThreadIdx_x; s < end; s += BLOCKSIZE)
+    {
+        sum_nnz += sample_nnz[s];
+        sum_bound += min(int_prod[sample[s]], static_cast<I>(n));
+    }
+
+    snnz[hipThreadIdx_x]   = sum_nnz;
+    sbound[hipThreadIdx_x] = sum_bound;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, snnz);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sbound);
+
+    sum_nnz   = snnz[0];
+    sum_bound = sbound[0];
+
+    double ratio = (sum_bound > 0.0) ? sum_nnz / sum_bound : 0.0;
+
+    // Wait for all threads to load the sums, before the shared memory is reused
+    __syncthreads();
+
+    // Sum of squared residuals of the sampled rows
+    double deviation = 0.0;
+
+    for(J s = begin + hipThreadIdx_x; s < end; s += BLOCKSIZE)
+    {
+        double res = sample_nnz[s] - ratio * min(int_prod[sample[s]], static_cast<I>(n));
+
+        deviation += res * res;
+    }
+
+    snnz[hipThreadIdx_x] = deviation;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, snnz);
+
+    if(hipThreadIdx_x == 0)
+    {
+        stats[3 * g + 0] = sum_nnz;
+        stats[3 * g + 1] = sum_bound;
+        stats[3 * g + 2] = snnz[0];
+    }
+}
+
+#endif // CSRGEMM_ESTIMATE_DEVICE_H
@@ -0,0 +1,316 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEMM_MASKED_DEVICE_H
+#define CSRGEMM_MASKED_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+
+// Compute the sparsity pattern of the product A * B outside of the mask M, where each
+// row is processed by a single block, see csrgemm_symbolic_chunked_block_per_row_device().
+// If FILL is false, the number of non-zero entries of each row is written to
+// csr_row_ptr_C, otherwise the column indices of C are written.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE,
+          bool         FILL,
+          typename I,
+          typename J>
+__device__ void csrgemm_masked_complement_block_per_row_device(J n,
+                                                               const I* __restrict__ csr_row_ptr_A,
+                                                               const J* __restrict__ csr_col_ind_A,
+                                                               const I* __restrict__ csr_row_ptr_B,
+                                                               const J* __restrict__ csr_col_ind_B,
+                                                               const I* __restrict__ csr_row_ptr_M,
+                                                               const J* __restrict__ csr_col_ind_M,
+                                                               I* __restrict__ csr_row_ptr_C,
+                                                               J* __restrict__ csr_col_ind_C,
+                                                               rocsparse_index_base idx_base_A,
+                                                               rocsparse_index_base idx_base_B,
+                                                               rocsparse_index_base idx_base_M,
+                                                               rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    J row = hipBlockIdx_x;
+
+    // Get row boundaries of the current row in A and M
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+    I row_begin_M = csr_row_ptr_M[row] - idx_base_M;
+    I row_end_M   = csr_row_ptr_M[row + 1] - idx_base_M;
+
+    // Offset into C
+    I row_begin_C = (FILL == true) ? csr_row_ptr_C[row] - idx_base_C : 0;
+
+    // Mark the products of the current chunk and remove all entries of the mask
+    auto mark = [&](J chunk_begin, J chunk_end, bool* table, J& min_col) {
+        // Loop over columns of A in current row
+        for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of A in current row
+            J col_A = csr_col_ind_A[j] - idx_base_A;
+
+            // Loop over columns of B in row col_A
+            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            {
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                if(col_B >= chunk_end)
+                {
+                    // Columns of B are sorted, thus the remaining columns are part of
+                    // subsequent chunks
+                    min_col = min(min_col, col_B);
+                    break;
+                }
+
+                if(col_B >= chunk_begin)
+                {
+                    // Mark nnz table if entry at col_B
+                    table[col_B - chunk_begin] = true;
+                }
+            }
+        }
+
+        // Wait for all threads to finish marking the products
+        __syncthreads();
+
+        // Remove all entries of the mask from the current chunk
+        for(I j = row_begin_M + hipThreadIdx_x; j < row_end_M; j += BLOCKSIZE)
+        {
+            J col_M = csr_col_ind_M[j] - idx_base_M;
+
+            if(col_M >= chunk_begin && col_M < chunk_end)
+            {
+                table[col_M - chunk_begin] = false;
+            }
+        }
+    };
+
+    // Write the column indices of C
+    auto write = [&](I pos, J col, bool) { csr_col_ind_C[row_begin_C + pos] = col + idx_base_C; };
+
+    I row_nnz = csrgemm_symbolic_chunked_block_per_row_device<BLOCKSIZE, CHUNKSIZE, FILL, I>(
+        n, false, mark, write);
+
+    // Write row nnz to global memory
+    if(FILL == false && hipThreadIdx_x == 0)
+    {
+        csr_row_ptr_C[row] = row_nnz;
+    }
+}
+
+// Compute the values of C = alpha * A * B for the given sparsity pattern of C, where each
+// row is processed by a single (sub)wavefront. Entries of A are processed sequentially,
+// while the lanes accumulate the (distinct) columns of the corresponding row of B into C.
+// Products that fall outside of the sparsity pattern of C are dropped.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__device__ void csrgemm_masked_row_wf_per_row_device(J m,
+                                                     T alpha,
+                                                     const I* __restrict__ csr_row_ptr_A,
+                                                     const J* __restrict__ csr_col_ind_A,
+                                                     const T* __restrict__ csr_val_A,
+                                                     const I* __restrict__ csr_row_ptr_B,
+                                                     const J* __restrict__ csr_col_ind_B,
+                                                     const T* __restrict__ csr_val_B,
+                                                     const I* __restrict__ csr_row_ptr_C,
+                                                     const J* __restrict__ csr_col_ind_C,
+                                                     T* __restrict__ csr_val_C,
+                                                     rocsparse_index_base idx_base_A,
+                                                     rocsparse_index_base idx_base_B,
+                                                     rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Get row boundaries of the current row in C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Initialize current row of C with zero
+    for(I j = row_begin_C + lid; j < row_end_C; j += WFSIZE)
+    {
+        csr_val_C[j] = static_cast<T>(0);
+    }
+
+    // Quick return, if the row of C is empty
+    if(row_begin_C == row_end_C)
+    {
+        return;
+    }
+
+    __threadfence_block();
+
+    // Get row boundaries of the current row in A
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    for(I j = row_begin_A; j < row_end_A; ++j)
+    {
+        // Column of A in current row
+        J col_A = csr_col_ind_A[j] - idx_base_A;
+        // Value of A in current row
+        T val_A = alpha * csr_val_A[j];
+
+        // Loop over columns of B in row col_A
+        I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+        {
+            // Column of B, shifted into the index base of C
+            J col_B = csr_col_ind_B[k] - idx_base_B + idx_base_C;
+
+            // Binary search for the position of col_B in the (sorted) row of C
+            I l = row_begin_C;
+            I r = row_end_C - 1;
+
+            while(l < r)
+            {
+                I mid = (l + r) >> 1;
+
+                if(csr_col_ind_C[mid] < col_B)
+                {
+                    l = mid + 1;
+                }
+                else
+                {
+                    r = mid;
+                }
+            }
+
+            // Only accumulate products that are part of the mask
+            if(csr_col_ind_C[l] == col_B)
+            {
+                csr_val_C[l] += val_A * csr_val_B[k];
+            }
+        }
+
+        __threadfence_block();
+    }
+}
+
+// Compute the values of C = alpha * A * B for the given sparsity pattern of C, where each
+// row is processed by a single (sub)wavefront. Each lane computes an entry of C as dot
+// product of the row of A and the corresponding column of B, given in CSC format.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__device__ void csrgemm_masked_dot_wf_per_row_device(J m,
+                                                     T alpha,
+                                                     const I* __restrict__ csr_row_ptr_A,
+                                                     const J* __restrict__ csr_col_ind_A,
+                                                     const T* __restrict__ csr_val_A,
+                                                     const I* __restrict__ csc_col_ptr_B,
+                                                     const J* __restrict__ csc_row_ind_B,
+                                                     const T* __restrict__ csc_val_B,
+                                                     const I* __restrict__ csr_row_ptr_C,
+                                                     const J* __restrict__ csr_col_ind_C,
+                                                     T* __restrict__ csr_val_C,
+                                                     rocsparse_index_base idx_base_A,
+                                                     rocsparse_index_base idx_base_B,
+                                                     rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Get row boundaries of the current row in A and C
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Each lane processes an entry of C
+    for(I j = row_begin_C + lid; j < row_end_C; j += WFSIZE)
+    {
+        // Column of C
+        J col_C = csr_col_ind_C[j] - idx_base_C;
+
+        // Get column boundaries of the current column in B
+        I col_begin_B = csc_col_ptr_B[col_C] - idx_base_B;
+        I col_end_B   = csc_col_ptr_B[col_C + 1] - idx_base_B;
+
+        // Intersect the (sorted) row of A with the (sorted) column of B
+        I a = row_begin_A;
+        I b = col_begin_B;
+
+        T sum = static_cast<T>(0);
+
+        while(a < row_end_A && b < col_end_B)
+        {
+            J col_A = csr_col_ind_A[a] - idx_base_A;
+            J row_B = csc_row_ind_B[b] - idx_base_B;
+
+            if(col_A < row_B)
+            {
+                ++a;
+            }
+            else if(col_A > row_B)
+            {
+                ++b;
+            }
+            else
+            {
+                sum = rocsparse_fma(csr_val_A[a], csc_val_B[b], sum);
+
+                ++a;
+                ++b;
+            }
+        }
+
+        csr_val_C[j] = alpha * sum;
+    }
+}
+
+#endif // CSRGEMM_MASKED_DEVICE_H
@@ -0,0 +1,242 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRRAP_DEVICE_H
+#define CSRRAP_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+
+// Compute the sparsity pattern of the triple product R * A * P, where each row of C is
+// processed by a single block, see csrgemm_symbolic_chunked_block_per_row_device(). The
+// rows of A * P that are required by the current row of C are expanded on the fly and
+// never stored.
+// If FILL is false, the number of non-zero entries of each row is written to
+// csr_row_ptr_C, otherwise the column indices of C are written.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE,
+          bool         FILL,
+          typename I,
+          typename J>
+__device__ void csrrap_symbolic_block_per_row_device(J k,
+                                                     const I* __restrict__ csr_row_ptr_R,
+                                                     const J* __restrict__ csr_col_ind_R,
+                                                     const I* __restrict__ csr_row_ptr_A,
+                                                     const J* __restrict__ csr_col_ind_A,
+                                                     const I* __restrict__ csr_row_ptr_P,
+                                                     const J* __restrict__ csr_col_ind_P,
+                                                     I* __restrict__ csr_row_ptr_C,
+                                                     J* __restrict__ csr_col_ind_C,
+                                                     rocsparse_index_base idx_base_R,
+                                                     rocsparse_index_base idx_base_A,
+                                                     rocsparse_index_base idx_base_P,
+                                                     rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    J row = hipBlockIdx_x;
+
+    // Get row boundaries of the current row in R
+    I row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+    I row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+    // Offset into C
+    I row_begin_C = (FILL == true) ? csr_row_ptr_C[row] - idx_base_C : 0;
+
+    // Mark the triple products of the current chunk
+    auto mark = [&](J chunk_begin, J chunk_end, bool* table, J& min_col) {
+        // Loop over columns of R in current row
+        for(I j = row_begin_R + wid; j < row_end_R; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of R in current row
+            J col_R = csr_col_ind_R[j] - idx_base_R;
+
+            // Loop over columns of A in row col_R
+            I row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+            I row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+            for(I l = row_begin_A; l < row_end_A; ++l)
+            {
+                // Column of A in row col_R
+                J col_A = csr_col_ind_A[l] - idx_base_A;
+
+                // Loop over columns of P in row col_A
+                I row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+                I row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+                for(I p = row_begin_P + lid; p < row_end_P; p += WFSIZE)
+                {
+                    // Column of P in row col_A
+                    J col_P = csr_col_ind_P[p] - idx_base_P;
+
+                    if(col_P >= chunk_end)
+                    {
+                        // Columns of P are sorted, thus the remaining columns are part
+                        // of subsequent chunks
+                        min_col = min(min_col, col_P);
+                        break;
+                    }
+
+                    if(col_P >= chunk_begin)
+                    {
+                        // Mark nnz table if entry at col_P
+                        table[col_P - chunk_begin] = true;
+                    }
+                }
+            }
+        }
+    };
+
+    // Write the column indices of C
+    auto write = [&](I pos, J col, bool) { csr_col_ind_C[row_begin_C + pos] = col + idx_base_C; };
+
+    I row_nnz = csrgemm_symbolic_chunked_block_per_row_device<BLOCKSIZE, CHUNKSIZE, FILL, I>(
+        k, false, mark, write);
+
+    // Write row nnz to global memory
+    if(FILL == false && hipThreadIdx_x == 0)
+    {
+        csr_row_ptr_C[row] = row_nnz;
+    }
+}
+
+// Compute the values of C = R * A * P for the given sparsity pattern of C, where each
+// row of C is processed by a single (sub)wavefront. Entries of R and A are processed
+// sequentially, while the lanes accumulate the (distinct) columns of the corresponding
+// row of P into C. Thus, the summation order is fixed and no atomics are required.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__device__ void csrrap_numeric_wf_per_row_device(J m,
+                                                 const I* __restrict__ csr_row_ptr_R,
+                                                 const J* __restrict__ csr_col_ind_R,
+                                                 const T* __restrict__ csr_val_R,
+                                                 const I* __restrict__ csr_row_ptr_A,
+                                                 const J* __restrict__ csr_col_ind_A,
+                                                 const T* __restrict__ csr_val_A,
+                                                 const I* __restrict__ csr_row_ptr_P,
+                                                 const J* __restrict__ csr_col_ind_P,
+                                                 const T* __restrict__ csr_val_P,
+                                                 const I* __restrict__ csr_row_ptr_C,
+                                                 const J* __restrict__ csr_col_ind_C,
+                                                 T* __restrict__ csr_val_C,
+                                                 rocsparse_index_base idx_base_R,
+                                                 rocsparse_index_base idx_base_A,
+                                                 rocsparse_index_base idx_base_P,
+                                                 rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Get row boundaries of the current row in C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Initialize current row of C with zero
+    for(I j = row_begin_C + lid; j < row_end_C; j += WFSIZE)
+    {
+        csr_val_C[j] = static_cast<T>(0);
+    }
+
+    // Quick return, if the row of C is empty
+    if(row_begin_C == row_end_C)
+    {
+        return;
+    }
+
+    __threadfence_block();
+
+    // Get row boundaries of the current row in R
+    I row_begin_R = csr_row_ptr_R[row] - idx_base_R;
+    I row_end_R   = csr_row_ptr_R[row + 1] - idx_base_R;
+
+    for(I j = row_begin_R; j < row_end_R; ++j)
+    {
+        // Column of R in current row
+        J col_R = csr_col_ind_R[j] - idx_base_R;
+        // Value of R in current row
+        T val_R = csr_val_R[j];
+
+        // Loop over columns of A in row col_R
+        I row_begin_A = csr_row_ptr_A[col_R] - idx_base_A;
+        I row_end_A   = csr_row_ptr_A[col_R + 1] - idx_base_A;
+
+        for(I l = row_begin_A; l < row_end_A; ++l)
+        {
+            // Column of A in row col_R
+            J col_A = csr_col_ind_A[l] - idx_base_A;
+            // Entry of the row of R * A
+            T val_RA = val_R * csr_val_A[l];
+
+            // Loop over columns of P in row col_A
+            I row_begin_P = csr_row_ptr_P[col_A] - idx_base_P;
+            I row_end_P   = csr_row_ptr_P[col_A + 1] - idx_base_P;
+
+            for(I p = row_begin_P + lid; p < row_end_P; p += WFSIZE)
+            {
+                // Column of P, shifted into the index base of C
+                J col_P = csr_col_ind_P[p] - idx_base_P + idx_base_C;
+
+                // Binary search for the position of col_P in the (sorted) row of C
+                I lo = row_begin_C;
+                I hi = row_end_C - 1;
+
+                while(lo < hi)
+                {
+                    I mid = (lo + hi) >> 1;
+
+                    if(csr_col_ind_C[mid] < col_P)
+                    {
+                        lo = mid + 1;
+                    }
+                    else
+                    {
+                        hi = mid;
+                    }
+                }
+
+                csr_val_C[lo] = rocsparse_fma(val_RA, csr_val_P[p], csr_val_C[lo]);
+            }
+
+            __threadfence_block();
+        }
+    }
+}
+
+#endif // CSRRAP_DEVICE_H
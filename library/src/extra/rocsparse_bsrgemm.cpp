@@ -0,0 +1,707 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bsrgemm_device.h"
+#include "csrgemm_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE, bool FILL>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void bsrgemm_symbolic(rocsparse_int nb,
+                          const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                          const rocsparse_int* __restrict__ bsr_col_ind_A,
+                          const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                          const rocsparse_int* __restrict__ bsr_col_ind_B,
+                          rocsparse_int* __restrict__ bsr_row_ptr_C,
+                          rocsparse_int* __restrict__ bsr_col_ind_C,
+                          rocsparse_index_base idx_base_A,
+                          rocsparse_index_base idx_base_B,
+                          rocsparse_index_base idx_base_C)
+{
+    bsrgemm_symbolic_block_per_row_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, FILL>(nb,
+                                                                             bsr_row_ptr_A,
+                                                                             bsr_col_ind_A,
+                                                                             bsr_row_ptr_B,
+                                                                             bsr_col_ind_B,
+                                                                             bsr_row_ptr_C,
+                                                                             bsr_col_ind_C,
+                                                                             idx_base_A,
+                                                                             idx_base_B,
+                                                                             idx_base_C);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void bsrgemm_fill(rocsparse_direction dir,
+                      U                   alpha_device_host,
+                      const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                      const rocsparse_int* __restrict__ bsr_col_ind_A,
+                      const T* __restrict__ bsr_val_A,
+                      const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                      const rocsparse_int* __restrict__ bsr_col_ind_B,
+                      const T* __restrict__ bsr_val_B,
+                      const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                      const rocsparse_int* __restrict__ bsr_col_ind_C,
+                      T* __restrict__ bsr_val_C,
+                      rocsparse_index_base idx_base_A,
+                      rocsparse_index_base idx_base_B,
+                      rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    bsrgemm_fill_block_per_row_device<BLOCKSIZE, BSRDIM>(dir,
+                                                         alpha,
+                                                         bsr_row_ptr_A,
+                                                         bsr_col_ind_A,
+                                                         bsr_val_A,
+                                                         bsr_row_ptr_B,
+                                                         bsr_col_ind_B,
+                                                         bsr_val_B,
+                                                         bsr_row_ptr_C,
+                                                         bsr_col_ind_C,
+                                                         bsr_val_C,
+                                                         idx_base_A,
+                                                         idx_base_B,
+                                                         idx_base_C);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void bsrgemm_fill_general(rocsparse_direction dir,
+                              rocsparse_int       block_dim,
+                              U                   alpha_device_host,
+                              const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                              const rocsparse_int* __restrict__ bsr_col_ind_A,
+                              const T* __restrict__ bsr_val_A,
+                              const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                              const rocsparse_int* __restrict__ bsr_col_ind_B,
+                              const T* __restrict__ bsr_val_B,
+                              const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                              const rocsparse_int* __restrict__ bsr_col_ind_C,
+                              T* __restrict__ bsr_val_C,
+                              rocsparse_index_base idx_base_A,
+                              rocsparse_index_base idx_base_B,
+                              rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    bsrgemm_fill_general_block_per_row_device<BLOCKSIZE>(dir,
+                                                         block_dim,
+                                                         alpha,
+                                                         bsr_row_ptr_A,
+                                                         bsr_col_ind_A,
+                                                         bsr_val_A,
+                                                         bsr_row_ptr_B,
+                                                         bsr_col_ind_B,
+                                                         bsr_val_B,
+                                                         bsr_row_ptr_C,
+                                                         bsr_col_ind_C,
+                                                         bsr_val_C,
+                                                         idx_base_A,
+                                                         idx_base_B,
+                                                         idx_base_C);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_bsrgemm_dispatch(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nb,
+                                            rocsparse_int             block_dim,
+                                            U                         alpha_device_host,
+                                            const rocsparse_mat_descr descr_A,
+                                            const T*                  bsr_val_A,
+                                            const rocsparse_int*      bsr_row_ptr_A,
+                                            const rocsparse_int*      bsr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            const T*                  bsr_val_B,
+                                            const rocsparse_int*      bsr_row_ptr_B,
+                                            const rocsparse_int*      bsr_col_ind_B,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        bsr_val_C,
+                                            const rocsparse_int*      bsr_row_ptr_C,
+                                            rocsparse_int*            bsr_col_ind_C)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Compute the block column indices of C
+#define BSRGEMM_DIM 256
+#define BSRGEMM_SUB 16
+#define BSRGEMM_CHUNKSIZE 2048
+    hipLaunchKernelGGL((bsrgemm_symbolic<BSRGEMM_DIM, BSRGEMM_SUB, BSRGEMM_CHUNKSIZE, true>),
+                       dim3(mb),
+                       dim3(BSRGEMM_DIM),
+                       0,
+                       stream,
+                       nb,
+                       bsr_row_ptr_A,
+                       bsr_col_ind_A,
+                       bsr_row_ptr_B,
+                       bsr_col_ind_B,
+                       (rocsparse_int*)bsr_row_ptr_C,
+                       bsr_col_ind_C,
+                       descr_A->base,
+                       descr_B->base,
+                       descr_C->base);
+#undef BSRGEMM_CHUNKSIZE
+#undef BSRGEMM_SUB
+
+    // Compute the blocks of C, where the rows of the small block dimensions are
+    // accumulated in registers
+#define LAUNCH_BSRGEMM_FILL(BSRDIM)                         \
+    hipLaunchKernelGGL((bsrgemm_fill<BSRGEMM_DIM, BSRDIM>), \
+                       dim3(mb),                            \
+                       dim3(BSRGEMM_DIM),                   \
+                       0,                                   \
+                       stream,                              \
+                       dir,                                 \
+                       alpha_device_host,                   \
+                       bsr_row_ptr_A,                       \
+                       bsr_col_ind_A,                       \
+                       bsr_val_A,                           \
+                       bsr_row_ptr_B,                       \
+                       bsr_col_ind_B,                       \
+                       bsr_val_B,                           \
+                       bsr_row_ptr_C,                       \
+                       bsr_col_ind_C,                       \
+                       bsr_val_C,                           \
+                       descr_A->base,                       \
+                       descr_B->base,                       \
+                       descr_C->base)
+
+    if(block_dim == 2)
+    {
+        LAUNCH_BSRGEMM_FILL(2);
+    }
+    else if(block_dim == 3)
+    {
+        LAUNCH_BSRGEMM_FILL(3);
+    }
+    else if(block_dim == 4)
+    {
+        LAUNCH_BSRGEMM_FILL(4);
+    }
+    else if(block_dim == 5)
+    {
+        LAUNCH_BSRGEMM_FILL(5);
+    }
+    else if(block_dim == 8)
+    {
+        LAUNCH_BSRGEMM_FILL(8);
+    }
+    else if(block_dim == 16)
+    {
+        LAUNCH_BSRGEMM_FILL(16);
+    }
+    else
+    {
+        hipLaunchKernelGGL((bsrgemm_fill_general<BSRGEMM_DIM>),
+                           dim3(mb),
+                           dim3(BSRGEMM_DIM),
+                           0,
+                           stream,
+                           dir,
+                           block_dim,
+                           alpha_device_host,
+                           bsr_row_ptr_A,
+                           bsr_col_ind_A,
+                           bsr_val_A,
+                           bsr_row_ptr_B,
+                           bsr_col_ind_B,
+                           bsr_val_B,
+                           bsr_row_ptr_C,
+                           bsr_col_ind_C,
+                           bsr_val_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+    }
+
+#undef LAUNCH_BSRGEMM_FILL
+#undef BSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrgemm_template(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nb,
+                                            rocsparse_int             kb,
+                                            rocsparse_int             block_dim,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnzb_A,
+                                            const T*                  bsr_val_A,
+                                            const rocsparse_int*      bsr_row_ptr_A,
+                                            const rocsparse_int*      bsr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnzb_B,
+                                            const T*                  bsr_val_B,
+                                            const rocsparse_int*      bsr_row_ptr_B,
+                                            const rocsparse_int*      bsr_col_ind_B,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        bsr_val_C,
+                                            const rocsparse_int*      bsr_row_ptr_C,
+                                            rocsparse_int*            bsr_col_ind_C)
+{
+    // Check for valid handle, alpha and descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(alpha == nullptr || descr_A == nullptr || descr_B == nullptr || descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrgemm"),
+                  dir,
+                  mb,
+                  nb,
+                  kb,
+                  block_dim,
+                  *alpha,
+                  (const void*&)descr_A,
+                  nnzb_A,
+                  (const void*&)bsr_val_A,
+                  (const void*&)bsr_row_ptr_A,
+                  (const void*&)bsr_col_ind_A,
+                  (const void*&)descr_B,
+                  nnzb_B,
+                  (const void*&)bsr_val_B,
+                  (const void*&)bsr_row_ptr_B,
+                  (const void*&)bsr_col_ind_B,
+                  (const void*&)descr_C,
+                  (const void*&)bsr_val_C,
+                  (const void*&)bsr_row_ptr_C,
+                  (const void*&)bsr_col_ind_C);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xbsrgemm"),
+                  dir,
+                  mb,
+                  nb,
+                  kb,
+                  block_dim,
+                  (const void*&)alpha,
+                  (const void*&)descr_A,
+                  nnzb_A,
+                  (const void*&)bsr_val_A,
+                  (const void*&)bsr_row_ptr_A,
+                  (const void*&)bsr_col_ind_A,
+                  (const void*&)descr_B,
+                  nnzb_B,
+                  (const void*&)bsr_val_B,
+                  (const void*&)bsr_row_ptr_B,
+                  (const void*&)bsr_col_ind_B,
+                  (const void*&)descr_C,
+                  (const void*&)bsr_val_C,
+                  (const void*&)bsr_row_ptr_C,
+                  (const void*&)bsr_col_ind_C);
+    }
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(mb < 0 || nb < 0 || kb < 0 || nnzb_A < 0 || nnzb_B < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || kb == 0 || nnzb_A == 0 || nnzb_B == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(bsr_val_A == nullptr || bsr_row_ptr_A == nullptr || bsr_col_ind_A == nullptr
+       || bsr_val_B == nullptr || bsr_row_ptr_B == nullptr || bsr_col_ind_B == nullptr
+       || bsr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((bsr_val_C == nullptr && bsr_col_ind_C != nullptr)
+       || (bsr_val_C != nullptr && bsr_col_ind_C == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(bsr_col_ind_C == nullptr && bsr_val_C == nullptr)
+    {
+        rocsparse_int start = 0;
+        rocsparse_int end   = 0;
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&end, &bsr_row_ptr_C[mb], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&start, &bsr_row_ptr_C[0], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Quick return if C is the zero matrix
+        if(end - start == 0)
+        {
+            return rocsparse_status_success;
+        }
+
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Pointer mode device
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_bsrgemm_dispatch(handle,
+                                          dir,
+                                          mb,
+                                          nb,
+                                          block_dim,
+                                          alpha,
+                                          descr_A,
+                                          bsr_val_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
+                                          descr_B,
+                                          bsr_val_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
+                                          descr_C,
+                                          bsr_val_C,
+                                          bsr_row_ptr_C,
+                                          bsr_col_ind_C);
+    }
+    else
+    {
+        return rocsparse_bsrgemm_dispatch(handle,
+                                          dir,
+                                          mb,
+                                          nb,
+                                          block_dim,
+                                          *alpha,
+                                          descr_A,
+                                          bsr_val_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
+                                          descr_B,
+                                          bsr_val_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
+                                          descr_C,
+                                          bsr_val_C,
+                                          bsr_row_ptr_C,
+                                          bsr_col_ind_C);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_bsrgemm_nnz(rocsparse_handle          handle,
+                                                  rocsparse_direction       dir,
+                                                  rocsparse_int             mb,
+                                                  rocsparse_int             nb,
+                                                  rocsparse_int             kb,
+                                                  rocsparse_int             block_dim,
+                                                  const rocsparse_mat_descr descr_A,
+                                                  rocsparse_int             nnzb_A,
+                                                  const rocsparse_int*      bsr_row_ptr_A,
+                                                  const rocsparse_int*      bsr_col_ind_A,
+                                                  const rocsparse_mat_descr descr_B,
+                                                  rocsparse_int             nnzb_B,
+                                                  const rocsparse_int*      bsr_row_ptr_B,
+                                                  const rocsparse_int*      bsr_col_ind_B,
+                                                  const rocsparse_mat_descr descr_C,
+                                                  rocsparse_int*            bsr_row_ptr_C,
+                                                  rocsparse_int*            nnzb_C)
+{
+    // Check for valid handle and descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr || descr_B == nullptr || descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_bsrgemm_nnz",
+              dir,
+              mb,
+              nb,
+              kb,
+              block_dim,
+              (const void*&)descr_A,
+              nnzb_A,
+              (const void*&)bsr_row_ptr_A,
+              (const void*&)bsr_col_ind_A,
+              (const void*&)descr_B,
+              nnzb_B,
+              (const void*&)bsr_row_ptr_B,
+              (const void*&)bsr_col_ind_B,
+              (const void*&)descr_C,
+              (const void*&)bsr_row_ptr_C,
+              (const void*&)nnzb_C);
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(mb < 0 || nb < 0 || kb < 0 || nnzb_A < 0 || nnzb_B < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(nnzb_C == nullptr || (mb > 0 && bsr_row_ptr_C == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0 || kb == 0 || nnzb_A == 0 || nnzb_B == 0)
+    {
+        if(mb > 0)
+        {
+#define BSRGEMM_DIM 1024
+            hipLaunchKernelGGL((set_array_to_value<BSRGEMM_DIM>),
+                               dim3(mb / BSRGEMM_DIM + 1),
+                               dim3(BSRGEMM_DIM),
+                               0,
+                               stream,
+                               mb + 1,
+                               bsr_row_ptr_C,
+                               static_cast<rocsparse_int>(descr_C->base));
+#undef BSRGEMM_DIM
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnzb_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnzb_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(bsr_row_ptr_A == nullptr || bsr_col_ind_A == nullptr || bsr_row_ptr_B == nullptr
+       || bsr_col_ind_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // rocprim buffer size of the block row pointer scan
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                bsr_row_ptr_C,
+                                                bsr_row_ptr_C,
+                                                static_cast<rocsparse_int>(descr_C->base),
+                                                mb + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // In host pointer mode, the number of non-zero blocks of C is read back to the
+    // host, and a scan that does not fit the handle buffer allocates its workspace.
+    // Neither can be captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled
+       && (handle->pointer_mode == rocsparse_pointer_mode_host
+           || handle->buffer_size < rocprim_size))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Compute the number of non-zero blocks of each block row of C
+#define BSRGEMM_DIM 256
+#define BSRGEMM_SUB 16
+#define BSRGEMM_CHUNKSIZE 2048
+    hipLaunchKernelGGL((bsrgemm_symbolic<BSRGEMM_DIM, BSRGEMM_SUB, BSRGEMM_CHUNKSIZE, false>),
+                       dim3(mb),
+                       dim3(BSRGEMM_DIM),
+                       0,
+                       stream,
+                       nb,
+                       bsr_row_ptr_A,
+                       bsr_col_ind_A,
+                       bsr_row_ptr_B,
+                       bsr_col_ind_B,
+                       bsr_row_ptr_C,
+                       (rocsparse_int*)nullptr,
+                       descr_A->base,
+                       descr_B->base,
+                       descr_C->base);
+#undef BSRGEMM_CHUNKSIZE
+#undef BSRGEMM_SUB
+#undef BSRGEMM_DIM
+
+    // Exclusive sum to obtain block row pointers of C
+    bool  rocprim_alloc;
+    void* rocprim_buffer;
+
+    if(handle->buffer_size >= rocprim_size)
+    {
+        rocprim_buffer = handle->buffer;
+        rocprim_alloc  = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+        rocprim_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                bsr_row_ptr_C,
+                                                bsr_row_ptr_C,
+                                                static_cast<rocsparse_int>(descr_C->base),
+                                                mb + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(rocprim_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+    }
+
+    // Extract the number of non-zero blocks of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        // Blocking mode
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnzb_C, bsr_row_ptr_C + mb, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust index base of nnzb_C
+        *nnzb_C -= descr_C->base;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnzb_C, bsr_row_ptr_C + mb, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust index base of nnzb_C
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnzb_C);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_direction       dir,           \
+                                     rocsparse_int             mb,            \
+                                     rocsparse_int             nb,            \
+                                     rocsparse_int             kb,            \
+                                     rocsparse_int             block_dim,     \
+                                     const TYPE*               alpha,         \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnzb_A,        \
+                                     const TYPE*               bsr_val_A,     \
+                                     const rocsparse_int*      bsr_row_ptr_A, \
+                                     const rocsparse_int*      bsr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_B,       \
+                                     rocsparse_int             nnzb_B,        \
+                                     const TYPE*               bsr_val_B,     \
+                                     const rocsparse_int*      bsr_row_ptr_B, \
+                                     const rocsparse_int*      bsr_col_ind_B, \
+                                     const rocsparse_mat_descr descr_C,       \
+                                     TYPE*                     bsr_val_C,     \
+                                     const rocsparse_int*      bsr_row_ptr_C, \
+                                     rocsparse_int*            bsr_col_ind_C) \
+    {                                                                         \
+        return rocsparse_bsrgemm_template(handle,                             \
+                                          dir,                                \
+                                          mb,                                 \
+                                          nb,                                 \
+                                          kb,                                 \
+                                          block_dim,                          \
+                                          alpha,                              \
+                                          descr_A,                            \
+                                          nnzb_A,                             \
+                                          bsr_val_A,                          \
+                                          bsr_row_ptr_A,                      \
+                                          bsr_col_ind_A,                      \
+                                          descr_B,                            \
+                                          nnzb_B,                             \
+                                          bsr_val_B,                          \
+                                          bsr_row_ptr_B,                      \
+                                          bsr_col_ind_B,                      \
+                                          descr_C,                            \
+                                          bsr_val_C,                          \
+                                          bsr_row_ptr_C,                      \
+                                          bsr_col_ind_C);                     \
+    }
+
+C_IMPL(rocsparse_sbsrgemm, float);
+C_IMPL(rocsparse_dbsrgemm, double);
+C_IMPL(rocsparse_cbsrgemm, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrgemm, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -381,6 +381,109 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
         add);
 }
 
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_fill_deterministic_host_pointer(J m,
+                                                 J offset,
+                                                 const J* __restrict__ perm,
+                                                 T alpha,
+                                                 const I* __restrict__ csr_row_ptr_A,
+                                                 const J* __restrict__ csr_col_ind_A,
+                                                 const T* __restrict__ csr_val_A,
+                                                 const I* __restrict__ csr_row_ptr_B,
+                                                 const J* __restrict__ csr_col_ind_B,
+                                                 const T* __restrict__ csr_val_B,
+                                                 T beta,
+                                                 const I* __restrict__ csr_row_ptr_D,
+                                                 const J* __restrict__ csr_col_ind_D,
+                                                 const T* __restrict__ csr_val_D,
+                                                 const I* __restrict__ csr_row_ptr_C,
+                                                 const J* __restrict__ csr_col_ind_C,
+                                                 T* __restrict__ csr_val_C,
+                                                 rocsparse_index_base idx_base_A,
+                                                 rocsparse_index_base idx_base_B,
+                                                 rocsparse_index_base idx_base_C,
+                                                 rocsparse_index_base idx_base_D,
+                                                 bool                 mul,
+                                                 bool                 add)
+{
+    csrgemm_fill_deterministic_wf_per_row_device<BLOCKSIZE, WFSIZE>(m,
+                                                                    offset,
+                                                                    perm,
+                                                                    alpha,
+                                                                    csr_row_ptr_A,
+                                                                    csr_col_ind_A,
+                                                                    csr_val_A,
+                                                                    csr_row_ptr_B,
+                                                                    csr_col_ind_B,
+                                                                    csr_val_B,
+                                                                    beta,
+                                                                    csr_row_ptr_D,
+                                                                    csr_col_ind_D,
+                                                                    csr_val_D,
+                                                                    csr_row_ptr_C,
+                                                                    csr_col_ind_C,
+                                                                    csr_val_C,
+                                                                    idx_base_A,
+                                                                    idx_base_B,
+                                                                    idx_base_C,
+                                                                    idx_base_D,
+                                                                    mul,
+                                                                    add);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_fill_deterministic_device_pointer(J m,
+                                                   J offset,
+                                                   const J* __restrict__ perm,
+                                                   const T* __restrict__ alpha,
+                                                   const I* __restrict__ csr_row_ptr_A,
+                                                   const J* __restrict__ csr_col_ind_A,
+                                                   const T* __restrict__ csr_val_A,
+                                                   const I* __restrict__ csr_row_ptr_B,
+                                                   const J* __restrict__ csr_col_ind_B,
+                                                   const T* __restrict__ csr_val_B,
+                                                   const T* __restrict__ beta,
+                                                   const I* __restrict__ csr_row_ptr_D,
+                                                   const J* __restrict__ csr_col_ind_D,
+                                                   const T* __restrict__ csr_val_D,
+                                                   const I* __restrict__ csr_row_ptr_C,
+                                                   const J* __restrict__ csr_col_ind_C,
+                                                   T* __restrict__ csr_val_C,
+                                                   rocsparse_index_base idx_base_A,
+                                                   rocsparse_index_base idx_base_B,
+                                                   rocsparse_index_base idx_base_C,
+                                                   rocsparse_index_base idx_base_D,
+                                                   bool                 mul,
+                                                   bool                 add)
+{
+    csrgemm_fill_deterministic_wf_per_row_device<BLOCKSIZE, WFSIZE>(
+        m,
+        offset,
+        perm,
+        (mul == true) ? *alpha : static_cast<T>(0),
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        (add == true) ? *beta : static_cast<T>(0),
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add);
+}
+
 // Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
 // if I == J == int64_t, as required size would exceed available memory
 template <typename I,
@@ -542,56 +645,22 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T>
-static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handle,
-                                                               rocsparse_operation       trans_A,
-                                                               rocsparse_operation       trans_B,
-                                                               J                         m,
-                                                               J                         n,
-                                                               J                         k,
-                                                               const T*                  alpha,
-                                                               const rocsparse_mat_descr descr_A,
-                                                               I                         nnz_A,
-                                                               const T*                  csr_val_A,
-                                                               const I* csr_row_ptr_A,
-                                                               const J* csr_col_ind_A,
-                                                               const rocsparse_mat_descr descr_B,
-                                                               I                         nnz_B,
-                                                               const T*                  csr_val_B,
-                                                               const I* csr_row_ptr_B,
-                                                               const J* csr_col_ind_B,
-                                                               const T* beta,
-                                                               const rocsparse_mat_descr descr_D,
-                                                               I                         nnz_D,
-                                                               const T*                  csr_val_D,
-                                                               const I* csr_row_ptr_D,
-                                                               const J* csr_col_ind_D,
-                                                               const rocsparse_mat_descr descr_C,
-                                                               T*                        csr_val_C,
-                                                               const I* csr_row_ptr_C,
-                                                               J*       csr_col_ind_C,
-                                                               const rocsparse_mat_info info_C,
-                                                               void*                    temp_buffer)
+// Sort the rows of C into groups of similar row nnz. The number of rows per group is
+// returned on the host, group offsets and row permutation are placed into the temporary
+// buffer. If no row exceeds 16 non-zeros, all rows form the first group and no
+// permutation is required.
+template <bool EXCEEDING_SMEM, typename I, typename J>
+static inline rocsparse_status csrgemm_group_rows(rocsparse_handle handle,
+                                                  J                m,
+                                                  const I*         csr_row_ptr_C,
+                                                  J*               h_group_size,
+                                                  J**              group_offset,
+                                                  J**              perm,
+                                                  void*            temp_buffer)
 {
     // Stream
     hipStream_t stream = handle->stream;
 
-    // Index base
-    rocsparse_index_base base_A
-        = info_C->csrgemm_info->mul ? descr_A->base : rocsparse_index_base_zero;
-    rocsparse_index_base base_B
-        = info_C->csrgemm_info->mul ? descr_B->base : rocsparse_index_base_zero;
-    rocsparse_index_base base_D
-        = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
-
-    // Flag for exceeding shared memory
-    constexpr bool exceeding_smem
-        = std::is_same<T, rocsparse_double_complex>::value
-          || (std::is_same<T, double>::value && std::is_same<I, int64_t>::value
-              && std::is_same<J, int64_t>::value)
-          || (std::is_same<T, rocsparse_float_complex>::value && std::is_same<I, int64_t>::value
-              && std::is_same<J, int64_t>::value);
-
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
@@ -627,9 +696,6 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     J* d_group_offset = reinterpret_cast<J*>(buffer);
     buffer += sizeof(J) * 256;
 
-    // Group size buffer
-    J h_group_size[CSRGEMM_MAXGROUPS];
-
     // Initialize group sizes with zero
     memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
 
@@ -660,7 +726,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         // Determine number of rows per group
 #define CSRGEMM_DIM 256
         hipLaunchKernelGGL(
-            (csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, exceeding_smem>),
+            (csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, EXCEEDING_SMEM>),
             dim3(CSRGEMM_DIM),
             dim3(CSRGEMM_DIM),
             0,
@@ -698,7 +764,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                     stream));
 
         // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
                                            d_group_size,
                                            sizeof(J) * CSRGEMM_MAXGROUPS,
                                            hipMemcpyDeviceToHost,
@@ -736,6 +802,84 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
     }
 
+    *group_offset = d_group_offset;
+    *perm         = d_perm;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handle,
+                                                               rocsparse_operation       trans_A,
+                                                               rocsparse_operation       trans_B,
+                                                               J                         m,
+                                                               J                         n,
+                                                               J                         k,
+                                                               const T*                  alpha,
+                                                               const rocsparse_mat_descr descr_A,
+                                                               I                         nnz_A,
+                                                               const T*                  csr_val_A,
+                                                               const I* csr_row_ptr_A,
+                                                               const J* csr_col_ind_A,
+                                                               const rocsparse_mat_descr descr_B,
+                                                               I                         nnz_B,
+                                                               const T*                  csr_val_B,
+                                                               const I* csr_row_ptr_B,
+                                                               const J* csr_col_ind_B,
+                                                               const T* beta,
+                                                               const rocsparse_mat_descr descr_D,
+                                                               I                         nnz_D,
+                                                               const T*                  csr_val_D,
+                                                               const I* csr_row_ptr_D,
+                                                               const J* csr_col_ind_D,
+                                                               const rocsparse_mat_descr descr_C,
+                                                               T*                        csr_val_C,
+                                                               const I* csr_row_ptr_C,
+                                                               J*       csr_col_ind_C,
+                                                               const rocsparse_mat_info info_C,
+                                                               void*                    temp_buffer)
+{
+    // The kernel configuration depends on the row nnz distribution, that is read
+    // back to the host. This cannot be captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Index base
+    rocsparse_index_base base_A
+        = info_C->csrgemm_info->mul ? descr_A->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_B
+        = info_C->csrgemm_info->mul ? descr_B->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_D
+        = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
+
+    // In deterministic mode, the values of C are computed with a fixed summation order
+    // once the sparsity pattern of C is known. Thus, the hash based fill only determines
+    // the column indices of C and skips the atomic accumulation of the values.
+    bool deterministic = handle->deterministic_mode == rocsparse_deterministic_mode_enabled
+                         && info_C->csrgemm_info->mul == true;
+    T*   fill_val_C    = deterministic ? nullptr : csr_val_C;
+
+    // Flag for exceeding shared memory
+    constexpr bool exceeding_smem
+        = std::is_same<T, rocsparse_double_complex>::value
+          || (std::is_same<T, double>::value && std::is_same<I, int64_t>::value
+              && std::is_same<J, int64_t>::value)
+          || (std::is_same<T, rocsparse_float_complex>::value && std::is_same<I, int64_t>::value
+              && std::is_same<J, int64_t>::value);
+
+    // Group rows of C by their number of non-zeros
+    J  h_group_size[CSRGEMM_MAXGROUPS];
+    J* d_group_offset;
+    J* d_perm;
+
+    RETURN_IF_ROCSPARSE_ERROR((csrgemm_group_rows<exceeding_smem>(
+        handle, m, csr_row_ptr_C, h_group_size, &d_group_offset, &d_perm, temp_buffer)));
+
     // Compute columns and accumulate values for each group
 
     // pointer mode device
@@ -772,7 +916,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -815,7 +959,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -857,7 +1001,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -899,7 +1043,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -941,7 +1085,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -983,7 +1127,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1019,7 +1163,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                        csr_val_D,
                                                        csr_row_ptr_C,
                                                        csr_col_ind_C,
-                                                       csr_val_C,
+                                                       fill_val_C,
                                                        base_A,
                                                        base_B,
                                                        descr_C->base,
@@ -1067,7 +1211,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                 csr_val_D,
                 csr_row_ptr_C,
                 csr_col_ind_C,
-                csr_val_C,
+                fill_val_C,
                 workspace_B,
                 base_A,
                 base_B,
@@ -1118,7 +1262,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1161,7 +1305,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1203,7 +1347,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1245,7 +1389,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1287,7 +1431,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1329,7 +1473,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                csr_val_D,
                                csr_row_ptr_C,
                                csr_col_ind_C,
-                               csr_val_C,
+                               fill_val_C,
                                base_A,
                                base_B,
                                descr_C->base,
@@ -1365,7 +1509,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                        csr_val_D,
                                                        csr_row_ptr_C,
                                                        csr_col_ind_C,
-                                                       csr_val_C,
+                                                       fill_val_C,
                                                        base_A,
                                                        base_B,
                                                        descr_C->base,
@@ -1413,7 +1557,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                 csr_val_D,
                 csr_row_ptr_C,
                 csr_col_ind_C,
-                csr_val_C,
+                fill_val_C,
                 workspace_B,
                 base_A,
                 base_B,
@@ -1432,6 +1576,78 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         }
     }
 
+    // In deterministic mode, the values of C are computed with a fixed summation order
+    if(deterministic)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrgemm_fill_deterministic_device_pointer<CSRGEMM_DIM, CSRGEMM_SUB>),
+                               dim3((CSRGEMM_SUB * m - 1) / CSRGEMM_DIM + 1),
+                               dim3(CSRGEMM_DIM),
+                               0,
+                               stream,
+                               m,
+                               (J)0,
+                               (const J*)nullptr,
+                               alpha,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               csr_val_A,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               csr_val_B,
+                               beta,
+                               csr_row_ptr_D,
+                               csr_col_ind_D,
+                               csr_val_D,
+                               csr_row_ptr_C,
+                               csr_col_ind_C,
+                               csr_val_C,
+                               base_A,
+                               base_B,
+                               descr_C->base,
+                               base_D,
+                               true,
+                               info_C->csrgemm_info->add);
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                (csrgemm_fill_deterministic_host_pointer<CSRGEMM_DIM, CSRGEMM_SUB>),
+                dim3((CSRGEMM_SUB * m - 1) / CSRGEMM_DIM + 1),
+                dim3(CSRGEMM_DIM),
+                0,
+                stream,
+                m,
+                (J)0,
+                (const J*)nullptr,
+                *alpha,
+                csr_row_ptr_A,
+                csr_col_ind_A,
+                csr_val_A,
+                csr_row_ptr_B,
+                csr_col_ind_B,
+                csr_val_B,
+                (info_C->csrgemm_info->add == true) ? *beta : static_cast<T>(0),
+                csr_row_ptr_D,
+                csr_col_ind_D,
+                csr_val_D,
+                csr_row_ptr_C,
+                csr_col_ind_C,
+                csr_val_C,
+                base_A,
+                base_B,
+                descr_C->base,
+                base_D,
+                true,
+                info_C->csrgemm_info->add);
+        }
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
     return rocsparse_status_success;
 }
 
@@ -2207,6 +2423,339 @@ INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
 #undef INSTANTIATE
 
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_symbolic_template(rocsparse_handle         handle,
+                                                     J                        m,
+                                                     I                        nnz_C,
+                                                     const I*                 csr_row_ptr_C,
+                                                     const rocsparse_mat_info info_C,
+                                                     void*                    temp_buffer)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(info_C == nullptr || info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid sizes
+    if(m < 0 || nnz_C < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(m > 0 && (csr_row_ptr_C == nullptr || temp_buffer == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrgemm_info plan = info_C->csrgemm_info;
+
+    // Clear previous plan
+    plan->symbolic = false;
+
+    if(plan->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(plan->perm));
+        plan->perm = nullptr;
+    }
+
+    memset(plan->group_size, 0, sizeof(plan->group_size));
+
+    if(m > 0)
+    {
+        // The groups only determine the (sub)wavefront size of the numeric stage,
+        // thus the grouping does not depend on the available shared memory
+        J  h_group_size[CSRGEMM_MAXGROUPS];
+        J* d_group_offset;
+        J* d_perm;
+
+        RETURN_IF_ROCSPARSE_ERROR((csrgemm_group_rows<false>(
+            handle, m, csr_row_ptr_C, h_group_size, &d_group_offset, &d_perm, temp_buffer)));
+
+        // The permutation lives in the temporary buffer, so it is copied into the plan
+        if(d_perm != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipMalloc(&plan->perm, sizeof(J) * m));
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                plan->perm, d_perm, sizeof(J) * m, hipMemcpyDeviceToDevice, handle->stream));
+        }
+
+        for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+        {
+            plan->group_size[i] = h_group_size[i];
+        }
+    }
+
+    plan->m        = m;
+    plan->nnz      = nnz_C;
+    plan->symbolic = true;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_numeric_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    J                         k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    I                         nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const I*                  csr_row_ptr_A,
+                                                    const J*                  csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    I                         nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const I*                  csr_row_ptr_B,
+                                                    const J*                  csr_col_ind_B,
+                                                    const T*                  beta,
+                                                    const rocsparse_mat_descr descr_D,
+                                                    I                         nnz_D,
+                                                    const T*                  csr_val_D,
+                                                    const I*                  csr_row_ptr_D,
+                                                    const J*                  csr_col_ind_D,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    I                         nnz_C,
+                                                    T*                        csr_val_C,
+                                                    const I*                  csr_row_ptr_C,
+                                                    const J*                  csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Check for valid symbolic plan
+    if(info_C == nullptr || info_C->csrgemm_info == nullptr
+       || info_C->csrgemm_info->symbolic == false)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrgemm_info plan = info_C->csrgemm_info;
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_D < 0 || nnz_C < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The plan has to match the sparsity pattern of C
+    if(plan->m != m || plan->nnz != nnz_C)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid descriptors
+    if(descr_C == nullptr || (plan->mul == true && (descr_A == nullptr || descr_B == nullptr))
+       || (plan->add == true && descr_D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_C == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(csr_val_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(plan->mul == true
+       && (alpha == nullptr || csr_row_ptr_A == nullptr || csr_row_ptr_B == nullptr
+           || (nnz_A > 0 && (csr_val_A == nullptr || csr_col_ind_A == nullptr))
+           || (nnz_B > 0 && (csr_val_B == nullptr || csr_col_ind_B == nullptr))))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(plan->add == true
+       && (beta == nullptr || csr_row_ptr_D == nullptr
+           || (nnz_D > 0 && (csr_val_D == nullptr || csr_col_ind_D == nullptr))))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Index base
+    rocsparse_index_base base_A = plan->mul ? descr_A->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_B = plan->mul ? descr_B->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_D = plan->add ? descr_D->base : rocsparse_index_base_zero;
+
+    const J* perm = reinterpret_cast<const J*>(plan->perm);
+
+#define LAUNCH_CSRGEMM_NUMERIC(WFSIZE)                                                       \
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)                                \
+    {                                                                                        \
+        hipLaunchKernelGGL((csrgemm_fill_deterministic_device_pointer<CSRGEMM_DIM, WFSIZE>), \
+                           dim3((WFSIZE * size - 1) / CSRGEMM_DIM + 1),                      \
+                           dim3(CSRGEMM_DIM),                                                \
+                           0,                                                                \
+                           handle->stream,                                                   \
+                           size,                                                             \
+                           offset,                                                           \
+                           perm,                                                             \
+                           alpha,                                                            \
+                           csr_row_ptr_A,                                                    \
+                           csr_col_ind_A,                                                    \
+                           csr_val_A,                                                        \
+                           csr_row_ptr_B,                                                    \
+                           csr_col_ind_B,                                                    \
+                           csr_val_B,                                                        \
+                           beta,                                                             \
+                           csr_row_ptr_D,                                                    \
+                           csr_col_ind_D,                                                    \
+                           csr_val_D,                                                        \
+                           csr_row_ptr_C,                                                    \
+                           csr_col_ind_C,                                                    \
+                           csr_val_C,                                                        \
+                           base_A,                                                           \
+                           base_B,                                                           \
+                           descr_C->base,                                                    \
+                           base_D,                                                           \
+                           plan->mul,                                                        \
+                           plan->add);                                                       \
+    }                                                                                        \
+    else                                                                                     \
+    {                                                                                        \
+        hipLaunchKernelGGL((csrgemm_fill_deterministic_host_pointer<CSRGEMM_DIM, WFSIZE>),   \
+                           dim3((WFSIZE * size - 1) / CSRGEMM_DIM + 1),                      \
+                           dim3(CSRGEMM_DIM),                                                \
+                           0,                                                                \
+                           handle->stream,                                                   \
+                           size,                                                             \
+                           offset,                                                           \
+                           perm,                                                             \
+                           (plan->mul == true) ? *alpha : static_cast<T>(0),                 \
+                           csr_row_ptr_A,                                                    \
+                           csr_col_ind_A,                                                    \
+                           csr_val_A,                                                        \
+                           csr_row_ptr_B,                                                    \
+                           csr_col_ind_B,                                                    \
+                           csr_val_B,                                                        \
+                           (plan->add == true) ? *beta : static_cast<T>(0),                  \
+                           csr_row_ptr_D,                                                    \
+                           csr_col_ind_D,                                                    \
+                           csr_val_D,                                                        \
+                           csr_row_ptr_C,                                                    \
+                           csr_col_ind_C,                                                    \
+                           csr_val_C,                                                        \
+                           base_A,                                                           \
+                           base_B,                                                           \
+                           descr_C->base,                                                    \
+                           base_D,                                                           \
+                           plan->mul,                                                        \
+                           plan->add);                                                       \
+    }
+
+    // Only the values of C are computed, using the (sorted) column indices of C. Rows
+    // with more non-zeros are processed by larger (sub)wavefronts. Since neither the
+    // row distribution has to be read back nor additional memory is allocated, this
+    // stage does not synchronize with the host.
+    J offset = 0;
+
+#define CSRGEMM_DIM 256
+    for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+    {
+        J size = static_cast<J>(plan->group_size[i]);
+
+        if(size > 0)
+        {
+            if(i == 0)
+            {
+                // Group 0: 0 - 16 non-zeros per row
+                LAUNCH_CSRGEMM_NUMERIC(8);
+            }
+            else if(i == 1)
+            {
+                // Group 1: 17 - 32 non-zeros per row
+                LAUNCH_CSRGEMM_NUMERIC(16);
+            }
+            else
+            {
+                // Groups 2 - 7: more than 32 non-zeros per row
+                LAUNCH_CSRGEMM_NUMERIC(32);
+            }
+        }
+
+        offset += size;
+    }
+#undef CSRGEMM_DIM
+#undef LAUNCH_CSRGEMM_NUMERIC
+
+    return rocsparse_status_success;
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                                \
+    template rocsparse_status rocsparse_csrgemm_symbolic_template<ITYPE, JTYPE>( \
+        rocsparse_handle         handle,                                         \
+        JTYPE                    m,                                              \
+        ITYPE                    nnz_C,                                          \
+        const ITYPE*             csr_row_ptr_C,                                  \
+        const rocsparse_mat_info info_C,                                         \
+        void*                    temp_buffer);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                               \
+    template rocsparse_status rocsparse_csrgemm_numeric_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                              \
+        JTYPE                     m,                                                   \
+        JTYPE                     n,                                                   \
+        JTYPE                     k,                                                   \
+        const TTYPE*              alpha,                                               \
+        const rocsparse_mat_descr descr_A,                                             \
+        ITYPE                     nnz_A,                                               \
+        const TTYPE*              csr_val_A,                                           \
+        const ITYPE*              csr_row_ptr_A,                                       \
+        const JTYPE*              csr_col_ind_A,                                       \
+        const rocsparse_mat_descr descr_B,                                             \
+        ITYPE                     nnz_B,                                               \
+        const TTYPE*              csr_val_B,                                           \
+        const ITYPE*              csr_row_ptr_B,                                       \
+        const JTYPE*              csr_col_ind_B,                                       \
+        const TTYPE*              beta,                                                \
+        const rocsparse_mat_descr descr_D,                                             \
+        ITYPE                     nnz_D,                                               \
+        const TTYPE*              csr_val_D,                                           \
+        const ITYPE*              csr_row_ptr_D,                                       \
+        const JTYPE*              csr_col_ind_D,                                       \
+        const rocsparse_mat_descr descr_C,                                             \
+        ITYPE                     nnz_C,                                               \
+        TTYPE*                    csr_val_C,                                           \
+        const ITYPE*              csr_row_ptr_C,                                       \
+        const JTYPE*              csr_col_ind_C,                                       \
+        const rocsparse_mat_info  info_C);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
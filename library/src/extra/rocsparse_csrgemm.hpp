@@ -112,4 +112,41 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             const rocsparse_mat_info  info_C,
                                             void*                     temp_buffer);
 
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_symbolic_template(rocsparse_handle         handle,
+                                                     J                        m,
+                                                     I                        nnz_C,
+                                                     const I*                 csr_row_ptr_C,
+                                                     const rocsparse_mat_info info_C,
+                                                     void*                    temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_numeric_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    J                         n,
+                                                    J                         k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    I                         nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const I*                  csr_row_ptr_A,
+                                                    const J*                  csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    I                         nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const I*                  csr_row_ptr_B,
+                                                    const J*                  csr_col_ind_B,
+                                                    const T*                  beta,
+                                                    const rocsparse_mat_descr descr_D,
+                                                    I                         nnz_D,
+                                                    const T*                  csr_val_D,
+                                                    const I*                  csr_row_ptr_D,
+                                                    const J*                  csr_col_ind_D,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    I                         nnz_C,
+                                                    T*                        csr_val_C,
+                                                    const I*                  csr_row_ptr_C,
+                                                    const J*                  csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C);
+
 #endif // ROCSPARSE_CSRGEMM_HPP
@@ -0,0 +1,767 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrgemm.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include <limits>
+#include <vector>
+
+// Upper bound of the number of non-zero entries of each row of C, computed from
+// the number of intermediate products and the non-zero entries of D
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_chunked_row_bound(rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                   const rocsparse_int* __restrict__ csr_col_ind_A,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_D,
+                                   rocsparse_int* __restrict__ row_bound,
+                                   rocsparse_index_base idx_base_A,
+                                   bool                 mul,
+                                   bool                 add)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    int64_t bound = 0;
+
+    if(mul == true)
+    {
+        rocsparse_int row_begin = csr_row_ptr_A[row] - idx_base_A;
+        rocsparse_int row_end   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind_A[j] - idx_base_A;
+
+            bound += csr_row_ptr_B[col + 1] - csr_row_ptr_B[col];
+        }
+    }
+
+    if(add == true)
+    {
+        bound += csr_row_ptr_D[row + 1] - csr_row_ptr_D[row];
+    }
+
+    // A row of C cannot hold more than n entries
+    row_bound[row] = static_cast<rocsparse_int>((bound < n) ? bound : n);
+}
+
+// Size of a single chunk slot, i.e. row pointers, column indices and values of C
+template <typename T>
+static inline size_t csrgemm_chunked_slot_size(rocsparse_int rows, int64_t nnz)
+{
+    size_t size = 0;
+
+    size += ((sizeof(rocsparse_int) * (rows + 1) - 1) / 256 + 1) * 256;
+    size += ((sizeof(rocsparse_int) * std::max(nnz, static_cast<int64_t>(1)) - 1) / 256 + 1) * 256;
+    size += ((sizeof(T) * std::max(nnz, static_cast<int64_t>(1)) - 1) / 256 + 1) * 256;
+
+    return size;
+}
+
+// Split the rows of C into chunks, such that two chunk slots and the row arrays
+// of the csrgemm buffer fit into the given budget
+template <typename T>
+static inline rocsparse_status
+    csrgemm_chunked_partition(rocsparse_int                     m,
+                              const std::vector<rocsparse_int>& bound,
+                              bool                              split,
+                              size_t                            budget,
+                              std::vector<rocsparse_int>&       chunks,
+                              rocsparse_int&                    max_rows,
+                              int64_t&                          max_nnz)
+{
+    // Bytes per row for both slots and the per row arrays of the csrgemm buffer
+    size_t row_cost = 2 * sizeof(rocsparse_int) + 4 * sizeof(rocsparse_int);
+    size_t nnz_cost = 2 * (sizeof(rocsparse_int) + sizeof(T));
+
+    chunks.clear();
+    chunks.push_back(0);
+
+    max_rows = 0;
+    max_nnz  = 0;
+
+    size_t  chunk_cost = 0;
+    int64_t chunk_nnz  = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        size_t cost = row_cost + nnz_cost * bound[i];
+
+        // A single row has to fit the budget
+        if(split == true && cost > budget)
+        {
+            return rocsparse_status_memory_error;
+        }
+
+        // Close the current chunk, if the row does not fit anymore
+        if(split == true && i > chunks.back()
+           && (chunk_cost + cost > budget
+               || chunk_nnz + bound[i] > std::numeric_limits<rocsparse_int>::max()))
+        {
+            max_rows = std::max(max_rows, i - chunks.back());
+            max_nnz  = std::max(max_nnz, chunk_nnz);
+
+            chunks.push_back(i);
+
+            chunk_cost = 0;
+            chunk_nnz  = 0;
+        }
+
+        chunk_cost += cost;
+        chunk_nnz += bound[i];
+    }
+
+    max_rows = std::max(max_rows, m - chunks.back());
+    max_nnz  = std::max(max_nnz, chunk_nnz);
+
+    chunks.push_back(m);
+
+    return rocsparse_status_success;
+}
+
+// Device and host resources of the chunked csrgemm. They are released on every
+// return path, including early returns on errors.
+struct csrgemm_chunked_resources
+{
+    hipStream_t    stream           = nullptr;
+    rocsparse_int* d_bound          = nullptr;
+    char*          workspace        = nullptr;
+    char*          host_workspace   = nullptr;
+    hipStream_t    copy_stream      = nullptr;
+    hipEvent_t     compute_event[2] = {nullptr, nullptr};
+    hipEvent_t     copy_event[2]    = {nullptr, nullptr};
+
+    ~csrgemm_chunked_resources()
+    {
+        // Outstanding kernels and copies need to finish before the workspace can be
+        // released. Errors cannot be reported from here.
+        if(copy_stream != nullptr)
+        {
+            (void)hipStreamSynchronize(copy_stream);
+        }
+
+        (void)hipStreamSynchronize(stream);
+
+        for(int s = 0; s < 2; ++s)
+        {
+            if(compute_event[s] != nullptr)
+            {
+                (void)hipEventDestroy(compute_event[s]);
+            }
+
+            if(copy_event[s] != nullptr)
+            {
+                (void)hipEventDestroy(copy_event[s]);
+            }
+        }
+
+        if(copy_stream != nullptr)
+        {
+            (void)hipStreamDestroy(copy_stream);
+        }
+
+        if(host_workspace != nullptr)
+        {
+            (void)hipHostFree(host_workspace);
+        }
+
+        if(workspace != nullptr)
+        {
+            (void)hipFree(workspace);
+        }
+
+        if(d_bound != nullptr)
+        {
+            (void)hipFree(d_bound);
+        }
+    }
+};
+
+template <typename T>
+static rocsparse_status
+    rocsparse_csrgemm_chunked_pipeline(rocsparse_handle                  handle,
+                                       rocsparse_operation               trans_A,
+                                       rocsparse_operation               trans_B,
+                                       rocsparse_int                     n,
+                                       rocsparse_int                     k,
+                                       const T*                          alpha,
+                                       const rocsparse_mat_descr         descr_A,
+                                       rocsparse_int                     nnz_A,
+                                       const T*                          csr_val_A,
+                                       const rocsparse_int*              csr_row_ptr_A,
+                                       const rocsparse_int*              csr_col_ind_A,
+                                       const rocsparse_mat_descr         descr_B,
+                                       rocsparse_int                     nnz_B,
+                                       const T*                          csr_val_B,
+                                       const rocsparse_int*              csr_row_ptr_B,
+                                       const rocsparse_int*              csr_col_ind_B,
+                                       const T*                          beta,
+                                       const rocsparse_mat_descr         descr_D,
+                                       rocsparse_int                     nnz_D,
+                                       const T*                          csr_val_D,
+                                       const rocsparse_int*              csr_row_ptr_D,
+                                       const rocsparse_int*              csr_col_ind_D,
+                                       const rocsparse_mat_descr         descr_C,
+                                       const rocsparse_mat_info          info_C,
+                                       const std::vector<rocsparse_int>& chunks,
+                                       rocsparse_int                     max_rows,
+                                       int64_t                           max_nnz,
+                                       char*                             workspace,
+                                       char*                             host_workspace,
+                                       void*                             temp_buffer,
+                                       hipStream_t                       copy_stream,
+                                       hipEvent_t*                       compute_event,
+                                       hipEvent_t*                       copy_event,
+                                       rocsparse_csrgemm_chunk_callback  callback,
+                                       void*                             user_data)
+{
+    size_t slot_size = csrgemm_chunked_slot_size<T>(max_rows, max_nnz);
+
+    size_t row_ptr_size = ((sizeof(rocsparse_int) * (max_rows + 1) - 1) / 256 + 1) * 256;
+    size_t col_ind_size
+        = ((sizeof(rocsparse_int) * std::max(max_nnz, static_cast<int64_t>(1)) - 1) / 256 + 1)
+          * 256;
+
+    rocsparse_int nchunks = static_cast<rocsparse_int>(chunks.size()) - 1;
+
+    // Chunk slot arrays, both on device and host. A single chunk requires a single slot.
+    rocsparse_int* d_row_ptr[2];
+    rocsparse_int* d_col_ind[2];
+    T*             d_val[2];
+    rocsparse_int* h_row_ptr[2];
+    rocsparse_int* h_col_ind[2];
+    T*             h_val[2];
+
+    for(int s = 0; s < std::min(nchunks, 2); ++s)
+    {
+        char* dptr = workspace + s * slot_size;
+        char* hptr = host_workspace + s * slot_size;
+
+        d_row_ptr[s] = reinterpret_cast<rocsparse_int*>(dptr);
+        d_col_ind[s] = reinterpret_cast<rocsparse_int*>(dptr + row_ptr_size);
+        d_val[s]     = reinterpret_cast<T*>(dptr + row_ptr_size + col_ind_size);
+        h_row_ptr[s] = reinterpret_cast<rocsparse_int*>(hptr);
+        h_col_ind[s] = reinterpret_cast<rocsparse_int*>(hptr + row_ptr_size);
+        h_val[s]     = reinterpret_cast<T*>(hptr + row_ptr_size + col_ind_size);
+    }
+
+    // Number of non-zero entries of the chunk that currently occupies each slot
+    rocsparse_int slot_nnz[2] = {0, 0};
+
+    // The nnz of each chunk is required on the host to issue the copies
+    rocsparse_pointer_mode ptr_mode;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(handle, &ptr_mode));
+
+    for(rocsparse_int c = 0; c < nchunks + 2; ++c)
+    {
+        int slot = c & 1;
+
+        // Hand the chunk that previously occupied this slot over to the user, once its
+        // copy has finished. This also frees the slot on the device.
+        if(c >= 2)
+        {
+            rocsparse_int p = c - 2;
+
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(copy_event[slot]));
+
+            callback(chunks[p],
+                     chunks[p + 1],
+                     slot_nnz[slot],
+                     h_row_ptr[slot],
+                     h_col_ind[slot],
+                     h_val[slot],
+                     user_data);
+        }
+
+        if(c >= nchunks)
+        {
+            continue;
+        }
+
+        rocsparse_int row_begin = chunks[c];
+        rocsparse_int rows      = chunks[c + 1] - row_begin;
+
+        // Rows of A and D that belong to this chunk
+        const rocsparse_int* chunk_row_ptr_A
+            = (csr_row_ptr_A != nullptr) ? csr_row_ptr_A + row_begin : nullptr;
+        const rocsparse_int* chunk_row_ptr_D
+            = (csr_row_ptr_D != nullptr) ? csr_row_ptr_D + row_begin : nullptr;
+
+        // Row pointers and nnz of the chunk
+        rocsparse_int nnz;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        rocsparse_status status = rocsparse_csrgemm_nnz_template(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 rows,
+                                                                 n,
+                                                                 k,
+                                                                 descr_A,
+                                                                 nnz_A,
+                                                                 chunk_row_ptr_A,
+                                                                 csr_col_ind_A,
+                                                                 descr_B,
+                                                                 nnz_B,
+                                                                 csr_row_ptr_B,
+                                                                 csr_col_ind_B,
+                                                                 descr_D,
+                                                                 nnz_D,
+                                                                 chunk_row_ptr_D,
+                                                                 csr_col_ind_D,
+                                                                 descr_C,
+                                                                 d_row_ptr[slot],
+                                                                 &nnz,
+                                                                 info_C,
+                                                                 temp_buffer);
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, ptr_mode));
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        // Column indices and values of the chunk
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_template(handle,
+                                                             trans_A,
+                                                             trans_B,
+                                                             rows,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_val_A,
+                                                             chunk_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descr_B,
+                                                             nnz_B,
+                                                             csr_val_B,
+                                                             csr_row_ptr_B,
+                                                             csr_col_ind_B,
+                                                             beta,
+                                                             descr_D,
+                                                             nnz_D,
+                                                             csr_val_D,
+                                                             chunk_row_ptr_D,
+                                                             csr_col_ind_D,
+                                                             descr_C,
+                                                             d_val[slot],
+                                                             d_row_ptr[slot],
+                                                             d_col_ind[slot],
+                                                             info_C,
+                                                             temp_buffer));
+
+        // Copy the chunk to the host on the second stream, such that the copy overlaps
+        // with the computation of the next chunk
+        RETURN_IF_HIP_ERROR(hipEventRecord(compute_event[slot], handle->stream));
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(copy_stream, compute_event[slot], 0));
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_row_ptr[slot],
+                                           d_row_ptr[slot],
+                                           sizeof(rocsparse_int) * (rows + 1),
+                                           hipMemcpyDeviceToHost,
+                                           copy_stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_col_ind[slot],
+                                           d_col_ind[slot],
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToHost,
+                                           copy_stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            h_val[slot], d_val[slot], sizeof(T) * nnz, hipMemcpyDeviceToHost, copy_stream));
+
+        RETURN_IF_HIP_ERROR(hipEventRecord(copy_event[slot], copy_stream));
+
+        slot_nnz[slot] = nnz;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_chunked_template(rocsparse_handle                 handle,
+                                                    rocsparse_operation              trans_A,
+                                                    rocsparse_operation              trans_B,
+                                                    rocsparse_int                    m,
+                                                    rocsparse_int                    n,
+                                                    rocsparse_int                    k,
+                                                    const T*                         alpha,
+                                                    const rocsparse_mat_descr        descr_A,
+                                                    rocsparse_int                    nnz_A,
+                                                    const T*                         csr_val_A,
+                                                    const rocsparse_int*             csr_row_ptr_A,
+                                                    const rocsparse_int*             csr_col_ind_A,
+                                                    const rocsparse_mat_descr        descr_B,
+                                                    rocsparse_int                    nnz_B,
+                                                    const T*                         csr_val_B,
+                                                    const rocsparse_int*             csr_row_ptr_B,
+                                                    const rocsparse_int*             csr_col_ind_B,
+                                                    const T*                         beta,
+                                                    const rocsparse_mat_descr        descr_D,
+                                                    rocsparse_int                    nnz_D,
+                                                    const T*                         csr_val_D,
+                                                    const rocsparse_int*             csr_row_ptr_D,
+                                                    const rocsparse_int*             csr_col_ind_D,
+                                                    const rocsparse_mat_descr        descr_C,
+                                                    rocsparse_mat_info               info_C,
+                                                    size_t                           memory_budget,
+                                                    rocsparse_csrgemm_chunk_callback callback,
+                                                    void*                            user_data)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_chunked"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_val_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)info_C,
+              memory_budget,
+              (const void*&)callback,
+              (const void*&)user_data);
+
+    // Chunks are handed over to the host, which requires synchronization
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_D < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(info_C == nullptr || descr_C == nullptr || callback == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Either alpha or beta must be valid
+    if(alpha == nullptr && beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(alpha != nullptr
+       && (descr_A == nullptr || csr_row_ptr_A == nullptr || descr_B == nullptr
+           || csr_row_ptr_B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(beta != nullptr && (descr_D == nullptr || csr_row_ptr_D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Released on every return path
+    csrgemm_chunked_resources res;
+    res.stream = stream;
+
+    bool mul = (alpha != nullptr && k > 0 && nnz_A > 0 && nnz_B > 0);
+    bool add = (beta != nullptr && nnz_D > 0);
+
+    // Estimate the number of non-zero entries per row of C
+    std::vector<rocsparse_int> bound(m);
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&res.d_bound, sizeof(rocsparse_int) * m));
+
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_chunked_row_bound<CSRGEMM_DIM>),
+                       dim3((m - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_row_ptr_D,
+                       res.d_bound,
+                       (mul == true) ? descr_A->base : rocsparse_index_base_zero,
+                       mul,
+                       add);
+#undef CSRGEMM_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        bound.data(), res.d_bound, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    RETURN_IF_HIP_ERROR(hipFree(res.d_bound));
+    res.d_bound = nullptr;
+
+    // Without products, C = beta * D shares the row pointers of D and cannot be split
+    bool split = mul;
+
+    // Split the rows into chunks. The csrgemm buffer does not scale linearly with the
+    // number of rows, thus the budget is reduced until everything fits.
+    std::vector<rocsparse_int> chunks;
+    rocsparse_int              max_rows;
+    int64_t                    max_nnz;
+
+    size_t budget = memory_budget;
+    size_t buffer_size;
+    size_t workspace_size;
+
+    while(true)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrgemm_chunked_partition<T>(
+            m, bound, split, budget, chunks, max_rows, max_nnz));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size_template(handle,
+                                                                         trans_A,
+                                                                         trans_B,
+                                                                         max_rows,
+                                                                         n,
+                                                                         k,
+                                                                         alpha,
+                                                                         descr_A,
+                                                                         nnz_A,
+                                                                         csr_row_ptr_A,
+                                                                         csr_col_ind_A,
+                                                                         descr_B,
+                                                                         nnz_B,
+                                                                         csr_row_ptr_B,
+                                                                         csr_col_ind_B,
+                                                                         beta,
+                                                                         descr_D,
+                                                                         nnz_D,
+                                                                         csr_row_ptr_D,
+                                                                         csr_col_ind_D,
+                                                                         info_C,
+                                                                         &buffer_size));
+
+        // Double buffering requires two slots, unless there is a single chunk
+        size_t nslots = std::min(chunks.size() - 1, static_cast<size_t>(2));
+
+        buffer_size    = ((buffer_size - 1) / 256 + 1) * 256;
+        workspace_size = nslots * csrgemm_chunked_slot_size<T>(max_rows, max_nnz) + buffer_size;
+
+        if(workspace_size <= memory_budget)
+        {
+            break;
+        }
+
+        size_t excess = workspace_size - memory_budget;
+
+        if(split == false || excess >= budget)
+        {
+            return rocsparse_status_memory_error;
+        }
+
+        budget -= excess;
+    }
+
+    // Device workspace, holding the chunk slots and the csrgemm buffer
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&res.workspace, workspace_size));
+
+    // Pinned host workspace, holding the chunk slots
+    if(hipHostMalloc((void**)&res.host_workspace, workspace_size - buffer_size) != hipSuccess)
+    {
+        res.host_workspace = nullptr;
+        return rocsparse_status_memory_error;
+    }
+
+    // Second stream for the device to host copies
+    RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&res.copy_stream, hipStreamNonBlocking));
+
+    for(int s = 0; s < 2; ++s)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipEventCreateWithFlags(&res.compute_event[s], hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&res.copy_event[s], hipEventDisableTiming));
+    }
+
+    rocsparse_status status
+        = rocsparse_csrgemm_chunked_pipeline(handle,
+                                             trans_A,
+                                             trans_B,
+                                             n,
+                                             k,
+                                             alpha,
+                                             descr_A,
+                                             nnz_A,
+                                             csr_val_A,
+                                             csr_row_ptr_A,
+                                             csr_col_ind_A,
+                                             descr_B,
+                                             nnz_B,
+                                             csr_val_B,
+                                             csr_row_ptr_B,
+                                             csr_col_ind_B,
+                                             beta,
+                                             descr_D,
+                                             nnz_D,
+                                             csr_val_D,
+                                             csr_row_ptr_D,
+                                             csr_col_ind_D,
+                                             descr_C,
+                                             info_C,
+                                             chunks,
+                                             max_rows,
+                                             max_nnz,
+                                             res.workspace,
+                                             res.host_workspace,
+                                             res.workspace + workspace_size - buffer_size,
+                                             res.copy_stream,
+                                             res.compute_event,
+                                             res.copy_event,
+                                             callback,
+                                             user_data);
+
+    // Outstanding copies need to finish before the workspace can be released
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(res.copy_stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return status;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                           \
+    extern "C" rocsparse_status NAME(rocsparse_handle                 handle,        \
+                                     rocsparse_operation              trans_A,       \
+                                     rocsparse_operation              trans_B,       \
+                                     rocsparse_int                    m,             \
+                                     rocsparse_int                    n,             \
+                                     rocsparse_int                    k,             \
+                                     const TYPE*                      alpha,         \
+                                     const rocsparse_mat_descr        descr_A,       \
+                                     rocsparse_int                    nnz_A,         \
+                                     const TYPE*                      csr_val_A,     \
+                                     const rocsparse_int*             csr_row_ptr_A, \
+                                     const rocsparse_int*             csr_col_ind_A, \
+                                     const rocsparse_mat_descr        descr_B,       \
+                                     rocsparse_int                    nnz_B,         \
+                                     const TYPE*                      csr_val_B,     \
+                                     const rocsparse_int*             csr_row_ptr_B, \
+                                     const rocsparse_int*             csr_col_ind_B, \
+                                     const TYPE*                      beta,          \
+                                     const rocsparse_mat_descr        descr_D,       \
+                                     rocsparse_int                    nnz_D,         \
+                                     const TYPE*                      csr_val_D,     \
+                                     const rocsparse_int*             csr_row_ptr_D, \
+                                     const rocsparse_int*             csr_col_ind_D, \
+                                     const rocsparse_mat_descr        descr_C,       \
+                                     rocsparse_mat_info               info_C,        \
+                                     size_t                           memory_budget, \
+                                     rocsparse_csrgemm_chunk_callback callback,      \
+                                     void*                            user_data)     \
+    {                                                                                \
+        return rocsparse_csrgemm_chunked_template(handle,                            \
+                                                  trans_A,                           \
+                                                  trans_B,                           \
+                                                  m,                                 \
+                                                  n,                                 \
+                                                  k,                                 \
+                                                  alpha,                             \
+                                                  descr_A,                           \
+                                                  nnz_A,                             \
+                                                  csr_val_A,                         \
+                                                  csr_row_ptr_A,                     \
+                                                  csr_col_ind_A,                     \
+                                                  descr_B,                           \
+                                                  nnz_B,                             \
+                                                  csr_val_B,                         \
+                                                  csr_row_ptr_B,                     \
+                                                  csr_col_ind_B,                     \
+                                                  beta,                              \
+                                                  descr_D,                           \
+                                                  nnz_D,                             \
+                                                  csr_val_D,                         \
+                                                  csr_row_ptr_D,                     \
+                                                  csr_col_ind_D,                     \
+                                                  descr_C,                           \
+                                                  info_C,                            \
+                                                  memory_budget,                     \
+                                                  callback,                          \
+                                                  user_data);                        \
+    }
+
+C_IMPL(rocsparse_scsrgemm_chunked, float);
+C_IMPL(rocsparse_dcsrgemm_chunked, double);
+C_IMPL(rocsparse_ccsrgemm_chunked, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgemm_chunked, rocsparse_double_complex);
+#undef C_IMPL
@@ -0,0 +1,628 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../conversion/rocsparse_identity.hpp"
+#include "csrgemm_estimate_device.h"
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+#include <cmath>
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_estimate_sample_nnz(rocsparse_int n,
+                                     const rocsparse_int* __restrict__ sample,
+                                     const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                     const rocsparse_int* __restrict__ csr_col_ind_A,
+                                     const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                     const rocsparse_int* __restrict__ csr_col_ind_B,
+                                     rocsparse_int* __restrict__ sample_nnz,
+                                     rocsparse_index_base idx_base_A,
+                                     rocsparse_index_base idx_base_B)
+{
+    csrgemm_estimate_sample_nnz_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(n,
+                                                                     sample,
+                                                                     csr_row_ptr_A,
+                                                                     csr_col_ind_A,
+                                                                     csr_row_ptr_B,
+                                                                     csr_col_ind_B,
+                                                                     sample_nnz,
+                                                                     idx_base_A,
+                                                                     idx_base_B);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int GROUPS>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_estimate_group_bound(rocsparse_int n,
+                                      rocsparse_int m,
+                                      const rocsparse_int* __restrict__ int_prod,
+                                      const rocsparse_int* __restrict__ group,
+                                      int64_t* __restrict__ group_bound)
+{
+    csrgemm_estimate_group_bound_device<BLOCKSIZE, GROUPS>(n, m, int_prod, group, group_bound);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int GROUPS>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_estimate_sample_rows(rocsparse_int nsample,
+                                      rocsparse_int sample_size,
+                                      const rocsparse_int* __restrict__ group_size,
+                                      const rocsparse_int* __restrict__ perm,
+                                      rocsparse_int* __restrict__ sample)
+{
+    csrgemm_estimate_sample_rows_device<BLOCKSIZE, GROUPS>(
+        nsample, sample_size, group_size, perm, sample);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int GROUPS>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_estimate_group_stats(rocsparse_int n,
+                                      rocsparse_int sample_size,
+                                      const rocsparse_int* __restrict__ group_size,
+                                      const rocsparse_int* __restrict__ int_prod,
+                                      const rocsparse_int* __restrict__ sample,
+                                      const rocsparse_int* __restrict__ sample_nnz,
+                                      double* __restrict__ stats)
+{
+    csrgemm_estimate_group_stats_device<BLOCKSIZE, GROUPS>(
+        n, sample_size, group_size, int_prod, sample, sample_nnz, stats);
+}
+
+// Number of standard deviations of the confidence bound
+#define CSRGEMM_ESTIMATE_SIGMAS 3.0
+
+// Device memory that is required to hold the rows of a group of C, i.e. row pointers,
+// column indices and values
+template <typename T>
+static inline size_t csrgemm_estimate_workspace(rocsparse_int rows, int64_t nnz)
+{
+    size_t size = 0;
+
+    size += ((sizeof(rocsparse_int) * (rows + 1) - 1) / 256 + 1) * 256;
+    size += ((sizeof(rocsparse_int) * std::max(nnz, static_cast<int64_t>(1)) - 1) / 256 + 1) * 256;
+    size += ((sizeof(T) * std::max(nnz, static_cast<int64_t>(1)) - 1) / 256 + 1) * 256;
+
+    return size;
+}
+
+// Device memory of rocsparse_csrgemm_estimate_stats(), i.e. intermediate products,
+// group keys and permutation of the group sort, samples and their number of non-zero
+// entries, block partial sums of each group, sample statistics and the rocprim buffer
+static inline size_t csrgemm_estimate_stats_workspace(rocsparse_int m, size_t rocprim_size)
+{
+    size_t size_m      = ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+    size_t size_groups = ((sizeof(int64_t) * 256 * CSRGEMM_MAXGROUPS - 1) / 256 + 1) * 256;
+    size_t size_stats  = ((sizeof(double) * 3 * CSRGEMM_MAXGROUPS - 1) / 256 + 1) * 256;
+
+    return 7 * size_m + 2 * size_groups + size_stats + rocprim_size;
+}
+
+// Computes the number of rows, the sum of the product bounds and the statistics of the
+// sampled rows of each group on the device. Only these per group figures are copied
+// back to the host.
+static rocsparse_status rocsparse_csrgemm_estimate_stats(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_B,
+                                                         const rocsparse_int*      csr_row_ptr_B,
+                                                         const rocsparse_int*      csr_col_ind_B,
+                                                         rocsparse_int             sample_size,
+                                                         char*                     workspace,
+                                                         size_t                    rocprim_size,
+                                                         rocsparse_int*            group_rows,
+                                                         int64_t*                  group_bound,
+                                                         double*                   group_stats)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    size_t size_m      = ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+    size_t size_groups = ((sizeof(int64_t) * 256 * CSRGEMM_MAXGROUPS - 1) / 256 + 1) * 256;
+    size_t size_stats  = ((sizeof(double) * 3 * CSRGEMM_MAXGROUPS - 1) / 256 + 1) * 256;
+
+    rocsparse_int* d_nprod = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* d_group = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* tmp_keys = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* d_perm = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* tmp_perm = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* d_sample = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* d_sample_nnz = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_m;
+
+    rocsparse_int* d_group_size = reinterpret_cast<rocsparse_int*>(workspace);
+    workspace += size_groups;
+
+    int64_t* d_group_bound = reinterpret_cast<int64_t*>(workspace);
+    workspace += size_groups;
+
+    double* d_stats = reinterpret_cast<double*>(workspace);
+    workspace += size_stats;
+
+    void* rocprim_buffer = reinterpret_cast<void*>(workspace);
+
+    // Compute the number of intermediate products of each row
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+    hipLaunchKernelGGL((csrgemm_intermediate_products<CSRGEMM_DIM, CSRGEMM_SUB>),
+                       dim3((m - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       (const rocsparse_int*)nullptr,
+                       d_nprod,
+                       descr_A->base,
+                       true,
+                       false);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Determine the group of each row and the number of rows and the product bound of
+    // each group
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        d_group, d_nprod, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_group_reduce_part1<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(CSRGEMM_DIM),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       d_group,
+                       d_group_size);
+
+    hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       d_group_size);
+
+    hipLaunchKernelGGL((csrgemm_estimate_group_bound<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(CSRGEMM_DIM),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       n,
+                       m,
+                       d_nprod,
+                       d_group,
+                       d_group_bound);
+
+    hipLaunchKernelGGL((csrgemm_group_reduce_part3<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       d_group_bound);
+#undef CSRGEMM_DIM
+
+    // Sort the rows by their group. The sort is stable, thus the rows of each group
+    // keep their order.
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation_template(handle, m, d_perm));
+
+    rocprim::double_buffer<rocsparse_int> keys(d_group, tmp_keys);
+    rocprim::double_buffer<rocsparse_int> vals(d_perm, tmp_perm);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(rocprim_buffer, rocprim_size, keys, vals, m, 0, 3, stream));
+
+    // Copy the number of rows and the product bound of each group to the host
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(group_rows,
+                                       d_group_size,
+                                       sizeof(rocsparse_int) * CSRGEMM_MAXGROUPS,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(group_bound,
+                                       d_group_bound,
+                                       sizeof(int64_t) * CSRGEMM_MAXGROUPS,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Groups with at most sample_size rows are computed exactly
+    rocsparse_int nsample = 0;
+
+    for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+    {
+        nsample += std::min(sample_size, group_rows[i]);
+    }
+
+    // Select the sampled rows of each group
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_estimate_sample_rows<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3((nsample - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       nsample,
+                       sample_size,
+                       d_group_size,
+                       vals.current(),
+                       d_sample);
+#undef CSRGEMM_DIM
+
+    // Compute the exact number of non-zero entries of the sampled rows
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_CHUNKSIZE 2048
+    hipLaunchKernelGGL((csrgemm_estimate_sample_nnz<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE>),
+                       dim3(nsample),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       n,
+                       d_sample,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_B,
+                       csr_col_ind_B,
+                       d_sample_nnz,
+                       descr_A->base,
+                       descr_B->base);
+#undef CSRGEMM_CHUNKSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Sample statistics of each group
+#define CSRGEMM_DIM 256
+    hipLaunchKernelGGL((csrgemm_estimate_group_stats<CSRGEMM_DIM, CSRGEMM_MAXGROUPS>),
+                       dim3(CSRGEMM_MAXGROUPS),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       n,
+                       sample_size,
+                       d_group_size,
+                       d_nprod,
+                       d_sample,
+                       d_sample_nnz,
+                       d_stats);
+#undef CSRGEMM_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(group_stats,
+                                       d_stats,
+                                       sizeof(double) * 3 * CSRGEMM_MAXGROUPS,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_nnz_estimate_template(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_operation       trans_B,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_B,
+                                                         rocsparse_int             nnz_B,
+                                                         const rocsparse_int*      csr_row_ptr_B,
+                                                         const rocsparse_int*      csr_col_ind_B,
+                                                         rocsparse_int             sample_size,
+                                                         int64_t*                  nnz_C,
+                                                         int64_t*                  nnz_C_lower,
+                                                         int64_t*                  nnz_C_upper,
+                                                         rocsparse_int*            group_rows,
+                                                         int64_t*                  group_nnz,
+                                                         size_t*                   group_workspace)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_nnz_estimate"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              sample_size,
+              (const void*&)nnz_C,
+              (const void*&)nnz_C_lower,
+              (const void*&)nnz_C_upper,
+              (const void*&)group_rows,
+              (const void*&)group_nnz,
+              (const void*&)group_workspace);
+
+    // The estimate is computed on the host, which requires synchronization
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_A))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || sample_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
+       || nnz_C == nullptr || nnz_C_lower == nullptr || nnz_C_upper == nullptr
+       || group_rows == nullptr || group_nnz == nullptr || group_workspace == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Initialize the estimate with zero
+    *nnz_C       = 0;
+    *nnz_C_lower = 0;
+    *nnz_C_upper = 0;
+
+    for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+    {
+        group_rows[i]      = 0;
+        group_nnz[i]       = 0;
+        group_workspace[i] = 0;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Without products, all rows of C are empty
+    if(n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        group_rows[0]      = m;
+        group_workspace[0] = csrgemm_estimate_workspace<T>(m, 0);
+
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // rocprim buffer size of the group sort
+    size_t rocprim_size;
+
+    {
+        rocprim::double_buffer<rocsparse_int> dummy(nullptr, nullptr);
+
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(nullptr, rocprim_size, dummy, dummy, m, 0, 3, stream));
+    }
+
+    // Device workspace of the estimate
+    char* workspace;
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&workspace, csrgemm_estimate_stats_workspace(m, rocprim_size)));
+
+    // Number of rows, product bound and sample statistics of each group
+    int64_t bound[CSRGEMM_MAXGROUPS];
+    double  stats[3 * CSRGEMM_MAXGROUPS];
+
+    rocsparse_status status = rocsparse_csrgemm_estimate_stats(handle,
+                                                               m,
+                                                               n,
+                                                               descr_A,
+                                                               csr_row_ptr_A,
+                                                               csr_col_ind_A,
+                                                               descr_B,
+                                                               csr_row_ptr_B,
+                                                               csr_col_ind_B,
+                                                               sample_size,
+                                                               workspace,
+                                                               rocprim_size,
+                                                               group_rows,
+                                                               bound,
+                                                               stats);
+
+    // The workspace is released on success and failure
+    RETURN_IF_HIP_ERROR(hipFree(workspace));
+    RETURN_IF_ROCSPARSE_ERROR(status);
+
+    // Ratio estimate of each group, using the bound of each row as auxiliary variable
+    rocsparse_int size[CSRGEMM_MAXGROUPS];
+    double        sum_nnz[CSRGEMM_MAXGROUPS];
+    double        ratio[CSRGEMM_MAXGROUPS];
+    double        deviation[CSRGEMM_MAXGROUPS];
+
+    for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+    {
+        size[i]      = std::min(sample_size, group_rows[i]);
+        sum_nnz[i]   = stats[3 * i + 0];
+        ratio[i]     = (stats[3 * i + 1] > 0.0) ? stats[3 * i + 0] / stats[3 * i + 1] : 0.0;
+        deviation[i] = stats[3 * i + 2];
+    }
+
+    for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+    {
+        if(group_rows[i] == 0)
+        {
+            continue;
+        }
+
+        double estimate = ratio[i] * bound[i];
+        double lower    = sum_nnz[i];
+        double upper    = static_cast<double>(bound[i]);
+
+        if(size[i] == group_rows[i])
+        {
+            // All rows of the group have been sampled, thus the estimate is exact
+            lower = estimate;
+            upper = estimate;
+        }
+        else if(size[i] > 1)
+        {
+            // Standard deviation of the ratio estimate, including the finite population
+            // correction
+            double rows  = group_rows[i];
+            double var   = deviation[i] / (size[i] - 1);
+            double sigma = std::sqrt(rows * rows * (1.0 - size[i] / rows) / size[i] * var);
+
+            lower = std::max(lower, estimate - CSRGEMM_ESTIMATE_SIGMAS * sigma);
+            upper = std::min(upper, estimate + CSRGEMM_ESTIMATE_SIGMAS * sigma);
+        }
+
+        group_nnz[i] = static_cast<int64_t>(std::llround(estimate));
+
+        int64_t group_lower = static_cast<int64_t>(std::floor(lower));
+        int64_t group_upper = static_cast<int64_t>(std::ceil(upper));
+
+        *nnz_C += group_nnz[i];
+        *nnz_C_lower += group_lower;
+        *nnz_C_upper += group_upper;
+
+        // The workspace is sized for the upper bound of the group
+        group_workspace[i] = csrgemm_estimate_workspace<T>(group_rows[i], group_upper);
+    }
+
+    // Rows with more than 8192 intermediate products require an additional buffer
+    if(group_rows[CSRGEMM_MAXGROUPS - 1] > 0)
+    {
+        group_workspace[CSRGEMM_MAXGROUPS - 1] += sizeof(rocsparse_int) * nnz_A;
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef CSRGEMM_ESTIMATE_SIGMAS
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,          \
+                                     rocsparse_operation       trans_A,         \
+                                     rocsparse_operation       trans_B,         \
+                                     rocsparse_int             m,               \
+                                     rocsparse_int             n,               \
+                                     rocsparse_int             k,               \
+                                     const rocsparse_mat_descr descr_A,         \
+                                     rocsparse_int             nnz_A,           \
+                                     const rocsparse_int*      csr_row_ptr_A,   \
+                                     const rocsparse_int*      csr_col_ind_A,   \
+                                     const rocsparse_mat_descr descr_B,         \
+                                     rocsparse_int             nnz_B,           \
+                                     const rocsparse_int*      csr_row_ptr_B,   \
+                                     const rocsparse_int*      csr_col_ind_B,   \
+                                     rocsparse_int             sample_size,     \
+                                     int64_t*                  nnz_C,           \
+                                     int64_t*                  nnz_C_lower,     \
+                                     int64_t*                  nnz_C_upper,     \
+                                     rocsparse_int*            group_rows,      \
+                                     int64_t*                  group_nnz,       \
+                                     size_t*                   group_workspace) \
+    {                                                                           \
+        return rocsparse_csrgemm_nnz_estimate_template<TYPE>(handle,            \
+                                                             trans_A,           \
+                                                             trans_B,           \
+                                                             m,                 \
+                                                             n,                 \
+                                                             k,                 \
+                                                             descr_A,           \
+                                                             nnz_A,             \
+                                                             csr_row_ptr_A,     \
+                                                             csr_col_ind_A,     \
+                                                             descr_B,           \
+                                                             nnz_B,             \
+                                                             csr_row_ptr_B,     \
+                                                             csr_col_ind_B,     \
+                                                             sample_size,       \
+                                                             nnz_C,             \
+                                                             nnz_C_lower,       \
+                                                             nnz_C_upper,       \
+                                                             group_rows,        \
+                                                             group_nnz,         \
+                                                             group_workspace);  \
+    }
+
+C_IMPL(rocsparse_scsrgemm_nnz_estimate, float);
+C_IMPL(rocsparse_dcsrgemm_nnz_estimate, double);
+C_IMPL(rocsparse_ccsrgemm_nnz_estimate, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgemm_nnz_estimate, rocsparse_double_complex);
+#undef C_IMPL
@@ -0,0 +1,983 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../conversion/rocsparse_csr2csc.hpp"
+#include "csrgemm_device.h"
+#include "csrgemm_masked_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE, bool FILL>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_masked_complement(rocsparse_int n,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                   const rocsparse_int* __restrict__ csr_col_ind_A,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                   const rocsparse_int* __restrict__ csr_col_ind_B,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_M,
+                                   const rocsparse_int* __restrict__ csr_col_ind_M,
+                                   rocsparse_int* __restrict__ csr_row_ptr_C,
+                                   rocsparse_int* __restrict__ csr_col_ind_C,
+                                   rocsparse_index_base idx_base_A,
+                                   rocsparse_index_base idx_base_B,
+                                   rocsparse_index_base idx_base_M,
+                                   rocsparse_index_base idx_base_C)
+{
+    csrgemm_masked_complement_block_per_row_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, FILL>(
+        n,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_M,
+        idx_base_C);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_masked_row(rocsparse_int m,
+                            U             alpha_device_host,
+                            const rocsparse_int* __restrict__ csr_row_ptr_A,
+                            const rocsparse_int* __restrict__ csr_col_ind_A,
+                            const T* __restrict__ csr_val_A,
+                            const rocsparse_int* __restrict__ csr_row_ptr_B,
+                            const rocsparse_int* __restrict__ csr_col_ind_B,
+                            const T* __restrict__ csr_val_B,
+                            const rocsparse_int* __restrict__ csr_row_ptr_C,
+                            const rocsparse_int* __restrict__ csr_col_ind_C,
+                            T* __restrict__ csr_val_C,
+                            rocsparse_index_base idx_base_A,
+                            rocsparse_index_base idx_base_B,
+                            rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+
+    csrgemm_masked_row_wf_per_row_device<BLOCKSIZE, WFSIZE>(m,
+                                                            alpha,
+                                                            csr_row_ptr_A,
+                                                            csr_col_ind_A,
+                                                            csr_val_A,
+                                                            csr_row_ptr_B,
+                                                            csr_col_ind_B,
+                                                            csr_val_B,
+                                                            csr_row_ptr_C,
+                                                            csr_col_ind_C,
+                                                            csr_val_C,
+                                                            idx_base_A,
+                                                            idx_base_B,
+                                                            idx_base_C);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrgemm_masked_dot(rocsparse_int m,
+                            U             alpha_device_host,
+                            const rocsparse_int* __restrict__ csr_row_ptr_A,
+                            const rocsparse_int* __restrict__ csr_col_ind_A,
+                            const T* __restrict__ csr_val_A,
+                            const rocsparse_int* __restrict__ csc_col_ptr_B,
+                            const rocsparse_int* __restrict__ csc_row_ind_B,
+                            const T* __restrict__ csc_val_B,
+                            const rocsparse_int* __restrict__ csr_row_ptr_C,
+                            const rocsparse_int* __restrict__ csr_col_ind_C,
+                            T* __restrict__ csr_val_C,
+                            rocsparse_index_base idx_base_A,
+                            rocsparse_index_base idx_base_B,
+                            rocsparse_index_base idx_base_C)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+
+    csrgemm_masked_dot_wf_per_row_device<BLOCKSIZE, WFSIZE>(m,
+                                                            alpha,
+                                                            csr_row_ptr_A,
+                                                            csr_col_ind_A,
+                                                            csr_val_A,
+                                                            csc_col_ptr_B,
+                                                            csc_row_ind_B,
+                                                            csc_val_B,
+                                                            csr_row_ptr_C,
+                                                            csr_col_ind_C,
+                                                            csr_val_C,
+                                                            idx_base_A,
+                                                            idx_base_B,
+                                                            idx_base_C);
+}
+
+// Select the algorithm that is used to compute the values of C
+static inline rocsparse_csrgemm_masked_alg
+    csrgemm_masked_select_alg(rocsparse_csrgemm_mask       mask,
+                              rocsparse_csrgemm_masked_alg alg,
+                              rocsparse_int                m,
+                              rocsparse_int                n,
+                              rocsparse_int                k,
+                              rocsparse_int                nnz_A,
+                              rocsparse_int                nnz_B,
+                              rocsparse_int                nnz_M)
+{
+    // Without any products, the row-wise algorithm only zeros C
+    if(k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        return rocsparse_csrgemm_masked_alg_row;
+    }
+
+    if(alg != rocsparse_csrgemm_masked_alg_default)
+    {
+        return alg;
+    }
+
+    // The complement of a mask is typically dense, thus all products are required
+    if(mask == rocsparse_csrgemm_mask_complement)
+    {
+        return rocsparse_csrgemm_masked_alg_row;
+    }
+
+    // Estimate the work of both algorithms, based on the average density of A and B.
+    // The dot product algorithm intersects a row of A with a column of B for each entry
+    // of the mask, after B has been transposed. The row-wise algorithm computes all
+    // intermediate products.
+    double nnz_per_row_A = static_cast<double>(nnz_A) / m;
+    double nnz_per_col_B = static_cast<double>(nnz_B) / n;
+
+    double work_dot = nnz_M * (nnz_per_row_A + nnz_per_col_B) + 2.0 * nnz_B;
+    double work_row = static_cast<double>(nnz_A) * nnz_B / k;
+
+    return (work_dot < work_row) ? rocsparse_csrgemm_masked_alg_dot
+                                 : rocsparse_csrgemm_masked_alg_row;
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse_csrgemm_masked_buffer_size_template(rocsparse_handle             handle,
+                                                  rocsparse_operation          trans_A,
+                                                  rocsparse_operation          trans_B,
+                                                  rocsparse_csrgemm_mask       mask,
+                                                  rocsparse_csrgemm_masked_alg alg,
+                                                  rocsparse_int                m,
+                                                  rocsparse_int                n,
+                                                  rocsparse_int                k,
+                                                  const rocsparse_mat_descr    descr_A,
+                                                  rocsparse_int                nnz_A,
+                                                  const rocsparse_int*         csr_row_ptr_A,
+                                                  const rocsparse_int*         csr_col_ind_A,
+                                                  const rocsparse_mat_descr    descr_B,
+                                                  rocsparse_int                nnz_B,
+                                                  const rocsparse_int*         csr_row_ptr_B,
+                                                  const rocsparse_int*         csr_col_ind_B,
+                                                  const rocsparse_mat_descr    descr_M,
+                                                  rocsparse_int                nnz_M,
+                                                  const rocsparse_int*         csr_row_ptr_M,
+                                                  const rocsparse_int*         csr_col_ind_M,
+                                                  size_t*                      buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_masked_buffer_size"),
+              trans_A,
+              trans_B,
+              mask,
+              alg,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_M,
+              nnz_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              (const void*&)buffer_size);
+
+    // Check enums
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B)
+       || rocsparse_enum_utils::is_invalid(mask) || rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_M < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
+       || descr_M == nullptr || csr_row_ptr_M == nullptr || csr_col_ind_M == nullptr
+       || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Do not return 0 as buffer size
+    *buffer_size = 4;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // rocprim buffer for the row pointers of the complement
+    if(mask == rocsparse_csrgemm_mask_complement)
+    {
+        size_t         rocprim_size;
+        rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                    rocprim_size,
+                                                    ptr,
+                                                    ptr,
+                                                    0,
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    handle->stream));
+
+        *buffer_size = std::max(*buffer_size, rocprim_size);
+    }
+
+    // B in CSC format for the dot product algorithm
+    if(csrgemm_masked_select_alg(mask, alg, m, n, k, nnz_A, nnz_B, nnz_M)
+       == rocsparse_csrgemm_masked_alg_dot)
+    {
+        size_t csr2csc_size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csc_buffer_size(handle,
+                                                                k,
+                                                                n,
+                                                                nnz_B,
+                                                                csr_row_ptr_B,
+                                                                csr_col_ind_B,
+                                                                rocsparse_action_numeric,
+                                                                &csr2csc_size));
+
+        size_t csc_size = 0;
+
+        csc_size += ((sizeof(rocsparse_int) * (n + 1) - 1) / 256 + 1) * 256;
+        csc_size += ((sizeof(rocsparse_int) * nnz_B - 1) / 256 + 1) * 256;
+        csc_size += ((sizeof(T) * nnz_B - 1) / 256 + 1) * 256;
+        csc_size += csr2csc_size;
+
+        *buffer_size = std::max(*buffer_size, csc_size);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+static rocsparse_status
+    rocsparse_csrgemm_masked_dispatch(rocsparse_handle             handle,
+                                      rocsparse_csrgemm_masked_alg alg,
+                                      rocsparse_int                m,
+                                      rocsparse_int                n,
+                                      rocsparse_int                k,
+                                      U                            alpha_device_host,
+                                      const rocsparse_mat_descr    descr_A,
+                                      rocsparse_int                nnz_A,
+                                      const T*                     csr_val_A,
+                                      const rocsparse_int*         csr_row_ptr_A,
+                                      const rocsparse_int*         csr_col_ind_A,
+                                      const rocsparse_mat_descr    descr_B,
+                                      rocsparse_int                nnz_B,
+                                      const T*                     csr_val_B,
+                                      const rocsparse_int*         csr_row_ptr_B,
+                                      const rocsparse_int*         csr_col_ind_B,
+                                      const rocsparse_mat_descr    descr_C,
+                                      T*                           csr_val_C,
+                                      const rocsparse_int*         csr_row_ptr_C,
+                                      const rocsparse_int*         csr_col_ind_C,
+                                      void*                        temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    if(alg == rocsparse_csrgemm_masked_alg_row)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+        hipLaunchKernelGGL((csrgemm_masked_row<CSRGEMM_DIM, CSRGEMM_SUB>),
+                           dim3((CSRGEMM_SUB * m - 1) / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           m,
+                           alpha_device_host,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+        return rocsparse_status_success;
+    }
+
+    // Transpose B, such that its columns can be accessed efficiently
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    rocsparse_int* csc_col_ptr_B = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * (n + 1) - 1) / 256 + 1) * 256;
+
+    rocsparse_int* csc_row_ind_B = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * nnz_B - 1) / 256 + 1) * 256;
+
+    T* csc_val_B = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * nnz_B - 1) / 256 + 1) * 256;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr2csc_template(handle,
+                                                         k,
+                                                         n,
+                                                         nnz_B,
+                                                         csr_val_B,
+                                                         csr_row_ptr_B,
+                                                         csr_col_ind_B,
+                                                         csc_val_B,
+                                                         csc_row_ind_B,
+                                                         csc_col_ptr_B,
+                                                         rocsparse_action_numeric,
+                                                         descr_B->base,
+                                                         ptr));
+
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+    hipLaunchKernelGGL((csrgemm_masked_dot<CSRGEMM_DIM, CSRGEMM_SUB>),
+                       dim3((CSRGEMM_SUB * m - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       alpha_device_host,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csc_col_ptr_B,
+                       csc_row_ind_B,
+                       csc_val_B,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       descr_A->base,
+                       descr_B->base,
+                       descr_C->base);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_masked_template(rocsparse_handle             handle,
+                                                   rocsparse_operation          trans_A,
+                                                   rocsparse_operation          trans_B,
+                                                   rocsparse_csrgemm_mask       mask,
+                                                   rocsparse_csrgemm_masked_alg alg,
+                                                   rocsparse_int                m,
+                                                   rocsparse_int                n,
+                                                   rocsparse_int                k,
+                                                   const T*                     alpha,
+                                                   const rocsparse_mat_descr    descr_A,
+                                                   rocsparse_int                nnz_A,
+                                                   const T*                     csr_val_A,
+                                                   const rocsparse_int*         csr_row_ptr_A,
+                                                   const rocsparse_int*         csr_col_ind_A,
+                                                   const rocsparse_mat_descr    descr_B,
+                                                   rocsparse_int                nnz_B,
+                                                   const T*                     csr_val_B,
+                                                   const rocsparse_int*         csr_row_ptr_B,
+                                                   const rocsparse_int*         csr_col_ind_B,
+                                                   const rocsparse_mat_descr    descr_M,
+                                                   rocsparse_int                nnz_M,
+                                                   const rocsparse_int*         csr_row_ptr_M,
+                                                   const rocsparse_int*         csr_col_ind_M,
+                                                   const rocsparse_mat_descr    descr_C,
+                                                   T*                           csr_val_C,
+                                                   const rocsparse_int*         csr_row_ptr_C,
+                                                   rocsparse_int*               csr_col_ind_C,
+                                                   void*                        temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_masked"),
+              trans_A,
+              trans_B,
+              mask,
+              alg,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_M,
+              nnz_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)temp_buffer);
+
+    // Check enums
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B)
+       || rocsparse_enum_utils::is_invalid(mask) || rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_M < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(alpha == nullptr || descr_A == nullptr || csr_val_A == nullptr || csr_row_ptr_A == nullptr
+       || csr_col_ind_A == nullptr || descr_B == nullptr || csr_val_B == nullptr
+       || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr || descr_M == nullptr
+       || csr_row_ptr_M == nullptr || csr_col_ind_M == nullptr || descr_C == nullptr
+       || csr_val_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general
+       || descr_M->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Sparsity pattern of C
+    if(mask == rocsparse_csrgemm_mask_keep)
+    {
+        // C inherits the pattern of the mask
+        if(nnz_M > 0)
+        {
+#define CSRGEMM_DIM 1024
+            hipLaunchKernelGGL((csrgemm_copy<CSRGEMM_DIM>),
+                               dim3((nnz_M - 1) / CSRGEMM_DIM + 1),
+                               dim3(CSRGEMM_DIM),
+                               0,
+                               stream,
+                               nnz_M,
+                               csr_col_ind_M,
+                               csr_col_ind_C,
+                               descr_M->base,
+                               descr_C->base);
+#undef CSRGEMM_DIM
+        }
+    }
+    else
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_CHUNKSIZE 2048
+        hipLaunchKernelGGL(
+            (csrgemm_masked_complement<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE, true>),
+            dim3(m),
+            dim3(CSRGEMM_DIM),
+            0,
+            stream,
+            n,
+            csr_row_ptr_A,
+            csr_col_ind_A,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            const_cast<rocsparse_int*>(csr_row_ptr_C),
+            csr_col_ind_C,
+            descr_A->base,
+            descr_B->base,
+            descr_M->base,
+            descr_C->base);
+#undef CSRGEMM_CHUNKSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Values of C
+    rocsparse_csrgemm_masked_alg value_alg
+        = csrgemm_masked_select_alg(mask, alg, m, n, k, nnz_A, nnz_B, nnz_M);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrgemm_masked_dispatch(handle,
+                                                 value_alg,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 descr_A,
+                                                 nnz_A,
+                                                 csr_val_A,
+                                                 csr_row_ptr_A,
+                                                 csr_col_ind_A,
+                                                 descr_B,
+                                                 nnz_B,
+                                                 csr_val_B,
+                                                 csr_row_ptr_B,
+                                                 csr_col_ind_B,
+                                                 descr_C,
+                                                 csr_val_C,
+                                                 csr_row_ptr_C,
+                                                 csr_col_ind_C,
+                                                 temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrgemm_masked_dispatch(handle,
+                                                 value_alg,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 *alpha,
+                                                 descr_A,
+                                                 nnz_A,
+                                                 csr_val_A,
+                                                 csr_row_ptr_A,
+                                                 csr_col_ind_A,
+                                                 descr_B,
+                                                 nnz_B,
+                                                 csr_val_B,
+                                                 csr_row_ptr_B,
+                                                 csr_col_ind_B,
+                                                 descr_C,
+                                                 csr_val_C,
+                                                 csr_row_ptr_C,
+                                                 csr_col_ind_C,
+                                                 temp_buffer);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrgemm_masked_nnz(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_operation       trans_B,
+                                                         rocsparse_csrgemm_mask    mask,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_B,
+                                                         rocsparse_int             nnz_B,
+                                                         const rocsparse_int*      csr_row_ptr_B,
+                                                         const rocsparse_int*      csr_col_ind_B,
+                                                         const rocsparse_mat_descr descr_M,
+                                                         rocsparse_int             nnz_M,
+                                                         const rocsparse_int*      csr_row_ptr_M,
+                                                         const rocsparse_int*      csr_col_ind_M,
+                                                         const rocsparse_mat_descr descr_C,
+                                                         rocsparse_int*            csr_row_ptr_C,
+                                                         rocsparse_int*            nnz_C,
+                                                         void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgemm_masked_nnz",
+              trans_A,
+              trans_B,
+              mask,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_M,
+              nnz_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)temp_buffer);
+
+    // Check enums
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B)
+       || rocsparse_enum_utils::is_invalid(mask))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || nnz_M < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
+       || descr_M == nullptr || csr_row_ptr_M == nullptr || csr_col_ind_M == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general
+       || descr_M->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // In host pointer mode, the number of non-zero entries of the complement product
+    // is read back to the host. This cannot be captured in graph mode
+    if(mask == rocsparse_csrgemm_mask_complement
+       && handle->pointer_mode == rocsparse_pointer_mode_host
+       && handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(mask == rocsparse_csrgemm_mask_keep)
+    {
+        // C inherits the row pointers of the mask
+#define CSRGEMM_DIM 1024
+        hipLaunchKernelGGL((csrgemm_copy<CSRGEMM_DIM>),
+                           dim3(m / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           m + 1,
+                           csr_row_ptr_M,
+                           csr_row_ptr_C,
+                           descr_M->base,
+                           descr_C->base);
+#undef CSRGEMM_DIM
+
+        // Thus, nnz of C will always be equal to nnz of M
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                nnz_C, &nnz_M, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+        }
+        else
+        {
+            *nnz_C = nnz_M;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Compute the number of non-zero entries of each row of C
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_CHUNKSIZE 2048
+    hipLaunchKernelGGL(
+        (csrgemm_masked_complement<CSRGEMM_DIM, CSRGEMM_SUB, CSRGEMM_CHUNKSIZE, false>),
+        dim3(m),
+        dim3(CSRGEMM_DIM),
+        0,
+        stream,
+        n,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        csr_row_ptr_C,
+        (rocsparse_int*)nullptr,
+        descr_A->base,
+        descr_B->base,
+        descr_M->base,
+        descr_C->base);
+#undef CSRGEMM_CHUNKSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<rocsparse_int>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(temp_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<rocsparse_int>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Store nnz of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_C,
+                                           csr_row_ptr_C + m,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz by index base
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz by index base
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle             handle,         \
+                                     rocsparse_operation          trans_A,        \
+                                     rocsparse_operation          trans_B,        \
+                                     rocsparse_csrgemm_mask       mask,           \
+                                     rocsparse_csrgemm_masked_alg alg,            \
+                                     rocsparse_int                m,              \
+                                     rocsparse_int                n,              \
+                                     rocsparse_int                k,              \
+                                     const rocsparse_mat_descr    descr_A,        \
+                                     rocsparse_int                nnz_A,          \
+                                     const rocsparse_int*         csr_row_ptr_A,  \
+                                     const rocsparse_int*         csr_col_ind_A,  \
+                                     const rocsparse_mat_descr    descr_B,        \
+                                     rocsparse_int                nnz_B,          \
+                                     const rocsparse_int*         csr_row_ptr_B,  \
+                                     const rocsparse_int*         csr_col_ind_B,  \
+                                     const rocsparse_mat_descr    descr_M,        \
+                                     rocsparse_int                nnz_M,          \
+                                     const rocsparse_int*         csr_row_ptr_M,  \
+                                     const rocsparse_int*         csr_col_ind_M,  \
+                                     size_t*                      buffer_size)    \
+    {                                                                             \
+        return rocsparse_csrgemm_masked_buffer_size_template<TYPE>(handle,        \
+                                                                   trans_A,       \
+                                                                   trans_B,       \
+                                                                   mask,          \
+                                                                   alg,           \
+                                                                   m,             \
+                                                                   n,             \
+                                                                   k,             \
+                                                                   descr_A,       \
+                                                                   nnz_A,         \
+                                                                   csr_row_ptr_A, \
+                                                                   csr_col_ind_A, \
+                                                                   descr_B,       \
+                                                                   nnz_B,         \
+                                                                   csr_row_ptr_B, \
+                                                                   csr_col_ind_B, \
+                                                                   descr_M,       \
+                                                                   nnz_M,         \
+                                                                   csr_row_ptr_M, \
+                                                                   csr_col_ind_M, \
+                                                                   buffer_size);  \
+    }
+
+C_IMPL(rocsparse_scsrgemm_masked_buffer_size, float);
+C_IMPL(rocsparse_dcsrgemm_masked_buffer_size, double);
+C_IMPL(rocsparse_ccsrgemm_masked_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgemm_masked_buffer_size, rocsparse_double_complex);
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                       \
+    extern "C" rocsparse_status NAME(rocsparse_handle             handle,        \
+                                     rocsparse_operation          trans_A,       \
+                                     rocsparse_operation          trans_B,       \
+                                     rocsparse_csrgemm_mask       mask,          \
+                                     rocsparse_csrgemm_masked_alg alg,           \
+                                     rocsparse_int                m,             \
+                                     rocsparse_int                n,             \
+                                     rocsparse_int                k,             \
+                                     const TYPE*                  alpha,         \
+                                     const rocsparse_mat_descr    descr_A,       \
+                                     rocsparse_int                nnz_A,         \
+                                     const TYPE*                  csr_val_A,     \
+                                     const rocsparse_int*         csr_row_ptr_A, \
+                                     const rocsparse_int*         csr_col_ind_A, \
+                                     const rocsparse_mat_descr    descr_B,       \
+                                     rocsparse_int                nnz_B,         \
+                                     const TYPE*                  csr_val_B,     \
+                                     const rocsparse_int*         csr_row_ptr_B, \
+                                     const rocsparse_int*         csr_col_ind_B, \
+                                     const rocsparse_mat_descr    descr_M,       \
+                                     rocsparse_int                nnz_M,         \
+                                     const rocsparse_int*         csr_row_ptr_M, \
+                                     const rocsparse_int*         csr_col_ind_M, \
+                                     const rocsparse_mat_descr    descr_C,       \
+                                     TYPE*                        csr_val_C,     \
+                                     const rocsparse_int*         csr_row_ptr_C, \
+                                     rocsparse_int*               csr_col_ind_C, \
+                                     void*                        temp_buffer)   \
+    {                                                                            \
+        return rocsparse_csrgemm_masked_template(handle,                         \
+                                                 trans_A,                        \
+                                                 trans_B,                        \
+                                                 mask,                           \
+                                                 alg,                            \
+                                                 m,                              \
+                                                 n,                              \
+                                                 k,                              \
+                                                 alpha,                          \
+                                                 descr_A,                        \
+                                                 nnz_A,                          \
+                                                 csr_val_A,                      \
+                                                 csr_row_ptr_A,                  \
+                                                 csr_col_ind_A,                  \
+                                                 descr_B,                        \
+                                                 nnz_B,                          \
+                                                 csr_val_B,                      \
+                                                 csr_row_ptr_B,                  \
+                                                 csr_col_ind_B,                  \
+                                                 descr_M,                        \
+                                                 nnz_M,                          \
+                                                 csr_row_ptr_M,                  \
+                                                 csr_col_ind_M,                  \
+                                                 descr_C,                        \
+                                                 csr_val_C,                      \
+                                                 csr_row_ptr_C,                  \
+                                                 csr_col_ind_C,                  \
+                                                 temp_buffer);                   \
+    }
+
+C_IMPL(rocsparse_scsrgemm_masked, float);
+C_IMPL(rocsparse_dcsrgemm_masked, double);
+C_IMPL(rocsparse_ccsrgemm_masked, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgemm_masked, rocsparse_double_complex);
+#undef C_IMPL
@@ -640,6 +640,13 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                                                           const rocsparse_mat_info  info_C,
                                                           void*                     temp_buffer)
 {
+    // The kernel configuration depends on the row nnz distribution, that is read
+    // back to the host. This cannot be captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -0,0 +1,668 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "csrgemm_device.h"
+#include "csrrap_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE, bool FILL>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrap_symbolic(rocsparse_int k,
+                         const rocsparse_int* __restrict__ csr_row_ptr_R,
+                         const rocsparse_int* __restrict__ csr_col_ind_R,
+                         const rocsparse_int* __restrict__ csr_row_ptr_A,
+                         const rocsparse_int* __restrict__ csr_col_ind_A,
+                         const rocsparse_int* __restrict__ csr_row_ptr_P,
+                         const rocsparse_int* __restrict__ csr_col_ind_P,
+                         rocsparse_int* __restrict__ csr_row_ptr_C,
+                         rocsparse_int* __restrict__ csr_col_ind_C,
+                         rocsparse_index_base idx_base_R,
+                         rocsparse_index_base idx_base_A,
+                         rocsparse_index_base idx_base_P,
+                         rocsparse_index_base idx_base_C)
+{
+    csrrap_symbolic_block_per_row_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, FILL>(k,
+                                                                             csr_row_ptr_R,
+                                                                             csr_col_ind_R,
+                                                                             csr_row_ptr_A,
+                                                                             csr_col_ind_A,
+                                                                             csr_row_ptr_P,
+                                                                             csr_col_ind_P,
+                                                                             csr_row_ptr_C,
+                                                                             csr_col_ind_C,
+                                                                             idx_base_R,
+                                                                             idx_base_A,
+                                                                             idx_base_P,
+                                                                             idx_base_C);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrap_numeric(rocsparse_int m,
+                        const rocsparse_int* __restrict__ csr_row_ptr_R,
+                        const rocsparse_int* __restrict__ csr_col_ind_R,
+                        const T* __restrict__ csr_val_R,
+                        const rocsparse_int* __restrict__ csr_row_ptr_A,
+                        const rocsparse_int* __restrict__ csr_col_ind_A,
+                        const T* __restrict__ csr_val_A,
+                        const rocsparse_int* __restrict__ csr_row_ptr_P,
+                        const rocsparse_int* __restrict__ csr_col_ind_P,
+                        const T* __restrict__ csr_val_P,
+                        const rocsparse_int* __restrict__ csr_row_ptr_C,
+                        const rocsparse_int* __restrict__ csr_col_ind_C,
+                        T* __restrict__ csr_val_C,
+                        rocsparse_index_base idx_base_R,
+                        rocsparse_index_base idx_base_A,
+                        rocsparse_index_base idx_base_P,
+                        rocsparse_index_base idx_base_C)
+{
+    csrrap_numeric_wf_per_row_device<BLOCKSIZE, WFSIZE>(m,
+                                                        csr_row_ptr_R,
+                                                        csr_col_ind_R,
+                                                        csr_val_R,
+                                                        csr_row_ptr_A,
+                                                        csr_col_ind_A,
+                                                        csr_val_A,
+                                                        csr_row_ptr_P,
+                                                        csr_col_ind_P,
+                                                        csr_val_P,
+                                                        csr_row_ptr_C,
+                                                        csr_col_ind_C,
+                                                        csr_val_C,
+                                                        idx_base_R,
+                                                        idx_base_A,
+                                                        idx_base_P,
+                                                        idx_base_C);
+}
+
+template <typename T>
+rocsparse_status
+    rocsparse_csrrap_numeric_template(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             k,
+                                      const rocsparse_mat_descr descr_R,
+                                      rocsparse_int             nnz_R,
+                                      const T*                  csr_val_R,
+                                      const rocsparse_int*      csr_row_ptr_R,
+                                      const rocsparse_int*      csr_col_ind_R,
+                                      const rocsparse_mat_descr descr_A,
+                                      rocsparse_int             nnz_A,
+                                      const T*                  csr_val_A,
+                                      const rocsparse_int*      csr_row_ptr_A,
+                                      const rocsparse_int*      csr_col_ind_A,
+                                      const rocsparse_mat_descr descr_P,
+                                      rocsparse_int             nnz_P,
+                                      const T*                  csr_val_P,
+                                      const rocsparse_int*      csr_row_ptr_P,
+                                      const rocsparse_int*      csr_col_ind_P,
+                                      const rocsparse_mat_descr descr_C,
+                                      T*                        csr_val_C,
+                                      const rocsparse_int*      csr_row_ptr_C,
+                                      const rocsparse_int*      csr_col_ind_C)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrrap_numeric"),
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_val_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_val_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C);
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_val_R == nullptr || csr_row_ptr_R == nullptr
+       || csr_col_ind_R == nullptr || descr_A == nullptr || csr_val_A == nullptr
+       || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr || descr_P == nullptr
+       || csr_val_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_val_C == nullptr || csr_row_ptr_C == nullptr
+       || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general
+       || descr_A->type != rocsparse_matrix_type_general
+       || descr_P->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRRAP_DIM 256
+#define CSRRAP_SUB 16
+    hipLaunchKernelGGL((csrrap_numeric<CSRRAP_DIM, CSRRAP_SUB>),
+                       dim3((CSRRAP_SUB * m - 1) / CSRRAP_DIM + 1),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_R,
+                       csr_col_ind_R,
+                       csr_val_R,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_P,
+                       csr_col_ind_P,
+                       csr_val_P,
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       descr_R->base,
+                       descr_A->base,
+                       descr_P->base,
+                       descr_C->base);
+#undef CSRRAP_SUB
+#undef CSRRAP_DIM
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const rocsparse_mat_descr descr_R,
+                                                         rocsparse_int             nnz_R,
+                                                         const rocsparse_int*      csr_row_ptr_R,
+                                                         const rocsparse_int*      csr_col_ind_R,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_P,
+                                                         rocsparse_int             nnz_P,
+                                                         const rocsparse_int*      csr_row_ptr_P,
+                                                         const rocsparse_int*      csr_col_ind_P,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrap_buffer_size",
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)buffer_size);
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Do not return 0 as buffer size
+    *buffer_size = 4;
+
+    // Quick return if possible
+    if(m == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // rocprim buffer for the row pointers of C
+    size_t         rocprim_size;
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                ptr,
+                                                ptr,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+
+    *buffer_size = std::max(*buffer_size, rocprim_size);
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_R,
+                                                 rocsparse_int             nnz_R,
+                                                 const rocsparse_int*      csr_row_ptr_R,
+                                                 const rocsparse_int*      csr_col_ind_R,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_P,
+                                                 rocsparse_int             nnz_P,
+                                                 const rocsparse_int*      csr_row_ptr_P,
+                                                 const rocsparse_int*      csr_col_ind_P,
+                                                 const rocsparse_mat_descr descr_C,
+                                                 rocsparse_int*            csr_row_ptr_C,
+                                                 rocsparse_int*            nnz_C,
+                                                 void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrap_nnz",
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)temp_buffer);
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general
+       || descr_A->type != rocsparse_matrix_type_general
+       || descr_P->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // In host pointer mode, the number of non-zero entries of C is read back to the
+    // host. This cannot be captured in graph mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0 || k == 0)
+    {
+        if(m > 0)
+        {
+#define CSRRAP_DIM 1024
+            hipLaunchKernelGGL((set_array_to_value<CSRRAP_DIM>),
+                               dim3(m / CSRRAP_DIM + 1),
+                               dim3(CSRRAP_DIM),
+                               0,
+                               stream,
+                               m + 1,
+                               csr_row_ptr_C,
+                               static_cast<rocsparse_int>(descr_C->base));
+#undef CSRRAP_DIM
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Compute the number of non-zero entries of each row of C
+#define CSRRAP_DIM 256
+#define CSRRAP_SUB 16
+#define CSRRAP_CHUNKSIZE 2048
+    hipLaunchKernelGGL((csrrap_symbolic<CSRRAP_DIM, CSRRAP_SUB, CSRRAP_CHUNKSIZE, false>),
+                       dim3(m),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       k,
+                       csr_row_ptr_R,
+                       csr_col_ind_R,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_P,
+                       csr_col_ind_P,
+                       csr_row_ptr_C,
+                       (rocsparse_int*)nullptr,
+                       descr_R->base,
+                       descr_A->base,
+                       descr_P->base,
+                       descr_C->base);
+#undef CSRRAP_CHUNKSIZE
+#undef CSRRAP_SUB
+#undef CSRRAP_DIM
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<rocsparse_int>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(temp_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<rocsparse_int>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Store nnz of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_C,
+                                           csr_row_ptr_C + m,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz by index base
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz by index base
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrap_symbolic(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             n,
+                                                      rocsparse_int             k,
+                                                      const rocsparse_mat_descr descr_R,
+                                                      rocsparse_int             nnz_R,
+                                                      const rocsparse_int*      csr_row_ptr_R,
+                                                      const rocsparse_int*      csr_col_ind_R,
+                                                      const rocsparse_mat_descr descr_A,
+                                                      rocsparse_int             nnz_A,
+                                                      const rocsparse_int*      csr_row_ptr_A,
+                                                      const rocsparse_int*      csr_col_ind_A,
+                                                      const rocsparse_mat_descr descr_P,
+                                                      rocsparse_int             nnz_P,
+                                                      const rocsparse_int*      csr_row_ptr_P,
+                                                      const rocsparse_int*      csr_col_ind_P,
+                                                      const rocsparse_mat_descr descr_C,
+                                                      const rocsparse_int*      csr_row_ptr_C,
+                                                      rocsparse_int*            csr_col_ind_C)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrap_symbolic",
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C);
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general
+       || descr_A->type != rocsparse_matrix_type_general
+       || descr_P->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || k == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Compute the column indices of C
+#define CSRRAP_DIM 256
+#define CSRRAP_SUB 16
+#define CSRRAP_CHUNKSIZE 2048
+    hipLaunchKernelGGL((csrrap_symbolic<CSRRAP_DIM, CSRRAP_SUB, CSRRAP_CHUNKSIZE, true>),
+                       dim3(m),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       k,
+                       csr_row_ptr_R,
+                       csr_col_ind_R,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_P,
+                       csr_col_ind_P,
+                       const_cast<rocsparse_int*>(csr_row_ptr_C),
+                       csr_col_ind_C,
+                       descr_R->base,
+                       descr_A->base,
+                       descr_P->base,
+                       descr_C->base);
+#undef CSRRAP_CHUNKSIZE
+#undef CSRRAP_SUB
+#undef CSRRAP_DIM
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             n,             \
+                                     rocsparse_int             k,             \
+                                     const rocsparse_mat_descr descr_R,       \
+                                     rocsparse_int             nnz_R,         \
+                                     const TYPE*               csr_val_R,     \
+                                     const rocsparse_int*      csr_row_ptr_R, \
+                                     const rocsparse_int*      csr_col_ind_R, \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnz_A,         \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_P,       \
+                                     rocsparse_int             nnz_P,         \
+                                     const TYPE*               csr_val_P,     \
+                                     const rocsparse_int*      csr_row_ptr_P, \
+                                     const rocsparse_int*      csr_col_ind_P, \
+                                     const rocsparse_mat_descr descr_C,       \
+                                     TYPE*                     csr_val_C,     \
+                                     const rocsparse_int*      csr_row_ptr_C, \
+                                     const rocsparse_int*      csr_col_ind_C) \
+    {                                                                         \
+        return rocsparse_csrrap_numeric_template(handle,                      \
+                                                 m,                           \
+                                                 n,                           \
+                                                 k,                           \
+                                                 descr_R,                     \
+                                                 nnz_R,                       \
+                                                 csr_val_R,                   \
+                                                 csr_row_ptr_R,               \
+                                                 csr_col_ind_R,               \
+                                                 descr_A,                     \
+                                                 nnz_A,                       \
+                                                 csr_val_A,                   \
+                                                 csr_row_ptr_A,               \
+                                                 csr_col_ind_A,               \
+                                                 descr_P,                     \
+                                                 nnz_P,                       \
+                                                 csr_val_P,                   \
+                                                 csr_row_ptr_P,               \
+                                                 csr_col_ind_P,               \
+                                                 descr_C,                     \
+                                                 csr_val_C,                   \
+                                                 csr_row_ptr_C,               \
+                                                 csr_col_ind_C);              \
+    }
+
+C_IMPL(rocsparse_scsrrap_numeric, float);
+C_IMPL(rocsparse_dcsrrap_numeric, double);
+C_IMPL(rocsparse_ccsrrap_numeric, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrrap_numeric, rocsparse_double_complex);
+#undef C_IMPL
@@ -207,6 +207,85 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
         }
     }
 
+    // STAGE 4 - perform SpGEMM computation and store the symbolic plan
+    if(stage == rocsparse_spgemm_stage_symbolic)
+    {
+        // CSR format
+        if(A->format == rocsparse_format_csr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_template(handle,
+                                                                 trans_A,
+                                                                 trans_B,
+                                                                 (J)A->rows,
+                                                                 (J)B->cols,
+                                                                 (J)A->cols,
+                                                                 (const T*)alpha,
+                                                                 A->descr,
+                                                                 (I)A->nnz,
+                                                                 (const T*)A->val_data,
+                                                                 (const I*)A->row_data,
+                                                                 (const J*)A->col_data,
+                                                                 B->descr,
+                                                                 (I)B->nnz,
+                                                                 (const T*)B->val_data,
+                                                                 (const I*)B->row_data,
+                                                                 (const J*)B->col_data,
+                                                                 (const T*)beta,
+                                                                 D->descr,
+                                                                 (I)D->nnz,
+                                                                 (const T*)D->val_data,
+                                                                 (const I*)D->row_data,
+                                                                 (const J*)D->col_data,
+                                                                 C->descr,
+                                                                 (T*)C->val_data,
+                                                                 (const I*)C->row_data,
+                                                                 (J*)C->col_data,
+                                                                 C->info,
+                                                                 temp_buffer));
+
+            return rocsparse_csrgemm_symbolic_template(
+                handle, (J)C->rows, (I)C->nnz, (const I*)C->row_data, C->info, temp_buffer);
+        }
+
+        return rocsparse_status_not_implemented;
+    }
+
+    // STAGE 5 - recompute the values of C using the symbolic plan
+    if(stage == rocsparse_spgemm_stage_numeric)
+    {
+        // CSR format
+        if(A->format == rocsparse_format_csr)
+        {
+            return rocsparse_csrgemm_numeric_template(handle,
+                                                      (J)A->rows,
+                                                      (J)B->cols,
+                                                      (J)A->cols,
+                                                      (const T*)alpha,
+                                                      A->descr,
+                                                      (I)A->nnz,
+                                                      (const T*)A->val_data,
+                                                      (const I*)A->row_data,
+                                                      (const J*)A->col_data,
+                                                      B->descr,
+                                                      (I)B->nnz,
+                                                      (const T*)B->val_data,
+                                                      (const I*)B->row_data,
+                                                      (const J*)B->col_data,
+                                                      (const T*)beta,
+                                                      D->descr,
+                                                      (I)D->nnz,
+                                                      (const T*)D->val_data,
+                                                      (const I*)D->row_data,
+                                                      (const J*)D->col_data,
+                                                      C->descr,
+                                                      (I)C->nnz,
+                                                      (T*)C->val_data,
+                                                      (const I*)C->row_data,
+                                                      (const J*)C->col_data,
+                                                      C->info);
+        }
+    }
+
     return rocsparse_status_not_implemented;
 }
 
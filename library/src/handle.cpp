@@ -207,6 +207,22 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
         RETURN_IF_HIP_ERROR(hipFree(info->wg_ids));
     }
 
+    // Clean up transposed structure
+    if(info->trmv_perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trmv_perm));
+    }
+
+    if(info->trmv_col_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trmv_col_ptr));
+    }
+
+    if(info->trmv_row_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trmv_row_ind));
+    }
+
     // Destruct
     try
     {
@@ -270,6 +286,18 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
         info->trm_diag_ind = nullptr;
     }
 
+    if(info->supernode_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->supernode_ptr));
+        info->supernode_ptr = nullptr;
+    }
+
+    if(info->entry_map != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->entry_map));
+        info->entry_map = nullptr;
+    }
+
     // Clear trmt arrays
     if(info->trmt_perm != nullptr)
     {
@@ -330,6 +358,8 @@ bool rocsparse_check_trm_shared(const rocsparse_mat_info info, rocsparse_trm_inf
         ++shared;
     if(trm == info->csric0_info)
         ++shared;
+    if(trm == info->csrildl0_info)
+        ++shared;
     if(trm == info->csrsv_lower_info)
         ++shared;
     if(trm == info->csrsv_upper_info)
@@ -387,6 +417,12 @@ rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info)
         return rocsparse_status_success;
     }
 
+    // Clean up symbolic plan
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->perm));
+    }
+
     // Destruct
     try
     {
@@ -651,6 +651,16 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
     array[idx] = value;
 }
 
+// Write zero pivot to position, or -1 if no zero pivot has been found
+template <typename I>
+ROCSPARSE_KERNEL void zero_pivot_to_position(const I* __restrict__ zero_pivot,
+                                             I* __restrict__ position)
+{
+    I pivot = *zero_pivot;
+
+    *position = (pivot == std::numeric_limits<I>::max()) ? -1 : pivot;
+}
+
 // Scale array by value
 template <unsigned int BLOCKSIZE, typename I, typename T>
 __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void scale_array(I m, T* __restrict__ array, T value)
@@ -69,6 +69,10 @@ struct _rocsparse_handle
     hipStream_t stream = 0;
     // pointer mode ; default mode is host
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
+    // deterministic mode ; default mode is disabled
+    rocsparse_deterministic_mode deterministic_mode = rocsparse_deterministic_mode_disabled;
+    // graph mode ; default mode is disabled
+    rocsparse_graph_mode graph_mode = rocsparse_graph_mode_disabled;
     // logging mode
     rocsparse_layer_mode layer_mode;
     // device buffer
@@ -135,6 +139,9 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void*          coo_val     = nullptr;
+
+    // modelled hybmv cost in bytes
+    int64_t predicted_cost = 0;
 };
 
 /********************************************************************************
@@ -161,6 +168,7 @@ struct _rocsparse_mat_info
     rocsparse_csrmv_info   csrmv_info        = nullptr;
     rocsparse_trm_info     csric0_info       = nullptr;
     rocsparse_trm_info     csrilu0_info      = nullptr;
+    rocsparse_trm_info     csrildl0_info     = nullptr;
     rocsparse_trm_info     csrsv_upper_info  = nullptr;
     rocsparse_trm_info     csrsv_lower_info  = nullptr;
     rocsparse_trm_info     csrsvt_upper_info = nullptr;
@@ -170,11 +178,21 @@ struct _rocsparse_mat_info
     rocsparse_trm_info     csrsmt_upper_info = nullptr;
     rocsparse_trm_info     csrsmt_lower_info = nullptr;
     rocsparse_csrgemm_info csrgemm_info      = nullptr;
-
-    // zero pivot for csrsv, csrsm, csrilu0, csric0
+    rocsparse_trm_info     csrmc_info        = nullptr;
+
+    // ILU(k) pattern computed by csriluk_nnz, where the column indices and levels of
+    // the level-of-fill passes are double buffered and csriluk_slot holds the final
+    // pattern. A negative number of non-zero entries marks that no pattern is available
+    rocsparse_int  csriluk_nnz        = -1;
+    int            csriluk_slot       = 0;
+    size_t         csriluk_size[2]    = {};
+    rocsparse_int* csriluk_col_ind[2] = {};
+    int*           csriluk_lev[2]     = {};
+
+    // zero pivot for csrsv, csrsm, csrilu0, csric0, csrildl0, csrmc
     void* zero_pivot = nullptr;
 
-    // numeric boost for ilu0
+    // numeric boost for ilu0, ildl0 and ilut
     int         boost_enable        = 0;
     int         use_double_prec_tol = 0;
     const void* boost_tol           = nullptr;
@@ -207,6 +225,11 @@ struct _rocsparse_csrmv_info
     unsigned int* wg_flags   = nullptr;
     void*         wg_ids     = nullptr;
 
+    // transposed (CSC) structure for atomic-free transposed csrmv
+    void* trmv_perm    = nullptr;
+    void* trmv_col_ptr = nullptr;
+    void* trmv_row_ind = nullptr;
+
     // some data to verify correct execution
     rocsparse_operation         trans;
     int64_t                     m;
@@ -236,10 +259,27 @@ struct _rocsparse_trm_info
     // maximum non-zero entries per row
     int64_t max_nnz = 0;
 
-    // device array to hold row permutation
+    // number of levels and maximum number of rows per level
+    int64_t nlevels   = 0;
+    int64_t max_width = 0;
+    // critical path length, i.e. sum of the maximum row length of each level
+    int64_t critical_path = 0;
+    // host array to hold the start of each level in row_map
+    std::vector<int64_t> level_ptr;
+
+    // number of supernodes, i.e. groups of consecutive rows that share their pattern
+    // outside of a dense triangular diagonal block
+    int64_t nsupernodes = 0;
+    // device array to hold the first row of each supernode
+    void* supernode_ptr = nullptr;
+
+    // device array to hold row permutation, sorted by level
     void* row_map = nullptr;
     // device array to hold pointer to diagonal entry
     void* trm_diag_ind = nullptr;
+    // device array to hold the entries of each row, sorted by the position of their
+    // column in row_map
+    void* entry_map = nullptr;
     // device pointers to hold transposed data
     void* trmt_perm    = nullptr;
     void* trmt_row_ptr = nullptr;
@@ -285,6 +325,17 @@ struct _rocsparse_csrgemm_info
     bool mul = true;
     // Perform beta * D
     bool add = true;
+
+    // Symbolic plan for the numeric SpGEMM stage, rows of C are grouped by their
+    // number of non-zeros (see CSRGEMM_MAXGROUPS)
+    bool    symbolic      = false;
+    int64_t group_size[8] = {};
+    // device array to hold the row permutation, nullptr if rows are not permuted
+    void* perm = nullptr;
+
+    // some data to verify correct execution
+    int64_t m   = 0;
+    int64_t nnz = 0;
 };
 
 /********************************************************************************
@@ -351,6 +402,10 @@ struct _rocsparse_spmat_descr
     int64_t             block_dim;
     int64_t             ell_cols;
     int64_t             ell_width;
+
+    // Strided batch of values sharing the sparsity pattern
+    int64_t batch_count  = 1;
+    int64_t batch_stride = 0;
 };
 
 struct _rocsparse_dnvec_descr
@@ -374,6 +429,10 @@ struct _rocsparse_dnmat_descr
 
     rocsparse_datatype data_type;
     rocsparse_order    order;
+
+    // Strided batch of dense matrices
+    int64_t batch_count  = 1;
+    int64_t batch_stride = 0;
 };
 
 #endif // HANDLE_H
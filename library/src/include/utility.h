@@ -391,6 +391,7 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_hyb_partition value)
     case rocsparse_hyb_partition_auto:
     case rocsparse_hyb_partition_user:
     case rocsparse_hyb_partition_max:
+    case rocsparse_hyb_partition_histogram:
     {
         return false;
     }
@@ -570,6 +571,98 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_spgemm_stage value_)
     case rocsparse_spgemm_stage_buffer_size:
     case rocsparse_spgemm_stage_nnz:
     case rocsparse_spgemm_stage_compute:
+    case rocsparse_spgemm_stage_symbolic:
+    case rocsparse_spgemm_stage_numeric:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_csrgemm_mask value_)
+{
+    switch(value_)
+    {
+    case rocsparse_csrgemm_mask_keep:
+    case rocsparse_csrgemm_mask_complement:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_csrgemm_masked_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_csrgemm_masked_alg_default:
+    case rocsparse_csrgemm_masked_alg_dot:
+    case rocsparse_csrgemm_masked_alg_row:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_gtsv_interleaved_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_gtsv_interleaved_alg_default:
+    case rocsparse_gtsv_interleaved_alg_thomas:
+    case rocsparse_gtsv_interleaved_alg_pcr:
+    case rocsparse_gtsv_interleaved_alg_lu:
+    case rocsparse_gtsv_interleaved_alg_qr:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_gpsv_interleaved_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_gpsv_interleaved_alg_default:
+    case rocsparse_gpsv_interleaved_alg_qr:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_bsrdiag_inverse_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_bsrdiag_inverse_alg_default:
+    case rocsparse_bsrdiag_inverse_alg_no_pivot:
+    case rocsparse_bsrdiag_inverse_alg_partial_pivot:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_sor_sweep value_)
+{
+    switch(value_)
+    {
+    case rocsparse_sor_sweep_forward:
+    case rocsparse_sor_sweep_backward:
+    case rocsparse_sor_sweep_symmetric:
     {
         return false;
     }
@@ -583,6 +676,8 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_solve_policy value_)
     switch(value_)
     {
     case rocsparse_solve_policy_auto:
+    case rocsparse_solve_policy_level_set:
+    case rocsparse_solve_policy_sync_free:
     {
         return false;
     }
@@ -93,6 +93,13 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle     handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Returning the result to the host requires a blocking copy
+    if(handle->graph_mode == rocsparse_graph_mode_enabled
+       && handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
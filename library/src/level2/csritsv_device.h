@@ -0,0 +1,137 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRITSV_DEVICE_H
+#define CSRITSV_DEVICE_H
+
+#include "common.h"
+
+// Atomic maximum of non-negative floating point values. Non-negative IEEE values are
+// ordered like their bit patterns, when interpreted as signed integers.
+__device__ __forceinline__ void csritsv_atomic_max(float* ptr, float val)
+{
+    atomicMax(reinterpret_cast<int*>(ptr), __float_as_int(val));
+}
+
+__device__ __forceinline__ void csritsv_atomic_max(double* ptr, double val)
+{
+    atomicMax(reinterpret_cast<int64_t*>(ptr), static_cast<int64_t>(__double_as_longlong(val)));
+}
+
+// Single Jacobi sweep on the triangular system, where each row is processed by a
+// (sub)wavefront. The diagonal entry is accessed through the diagonal index that has
+// been collected during the analysis step. The new iterate only depends on the previous
+// one, thus all rows are independent. The maximum update of this sweep is accumulated
+// in max_update, such that convergence can be tested without an additional kernel.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+__device__ void csritsv_sweep_device(J m,
+                                     T alpha,
+                                     const I* __restrict__ csr_row_ptr,
+                                     const J* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     const I* __restrict__ csr_diag_ind,
+                                     const T* __restrict__ x,
+                                     const T* __restrict__ y_old,
+                                     T* __restrict__ y_new,
+                                     floating_data_t<T>* __restrict__ max_update,
+                                     J* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base,
+                                     rocsparse_fill_mode  fill_mode,
+                                     rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Row that the wavefront will process
+    J row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Shared memory to hold the update of each row
+    __shared__ floating_data_t<T> update[BLOCKSIZE / WF_SIZE];
+
+    update[wid] = static_cast<floating_data_t<T>>(0);
+
+    if(row < m)
+    {
+        I row_begin = csr_row_ptr[row] - idx_base;
+        I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        // Local summation variable
+        T local_sum = static_cast<T>(0);
+
+        for(I j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            J col = csr_col_ind[j] - idx_base;
+
+            // Only the strictly triangular part contributes
+            if((fill_mode == rocsparse_fill_mode_lower && col < row)
+               || (fill_mode == rocsparse_fill_mode_upper && col > row))
+            {
+                local_sum = rocsparse_fma(csr_val[j], y_old[col], local_sum);
+            }
+        }
+
+        // Gather all local sums for each lane
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            T sum = alpha * x[row] - local_sum;
+
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                I diag_idx = csr_diag_ind[row];
+
+                // Structural zero pivots have been reported by the analysis step
+                T diag = (diag_idx == -1) ? static_cast<T>(1) : csr_val[diag_idx];
+
+                if(diag == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    atomicMin(zero_pivot, row + idx_base);
+                    diag = static_cast<T>(1);
+                }
+
+                sum = sum / diag;
+            }
+
+            update[wid] = rocsparse_abs(sum - y_old[row]);
+
+            y_new[row] = sum;
+        }
+    }
+
+    __syncthreads();
+
+    // Determine the maximum update of this block
+    rocsparse_blockreduce_max<BLOCKSIZE / WF_SIZE>(hipThreadIdx_x, update);
+
+    if(hipThreadIdx_x == 0)
+    {
+        csritsv_atomic_max(max_update, update[0]);
+    }
+}
+
+#endif // CSRITSV_DEVICE_H
@@ -28,16 +28,67 @@
 
 #include "common.h"
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+// Output stage of csrmv, computes sum + beta * y[row]
+template <typename T>
+struct csrmv_beta_epilogue
+{
+    T        beta;
+    const T* y;
+
+    template <typename J>
+    __device__ __forceinline__ T operator()(J row, T sum) const
+    {
+        return (beta == static_cast<T>(0)) ? sum : rocsparse_fma(beta, y[row], sum);
+    }
+};
+
+// Output stage of a fused polynomial step, computes
+// sum + beta * y[row] + gamma * x[row] + delta * v[row]
+// where v is the vector that has been multiplied by the matrix
+template <typename T>
+struct csrmv_poly_epilogue
+{
+    T        beta;
+    T        gamma;
+    T        delta;
+    const T* x;
+    const T* v;
+    const T* y;
+
+    template <typename J>
+    __device__ __forceinline__ T operator()(J row, T sum) const
+    {
+        sum = rocsparse_fma(gamma, x[row], sum);
+
+        if(delta != static_cast<T>(0))
+        {
+            sum = rocsparse_fma(delta, v[row], sum);
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            sum = rocsparse_fma(beta, y[row], sum);
+        }
+
+        return sum;
+    }
+};
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename EPILOGUE>
 static __device__ void csrmvn_general_device(J                    m,
                                              T                    alpha,
                                              const I*             row_offset,
                                              const J*             csr_col_ind,
                                              const T*             csr_val,
                                              const T*             x,
-                                             T                    beta,
                                              T*                   y,
-                                             rocsparse_index_base idx_base)
+                                             rocsparse_index_base idx_base,
+                                             EPILOGUE             epilogue)
 {
     int lid = hipThreadIdx_x & (WF_SIZE - 1);
 
@@ -66,14 +117,7 @@ static __device__ void csrmvn_general_device(J                    m,
         // First thread of each wavefront writes result into global memory
         if(lid == WF_SIZE - 1)
         {
-            if(beta == static_cast<T>(0))
-            {
-                y[row] = sum;
-            }
-            else
-            {
-                y[row] = rocsparse_fma(beta, y[row], sum);
-            }
+            y[row] = epilogue(row, sum);
         }
     }
 }
@@ -124,6 +168,65 @@ static __device__ void csrmvt_general_device(rocsparse_operation  trans,
     }
 }
 
+// Transposed csrmv using the CSC structure computed during csrmv_analysis. Each
+// wavefront gathers one column of A, values are read through the permutation
+// into the original CSR value array. No atomics are required and the summation
+// order is fixed.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+static __device__ void csrmvt_gather_device(rocsparse_operation  trans,
+                                            J                    n,
+                                            T                    alpha,
+                                            const I*             csc_col_ptr,
+                                            const J*             csc_row_ind,
+                                            const I*             csc_perm,
+                                            const T*             csr_val,
+                                            const T*             x,
+                                            T                    beta,
+                                            T*                   y,
+                                            rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    J nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over columns
+    for(J col = gid / WF_SIZE; col < n; col += nwf)
+    {
+        // Each wavefront processes one column
+        I col_start = csc_col_ptr[col] - idx_base;
+        I col_end   = csc_col_ptr[col + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(I j = col_start + lid; j < col_end; j += WF_SIZE)
+        {
+            T val = (trans == rocsparse_operation_conjugate_transpose)
+                        ? rocsparse_conj(csr_val[csc_perm[j]])
+                        : csr_val[csc_perm[j]];
+
+            sum = rocsparse_fma(alpha * val, rocsparse_ldg(x + csc_row_ind[j] - idx_base), sum);
+        }
+
+        // Obtain column sum using parallel reduction
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == WF_SIZE - 1)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[col] = sum;
+            }
+            else
+            {
+                y[col] = rocsparse_fma(beta, y[col], sum);
+            }
+        }
+    }
+}
+
 template <typename I, typename T>
 static inline __device__ T sum2_reduce(T cur_sum, T* partial, int lid, I max_size, int reduc_size)
 {
@@ -142,7 +245,8 @@ template <rocsparse_int BLOCKSIZE,
           rocsparse_int WG_SIZE,
           typename I,
           typename J,
-          typename T>
+          typename T,
+          typename EPILOGUE>
 __device__ void csrmvn_adaptive_device(I                    nnz,
                                        const I*             row_blocks,
                                        unsigned int*        wg_flags,
@@ -152,9 +256,9 @@ __device__ void csrmvn_adaptive_device(I                    nnz,
                                        const J*             csr_col_ind,
                                        const T*             csr_val,
                                        const T*             x,
-                                       T                    beta,
                                        T*                   y,
-                                       rocsparse_index_base idx_base)
+                                       rocsparse_index_base idx_base,
+                                       EPILOGUE             epilogue)
 {
     __shared__ T partialSums[BLOCKSIZE];
 
@@ -300,14 +404,10 @@ __device__ void csrmvn_adaptive_device(I                    nnz,
 
             if(threadInBlock == 0 && local_row < stop_row)
             {
-                // All of our write-outs check to see if the output vector should first be zeroed.
-                // If so, just do a write rather than a read-write. Measured to be a slight (~5%)
-                // performance improvement.
-                if(beta != static_cast<T>(0))
-                {
-                    temp_sum = rocsparse_fma(beta, y[local_row], temp_sum);
-                }
-                y[local_row] = temp_sum;
+                // All of our write-outs go through the epilogue, which checks to see if the
+                // output vector should first be zeroed. If so, just do a write rather than a
+                // read-write. Measured to be a slight (~5%) performance improvement.
+                y[local_row] = epilogue(local_row, temp_sum);
             }
         }
         else
@@ -332,12 +432,7 @@ __device__ void csrmvn_adaptive_device(I                    nnz,
 
                 // After you've done the reduction into the temp_sum register,
                 // put that into the output for each row.
-                if(beta != static_cast<T>(0))
-                {
-                    temp_sum = rocsparse_fma(beta, y[local_row], temp_sum);
-                }
-
-                y[local_row] = temp_sum;
+                y[local_row] = epilogue(local_row, temp_sum);
                 local_row += WG_SIZE;
             }
         }
@@ -381,14 +476,7 @@ __device__ void csrmvn_adaptive_device(I                    nnz,
 
             if(lid == 0)
             {
-                temp_sum = partialSums[0];
-
-                if(beta != static_cast<T>(0))
-                {
-                    temp_sum = rocsparse_fma(beta, y[row], temp_sum);
-                }
-
-                y[row] = temp_sum;
+                y[row] = epilogue(row, partialSums[0]);
             }
             ++row;
         }
@@ -414,9 +502,13 @@ __device__ void csrmvn_adaptive_device(I                    nnz,
         // wg_flags[first_wg_in_row] in the first workgroup is the flag that everyone waits on.
         if(gid == first_wg_in_row && lid == 0)
         {
-            // The first workgroup handles the output initialization.
-            T out_val = y[row];
-            temp_sum  = (beta - static_cast<T>(1)) * out_val;
+            // The first workgroup handles the output initialization. The partial
+            // results of all workgroups are added to y, thus the first workgroup
+            // stores the epilogue of a zero sum to y, before any other workgroup is
+            // released. The previous content of y is only read by the epilogue, such
+            // that it may be uninitialized if beta is zero.
+            y[row] = epilogue(row, static_cast<T>(0));
+            __threadfence();
             atomicXor(&wg_flags[first_wg_in_row], 1U); // Release other workgroups.
         }
         // For every other workgroup, wg_flags[first_wg_in_row] holds the value they wait on.
@@ -338,6 +338,194 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
     }
 }
 
+// Count the number of rows of each level, where depth holds the depth of each row. Depths
+// start at 1 and are contiguous, because each row depends on a row of the previous level.
+// Rows of the same level are grouped within each wavefront, such that a single atomic
+// operation per wavefront and level is sufficient. Additionally, the maximum row length
+// of each level and the total number of levels are determined.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrsv_analysis_level_count_kernel(J m,
+                                           const I* __restrict__ csr_row_ptr,
+                                           const int* __restrict__ depth,
+                                           J* __restrict__ level_size,
+                                           int* __restrict__ level_max_nnz,
+                                           int* __restrict__ nlevels)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Rows that are out of bounds do not belong to any level
+    int level = (row < m) ? depth[row] : 0;
+
+    if(level != 0)
+    {
+        int row_nnz = static_cast<int>(csr_row_ptr[row + 1] - csr_row_ptr[row]);
+
+        // Only rows that exceed the current maximum of their level need to be updated
+        if(row_nnz > level_max_nnz[level - 1])
+        {
+            atomicMax(&level_max_nnz[level - 1], row_nnz);
+        }
+    }
+
+    // Lanes that have not been counted yet
+    uint64_t pending = __ballot(level != 0);
+
+    while(pending != 0)
+    {
+        // The first pending lane determines the level that is processed next
+        int leader  = __ffsll(pending) - 1;
+        int current = __shfl(level, leader, WF_SIZE);
+
+        // All lanes of the current level
+        uint64_t group = __ballot(level == current);
+
+        if(lid == leader)
+        {
+            atomicAdd(&level_size[current - 1], static_cast<J>(__popcll(group)));
+            atomicMax(nlevels, current);
+        }
+
+        pending &= ~group;
+    }
+}
+
+// Scatter the rows into the row map, such that the rows are grouped by their level. The
+// start of each level is held by level_ptr, which is advanced while inserting. Rows of
+// the same level are grouped within each wavefront, such that a single atomic operation
+// reserves the slots for all of them. The order of the rows within a level does not
+// matter, because they are independent of each other.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename J>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrsv_analysis_level_scatter_kernel(J m,
+                                             const int* __restrict__ depth,
+                                             J* __restrict__ level_ptr,
+                                             J* __restrict__ row_map)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Rows that are out of bounds do not belong to any level
+    int level = (row < m) ? depth[row] : 0;
+
+    // Lanes that have not been inserted yet
+    uint64_t pending = __ballot(level != 0);
+
+    while(pending != 0)
+    {
+        // The first pending lane determines the level that is processed next
+        int leader  = __ffsll(pending) - 1;
+        int current = __shfl(level, leader, WF_SIZE);
+
+        // All lanes of the current level
+        uint64_t group = __ballot(level == current);
+
+        // Reserve the slots of the group
+        J offset = 0;
+
+        if(lid == leader)
+        {
+            offset = atomicAdd(&level_ptr[current - 1], static_cast<J>(__popcll(group)));
+        }
+
+        offset = __shfl(offset, leader, WF_SIZE);
+
+        if(level == current)
+        {
+            // Each lane is placed behind the lanes of the group that precede it
+            row_map[offset + __popcll(group & ((1ULL << lid) - 1))] = row;
+        }
+
+        pending &= ~group;
+    }
+}
+
+// Determine whether a row can be merged with its predecessor into a supernode. For lower
+// triangular matrices, the strictly lower part of the row has to be the strictly lower
+// part of the previous row, extended by the previous row itself. For upper triangular
+// matrices, the strictly upper part of the previous row has to be the strictly upper
+// part of the row, extended by the row itself. Rows without diagonal entry are never
+// merged.
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrsv_analysis_supernode_kernel(J m,
+                                         const I* __restrict__ csr_row_ptr,
+                                         const J* __restrict__ csr_col_ind,
+                                         const I* __restrict__ csr_diag_ind,
+                                         J* __restrict__ merge,
+                                         rocsparse_index_base idx_base,
+                                         rocsparse_fill_mode  fill_mode)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    merge[row] = 0;
+
+    if(row == 0)
+    {
+        return;
+    }
+
+    I diag_prev = csr_diag_ind[row - 1];
+    I diag      = csr_diag_ind[row];
+
+    if(diag_prev == -1 || diag == -1)
+    {
+        return;
+    }
+
+    if(fill_mode == rocsparse_fill_mode_lower)
+    {
+        I row_begin_prev = csr_row_ptr[row - 1] - idx_base;
+        I row_begin      = csr_row_ptr[row] - idx_base;
+
+        // The row has to hold one additional strictly lower entry, which is row - 1
+        if(diag - row_begin != diag_prev - row_begin_prev + 1
+           || csr_col_ind[diag - 1] - idx_base != row - 1)
+        {
+            return;
+        }
+
+        for(I j = 0; j < diag_prev - row_begin_prev; ++j)
+        {
+            if(csr_col_ind[row_begin + j] != csr_col_ind[row_begin_prev + j])
+            {
+                return;
+            }
+        }
+    }
+    else
+    {
+        I row_end_prev = csr_row_ptr[row] - idx_base;
+        I row_end      = csr_row_ptr[row + 1] - idx_base;
+
+        // The previous row has to hold one additional strictly upper entry, which is row
+        if(row_end_prev - diag_prev != row_end - diag + 1
+           || csr_col_ind[diag_prev + 1] - idx_base != row)
+        {
+            return;
+        }
+
+        for(I j = 1; j < row_end - diag; ++j)
+        {
+            if(csr_col_ind[diag + j] != csr_col_ind[diag_prev + 1 + j])
+            {
+                return;
+            }
+        }
+    }
+
+    merge[row] = 1;
+}
+
 template <unsigned int BLOCKSIZE,
           unsigned int WF_SIZE,
           bool         SLEEP,
@@ -509,4 +697,198 @@ __device__ void csrsv_device(J m,
     }
 }
 
+// Sync-free triangular solve, where each supernode is processed by a wavefront. All rows
+// of a supernode share their dependencies outside of the supernode, thus each dependency
+// is waited for only once. The shared part is processed as dense matrix vector product,
+// followed by a dense triangular solve of the diagonal block, where lane k holds row
+// first + k of the supernode. The width of a supernode must not exceed the wavefront size.
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          bool         SLEEP,
+          typename I,
+          typename J,
+          typename T>
+__device__ void csrsv_supernode_device(J nsupernodes,
+                                       T alpha,
+                                       const I* __restrict__ csr_row_ptr,
+                                       const J* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const I* __restrict__ csr_diag_ind,
+                                       const J* __restrict__ supernode_ptr,
+                                       const T* __restrict__ x,
+                                       T* __restrict__ y,
+                                       int* __restrict__ done_array,
+                                       J* __restrict__ zero_pivot,
+                                       rocsparse_index_base idx_base,
+                                       rocsparse_fill_mode  fill_mode,
+                                       rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    J idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Shared memory to exchange the entries of the diagonal block between lanes
+    __shared__ T sdata[BLOCKSIZE];
+
+    // Do not run out of bounds
+    if(idx >= nsupernodes)
+    {
+        return;
+    }
+
+    // Supernodes of lower triangular matrices are processed in ascending order, those of
+    // upper triangular matrices in descending order
+    J supernode = (fill_mode == rocsparse_fill_mode_lower) ? idx : nsupernodes - 1 - idx;
+
+    J first = supernode_ptr[supernode];
+    J width = supernode_ptr[supernode + 1] - first;
+    J last  = first + width - 1;
+
+    // The reference row holds the shared pattern in front of (lower) or behind (upper)
+    // the diagonal block
+    J ref_row   = (fill_mode == rocsparse_fill_mode_lower) ? first : last;
+    I ref_begin = csr_row_ptr[ref_row] - idx_base;
+    I ref_end   = csr_row_ptr[ref_row + 1] - idx_base;
+
+    // Wait for all dependencies of the supernode
+    for(I j = ref_begin + lid; j < ref_end; j += WF_SIZE)
+    {
+        J local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        if(local_col >= first && local_col <= last)
+        {
+            continue;
+        }
+
+        if((fill_mode == rocsparse_fill_mode_lower && local_col > last)
+           || (fill_mode == rocsparse_fill_mode_upper && local_col < first))
+        {
+            continue;
+        }
+
+        // Spin loop until dependency has been resolved
+        int          local_done    = atomicOr(&done_array[local_col], 0);
+        unsigned int times_through = 0;
+        while(!local_done)
+        {
+            if(SLEEP)
+            {
+                for(unsigned int i = 0; i < times_through; ++i)
+                {
+                    __builtin_amdgcn_s_sleep(1);
+                }
+
+                if(times_through < 3907)
+                {
+                    ++times_through;
+                }
+            }
+
+            local_done = atomicOr(&done_array[local_col], 0);
+        }
+    }
+
+    // Wait for y to be visible globally
+    __threadfence();
+
+    // Dense matrix vector product with the shared part. The shared entries are located
+    // at the beginning (lower) or at the end (upper) of each row of the supernode.
+    for(J k = 0; k < width; ++k)
+    {
+        J row = first + k;
+
+        I row_begin = csr_row_ptr[row] - idx_base;
+        I row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T local_sum = static_cast<T>(0);
+
+        for(I j = ref_begin + lid; j < ref_end; j += WF_SIZE)
+        {
+            J local_col = csr_col_ind[j] - idx_base;
+
+            if((fill_mode == rocsparse_fill_mode_lower && local_col < first)
+               || (fill_mode == rocsparse_fill_mode_upper && local_col > last))
+            {
+                I pos = (fill_mode == rocsparse_fill_mode_lower) ? row_begin + (j - ref_begin)
+                                                                 : row_end - (ref_end - j);
+
+                local_sum = rocsparse_fma(csr_val[pos], y[local_col], local_sum);
+            }
+        }
+
+        // Gather all local sums for each lane
+        local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            sdata[wid * WF_SIZE + k] = local_sum;
+        }
+    }
+
+    __threadfence_block();
+
+    // Right-hand side of the diagonal block
+    T rhs = static_cast<T>(0);
+
+    if(lid < width)
+    {
+        rhs = alpha * rocsparse_nontemporal_load(x + first + lid) - sdata[wid * WF_SIZE + lid];
+    }
+
+    // Forward (lower) or backward (upper) substitution of the diagonal block
+    for(J s = 0; s < width; ++s)
+    {
+        J i = (fill_mode == rocsparse_fill_mode_lower) ? s : width - 1 - s;
+
+        if(lid == i)
+        {
+            // If we have non unit diagonal, take the diagonal into account
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                I diag_idx = csr_diag_ind[first + i];
+
+                // Structural zero pivots have been reported by the analysis step
+                T diag = (diag_idx == -1) ? static_cast<T>(1) : csr_val[diag_idx];
+
+                if(diag == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    atomicMin(zero_pivot, first + i + idx_base);
+                    diag = static_cast<T>(1);
+                }
+
+                rhs = rhs / diag;
+            }
+
+            sdata[wid * WF_SIZE + i] = rhs;
+        }
+
+        __threadfence_block();
+
+        // Eliminate the solved entry from the remaining rows of the block
+        if((fill_mode == rocsparse_fill_mode_lower && lid > i && lid < width)
+           || (fill_mode == rocsparse_fill_mode_upper && lid < i))
+        {
+            // Entry (first + lid, first + i) relative to the diagonal of row first + lid
+            I pos = csr_diag_ind[first + lid] + i - lid;
+
+            rhs = rocsparse_fma(-csr_val[pos], sdata[wid * WF_SIZE + i], rhs);
+        }
+    }
+
+    if(lid < width)
+    {
+        // Store the rows result in y
+        rocsparse_nontemporal_store(rhs, &y[first + lid]);
+
+        // Make sure y is written to global memory before setting "row is done" flag
+        __threadfence();
+
+        // Mark row as done
+        atomicOr(&done_array[first + lid], 1);
+    }
+}
+
 #endif // CSRSV_DEVICE_H
@@ -24,6 +24,7 @@
 
 #include "rocsparse_bsrsv.hpp"
 
+#include "common.h"
 #include "definitions.h"
 #include "utility.h"
 
@@ -75,6 +76,25 @@ extern "C" rocsparse_status rocsparse_bsrsv_zero_pivot(rocsparse_handle   handle
         return rocsparse_status_success;
     }
 
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -26,7 +26,9 @@
 #include "definitions.h"
 #include "utility.h"
 
+#include "../conversion/rocsparse_identity.hpp"
 #include "coomv_device.h"
+#include <rocprim/rocprim.hpp>
 
 template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
 __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
@@ -84,6 +86,227 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void coomvt_kernel(rocsparse_opera
     }
 }
 
+template <unsigned int BLOCKSIZE, typename I, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void coomvt_permute_kernel(rocsparse_operation trans,
+                               I                   nnz,
+                               const I* __restrict__ perm,
+                               const I* __restrict__ coo_row_ind,
+                               const T* __restrict__ coo_val,
+                               I* __restrict__ coo_col_ind_t,
+                               T* __restrict__ coo_val_t)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    I idx = perm[gid];
+
+    coo_col_ind_t[gid] = coo_row_ind[idx];
+    coo_val_t[gid]
+        = (trans == rocsparse_operation_conjugate_transpose) ? rocsparse_conj(coo_val[idx])
+                                                             : coo_val[idx];
+}
+
+template <typename I, typename T, typename U>
+static rocsparse_status rocsparse_coomvn_segmented_dispatch(rocsparse_handle     handle,
+                                                            I                    nnz,
+                                                            U                    alpha_device_host,
+                                                            const T*             coo_val,
+                                                            const I*             coo_row_ind,
+                                                            const I*             coo_col_ind,
+                                                            const T*             x,
+                                                            T*                   y,
+                                                            rocsparse_index_base idx_base)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define COOMVN_DIM 128
+    int maxthreads = handle->properties.maxThreadsPerBlock;
+    int nprocs     = handle->properties.multiProcessorCount;
+    int maxblocks  = (nprocs * maxthreads - 1) / COOMVN_DIM + 1;
+
+    I minblocks = (nnz - 1) / COOMVN_DIM + 1;
+    I nblocks   = maxblocks < minblocks ? maxblocks : minblocks;
+    I nwfs      = nblocks * (COOMVN_DIM / handle->wavefront_size);
+    I nloops    = (nnz / handle->wavefront_size + 1) / nwfs + 1;
+
+    dim3 coomvn_blocks(nblocks);
+    dim3 coomvn_threads(COOMVN_DIM);
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(handle->buffer);
+    ptr += 256;
+
+    // row block reduction buffer
+    I* row_block_red = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * nwfs - 1) / 256 + 1) * 256;
+
+    // val block reduction buffer
+    T* val_block_red = reinterpret_cast<T*>(ptr);
+
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((coomvn_wf<COOMVN_DIM, 32>),
+                           coomvn_blocks,
+                           coomvn_threads,
+                           0,
+                           stream,
+                           nnz,
+                           nloops,
+                           alpha_device_host,
+                           coo_row_ind,
+                           coo_col_ind,
+                           coo_val,
+                           x,
+                           y,
+                           row_block_red,
+                           val_block_red,
+                           idx_base);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((coomvn_wf<COOMVN_DIM, 64>),
+                           coomvn_blocks,
+                           coomvn_threads,
+                           0,
+                           stream,
+                           nnz,
+                           nloops,
+                           alpha_device_host,
+                           coo_row_ind,
+                           coo_col_ind,
+                           coo_val,
+                           x,
+                           y,
+                           row_block_red,
+                           val_block_red,
+                           idx_base);
+    }
+
+    hipLaunchKernelGGL((coomvn_general_block_reduce<COOMVN_DIM>),
+                       dim3(1),
+                       coomvn_threads,
+                       0,
+                       stream,
+                       nwfs,
+                       row_block_red,
+                       val_block_red,
+                       y);
+#undef COOMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename T, typename U>
+static rocsparse_status rocsparse_coomvt_deterministic_dispatch(rocsparse_handle    handle,
+                                                                rocsparse_operation trans,
+                                                                I                   n,
+                                                                I                   nnz,
+                                                                U alpha_device_host,
+                                                                const rocsparse_mat_descr descr,
+                                                                const T*                  coo_val,
+                                                                const I* coo_row_ind,
+                                                                const I* coo_col_ind,
+                                                                const T* x,
+                                                                T*       y)
+{
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // The temporary work arrays cannot be allocated in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Temporary work arrays to hold the transposed COO structure
+    I* tmp_row1;
+    I* tmp_row2;
+    I* tmp_perm1;
+    I* tmp_perm2;
+    I* tmp_col;
+    T* tmp_val;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_row1, sizeof(I) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_row2, sizeof(I) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_perm1, sizeof(I) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_perm2, sizeof(I) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_col, sizeof(I) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_val, sizeof(T) * nnz));
+
+    // Column indices become the row indices of the transposed matrix
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(tmp_row1, coo_col_ind, sizeof(I) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identity permutation
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation_template(handle, nnz, tmp_perm1));
+
+    // Stable sort COO by columns, such that the transposed matrix is sorted by rows
+    rocprim::double_buffer<I> keys(tmp_row1, tmp_row2);
+    rocprim::double_buffer<I> vals(tmp_perm1, tmp_perm2);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n + descr->base);
+
+    size_t rocprim_size;
+    void*  rocprim_buffer;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+
+    // Permute row indices and values
+    hipLaunchKernelGGL((coomvt_permute_kernel<1024>),
+                       dim3((nnz - 1) / 1024 + 1),
+                       dim3(1024),
+                       0,
+                       stream,
+                       trans,
+                       nnz,
+                       vals.current(),
+                       coo_row_ind,
+                       coo_val,
+                       tmp_col,
+                       tmp_val);
+
+    // Segmented reduction over the rows of the transposed matrix
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomvn_segmented_dispatch(handle,
+                                                                  nnz,
+                                                                  alpha_device_host,
+                                                                  (const T*)tmp_val,
+                                                                  (const I*)keys.current(),
+                                                                  (const I*)tmp_col,
+                                                                  x,
+                                                                  y,
+                                                                  descr->base));
+
+    // Free temporary work arrays, hipFree synchronizes the device
+    RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_row1));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_row2));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_perm1));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_perm2));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_col));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_val));
+
+    return rocsparse_status_success;
+}
+
 template <typename I, typename T, typename U>
 rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -99,9 +322,6 @@ rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
                                           U                         beta_device_host,
                                           T*                        y)
 {
-    // Stream
-    hipStream_t stream = handle->stream;
-
     I ysize = (trans == rocsparse_operation_none) ? m : n;
 
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -142,87 +362,28 @@ rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle          handle,
     {
     case rocsparse_operation_none:
     {
-#define COOMVN_DIM 128
-        int maxthreads = handle->properties.maxThreadsPerBlock;
-        int nprocs     = handle->properties.multiProcessorCount;
-        int maxblocks  = (nprocs * maxthreads - 1) / COOMVN_DIM + 1;
-
-        I minblocks = (nnz - 1) / COOMVN_DIM + 1;
-        I nblocks   = maxblocks < minblocks ? maxblocks : minblocks;
-        I nwfs      = nblocks * (COOMVN_DIM / handle->wavefront_size);
-        I nloops    = (nnz / handle->wavefront_size + 1) / nwfs + 1;
-
-        dim3 coomvn_blocks(nblocks);
-        dim3 coomvn_threads(COOMVN_DIM);
-
-        // Buffer
-        char* ptr = reinterpret_cast<char*>(handle->buffer);
-        ptr += 256;
-
-        // row block reduction buffer
-        I* row_block_red = reinterpret_cast<I*>(ptr);
-        ptr += ((sizeof(I) * nwfs - 1) / 256 + 1) * 256;
-
-        // val block reduction buffer
-        T* val_block_red = reinterpret_cast<T*>(ptr);
-
-        if(handle->wavefront_size == 32)
-        {
-            // LCOV_EXCL_START
-            hipLaunchKernelGGL((coomvn_wf<COOMVN_DIM, 32>),
-                               coomvn_blocks,
-                               coomvn_threads,
-                               0,
-                               stream,
-                               nnz,
-                               nloops,
-                               alpha_device_host,
-                               coo_row_ind,
-                               coo_col_ind,
-                               coo_val,
-                               x,
-                               y,
-                               row_block_red,
-                               val_block_red,
-                               descr->base);
-            // LCOV_EXCL_STOP
-        }
-        else
-        {
-            assert(handle->wavefront_size == 64);
-            hipLaunchKernelGGL((coomvn_wf<COOMVN_DIM, 64>),
-                               coomvn_blocks,
-                               coomvn_threads,
-                               0,
-                               stream,
-                               nnz,
-                               nloops,
-                               alpha_device_host,
-                               coo_row_ind,
-                               coo_col_ind,
-                               coo_val,
-                               x,
-                               y,
-                               row_block_red,
-                               val_block_red,
-                               descr->base);
-        }
-
-        hipLaunchKernelGGL((coomvn_general_block_reduce<COOMVN_DIM>),
-                           dim3(1),
-                           coomvn_threads,
-                           0,
-                           stream,
-                           nwfs,
-                           row_block_red,
-                           val_block_red,
-                           y);
-#undef COOMVN_DIM
-        break;
+        return rocsparse_coomvn_segmented_dispatch(
+            handle, nnz, alpha_device_host, coo_val, coo_row_ind, coo_col_ind, x, y, descr->base);
     }
     case rocsparse_operation_transpose:
     case rocsparse_operation_conjugate_transpose:
     {
+        // Atomic-free path, that produces bitwise reproducible results
+        if(handle->deterministic_mode == rocsparse_deterministic_mode_enabled)
+        {
+            return rocsparse_coomvt_deterministic_dispatch(handle,
+                                                           trans,
+                                                           n,
+                                                           nnz,
+                                                           alpha_device_host,
+                                                           descr,
+                                                           coo_val,
+                                                           coo_row_ind,
+                                                           coo_col_ind,
+                                                           x,
+                                                           y);
+        }
+
         coomvt_kernel<1024><<<(nnz - 1) / 1024 + 1, 1024, 0, handle->stream>>>(
             trans, nnz, alpha_device_host, coo_row_ind, coo_col_ind, coo_val, x, y, descr->base);
         break;
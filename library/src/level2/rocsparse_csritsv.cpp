@@ -0,0 +1,560 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "csritsv_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csritsv_sweep_kernel(J m,
+                              U alpha_device_host,
+                              const I* __restrict__ csr_row_ptr,
+                              const J* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              const I* __restrict__ csr_diag_ind,
+                              const T* __restrict__ x,
+                              const T* __restrict__ y_old,
+                              T* __restrict__ y_new,
+                              floating_data_t<T>* __restrict__ max_update,
+                              J* __restrict__ zero_pivot,
+                              rocsparse_index_base idx_base,
+                              rocsparse_fill_mode  fill_mode,
+                              rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csritsv_sweep_device<BLOCKSIZE, WF_SIZE>(m,
+                                             alpha,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             csr_val,
+                                             csr_diag_ind,
+                                             x,
+                                             y_old,
+                                             y_new,
+                                             max_update,
+                                             zero_pivot,
+                                             idx_base,
+                                             fill_mode,
+                                             diag_type);
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csritsv_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_operation       trans,
+                                                        J                         m,
+                                                        I                         nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const I*                  csr_row_ptr,
+                                                        const J*                  csr_col_ind,
+                                                        rocsparse_mat_info        info,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritsv_buffer_size"),
+              trans,
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_col_ind == nullptr && csr_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Maximum update of a sweep
+    *buffer_size = 256;
+
+    // Previous iterate
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_csritsv_solve_dispatch(rocsparse_handle          handle,
+                                                  J                         m,
+                                                  U                         alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const I*                  csr_row_ptr,
+                                                  const J*                  csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  const T*                  x,
+                                                  T*                        y,
+                                                  rocsparse_int*            sweeps,
+                                                  const floating_data_t<T>* tol,
+                                                  void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_trm_info csritsv = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    // The diagonal index of each row has been collected by the csrsv analysis
+    if(csritsv == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Maximum update of a sweep
+    floating_data_t<T>* max_update = reinterpret_cast<floating_data_t<T>*>(ptr);
+    ptr += 256;
+
+    // Previous iterate
+    T* z = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // Start with the zero vector, such that the first sweep computes alpha * D^{-1} x
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(z, 0, sizeof(T) * m, stream));
+
+    // If diag type is unit, re-initialize zero pivot to remove structural zeros
+    if(descr->diag_type == rocsparse_diag_type_unit)
+    {
+        // Initialize on the device, such that no host synchronization is required
+        hipLaunchKernelGGL((set_array_to_value<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           1,
+                           (J*)info->zero_pivot,
+                           std::numeric_limits<J>::max());
+    }
+
+    rocsparse_int max_sweeps = *sweeps;
+
+    // Ping-pong between y and z, such that each sweep reads the previous iterate
+    const T* y_old = z;
+    T*       y_new = y;
+
+#define CSRITSV_DIM 1024
+    dim3 csritsv_blocks((handle->wavefront_size * m - 1) / CSRITSV_DIM + 1);
+    dim3 csritsv_threads(CSRITSV_DIM);
+
+    rocsparse_int sweep = 0;
+    while(sweep < max_sweeps)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(max_update, 0, sizeof(floating_data_t<T>), stream));
+
+        if(handle->wavefront_size == 32)
+        {
+            // LCOV_EXCL_START
+            hipLaunchKernelGGL((csritsv_sweep_kernel<CSRITSV_DIM, 32>),
+                               csritsv_blocks,
+                               csritsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               (const I*)csritsv->trm_diag_ind,
+                               x,
+                               y_old,
+                               y_new,
+                               max_update,
+                               (J*)info->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            assert(handle->wavefront_size == 64);
+            hipLaunchKernelGGL((csritsv_sweep_kernel<CSRITSV_DIM, 64>),
+                               csritsv_blocks,
+                               csritsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha_device_host,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               (const I*)csritsv->trm_diag_ind,
+                               x,
+                               y_old,
+                               y_new,
+                               max_update,
+                               (J*)info->zero_pivot,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+
+        ++sweep;
+
+        // Swap iterates
+        y_old = y_new;
+        y_new = (y_new == y) ? z : y;
+
+        // Convergence check requires the maximum update on the host
+        if(tol != nullptr)
+        {
+            floating_data_t<T> hmax_update;
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&hmax_update,
+                                               max_update,
+                                               sizeof(floating_data_t<T>),
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            if(hmax_update <= *tol)
+            {
+                break;
+            }
+        }
+    }
+#undef CSRITSV_DIM
+
+    // The last iterate might reside in the temporary buffer
+    if(y_old != y)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(y, y_old, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+    }
+
+    *sweeps = sweep;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csritsv_solve_template(rocsparse_handle          handle,
+                                                  rocsparse_operation       trans,
+                                                  J                         m,
+                                                  I                         nnz,
+                                                  const T*                  alpha_device_host,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const I*                  csr_row_ptr,
+                                                  const J*                  csr_col_ind,
+                                                  rocsparse_mat_info        info,
+                                                  const T*                  x,
+                                                  T*                        y,
+                                                  rocsparse_int*            sweeps,
+                                                  const floating_data_t<T>* tol,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritsv_solve"),
+              trans,
+              m,
+              nnz,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)x,
+              (const void*&)y,
+              (const void*&)sweeps,
+              (const void*&)tol,
+              (const void*&)temp_buffer);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check sweeps argument
+    if(sweeps == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(*sweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(tol != nullptr && *tol < static_cast<floating_data_t<T>>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        *sweeps = 0;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || alpha_device_host == nullptr || x == nullptr || y == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_col_ind == nullptr && csr_val == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The convergence check reads the residual back to the host after each sweep.
+    // This cannot be captured in graph mode
+    if(tol != nullptr && handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(*sweeps == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csritsv_solve_dispatch(handle,
+                                                m,
+                                                alpha_device_host,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                info,
+                                                x,
+                                                y,
+                                                sweeps,
+                                                tol,
+                                                temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csritsv_solve_dispatch(handle,
+                                                m,
+                                                *alpha_device_host,
+                                                descr,
+                                                csr_val,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                info,
+                                                x,
+                                                y,
+                                                sweeps,
+                                                tol,
+                                                temp_buffer);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_operation       trans,       \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     size_t*                   buffer_size) \
+    {                                                                       \
+        return rocsparse_csritsv_buffer_size_template(handle,               \
+                                                      trans,                \
+                                                      m,                    \
+                                                      nnz,                  \
+                                                      descr,                \
+                                                      csr_val,              \
+                                                      csr_row_ptr,          \
+                                                      csr_col_ind,          \
+                                                      info,                 \
+                                                      buffer_size);         \
+    }
+
+C_IMPL(rocsparse_scsritsv_buffer_size, float);
+C_IMPL(rocsparse_dcsritsv_buffer_size, double);
+C_IMPL(rocsparse_ccsritsv_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsritsv_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, TYPE2)                                           \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_operation       trans,       \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const TYPE*               alpha,       \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     const TYPE*               x,           \
+                                     TYPE*                     y,           \
+                                     rocsparse_int*            sweeps,      \
+                                     const TYPE2*              tol,         \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csritsv_solve_template(handle,                     \
+                                                trans,                      \
+                                                m,                          \
+                                                nnz,                        \
+                                                alpha,                      \
+                                                descr,                      \
+                                                csr_val,                    \
+                                                csr_row_ptr,                \
+                                                csr_col_ind,                \
+                                                info,                       \
+                                                x,                          \
+                                                y,                          \
+                                                sweeps,                     \
+                                                tol,                        \
+                                                temp_buffer);               \
+    }
+
+C_IMPL(rocsparse_scsritsv_solve, float, float);
+C_IMPL(rocsparse_dcsritsv_solve, double, double);
+C_IMPL(rocsparse_ccsritsv_solve, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsritsv_solve, rocsparse_double_complex, double);
+
+#undef C_IMPL
@@ -27,9 +27,15 @@
 #include "definitions.h"
 #include "utility.h"
 
+#include "../conversion/rocsparse_coo2csr.hpp"
+#include "../conversion/rocsparse_csr2coo.hpp"
+#include "../conversion/rocsparse_identity.hpp"
+#include "../level1/rocsparse_gthr.hpp"
 #include "csrmv_device.h"
 #include "csrmv_symm_device.h"
 
+#include <rocprim/rocprim.hpp>
+
 #define BLOCK_SIZE 1024
 #define BLOCK_MULTIPLIER 3
 #define ROWS_FOR_VECTOR 1
@@ -47,10 +53,39 @@
                                                        y,                 \
                                                        descr->base)
 
+#define LAUNCH_CSRMVN_GENERAL_POLY(wfsize)                          \
+    csrmvn_general_poly_kernel<CSRMVN_DIM, wfsize>                  \
+        <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(m,           \
+                                                       alpha,       \
+                                                       csr_row_ptr, \
+                                                       csr_col_ind, \
+                                                       csr_val,     \
+                                                       v,           \
+                                                       beta,        \
+                                                       gamma,       \
+                                                       delta,       \
+                                                       x,           \
+                                                       y,           \
+                                                       descr->base)
+
 #define LAUNCH_CSRMVT(wfsize)                                                                \
     csrmvt_general_kernel<CSRMVT_DIM, wfsize><<<csrmvt_blocks, csrmvt_threads, 0, stream>>>( \
         trans, m, alpha_device_host, csr_row_ptr, csr_col_ind, csr_val, x, y, descr->base)
 
+#define LAUNCH_CSRMVT_GATHER(wfsize)                                           \
+    csrmvt_gather_kernel<CSRMVT_DIM, wfsize>                                   \
+        <<<csrmvt_blocks, csrmvt_threads, 0, stream>>>(trans,                  \
+                                                       n,                      \
+                                                       alpha_device_host,      \
+                                                       (const I*)trmv_col_ptr, \
+                                                       (const J*)trmv_row_ind, \
+                                                       (const I*)trmv_perm,    \
+                                                       csr_val,                \
+                                                       x,                      \
+                                                       beta_device_host,       \
+                                                       y,                      \
+                                                       descr->base)
+
 #define LAUNCH_CSRMVN_SYMM_GENERAL(wfsize)                                \
     csrmvn_symm_general_kernel<CSRMV_SYMM_DIM, wfsize>                    \
         <<<csrmvn_blocks, csrmvn_threads, 0, stream>>>(trans,             \
@@ -339,6 +374,101 @@ static inline void ComputeRowBlocks(I*       rowBlocks,
     }
 }
 
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrmv_analysis_transpose(rocsparse_handle          handle,
+                                                           J                         m,
+                                                           J                         n,
+                                                           I                         nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const I*                  csr_row_ptr,
+                                                           const J*                  csr_col_ind,
+                                                           rocsparse_csrmv_info      info)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Allocate memory to hold the transposed structure
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmv_col_ptr, sizeof(I) * (n + 1)));
+
+    if(nnz == 0)
+    {
+        hipLaunchKernelGGL((set_array_to_value<256, J, I>),
+                           dim3(n / 256 + 1),
+                           dim3(256),
+                           0,
+                           stream,
+                           (n + 1),
+                           (I*)info->trmv_col_ptr,
+                           static_cast<I>(descr->base));
+
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmv_perm, sizeof(I) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmv_row_ind, sizeof(J) * nnz));
+
+    // Temporary work arrays
+    J* tmp_work1;
+    I* tmp_work2;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_work1, sizeof(J) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&tmp_work2, sizeof(I) * nnz));
+
+    // Load CSR column indices into work1 buffer
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(tmp_work1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    // Create identity permutation
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_create_identity_permutation_template(handle, nnz, (I*)info->trmv_perm));
+
+    // Stable sort COO by columns
+    rocprim::double_buffer<J> keys(tmp_work1, (J*)info->trmv_row_ind);
+    rocprim::double_buffer<I> vals((I*)info->trmv_perm, tmp_work2);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(n);
+
+    size_t rocprim_size;
+    void*  rocprim_buffer;
+
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        rocprim_buffer, rocprim_size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+
+    // Copy permutation vector, if not already available
+    if(vals.current() != info->trmv_perm)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            info->trmv_perm, vals.current(), sizeof(I) * nnz, hipMemcpyDeviceToDevice, stream));
+    }
+
+    // Create column pointers
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coo2csr_template(
+        handle, keys.current(), nnz, n, (I*)info->trmv_col_ptr, descr->base));
+
+    // Create row indices
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, m, tmp_work1, descr->base));
+
+    // Permute row indices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(handle,
+                                                      nnz,
+                                                      tmp_work1,
+                                                      (J*)info->trmv_row_ind,
+                                                      (const I*)info->trmv_perm,
+                                                      rocsparse_index_base_zero));
+
+    // Free temporary work arrays, hipFree synchronizes the device
+    RETURN_IF_HIP_ERROR(hipFree(tmp_work1));
+    RETURN_IF_HIP_ERROR(hipFree(tmp_work2));
+
+    return rocsparse_status_success;
+}
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -467,6 +597,14 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle          han
         info->csrmv_info->max_rows = maxRowsInABlock(row_blocks.data(), info->csrmv_info->size);
     }
 
+    // For transposed products on non-symmetric matrices, build the CSC structure
+    // so that csrmv can gather instead of scattering with atomics
+    if(trans != rocsparse_operation_none && descr->type != rocsparse_matrix_type_symmetric)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_analysis_transpose(
+            handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info->csrmv_info));
+    }
+
     // Allocate memory on device to hold csrmv info, if required
     if(info->csrmv_info->size > 0)
     {
@@ -531,11 +669,44 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
     auto beta  = load_scalar_device_host(beta_device_host);
     if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
     {
-        csrmvn_general_device<BLOCKSIZE, WF_SIZE>(
-            m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+        csrmvn_general_device<BLOCKSIZE, WF_SIZE>(m,
+                                                  alpha,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  x,
+                                                  y,
+                                                  idx_base,
+                                                  csrmv_beta_epilogue<T>{beta, y});
     }
 }
 
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmvn_general_poly_kernel(J m,
+                                    T alpha,
+                                    const I* __restrict__ csr_row_ptr,
+                                    const J* __restrict__ csr_col_ind,
+                                    const T* __restrict__ csr_val,
+                                    const T* __restrict__ v,
+                                    T beta,
+                                    T gamma,
+                                    T delta,
+                                    const T* __restrict__ x,
+                                    T* __restrict__ y,
+                                    rocsparse_index_base idx_base)
+{
+    csrmvn_general_device<BLOCKSIZE, WF_SIZE>(m,
+                                              alpha,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val,
+                                              v,
+                                              y,
+                                              idx_base,
+                                              csrmv_poly_epilogue<T>{beta, gamma, delta, x, v, y});
+}
+
 template <unsigned int BLOCKSIZE, typename J, typename T, typename U>
 __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
     void csrmvt_scale_kernel(J size, U scalar_device_host, T* __restrict__ data)
@@ -569,6 +740,43 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
     }
 }
 
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmvt_gather_kernel(rocsparse_operation trans,
+                              J                   n,
+                              U                   alpha_device_host,
+                              const I* __restrict__ csc_col_ptr,
+                              const J* __restrict__ csc_row_ind,
+                              const I* __restrict__ csc_perm,
+                              const T* __restrict__ csr_val,
+                              const T* __restrict__ x,
+                              U beta_device_host,
+                              T* __restrict__ y,
+                              rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        csrmvt_gather_device<BLOCKSIZE, WF_SIZE>(trans,
+                                                 n,
+                                                 alpha,
+                                                 csc_col_ptr,
+                                                 csc_row_ind,
+                                                 csc_perm,
+                                                 csr_val,
+                                                 x,
+                                                 beta,
+                                                 y,
+                                                 idx_base);
+    }
+}
+
 template <unsigned int BLOCKSIZE,
           unsigned int WF_SIZE,
           typename I,
@@ -640,21 +848,55 @@ __launch_bounds__(WG_SIZE) ROCSPARSE_KERNEL
     auto beta  = load_scalar_device_host(beta_device_host);
     if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
     {
-        csrmvn_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(nnz,
-                                                                                       row_blocks,
-                                                                                       wg_flags,
-                                                                                       wg_ids,
-                                                                                       alpha,
-                                                                                       csr_row_ptr,
-                                                                                       csr_col_ind,
-                                                                                       csr_val,
-                                                                                       x,
-                                                                                       beta,
-                                                                                       y,
-                                                                                       idx_base);
+        csrmvn_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+            nnz,
+            row_blocks,
+            wg_flags,
+            wg_ids,
+            alpha,
+            csr_row_ptr,
+            csr_col_ind,
+            csr_val,
+            x,
+            y,
+            idx_base,
+            csrmv_beta_epilogue<T>{beta, y});
     }
 }
 
+template <typename I, typename J, typename T>
+__launch_bounds__(WG_SIZE) ROCSPARSE_KERNEL
+    void csrmvn_adaptive_poly_kernel(I nnz,
+                                     const I* __restrict__ row_blocks,
+                                     unsigned int* __restrict__ wg_flags,
+                                     const J* __restrict__ wg_ids,
+                                     T alpha,
+                                     const I* __restrict__ csr_row_ptr,
+                                     const J* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     const T* __restrict__ v,
+                                     T beta,
+                                     T gamma,
+                                     T delta,
+                                     const T* __restrict__ x,
+                                     T* __restrict__ y,
+                                     rocsparse_index_base idx_base)
+{
+    csrmvn_adaptive_device<BLOCK_SIZE, BLOCK_MULTIPLIER, ROWS_FOR_VECTOR, WG_SIZE>(
+        nnz,
+        row_blocks,
+        wg_flags,
+        wg_ids,
+        alpha,
+        csr_row_ptr,
+        csr_col_ind,
+        csr_val,
+        v,
+        y,
+        idx_base,
+        csrmv_poly_epilogue<T>{beta, gamma, delta, x, v, y});
+}
+
 template <rocsparse_int MAX_ROWS, typename I, typename J, typename T, typename U>
 __launch_bounds__(WG_SIZE) ROCSPARSE_KERNEL
     void csrmvn_symm_adaptive_kernel(I nnz,
@@ -1059,6 +1301,147 @@ rocsparse_status rocsparse_csrmv_adaptive_template_dispatch(rocsparse_handle
     return rocsparse_status_success;
 }
 
+template <typename I, typename J, typename T, typename U>
+rocsparse_status rocsparse_csrmv_transpose_template_dispatch(rocsparse_handle    handle,
+                                                             rocsparse_operation trans,
+                                                             J                   m,
+                                                             J                   n,
+                                                             I                   nnz,
+                                                             U                   alpha_device_host,
+                                                             const rocsparse_mat_descr descr,
+                                                             const T*                  csr_val,
+                                                             const I*                  csr_row_ptr,
+                                                             const J*                  csr_col_ind,
+                                                             rocsparse_csrmv_info      info,
+                                                             const T*                  x,
+                                                             U  beta_device_host,
+                                                             T* y)
+{
+    // Check if info matches current matrix and options
+    if(info->trans == rocsparse_operation_none)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(info->m != m || info->n != n || info->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if(info->descr != descr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(info->csr_row_ptr != csr_row_ptr || info->csr_col_ind != csr_col_ind)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Transposed structure
+    const void* trmv_col_ptr = info->trmv_col_ptr;
+    const void* trmv_row_ind = info->trmv_row_ind;
+    const void* trmv_perm    = info->trmv_perm;
+
+    // Average nnz per column
+    I nnz_per_col = nnz / n;
+
+#define CSRMVT_DIM 512
+    dim3 csrmvt_blocks((n - 1) / CSRMVT_DIM + 1);
+    dim3 csrmvt_threads(CSRMVT_DIM);
+
+    if(nnz_per_col < 4)
+    {
+        LAUNCH_CSRMVT_GATHER(2);
+    }
+    else if(nnz_per_col < 8)
+    {
+        LAUNCH_CSRMVT_GATHER(4);
+    }
+    else if(nnz_per_col < 16)
+    {
+        LAUNCH_CSRMVT_GATHER(8);
+    }
+    else if(nnz_per_col < 32)
+    {
+        LAUNCH_CSRMVT_GATHER(16);
+    }
+    else if(nnz_per_col < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVT_GATHER(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVT_GATHER(64);
+    }
+#undef CSRMVT_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T, typename U>
+static rocsparse_status
+    rocsparse_csrmv_transpose_deterministic_dispatch(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     J                         m,
+                                                     J                         n,
+                                                     I                         nnz,
+                                                     U                         alpha_device_host,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const I*                  csr_row_ptr,
+                                                     const J*                  csr_col_ind,
+                                                     const T*                  x,
+                                                     U                         beta_device_host,
+                                                     T*                        y)
+{
+    // The temporary transposed structure cannot be allocated in graph mode,
+    // rocsparse_csrmv_analysis() has to be called beforehand instead
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Build a temporary transposed structure, such that the atomic-free
+    // csrmvt can be used without prior analysis
+    rocsparse_csrmv_info info;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info));
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_analysis_transpose(
+        handle, m, n, nnz, descr, csr_row_ptr, csr_col_ind, info));
+
+    info->trans       = trans;
+    info->m           = m;
+    info->n           = n;
+    info->nnz         = nnz;
+    info->descr       = descr;
+    info->csr_row_ptr = csr_row_ptr;
+    info->csr_col_ind = csr_col_ind;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_transpose_template_dispatch(handle,
+                                                                          trans,
+                                                                          m,
+                                                                          n,
+                                                                          nnz,
+                                                                          alpha_device_host,
+                                                                          descr,
+                                                                          csr_val,
+                                                                          csr_row_ptr,
+                                                                          csr_col_ind,
+                                                                          info,
+                                                                          x,
+                                                                          beta_device_host,
+                                                                          y));
+
+    // Destroying the info frees the transposed structure and synchronizes the device
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info));
+
+    return rocsparse_status_success;
+}
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           rocsparse_operation       trans,
@@ -1207,7 +1590,84 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
         return rocsparse_status_success;
     }
 
-    if(info == nullptr || info->csrmv_info == nullptr || trans != rocsparse_operation_none)
+    if(info != nullptr && info->csrmv_info != nullptr && trans != rocsparse_operation_none
+       && info->csrmv_info->trmv_col_ptr != nullptr)
+    {
+        // If the transposed structure is available, call atomic-free csrmvt
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return rocsparse_csrmv_transpose_template_dispatch(handle,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               alpha_device_host,
+                                                               descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               info->csrmv_info,
+                                                               x,
+                                                               beta_device_host,
+                                                               y);
+        }
+        else
+        {
+            return rocsparse_csrmv_transpose_template_dispatch(handle,
+                                                               trans,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               *alpha_device_host,
+                                                               descr,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               info->csrmv_info,
+                                                               x,
+                                                               *beta_device_host,
+                                                               y);
+        }
+    }
+    else if(trans != rocsparse_operation_none
+            && descr->type != rocsparse_matrix_type_symmetric
+            && handle->deterministic_mode == rocsparse_deterministic_mode_enabled)
+    {
+        // Deterministic mode, avoid the atomics of csrmv general
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            return rocsparse_csrmv_transpose_deterministic_dispatch(handle,
+                                                                    trans,
+                                                                    m,
+                                                                    n,
+                                                                    nnz,
+                                                                    alpha_device_host,
+                                                                    descr,
+                                                                    csr_val,
+                                                                    csr_row_ptr,
+                                                                    csr_col_ind,
+                                                                    x,
+                                                                    beta_device_host,
+                                                                    y);
+        }
+        else
+        {
+            return rocsparse_csrmv_transpose_deterministic_dispatch(handle,
+                                                                    trans,
+                                                                    m,
+                                                                    n,
+                                                                    nnz,
+                                                                    *alpha_device_host,
+                                                                    descr,
+                                                                    csr_val,
+                                                                    csr_row_ptr,
+                                                                    csr_col_ind,
+                                                                    x,
+                                                                    *beta_device_host,
+                                                                    y);
+        }
+    }
+    else if(info == nullptr || info->csrmv_info == nullptr || trans != rocsparse_operation_none)
     {
         // If csrmv info is not available, call csrmv general
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
@@ -1283,6 +1743,91 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
     }
 }
 
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_poly_step_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    rocsparse_csrmv_info      info,
+                                                    T                         alpha,
+                                                    const T*                  v,
+                                                    T                         beta,
+                                                    T                         gamma,
+                                                    T                         delta,
+                                                    const T*                  x,
+                                                    T*                        y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Re-use the csrmv adaptive row blocks, if they have been computed for this matrix
+    if(info != nullptr && info->trans == rocsparse_operation_none && info->m == m && info->n == m
+       && info->nnz == nnz && info->descr == descr && info->csr_row_ptr == csr_row_ptr
+       && info->csr_col_ind == csr_col_ind)
+    {
+        hipLaunchKernelGGL((csrmvn_adaptive_poly_kernel),
+                           dim3(info->size - 1),
+                           dim3(WG_SIZE),
+                           0,
+                           stream,
+                           nnz,
+                           static_cast<I*>(info->row_blocks),
+                           info->wg_flags,
+                           static_cast<J*>(info->wg_ids),
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           v,
+                           beta,
+                           gamma,
+                           delta,
+                           x,
+                           y,
+                           descr->base);
+
+        return rocsparse_status_success;
+    }
+
+    // Average nnz per row
+    J nnz_per_row = nnz / m;
+
+#define CSRMVN_DIM 512
+    dim3 csrmvn_blocks((m - 1) / CSRMVN_DIM + 1);
+    dim3 csrmvn_threads(CSRMVN_DIM);
+
+    if(nnz_per_row < 4)
+    {
+        LAUNCH_CSRMVN_GENERAL_POLY(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        LAUNCH_CSRMVN_GENERAL_POLY(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        LAUNCH_CSRMVN_GENERAL_POLY(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        LAUNCH_CSRMVN_GENERAL_POLY(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        LAUNCH_CSRMVN_GENERAL_POLY(32);
+    }
+    else
+    {
+        LAUNCH_CSRMVN_GENERAL_POLY(64);
+    }
+#undef CSRMVN_DIM
+
+    return rocsparse_status_success;
+}
+
 #define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                              \
     template rocsparse_status rocsparse_csrmv_analysis_template<ITYPE, JTYPE, TTYPE>( \
         rocsparse_handle          handle,                                             \
@@ -1325,6 +1870,30 @@ INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
 #undef INSTANTIATE
 
+#define INSTANTIATE(TTYPE)                                        \
+    template rocsparse_status rocsparse_csrmv_poly_step_template( \
+        rocsparse_handle          handle,                         \
+        rocsparse_int             m,                              \
+        rocsparse_int             nnz,                            \
+        const rocsparse_mat_descr descr,                          \
+        const TTYPE*              csr_val,                        \
+        const rocsparse_int*      csr_row_ptr,                    \
+        const rocsparse_int*      csr_col_ind,                    \
+        rocsparse_csrmv_info      info,                           \
+        TTYPE                     alpha,                          \
+        const TTYPE*              v,                              \
+        TTYPE                     beta,                           \
+        TTYPE                     gamma,                          \
+        TTYPE                     delta,                          \
+        const TTYPE*              x,                              \
+        TTYPE*                    y);
+
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
+#undef INSTANTIATE
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -71,4 +71,23 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle          handle,
                                           const T*                  beta,
                                           T*                        y);
 
+// Fused polynomial step y := alpha * A * v + beta * y + gamma * x + delta * v, using the
+// csrmv adaptive row blocks, if info has been obtained for the same matrix
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrmv_poly_step_template(rocsparse_handle          handle,
+                                                    J                         m,
+                                                    I                         nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const I*                  csr_row_ptr,
+                                                    const J*                  csr_col_ind,
+                                                    rocsparse_csrmv_info      info,
+                                                    T                         alpha,
+                                                    const T*                  v,
+                                                    T                         beta,
+                                                    T                         gamma,
+                                                    T                         delta,
+                                                    const T*                  x,
+                                                    T*                        y);
+
 #endif // ROCSPARSE_CSRMV_HPP
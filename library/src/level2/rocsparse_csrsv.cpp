@@ -23,6 +23,7 @@
  * ************************************************************************ */
 
 #include "rocsparse_csrsv.hpp"
+#include "common.h"
 #include "definitions.h"
 #include "utility.h"
 
@@ -69,6 +70,25 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
         return rocsparse_status_success;
     }
 
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -162,3 +182,68 @@ extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          hand
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_csrsv_level_info(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       const rocsparse_mat_descr descr,
+                                                       rocsparse_mat_info        info,
+                                                       int64_t*                  nlevels,
+                                                       int64_t*                  max_width,
+                                                       int64_t*                  critical_path)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsv_level_info",
+              trans,
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)nlevels,
+              (const void*&)max_width,
+              (const void*&)critical_path);
+
+    // Check operation type
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose
+       && trans != rocsparse_operation_conjugate_transpose)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check pointer arguments
+    if(nlevels == nullptr || max_width == nullptr || critical_path == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_trm_info csrsv
+        = (descr->fill_mode == rocsparse_fill_mode_upper)
+              ? ((trans == rocsparse_operation_none) ? info->csrsv_upper_info
+                                                     : info->csrsvt_upper_info)
+              : ((trans == rocsparse_operation_none) ? info->csrsv_lower_info
+                                                     : info->csrsvt_lower_info);
+
+    // Analysis has not been performed
+    if(csrsv == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *nlevels       = csrsv->nlevels;
+    *max_width     = csrsv->max_width;
+    *critical_path = csrsv->critical_path;
+
+    return rocsparse_status_success;
+}
@@ -32,6 +32,11 @@
 #include "utility.h"
 #include <rocprim/rocprim.hpp>
 
+#include <vector>
+
+// Maximum number of rows of a supernode
+#define CSRSV_SUPERNODE_MAX_WIDTH 32
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         rocsparse_operation       trans,
@@ -145,11 +150,14 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
     // Initialize temporary buffer with 0
-    size_t buffer_size = 256 + sizeof(int) * ((m - 1) / 256 + 1) * 256;
+    size_t buffer_size = 256 + (sizeof(int) * 2 + sizeof(J)) * ((m - 1) / 256 + 1) * 256;
     RETURN_IF_HIP_ERROR(hipMemsetAsync(ptr, 0, sizeof(char) * buffer_size, stream));
 
     // max_nnz
     I* d_max_nnz = reinterpret_cast<I*>(ptr);
+
+    // number of levels
+    int* d_nlevels = reinterpret_cast<int*>(ptr + 128);
     ptr += 256;
 
     // done array
@@ -446,33 +454,147 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     }
 #undef CSRSV_DIM
 
-    // Post processing
+    // Post processing, the matrix that is processed by the solve is the transposed matrix
+    // with swapped fill mode, if analyzing transposed
+    const I* local_csr_row_ptr = csr_row_ptr;
+    const J* local_csr_col_ind = csr_col_ind;
+
+    rocsparse_fill_mode fill_mode = descr->fill_mode;
+
+    if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
+    {
+        local_csr_row_ptr = (const I*)info->trmt_row_ptr;
+        local_csr_col_ind = (const J*)info->trmt_col_ind;
+
+        fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
+                                                             : rocsparse_fill_mode_lower;
+    }
+
+    // Determine the size and the maximum row length of each level. The rows are then
+    // grouped by their level using a counting sort, which avoids sorting the depths.
+#define CSRSV_DIM 256
+    dim3 level_blocks((m - 1) / CSRSV_DIM + 1);
+    dim3 level_threads(CSRSV_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csrsv_analysis_level_count_kernel<CSRSV_DIM, 32>),
+                           level_blocks,
+                           level_threads,
+                           0,
+                           stream,
+                           m,
+                           local_csr_row_ptr,
+                           done_array,
+                           workspace,
+                           workspace2,
+                           d_nlevels);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csrsv_analysis_level_count_kernel<CSRSV_DIM, 64>),
+                           level_blocks,
+                           level_threads,
+                           0,
+                           stream,
+                           m,
+                           local_csr_row_ptr,
+                           done_array,
+                           workspace,
+                           workspace2,
+                           d_nlevels);
+    }
+
+    int nlevels;
     RETURN_IF_HIP_ERROR(
         hipMemcpyAsync(&info->max_nnz, d_max_nnz, sizeof(I), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&nlevels, d_nlevels, sizeof(int), hipMemcpyDeviceToHost, stream));
 
     // Wait for host transfer to finish
     RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation_template(handle, m, workspace));
-
+    // Level sizes and maximum row lengths for the level statistics, that are processed on
+    // the host once the row map has been built
+    std::vector<J>   level_size(nlevels);
+    std::vector<int> level_max_nnz(nlevels);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        level_size.data(), workspace, sizeof(J) * nlevels, hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(level_max_nnz.data(),
+                                       workspace2,
+                                       sizeof(int) * nlevels,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Exclusive scan of the level sizes on the device, to obtain the start of each level
     size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                workspace,
+                                                workspace,
+                                                static_cast<J>(0),
+                                                nlevels,
+                                                rocprim::plus<J>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                workspace,
+                                                workspace,
+                                                static_cast<J>(0),
+                                                nlevels,
+                                                rocprim::plus<J>(),
+                                                stream));
+
+    // Scatter the rows into the row map, using the level starts as insertion cursor
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csrsv_analysis_level_scatter_kernel<CSRSV_DIM, 32>),
+                           level_blocks,
+                           level_threads,
+                           0,
+                           stream,
+                           m,
+                           done_array,
+                           workspace,
+                           (J*)info->row_map);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csrsv_analysis_level_scatter_kernel<CSRSV_DIM, 64>),
+                           level_blocks,
+                           level_threads,
+                           0,
+                           stream,
+                           m,
+                           done_array,
+                           workspace,
+                           (J*)info->row_map);
+    }
+#undef CSRSV_DIM
 
-    unsigned int startbit = 0;
-    unsigned int endbit   = rocsparse_clz(m);
-
-    rocprim::double_buffer<int> keys(done_array, workspace2);
-    rocprim::double_buffer<J>   vals(workspace, (J*)info->row_map);
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
 
-    RETURN_IF_HIP_ERROR(
-        rocprim::radix_sort_pairs(nullptr, rocprim_size, keys, vals, m, startbit, endbit, stream));
+    info->nlevels       = nlevels;
+    info->max_width     = 0;
+    info->critical_path = 0;
+    info->level_ptr.resize(nlevels + 1);
 
-    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-        rocprim_buffer, rocprim_size, keys, vals, m, startbit, endbit, stream));
+    // Level starts and statistics
+    info->level_ptr[0] = 0;
 
-    if(vals.current() != info->row_map)
+    for(int i = 0; i < nlevels; ++i)
     {
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            info->row_map, vals.current(), sizeof(J) * m, hipMemcpyDeviceToDevice, stream));
+        info->max_width = std::max(info->max_width, static_cast<int64_t>(level_size[i]));
+        info->critical_path += level_max_nnz[i];
+
+        info->level_ptr[i + 1] = info->level_ptr[i] + level_size[i];
     }
 
     // Store some pointers to verify correct execution
@@ -485,6 +607,90 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+// Detect supernodes on the matrix that is processed by the solve, i.e. the transposed
+// matrix with swapped fill mode, if analyzed transposed. Supernodes are only used by the
+// sync-free csrsv solve, thus this is not part of the triangular analysis that is shared
+// with the other routines.
+template <typename I, typename J>
+static rocsparse_status rocsparse_csrsv_analysis_supernodes(rocsparse_handle          handle,
+                                                            rocsparse_operation       trans,
+                                                            J                         m,
+                                                            const rocsparse_mat_descr descr,
+                                                            rocsparse_trm_info        info,
+                                                            void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_fill_mode fill_mode = descr->fill_mode;
+
+    if(trans == rocsparse_operation_transpose || trans == rocsparse_operation_conjugate_transpose)
+    {
+        fill_mode = (fill_mode == rocsparse_fill_mode_lower) ? rocsparse_fill_mode_upper
+                                                             : rocsparse_fill_mode_lower;
+    }
+
+    // Use the workspace of the analysis, to hold the merge flag of each row
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+    ptr += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    J* merge_flag = reinterpret_cast<J*>(ptr);
+
+#define CSRSV_DIM 256
+    hipLaunchKernelGGL((csrsv_analysis_supernode_kernel<CSRSV_DIM>),
+                       dim3((m - 1) / CSRSV_DIM + 1),
+                       dim3(CSRSV_DIM),
+                       0,
+                       stream,
+                       m,
+                       (const I*)info->trm_row_ptr,
+                       (const J*)info->trm_col_ind,
+                       (const I*)info->trm_diag_ind,
+                       merge_flag,
+                       descr->base,
+                       fill_mode);
+#undef CSRSV_DIM
+
+    std::vector<J> merge(m);
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(merge.data(), merge_flag, sizeof(J) * m, hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Group the rows into supernodes, where the width of a supernode is limited by the
+    // smallest supported wavefront size, such that each lane of a wavefront holds one row
+    // of the supernode
+    std::vector<J> supernode_ptr(1, 0);
+
+    for(J i = 1; i < m; ++i)
+    {
+        if(merge[i] == 0 || i - supernode_ptr.back() >= CSRSV_SUPERNODE_MAX_WIDTH)
+        {
+            supernode_ptr.push_back(i);
+        }
+    }
+
+    supernode_ptr.push_back(m);
+
+    info->nsupernodes = supernode_ptr.size() - 1;
+
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->supernode_ptr, sizeof(J) * supernode_ptr.size()));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->supernode_ptr,
+                                       supernode_ptr.data(),
+                                       sizeof(J) * supernode_ptr.size(),
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    // Wait for device transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+#undef CSRSV_SUPERNODE_MAX_WIDTH
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -656,6 +862,19 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             (trans == rocsparse_operation_none) ? info->csrsv_upper_info : info->csrsvt_upper_info,
             (J**)&info->zero_pivot,
             temp_buffer));
+
+        // Detect supernodes, unless the level set solve is requested
+        if(solve != rocsparse_solve_policy_level_set)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_analysis_supernodes<I>(
+                handle,
+                trans,
+                m,
+                descr,
+                (trans == rocsparse_operation_none) ? info->csrsv_upper_info
+                                                    : info->csrsvt_upper_info,
+                temp_buffer));
+        }
     }
     else
     {
@@ -695,6 +914,12 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                 info->csrsv_lower_info = info->csric0_info;
                 return rocsparse_status_success;
             }
+            else if(trans == rocsparse_operation_none && info->csrildl0_info != nullptr)
+            {
+                // csrildl0 meta data
+                info->csrsv_lower_info = info->csrildl0_info;
+                return rocsparse_status_success;
+            }
             else if(trans == rocsparse_operation_none && info->csrsm_lower_info != nullptr)
             {
                 // csrsm meta data
@@ -742,6 +967,19 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
             (trans == rocsparse_operation_none) ? info->csrsv_lower_info : info->csrsvt_lower_info,
             (J**)&info->zero_pivot,
             temp_buffer));
+
+        // Detect supernodes, unless the level set solve is requested
+        if(solve != rocsparse_solve_policy_level_set)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_analysis_supernodes<I>(
+                handle,
+                trans,
+                m,
+                descr,
+                (trans == rocsparse_operation_none) ? info->csrsv_lower_info
+                                                    : info->csrsvt_lower_info,
+                temp_buffer));
+        }
     }
 
     return rocsparse_status_success;
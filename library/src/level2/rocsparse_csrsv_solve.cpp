@@ -69,6 +69,85 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void csrsv_kernel(J m,
                                             diag_type);
 }
 
+template <unsigned int BLOCKSIZE,
+          unsigned int WF_SIZE,
+          bool         SLEEP,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrsv_supernode_kernel(J nsupernodes,
+                                U alpha_device_host,
+                                const I* __restrict__ csr_row_ptr,
+                                const J* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                const I* __restrict__ csr_diag_ind,
+                                const J* __restrict__ supernode_ptr,
+                                const T* __restrict__ x,
+                                T* __restrict__ y,
+                                int* __restrict__ done_array,
+                                J* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base,
+                                rocsparse_fill_mode  fill_mode,
+                                rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_supernode_device<BLOCKSIZE, WF_SIZE, SLEEP>(nsupernodes,
+                                                      alpha,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      csr_val,
+                                                      csr_diag_ind,
+                                                      supernode_ptr,
+                                                      x,
+                                                      y,
+                                                      done_array,
+                                                      zero_pivot,
+                                                      idx_base,
+                                                      fill_mode,
+                                                      diag_type);
+}
+
+// Level scheduling requires a kernel launch per level, but no row has to wait for its
+// dependencies. It is chosen, if the number of levels is small enough to amortize the
+// launches, and if the average level is wide enough to occupy all compute units.
+#define CSRSV_LEVEL_SET_MAX_LEVELS 512
+#define CSRSV_LEVEL_SET_MIN_WIDTH 16
+
+static inline bool rocsparse_csrsv_use_level_set(rocsparse_handle       handle,
+                                                 rocsparse_trm_info     info,
+                                                 rocsparse_solve_policy policy)
+{
+    if(policy == rocsparse_solve_policy_level_set)
+    {
+        return true;
+    }
+
+    if(policy == rocsparse_solve_policy_sync_free || info->nlevels == 0)
+    {
+        return false;
+    }
+
+    return info->nlevels <= CSRSV_LEVEL_SET_MAX_LEVELS
+           && info->m / info->nlevels
+                  >= CSRSV_LEVEL_SET_MIN_WIDTH * handle->properties.multiProcessorCount;
+}
+
+#undef CSRSV_LEVEL_SET_MIN_WIDTH
+#undef CSRSV_LEVEL_SET_MAX_LEVELS
+
+// The supernodal solve is chosen, if the supernodes are wide enough on average, such
+// that waiting for shared dependencies and the dense block operations pay off.
+#define CSRSV_SUPERNODE_MIN_WIDTH 2
+
+static inline bool rocsparse_csrsv_use_supernodes(rocsparse_trm_info info)
+{
+    return info->nsupernodes > 0 && info->m >= CSRSV_SUPERNODE_MIN_WIDTH * info->nsupernodes;
+}
+
+#undef CSRSV_SUPERNODE_MIN_WIDTH
+
 template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
@@ -115,12 +194,15 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        J max = std::numeric_limits<J>::max();
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(info->zero_pivot, &max, sizeof(J), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        // Initialize on the device, such that no host synchronization is required
+        hipLaunchKernelGGL((set_array_to_value<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           1,
+                           (J*)info->zero_pivot,
+                           std::numeric_limits<J>::max());
     }
 
     // Pointers to differentiate between transpose mode
@@ -160,10 +242,164 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                                              : rocsparse_fill_mode_lower;
     }
 
+    // Level set solve, where each level is solved by a separate kernel launch. All
+    // dependencies of a level have been resolved by the previous launches, thus no
+    // wavefront is spinning on the done array.
+    if(rocsparse_csrsv_use_level_set(handle, csrsv, policy))
+    {
+#define CSRSV_DIM 1024
+        dim3 csrsv_threads(CSRSV_DIM);
+
+        for(int64_t level = 0; level < csrsv->nlevels; ++level)
+        {
+            J   width  = static_cast<J>(csrsv->level_ptr[level + 1] - csrsv->level_ptr[level]);
+            int offset = static_cast<int>(csrsv->level_ptr[level]);
+
+            dim3 csrsv_blocks((handle->wavefront_size * width - 1) / CSRSV_DIM + 1);
+
+            if(handle->wavefront_size == 32)
+            {
+                // LCOV_EXCL_START
+                hipLaunchKernelGGL((csrsv_kernel<CSRSV_DIM, 32, false>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   width,
+                                   alpha_device_host,
+                                   local_csr_row_ptr,
+                                   local_csr_col_ind,
+                                   local_csr_val,
+                                   x,
+                                   y,
+                                   done_array,
+                                   (J*)csrsv->row_map,
+                                   offset,
+                                   (J*)info->zero_pivot,
+                                   descr->base,
+                                   fill_mode,
+                                   descr->diag_type);
+                // LCOV_EXCL_STOP
+            }
+            else
+            {
+                assert(handle->wavefront_size == 64);
+                hipLaunchKernelGGL((csrsv_kernel<CSRSV_DIM, 64, false>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   width,
+                                   alpha_device_host,
+                                   local_csr_row_ptr,
+                                   local_csr_col_ind,
+                                   local_csr_val,
+                                   x,
+                                   y,
+                                   done_array,
+                                   (J*)csrsv->row_map,
+                                   offset,
+                                   (J*)info->zero_pivot,
+                                   descr->base,
+                                   fill_mode,
+                                   descr->diag_type);
+            }
+        }
+#undef CSRSV_DIM
+
+        return rocsparse_status_success;
+    }
+
     // Determine gcnArch
     int gcnArch = handle->properties.gcnArch;
     int asicRev = handle->asic_rev;
 
+    // Supernodal sync-free solve, where each wavefront processes a group of rows that
+    // share their dependencies
+    if(rocsparse_csrsv_use_supernodes(csrsv))
+    {
+#define CSRSV_DIM 1024
+        J nsupernodes = static_cast<J>(csrsv->nsupernodes);
+
+        dim3 csrsv_blocks((handle->wavefront_size * nsupernodes - 1) / CSRSV_DIM + 1);
+        dim3 csrsv_threads(CSRSV_DIM);
+
+        if(gcnArch == 908 && asicRev < 2)
+        {
+            // LCOV_EXCL_START
+            hipLaunchKernelGGL((csrsv_supernode_kernel<CSRSV_DIM, 64, true>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               nsupernodes,
+                               alpha_device_host,
+                               local_csr_row_ptr,
+                               local_csr_col_ind,
+                               local_csr_val,
+                               (const I*)csrsv->trm_diag_ind,
+                               (const J*)csrsv->supernode_ptr,
+                               x,
+                               y,
+                               done_array,
+                               (J*)info->zero_pivot,
+                               descr->base,
+                               fill_mode,
+                               descr->diag_type);
+            // LCOV_EXCL_STOP
+        }
+        else if(handle->wavefront_size == 32)
+        {
+            // LCOV_EXCL_START
+            hipLaunchKernelGGL((csrsv_supernode_kernel<CSRSV_DIM, 32, false>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               nsupernodes,
+                               alpha_device_host,
+                               local_csr_row_ptr,
+                               local_csr_col_ind,
+                               local_csr_val,
+                               (const I*)csrsv->trm_diag_ind,
+                               (const J*)csrsv->supernode_ptr,
+                               x,
+                               y,
+                               done_array,
+                               (J*)info->zero_pivot,
+                               descr->base,
+                               fill_mode,
+                               descr->diag_type);
+            // LCOV_EXCL_STOP
+        }
+        else
+        {
+            assert(handle->wavefront_size == 64);
+            hipLaunchKernelGGL((csrsv_supernode_kernel<CSRSV_DIM, 64, false>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               nsupernodes,
+                               alpha_device_host,
+                               local_csr_row_ptr,
+                               local_csr_col_ind,
+                               local_csr_val,
+                               (const I*)csrsv->trm_diag_ind,
+                               (const J*)csrsv->supernode_ptr,
+                               x,
+                               y,
+                               done_array,
+                               (J*)info->zero_pivot,
+                               descr->base,
+                               fill_mode,
+                               descr->diag_type);
+        }
+#undef CSRSV_DIM
+
+        return rocsparse_status_success;
+    }
+
 #define CSRSV_DIM 1024
     dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
     dim3 csrsv_threads(CSRSV_DIM);
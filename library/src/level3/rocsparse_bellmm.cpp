@@ -46,7 +46,11 @@ rocsparse_status rocsparse_bellmm_template_general(rocsparse_handle          han
                                                    I                         ldb,
                                                    U                         beta,
                                                    T*                        C,
-                                                   I                         ldc);
+                                                   I                         ldc,
+                                                   I                         batch_count,
+                                                   int64_t                   batch_stride_A,
+                                                   int64_t                   batch_stride_B,
+                                                   int64_t                   batch_stride_C);
 
 template <typename T, typename U, typename I>
 rocsparse_status rocsparse_bellmm_template_dispatch(rocsparse_handle          handle,
@@ -68,7 +72,11 @@ rocsparse_status rocsparse_bellmm_template_dispatch(rocsparse_handle          ha
                                                     I                         ldb,
                                                     U                         beta_device_host,
                                                     T*                        C,
-                                                    I                         ldc)
+                                                    I                         ldc,
+                                                    I                         batch_count,
+                                                    int64_t                   batch_stride_A,
+                                                    int64_t                   batch_stride_B,
+                                                    int64_t                   batch_stride_C)
 {
 
     return rocsparse_bellmm_template_general(handle,
@@ -90,7 +98,11 @@ rocsparse_status rocsparse_bellmm_template_dispatch(rocsparse_handle          ha
                                              ldb,
                                              beta_device_host,
                                              C,
-                                             ldc);
+                                             ldc,
+                                             batch_count,
+                                             batch_stride_A,
+                                             batch_stride_B,
+                                             batch_stride_C);
 }
 
 template <typename T, typename I>
@@ -167,6 +179,10 @@ rocsparse_status rocsparse_bellmm_template(rocsparse_handle          handle,
                                            const T*                  beta,
                                            T*                        C,
                                            I                         ldc,
+                                           I                         batch_count,
+                                           int64_t                   batch_stride_A,
+                                           int64_t                   batch_stride_B,
+                                           int64_t                   batch_stride_C,
                                            void*                     temp_buffer)
 {
     // Check for valid handle and matrix descriptor
@@ -234,13 +250,13 @@ rocsparse_status rocsparse_bellmm_template(rocsparse_handle          handle,
     }
 
     // Check sizes
-    if(mb < 0 || n < 0 || kb < 0 || bell_cols < 0 || block_dim <= 0)
+    if(mb < 0 || n < 0 || kb < 0 || bell_cols < 0 || block_dim <= 0 || batch_count < 0)
     {
         return rocsparse_status_invalid_size;
     }
 
     // Quick return if possible
-    if(mb == 0 || n == 0 || kb == 0 || bell_cols == 0)
+    if(mb == 0 || n == 0 || kb == 0 || bell_cols == 0 || batch_count == 0)
     {
         return rocsparse_status_success;
     }
@@ -305,7 +321,11 @@ rocsparse_status rocsparse_bellmm_template(rocsparse_handle          handle,
                                                   ldb,
                                                   beta,
                                                   C,
-                                                  ldc);
+                                                  ldc,
+                                                  batch_count,
+                                                  batch_stride_A,
+                                                  batch_stride_B,
+                                                  batch_stride_C);
     }
     else
     {
@@ -328,7 +348,11 @@ rocsparse_status rocsparse_bellmm_template(rocsparse_handle          handle,
                                                   ldb,
                                                   *beta,
                                                   C,
-                                                  ldc);
+                                                  ldc,
+                                                  batch_count,
+                                                  batch_stride_A,
+                                                  batch_stride_B,
+                                                  batch_stride_C);
     }
 }
 
@@ -397,6 +421,10 @@ rocsparse_status rocsparse_bellmm_template(rocsparse_handle          handle,
                                                         const TTYPE*              beta,           \
                                                         TTYPE*                    C,              \
                                                         ITYPE                     ldc,            \
+                                                        ITYPE                     batch_count,    \
+                                                        int64_t                   batch_stride_A, \
+                                                        int64_t                   batch_stride_B, \
+                                                        int64_t                   batch_stride_C, \
                                                         void*                     temp_buffer)
 
 INSTANTIATE(float, int32_t);
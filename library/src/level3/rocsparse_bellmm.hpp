@@ -100,6 +100,10 @@ rocsparse_status rocsparse_bellmm_template(rocsparse_handle          handle,
                                            const T*                  beta,
                                            T*                        C,
                                            I                         ldc,
+                                           I                         batch_count,
+                                           int64_t                   batch_stride_A,
+                                           int64_t                   batch_stride_B,
+                                           int64_t                   batch_stride_C,
                                            void*                     temp_buffer);
 
 #endif // ROCSPARSE_BELLMM_HPP
@@ -43,13 +43,21 @@ __launch_bounds__(BELL_BLOCK_DIM* BLK_SIZE_Y) ROCSPARSE_KERNEL
                                         I                   block_dim,
                                         const I* __restrict__ bell_col_ind,
                                         const T* __restrict__ bell_val,
+                                        int64_t batch_stride_A,
                                         const T* __restrict__ B,
-                                        I ldb,
-                                        U beta_device_host,
+                                        I       ldb,
+                                        int64_t batch_stride_B,
+                                        U       beta_device_host,
                                         T* __restrict__ C,
                                         I                    ldc,
+                                        int64_t              batch_stride_C,
                                         rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    bell_val += batch_stride_A * hipBlockIdx_z;
+    B        += batch_stride_B * hipBlockIdx_z;
+    C        += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -98,11 +106,15 @@ rocsparse_status rocsparse_bellmm_template_general(rocsparse_handle          han
                                                    I                         ldb,
                                                    U                         beta,
                                                    T*                        C,
-                                                   I                         ldc)
+                                                   I                         ldc,
+                                                   I                         batch_count,
+                                                   int64_t                   batch_stride_A,
+                                                   int64_t                   batch_stride_B,
+                                                   int64_t                   batch_stride_C)
 {
     hipStream_t stream = handle->stream;
     assert(block_dim > 32);
-    dim3 bellmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1);
+    dim3 bellmm_blocks((mb - 1) / 1 + 1, (n - 1) / 32 + 1, batch_count);
     dim3 bellmm_threads(32, 32, 1);
     assert(trans_A == rocsparse_operation_none);
     //
@@ -125,11 +137,14 @@ rocsparse_status rocsparse_bellmm_template_general(rocsparse_handle          han
                        block_dim,
                        bell_col_ind,
                        bell_val,
+                       batch_stride_A,
                        B,
                        ldb,
+                       batch_stride_B,
                        beta,
                        C,
                        ldc,
+                       batch_stride_C,
                        descr->base);
 
     return rocsparse_status_success;
@@ -155,7 +170,11 @@ rocsparse_status rocsparse_bellmm_template_general(rocsparse_handle          han
                                                                 ITYPE        ldb,                   \
                                                                 UTYPE        beta,                  \
                                                                 TTYPE*       C,                     \
-                                                                ITYPE        ldc)
+                                                                ITYPE        ldc,                   \
+                                                                ITYPE        batch_count,           \
+                                                                int64_t      batch_stride_A,        \
+                                                                int64_t      batch_stride_B,        \
+                                                                int64_t      batch_stride_C)
 
 INSTANTIATE(float, float, int32_t);
 INSTANTIATE(float, const float*, int32_t);
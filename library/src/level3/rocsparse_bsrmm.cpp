@@ -165,6 +165,10 @@ rocsparse_status rocsparse_bsrmm_template_dispatch(rocsparse_handle          han
                                                  beta,
                                                  C,
                                                  ldc,
+                                                 (rocsparse_int)1,
+                                                 0,
+                                                 0,
+                                                 0,
                                                  nullptr);
     }
 
@@ -168,12 +168,15 @@ rocsparse_status rocsparse_bsrsm_solve_template_large(rocsparse_handle
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
-            info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        // Initialize on the device, such that no host synchronization is required
+        hipLaunchKernelGGL((set_array_to_value<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           1,
+                           (rocsparse_int*)info->zero_pivot,
+                           std::numeric_limits<rocsparse_int>::max());
     }
 
     rocsparse_fill_mode fill_mode = descr->fill_mode;
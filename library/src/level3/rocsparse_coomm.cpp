@@ -69,8 +69,11 @@ __device__ void coomm_row_scale_device(I m, I n, T beta, T* __restrict__ data, I
 
 template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename T, typename U>
 __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
-    void coomm_row_scale(I m, I n, U beta_device_host, T* __restrict__ data, I ld)
+    void coomm_row_scale(I m, I n, U beta_device_host, T* __restrict__ data, I ld, int64_t stride)
 {
+    // Offset into the current batch
+    data += stride * hipBlockIdx_z;
+
     auto beta = load_scalar_device_host(beta_device_host);
     if(beta != static_cast<T>(1))
     {
@@ -80,8 +83,12 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
 
 template <unsigned int BLOCKSIZE, typename I, typename T, typename U>
 __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
-    void coomm_column_scale(I m, I n, U beta_device_host, T* __restrict__ data, I ld)
+    void coomm_column_scale(
+        I m, I n, U beta_device_host, T* __restrict__ data, I ld, int64_t stride)
 {
+    // Offset into the current batch
+    data += stride * hipBlockIdx_z;
+
     auto beta = load_scalar_device_host(beta_device_host);
     if(beta != static_cast<T>(1))
     {
@@ -124,15 +131,31 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                                    I                         ldb,
                                                    U                         beta_device_host,
                                                    T*                        C,
-                                                   I                         ldc)
+                                                   I                         ldc,
+                                                   I                         batch_count,
+                                                   int64_t                   batch_stride_A,
+                                                   int64_t                   batch_stride_B,
+                                                   int64_t                   batch_stride_C)
 {
+    // In deterministic mode, atomic accumulation is replaced by the segmented reduction
+    if(handle->deterministic_mode == rocsparse_deterministic_mode_enabled)
+    {
+        if(trans_A != rocsparse_operation_none
+           || trans_B == rocsparse_operation_conjugate_transpose)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        alg = rocsparse_coomm_alg_segmented;
+    }
+
     // Scale C with beta
     if(order == rocsparse_order_row)
     {
         if(n >= 256)
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 256>),
-                               dim3((256 * m - 1) / 256 + 1),
+                               dim3((256 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -140,12 +163,13 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
         else if(n >= 128)
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 128>),
-                               dim3((128 * m - 1) / 256 + 1),
+                               dim3((128 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -153,12 +177,13 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
         else if(n >= 64)
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 64>),
-                               dim3((64 * m - 1) / 256 + 1),
+                               dim3((64 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -166,12 +191,13 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
         else if(n >= 32)
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 32>),
-                               dim3((32 * m - 1) / 256 + 1),
+                               dim3((32 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -179,12 +205,13 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
         else if(n >= 16)
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 16>),
-                               dim3((16 * m - 1) / 256 + 1),
+                               dim3((16 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -192,12 +219,13 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
         else if(n >= 8)
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 8>),
-                               dim3((8 * m - 1) / 256 + 1),
+                               dim3((8 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -205,12 +233,13 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
         else
         {
             hipLaunchKernelGGL((coomm_row_scale<256, 4>),
-                               dim3((4 * m - 1) / 256 + 1),
+                               dim3((4 * m - 1) / 256 + 1, 1, batch_count),
                                dim3(256),
                                0,
                                handle->stream,
@@ -218,13 +247,14 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                n,
                                beta_device_host,
                                C,
-                               ldc);
+                               ldc,
+                               batch_stride_C);
         }
     }
     else if(order == rocsparse_order_column)
     {
         hipLaunchKernelGGL((coomm_column_scale<1024>),
-                           dim3((m - 1) / 1024 + 1),
+                           dim3((m - 1) / 1024 + 1, 1, batch_count),
                            dim3(1024),
                            0,
                            handle->stream,
@@ -232,7 +262,8 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                            n,
                            beta_device_host,
                            C,
-                           ldc);
+                           ldc,
+                           batch_stride_C);
     }
 
     switch(alg)
@@ -257,29 +288,41 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                                ldb,
                                                beta_device_host,
                                                C,
-                                               ldc);
+                                               ldc,
+                                               batch_count,
+                                               batch_stride_A,
+                                               batch_stride_B,
+                                               batch_stride_C);
     }
 
     case rocsparse_coomm_alg_segmented:
     {
-        return rocsparse_coomm_template_segmented(handle,
-                                                  trans_A,
-                                                  trans_B,
-                                                  order,
-                                                  m,
-                                                  n,
-                                                  k,
-                                                  nnz,
-                                                  alpha_device_host,
-                                                  descr,
-                                                  coo_val,
-                                                  coo_row_ind,
-                                                  coo_col_ind,
-                                                  B,
-                                                  ldb,
-                                                  beta_device_host,
-                                                  C,
-                                                  ldc);
+        // The segmented reduction shares its block reduction buffer, so batches
+        // are processed one after another
+        for(I batch = 0; batch < batch_count; ++batch)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_coomm_template_segmented(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   order,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   nnz,
+                                                   alpha_device_host,
+                                                   descr,
+                                                   coo_val + batch_stride_A * batch,
+                                                   coo_row_ind,
+                                                   coo_col_ind,
+                                                   B + batch_stride_B * batch,
+                                                   ldb,
+                                                   beta_device_host,
+                                                   C + batch_stride_C * batch,
+                                                   ldc));
+        }
+
+        return rocsparse_status_success;
     }
 
     case rocsparse_coomm_alg_segmented_atomic:
@@ -301,7 +344,11 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                                          ldb,
                                                          beta_device_host,
                                                          C,
-                                                         ldc);
+                                                         ldc,
+                                                         batch_count,
+                                                         batch_stride_A,
+                                                         batch_stride_B,
+                                                         batch_stride_C);
     }
     }
 }
@@ -326,7 +373,11 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
                                           I                         ldb,
                                           const T*                  beta_device_host,
                                           T*                        C,
-                                          I                         ldc)
+                                          I                         ldc,
+                                          I                         batch_count,
+                                          int64_t                   batch_stride_A,
+                                          int64_t                   batch_stride_B,
+                                          int64_t                   batch_stride_C)
 {
     // Check for valid handle and matrix descriptor
     if(handle == nullptr)
@@ -394,13 +445,13 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
     }
 
     // Check sizes
-    if(m < 0 || n < 0 || k < 0 || nnz < 0)
+    if(m < 0 || n < 0 || k < 0 || nnz < 0 || batch_count < 0)
     {
         return rocsparse_status_invalid_size;
     }
 
     // Quick return if possible
-    if(m == 0 || n == 0 || k == 0)
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
         return rocsparse_status_success;
     }
@@ -522,7 +573,11 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
                                                  ldb,
                                                  beta_device_host,
                                                  C,
-                                                 ldc);
+                                                 ldc,
+                                                 batch_count,
+                                                 batch_stride_A,
+                                                 batch_stride_B,
+                                                 batch_stride_C);
     }
     else
     {
@@ -544,7 +599,11 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
                                                  ldb,
                                                  *beta_device_host,
                                                  C,
-                                                 ldc);
+                                                 ldc,
+                                                 batch_count,
+                                                 batch_stride_A,
+                                                 batch_stride_B,
+                                                 batch_stride_C);
     }
 
     return rocsparse_status_success;
@@ -571,7 +630,11 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
         ITYPE                     ldb,                                \
         const TTYPE*              beta_device_host,                   \
         TTYPE*                    C,                                  \
-        ITYPE                     ldc);
+        ITYPE                     ldc,                                \
+        ITYPE                     batch_count,                        \
+        int64_t                   batch_stride_A,                     \
+        int64_t                   batch_stride_B,                     \
+        int64_t                   batch_stride_C);
 
 INSTANTIATE(int32_t, float);
 INSTANTIATE(int32_t, double);
@@ -55,7 +55,11 @@ rocsparse_status rocsparse_coomm_template_dispatch(rocsparse_handle          han
                                                    I                         ldb,
                                                    U                         beta_device_host,
                                                    T*                        C,
-                                                   I                         ldc);
+                                                   I                         ldc,
+                                                   I                         batch_count,
+                                                   int64_t                   batch_stride_A,
+                                                   int64_t                   batch_stride_B,
+                                                   int64_t                   batch_stride_C);
 
 template <typename I, typename T>
 rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
@@ -77,6 +81,10 @@ rocsparse_status rocsparse_coomm_template(rocsparse_handle          handle,
                                           I                         ldb,
                                           const T*                  beta,
                                           T*                        C,
-                                          I                         ldc);
+                                          I                         ldc,
+                                          I                         batch_count,
+                                          int64_t                   batch_stride_A,
+                                          int64_t                   batch_stride_B,
+                                          int64_t                   batch_stride_C);
 
 #endif // ROCSPARSE_COOMM_HPP
@@ -266,13 +266,21 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                              const I* __restrict__ coo_row_ind,
                              const I* __restrict__ coo_col_ind,
                              const T* __restrict__ coo_val,
+                             int64_t batch_stride_A,
                              const T* __restrict__ B,
-                             I ldb,
+                             I       ldb,
+                             int64_t batch_stride_B,
                              T* __restrict__ C,
                              I                    ldc,
+                             int64_t              batch_stride_C,
                              rocsparse_order      order,
                              rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    coo_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     coommnn_atomic_main_device<BLOCKSIZE, WF_SIZE, LOOPS, NT>(trans_B,
                                                               offset,
@@ -301,13 +309,21 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                   const I* __restrict__ coo_row_ind,
                                   const I* __restrict__ coo_col_ind,
                                   const T* __restrict__ coo_val,
+                                  int64_t batch_stride_A,
                                   const T* __restrict__ B,
-                                  I ldb,
+                                  I       ldb,
+                                  int64_t batch_stride_B,
                                   T* __restrict__ C,
                                   I                    ldc,
+                                  int64_t              batch_stride_C,
                                   rocsparse_order      order,
                                   rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    coo_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     coommnn_atomic_remainder_device<BLOCKSIZE, WF_SIZE, NT>(trans_B,
                                                             offset,
@@ -327,13 +343,18 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
 
 template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool NT, typename I, typename... Ts>
 rocsparse_status
-    coommnn_atomic_dispatch(hipStream_t stream, rocsparse_operation trans_B, I nnz, I n, Ts&&... ts)
+    coommnn_atomic_dispatch(hipStream_t         stream,
+                            rocsparse_operation trans_B,
+                            I                   nnz,
+                            I                   n,
+                            I                   batch_count,
+                            Ts&&... ts)
 {
 #define TREAT_CONDITION(value_)                                                           \
     remainder = n % value_;                                                               \
     main      = n - remainder;                                                            \
     hipLaunchKernelGGL((coommnn_atomic_main<BLOCKSIZE, WF_SIZE, (value_ / WF_SIZE), NT>), \
-                       dim3((nnz - 1) / BLOCKSIZE + 1),                                   \
+                       dim3((nnz - 1) / BLOCKSIZE + 1, 1, batch_count),                   \
                        dim3(BLOCKSIZE),                                                   \
                        0,                                                                 \
                        stream,                                                            \
@@ -389,7 +410,7 @@ rocsparse_status
     if(remainder > 0)
     {
         hipLaunchKernelGGL((coommnn_atomic_remainder<BLOCKSIZE, WF_SIZE, NT>),
-                           dim3((nnz - 1) / BLOCKSIZE + 1),
+                           dim3((nnz - 1) / BLOCKSIZE + 1, 1, batch_count),
                            dim3(BLOCKSIZE),
                            0,
                            stream,
@@ -421,7 +442,11 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
                                                  I                         ldb,
                                                  U                         beta_device_host,
                                                  T*                        C,
-                                                 I                         ldc)
+                                                 I                         ldc,
+                                                 I                         batch_count,
+                                                 int64_t                   batch_stride_A,
+                                                 int64_t                   batch_stride_B,
+                                                 int64_t                   batch_stride_C)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -439,14 +464,18 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
                                                                trans_B,
                                                                nnz,
                                                                n,
+                                                               batch_count,
                                                                alpha_device_host,
                                                                coo_row_ind,
                                                                coo_col_ind,
                                                                coo_val,
+                                                               batch_stride_A,
                                                                B,
                                                                ldb,
+                                                               batch_stride_B,
                                                                C,
                                                                ldc,
+                                                               batch_stride_C,
                                                                order,
                                                                descr->base);
             }
@@ -456,14 +485,18 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
                                                                trans_B,
                                                                nnz,
                                                                n,
+                                                               batch_count,
                                                                alpha_device_host,
                                                                coo_row_ind,
                                                                coo_col_ind,
                                                                coo_val,
+                                                               batch_stride_A,
                                                                B,
                                                                ldb,
+                                                               batch_stride_B,
                                                                C,
                                                                ldc,
+                                                               batch_stride_C,
                                                                order,
                                                                descr->base);
             }
@@ -483,14 +516,18 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
                                                               trans_B,
                                                               nnz,
                                                               n,
+                                                              batch_count,
                                                               alpha_device_host,
                                                               coo_row_ind,
                                                               coo_col_ind,
                                                               coo_val,
+                                                              batch_stride_A,
                                                               B,
                                                               ldb,
+                                                              batch_stride_B,
                                                               C,
                                                               ldc,
+                                                              batch_stride_C,
                                                               order,
                                                               descr->base);
             }
@@ -500,14 +537,18 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
                                                               trans_B,
                                                               nnz,
                                                               n,
+                                                              batch_count,
                                                               alpha_device_host,
                                                               coo_row_ind,
                                                               coo_col_ind,
                                                               coo_val,
+                                                              batch_stride_A,
                                                               B,
                                                               ldb,
+                                                              batch_stride_B,
                                                               C,
                                                               ldc,
+                                                              batch_stride_C,
                                                               order,
                                                               descr->base);
             }
@@ -543,7 +584,11 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
         ITYPE                     ldb,                                              \
         UTYPE                     beta_device_host,                                 \
         TTYPE*                    C,                                                \
-        ITYPE                     ldc);
+        ITYPE                     ldc,                                              \
+        ITYPE                     batch_count,                                      \
+        int64_t                   batch_stride_A,                                   \
+        int64_t                   batch_stride_B,                                   \
+        int64_t                   batch_stride_C);
 
 INSTANTIATE(int32_t, float, float);
 INSTANTIATE(int32_t, double, double);
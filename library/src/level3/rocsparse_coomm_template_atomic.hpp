@@ -46,6 +46,10 @@ rocsparse_status rocsparse_coomm_template_atomic(rocsparse_handle          handl
                                                  I                         ldb,
                                                  U                         beta_device_host,
                                                  T*                        C,
-                                                 I                         ldc);
+                                                 I                         ldc,
+                                                 I                         batch_count,
+                                                 int64_t                   batch_stride_A,
+                                                 int64_t                   batch_stride_B,
+                                                 int64_t                   batch_stride_C);
 
 #endif // ROCSPARSE_COOMM_TEMPLATE_ATOMIC_HPP
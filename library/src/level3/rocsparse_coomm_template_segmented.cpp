@@ -318,6 +318,11 @@ rocsparse_status rocsparse_coomm_template_segmented(rocsparse_handle          ha
             temp_storage_ptr = handle->buffer;
             temp_alloc       = false;
         }
+        else if(handle->graph_mode == rocsparse_graph_mode_enabled)
+        {
+            // Temporary storage cannot be allocated in graph mode
+            return rocsparse_status_not_implemented;
+        }
         else
         {
             RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, required_size));
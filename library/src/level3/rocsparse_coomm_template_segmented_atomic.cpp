@@ -240,13 +240,21 @@ __launch_bounds__(WF_SIZE) ROCSPARSE_KERNEL
                                   const I* __restrict__ coo_row_ind,
                                   const I* __restrict__ coo_col_ind,
                                   const T* __restrict__ coo_val,
+                                  int64_t batch_stride_A,
                                   const T* __restrict__ B,
-                                  I ldb,
+                                  I       ldb,
+                                  int64_t batch_stride_B,
                                   T* __restrict__ C,
                                   I                    ldc,
+                                  int64_t              batch_stride_C,
                                   rocsparse_order      order,
                                   rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    coo_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     coommnn_segmented_atomic_device<WF_SIZE, LOOPS, COLS, NT>(
         trans_B, nnz, n, alpha, coo_row_ind, coo_col_ind, coo_val, B, ldb, C, ldc, order, idx_base);
@@ -254,7 +262,7 @@ __launch_bounds__(WF_SIZE) ROCSPARSE_KERNEL
 
 #define LAUNCH_COOMMNN_SEGMENTED_ATOMIC_MAIN_KERNEL(WF_SIZE, LOOPS, COLS, NT) \
     hipLaunchKernelGGL((coommnn_segmented_atomic<WF_SIZE, LOOPS, COLS, NT>),  \
-                       dim3(nblocks, (main - 1) / COLS + 1),                  \
+                       dim3(nblocks, (main - 1) / COLS + 1, batch_count),     \
                        dim3(WF_SIZE),                                         \
                        0,                                                     \
                        stream,                                                \
@@ -265,16 +273,19 @@ __launch_bounds__(WF_SIZE) ROCSPARSE_KERNEL
                        coo_row_ind,                                           \
                        coo_col_ind,                                           \
                        coo_val,                                               \
+                       batch_stride_A,                                        \
                        B,                                                     \
                        ldb,                                                   \
+                       batch_stride_B,                                        \
                        C,                                                     \
                        ldc,                                                   \
+                       batch_stride_C,                                        \
                        order,                                                 \
                        descr->base);
 
 #define LAUNCH_COOMMNN_SEGMENTED_ATOMIC_REMAINDER_KERNEL(WF_SIZE, LOOPS, COLS, NT) \
     hipLaunchKernelGGL((coommnn_segmented_atomic<WF_SIZE, LOOPS, COLS, NT>),       \
-                       dim3(nblocks),                                              \
+                       dim3(nblocks, 1, batch_count),                              \
                        dim3(WF_SIZE),                                              \
                        0,                                                          \
                        stream,                                                     \
@@ -285,10 +296,13 @@ __launch_bounds__(WF_SIZE) ROCSPARSE_KERNEL
                        coo_row_ind,                                                \
                        coo_col_ind,                                                \
                        coo_val,                                                    \
+                       batch_stride_A,                                             \
                        B,                                                          \
                        ldb,                                                        \
+                       batch_stride_B,                                             \
                        C,                                                          \
                        ldc,                                                        \
+                       batch_stride_C,                                             \
                        order,                                                      \
                        descr->base);
 
@@ -308,9 +322,13 @@ rocsparse_status rocsparse_coomm_template_segmented_atomic(rocsparse_handle    h
                                                            const I*                  coo_col_ind,
                                                            const T*                  B,
                                                            I                         ldb,
-                                                           U  beta_device_host,
-                                                           T* C,
-                                                           I  ldc)
+                                                           U       beta_device_host,
+                                                           T*      C,
+                                                           I       ldc,
+                                                           I       batch_count,
+                                                           int64_t batch_stride_A,
+                                                           int64_t batch_stride_B,
+                                                           int64_t batch_stride_C)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -587,7 +605,11 @@ rocsparse_status rocsparse_coomm_template_segmented_atomic(rocsparse_handle    h
         ITYPE                     ldb,                                                        \
         UTYPE                     beta_device_host,                                           \
         TTYPE*                    C,                                                          \
-        ITYPE                     ldc);
+        ITYPE                     ldc,                                                        \
+        ITYPE                     batch_count,                                                \
+        int64_t                   batch_stride_A,                                             \
+        int64_t                   batch_stride_B,                                             \
+        int64_t                   batch_stride_C);
 
 INSTANTIATE(int32_t, float, float);
 INSTANTIATE(int32_t, double, double);
@@ -44,8 +44,12 @@ rocsparse_status rocsparse_coomm_template_segmented_atomic(rocsparse_handle    h
                                                            const I*                  coo_col_ind,
                                                            const T*                  B,
                                                            I                         ldb,
-                                                           U  beta_device_host,
-                                                           T* C,
-                                                           I  ldc);
+                                                           U       beta_device_host,
+                                                           T*      C,
+                                                           I       ldc,
+                                                           I       batch_count,
+                                                           int64_t batch_stride_A,
+                                                           int64_t batch_stride_B,
+                                                           int64_t batch_stride_C);
 
 #endif // ROCSPARSE_COOMM_TEMPLATE_SEGMENTED_ATOMIC_HPP
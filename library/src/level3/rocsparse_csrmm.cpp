@@ -293,7 +293,11 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                                   J                         ldb,
                                                   U                         beta_device_host,
                                                   T*                        C,
-                                                  J                         ldc);
+                                                  J                         ldc,
+                                                  J                         batch_count,
+                                                  int64_t                   batch_stride_A,
+                                                  int64_t                   batch_stride_B,
+                                                  int64_t                   batch_stride_C);
 
 template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          handle,
@@ -313,7 +317,11 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                                     J                         ldb,
                                                     U                         beta_device_host,
                                                     T*                        C,
-                                                    J                         ldc);
+                                                    J                         ldc,
+                                                    J                         batch_count,
+                                                    int64_t                   batch_stride_A,
+                                                    int64_t                   batch_stride_B,
+                                                    int64_t                   batch_stride_C);
 
 template <typename I, typename J, typename T, typename U>
 rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle,
@@ -334,6 +342,10 @@ rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle
                                                 U                         beta_device_host,
                                                 T*                        C,
                                                 J                         ldc,
+                                                J                         batch_count,
+                                                int64_t                   batch_stride_A,
+                                                int64_t                   batch_stride_B,
+                                                int64_t                   batch_stride_C,
                                                 void*                     temp_buffer);
 
 template <typename I, typename J, typename T, typename U>
@@ -356,6 +368,10 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                    U                         beta_device_host,
                                                    T*                        C,
                                                    J                         ldc,
+                                                   J                         batch_count,
+                                                   int64_t                   batch_stride_A,
+                                                   int64_t                   batch_stride_B,
+                                                   int64_t                   batch_stride_C,
                                                    void*                     temp_buffer)
 {
     switch(alg)
@@ -380,7 +396,11 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                 ldb,
                                                 beta_device_host,
                                                 C,
-                                                ldc);
+                                                ldc,
+                                                batch_count,
+                                                batch_stride_A,
+                                                batch_stride_B,
+                                                batch_stride_C);
     }
 
     case rocsparse_csrmm_alg_merge:
@@ -407,6 +427,10 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                   beta_device_host,
                                                   C,
                                                   ldc,
+                                                  batch_count,
+                                                  batch_stride_A,
+                                                  batch_stride_B,
+                                                  batch_stride_C,
                                                   temp_buffer);
         }
         case rocsparse_operation_transpose:
@@ -429,7 +453,11 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                     ldb,
                                                     beta_device_host,
                                                     C,
-                                                    ldc);
+                                                    ldc,
+                                                    batch_count,
+                                                    batch_stride_A,
+                                                    batch_stride_B,
+                                                    batch_stride_C);
         }
         }
     }
@@ -457,7 +485,11 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                       ldb,
                                                       beta_device_host,
                                                       C,
-                                                      ldc);
+                                                      ldc,
+                                                      batch_count,
+                                                      batch_stride_A,
+                                                      batch_stride_B,
+                                                      batch_stride_C);
         }
         case rocsparse_operation_transpose:
         case rocsparse_operation_conjugate_transpose:
@@ -479,7 +511,11 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                     ldb,
                                                     beta_device_host,
                                                     C,
-                                                    ldc);
+                                                    ldc,
+                                                    batch_count,
+                                                    batch_stride_A,
+                                                    batch_stride_B,
+                                                    batch_stride_C);
         }
         }
     }
@@ -507,6 +543,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           const T*                  beta_device_host,
                                           T*                        C,
                                           J                         ldc,
+                                          J                         batch_count,
+                                          int64_t                   batch_stride_A,
+                                          int64_t                   batch_stride_B,
+                                          int64_t                   batch_stride_C,
                                           void*                     temp_buffer)
 {
     // Check for valid handle and matrix descriptor
@@ -576,13 +616,13 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
     }
 
     // Check sizes
-    if(m < 0 || n < 0 || k < 0 || nnz < 0)
+    if(m < 0 || n < 0 || k < 0 || nnz < 0 || batch_count < 0)
     {
         return rocsparse_status_invalid_size;
     }
 
     // Quick return if possible
-    if(m == 0 || n == 0 || k == 0)
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
         return rocsparse_status_success;
     }
@@ -709,6 +749,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                                  beta_device_host,
                                                  C,
                                                  ldc,
+                                                 batch_count,
+                                                 batch_stride_A,
+                                                 batch_stride_B,
+                                                 batch_stride_C,
                                                  temp_buffer);
     }
     else
@@ -732,6 +776,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                                  *beta_device_host,
                                                  C,
                                                  ldc,
+                                                 batch_count,
+                                                 batch_stride_A,
+                                                 batch_stride_B,
+                                                 batch_stride_C,
                                                  temp_buffer);
     }
 
@@ -818,6 +866,10 @@ INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
         const TTYPE*              beta_device_host,                          \
         TTYPE*                    C,                                         \
         JTYPE                     ldc,                                       \
+        JTYPE                     batch_count,                               \
+        int64_t                   batch_stride_A,                            \
+        int64_t                   batch_stride_B,                            \
+        int64_t                   batch_stride_C,                            \
         void*                     temp_buffer);
 
 INSTANTIATE(int32_t, int32_t, float);
@@ -879,6 +931,10 @@ INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
                                         beta,                               \
                                         C,                                  \
                                         ldc,                                \
+                                        (rocsparse_int)1,                   \
+                                        0,                                  \
+                                        0,                                  \
+                                        0,                                  \
                                         nullptr);                           \
     }
 
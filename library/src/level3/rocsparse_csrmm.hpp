@@ -83,6 +83,10 @@ rocsparse_status rocsparse_csrmm_template_dispatch(rocsparse_handle          han
                                                    U                         beta_device_host,
                                                    T*                        C,
                                                    J                         ldc,
+                                                   J                         batch_count,
+                                                   int64_t                   batch_stride_A,
+                                                   int64_t                   batch_stride_B,
+                                                   int64_t                   batch_stride_C,
                                                    void*                     temp_buffer);
 
 template <typename I, typename J, typename T>
@@ -106,6 +110,10 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle          handle,
                                           const T*                  beta,
                                           T*                        C,
                                           J                         ldc,
+                                          J                         batch_count,
+                                          int64_t                   batch_stride_A,
+                                          int64_t                   batch_stride_B,
+                                          int64_t                   batch_stride_C,
                                           void*                     temp_buffer);
 
 #endif // ROCSPARSE_CSRMM_HPP
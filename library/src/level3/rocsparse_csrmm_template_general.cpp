@@ -28,8 +28,11 @@
 
 template <unsigned int DIM_X, unsigned int DIM_Y, typename I, typename T, typename U>
 __launch_bounds__(DIM_X* DIM_Y) ROCSPARSE_KERNEL void csrmm_scale(
-    I m, I n, U beta_device_host, T* __restrict__ data, I ld, rocsparse_order order)
+    I m, I n, U beta_device_host, T* __restrict__ data, I ld, int64_t stride, rocsparse_order order)
 {
+    // Offset into the current batch
+    data += stride * hipBlockIdx_z;
+
     auto beta = load_scalar_device_host(beta_device_host);
     if(beta != static_cast<T>(1))
     {
@@ -54,14 +57,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
                                 const T* __restrict__ csr_val,
+                                int64_t batch_stride_A,
                                 const T* __restrict__ B,
-                                J ldb,
-                                U beta_device_host,
+                                J       ldb,
+                                int64_t batch_stride_B,
+                                U       beta_device_host,
                                 T* __restrict__ C,
                                 J                    ldc,
+                                int64_t              batch_stride_C,
                                 rocsparse_order      order,
                                 rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -109,14 +120,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                      const I* __restrict__ csr_row_ptr,
                                      const J* __restrict__ csr_col_ind,
                                      const T* __restrict__ csr_val,
+                                     int64_t batch_stride_A,
                                      const T* __restrict__ B,
-                                     J ldb,
-                                     U beta_device_host,
+                                     J       ldb,
+                                     int64_t batch_stride_B,
+                                     U       beta_device_host,
                                      T* __restrict__ C,
                                      J                    ldc,
+                                     int64_t              batch_stride_C,
                                      rocsparse_order      order,
                                      rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -164,14 +183,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                           const I* __restrict__ csr_row_ptr,
                                           const J* __restrict__ csr_col_ind,
                                           const T* __restrict__ csr_val,
+                                          int64_t batch_stride_A,
                                           const T* __restrict__ B,
-                                          J ldb,
-                                          U beta_device_host,
+                                          J       ldb,
+                                          int64_t batch_stride_B,
+                                          U       beta_device_host,
                                           T* __restrict__ C,
                                           J                    ldc,
+                                          int64_t              batch_stride_C,
                                           rocsparse_order      order,
                                           rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -217,14 +244,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
                                 const T* __restrict__ csr_val,
+                                int64_t batch_stride_A,
                                 const T* __restrict__ B,
-                                J ldb,
-                                U beta_device_host,
+                                J       ldb,
+                                int64_t batch_stride_B,
+                                U       beta_device_host,
                                 T* __restrict__ C,
                                 J                    ldc,
+                                int64_t              batch_stride_C,
                                 rocsparse_order      order,
                                 rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -268,14 +303,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                 const I* __restrict__ csr_row_ptr,
                                 const J* __restrict__ csr_col_ind,
                                 const T* __restrict__ csr_val,
+                                int64_t batch_stride_A,
                                 const T* __restrict__ B,
-                                J ldb,
-                                U beta_device_host,
+                                J       ldb,
+                                int64_t batch_stride_B,
+                                U       beta_device_host,
                                 T* __restrict__ C,
                                 J                    ldc,
+                                int64_t              batch_stride_C,
                                 rocsparse_order      order,
                                 rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -302,33 +345,38 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                                idx_base);
 }
 
-#define LAUNCH_CSRMMNN_GENERAL_KERNEL(CSRMMNN_DIM, WF_SIZE)                              \
-    hipLaunchKernelGGL((csrmmnn_general_kernel<CSRMMNN_DIM, WF_SIZE>),                   \
-                       dim3((WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (n - 1) / WF_SIZE + 1), \
-                       dim3(CSRMMNN_DIM),                                                \
-                       0,                                                                \
-                       stream,                                                           \
-                       trans_A,                                                          \
-                       trans_B,                                                          \
-                       m,                                                                \
-                       n,                                                                \
-                       k,                                                                \
-                       nnz,                                                              \
-                       alpha_device_host,                                                \
-                       csr_row_ptr,                                                      \
-                       csr_col_ind,                                                      \
-                       csr_val,                                                          \
-                       B,                                                                \
-                       ldb,                                                              \
-                       beta_device_host,                                                 \
-                       C,                                                                \
-                       ldc,                                                              \
-                       order,                                                            \
+#define LAUNCH_CSRMMNN_GENERAL_KERNEL(CSRMMNN_DIM, WF_SIZE)            \
+    hipLaunchKernelGGL((csrmmnn_general_kernel<CSRMMNN_DIM, WF_SIZE>), \
+                       dim3((WF_SIZE * m - 1) / CSRMMNN_DIM + 1,       \
+                            (n - 1) / WF_SIZE + 1,                     \
+                            batch_count),                              \
+                       dim3(CSRMMNN_DIM),                              \
+                       0,                                              \
+                       stream,                                         \
+                       trans_A,                                        \
+                       trans_B,                                        \
+                       m,                                              \
+                       n,                                              \
+                       k,                                              \
+                       nnz,                                            \
+                       alpha_device_host,                              \
+                       csr_row_ptr,                                    \
+                       csr_col_ind,                                    \
+                       csr_val,                                        \
+                       batch_stride_A,                                 \
+                       B,                                              \
+                       ldb,                                            \
+                       batch_stride_B,                                 \
+                       beta_device_host,                               \
+                       C,                                              \
+                       ldc,                                            \
+                       batch_stride_C,                                 \
+                       order,                                          \
                        descr->base);
 
 #define LAUNCH_CSRMMNT_GENERAL_MAIN_KERNEL(CSRMMNT_DIM, WF_SIZE, LOOPS)            \
     hipLaunchKernelGGL((csrmmnt_general_main_kernel<CSRMMNT_DIM, WF_SIZE, LOOPS>), \
-                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1),                  \
+                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1, 1, batch_count),  \
                        dim3(CSRMMNT_DIM),                                          \
                        0,                                                          \
                        stream,                                                     \
@@ -344,38 +392,44 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                        csr_row_ptr,                                                \
                        csr_col_ind,                                                \
                        csr_val,                                                    \
+                       batch_stride_A,                                             \
                        B,                                                          \
                        ldb,                                                        \
+                       batch_stride_B,                                             \
                        beta_device_host,                                           \
                        C,                                                          \
                        ldc,                                                        \
+                       batch_stride_C,                                             \
                        order,                                                      \
                        descr->base);
 
-#define LAUNCH_CSRMMNT_GENERAL_REMAINDER_KERNEL(CSRMMNT_DIM, WF_SIZE)            \
-    hipLaunchKernelGGL((csrmmnt_general_remainder_kernel<CSRMMNT_DIM, WF_SIZE>), \
-                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1),                \
-                       dim3(CSRMMNT_DIM),                                        \
-                       0,                                                        \
-                       stream,                                                   \
-                       trans_A,                                                  \
-                       trans_B,                                                  \
-                       main,                                                     \
-                       n,                                                        \
-                       m,                                                        \
-                       n,                                                        \
-                       k,                                                        \
-                       nnz,                                                      \
-                       alpha_device_host,                                        \
-                       csr_row_ptr,                                              \
-                       csr_col_ind,                                              \
-                       csr_val,                                                  \
-                       B,                                                        \
-                       ldb,                                                      \
-                       beta_device_host,                                         \
-                       C,                                                        \
-                       ldc,                                                      \
-                       order,                                                    \
+#define LAUNCH_CSRMMNT_GENERAL_REMAINDER_KERNEL(CSRMMNT_DIM, WF_SIZE)             \
+    hipLaunchKernelGGL((csrmmnt_general_remainder_kernel<CSRMMNT_DIM, WF_SIZE>),  \
+                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1, 1, batch_count), \
+                       dim3(CSRMMNT_DIM),                                         \
+                       0,                                                         \
+                       stream,                                                    \
+                       trans_A,                                                   \
+                       trans_B,                                                   \
+                       main,                                                      \
+                       n,                                                         \
+                       m,                                                         \
+                       n,                                                         \
+                       k,                                                         \
+                       nnz,                                                       \
+                       alpha_device_host,                                         \
+                       csr_row_ptr,                                               \
+                       csr_col_ind,                                               \
+                       csr_val,                                                   \
+                       batch_stride_A,                                            \
+                       B,                                                         \
+                       ldb,                                                       \
+                       batch_stride_B,                                            \
+                       beta_device_host,                                          \
+                       C,                                                         \
+                       ldc,                                                       \
+                       batch_stride_C,                                            \
+                       order,                                                     \
                        descr->base);
 
 template <typename I, typename J, typename T, typename U>
@@ -396,7 +450,11 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                                   J                         ldb,
                                                   U                         beta_device_host,
                                                   T*                        C,
-                                                  J                         ldc)
+                                                  J                         ldc,
+                                                  J                         batch_count,
+                                                  int64_t                   batch_stride_A,
+                                                  int64_t                   batch_stride_B,
+                                                  int64_t                   batch_stride_C)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -631,7 +689,7 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
 
             // Scale C with beta
             hipLaunchKernelGGL((csrmm_scale<CSRMMTN_DIM, WF_SIZE>),
-                               dim3((k - 1) / CSRMMTN_DIM + 1, (n - 1) / WF_SIZE + 1),
+                               dim3((k - 1) / CSRMMTN_DIM + 1, (n - 1) / WF_SIZE + 1, batch_count),
                                dim3(CSRMMTN_DIM, WF_SIZE),
                                0,
                                handle->stream,
@@ -640,10 +698,13 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                beta_device_host,
                                C,
                                ldc,
+                               batch_stride_C,
                                order);
 
             hipLaunchKernelGGL((csrmmtn_general_kernel<CSRMMTN_DIM, WF_SIZE>),
-                               dim3((WF_SIZE * m - 1) / CSRMMTN_DIM + 1, (n - 1) / WF_SIZE + 1),
+                               dim3((WF_SIZE * m - 1) / CSRMMTN_DIM + 1,
+                                    (n - 1) / WF_SIZE + 1,
+                                    batch_count),
                                dim3(CSRMMTN_DIM),
                                0,
                                stream,
@@ -657,11 +718,14 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               batch_stride_A,
                                B,
                                ldb,
+                               batch_stride_B,
                                beta_device_host,
                                C,
                                ldc,
+                               batch_stride_C,
                                order,
                                descr->base);
 
@@ -678,7 +742,7 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
 #define WF_SIZE 4
             // Scale C with beta
             hipLaunchKernelGGL((csrmm_scale<CSRMMTT_DIM, WF_SIZE>),
-                               dim3((k - 1) / CSRMMTT_DIM + 1, (n - 1) / WF_SIZE + 1),
+                               dim3((k - 1) / CSRMMTT_DIM + 1, (n - 1) / WF_SIZE + 1, batch_count),
                                dim3(CSRMMTT_DIM, WF_SIZE),
                                0,
                                handle->stream,
@@ -687,10 +751,13 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                beta_device_host,
                                C,
                                ldc,
+                               batch_stride_C,
                                order);
 
             hipLaunchKernelGGL((csrmmtt_general_kernel<CSRMMTT_DIM, WF_SIZE>),
-                               dim3((WF_SIZE * m - 1) / CSRMMTT_DIM + 1, (n - 1) / WF_SIZE + 1),
+                               dim3((WF_SIZE * m - 1) / CSRMMTT_DIM + 1,
+                                    (n - 1) / WF_SIZE + 1,
+                                    batch_count),
                                dim3(CSRMMTT_DIM),
                                0,
                                stream,
@@ -704,11 +771,14 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                csr_row_ptr,
                                csr_col_ind,
                                csr_val,
+                               batch_stride_A,
                                B,
                                ldb,
+                               batch_stride_B,
                                beta_device_host,
                                C,
                                ldc,
+                               batch_stride_C,
                                order,
                                descr->base);
 
@@ -741,7 +811,11 @@ rocsparse_status rocsparse_csrmm_template_general(rocsparse_handle          hand
                                                                JTYPE        ldb,                  \
                                                                UTYPE        beta_device_host,     \
                                                                TTYPE*       C,                    \
-                                                               JTYPE        ldc)
+                                                               JTYPE        ldc,                  \
+                                                               JTYPE        batch_count,          \
+                                                               int64_t      batch_stride_A,       \
+                                                               int64_t      batch_stride_B,       \
+                                                               int64_t      batch_stride_C)
 
 INSTANTIATE(int32_t, int32_t, float, float);
 INSTANTIATE(int32_t, int32_t, double, double);
@@ -45,6 +45,10 @@ rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle
                                                 U                         beta_device_host,
                                                 T*                        C,
                                                 J                         ldc,
+                                                J                         batch_count,
+                                                int64_t                   batch_stride_A,
+                                                int64_t                   batch_stride_B,
+                                                int64_t                   batch_stride_C,
                                                 void*                     temp_buffer)
 {
     // Temporary buffer entry points
@@ -70,7 +74,11 @@ rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle
                                              ldb,
                                              beta_device_host,
                                              C,
-                                             ldc);
+                                             ldc,
+                                             batch_count,
+                                             batch_stride_A,
+                                             batch_stride_B,
+                                             batch_stride_C);
 }
 
 #define INSTANTIATE(ITYPE, JTYPE, TTYPE, UTYPE)                                                     \
@@ -89,10 +97,14 @@ rocsparse_status rocsparse_csrmm_template_merge(rocsparse_handle          handle
                                                              const JTYPE*              csr_col_ind, \
                                                              const TTYPE*              B,           \
                                                              JTYPE                     ldb,         \
-                                                             UTYPE  beta_device_host,               \
-                                                             TTYPE* C,                              \
-                                                             JTYPE  ldc,                            \
-                                                             void*  temp_buffer)
+                                                             UTYPE   beta_device_host,              \
+                                                             TTYPE*  C,                             \
+                                                             JTYPE   ldc,                           \
+                                                             JTYPE   batch_count,                   \
+                                                             int64_t batch_stride_A,                \
+                                                             int64_t batch_stride_B,                \
+                                                             int64_t batch_stride_C,                \
+                                                             void*   temp_buffer)
 
 INSTANTIATE(int32_t, int32_t, float, float);
 INSTANTIATE(int32_t, int32_t, double, double);
@@ -45,14 +45,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                   const I* __restrict__ csr_row_ptr,
                                   const J* __restrict__ csr_col_ind,
                                   const T* __restrict__ csr_val,
+                                  int64_t batch_stride_A,
                                   const T* __restrict__ B,
-                                  J ldb,
-                                  U beta_device_host,
+                                  J       ldb,
+                                  int64_t batch_stride_B,
+                                  U       beta_device_host,
                                   T* __restrict__ C,
                                   J                    ldc,
+                                  int64_t              batch_stride_C,
                                   rocsparse_order      order,
                                   rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -101,14 +109,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                        const I* __restrict__ csr_row_ptr,
                                        const J* __restrict__ csr_col_ind,
                                        const T* __restrict__ csr_val,
+                                       int64_t batch_stride_A,
                                        const T* __restrict__ B,
-                                       J ldb,
-                                       U beta_device_host,
+                                       J       ldb,
+                                       int64_t batch_stride_B,
+                                       U       beta_device_host,
                                        T* __restrict__ C,
                                        J                    ldc,
+                                       int64_t              batch_stride_C,
                                        rocsparse_order      order,
                                        rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -157,14 +173,22 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                                             const I* __restrict__ csr_row_ptr,
                                             const J* __restrict__ csr_col_ind,
                                             const T* __restrict__ csr_val,
+                                            int64_t batch_stride_A,
                                             const T* __restrict__ B,
-                                            J ldb,
-                                            U beta_device_host,
+                                            J       ldb,
+                                            int64_t batch_stride_B,
+                                            U       beta_device_host,
                                             T* __restrict__ C,
                                             J                    ldc,
+                                            int64_t              batch_stride_C,
                                             rocsparse_order      order,
                                             rocsparse_index_base idx_base)
 {
+    // Offset into the current batch
+    csr_val += batch_stride_A * hipBlockIdx_z;
+    B       += batch_stride_B * hipBlockIdx_z;
+    C       += batch_stride_C * hipBlockIdx_z;
+
     auto alpha = load_scalar_device_host(alpha_device_host);
     auto beta  = load_scalar_device_host(beta_device_host);
 
@@ -196,7 +220,7 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
 
 #define LAUNCH_CSRMMNT_ROW_SPLIT_MAIN_KERNEL(CSRMMNT_DIM, WF_SIZE, LOOPS)            \
     hipLaunchKernelGGL((csrmmnt_row_split_main_kernel<CSRMMNT_DIM, WF_SIZE, LOOPS>), \
-                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1),                    \
+                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1, 1, batch_count),    \
                        dim3(CSRMMNT_DIM),                                            \
                        0,                                                            \
                        stream,                                                       \
@@ -212,17 +236,20 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                        csr_row_ptr,                                                  \
                        csr_col_ind,                                                  \
                        csr_val,                                                      \
+                       batch_stride_A,                                               \
                        B,                                                            \
                        ldb,                                                          \
+                       batch_stride_B,                                               \
                        beta_device_host,                                             \
                        C,                                                            \
                        ldc,                                                          \
+                       batch_stride_C,                                               \
                        order,                                                        \
                        descr->base);
 
 #define LAUNCH_CSRMMNT_ROW_SPLIT_REMAINDER_KERNEL(CSRMMNT_DIM, WF_SIZE)            \
     hipLaunchKernelGGL((csrmmnt_row_split_remainder_kernel<CSRMMNT_DIM, WF_SIZE>), \
-                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1),                  \
+                       dim3((WF_SIZE * m - 1) / CSRMMNT_DIM + 1, 1, batch_count),  \
                        dim3(CSRMMNT_DIM),                                          \
                        0,                                                          \
                        stream,                                                     \
@@ -238,11 +265,14 @@ __launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
                        csr_row_ptr,                                                \
                        csr_col_ind,                                                \
                        csr_val,                                                    \
+                       batch_stride_A,                                             \
                        B,                                                          \
                        ldb,                                                        \
+                       batch_stride_B,                                             \
                        beta_device_host,                                           \
                        C,                                                          \
                        ldc,                                                        \
+                       batch_stride_C,                                             \
                        order,                                                      \
                        descr->base);
 
@@ -264,7 +294,11 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                                     J                         ldb,
                                                     U                         beta_device_host,
                                                     T*                        C,
-                                                    J                         ldc)
+                                                    J                         ldc,
+                                                    J                         batch_count,
+                                                    int64_t                   batch_stride_A,
+                                                    int64_t                   batch_stride_B,
+                                                    int64_t                   batch_stride_C)
 {
     // Stream
     hipStream_t stream = handle->stream;
@@ -283,7 +317,8 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
 
             if(main > 0)
             {
-                dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (main - 1) / 8 + 1);
+                dim3 csrmmnn_blocks(
+                    (SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1, (main - 1) / 8 + 1, batch_count);
                 dim3 csrmmnn_threads(CSRMMNN_DIM);
                 hipLaunchKernelGGL((csrmmnn_row_split_kernel<CSRMMNN_DIM, SUB_WF_SIZE, 8>),
                                    csrmmnn_blocks,
@@ -301,11 +336,14 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
+                                   batch_stride_A,
                                    B,
                                    ldb,
+                                   batch_stride_B,
                                    beta_device_host,
                                    C,
                                    ldc,
+                                   batch_stride_C,
                                    order,
                                    descr->base);
             }
@@ -313,7 +351,8 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
             if(remainder > 0)
             {
                 dim3 csrmmnn_blocks((SUB_WF_SIZE * m - 1) / CSRMMNN_DIM + 1,
-                                    (remainder - 1) / 1 + 1);
+                                    (remainder - 1) / 1 + 1,
+                                    batch_count);
                 dim3 csrmmnn_threads(CSRMMNN_DIM);
                 hipLaunchKernelGGL((csrmmnn_row_split_kernel<CSRMMNN_DIM, SUB_WF_SIZE, 1>),
                                    csrmmnn_blocks,
@@ -331,11 +370,14 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                    csr_row_ptr,
                                    csr_col_ind,
                                    csr_val,
+                                   batch_stride_A,
                                    B,
                                    ldb,
+                                   batch_stride_B,
                                    beta_device_host,
                                    C,
                                    ldc,
+                                   batch_stride_C,
                                    order,
                                    descr->base);
             }
@@ -582,7 +624,11 @@ rocsparse_status rocsparse_csrmm_template_row_split(rocsparse_handle          ha
                                                                  JTYPE        ldb,                  \
                                                                  UTYPE        beta_device_host,     \
                                                                  TTYPE*       C,                    \
-                                                                 JTYPE        ldc)
+                                                                 JTYPE        ldc,                  \
+                                                                 JTYPE        batch_count,          \
+                                                                 int64_t      batch_stride_A,       \
+                                                                 int64_t      batch_stride_B,       \
+                                                                 int64_t      batch_stride_C)
 
 INSTANTIATE(int32_t, int32_t, float, float);
 INSTANTIATE(int32_t, int32_t, double, double);
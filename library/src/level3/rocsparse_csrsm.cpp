@@ -477,6 +477,12 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                 info->csrsm_lower_info = info->csric0_info;
                 return rocsparse_status_success;
             }
+            else if(trans_A == rocsparse_operation_none && info->csrildl0_info != nullptr)
+            {
+                // csrildl0 meta data
+                info->csrsm_lower_info = info->csrildl0_info;
+                return rocsparse_status_success;
+            }
             else if(trans_A == rocsparse_operation_none && info->csrsv_lower_info != nullptr)
             {
                 // csrsv meta data
@@ -654,12 +660,15 @@ rocsparse_status rocsparse_csrsm_solve_dispatch(rocsparse_handle          handle
     // If diag type is unit, re-initialize zero pivot to remove structural zeros
     if(descr->diag_type == rocsparse_diag_type_unit)
     {
-        J max = std::numeric_limits<J>::max();
-        RETURN_IF_HIP_ERROR(
-            hipMemcpyAsync(info->zero_pivot, &max, sizeof(J), hipMemcpyHostToDevice, stream));
-
-        // Wait for device transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        // Initialize on the device, such that no host synchronization is required
+        hipLaunchKernelGGL((set_array_to_value<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           1,
+                           (J*)info->zero_pivot,
+                           std::numeric_limits<J>::max());
     }
 
     // Leading dimension
@@ -1225,6 +1234,25 @@ extern "C" rocsparse_status rocsparse_csrsm_zero_pivot(rocsparse_handle   handle
         return rocsparse_status_success;
     }
 
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -157,6 +157,26 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
 
     rocsparse_status status;
 
+    // The batch count is given by C, A and B are either batched alike or shared
+    // by all batches
+    const int64_t batch_count = mat_C->batch_count;
+
+    // The batches are launched through the z dimension of the grid
+    if(batch_count > 65535)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    if((mat_A->batch_count != 1 && mat_A->batch_count != batch_count)
+       || (mat_B->batch_count != 1 && mat_B->batch_count != batch_count))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    const int64_t batch_stride_A = (mat_A->batch_count == 1) ? 0 : mat_A->batch_stride;
+    const int64_t batch_stride_B = (mat_B->batch_count == 1) ? 0 : mat_B->batch_stride;
+    const int64_t batch_stride_C = mat_C->batch_stride;
+
     auto mat_A_format = mat_A->format;
     switch(mat_A_format)
     {
@@ -242,6 +262,10 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
                                             (const T*)beta,
                                             (T*)mat_C->values,
                                             (J)mat_C->ld,
+                                            (J)batch_count,
+                                            batch_stride_A,
+                                            batch_stride_B,
+                                            batch_stride_C,
                                             temp_buffer);
         }
 
@@ -316,7 +340,11 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
                                             (I)mat_B->ld,
                                             (const T*)beta,
                                             (T*)mat_C->values,
-                                            (I)mat_C->ld);
+                                            (I)mat_C->ld,
+                                            (I)batch_count,
+                                            batch_stride_A,
+                                            batch_stride_B,
+                                            batch_stride_C);
         }
 
         case rocsparse_spmm_stage_auto:
@@ -441,6 +469,10 @@ rocsparse_status rocsparse_spmm_template(rocsparse_handle            handle,
                                                    (const T*)beta,
                                                    (T*)mat_C->values,
                                                    (I)mat_C->ld,
+                                                   (I)batch_count,
+                                                   batch_stride_A,
+                                                   batch_stride_B,
+                                                   batch_stride_C,
                                                    temp_buffer);
         }
 
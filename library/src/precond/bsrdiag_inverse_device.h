@@ -0,0 +1,318 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRDIAG_INVERSE_DEVICE_H
+#define BSRDIAG_INVERSE_DEVICE_H
+
+#include "common.h"
+
+// Inverts the diagonal blocks of a BSR matrix using in-place Gauss-Jordan elimination,
+// where each diagonal block is processed by BSRDIM * BSRDIM threads in shared memory and
+// each thread is responsible for a single entry of the block. Blocks with block_dim < BSRDIM
+// are padded with the identity, which does not interact with the block during elimination.
+template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void bsrdiag_inverse_kernel(rocsparse_direction dir,
+                                rocsparse_int       mb,
+                                const T* __restrict__ bsr_val,
+                                const rocsparse_int* __restrict__ bsr_row_ptr,
+                                const rocsparse_int* __restrict__ bsr_col_ind,
+                                rocsparse_int block_dim,
+                                bool          pivot,
+                                T* __restrict__ inv_val,
+                                rocsparse_int* __restrict__ inv_row_ptr,
+                                rocsparse_int* __restrict__ inv_col_ind,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    // Number of diagonal blocks processed by each thread block
+    static constexpr unsigned int NBLOCKS = BLOCKSIZE / (BSRDIM * BSRDIM);
+
+    rocsparse_int tid = hipThreadIdx_x;
+
+    // Local diagonal block id and the entry this thread is responsible for
+    rocsparse_int lid = tid / (BSRDIM * BSRDIM);
+    rocsparse_int idx = tid % (BSRDIM * BSRDIM);
+    rocsparse_int r   = idx / BSRDIM;
+    rocsparse_int c   = idx % BSRDIM;
+
+    // BSR row
+    rocsparse_int row = hipBlockIdx_x * NBLOCKS + lid;
+
+    // Remaining threads of the thread block idle, but still have to synchronize
+    bool active = (lid < NBLOCKS && row < mb);
+
+    __shared__ T             sdata[NBLOCKS * BSRDIM * BSRDIM];
+    __shared__ rocsparse_int sperm[NBLOCKS * BSRDIM];
+    __shared__ rocsparse_int sdiag[NBLOCKS];
+
+    T*             A    = sdata + lid * BSRDIM * BSRDIM;
+    rocsparse_int* perm = sperm + lid * BSRDIM;
+
+    if(active && idx == 0)
+    {
+        sdiag[lid] = -1;
+
+        // Block diagonal structure of the inverse
+        inv_row_ptr[row] = row + idx_base;
+        inv_col_ind[row] = row + idx_base;
+
+        if(row == mb - 1)
+        {
+            inv_row_ptr[mb] = mb + idx_base;
+        }
+    }
+
+    __syncthreads();
+
+    // Search the diagonal block of the current BSR row
+    if(active)
+    {
+        rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+        for(rocsparse_int j = row_begin + idx; j < row_end; j += BSRDIM * BSRDIM)
+        {
+            if(bsr_col_ind[j] - idx_base == row)
+            {
+                sdiag[lid] = j;
+            }
+        }
+    }
+
+    __syncthreads();
+
+    // Load the diagonal block into shared memory, a missing diagonal block is zero
+    if(active)
+    {
+        rocsparse_int diag = sdiag[lid];
+
+        T val = (r == c) ? static_cast<T>(1) : static_cast<T>(0);
+
+        if(r < block_dim && c < block_dim)
+        {
+            val = (diag == -1) ? static_cast<T>(0)
+                               : bsr_val[block_dim * block_dim * diag
+                                         + ((dir == rocsparse_direction_row) ? block_dim * r + c
+                                                                             : block_dim * c + r)];
+        }
+
+        A[BSRDIM * r + c] = val;
+    }
+
+    __syncthreads();
+
+    for(rocsparse_int k = 0; k < block_dim; ++k)
+    {
+        // Determine the pivot row
+        if(active && idx == 0)
+        {
+            rocsparse_int p = k;
+
+            if(pivot)
+            {
+                auto pmax = rocsparse_abs(A[BSRDIM * k + k]);
+
+                for(rocsparse_int i = k + 1; i < block_dim; ++i)
+                {
+                    auto val = rocsparse_abs(A[BSRDIM * i + k]);
+
+                    if(val > pmax)
+                    {
+                        pmax = val;
+                        p    = i;
+                    }
+                }
+            }
+
+            // Singular diagonal blocks are reported by their BSR row
+            if(A[BSRDIM * p + k] == static_cast<T>(0))
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            perm[k] = p;
+        }
+
+        __syncthreads();
+
+        // Interchange rows k and p
+        if(active && r == k && perm[k] != k)
+        {
+            rocsparse_int p = perm[k];
+
+            T tmp             = A[BSRDIM * p + c];
+            A[BSRDIM * p + c] = A[BSRDIM * k + c];
+            A[BSRDIM * k + c] = tmp;
+        }
+
+        __syncthreads();
+
+        // Scale the pivot row and eliminate column k from all other rows
+        T akc;
+        T ark;
+        T arc;
+
+        if(active)
+        {
+            T inv = static_cast<T>(1) / A[BSRDIM * k + k];
+
+            akc = (c == k) ? inv : A[BSRDIM * k + c] * inv;
+            ark = A[BSRDIM * r + k];
+            arc = (c == k) ? static_cast<T>(0) : A[BSRDIM * r + c];
+        }
+
+        __syncthreads();
+
+        if(active)
+        {
+            A[BSRDIM * r + c] = (r == k) ? akc : arc - ark * akc;
+        }
+
+        __syncthreads();
+    }
+
+    // Undo the row interchanges by interchanging the columns in reverse order
+    if(pivot)
+    {
+        for(rocsparse_int k = block_dim - 1; k >= 0; --k)
+        {
+            if(active && c == k && perm[k] != k)
+            {
+                rocsparse_int p = perm[k];
+
+                T tmp             = A[BSRDIM * r + p];
+                A[BSRDIM * r + p] = A[BSRDIM * r + k];
+                A[BSRDIM * r + k] = tmp;
+            }
+
+            __syncthreads();
+        }
+    }
+
+    // Write the inverse diagonal block back to global memory
+    if(active && r < block_dim && c < block_dim)
+    {
+        inv_val[block_dim * block_dim * row
+                + ((dir == rocsparse_direction_row) ? block_dim * r + c : block_dim * c + r)]
+            = A[BSRDIM * r + c];
+    }
+}
+
+// Computes y = alpha * D^{-1} * x + beta * y, where D^{-1} is the block diagonal matrix
+// of inverted diagonal blocks. The block diagonal structure is implicit, such that no
+// row pointer or column index has to be read, and each thread computes a single entry of y.
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void bsrdiag_inverse_apply_device(rocsparse_direction dir,
+                                             rocsparse_int       mb,
+                                             rocsparse_int       block_dim,
+                                             T                   alpha,
+                                             const T* __restrict__ inv_val,
+                                             const T* __restrict__ x,
+                                             T beta,
+                                             T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= mb * block_dim)
+    {
+        return;
+    }
+
+    // BSR row and row within the diagonal block
+    rocsparse_int row = gid / block_dim;
+    rocsparse_int r   = gid % block_dim;
+
+    const T* val = inv_val + block_dim * block_dim * row;
+    const T* xr  = x + block_dim * row;
+
+    T sum = static_cast<T>(0);
+
+    if(dir == rocsparse_direction_row)
+    {
+        for(rocsparse_int c = 0; c < block_dim; ++c)
+        {
+            sum = rocsparse_fma(val[block_dim * r + c], xr[c], sum);
+        }
+    }
+    else
+    {
+        for(rocsparse_int c = 0; c < block_dim; ++c)
+        {
+            sum = rocsparse_fma(val[block_dim * c + r], xr[c], sum);
+        }
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        y[gid] = rocsparse_fma(beta, y[gid], alpha * sum);
+    }
+    else
+    {
+        y[gid] = alpha * sum;
+    }
+}
+
+// Specialization for the block dimensions 2, 3, 4, 5, 8 and 16, such that the
+// loops over the diagonal block can be fully unrolled
+template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void bsrdiag_inverse_apply_kernel(rocsparse_direction dir,
+                                      rocsparse_int       mb,
+                                      U                   alpha_device_host,
+                                      const T* __restrict__ inv_val,
+                                      const T* __restrict__ x,
+                                      U beta_device_host,
+                                      T* __restrict__ y)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        bsrdiag_inverse_apply_device<BLOCKSIZE>(dir, mb, BSRDIM, alpha, inv_val, x, beta, y);
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void bsrdiag_inverse_apply_general_kernel(rocsparse_direction dir,
+                                              rocsparse_int       mb,
+                                              rocsparse_int       block_dim,
+                                              U                   alpha_device_host,
+                                              const T* __restrict__ inv_val,
+                                              const T* __restrict__ x,
+                                              U beta_device_host,
+                                              T* __restrict__ y)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+    if(alpha != static_cast<T>(0) || beta != static_cast<T>(1))
+    {
+        bsrdiag_inverse_apply_device<BLOCKSIZE>(dir, mb, block_dim, alpha, inv_val, x, beta, y);
+    }
+}
+
+#endif // BSRDIAG_INVERSE_DEVICE_H
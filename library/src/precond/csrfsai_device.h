@@ -0,0 +1,248 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRFSAI_DEVICE_H
+#define CSRFSAI_DEVICE_H
+
+#include "common.h"
+
+// Returns the position of the first entry of a sorted row with column index >= col
+__device__ __forceinline__ rocsparse_int csrfsai_lower_bound(rocsparse_int col,
+                                                             const rocsparse_int* __restrict__ ind,
+                                                             rocsparse_int        begin,
+                                                             rocsparse_int        end,
+                                                             rocsparse_index_base idx_base)
+{
+    while(begin < end)
+    {
+        rocsparse_int mid = begin + ((end - begin) >> 1);
+
+        if(ind[mid] - idx_base < col)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    return begin;
+}
+
+// Each row of G keeps the strictly lower entries of the corresponding row of S that are
+// closest to the diagonal, plus the diagonal entry, such that it has at most MAXDIM entries.
+// Rows of S with more strictly lower entries are counted in truncated_rows.
+template <unsigned int BLOCKSIZE, unsigned int MAXDIM>
+__device__ void csrfsai_nnz_device(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_S,
+                                   const rocsparse_int* __restrict__ csr_col_ind_S,
+                                   rocsparse_index_base idx_base_S,
+                                   rocsparse_int* __restrict__ nnz_per_row,
+                                   rocsparse_int* __restrict__ truncated_rows)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr_S[row] - idx_base_S;
+    rocsparse_int row_end   = csr_row_ptr_S[row + 1] - idx_base_S;
+
+    rocsparse_int nlower
+        = csrfsai_lower_bound(row, csr_col_ind_S, row_begin, row_end, idx_base_S) - row_begin;
+
+    if(nlower >= MAXDIM)
+    {
+        atomicAdd(truncated_rows, 1);
+    }
+
+    nnz_per_row[row] = min(nlower, static_cast<rocsparse_int>(MAXDIM - 1)) + 1;
+}
+
+// Computes a single row i of the FSAI factor G, where each row is processed by a wavefront.
+// With J the sparsity pattern of row i, the dense system A(J,J) g = e_i is gathered into
+// shared memory, where lane r holds local row r, and solved by Gaussian elimination without
+// pivoting. For A symmetric (hermitian) positive definite, G(i,J) = conj(g) / sqrt(g_i).
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrfsai_device(rocsparse_int m,
+                               const rocsparse_int* __restrict__ csr_row_ptr_A,
+                               const rocsparse_int* __restrict__ csr_col_ind_A,
+                               const T* __restrict__ csr_val_A,
+                               const rocsparse_int* __restrict__ csr_row_ptr_S,
+                               const rocsparse_int* __restrict__ csr_col_ind_S,
+                               const rocsparse_int* __restrict__ csr_row_ptr_G,
+                               rocsparse_int* __restrict__ csr_col_ind_G,
+                               T* __restrict__ csr_val_G,
+                               rocsparse_int* __restrict__ zero_pivot,
+                               rocsparse_index_base idx_base_A,
+                               rocsparse_index_base idx_base_S,
+                               rocsparse_index_base idx_base_G)
+{
+    // Number of rows processed by each thread block
+    static constexpr unsigned int NROWS = BLOCKSIZE / WFSIZE;
+
+    // Local system of each wavefront, padded to avoid bank conflicts
+    static constexpr unsigned int LDA = WFSIZE + 1;
+
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * NROWS + wid;
+
+    __shared__ T             sdata[NROWS * WFSIZE * LDA];
+    __shared__ rocsparse_int scol[NROWS * WFSIZE];
+
+    // Each wavefront works independently, no block synchronization required
+    if(row >= m)
+    {
+        return;
+    }
+
+    T*             A   = sdata + wid * WFSIZE * LDA;
+    rocsparse_int* col = scol + wid * WFSIZE;
+
+    rocsparse_int G_begin = csr_row_ptr_G[row] - idx_base_G;
+    rocsparse_int n       = csr_row_ptr_G[row + 1] - idx_base_G - G_begin;
+
+    // Sparsity pattern of G, which is the diagonal and the last n - 1 strictly lower
+    // entries of S
+    rocsparse_int S_begin = csr_row_ptr_S[row] - idx_base_S;
+    rocsparse_int S_end   = csr_row_ptr_S[row + 1] - idx_base_S;
+    rocsparse_int S_diag  = csrfsai_lower_bound(row, csr_col_ind_S, S_begin, S_end, idx_base_S);
+
+    if(lid < n)
+    {
+        rocsparse_int c = (lid == n - 1) ? row : csr_col_ind_S[S_diag - n + 1 + lid] - idx_base_S;
+
+        col[lid]                     = c;
+        csr_col_ind_G[G_begin + lid] = c + idx_base_G;
+    }
+
+    for(unsigned int k = 0; k < WFSIZE; ++k)
+    {
+        A[LDA * lid + k] = static_cast<T>(0);
+    }
+
+    __threadfence_block();
+
+    // Gather A(J,J), each lane scans the row of A that belongs to its local row
+    if(lid < n)
+    {
+        rocsparse_int A_row   = col[lid];
+        rocsparse_int A_begin = csr_row_ptr_A[A_row] - idx_base_A;
+        rocsparse_int A_end   = csr_row_ptr_A[A_row + 1] - idx_base_A;
+
+        for(rocsparse_int j = A_begin; j < A_end; ++j)
+        {
+            rocsparse_int c = csr_col_ind_A[j] - idx_base_A;
+
+            if(c < col[0] || c > row)
+            {
+                continue;
+            }
+
+            rocsparse_int k = csrfsai_lower_bound(c, col, 0, n, rocsparse_index_base_zero);
+
+            if(k < n && col[k] == c)
+            {
+                A[LDA * lid + k] = csr_val_A[j];
+            }
+        }
+    }
+
+    __threadfence_block();
+
+    // Forward elimination. The right hand side e_i is not modified, because i is the
+    // last local row.
+    bool singular = false;
+
+    for(rocsparse_int k = 0; k < n; ++k)
+    {
+        T akk = A[LDA * k + k];
+
+        if(akk == static_cast<T>(0))
+        {
+            singular = true;
+            break;
+        }
+
+        if(lid > k && lid < n)
+        {
+            T f = A[LDA * lid + k] / akk;
+
+            for(rocsparse_int c = k + 1; c < n; ++c)
+            {
+                A[LDA * lid + c] = rocsparse_fma(-f, A[LDA * k + c], A[LDA * lid + c]);
+            }
+        }
+
+        __threadfence_block();
+    }
+
+    // Backward substitution, lane r holds the r-th entry of the solution
+    T x = (lid == n - 1) ? static_cast<T>(1) : static_cast<T>(0);
+
+    if(!singular)
+    {
+        for(rocsparse_int k = n - 1; k >= 0; --k)
+        {
+            T xk = rocsparse_shfl(x, k, WFSIZE) / A[LDA * k + k];
+
+            if(lid == k)
+            {
+                x = xk;
+            }
+            else if(lid < k)
+            {
+                x = rocsparse_fma(-A[LDA * lid + k], xk, x);
+            }
+        }
+    }
+
+    // Diagonal entry of the inverse of A(J,J), which is positive for positive definite A
+    auto gii = rocsparse_real(rocsparse_shfl(x, n - 1, WFSIZE));
+
+    if(singular || !(gii > 0))
+    {
+        // Rows that cannot be computed fall back to the unit row
+        if(lid == 0)
+        {
+            atomicMin(zero_pivot, row + idx_base_A);
+        }
+
+        x   = (lid == n - 1) ? static_cast<T>(1) : static_cast<T>(0);
+        gii = 1;
+    }
+
+    if(lid < n)
+    {
+        csr_val_G[G_begin + lid] = rocsparse_conj(x) * static_cast<T>(1 / sqrt(gii));
+    }
+}
+
+#endif // CSRFSAI_DEVICE_H
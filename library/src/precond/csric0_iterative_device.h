@@ -0,0 +1,246 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRIC0_ITERATIVE_DEVICE_H
+#define CSRIC0_ITERATIVE_DEVICE_H
+
+#include "common.h"
+
+// Computes sum_{k < j} l_ik * conj(l_jk) for entry (i, j) by merging rows i and j, where
+// L is taken from the current iterate x
+template <typename T>
+__device__ __forceinline__ T csric0_iterative_sum(rocsparse_int col,
+                                                  rocsparse_int row_begin,
+                                                  rocsparse_int row_end,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const T* __restrict__ x,
+                                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int k     = row_begin;
+    rocsparse_int l     = csr_row_ptr[col] - idx_base;
+    rocsparse_int l_end = csr_row_ptr[col + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    while(k < row_end && l < l_end)
+    {
+        rocsparse_int col_k = csr_col_ind[k] - idx_base;
+        rocsparse_int col_l = csr_col_ind[l] - idx_base;
+
+        // Columns are sorted, thus all remaining entries are out of range
+        if(col_k >= col || col_l >= col)
+        {
+            break;
+        }
+
+        if(col_k == col_l)
+        {
+            sum = rocsparse_fma(x[k], rocsparse_conj(x[l]), sum);
+
+            ++k;
+            ++l;
+        }
+        else if(col_k < col_l)
+        {
+            ++k;
+        }
+        else
+        {
+            ++l;
+        }
+    }
+
+    return sum;
+}
+
+// Initial guess, where L is the lower part of A scaled by the square root of the
+// diagonal of A
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csric0_iterative_init_device(rocsparse_int m,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const T* __restrict__ a_val,
+                                             T* __restrict__ x,
+                                             const rocsparse_int* __restrict__ csr_diag_ind,
+                                             rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+        T             val = a_val[j];
+
+        if(col == row)
+        {
+            val = static_cast<T>(sqrt(rocsparse_abs(val)));
+        }
+        else if(col < row)
+        {
+            rocsparse_int diag  = csr_diag_ind[col];
+            T             pivot = (diag == -1) ? static_cast<T>(0) : a_val[diag];
+
+            if(pivot != static_cast<T>(0))
+            {
+                val = val / static_cast<T>(sqrt(rocsparse_abs(pivot)));
+            }
+        }
+
+        x[j] = val;
+    }
+}
+
+// Fixed-point sweep, where each entry of the new iterate is computed from the previous
+// iterate only. Entries with zero pivot keep their previous value, the strictly upper
+// part is not modified.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csric0_iterative_sweep_device(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ a_val,
+                                              const T* __restrict__ x_old,
+                                              T* __restrict__ x_new,
+                                              const rocsparse_int* __restrict__ csr_diag_ind,
+                                              rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col > row)
+        {
+            x_new[j] = x_old[j];
+            continue;
+        }
+
+        T sum = csric0_iterative_sum(
+            col, row_begin, row_end, csr_row_ptr, csr_col_ind, x_old, idx_base);
+
+        sum = a_val[j] - sum;
+
+        if(col == row)
+        {
+            // Diagonal entry
+            x_new[j] = static_cast<T>(sqrt(rocsparse_abs(sum)));
+        }
+        else
+        {
+            // Strictly lower entry
+            rocsparse_int diag  = csr_diag_ind[col];
+            T             pivot = (diag == -1) ? static_cast<T>(0) : x_old[diag];
+
+            x_new[j] = (pivot != static_cast<T>(0)) ? sum / pivot : x_old[j];
+        }
+    }
+}
+
+// Squared residual (A - LL^H)_ij of each entry of the lower part of the sparsity
+// pattern. Zero pivots of the final iterate are reported.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csric0_iterative_residual_device(rocsparse_int m,
+                                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                                 const T* __restrict__ a_val,
+                                                 const T* __restrict__ x,
+                                                 const rocsparse_int* __restrict__ csr_diag_ind,
+                                                 floating_data_t<T>* __restrict__ residual,
+                                                 rocsparse_int* __restrict__ zero_pivot,
+                                                 rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col > row)
+        {
+            residual[j] = static_cast<floating_data_t<T>>(0);
+            continue;
+        }
+
+        // (LL^H)_ij of the current iterate
+        T sum = csric0_iterative_sum(
+            col, row_begin, row_end, csr_row_ptr, csr_col_ind, x, idx_base);
+
+        rocsparse_int diag = csr_diag_ind[col];
+
+        if(diag != -1)
+        {
+            sum = rocsparse_fma(x[j], rocsparse_conj(x[diag]), sum);
+        }
+
+        if(col == row && x[j] == static_cast<T>(0))
+        {
+            atomicMin(zero_pivot, row + idx_base);
+        }
+
+        floating_data_t<T> abs_res = rocsparse_abs(a_val[j] - sum);
+
+        residual[j] = abs_res * abs_res;
+    }
+}
+
+#endif // CSRIC0_ITERATIVE_DEVICE_H
@@ -0,0 +1,470 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRILDL0_DEVICE_H
+#define CSRILDL0_DEVICE_H
+
+#include "common.h"
+
+// The factorization A = L * D * L^T is computed row by row, where each wavefront processes
+// a single row. During the computation of a row, its strictly lower entries hold
+// W_ij = L_ij * D_jj, such that the dot products with the rows it depends on do not need
+// to load the pivots D_kk. Once the row is complete, W is scaled by the pivots to obtain L.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int HASH, typename T, typename U>
+__device__ void csrildl0_hash_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     T* __restrict__ csr_val,
+                                     const rocsparse_int* __restrict__ csr_diag_ind,
+                                     int* __restrict__ done,
+                                     const rocsparse_int* __restrict__ map,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base,
+                                     int                  boost,
+                                     U                    boost_tol,
+                                     T                    boost_val)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    __shared__ rocsparse_int stable[BLOCKSIZE * HASH];
+    __shared__ rocsparse_int sdata[BLOCKSIZE * HASH];
+
+    // Pointer to each wavefronts shared data
+    rocsparse_int* table = &stable[wid * WFSIZE * HASH];
+    rocsparse_int* data  = &sdata[wid * WFSIZE * HASH];
+
+    // Initialize hash table with -1
+    for(unsigned int j = lid; j < WFSIZE * HASH; j += WFSIZE)
+    {
+        table[j] = -1;
+    }
+
+    __threadfence_block();
+
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // End of the processed entries, which is only less than row_diag on a zero pivot
+    rocsparse_int row_stop = row_diag;
+
+    // Pivot sum accumulator
+    T sum = static_cast<T>(0);
+
+    // Fill hash table
+    // Loop over columns of current row and fill hash table with row dependencies
+    // Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        // Insert key into hash table
+        rocsparse_int key = csr_col_ind[j];
+        // Compute hash
+        rocsparse_int hash = (key * 103) & (WFSIZE * HASH - 1);
+
+        // Hash operation
+        while(true)
+        {
+            if(table[hash] == key)
+            {
+                // key is already inserted, done
+                break;
+            }
+            else if(atomicCAS(&table[hash], -1, key) == -1)
+            {
+                // inserted key into the table, done
+                data[hash] = j;
+                break;
+            }
+            else
+            {
+                // collision, compute new hash
+                hash = (hash + 1) & (WFSIZE * HASH - 1);
+            }
+        }
+    }
+
+    __threadfence_block();
+
+    // Loop over column of current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        // Beginning of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            row_stop = j;
+            break;
+        }
+
+        // Spin loop until dependency has been resolved
+        while(!atomicOr(&done[local_col], 0))
+            ;
+
+        // Make sure updated csr_val is visible globally
+        __threadfence();
+
+        // Load diagonal entry
+        T diag_val = csr_val[local_diag];
+
+        // Numerical zero pivot, which has been reported by row local_col
+        if(diag_val == static_cast<T>(0))
+        {
+            row_stop = j;
+            break;
+        }
+
+        // Local row sum
+        T local_sum = static_cast<T>(0);
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WFSIZE)
+        {
+            // Get value from hash table
+            rocsparse_int key = csr_col_ind[k];
+
+            // Compute hash
+            rocsparse_int hash = (key * 103) & (WFSIZE * HASH - 1);
+
+            // Hash operation
+            while(true)
+            {
+                if(table[hash] == -1)
+                {
+                    // No entry for the key, done
+                    break;
+                }
+                else if(table[hash] == key)
+                {
+                    // Entry found, accumulate L_jk * L_ik * D_kk
+                    rocsparse_int idx = data[hash];
+                    local_sum         = rocsparse_fma(csr_val[k], csr_val[idx], local_sum);
+                    break;
+                }
+                else
+                {
+                    // Collision, compute new hash
+                    hash = (hash + 1) & (WFSIZE * HASH - 1);
+                }
+            }
+        }
+
+        // Accumulate row sum
+        local_sum = rocsparse_wfreduce_sum<WFSIZE>(local_sum);
+
+        // Last lane id computes W_ij and writes it to global memory
+        if(lid == WFSIZE - 1)
+        {
+            local_val -= local_sum;
+            sum = rocsparse_fma(local_val, local_val / diag_val, sum);
+
+            csr_val[j] = local_val;
+        }
+    }
+
+    __threadfence_block();
+
+    // Scale the row by the pivots, L_ij = W_ij / D_jj
+    for(rocsparse_int j = row_begin + lid; j < row_stop; j += WFSIZE)
+    {
+        csr_val[j] = csr_val[j] / csr_val[csr_diag_ind[csr_col_ind[j] - idx_base]];
+    }
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane processes the diagonal entry
+        if(row_diag >= 0)
+        {
+            T diag_val = csr_val[row_diag] - sum;
+
+            // Numeric boost
+            if(boost)
+            {
+                diag_val = (boost_tol >= rocsparse_abs(diag_val)) ? boost_val : diag_val;
+            }
+
+            // Row has numerical zero pivot
+            if(diag_val == static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            csr_val[row_diag] = diag_val;
+        }
+    }
+
+    // Make sure csr_val is written to global memory
+    __threadfence();
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane writes "we are done" flag
+        atomicOr(&done[row], 1);
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool SLEEP, typename T, typename U>
+__device__ void csrildl0_binsearch_kernel(rocsparse_int m,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          T* __restrict__ csr_val,
+                                          const rocsparse_int* __restrict__ csr_diag_ind,
+                                          int* __restrict__ done,
+                                          const rocsparse_int* __restrict__ map,
+                                          rocsparse_int* __restrict__ zero_pivot,
+                                          rocsparse_index_base idx_base,
+                                          int                  boost,
+                                          U                    boost_tol,
+                                          T                    boost_val)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Current row this wavefront is working on
+    rocsparse_int row = map[idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // End of the processed entries, which is only less than row_diag on a zero pivot
+    rocsparse_int row_stop = row_diag;
+
+    // Pivot sum accumulator
+    T sum = static_cast<T>(0);
+
+    // Loop over column of current row
+    for(rocsparse_int j = row_begin; j < row_diag; ++j)
+    {
+        // Column index currently being processes
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        // Beginning of the row that corresponds to local_col
+        rocsparse_int local_begin = csr_row_ptr[local_col] - idx_base;
+
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+
+        // Structural zero pivot, do not process this row
+        if(local_diag == -1)
+        {
+            row_stop = j;
+            break;
+        }
+
+        // Spin loop until dependency has been resolved
+        int          local_done    = atomicOr(&done[local_col], 0);
+        unsigned int times_through = 0;
+        while(!local_done)
+        {
+            if(SLEEP)
+            {
+                for(unsigned int i = 0; i < times_through; ++i)
+                {
+                    __builtin_amdgcn_s_sleep(1);
+                }
+
+                if(times_through < 3907)
+                {
+                    ++times_through;
+                }
+            }
+
+            local_done = atomicOr(&done[local_col], 0);
+        }
+
+        // Make sure updated csr_val is visible globally
+        __threadfence();
+
+        // Load diagonal entry
+        T diag_val = csr_val[local_diag];
+
+        // Numerical zero pivot, which has been reported by row local_col
+        if(diag_val == static_cast<T>(0))
+        {
+            row_stop = j;
+            break;
+        }
+
+        // Local row sum
+        T local_sum = static_cast<T>(0);
+
+        // Loop over the row the current column index depends on
+        // Each lane processes one entry
+        rocsparse_int l = row_begin;
+        for(rocsparse_int k = local_begin + lid; k < local_diag; k += WFSIZE)
+        {
+            // Perform a binary search to find matching columns
+            rocsparse_int r     = row_end - 1;
+            rocsparse_int m     = (r + l) >> 1;
+            rocsparse_int col_j = csr_col_ind[m];
+
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Binary search
+            while(l < r)
+            {
+                if(col_j < col_k)
+                {
+                    l = m + 1;
+                }
+                else
+                {
+                    r = m;
+                }
+
+                m     = (r + l) >> 1;
+                col_j = csr_col_ind[m];
+            }
+
+            // Check if a match has been found
+            if(col_j == col_k)
+            {
+                // If a match has been found, accumulate L_jk * L_ik * D_kk
+                local_sum = rocsparse_fma(csr_val[k], csr_val[m], local_sum);
+            }
+        }
+
+        // Accumulate row sum
+        local_sum = rocsparse_wfreduce_sum<WFSIZE>(local_sum);
+
+        // Last lane id computes W_ij and writes it to global memory
+        if(lid == WFSIZE - 1)
+        {
+            local_val -= local_sum;
+            sum = rocsparse_fma(local_val, local_val / diag_val, sum);
+
+            csr_val[j] = local_val;
+        }
+    }
+
+    __threadfence_block();
+
+    // Scale the row by the pivots, L_ij = W_ij / D_jj
+    for(rocsparse_int j = row_begin + lid; j < row_stop; j += WFSIZE)
+    {
+        csr_val[j] = csr_val[j] / csr_val[csr_diag_ind[csr_col_ind[j] - idx_base]];
+    }
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane processes the diagonal entry
+        if(row_diag >= 0)
+        {
+            T diag_val = csr_val[row_diag] - sum;
+
+            // Numeric boost
+            if(boost)
+            {
+                diag_val = (boost_tol >= rocsparse_abs(diag_val)) ? boost_val : diag_val;
+            }
+
+            // Row has numerical zero pivot
+            if(diag_val == static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            csr_val[row_diag] = diag_val;
+        }
+    }
+
+    // Make sure csr_val is written to global memory
+    __threadfence();
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane writes "we are done" flag
+        atomicOr(&done[row], 1);
+    }
+}
+
+// Scale x by the inverse of the pivots D, as part of the solve with L * D * L^T
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void csrildl0_diag_scale_device(rocsparse_int m,
+                                           const T* __restrict__ csr_val,
+                                           const rocsparse_int* __restrict__ csr_diag_ind,
+                                           T* __restrict__ x)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_diag = csr_diag_ind[row];
+
+    // Skip rows with structural zero pivot
+    if(row_diag != -1)
+    {
+        x[row] = x[row] / csr_val[row_diag];
+    }
+}
+
+#endif // CSRILDL0_DEVICE_H
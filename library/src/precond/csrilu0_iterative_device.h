@@ -0,0 +1,264 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRILU0_ITERATIVE_DEVICE_H
+#define CSRILU0_ITERATIVE_DEVICE_H
+
+#include "common.h"
+
+// Position of col within the sorted column indices [begin, end), -1 if not present
+__device__ __forceinline__ rocsparse_int
+    csrilu0_iterative_find(rocsparse_int col,
+                           rocsparse_int begin,
+                           rocsparse_int end,
+                           const rocsparse_int* __restrict__ csr_col_ind)
+{
+    while(begin < end)
+    {
+        rocsparse_int mid = (begin + end) >> 1;
+        rocsparse_int key = csr_col_ind[mid];
+
+        if(key == col)
+        {
+            return mid;
+        }
+        else if(key < col)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    return -1;
+}
+
+// Computes sum_{k < min(i, j)} l_ik * u_kj for entry (i, j), where L and U are taken
+// from the current iterate x
+template <typename T>
+__device__ __forceinline__ T csrilu0_iterative_sum(rocsparse_int row,
+                                                   rocsparse_int col,
+                                                   rocsparse_int row_begin,
+                                                   rocsparse_int row_end,
+                                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                                   const T* __restrict__ x,
+                                                   const rocsparse_int* __restrict__ csr_diag_ind,
+                                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int lim = min(row, col);
+    T             sum = static_cast<T>(0);
+
+    for(rocsparse_int k = row_begin; k < row_end; ++k)
+    {
+        rocsparse_int local_col = csr_col_ind[k] - idx_base;
+
+        // Columns are sorted, thus all remaining entries are out of range
+        if(local_col >= lim)
+        {
+            break;
+        }
+
+        // u_kj is located right of the diagonal of row k
+        rocsparse_int local_diag = csr_diag_ind[local_col];
+        rocsparse_int local_end  = csr_row_ptr[local_col + 1] - idx_base;
+
+        if(local_diag == -1)
+        {
+            local_diag = csr_row_ptr[local_col] - idx_base - 1;
+        }
+
+        rocsparse_int idx
+            = csrilu0_iterative_find(col + idx_base, local_diag + 1, local_end, csr_col_ind);
+
+        if(idx != -1)
+        {
+            sum = rocsparse_fma(x[k], x[idx], sum);
+        }
+    }
+
+    return sum;
+}
+
+// Initial guess, where L is the strictly lower part of A scaled by the diagonal of A
+// and U is the upper part of A
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrilu0_iterative_init_device(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ a_val,
+                                              T* __restrict__ x,
+                                              const rocsparse_int* __restrict__ csr_diag_ind,
+                                              rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+        T             val = a_val[j];
+
+        if(col < row)
+        {
+            rocsparse_int diag  = csr_diag_ind[col];
+            T             pivot = (diag == -1) ? static_cast<T>(0) : a_val[diag];
+
+            if(pivot != static_cast<T>(0))
+            {
+                val = val / pivot;
+            }
+        }
+
+        x[j] = val;
+    }
+}
+
+// Fixed-point sweep, where each entry of the new iterate is computed from the previous
+// iterate only. Entries with zero pivot keep their previous value.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrilu0_iterative_sweep_device(rocsparse_int m,
+                                               const rocsparse_int* __restrict__ csr_row_ptr,
+                                               const rocsparse_int* __restrict__ csr_col_ind,
+                                               const T* __restrict__ a_val,
+                                               const T* __restrict__ x_old,
+                                               T* __restrict__ x_new,
+                                               const rocsparse_int* __restrict__ csr_diag_ind,
+                                               rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Each lane processes one entry
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        T sum = csrilu0_iterative_sum(
+            row, col, row_begin, row_end, csr_row_ptr, csr_col_ind, x_old, csr_diag_ind, idx_base);
+
+        sum = a_val[j] - sum;
+
+        if(col < row)
+        {
+            // Entry of L
+            rocsparse_int diag  = csr_diag_ind[col];
+            T             pivot = (diag == -1) ? static_cast<T>(0) : x_old[diag];
+
+            x_new[j] = (pivot != static_cast<T>(0)) ? sum / pivot : x_old[j];
+        }
+        else
+        {
+            // Entry of U
+            x_new[j] = sum;
+        }
+    }
+}
+
+// Squared residual (A - LU)_ij of each entry of the sparsity pattern. Zero pivots of the
+// final iterate are reported.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrilu0_iterative_residual_device(rocsparse_int m,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const T* __restrict__ a_val,
+                                                  const T* __restrict__ x,
+                                                  const rocsparse_int* __restrict__ csr_diag_ind,
+                                                  floating_data_t<T>* __restrict__ residual,
+                                                  rocsparse_int* __restrict__ zero_pivot,
+                                                  rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // (LU)_ij of the current iterate
+        T sum = csrilu0_iterative_sum(
+            row, col, row_begin, row_end, csr_row_ptr, csr_col_ind, x, csr_diag_ind, idx_base);
+
+        if(col < row)
+        {
+            rocsparse_int diag = csr_diag_ind[col];
+
+            if(diag != -1)
+            {
+                sum = rocsparse_fma(x[j], x[diag], sum);
+            }
+        }
+        else
+        {
+            sum += x[j];
+
+            if(col == row && x[j] == static_cast<T>(0))
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+        }
+
+        floating_data_t<T> abs_res = rocsparse_abs(a_val[j] - sum);
+
+        residual[j] = abs_res * abs_res;
+    }
+}
+
+#endif // CSRILU0_ITERATIVE_DEVICE_H
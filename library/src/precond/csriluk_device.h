@@ -0,0 +1,223 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRILUK_DEVICE_H
+#define CSRILUK_DEVICE_H
+
+#include "../extra/csrgemm_device.h"
+#include "common.h"
+
+// Compute a single level-of-fill pass of the ILU(k) symbolic factorization, where each
+// row is processed by a single block, see csrgemm_symbolic_chunked_block_per_row_device().
+// An entry (i, j) with level lev_ij is added, if there exists an index l < min(i, j), such
+// that lev_ij = lev_il + lev_lj + 1 does not exceed the maximum level of fill. Each pass
+// extends the fill paths that have been found so far by at least one edge, thus k passes
+// are sufficient to obtain the full ILU(k) pattern. The chunk table holds the level of
+// each entry, where lfil + 1 marks an empty entry.
+// If FILL is false, the number of non-zero entries of each row is written to
+// csr_row_ptr_B, otherwise the column indices and levels of B are written. If the
+// levels of A are not available, all entries of A are considered to be of level 0.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE, bool FILL>
+__device__ void
+    csriluk_symbolic_block_per_row_device(rocsparse_int m,
+                                          rocsparse_int lfil,
+                                          const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                          const rocsparse_int* __restrict__ csr_col_ind_A,
+                                          const int* __restrict__ csr_lev_A,
+                                          rocsparse_int* __restrict__ csr_row_ptr_B,
+                                          rocsparse_int* __restrict__ csr_col_ind_B,
+                                          int* __restrict__ csr_lev_B,
+                                          rocsparse_index_base idx_base_A,
+                                          rocsparse_index_base idx_base_B)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Offset into B
+    rocsparse_int row_begin_B = (FILL == true) ? csr_row_ptr_B[row] - idx_base_B : 0;
+
+    // Mark the entries and the fill of the current chunk with their minimum level
+    auto mark = [&](rocsparse_int  chunk_begin,
+                    rocsparse_int  chunk_end,
+                    int*           table,
+                    rocsparse_int& min_col) {
+        // Loop over columns of A in current row
+        for(rocsparse_int j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column and level of A in current row
+            rocsparse_int col_A = csr_col_ind_A[j] - idx_base_A;
+            int           lev_A = (csr_lev_A != nullptr) ? csr_lev_A[j] : 0;
+
+            // Entries of the current row are always kept
+            if(lid == 0)
+            {
+                if(col_A >= chunk_end)
+                {
+                    min_col = min(min_col, col_A);
+                }
+                else if(col_A >= chunk_begin)
+                {
+                    atomicMin(&table[col_A - chunk_begin], lev_A);
+                }
+            }
+
+            // Only entries of the strictly lower part can create fill, as long as
+            // their level does not exceed the maximum level of fill
+            if(col_A >= row || lev_A >= lfil)
+            {
+                continue;
+            }
+
+            // Loop over the strictly upper part of row col_A
+            rocsparse_int row_begin = csr_row_ptr_A[col_A] - idx_base_A;
+            rocsparse_int row_end   = csr_row_ptr_A[col_A + 1] - idx_base_A;
+
+            for(rocsparse_int k = row_begin + lid; k < row_end; k += WFSIZE)
+            {
+                rocsparse_int col = csr_col_ind_A[k] - idx_base_A;
+
+                if(col <= col_A)
+                {
+                    continue;
+                }
+
+                int lev = lev_A + ((csr_lev_A != nullptr) ? csr_lev_A[k] : 0) + 1;
+
+                if(lev > lfil)
+                {
+                    continue;
+                }
+
+                if(col >= chunk_end)
+                {
+                    // Columns are sorted, thus the remaining columns are part of
+                    // subsequent chunks
+                    min_col = min(min_col, col);
+                    break;
+                }
+
+                if(col >= chunk_begin)
+                {
+                    atomicMin(&table[col - chunk_begin], lev);
+                }
+            }
+        }
+    };
+
+    // Write the column indices and levels of B
+    auto write = [&](rocsparse_int pos, rocsparse_int col, int lev) {
+        csr_col_ind_B[row_begin_B + pos] = col + idx_base_B;
+
+        if(csr_lev_B != nullptr)
+        {
+            csr_lev_B[row_begin_B + pos] = lev;
+        }
+    };
+
+    rocsparse_int row_nnz
+        = csrgemm_symbolic_chunked_block_per_row_device<BLOCKSIZE, CHUNKSIZE, FILL, rocsparse_int>(
+            m, lfil + 1, mark, write);
+
+    // Write row nnz to global memory
+    if(FILL == false && hipThreadIdx_x == 0)
+    {
+        csr_row_ptr_B[row] = row_nnz;
+    }
+}
+
+// Initialize the values of the ILU(k) pattern B with the values of A, where each row is
+// processed by a single (sub)wavefront. Fill-in entries are set to zero. Both patterns
+// are sorted and the pattern of B contains the pattern of A.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csriluk_fill_values_device(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_A,
+                                           const rocsparse_int* __restrict__ csr_col_ind_A,
+                                           const T* __restrict__ csr_val_A,
+                                           const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                           const rocsparse_int* __restrict__ csr_col_ind_B,
+                                           T* __restrict__ csr_val_B,
+                                           rocsparse_index_base idx_base_A,
+                                           rocsparse_index_base idx_base_B)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Get row boundaries of the current row in A
+    rocsparse_int row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Get row boundaries of the current row in B
+    rocsparse_int row_begin_B = csr_row_ptr_B[row] - idx_base_B;
+    rocsparse_int row_end_B   = csr_row_ptr_B[row + 1] - idx_base_B;
+
+    for(rocsparse_int j = row_begin_B + lid; j < row_end_B; j += WFSIZE)
+    {
+        // Column of B, shifted into the index base of A
+        rocsparse_int col = csr_col_ind_B[j] - idx_base_B + idx_base_A;
+
+        // Binary search for col in the (sorted) row of A
+        rocsparse_int lo = row_begin_A;
+        rocsparse_int hi = row_end_A;
+
+        while(lo < hi)
+        {
+            rocsparse_int mid = (lo + hi) >> 1;
+
+            if(csr_col_ind_A[mid] < col)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        csr_val_B[j] = (lo < row_end_A && csr_col_ind_A[lo] == col) ? csr_val_A[lo]
+                                                                      : static_cast<T>(0);
+    }
+}
+
+#endif // CSRILUK_DEVICE_H
@@ -0,0 +1,466 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRILUT_DEVICE_H
+#define CSRILUT_DEVICE_H
+
+#include "common.h"
+
+// Insert the update val into the working row at column col, where the working row is
+// held in a shared memory hash table. If col is not yet part of the working row, it is
+// only inserted if its magnitude is not below the drop threshold and the working row
+// has not reached its capacity. Rows of A never exceed the capacity, see
+// rocsparse_csrilut_nnz, such that only fill-in entries can be dropped.
+template <unsigned int HASHSIZE, unsigned int CAPACITY, typename T>
+__device__ __forceinline__ void csrilut_hash_update(rocsparse_int      col,
+                                                    T                  val,
+                                                    floating_data_t<T> threshold,
+                                                    rocsparse_int*     table,
+                                                    T*                 data,
+                                                    rocsparse_int*     count)
+{
+    // Compute hash
+    rocsparse_int hash = (col * 103) & (HASHSIZE - 1);
+
+    // Hash operation
+    while(true)
+    {
+        rocsparse_int key = table[hash];
+
+        if(key == col)
+        {
+            // Entry found, accumulate the update
+            data[hash] = data[hash] + val;
+            break;
+        }
+        else if(key == -1)
+        {
+            // Small fill-in entries are dropped immediately
+            if(rocsparse_abs(val) < threshold)
+            {
+                break;
+            }
+
+            // Reserve a slot of the working row, further fill-in is dropped
+            if(atomicAdd(count, 1) >= CAPACITY)
+            {
+                atomicSub(count, 1);
+                break;
+            }
+
+            if(atomicCAS(&table[hash], -1, col) == -1)
+            {
+                // Inserted key into the table, done
+                data[hash] = val;
+                break;
+            }
+
+            // Slot has been taken by another key, release reservation and probe again
+            atomicSub(count, 1);
+        }
+        else
+        {
+            // Collision, compute new hash
+            hash = (hash + 1) & (HASHSIZE - 1);
+        }
+    }
+}
+
+// Incomplete LU factorization with threshold dropping, where each row is processed by a
+// single block. The working row is held in a shared memory hash table and rows are
+// eliminated in ascending column order, waiting for the dependent rows to be completed
+// (sync-free). Multipliers and fill-in entries below tol times the average magnitude of
+// the row of A are dropped. Afterwards, only the max_fill largest entries of the
+// strictly lower and the strictly upper part are kept, together with the diagonal.
+// The factorized row is stored, sorted by column, in a padded array with stride
+// 2 * max_fill + 1. A zero diagonal entry is either replaced by the numeric boost, or
+// reported through zero_pivot, where rows depending on it skip their remaining
+// elimination.
+template <unsigned int BLOCKSIZE, unsigned int HASHSIZE, typename T>
+__device__ void csrilut_factorize_device(rocsparse_int      m,
+                                         rocsparse_int      max_fill,
+                                         floating_data_t<T> tol,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         const T* __restrict__ csr_val,
+                                         int* __restrict__ done,
+                                         rocsparse_int* __restrict__ ilut_col_ind,
+                                         T* __restrict__ ilut_val,
+                                         rocsparse_int* __restrict__ ilut_diag_ind,
+                                         rocsparse_int* __restrict__ ilut_row_nnz,
+                                         rocsparse_int* __restrict__ zero_pivot,
+                                         rocsparse_index_base idx_base,
+                                         int                  boost,
+                                         floating_data_t<T>   boost_tol,
+                                         T                    boost_val)
+{
+    // Maximum number of entries of the working row
+    static constexpr unsigned int CAPACITY = HASHSIZE / 2;
+
+    int tid = hipThreadIdx_x;
+
+    // Each block processes a row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Row stride of the padded factorization
+    int64_t stride = 2 * max_fill + 1;
+
+    // Working row
+    __shared__ rocsparse_int stable[HASHSIZE];
+    __shared__ T             sdata[HASHSIZE];
+
+    // Candidates of the factorized row and their magnitude
+    __shared__ rocsparse_int      slist[CAPACITY];
+    __shared__ floating_data_t<T> sabs[CAPACITY];
+    __shared__ bool               skeep[CAPACITY];
+    __shared__ floating_data_t<T> snorm[BLOCKSIZE];
+
+    __shared__ rocsparse_int scount;
+    __shared__ rocsparse_int snext;
+    __shared__ rocsparse_int snlower;
+    __shared__ rocsparse_int snkeep;
+    __shared__ T             smult;
+    __shared__ T             sdiag;
+    __shared__ bool          szero;
+
+    // Initialize hash table with -1
+    for(unsigned int i = tid; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        stable[i] = -1;
+    }
+
+    if(tid == 0)
+    {
+        scount  = 0;
+        snlower = 0;
+        snkeep  = 0;
+    }
+
+    __syncthreads();
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Average magnitude of the row of A
+    floating_data_t<T> sum = static_cast<floating_data_t<T>>(0);
+
+    for(rocsparse_int j = row_begin + tid; j < row_end; j += BLOCKSIZE)
+    {
+        sum += rocsparse_abs(csr_val[j]);
+    }
+
+    snorm[tid] = sum;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, snorm);
+
+    floating_data_t<T> norm = (row_end > row_begin) ? snorm[0] / (row_end - row_begin)
+                                                    : static_cast<floating_data_t<T>>(0);
+    floating_data_t<T> threshold = tol * norm;
+
+    // Load the row of A into the working row, all entries of A are inserted
+    for(rocsparse_int j = row_begin + tid; j < row_end; j += BLOCKSIZE)
+    {
+        csrilut_hash_update<HASHSIZE, CAPACITY>(csr_col_ind[j] - idx_base,
+                                                csr_val[j],
+                                                static_cast<floating_data_t<T>>(0),
+                                                stable,
+                                                sdata,
+                                                &scount);
+    }
+
+    // Last column that has been eliminated
+    rocsparse_int last = -1;
+
+    while(true)
+    {
+        if(tid == 0)
+        {
+            snext = row;
+        }
+
+        __syncthreads();
+
+        // Determine the next column of the strictly lower part to eliminate
+        rocsparse_int next = row;
+
+        for(unsigned int i = tid; i < HASHSIZE; i += BLOCKSIZE)
+        {
+            rocsparse_int key = stable[i];
+
+            if(key > last && key < row)
+            {
+                next = min(next, key);
+            }
+        }
+
+        atomicMin(&snext, next);
+
+        __syncthreads();
+
+        rocsparse_int k = snext;
+
+        // Strictly lower part has been eliminated
+        if(k == row)
+        {
+            break;
+        }
+
+        // Spin loop until dependency has been resolved
+        while(!atomicOr(&done[k], 0))
+            ;
+
+        // Make sure the factorized row k is visible
+        __threadfence();
+
+        rocsparse_int diag_k = ilut_diag_ind[k];
+        rocsparse_int nnz_k  = ilut_row_nnz[k];
+
+        if(tid == 0)
+        {
+            // Locate column k in the working row
+            rocsparse_int hash = (k * 103) & (HASHSIZE - 1);
+
+            while(stable[hash] != k)
+            {
+                hash = (hash + 1) & (HASHSIZE - 1);
+            }
+
+            T pivot = ilut_val[stride * k + diag_k];
+
+            // Row k has a zero pivot, that has been reported by row k
+            szero = (pivot == static_cast<T>(0));
+
+            T mult = (szero == true) ? static_cast<T>(0) : sdata[hash] / pivot;
+
+            // Drop small multipliers
+            if(rocsparse_abs(mult) < threshold)
+            {
+                mult = static_cast<T>(0);
+            }
+
+            sdata[hash] = smult = mult;
+        }
+
+        __syncthreads();
+
+        // Skip the remaining elimination of this row, if it depends on a zero pivot
+        if(szero == true)
+        {
+            break;
+        }
+
+        T mult = smult;
+
+        // Update the working row by the strictly upper part of row k
+        if(mult != static_cast<T>(0))
+        {
+            for(rocsparse_int j = diag_k + 1 + tid; j < nnz_k; j += BLOCKSIZE)
+            {
+                csrilut_hash_update<HASHSIZE, CAPACITY>(ilut_col_ind[stride * k + j],
+                                                        -mult * ilut_val[stride * k + j],
+                                                        threshold,
+                                                        stable,
+                                                        sdata,
+                                                        &scount);
+            }
+        }
+
+        last = k;
+    }
+
+    // Collect all entries that exceed the drop threshold, apart from the diagonal
+    if(tid == 0)
+    {
+        scount = 0;
+        sdiag  = static_cast<T>(0);
+    }
+
+    __syncthreads();
+
+    for(unsigned int i = tid; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        rocsparse_int key = stable[i];
+
+        if(key == -1)
+        {
+            continue;
+        }
+
+        if(key == row)
+        {
+            sdiag = sdata[i];
+            continue;
+        }
+
+        floating_data_t<T> val = rocsparse_abs(sdata[i]);
+
+        if(val >= threshold && val > static_cast<floating_data_t<T>>(0))
+        {
+            rocsparse_int idx = atomicAdd(&scount, 1);
+
+            slist[idx] = i;
+            sabs[idx]  = val;
+        }
+    }
+
+    __syncthreads();
+
+    rocsparse_int ncand = scount;
+
+    // Keep the max_fill largest entries of the strictly lower and upper part, where ties
+    // are broken by the column index
+    for(rocsparse_int i = tid; i < ncand; i += BLOCKSIZE)
+    {
+        rocsparse_int      key   = stable[slist[i]];
+        floating_data_t<T> val   = sabs[i];
+        bool               lower = key < row;
+        rocsparse_int      rank  = 0;
+
+        for(rocsparse_int j = 0; j < ncand; ++j)
+        {
+            rocsparse_int key_j = stable[slist[j]];
+
+            if((key_j < row) == lower && (sabs[j] > val || (sabs[j] == val && key_j < key)))
+            {
+                ++rank;
+            }
+        }
+
+        bool keep = rank < max_fill;
+
+        skeep[i] = keep;
+
+        if(keep == true)
+        {
+            atomicAdd(&snkeep, 1);
+
+            if(lower == true)
+            {
+                atomicAdd(&snlower, 1);
+            }
+        }
+    }
+
+    __syncthreads();
+
+    // Write the kept entries, sorted by column index, where the diagonal entry is placed
+    // right after the strictly lower part
+    for(rocsparse_int i = tid; i < ncand; i += BLOCKSIZE)
+    {
+        if(skeep[i] == false)
+        {
+            continue;
+        }
+
+        rocsparse_int key = stable[slist[i]];
+        rocsparse_int pos = (key > row) ? 1 : 0;
+
+        for(rocsparse_int j = 0; j < ncand; ++j)
+        {
+            if(skeep[j] == true && stable[slist[j]] < key)
+            {
+                ++pos;
+            }
+        }
+
+        ilut_col_ind[stride * row + pos] = key;
+        ilut_val[stride * row + pos]     = sdata[slist[i]];
+    }
+
+    if(tid == 0)
+    {
+        T diag = sdiag;
+
+        // Numeric boost
+        if(boost)
+        {
+            diag = (boost_tol >= rocsparse_abs(diag)) ? boost_val : diag;
+        }
+        else if(diag == static_cast<T>(0))
+        {
+            // Row has numerical or structural zero diagonal, we are looking for the
+            // first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+        }
+
+        ilut_col_ind[stride * row + snlower] = row;
+        ilut_val[stride * row + snlower]     = diag;
+        ilut_diag_ind[row]                   = snlower;
+        ilut_row_nnz[row]                    = snkeep + 1;
+    }
+
+    // Make sure the factorized row is visible, before it is flagged as done
+    __threadfence();
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        atomicOr(&done[row], 1);
+    }
+}
+
+// Copy the padded factorization into the CSR matrix LU, where each row is processed by a
+// single (sub)wavefront.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrilut_gather_device(rocsparse_int m,
+                                      rocsparse_int max_fill,
+                                      const rocsparse_int* __restrict__ ilut_col_ind,
+                                      const T* __restrict__ ilut_val,
+                                      const rocsparse_int* __restrict__ csr_row_ptr_LU,
+                                      rocsparse_int* __restrict__ csr_col_ind_LU,
+                                      T* __restrict__ csr_val_LU,
+                                      rocsparse_index_base idx_base_LU)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Row stride of the padded factorization
+    int64_t stride = 2 * max_fill + 1;
+
+    rocsparse_int row_begin = csr_row_ptr_LU[row] - idx_base_LU;
+    rocsparse_int row_end   = csr_row_ptr_LU[row + 1] - idx_base_LU;
+
+    for(rocsparse_int j = lid; j < row_end - row_begin; j += WFSIZE)
+    {
+        csr_col_ind_LU[row_begin + j] = ilut_col_ind[stride * row + j] + idx_base_LU;
+        csr_val_LU[row_begin + j]     = ilut_val[stride * row + j];
+    }
+}
+
+#endif // CSRILUT_DEVICE_H
@@ -0,0 +1,398 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef CSRMC_DEVICE_H
+#define CSRMC_DEVICE_H
+
+#include "common.h"
+
+// Inverse of the color reordering, i.e. the position of each row in row_map
+template <unsigned int BLOCKSIZE>
+__device__ void csrmc_inverse_map_device(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ row_map,
+                                         rocsparse_int* __restrict__ row_pos)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    row_pos[row_map[gid]] = gid;
+}
+
+// Number of rows of each color
+template <unsigned int BLOCKSIZE>
+__device__ void csrmc_count_colors_device(rocsparse_int m,
+                                          rocsparse_int ncolors,
+                                          const rocsparse_int* __restrict__ coloring,
+                                          rocsparse_int* __restrict__ color_count)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int color = coloring[gid];
+
+    if(color >= 0 && color < ncolors)
+    {
+        atomicAdd(&color_count[color], 1);
+    }
+}
+
+// Sort keys that order the entries of each row by the position of their column in
+// the color reordering. Rows stay in their original order.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__device__ void csrmc_sort_keys_device(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const rocsparse_int* __restrict__ row_pos,
+                                       unsigned long long* __restrict__ keys,
+                                       rocsparse_int* __restrict__ entries,
+                                       rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        keys[j] = static_cast<unsigned long long>(row) * m + row_pos[csr_col_ind[j] - idx_base];
+        entries[j] = j;
+    }
+}
+
+// Position of the diagonal entry of each row within the sorted entries. Rows without
+// diagonal entry are flagged as structural zero pivot.
+template <unsigned int BLOCKSIZE>
+__device__ void csrmc_diag_device(rocsparse_int m,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const rocsparse_int* __restrict__ entry_map,
+                                  rocsparse_int* __restrict__ diag_ind,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+    rocsparse_int row_diag  = -1;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        if(csr_col_ind[entry_map[j]] - idx_base == row)
+        {
+            row_diag = j;
+            break;
+        }
+    }
+
+    diag_ind[row] = row_diag;
+
+    if(row_diag == -1)
+    {
+        // We are looking for the first zero pivot
+        atomicMin(zero_pivot, row + idx_base);
+    }
+}
+
+// Relaxed Gauss-Seidel update of all rows of a single color. Rows of the same color
+// are not coupled, thus they can be updated in place.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrmcsor_device(rocsparse_int width,
+                                rocsparse_int offset,
+                                const rocsparse_int* __restrict__ row_map,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                T omega,
+                                const T* __restrict__ b,
+                                T* __restrict__ x,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    rocsparse_int idx = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    if(idx >= width)
+    {
+        return;
+    }
+
+    // Current row this group of lanes is working on
+    rocsparse_int row = row_map[offset + idx];
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum  = static_cast<T>(0);
+    T diag = static_cast<T>(0);
+
+    // Off-diagonal part of the row, the diagonal entry is extracted on the fly
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col == row)
+        {
+            diag = csr_val[j];
+        }
+        else
+        {
+            sum = rocsparse_fma(csr_val[j], x[col], sum);
+        }
+    }
+
+    sum  = rocsparse_wfreduce_sum<WFSIZE>(sum);
+    diag = rocsparse_wfreduce_sum<WFSIZE>(diag);
+
+    if(lid == WFSIZE - 1)
+    {
+        if(diag == static_cast<T>(0))
+        {
+            // We are looking for the first zero pivot, the row is left untouched
+            atomicMin(zero_pivot, row + idx_base);
+        }
+        else
+        {
+            T xi   = x[row];
+            x[row] = rocsparse_fma(omega, (b[row] - sum) / diag - xi, xi);
+        }
+    }
+}
+
+// ILU0 factorization of all rows of a single color. All rows the current color
+// depends on have been factorized by previous launches, thus no row has to wait.
+// The lower part of each row is processed in the order of the color reordering.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrmcilu0_device(rocsparse_int width,
+                                 rocsparse_int offset,
+                                 const rocsparse_int* __restrict__ row_map,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 T* __restrict__ csr_val,
+                                 const rocsparse_int* __restrict__ entry_map,
+                                 const rocsparse_int* __restrict__ diag_ind,
+                                 rocsparse_int* __restrict__ zero_pivot,
+                                 rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    rocsparse_int idx = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    if(idx >= width)
+    {
+        return;
+    }
+
+    // Current row this group of lanes is working on
+    rocsparse_int row = row_map[offset + idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = diag_ind[row];
+
+    // Structural zero pivot, do not process this row
+    if(row_diag == -1)
+    {
+        return;
+    }
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Loop over the lower part of the current row, in reordered column order
+    for(rocsparse_int s = row_begin; s < row_diag; ++s)
+    {
+        rocsparse_int j = entry_map[s];
+
+        // Column index currently being processed
+        rocsparse_int local_col = csr_col_ind[j] - idx_base;
+
+        // Corresponding value
+        T local_val = csr_val[j];
+
+        // End of the row that corresponds to local_col
+        rocsparse_int local_end = csr_row_ptr[local_col + 1] - idx_base;
+
+        // Diagonal entry point of row local_col
+        rocsparse_int local_diag = diag_ind[local_col];
+
+        // Structural zero pivot, has been reported by the analysis
+        if(local_diag == -1)
+        {
+            break;
+        }
+
+        // Load diagonal entry
+        T diag_val = csr_val[entry_map[local_diag]];
+
+        // Row has numerical zero diagonal
+        if(diag_val == static_cast<T>(0))
+        {
+            if(lid == 0)
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, local_col + idx_base);
+            }
+
+            // Skip this row if it has a zero pivot
+            break;
+        }
+
+        csr_val[j] = local_val = local_val / diag_val;
+
+        // Loop over the upper part of the row the current column index depends on
+        // Each lane processes one entry
+        for(rocsparse_int t = local_diag + 1 + lid; t < local_end; t += WFSIZE)
+        {
+            rocsparse_int k     = entry_map[t];
+            rocsparse_int col_k = csr_col_ind[k];
+
+            // Perform a binary search for the matching column of the current row
+            rocsparse_int l = row_begin;
+            rocsparse_int r = row_end - 1;
+
+            while(l < r)
+            {
+                rocsparse_int mid = (l + r) >> 1;
+
+                if(csr_col_ind[mid] < col_k)
+                {
+                    l = mid + 1;
+                }
+                else
+                {
+                    r = mid;
+                }
+            }
+
+            // Check if a match has been found
+            if(csr_col_ind[l] == col_k)
+            {
+                // If a match has been found, do ILU computation
+                csr_val[l] = rocsparse_fma(-local_val, csr_val[k], csr_val[l]);
+            }
+        }
+    }
+}
+
+// Triangular solve with the multicolor ILU0 factors for all rows of a single color.
+// The lower factor has unit diagonal.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrmcilu0_solve_device(rocsparse_int width,
+                                       rocsparse_int offset,
+                                       const rocsparse_int* __restrict__ row_map,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ entry_map,
+                                       const rocsparse_int* __restrict__ diag_ind,
+                                       const T* x,
+                                       T*       y,
+                                       rocsparse_int* __restrict__ zero_pivot,
+                                       rocsparse_index_base idx_base,
+                                       rocsparse_fill_mode  fill_mode)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    rocsparse_int idx = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    if(idx >= width)
+    {
+        return;
+    }
+
+    // Current row this group of lanes is working on
+    rocsparse_int row = row_map[offset + idx];
+
+    // Diagonal entry point of the current row
+    rocsparse_int row_diag = diag_ind[row];
+
+    // Structural zero pivot, has been reported by the analysis
+    if(row_diag == -1)
+    {
+        return;
+    }
+
+    // Lower part precedes the diagonal entry, upper part follows it
+    rocsparse_int begin
+        = (fill_mode == rocsparse_fill_mode_lower) ? csr_row_ptr[row] - idx_base : row_diag + 1;
+    rocsparse_int end
+        = (fill_mode == rocsparse_fill_mode_lower) ? row_diag : csr_row_ptr[row + 1] - idx_base;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int s = begin + lid; s < end; s += WFSIZE)
+    {
+        rocsparse_int j = entry_map[s];
+
+        sum = rocsparse_fma(csr_val[j], y[csr_col_ind[j] - idx_base], sum);
+    }
+
+    sum = rocsparse_wfreduce_sum<WFSIZE>(sum);
+
+    if(lid == WFSIZE - 1)
+    {
+        if(fill_mode == rocsparse_fill_mode_lower)
+        {
+            y[row] = x[row] - sum;
+        }
+        else
+        {
+            T diag_val = csr_val[entry_map[row_diag]];
+
+            if(diag_val == static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, row + idx_base);
+            }
+            else
+            {
+                y[row] = (y[row] - sum) / diag_val;
+            }
+        }
+    }
+}
+
+#endif // CSRMC_DEVICE_H
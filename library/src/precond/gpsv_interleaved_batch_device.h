@@ -0,0 +1,220 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GPSV_INTERLEAVED_BATCH_DEVICE_H
+#define GPSV_INTERLEAVED_BATCH_DEVICE_H
+
+#include "common.h"
+#include "gtsv_interleaved_batch_device.h"
+
+// Interleaved batch layout, where element i of system j is located at
+// batch_stride * i + j. Each thread solves one system.
+//
+// Matrix has form:
+//
+// [ d0 u0 w0 0  0  0  ]
+// [ l1 d1 u1 w1 0  0  ]
+// [ s2 l2 d2 u2 w2 0  ]
+// [ 0  s3 l3 d3 u3 w3 ]
+// [ 0  0  s4 l4 d4 u4 ]
+// [ 0  0  0  s5 l5 d5 ]
+
+// Applies the Givens rotation (c, s) to rows v and w and their right hand sides
+template <typename T>
+__device__ __forceinline__ void gpsv_interleaved_batch_rotate(T c, T s, T* v, T* w, T& bv, T& bw)
+{
+    for(int k = 0; k < 5; ++k)
+    {
+        T vk = v[k];
+        T wk = w[k];
+
+        v[k] = rocsparse_conj(c) * vk + rocsparse_conj(s) * wk;
+        w[k] = c * wk - s * vk;
+    }
+
+    T tv = bv;
+    T tw = bw;
+
+    bv = rocsparse_conj(c) * tv + rocsparse_conj(s) * tw;
+    bw = c * tw - s * tv;
+}
+
+// Loads row k, starting at column k - 2, into v. Entries outside of the matrix are zero.
+template <typename T>
+__device__ __forceinline__ void gpsv_interleaved_batch_load(rocsparse_int k,
+                                                            rocsparse_int m,
+                                                            rocsparse_int batch_stride,
+                                                            const T* __restrict__ ds,
+                                                            const T* __restrict__ dl,
+                                                            const T* __restrict__ d,
+                                                            const T* __restrict__ du,
+                                                            const T* __restrict__ dw,
+                                                            const T* __restrict__ x,
+                                                            T* v,
+                                                            T& b)
+{
+    if(k >= m)
+    {
+        for(int l = 0; l < 5; ++l)
+        {
+            v[l] = static_cast<T>(0);
+        }
+
+        b = static_cast<T>(0);
+
+        return;
+    }
+
+    rocsparse_int idx = batch_stride * k;
+
+    v[0] = (k >= 2) ? ds[idx] : static_cast<T>(0);
+    v[1] = (k >= 1) ? dl[idx] : static_cast<T>(0);
+    v[2] = d[idx];
+    v[3] = (k + 1 < m) ? du[idx] : static_cast<T>(0);
+    v[4] = (k + 2 < m) ? dw[idx] : static_cast<T>(0);
+    b    = x[idx];
+}
+
+// QR factorization using Givens rotations. Rows i, i + 1 and i + 2 are kept in
+// registers as windows over the columns i, ..., i + 4. R has four super diagonals,
+// where the third and fourth one are stored in dl and ds, respectively.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void gpsv_interleaved_batch_qr_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          T* __restrict__ ds,
+                                          T* __restrict__ dl,
+                                          T* __restrict__ d,
+                                          T* __restrict__ du,
+                                          T* __restrict__ dw,
+                                          T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    ds += gid;
+    dl += gid;
+    d += gid;
+    du += gid;
+    dw += gid;
+    x += gid;
+
+    T v0[5];
+    T v1[5];
+    T v2[5];
+    T b0;
+    T b1;
+    T b2;
+    T row[5];
+
+    // Row 0 and 1 start left of column 0, shift them into the window
+    gpsv_interleaved_batch_load(0, m, batch_stride, ds, dl, d, du, dw, x, row, b0);
+
+    v0[0] = row[2];
+    v0[1] = row[3];
+    v0[2] = row[4];
+    v0[3] = static_cast<T>(0);
+    v0[4] = static_cast<T>(0);
+
+    gpsv_interleaved_batch_load(1, m, batch_stride, ds, dl, d, du, dw, x, row, b1);
+
+    v1[0] = row[1];
+    v1[1] = row[2];
+    v1[2] = row[3];
+    v1[3] = row[4];
+    v1[4] = static_cast<T>(0);
+
+    gpsv_interleaved_batch_load(2, m, batch_stride, ds, dl, d, du, dw, x, v2, b2);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        T c;
+        T s;
+
+        // Eliminate column i from row i + 2
+        if(i + 2 < m)
+        {
+            gtsv_interleaved_batch_givens(v1[0], v2[0], c, s);
+            gpsv_interleaved_batch_rotate(c, s, v1, v2, b1, b2);
+        }
+
+        // Eliminate column i from row i + 1
+        if(i + 1 < m)
+        {
+            gtsv_interleaved_batch_givens(v0[0], v1[0], c, s);
+            gpsv_interleaved_batch_rotate(c, s, v0, v1, b0, b1);
+        }
+
+        // Row i of R is final
+        rocsparse_int idx = batch_stride * i;
+
+        d[idx]  = v0[0];
+        du[idx] = v0[1];
+        dw[idx] = v0[2];
+        dl[idx] = v0[3];
+        ds[idx] = v0[4];
+        x[idx]  = b0;
+
+        // Shift the windows by one column and load row i + 3
+        for(int k = 0; k < 4; ++k)
+        {
+            v0[k] = v1[k + 1];
+            v1[k] = v2[k + 1];
+        }
+
+        v0[4] = static_cast<T>(0);
+        v1[4] = static_cast<T>(0);
+        b0    = b1;
+        b1    = b2;
+
+        gpsv_interleaved_batch_load(i + 3, m, batch_stride, ds, dl, d, du, dw, x, v2, b2);
+    }
+
+    // Back substitution
+    T xp1 = static_cast<T>(0);
+    T xp2 = static_cast<T>(0);
+    T xp3 = static_cast<T>(0);
+    T xp4 = static_cast<T>(0);
+
+    for(rocsparse_int i = m - 1; i >= 0; --i)
+    {
+        rocsparse_int idx = batch_stride * i;
+
+        T xi = (x[idx] - du[idx] * xp1 - dw[idx] * xp2 - dl[idx] * xp3 - ds[idx] * xp4) / d[idx];
+
+        x[idx] = xi;
+        xp4    = xp3;
+        xp3    = xp2;
+        xp2    = xp1;
+        xp1    = xi;
+    }
+}
+
+#endif // GPSV_INTERLEAVED_BATCH_DEVICE_H
@@ -0,0 +1,358 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GTSV_INTERLEAVED_BATCH_DEVICE_H
+#define GTSV_INTERLEAVED_BATCH_DEVICE_H
+
+#include "common.h"
+
+// Interleaved batch layout, where element i of system j is located at
+// batch_stride * i + j. Each thread solves one system, such that consecutive
+// threads access consecutive memory locations.
+//
+// Matrix has form:
+//
+// [ d0 u0 0  0  0  ]
+// [ l1 d1 u1 0  0  ]
+// [ 0  l2 d2 u2 0  ]
+// [ 0  0  l3 d3 u3 ]
+// [ 0  0  0  l4 d4 ]
+
+// Computes the Givens rotation that eliminates b against a, i.e.
+// [ conj(c) conj(s) ] [ a ]   [ r ]
+// [   -s       c    ] [ b ] = [ 0 ]
+template <typename T>
+__device__ __forceinline__ void gtsv_interleaved_batch_givens(T a, T b, T& c, T& s)
+{
+    auto norm = hypot(rocsparse_abs(a), rocsparse_abs(b));
+
+    if(norm == 0)
+    {
+        c = static_cast<T>(1);
+        s = static_cast<T>(0);
+    }
+    else
+    {
+        c = a / static_cast<T>(norm);
+        s = b / static_cast<T>(norm);
+    }
+}
+
+// Back substitution of the upper triangular factor with bands d, du and dl, where
+// dl holds the second super diagonal of the factorization
+template <typename T>
+__device__ __forceinline__ void gtsv_interleaved_batch_backsolve(rocsparse_int m,
+                                                                 rocsparse_int batch_stride,
+                                                                 const T* __restrict__ dl,
+                                                                 const T* __restrict__ d,
+                                                                 const T* __restrict__ du,
+                                                                 T* __restrict__ x)
+{
+    T xp1 = x[batch_stride * (m - 1)] / d[batch_stride * (m - 1)];
+    T xp2 = static_cast<T>(0);
+
+    x[batch_stride * (m - 1)] = xp1;
+
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        rocsparse_int idx = batch_stride * i;
+
+        T xi = (x[idx] - du[idx] * xp1 - dl[idx] * xp2) / d[idx];
+
+        x[idx] = xi;
+        xp2    = xp1;
+        xp1    = xi;
+    }
+}
+
+// Thomas algorithm without pivoting. The modified upper diagonal is stored in du.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void gtsv_interleaved_batch_thomas_kernel(rocsparse_int m,
+                                              rocsparse_int batch_count,
+                                              rocsparse_int batch_stride,
+                                              const T* __restrict__ dl,
+                                              const T* __restrict__ d,
+                                              T* __restrict__ du,
+                                              T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Forward sweep
+    T cp = du[gid] / d[gid];
+    T xp = x[gid] / d[gid];
+
+    du[gid] = cp;
+    x[gid]  = xp;
+
+    for(rocsparse_int i = 1; i < m; ++i)
+    {
+        rocsparse_int idx = batch_stride * i + gid;
+
+        T a     = dl[idx];
+        T denom = d[idx] - a * cp;
+
+        cp = (i < m - 1) ? du[idx] / denom : static_cast<T>(0);
+        xp = (x[idx] - a * xp) / denom;
+
+        du[idx] = cp;
+        x[idx]  = xp;
+    }
+
+    // Backward substitution
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        rocsparse_int idx = batch_stride * i + gid;
+
+        xp     = x[idx] - du[idx] * xp;
+        x[idx] = xp;
+    }
+}
+
+// LU factorization with partial pivoting, similar to LAPACK gtsv. The second super
+// diagonal that is introduced by row interchanges is stored in dl.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void gtsv_interleaved_batch_lu_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          T* __restrict__ dl,
+                                          T* __restrict__ d,
+                                          T* __restrict__ du,
+                                          T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Current pivot row
+    T di  = d[gid];
+    T dui = du[gid];
+    T bi  = x[gid];
+
+    for(rocsparse_int i = 0; i < m - 1; ++i)
+    {
+        rocsparse_int idx  = batch_stride * i + gid;
+        rocsparse_int idx1 = idx + batch_stride;
+
+        T dl1 = dl[idx1];
+        T d1  = d[idx1];
+        T du1 = (i < m - 2) ? du[idx1] : static_cast<T>(0);
+        T b1  = x[idx1];
+
+        if(rocsparse_abs(di) >= rocsparse_abs(dl1))
+        {
+            // No row interchange
+            T fact = (di != static_cast<T>(0)) ? dl1 / di : static_cast<T>(0);
+
+            d[idx]  = di;
+            du[idx] = dui;
+            dl[idx] = static_cast<T>(0);
+            x[idx]  = bi;
+
+            di  = d1 - fact * dui;
+            dui = du1;
+            bi  = b1 - fact * bi;
+        }
+        else
+        {
+            // Interchange rows i and i + 1
+            T fact = di / dl1;
+
+            d[idx]  = dl1;
+            du[idx] = d1;
+            dl[idx] = du1;
+            x[idx]  = b1;
+
+            di  = dui - fact * d1;
+            dui = -fact * du1;
+            bi  = bi - fact * b1;
+        }
+    }
+
+    d[batch_stride * (m - 1) + gid] = di;
+    x[batch_stride * (m - 1) + gid] = bi;
+
+    gtsv_interleaved_batch_backsolve(m, batch_stride, dl + gid, d + gid, du + gid, x + gid);
+}
+
+// QR factorization using Givens rotations. The second super diagonal of R is stored
+// in dl.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void gtsv_interleaved_batch_qr_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          T* __restrict__ dl,
+                                          T* __restrict__ d,
+                                          T* __restrict__ du,
+                                          T* __restrict__ x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= batch_count)
+    {
+        return;
+    }
+
+    // Current row
+    T di  = d[gid];
+    T dui = du[gid];
+    T bi  = x[gid];
+
+    for(rocsparse_int i = 0; i < m - 1; ++i)
+    {
+        rocsparse_int idx  = batch_stride * i + gid;
+        rocsparse_int idx1 = idx + batch_stride;
+
+        T dl1 = dl[idx1];
+        T d1  = d[idx1];
+        T du1 = (i < m - 2) ? du[idx1] : static_cast<T>(0);
+        T b1  = x[idx1];
+
+        T c;
+        T s;
+        gtsv_interleaved_batch_givens(di, dl1, c, s);
+
+        // Rotate rows i and i + 1
+        d[idx]  = rocsparse_conj(c) * di + rocsparse_conj(s) * dl1;
+        du[idx] = rocsparse_conj(c) * dui + rocsparse_conj(s) * d1;
+        dl[idx] = rocsparse_conj(s) * du1;
+        x[idx]  = rocsparse_conj(c) * bi + rocsparse_conj(s) * b1;
+
+        di  = c * d1 - s * dui;
+        dui = c * du1;
+        bi  = c * b1 - s * bi;
+    }
+
+    d[batch_stride * (m - 1) + gid] = di;
+    x[batch_stride * (m - 1) + gid] = bi;
+
+    gtsv_interleaved_batch_backsolve(m, batch_stride, dl + gid, d + gid, du + gid, x + gid);
+}
+
+// One step of parallel cyclic reduction, where each thread reduces one equation of one
+// system. Equation i is coupled with equations i - stride and i + stride, which are
+// treated as zero if out of bounds.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void gtsv_interleaved_batch_pcr_kernel(rocsparse_int m,
+                                           rocsparse_int batch_count,
+                                           rocsparse_int stride,
+                                           rocsparse_int in_stride,
+                                           rocsparse_int out_stride,
+                                           const T* __restrict__ a,
+                                           const T* __restrict__ b,
+                                           const T* __restrict__ c,
+                                           const T* __restrict__ rhs,
+                                           T* __restrict__ a_out,
+                                           T* __restrict__ b_out,
+                                           T* __restrict__ c_out,
+                                           T* __restrict__ rhs_out)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m * batch_count)
+    {
+        return;
+    }
+
+    rocsparse_int i = gid / batch_count;
+    rocsparse_int j = gid % batch_count;
+
+    rocsparse_int idx = in_stride * i + j;
+
+    T ai = a[idx];
+    T bi = b[idx];
+    T ci = c[idx];
+    T ri = rhs[idx];
+
+    T an = static_cast<T>(0);
+    T cn = static_cast<T>(0);
+
+    if(i - stride >= 0)
+    {
+        rocsparse_int left = idx - in_stride * stride;
+
+        T alpha = -ai / b[left];
+
+        an = alpha * a[left];
+        bi = bi + alpha * c[left];
+        ri = ri + alpha * rhs[left];
+    }
+
+    if(i + stride < m)
+    {
+        rocsparse_int right = idx + in_stride * stride;
+
+        T gamma = -ci / b[right];
+
+        cn = gamma * c[right];
+        bi = bi + gamma * a[right];
+        ri = ri + gamma * rhs[right];
+    }
+
+    rocsparse_int out = out_stride * i + j;
+
+    a_out[out]   = an;
+    b_out[out]   = bi;
+    c_out[out]   = cn;
+    rhs_out[out] = ri;
+}
+
+// Solves the decoupled equations that remain after parallel cyclic reduction. rhs and
+// x may alias.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void gtsv_interleaved_batch_pcr_solve_kernel(rocsparse_int m,
+                                                 rocsparse_int batch_count,
+                                                 rocsparse_int batch_stride,
+                                                 rocsparse_int in_stride,
+                                                 const T* __restrict__ b,
+                                                 const T* rhs,
+                                                 T*       x)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m * batch_count)
+    {
+        return;
+    }
+
+    rocsparse_int i = gid / batch_count;
+    rocsparse_int j = gid % batch_count;
+
+    x[batch_stride * i + j] = rhs[in_stride * i + j] / b[in_stride * i + j];
+}
+
+#endif // GTSV_INTERLEAVED_BATCH_DEVICE_H
@@ -0,0 +1,537 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse_bsrdiag_inverse.hpp"
+
+#include "bsrdiag_inverse_device.h"
+
+#define LAUNCH_BSRDIAG_INVERSE(blocksize, bsrdim)                            \
+    hipLaunchKernelGGL((bsrdiag_inverse_kernel<blocksize, bsrdim>),          \
+                       dim3((mb - 1) / (blocksize / (bsrdim * bsrdim)) + 1), \
+                       dim3(blocksize),                                      \
+                       0,                                                    \
+                       stream,                                               \
+                       dir,                                                  \
+                       mb,                                                   \
+                       bsr_val,                                              \
+                       bsr_row_ptr,                                          \
+                       bsr_col_ind,                                          \
+                       block_dim,                                            \
+                       pivot,                                                \
+                       inv_val,                                              \
+                       inv_row_ptr,                                          \
+                       inv_col_ind,                                          \
+                       (rocsparse_int*)info->zero_pivot,                     \
+                       descr->base)
+
+#define LAUNCH_BSRDIAG_INVERSE_APPLY(blocksize, bsrdim)                   \
+    hipLaunchKernelGGL((bsrdiag_inverse_apply_kernel<blocksize, bsrdim>), \
+                       dim3((int64_t(mb) * bsrdim - 1) / blocksize + 1),  \
+                       dim3(blocksize),                                   \
+                       0,                                                 \
+                       handle->stream,                                    \
+                       dir,                                               \
+                       mb,                                                \
+                       alpha_device_host,                                 \
+                       inv_val,                                           \
+                       x,                                                 \
+                       beta_device_host,                                  \
+                       y)
+
+template <typename T>
+rocsparse_status rocsparse_bsrdiag_inverse_template(rocsparse_handle              handle,
+                                                    rocsparse_direction           dir,
+                                                    rocsparse_int                 mb,
+                                                    rocsparse_int                 nnzb,
+                                                    const rocsparse_mat_descr     descr,
+                                                    const T*                      bsr_val,
+                                                    const rocsparse_int*          bsr_row_ptr,
+                                                    const rocsparse_int*          bsr_col_ind,
+                                                    rocsparse_int                 block_dim,
+                                                    rocsparse_mat_info            info,
+                                                    rocsparse_bsrdiag_inverse_alg alg,
+                                                    T*                            inv_val,
+                                                    rocsparse_int*                inv_row_ptr,
+                                                    rocsparse_int*                inv_col_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr == nullptr || info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrdiag_inverse"),
+              dir,
+              mb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info,
+              alg,
+              (const void*&)inv_val,
+              (const void*&)inv_row_ptr,
+              (const void*&)inv_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f bsrdiag_inverse -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> "
+              "--blockdim",
+              block_dim,
+              "--algo",
+              alg);
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check algorithm
+    if(rocsparse_enum_utils::is_invalid(alg))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Diagonal blocks are inverted in shared memory
+    if(block_dim > 32)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(mb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_row_ptr == nullptr || inv_val == nullptr || inv_row_ptr == nullptr
+       || inv_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((bsr_val == nullptr && bsr_col_ind != nullptr)
+       || (bsr_val != nullptr && bsr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnzb != 0 && (bsr_val == nullptr && bsr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Allocate buffer to hold zero pivot
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Initialize zero pivot on the device, such that no host synchronization is required
+    hipLaunchKernelGGL((set_array_to_value<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       1,
+                       (rocsparse_int*)info->zero_pivot,
+                       std::numeric_limits<rocsparse_int>::max());
+
+    bool pivot = (alg != rocsparse_bsrdiag_inverse_alg_no_pivot);
+
+    // Blocks are padded to the next supported block dimension
+    if(block_dim == 1)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 1);
+    }
+    else if(block_dim == 2)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 2);
+    }
+    else if(block_dim == 3)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 3);
+    }
+    else if(block_dim == 4)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 4);
+    }
+    else if(block_dim == 5)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 5);
+    }
+    else if(block_dim <= 8)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 8);
+    }
+    else if(block_dim <= 16)
+    {
+        LAUNCH_BSRDIAG_INVERSE(256, 16);
+    }
+    else
+    {
+        LAUNCH_BSRDIAG_INVERSE(1024, 32);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status
+    rocsparse_bsrdiag_inverse_apply_template_dispatch(rocsparse_handle    handle,
+                                                      rocsparse_direction dir,
+                                                      rocsparse_int       mb,
+                                                      U                   alpha_device_host,
+                                                      const T*            inv_val,
+                                                      rocsparse_int       block_dim,
+                                                      const T*            x,
+                                                      U                   beta_device_host,
+                                                      T*                  y)
+{
+    // Run different kernels depending on the block dimension
+    if(block_dim == 2)
+    {
+        LAUNCH_BSRDIAG_INVERSE_APPLY(256, 2);
+    }
+    else if(block_dim == 3)
+    {
+        LAUNCH_BSRDIAG_INVERSE_APPLY(256, 3);
+    }
+    else if(block_dim == 4)
+    {
+        LAUNCH_BSRDIAG_INVERSE_APPLY(256, 4);
+    }
+    else if(block_dim == 5)
+    {
+        LAUNCH_BSRDIAG_INVERSE_APPLY(256, 5);
+    }
+    else if(block_dim == 8)
+    {
+        LAUNCH_BSRDIAG_INVERSE_APPLY(256, 8);
+    }
+    else if(block_dim == 16)
+    {
+        LAUNCH_BSRDIAG_INVERSE_APPLY(256, 16);
+    }
+    else
+    {
+        hipLaunchKernelGGL((bsrdiag_inverse_apply_general_kernel<256>),
+                           dim3((int64_t(mb) * block_dim - 1) / 256 + 1),
+                           dim3(256),
+                           0,
+                           handle->stream,
+                           dir,
+                           mb,
+                           block_dim,
+                           alpha_device_host,
+                           inv_val,
+                           x,
+                           beta_device_host,
+                           y);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrdiag_inverse_apply_template(rocsparse_handle    handle,
+                                                          rocsparse_direction dir,
+                                                          rocsparse_int       mb,
+                                                          const T*            alpha_device_host,
+                                                          const T*            inv_val,
+                                                          rocsparse_int       block_dim,
+                                                          const T*            x,
+                                                          const T*            beta_device_host,
+                                                          T*                  y)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrdiag_inverse_apply"),
+              dir,
+              mb,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)inv_val,
+              block_dim,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Another quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the rest of pointer arguments
+    if(inv_val == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_bsrdiag_inverse_apply_template_dispatch(
+            handle, dir, mb, alpha_device_host, inv_val, block_dim, x, beta_device_host, y);
+    }
+    else
+    {
+        return rocsparse_bsrdiag_inverse_apply_template_dispatch(
+            handle, dir, mb, *alpha_device_host, inv_val, block_dim, x, *beta_device_host, y);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle              handle,      \
+                                     rocsparse_direction           dir,         \
+                                     rocsparse_int                 mb,          \
+                                     rocsparse_int                 nnzb,        \
+                                     const rocsparse_mat_descr     descr,       \
+                                     const TYPE*                   bsr_val,     \
+                                     const rocsparse_int*          bsr_row_ptr, \
+                                     const rocsparse_int*          bsr_col_ind, \
+                                     rocsparse_int                 block_dim,   \
+                                     rocsparse_mat_info            info,        \
+                                     rocsparse_bsrdiag_inverse_alg alg,         \
+                                     TYPE*                         inv_val,     \
+                                     rocsparse_int*                inv_row_ptr, \
+                                     rocsparse_int*                inv_col_ind) \
+    {                                                                           \
+        return rocsparse_bsrdiag_inverse_template(handle,                       \
+                                                  dir,                          \
+                                                  mb,                           \
+                                                  nnzb,                         \
+                                                  descr,                        \
+                                                  bsr_val,                      \
+                                                  bsr_row_ptr,                  \
+                                                  bsr_col_ind,                  \
+                                                  block_dim,                    \
+                                                  info,                         \
+                                                  alg,                          \
+                                                  inv_val,                      \
+                                                  inv_row_ptr,                  \
+                                                  inv_col_ind);                 \
+    }
+
+C_IMPL(rocsparse_sbsrdiag_inverse, float);
+C_IMPL(rocsparse_dbsrdiag_inverse, double);
+C_IMPL(rocsparse_cbsrdiag_inverse, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrdiag_inverse, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                           \
+    extern "C" rocsparse_status NAME(rocsparse_handle    handle,     \
+                                     rocsparse_direction dir,        \
+                                     rocsparse_int       mb,         \
+                                     const TYPE*         alpha,      \
+                                     const TYPE*         inv_val,    \
+                                     rocsparse_int       block_dim,  \
+                                     const TYPE*         x,          \
+                                     const TYPE*         beta,       \
+                                     TYPE*               y)          \
+    {                                                                \
+        return rocsparse_bsrdiag_inverse_apply_template(             \
+            handle, dir, mb, alpha, inv_val, block_dim, x, beta, y); \
+    }
+
+C_IMPL(rocsparse_sbsrdiag_inverse_apply, float);
+C_IMPL(rocsparse_dbsrdiag_inverse_apply, double);
+C_IMPL(rocsparse_cbsrdiag_inverse_apply, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrdiag_inverse_apply, rocsparse_double_complex);
+
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_bsrdiag_inverse_zero_pivot(rocsparse_handle   handle,
+                                                                 rocsparse_mat_info info,
+                                                                 rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_bsrdiag_inverse_zero_pivot",
+              (const void*&)info,
+              (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If mb == 0 it can happen, that the zero pivot is not created.
+    // In this case, always return -1.
+    if(info->zero_pivot == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
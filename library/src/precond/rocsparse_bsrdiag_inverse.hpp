@@ -0,0 +1,73 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_BSRDIAG_INVERSE_HPP
+#define ROCSPARSE_BSRDIAG_INVERSE_HPP
+
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+template <typename T>
+rocsparse_status rocsparse_bsrdiag_inverse_template(rocsparse_handle              handle,
+                                                    rocsparse_direction           dir,
+                                                    rocsparse_int                 mb,
+                                                    rocsparse_int                 nnzb,
+                                                    const rocsparse_mat_descr     descr,
+                                                    const T*                      bsr_val,
+                                                    const rocsparse_int*          bsr_row_ptr,
+                                                    const rocsparse_int*          bsr_col_ind,
+                                                    rocsparse_int                 block_dim,
+                                                    rocsparse_mat_info            info,
+                                                    rocsparse_bsrdiag_inverse_alg alg,
+                                                    T*                            inv_val,
+                                                    rocsparse_int*                inv_row_ptr,
+                                                    rocsparse_int*                inv_col_ind);
+
+template <typename T, typename U>
+rocsparse_status
+    rocsparse_bsrdiag_inverse_apply_template_dispatch(rocsparse_handle    handle,
+                                                      rocsparse_direction dir,
+                                                      rocsparse_int       mb,
+                                                      U                   alpha_device_host,
+                                                      const T*            inv_val,
+                                                      rocsparse_int       block_dim,
+                                                      const T*            x,
+                                                      U                   beta_device_host,
+                                                      T*                  y);
+
+template <typename T>
+rocsparse_status rocsparse_bsrdiag_inverse_apply_template(rocsparse_handle    handle,
+                                                          rocsparse_direction dir,
+                                                          rocsparse_int       mb,
+                                                          const T*            alpha_device_host,
+                                                          const T*            inv_val,
+                                                          rocsparse_int       block_dim,
+                                                          const T*            x,
+                                                          const T*            beta_device_host,
+                                                          T*                  y);
+
+#endif // ROCSPARSE_BSRDIAG_INVERSE_HPP
@@ -0,0 +1,564 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "utility.h"
+
+#include "../conversion/nnz_compress_device.h"
+#include "csrfsai_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+// Maximum number of entries per row of G, which is the maximum dimension of the local
+// systems that are solved by a single wavefront
+#define CSRFSAI_MAXDIM 32
+#define CSRFSAI_DIM 64
+
+template <unsigned int BLOCKSIZE, unsigned int MAXDIM>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrfsai_nnz_kernel(rocsparse_int m,
+                            const rocsparse_int* __restrict__ csr_row_ptr_S,
+                            const rocsparse_int* __restrict__ csr_col_ind_S,
+                            rocsparse_index_base idx_base_S,
+                            rocsparse_int* __restrict__ nnz_per_row,
+                            rocsparse_int* __restrict__ truncated_rows)
+{
+    csrfsai_nnz_device<BLOCKSIZE, MAXDIM>(
+        m, csr_row_ptr_S, csr_col_ind_S, idx_base_S, nnz_per_row, truncated_rows);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrfsai_kernel(rocsparse_int m,
+                        const rocsparse_int* __restrict__ csr_row_ptr_A,
+                        const rocsparse_int* __restrict__ csr_col_ind_A,
+                        const T* __restrict__ csr_val_A,
+                        const rocsparse_int* __restrict__ csr_row_ptr_S,
+                        const rocsparse_int* __restrict__ csr_col_ind_S,
+                        const rocsparse_int* __restrict__ csr_row_ptr_G,
+                        rocsparse_int* __restrict__ csr_col_ind_G,
+                        T* __restrict__ csr_val_G,
+                        rocsparse_int* __restrict__ zero_pivot,
+                        rocsparse_index_base idx_base_A,
+                        rocsparse_index_base idx_base_S,
+                        rocsparse_index_base idx_base_G)
+{
+    csrfsai_device<BLOCKSIZE, WFSIZE>(m,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      csr_val_A,
+                                      csr_row_ptr_S,
+                                      csr_col_ind_S,
+                                      csr_row_ptr_G,
+                                      csr_col_ind_G,
+                                      csr_val_G,
+                                      zero_pivot,
+                                      idx_base_A,
+                                      idx_base_S,
+                                      idx_base_G);
+}
+
+extern "C" rocsparse_status rocsparse_csrfsai_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  const rocsparse_mat_descr descr_S,
+                                                  rocsparse_int             nnz_S,
+                                                  const rocsparse_int*      csr_row_ptr_S,
+                                                  const rocsparse_int*      csr_col_ind_S,
+                                                  const rocsparse_mat_descr descr_G,
+                                                  rocsparse_int*            csr_row_ptr_G,
+                                                  rocsparse_int*            nnz_G,
+                                                  rocsparse_int*            truncated_rows)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr_S == nullptr || descr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrfsai_nnz",
+              m,
+              (const void*&)descr_S,
+              nnz_S,
+              (const void*&)csr_row_ptr_S,
+              (const void*&)csr_col_ind_S,
+              (const void*&)descr_G,
+              (const void*&)csr_row_ptr_G,
+              (const void*&)nnz_G,
+              (const void*&)truncated_rows);
+
+    // Check sizes
+    if(m < 0 || nnz_S < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check output pointers
+    if(nnz_G == nullptr || truncated_rows == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_G, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(truncated_rows, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_G          = 0;
+            *truncated_rows = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr_S == nullptr || csr_row_ptr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_S != 0 && csr_col_ind_S == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // In host pointer mode, the number of entries of G is read back to the host. This
+    // cannot be captured in graph mode
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Temporary storage of the scan on csr_row_ptr_G
+    auto   op = rocprim::plus<rocsparse_int>();
+    size_t temp_storage_size_bytes;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, temp_storage_size_bytes, csr_row_ptr_G, csr_row_ptr_G, m + 1, op, stream));
+
+    // If the handle buffer is too small, temporary storage is allocated. This cannot be
+    // captured in graph mode
+    if(handle->buffer_size < temp_storage_size_bytes
+       && handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // The number of truncated rows is accumulated in the first entry of csr_row_ptr_G
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(csr_row_ptr_G, 0, sizeof(rocsparse_int), stream));
+
+    // Number of entries per row of G
+    hipLaunchKernelGGL((csrfsai_nnz_kernel<CSRFSAI_DIM, CSRFSAI_MAXDIM>),
+                       dim3((m - 1) / CSRFSAI_DIM + 1),
+                       dim3(CSRFSAI_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_S,
+                       csr_col_ind_S,
+                       descr_S->base,
+                       csr_row_ptr_G + 1,
+                       csr_row_ptr_G);
+
+    // Number of rows of S, that exceed the maximum number of entries per row of G
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(truncated_rows,
+                                           csr_row_ptr_G,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            truncated_rows, csr_row_ptr_G, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    }
+
+    // Compute csr_row_ptr_G with the right index base
+    hipLaunchKernelGGL((set_array_to_value<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       1,
+                       csr_row_ptr_G,
+                       static_cast<rocsparse_int>(descr_G->base));
+
+    // Perform inclusive scan on csr row pointer array
+    bool  temp_alloc       = false;
+    void* temp_storage_ptr = nullptr;
+    if(handle->buffer_size >= temp_storage_size_bytes)
+    {
+        temp_storage_ptr = handle->buffer;
+        temp_alloc       = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, temp_storage_size_bytes));
+        temp_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(temp_storage_ptr,
+                                                temp_storage_size_bytes,
+                                                csr_row_ptr_G,
+                                                csr_row_ptr_G,
+                                                m + 1,
+                                                op,
+                                                stream));
+
+    // Total number of entries of G
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((compute_nnz_from_row_ptr_array_kernel<1>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr_G,
+                           nnz_G);
+    }
+    else
+    {
+        // Wait for the number of truncated rows
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_G, &csr_row_ptr_G[m], sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        *nnz_G -= descr_G->base;
+    }
+
+    if(temp_alloc)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrfsai_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const T*                  csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_S,
+                                            rocsparse_int             nnz_S,
+                                            const rocsparse_int*      csr_row_ptr_S,
+                                            const rocsparse_int*      csr_col_ind_S,
+                                            rocsparse_mat_info        info,
+                                            const rocsparse_mat_descr descr_G,
+                                            T*                        csr_val_G,
+                                            const rocsparse_int*      csr_row_ptr_G,
+                                            rocsparse_int*            csr_col_ind_G)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(descr_A == nullptr || descr_S == nullptr || descr_G == nullptr || info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrfsai"),
+              m,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_S,
+              nnz_S,
+              (const void*&)csr_row_ptr_S,
+              (const void*&)csr_col_ind_S,
+              (const void*&)info,
+              (const void*&)descr_G,
+              (const void*&)csr_val_G,
+              (const void*&)csr_row_ptr_G,
+              (const void*&)csr_col_ind_G);
+
+    log_bench(handle, "./rocsparse-bench -f csrfsai -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz_A < 0 || nnz_S < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr_A == nullptr || csr_row_ptr_S == nullptr || csr_val_G == nullptr
+       || csr_row_ptr_G == nullptr || csr_col_ind_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val_A == nullptr && csr_col_ind_A != nullptr)
+       || (csr_val_A != nullptr && csr_col_ind_A == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_A != 0 && (csr_val_A == nullptr && csr_col_ind_A == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_S != 0 && csr_col_ind_S == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Allocate buffer to hold zero pivot
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Initialize zero pivot on the device, such that no host synchronization is required
+    hipLaunchKernelGGL((set_array_to_value<1>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       1,
+                       (rocsparse_int*)info->zero_pivot,
+                       std::numeric_limits<rocsparse_int>::max());
+
+    // Each row of G is computed by CSRFSAI_MAXDIM lanes, one per entry of the row
+    hipLaunchKernelGGL((csrfsai_kernel<CSRFSAI_DIM, CSRFSAI_MAXDIM>),
+                       dim3((m - 1) / (CSRFSAI_DIM / CSRFSAI_MAXDIM) + 1),
+                       dim3(CSRFSAI_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_S,
+                       csr_col_ind_S,
+                       csr_row_ptr_G,
+                       csr_col_ind_G,
+                       csr_val_G,
+                       (rocsparse_int*)info->zero_pivot,
+                       descr_A->base,
+                       descr_S->base,
+                       descr_G->base);
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrfsai_zero_pivot(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrfsai_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 it can happen, that the zero pivot is not created.
+    // In this case, always return -1.
+    if(info->zero_pivot == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_int             m,             \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnz_A,         \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_S,       \
+                                     rocsparse_int             nnz_S,         \
+                                     const rocsparse_int*      csr_row_ptr_S, \
+                                     const rocsparse_int*      csr_col_ind_S, \
+                                     rocsparse_mat_info        info,          \
+                                     const rocsparse_mat_descr descr_G,       \
+                                     TYPE*                     csr_val_G,     \
+                                     const rocsparse_int*      csr_row_ptr_G, \
+                                     rocsparse_int*            csr_col_ind_G) \
+    {                                                                         \
+        return rocsparse_csrfsai_template(handle,                             \
+                                          m,                                  \
+                                          descr_A,                            \
+                                          nnz_A,                              \
+                                          csr_val_A,                          \
+                                          csr_row_ptr_A,                      \
+                                          csr_col_ind_A,                      \
+                                          descr_S,                            \
+                                          nnz_S,                              \
+                                          csr_row_ptr_S,                      \
+                                          csr_col_ind_S,                      \
+                                          info,                               \
+                                          descr_G,                            \
+                                          csr_val_G,                          \
+                                          csr_row_ptr_G,                      \
+                                          csr_col_ind_G);                     \
+    }
+
+C_IMPL(rocsparse_scsrfsai, float);
+C_IMPL(rocsparse_dcsrfsai, double);
+C_IMPL(rocsparse_ccsrfsai, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrfsai, rocsparse_double_complex);
+
+#undef C_IMPL
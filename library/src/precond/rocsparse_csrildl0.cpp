@@ -0,0 +1,1133 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "../level2/rocsparse_csrsv.hpp"
+#include "csrildl0_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          bool         SLEEP,
+          typename T,
+          typename U,
+          typename V>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrildl0_binsearch(rocsparse_int        m,
+                            const rocsparse_int* csr_row_ptr,
+                            const rocsparse_int* csr_col_ind,
+                            T*                   csr_val,
+                            const rocsparse_int* csr_diag_ind,
+                            int*                 done,
+                            const rocsparse_int* map,
+                            rocsparse_int*       zero_pivot,
+                            rocsparse_index_base idx_base,
+                            int                  enable_boost,
+                            U                    boost_tol_device_host,
+                            V                    boost_val_device_host)
+{
+    auto boost_tol = (enable_boost) ? load_scalar_device_host(boost_tol_device_host)
+                                    : zero_scalar_device_host(boost_tol_device_host);
+
+    auto boost_val = (enable_boost) ? load_scalar_device_host(boost_val_device_host)
+                                    : zero_scalar_device_host(boost_val_device_host);
+
+    csrildl0_binsearch_kernel<BLOCKSIZE, WFSIZE, SLEEP>(m,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        csr_val,
+                                                        csr_diag_ind,
+                                                        done,
+                                                        map,
+                                                        zero_pivot,
+                                                        idx_base,
+                                                        enable_boost,
+                                                        boost_tol,
+                                                        boost_val);
+}
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASH,
+          typename T,
+          typename U,
+          typename V>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void csrildl0_hash(rocsparse_int        m,
+                                                                 const rocsparse_int* csr_row_ptr,
+                                                                 const rocsparse_int* csr_col_ind,
+                                                                 T*                   csr_val,
+                                                                 const rocsparse_int* csr_diag_ind,
+                                                                 int*                 done,
+                                                                 const rocsparse_int* map,
+                                                                 rocsparse_int*       zero_pivot,
+                                                                 rocsparse_index_base idx_base,
+                                                                 int                  enable_boost,
+                                                                 U boost_tol_device_host,
+                                                                 V boost_val_device_host)
+{
+    auto boost_tol = (enable_boost) ? load_scalar_device_host(boost_tol_device_host)
+                                    : zero_scalar_device_host(boost_tol_device_host);
+
+    auto boost_val = (enable_boost) ? load_scalar_device_host(boost_val_device_host)
+                                    : zero_scalar_device_host(boost_val_device_host);
+
+    csrildl0_hash_kernel<BLOCKSIZE, WFSIZE, HASH>(m,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  csr_diag_ind,
+                                                  done,
+                                                  map,
+                                                  zero_pivot,
+                                                  idx_base,
+                                                  enable_boost,
+                                                  boost_tol,
+                                                  boost_val);
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrildl0_diag_scale(rocsparse_int m,
+                             const T* __restrict__ csr_val,
+                             const rocsparse_int* __restrict__ csr_diag_ind,
+                             T* __restrict__ x)
+{
+    csrildl0_diag_scale_device<BLOCKSIZE>(m, csr_val, csr_diag_ind, x);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrildl0_numeric_boost_template(rocsparse_handle   handle,
+                                                           rocsparse_mat_info info,
+                                                           int                enable_boost,
+                                                           const U*           boost_tol,
+                                                           const T*           boost_val)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrildl0_numeric_boost"),
+              (const void*&)info,
+              enable_boost,
+              (const void*&)boost_tol,
+              (const void*&)boost_val);
+
+    // Reset boost
+    info->boost_enable        = 0;
+    info->use_double_prec_tol = 0;
+
+    // Numeric boost
+    if(enable_boost)
+    {
+        // Check pointer arguments
+        if(boost_tol == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(boost_val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        info->boost_enable        = enable_boost;
+        info->use_double_prec_tol = std::is_same<U, double>();
+        info->boost_tol           = reinterpret_cast<const void*>(boost_tol);
+        info->boost_val           = reinterpret_cast<const void*>(boost_val);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrildl0_buffer_size_template(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const T*                  csr_val,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         rocsparse_mat_info        info,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrildl0_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // The transposed triangular solve requires the largest buffer
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size_template(handle,
+                                                                   rocsparse_operation_transpose,
+                                                                   m,
+                                                                   nnz,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   info,
+                                                                   buffer_size));
+
+    // Intermediate vector of the solve
+    if(m > 0)
+    {
+        *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrildl0_analysis_template(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy    solve,
+                                                      void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrildl0_analysis"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              solve,
+              analysis);
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check analysis policy
+    if(rocsparse_enum_utils::is_invalid(analysis))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(solve))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(solve != rocsparse_solve_policy_auto)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Differentiate the analysis policies
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        // We try to re-use already analyzed lower part, if available.
+        // It is the user's responsibility that this data is still valid,
+        // since he passed the 'reuse' flag.
+
+        // If csrildl0 meta data is already available, do nothing
+        if(info->csrildl0_info != nullptr)
+        {
+            return rocsparse_status_success;
+        }
+
+        // Check for other lower analysis meta data
+
+        if(info->csric0_info != nullptr)
+        {
+            // csric0 meta data
+            info->csrildl0_info = info->csric0_info;
+            return rocsparse_status_success;
+        }
+        else if(info->csrilu0_info != nullptr)
+        {
+            // csrilu0 meta data
+            info->csrildl0_info = info->csrilu0_info;
+            return rocsparse_status_success;
+        }
+        else if(info->csrsv_lower_info != nullptr)
+        {
+            // csrsv meta data
+            info->csrildl0_info = info->csrsv_lower_info;
+            return rocsparse_status_success;
+        }
+        else if(info->csrsm_lower_info != nullptr)
+        {
+            // csrsm meta data
+            info->csrildl0_info = info->csrsm_lower_info;
+            return rocsparse_status_success;
+        }
+    }
+
+    // User is explicitly asking to force a re-analysis, or no valid data has been
+    // found to be re-used.
+
+    // Clear csrildl0 info, if it is not shared
+    if(!rocsparse_check_trm_shared(info, info->csrildl0_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrildl0_info));
+    }
+
+    // Create csrildl0 info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&info->csrildl0_info));
+
+    // Perform analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                     rocsparse_operation_none,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     info->csrildl0_info,
+                                                     (rocsparse_int**)&info->zero_pivot,
+                                                     temp_buffer));
+
+    return rocsparse_status_success;
+}
+
+#define LAUNCH_CSRILDL0_HASH(WFSIZE, HASH)                                \
+    hipLaunchKernelGGL((csrildl0_hash<CSRILDL0_DIM, WFSIZE, HASH>),       \
+                       csrildl0_blocks,                                   \
+                       csrildl0_threads,                                  \
+                       0,                                                 \
+                       stream,                                            \
+                       m,                                                 \
+                       csr_row_ptr,                                       \
+                       csr_col_ind,                                       \
+                       csr_val,                                           \
+                       (rocsparse_int*)info->csrildl0_info->trm_diag_ind, \
+                       d_done_array,                                      \
+                       (rocsparse_int*)info->csrildl0_info->row_map,      \
+                       (rocsparse_int*)info->zero_pivot,                  \
+                       descr->base,                                       \
+                       info->boost_enable,                                \
+                       boost_tol_device_host,                             \
+                       boost_val_device_host)
+
+#define LAUNCH_CSRILDL0_BINSEARCH(WFSIZE, SLEEP)                          \
+    hipLaunchKernelGGL((csrildl0_binsearch<CSRILDL0_DIM, WFSIZE, SLEEP>), \
+                       csrildl0_blocks,                                   \
+                       csrildl0_threads,                                  \
+                       0,                                                 \
+                       stream,                                            \
+                       m,                                                 \
+                       csr_row_ptr,                                       \
+                       csr_col_ind,                                       \
+                       csr_val,                                           \
+                       (rocsparse_int*)info->csrildl0_info->trm_diag_ind, \
+                       d_done_array,                                      \
+                       (rocsparse_int*)info->csrildl0_info->row_map,      \
+                       (rocsparse_int*)info->zero_pivot,                  \
+                       descr->base,                                       \
+                       info->boost_enable,                                \
+                       boost_tol_device_host,                             \
+                       boost_val_device_host)
+
+template <typename T, typename U, typename V>
+static rocsparse_status rocsparse_csrildl0_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    T*                        csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    void*                     temp_buffer,
+                                                    U                         boost_tol_device_host,
+                                                    V                         boost_val_device_host)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    ptr += 256;
+
+    // done array
+    int* d_done_array = reinterpret_cast<int*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(int) * m, stream));
+
+    // Max nnz per row
+    rocsparse_int max_nnz = info->csrildl0_info->max_nnz;
+
+    // Determine gcnArch and ASIC revision
+    int gcnArch = handle->properties.gcnArch;
+    int asicRev = handle->asic_rev;
+
+#define CSRILDL0_DIM 256
+    dim3 csrildl0_blocks((m * handle->wavefront_size - 1) / CSRILDL0_DIM + 1);
+    dim3 csrildl0_threads(CSRILDL0_DIM);
+
+    if(gcnArch == 908 && asicRev < 2)
+    {
+        LAUNCH_CSRILDL0_BINSEARCH(64, true);
+    }
+    else
+    {
+        if(handle->wavefront_size == 32)
+        {
+            if(max_nnz <= 32)
+            {
+                LAUNCH_CSRILDL0_HASH(32, 1);
+            }
+            else if(max_nnz <= 64)
+            {
+                LAUNCH_CSRILDL0_HASH(32, 2);
+            }
+            else if(max_nnz <= 128)
+            {
+                LAUNCH_CSRILDL0_HASH(32, 4);
+            }
+            else if(max_nnz <= 256)
+            {
+                LAUNCH_CSRILDL0_HASH(32, 8);
+            }
+            else if(max_nnz <= 512)
+            {
+                LAUNCH_CSRILDL0_HASH(32, 16);
+            }
+            else
+            {
+                LAUNCH_CSRILDL0_BINSEARCH(32, false);
+            }
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            if(max_nnz <= 64)
+            {
+                LAUNCH_CSRILDL0_HASH(64, 1);
+            }
+            else if(max_nnz <= 128)
+            {
+                LAUNCH_CSRILDL0_HASH(64, 2);
+            }
+            else if(max_nnz <= 256)
+            {
+                LAUNCH_CSRILDL0_HASH(64, 4);
+            }
+            else if(max_nnz <= 512)
+            {
+                LAUNCH_CSRILDL0_HASH(64, 8);
+            }
+            else if(max_nnz <= 1024)
+            {
+                LAUNCH_CSRILDL0_HASH(64, 16);
+            }
+            else
+            {
+                LAUNCH_CSRILDL0_BINSEARCH(64, false);
+            }
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+    }
+#undef CSRILDL0_DIM
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSRILDL0_BINSEARCH
+#undef LAUNCH_CSRILDL0_HASH
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrildl0_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             T*                        csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_solve_policy    policy,
+                                             void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrildl0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrildl0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrildl0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrildl0_dispatch(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           temp_buffer,
+                                           reinterpret_cast<const U*>(info->boost_tol),
+                                           reinterpret_cast<const T*>(info->boost_val));
+    }
+    else
+    {
+        return rocsparse_csrildl0_dispatch(
+            handle,
+            m,
+            nnz,
+            descr,
+            csr_val,
+            csr_row_ptr,
+            csr_col_ind,
+            info,
+            temp_buffer,
+            (info->boost_enable != 0) ? *reinterpret_cast<const U*>(info->boost_tol)
+                                      : static_cast<U>(0),
+            (info->boost_enable != 0) ? *reinterpret_cast<const T*>(info->boost_val)
+                                      : static_cast<T>(0));
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrildl0_solve_template(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const T*                  alpha_device_host,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   const T*                  x,
+                                                   T*                        y,
+                                                   rocsparse_solve_policy    policy,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrildl0_solve"),
+              m,
+              nnz,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)x,
+              (const void*&)y,
+              policy,
+              (const void*&)temp_buffer);
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || alpha_device_host == nullptr || x == nullptr || y == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // value arrays and column indices arrays must both be null (zero matrix) or both not null
+    if((csr_val == nullptr && csr_col_ind != nullptr)
+       || (csr_val != nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr && csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for csrsv analysis calls of the lower triangular factor
+    if(info->csrsv_lower_info == nullptr || info->csrsvt_lower_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Intermediate vector z
+    T* z = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // Unit lower triangular factor L, where the diagonal holds the pivots D
+    _rocsparse_mat_descr descr_L = *descr;
+
+    descr_L.fill_mode = rocsparse_fill_mode_lower;
+    descr_L.diag_type = rocsparse_diag_type_unit;
+
+    // Solve L * z = alpha * x
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_solve_template(handle,
+                                                             rocsparse_operation_none,
+                                                             m,
+                                                             nnz,
+                                                             alpha_device_host,
+                                                             &descr_L,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info,
+                                                             x,
+                                                             z,
+                                                             policy,
+                                                             ptr));
+
+    // Scale z by the inverse of D
+#define CSRILDL0_DIM 256
+    hipLaunchKernelGGL((csrildl0_diag_scale<CSRILDL0_DIM>),
+                       dim3((m - 1) / CSRILDL0_DIM + 1),
+                       dim3(CSRILDL0_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_val,
+                       (const rocsparse_int*)info->csrsv_lower_info->trm_diag_ind,
+                       z);
+#undef CSRILDL0_DIM
+
+    // Solve L^T * y = z
+    T        one        = static_cast<T>(1);
+    const T* one_device = &one;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        T* d_one = nullptr;
+        rocsparse_one(handle, &d_one);
+
+        one_device = d_one;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_solve_template(handle,
+                                                             rocsparse_operation_transpose,
+                                                             m,
+                                                             nnz,
+                                                             one_device,
+                                                             &descr_L,
+                                                             csr_val,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info,
+                                                             (const T*)z,
+                                                             y,
+                                                             policy,
+                                                             ptr));
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     size_t*                   buffer_size) \
+    {                                                                       \
+        return rocsparse_csrildl0_buffer_size_template(handle,              \
+                                                       m,                   \
+                                                       nnz,                 \
+                                                       descr,               \
+                                                       csr_val,             \
+                                                       csr_row_ptr,         \
+                                                       csr_col_ind,         \
+                                                       info,                \
+                                                       buffer_size);        \
+    }
+
+C_IMPL(rocsparse_scsrildl0_buffer_size, float);
+C_IMPL(rocsparse_dcsrildl0_buffer_size, double);
+C_IMPL(rocsparse_ccsrildl0_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrildl0_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, REAL)                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle   handle,       \
+                                     rocsparse_mat_info info,         \
+                                     int                enable_boost, \
+                                     const REAL*        boost_tol,    \
+                                     const TYPE*        boost_val)    \
+    {                                                                 \
+        return rocsparse_csrildl0_numeric_boost_template(             \
+            handle, info, enable_boost, boost_tol, boost_val);        \
+    }
+
+C_IMPL(rocsparse_scsrildl0_numeric_boost, float, float);
+C_IMPL(rocsparse_dcsrildl0_numeric_boost, double, double);
+C_IMPL(rocsparse_ccsrildl0_numeric_boost, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrildl0_numeric_boost, rocsparse_double_complex, double);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_analysis_policy analysis,    \
+                                     rocsparse_solve_policy    solve,       \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrildl0_analysis_template(handle,                 \
+                                                    m,                      \
+                                                    nnz,                    \
+                                                    descr,                  \
+                                                    csr_val,                \
+                                                    csr_row_ptr,            \
+                                                    csr_col_ind,            \
+                                                    info,                   \
+                                                    analysis,               \
+                                                    solve,                  \
+                                                    temp_buffer);           \
+    }
+
+C_IMPL(rocsparse_scsrildl0_analysis, float);
+C_IMPL(rocsparse_dcsrildl0_analysis, double);
+C_IMPL(rocsparse_ccsrildl0_analysis, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrildl0_analysis, rocsparse_double_complex);
+
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_csrildl0_clear(rocsparse_handle   handle,
+                                                     rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrildl0_clear", (const void*&)info);
+
+    // If meta data is not shared, delete it
+    if(!rocsparse_check_trm_shared(info, info->csrildl0_info))
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrildl0_info));
+    }
+
+    info->csrildl0_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+// The numeric boost is shared with csrilu0, whose mixed precision variants set up a double
+// precision tolerance for single precision matrices
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                \
+                                     rocsparse_int             m,                     \
+                                     rocsparse_int             nnz,                   \
+                                     const rocsparse_mat_descr descr,                 \
+                                     TYPE*                     csr_val,               \
+                                     const rocsparse_int*      csr_row_ptr,           \
+                                     const rocsparse_int*      csr_col_ind,           \
+                                     rocsparse_mat_info        info,                  \
+                                     rocsparse_solve_policy    policy,                \
+                                     void*                     temp_buffer)           \
+    {                                                                                 \
+        if(info != nullptr && info->use_double_prec_tol)                              \
+        {                                                                             \
+            return rocsparse_csrildl0_template<TYPE, double>(handle,                  \
+                                                             m,                       \
+                                                             nnz,                     \
+                                                             descr,                   \
+                                                             csr_val,                 \
+                                                             csr_row_ptr,             \
+                                                             csr_col_ind,             \
+                                                             info,                    \
+                                                             policy,                  \
+                                                             temp_buffer);            \
+        }                                                                             \
+                                                                                      \
+        return rocsparse_csrildl0_template<TYPE, floating_data_t<TYPE>>(handle,       \
+                                                                        m,            \
+                                                                        nnz,          \
+                                                                        descr,        \
+                                                                        csr_val,      \
+                                                                        csr_row_ptr,  \
+                                                                        csr_col_ind,  \
+                                                                        info,         \
+                                                                        policy,       \
+                                                                        temp_buffer); \
+    }
+
+C_IMPL(rocsparse_scsrildl0, float);
+C_IMPL(rocsparse_dcsrildl0, double);
+C_IMPL(rocsparse_ccsrildl0, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrildl0, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const TYPE*               alpha,       \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     const TYPE*               x,           \
+                                     TYPE*                     y,           \
+                                     rocsparse_solve_policy    policy,      \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrildl0_solve_template(handle,                    \
+                                                 m,                         \
+                                                 nnz,                       \
+                                                 alpha,                     \
+                                                 descr,                     \
+                                                 csr_val,                   \
+                                                 csr_row_ptr,               \
+                                                 csr_col_ind,               \
+                                                 info,                      \
+                                                 x,                         \
+                                                 y,                         \
+                                                 policy,                    \
+                                                 temp_buffer);              \
+    }
+
+C_IMPL(rocsparse_scsrildl0_solve, float);
+C_IMPL(rocsparse_dcsrildl0_solve, double);
+C_IMPL(rocsparse_ccsrildl0_solve, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrildl0_solve, rocsparse_double_complex);
+
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_csrildl0_zero_pivot(rocsparse_handle   handle,
+                                                          rocsparse_mat_info info,
+                                                          rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrildl0_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->csrildl0_info == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
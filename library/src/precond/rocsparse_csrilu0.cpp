@@ -308,6 +308,49 @@ extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle   handle,
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csrilu0_level_info(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         int64_t*           nlevels,
+                                                         int64_t*           max_width,
+                                                         int64_t*           critical_path)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrilu0_level_info",
+              (const void*&)info,
+              (const void*&)nlevels,
+              (const void*&)max_width,
+              (const void*&)critical_path);
+
+    // Check pointer arguments
+    if(nlevels == nullptr || max_width == nullptr || critical_path == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Analysis has not been performed
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *nlevels       = info->csrilu0_info->nlevels;
+    *max_width     = info->csrilu0_info->max_width;
+    *critical_path = info->csrilu0_info->critical_path;
+
+    return rocsparse_status_success;
+}
+
 extern "C" rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                rocsparse_int             nnz,
@@ -426,6 +469,25 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   hand
         return rocsparse_status_success;
     }
 
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
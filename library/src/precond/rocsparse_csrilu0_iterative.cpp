@@ -0,0 +1,537 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "csrilu0_iterative_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrilu0_iterative_init(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ a_val,
+                                T* __restrict__ x,
+                                const rocsparse_int* __restrict__ csr_diag_ind,
+                                rocsparse_index_base idx_base)
+{
+    csrilu0_iterative_init_device<BLOCKSIZE, WFSIZE>(
+        m, csr_row_ptr, csr_col_ind, a_val, x, csr_diag_ind, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrilu0_iterative_sweep(rocsparse_int m,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 const T* __restrict__ a_val,
+                                 const T* __restrict__ x_old,
+                                 T* __restrict__ x_new,
+                                 const rocsparse_int* __restrict__ csr_diag_ind,
+                                 rocsparse_index_base idx_base)
+{
+    csrilu0_iterative_sweep_device<BLOCKSIZE, WFSIZE>(
+        m, csr_row_ptr, csr_col_ind, a_val, x_old, x_new, csr_diag_ind, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrilu0_iterative_residual(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const T* __restrict__ a_val,
+                                    const T* __restrict__ x,
+                                    const rocsparse_int* __restrict__ csr_diag_ind,
+                                    floating_data_t<T>* __restrict__ residual,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base)
+{
+    csrilu0_iterative_residual_device<BLOCKSIZE, WFSIZE>(
+        m, csr_row_ptr, csr_col_ind, a_val, x, csr_diag_ind, residual, zero_pivot, idx_base);
+}
+
+template <typename T>
+__launch_bounds__(1) ROCSPARSE_KERNEL void csrilu0_iterative_sqrt(T* __restrict__ residual)
+{
+    *residual = sqrt(*residual);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_iterative_buffer_size_template(rocsparse_handle          handle,
+                                                                  rocsparse_int             m,
+                                                                  rocsparse_int             nnz,
+                                                                  const rocsparse_mat_descr descr,
+                                                                  const T*                  csr_val,
+                                                                  const rocsparse_int* csr_row_ptr,
+                                                                  const rocsparse_int* csr_col_ind,
+                                                                  size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_iterative_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Do not return 0 as buffer size
+    *buffer_size = 4;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Copy of A and second iterate
+    *buffer_size = sizeof(T) * ((nnz - 1) / 256 + 1) * 256 * 2;
+
+    // Squared residual of each entry and its sum
+    *buffer_size += sizeof(floating_data_t<T>) * ((nnz - 1) / 256 + 1) * 256;
+    *buffer_size += 256;
+
+    // rocprim buffer for the residual norm
+    size_t              rocprim_size;
+    floating_data_t<T>* ptr = reinterpret_cast<floating_data_t<T>*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
+                                        rocprim_size,
+                                        ptr,
+                                        ptr,
+                                        static_cast<floating_data_t<T>>(0),
+                                        nnz,
+                                        rocprim::plus<floating_data_t<T>>(),
+                                        handle->stream));
+
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int WFSIZE, typename T>
+static rocsparse_status rocsparse_csrilu0_iterative_dispatch(rocsparse_handle          handle,
+                                                             rocsparse_int             m,
+                                                             rocsparse_int             nnz,
+                                                             const rocsparse_mat_descr descr,
+                                                             T*                        csr_val,
+                                                             const rocsparse_int*      csr_row_ptr,
+                                                             const rocsparse_int*      csr_col_ind,
+                                                             rocsparse_mat_info        info,
+                                                             rocsparse_int             sweeps,
+                                                             floating_data_t<T>*       residual,
+                                                             void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Diagonal entry of each row, obtained from the csrilu0 analysis
+    const rocsparse_int* csr_diag_ind
+        = reinterpret_cast<const rocsparse_int*>(info->csrilu0_info->trm_diag_ind);
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    T* a_val = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    T* x_tmp = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+
+    floating_data_t<T>* res = reinterpret_cast<floating_data_t<T>*>(ptr);
+    ptr += sizeof(floating_data_t<T>) * ((nnz - 1) / 256 + 1) * 256;
+
+    floating_data_t<T>* res_sum = reinterpret_cast<floating_data_t<T>*>(ptr);
+    ptr += 256;
+
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Keep a copy of A, the factors are computed in place
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(a_val, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+#define CSRILU0_ITERATIVE_DIM 256
+    dim3 csrilu0_blocks((m - 1) / (CSRILU0_ITERATIVE_DIM / WFSIZE) + 1);
+    dim3 csrilu0_threads(CSRILU0_ITERATIVE_DIM);
+
+    // Initial guess
+    hipLaunchKernelGGL((csrilu0_iterative_init<CSRILU0_ITERATIVE_DIM, WFSIZE>),
+                       csrilu0_blocks,
+                       csrilu0_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       a_val,
+                       csr_val,
+                       csr_diag_ind,
+                       descr->base);
+
+    // Fixed-point sweeps, alternating between csr_val and the second iterate
+    T* x_old = csr_val;
+    T* x_new = x_tmp;
+
+    for(rocsparse_int iter = 0; iter < sweeps; ++iter)
+    {
+        hipLaunchKernelGGL((csrilu0_iterative_sweep<CSRILU0_ITERATIVE_DIM, WFSIZE>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           a_val,
+                           x_old,
+                           x_new,
+                           csr_diag_ind,
+                           descr->base);
+
+        std::swap(x_old, x_new);
+    }
+
+    // Last iterate has to be in csr_val
+    if(x_old != csr_val)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(csr_val, x_old, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+    }
+
+    // Residual of the factorization
+    hipLaunchKernelGGL((csrilu0_iterative_residual<CSRILU0_ITERATIVE_DIM, WFSIZE>),
+                       csrilu0_blocks,
+                       csrilu0_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       a_val,
+                       csr_val,
+                       csr_diag_ind,
+                       res,
+                       (rocsparse_int*)info->zero_pivot,
+                       descr->base);
+#undef CSRILU0_ITERATIVE_DIM
+
+    // Residual norm
+    floating_data_t<T>* res_norm
+        = (handle->pointer_mode == rocsparse_pointer_mode_device) ? residual : res_sum;
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
+                                        rocprim_size,
+                                        res,
+                                        res_norm,
+                                        static_cast<floating_data_t<T>>(0),
+                                        nnz,
+                                        rocprim::plus<floating_data_t<T>>(),
+                                        stream));
+    RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
+                                        rocprim_size,
+                                        res,
+                                        res_norm,
+                                        static_cast<floating_data_t<T>>(0),
+                                        nnz,
+                                        rocprim::plus<floating_data_t<T>>(),
+                                        stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL(
+            (csrilu0_iterative_sqrt<floating_data_t<T>>), dim3(1), dim3(1), 0, stream, residual);
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            residual, res_sum, sizeof(floating_data_t<T>), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        *residual = std::sqrt(*residual);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_iterative_template(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      T*                        csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_int             sweeps,
+                                                      floating_data_t<T>*       residual,
+                                                      void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilu0_iterative"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              sweeps,
+              (const void*&)residual,
+              (const void*&)temp_buffer);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0 || sweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || info == nullptr || residual == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // The residual is read back to the host in host pointer mode. This cannot be
+    // captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled
+       && handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemsetAsync(residual, 0, sizeof(floating_data_t<T>), handle->stream));
+        }
+        else
+        {
+            *residual = static_cast<floating_data_t<T>>(0);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Number of lanes per row, depending on the average number of entries per row
+    rocsparse_int nnz_per_row = (nnz - 1) / m + 1;
+
+    if(nnz_per_row <= 4)
+    {
+        return rocsparse_csrilu0_iterative_dispatch<4>(handle,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       info,
+                                                       sweeps,
+                                                       residual,
+                                                       temp_buffer);
+    }
+    else if(nnz_per_row <= 8)
+    {
+        return rocsparse_csrilu0_iterative_dispatch<8>(handle,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       csr_val,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       info,
+                                                       sweeps,
+                                                       residual,
+                                                       temp_buffer);
+    }
+    else if(nnz_per_row <= 16)
+    {
+        return rocsparse_csrilu0_iterative_dispatch<16>(handle,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        sweeps,
+                                                        residual,
+                                                        temp_buffer);
+    }
+    else if(nnz_per_row <= 32)
+    {
+        return rocsparse_csrilu0_iterative_dispatch<32>(handle,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        sweeps,
+                                                        residual,
+                                                        temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csrilu0_iterative_dispatch<64>(handle,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        info,
+                                                        sweeps,
+                                                        residual,
+                                                        temp_buffer);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             nnz,           \
+                                     const rocsparse_mat_descr descr,         \
+                                     const TYPE*               csr_val,       \
+                                     const rocsparse_int*      csr_row_ptr,   \
+                                     const rocsparse_int*      csr_col_ind,   \
+                                     size_t*                   buffer_size)   \
+    {                                                                         \
+        return rocsparse_csrilu0_iterative_buffer_size_template(handle,       \
+                                                                m,            \
+                                                                nnz,          \
+                                                                descr,        \
+                                                                csr_val,      \
+                                                                csr_row_ptr,  \
+                                                                csr_col_ind,  \
+                                                                buffer_size); \
+    }
+
+C_IMPL(rocsparse_scsrilu0_iterative_buffer_size, float);
+C_IMPL(rocsparse_dcsrilu0_iterative_buffer_size, double);
+C_IMPL(rocsparse_ccsrilu0_iterative_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrilu0_iterative_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, TYPE2)                                           \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     TYPE*                     csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_int             sweeps,      \
+                                     TYPE2*                    residual,    \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrilu0_iterative_template(handle,                 \
+                                                    m,                      \
+                                                    nnz,                    \
+                                                    descr,                  \
+                                                    csr_val,                \
+                                                    csr_row_ptr,            \
+                                                    csr_col_ind,            \
+                                                    info,                   \
+                                                    sweeps,                 \
+                                                    residual,               \
+                                                    temp_buffer);           \
+    }
+
+C_IMPL(rocsparse_scsrilu0_iterative, float, float);
+C_IMPL(rocsparse_dcsrilu0_iterative, double, double);
+C_IMPL(rocsparse_ccsrilu0_iterative, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrilu0_iterative, rocsparse_double_complex, double);
+
+#undef C_IMPL
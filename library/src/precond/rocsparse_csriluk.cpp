@@ -0,0 +1,870 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "../extra/csrgemm_device.h"
+#include "csriluk_device.h"
+#include "definitions.h"
+#include "rocsparse_csrilu0.hpp"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int CHUNKSIZE, bool FILL>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csriluk_symbolic(rocsparse_int m,
+                          rocsparse_int lfil,
+                          const rocsparse_int* __restrict__ csr_row_ptr_A,
+                          const rocsparse_int* __restrict__ csr_col_ind_A,
+                          const int* __restrict__ csr_lev_A,
+                          rocsparse_int* __restrict__ csr_row_ptr_B,
+                          rocsparse_int* __restrict__ csr_col_ind_B,
+                          int* __restrict__ csr_lev_B,
+                          rocsparse_index_base idx_base_A,
+                          rocsparse_index_base idx_base_B)
+{
+    csriluk_symbolic_block_per_row_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, FILL>(m,
+                                                                              lfil,
+                                                                              csr_row_ptr_A,
+                                                                              csr_col_ind_A,
+                                                                              csr_lev_A,
+                                                                              csr_row_ptr_B,
+                                                                              csr_col_ind_B,
+                                                                              csr_lev_B,
+                                                                              idx_base_A,
+                                                                              idx_base_B);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csriluk_fill_values(rocsparse_int m,
+                             const rocsparse_int* __restrict__ csr_row_ptr_A,
+                             const rocsparse_int* __restrict__ csr_col_ind_A,
+                             const T* __restrict__ csr_val_A,
+                             const rocsparse_int* __restrict__ csr_row_ptr_B,
+                             const rocsparse_int* __restrict__ csr_col_ind_B,
+                             T* __restrict__ csr_val_B,
+                             rocsparse_index_base idx_base_A,
+                             rocsparse_index_base idx_base_B)
+{
+    csriluk_fill_values_device<BLOCKSIZE, WFSIZE>(m,
+                                                  csr_row_ptr_A,
+                                                  csr_col_ind_A,
+                                                  csr_val_A,
+                                                  csr_row_ptr_B,
+                                                  csr_col_ind_B,
+                                                  csr_val_B,
+                                                  idx_base_A,
+                                                  idx_base_B);
+}
+
+// Temporary storage layout of rocsparse_csriluk_nnz, where the row pointers of the
+// intermediate level-of-fill passes are double buffered
+static void rocsparse_csriluk_buffer_layout(rocsparse_int   m,
+                                            void*           temp_buffer,
+                                            rocsparse_int** tmp_row_ptr,
+                                            void**          rocprim_buffer)
+{
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    tmp_row_ptr[0] = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    tmp_row_ptr[1] = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    *rocprim_buffer = reinterpret_cast<void*>(ptr);
+}
+
+// Make sure that the pattern storage of the given slot can hold nnz entries. The storage
+// is owned by info and released by rocsparse_destroy_mat_info(), such that it is reused
+// by subsequent calls and cannot leak on error.
+static rocsparse_status
+    rocsparse_csriluk_reserve(rocsparse_mat_info info, int slot, rocsparse_int nnz)
+{
+    if(info->csriluk_size[slot] >= static_cast<size_t>(nnz))
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipFree(info->csriluk_col_ind[slot]));
+    RETURN_IF_HIP_ERROR(hipFree(info->csriluk_lev[slot]));
+
+    info->csriluk_size[slot]    = 0;
+    info->csriluk_col_ind[slot] = nullptr;
+    info->csriluk_lev[slot]     = nullptr;
+
+    RETURN_IF_HIP_ERROR(
+        hipMalloc((void**)&info->csriluk_col_ind[slot], sizeof(rocsparse_int) * nnz));
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csriluk_lev[slot], sizeof(int) * nnz));
+
+    info->csriluk_size[slot] = nnz;
+
+    return rocsparse_status_success;
+}
+
+// Compute the ILU(k) pattern of A by lfil level-of-fill passes. The row pointers of the
+// intermediate passes are held in the temporary buffer, while the column indices and
+// levels are held in info. The last pass writes the row pointers into csr_row_ptr_LU and
+// keeps the column indices in info, where they are picked up by csriluk_symbolic.
+static rocsparse_status rocsparse_csriluk_symbolic_passes(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_int             lfil,
+                                                          const rocsparse_mat_descr descr_LU,
+                                                          rocsparse_int*            csr_row_ptr_LU,
+                                                          rocsparse_mat_info        info,
+                                                          void*                     temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Number of level-of-fill passes, where a single pass without fill copies the pattern
+    rocsparse_int npass = std::max(lfil, 1);
+
+    // Buffer
+    rocsparse_int* tmp_row_ptr[2];
+    void*          rocprim_buffer;
+
+    rocsparse_csriluk_buffer_layout(m, temp_buffer, tmp_row_ptr, &rocprim_buffer);
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_LU,
+                                                csr_row_ptr_LU,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Pattern and levels of the current pass, starting with the pattern of A
+    const rocsparse_int* csr_row_ptr_S = csr_row_ptr;
+    const rocsparse_int* csr_col_ind_S = csr_col_ind;
+    const int*           csr_lev_S     = nullptr;
+    rocsparse_index_base base_S        = descr->base;
+
+    // Invalidate any previously computed pattern
+    info->csriluk_nnz = -1;
+
+    rocsparse_int nnz_B = 0;
+
+    for(rocsparse_int pass = 1; pass <= npass; ++pass)
+    {
+        bool last = (pass == npass);
+        int  slot = pass & 1;
+
+        // The last pass writes into the ILU(k) pattern
+        rocsparse_int*       csr_row_ptr_B = tmp_row_ptr[slot];
+        rocsparse_index_base base_B        = rocsparse_index_base_zero;
+
+        if(last == true)
+        {
+            csr_row_ptr_B = csr_row_ptr_LU;
+            base_B        = descr_LU->base;
+        }
+
+        // Compute the number of entries of each row
+#define CSRILUK_DIM 256
+#define CSRILUK_SUB 16
+#define CSRILUK_CHUNKSIZE 2048
+        hipLaunchKernelGGL((csriluk_symbolic<CSRILUK_DIM, CSRILUK_SUB, CSRILUK_CHUNKSIZE, false>),
+                           dim3(m),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           lfil,
+                           csr_row_ptr_S,
+                           csr_col_ind_S,
+                           csr_lev_S,
+                           csr_row_ptr_B,
+                           (rocsparse_int*)nullptr,
+                           (int*)nullptr,
+                           base_S,
+                           base_B);
+#undef CSRILUK_CHUNKSIZE
+#undef CSRILUK_SUB
+#undef CSRILUK_DIM
+
+        // Exclusive sum to obtain row pointers
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                    rocprim_size,
+                                                    csr_row_ptr_B,
+                                                    csr_row_ptr_B,
+                                                    static_cast<rocsparse_int>(base_B),
+                                                    m + 1,
+                                                    rocprim::plus<rocsparse_int>(),
+                                                    stream));
+
+        // The number of entries of the pass determines the size of its pattern
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &nnz_B, csr_row_ptr_B + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        nnz_B -= base_B;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_reserve(info, slot, nnz_B));
+
+        // Compute the column indices and levels
+#define CSRILUK_DIM 256
+#define CSRILUK_SUB 16
+#define CSRILUK_CHUNKSIZE 2048
+        hipLaunchKernelGGL((csriluk_symbolic<CSRILUK_DIM, CSRILUK_SUB, CSRILUK_CHUNKSIZE, true>),
+                           dim3(m),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           lfil,
+                           csr_row_ptr_S,
+                           csr_col_ind_S,
+                           csr_lev_S,
+                           csr_row_ptr_B,
+                           info->csriluk_col_ind[slot],
+                           (last == true) ? (int*)nullptr : info->csriluk_lev[slot],
+                           base_S,
+                           base_B);
+#undef CSRILUK_CHUNKSIZE
+#undef CSRILUK_SUB
+#undef CSRILUK_DIM
+
+        // The next pass extends the pattern of this pass
+        csr_row_ptr_S = csr_row_ptr_B;
+        csr_col_ind_S = info->csriluk_col_ind[slot];
+        csr_lev_S     = info->csriluk_lev[slot];
+        base_S        = base_B;
+    }
+
+    // Keep the ILU(k) pattern for csriluk_symbolic
+    info->csriluk_nnz  = nnz_B;
+    info->csriluk_slot = npass & 1;
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csriluk_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             nnz_LU,
+                                            const rocsparse_mat_descr descr_LU,
+                                            T*                        csr_val_LU,
+                                            const rocsparse_int*      csr_row_ptr_LU,
+                                            const rocsparse_int*      csr_col_ind_LU,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_solve_policy    policy,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              nnz_LU,
+              (const void*&)descr_LU,
+              (const void*&)csr_val_LU,
+              (const void*&)csr_row_ptr_LU,
+              (const void*&)csr_col_ind_LU,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    // Check solve policy
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0 || nnz_LU < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || descr_LU == nullptr
+       || csr_row_ptr_LU == nullptr || info == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_LU != 0 && (csr_val_LU == nullptr || csr_col_ind_LU == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       || descr_LU->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Initialize the ILU(k) pattern with the values of A
+#define CSRILUK_DIM 256
+#define CSRILUK_SUB 16
+    hipLaunchKernelGGL((csriluk_fill_values<CSRILUK_DIM, CSRILUK_SUB>),
+                       dim3((CSRILUK_SUB * m - 1) / CSRILUK_DIM + 1),
+                       dim3(CSRILUK_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       csr_row_ptr_LU,
+                       csr_col_ind_LU,
+                       csr_val_LU,
+                       descr->base,
+                       descr_LU->base);
+#undef CSRILUK_SUB
+#undef CSRILUK_DIM
+
+    // Incomplete LU factorization on the ILU(k) pattern, using the meta data that has
+    // been collected by csrilu0 analysis of the ILU(k) pattern
+    return rocsparse_csrilu0_template<T, U>(handle,
+                                            m,
+                                            nnz_LU,
+                                            descr_LU,
+                                            csr_val_LU,
+                                            csr_row_ptr_LU,
+                                            csr_col_ind_LU,
+                                            info,
+                                            policy,
+                                            temp_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csriluk_buffer_size(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          rocsparse_int             lfil,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              lfil,
+              (const void*&)buffer_size);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check level of fill
+    if(lfil < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Do not return 0 as buffer size
+    *buffer_size = 4;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Row pointers of the intermediate level-of-fill passes
+    *buffer_size = sizeof(rocsparse_int) * (m / 256 + 1) * 256 * 2;
+
+    // rocprim buffer for the row pointers
+    size_t         rocprim_size;
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                ptr,
+                                                ptr,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             lfil,
+                                                  const rocsparse_mat_descr descr_LU,
+                                                  rocsparse_int*            csr_row_ptr_LU,
+                                                  rocsparse_int*            nnz_LU,
+                                                  rocsparse_mat_info        info,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_nnz",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              lfil,
+              (const void*&)descr_LU,
+              (const void*&)csr_row_ptr_LU,
+              (const void*&)nnz_LU,
+              (const void*&)info,
+              (const void*&)temp_buffer);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check level of fill
+    if(lfil < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || descr_LU == nullptr
+       || csr_row_ptr_LU == nullptr || nnz_LU == nullptr || info == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       || descr_LU->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // The number of entries of each level-of-fill pass is read back to the host, to
+    // size its pattern. This cannot be captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        info->csriluk_nnz = 0;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_LU, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_LU = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Compute the ILU(k) pattern
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic_passes(handle,
+                                                                m,
+                                                                descr,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                lfil,
+                                                                descr_LU,
+                                                                csr_row_ptr_LU,
+                                                                info,
+                                                                temp_buffer));
+
+    // Store nnz of the ILU(k) pattern
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_LU,
+                                           csr_row_ptr_LU + m,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz by index base
+        if(descr_LU->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_LU);
+        }
+    }
+    else
+    {
+        *nnz_LU = info->csriluk_nnz;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             lfil,
+                                                       const rocsparse_mat_descr descr_LU,
+                                                       const rocsparse_int*      csr_row_ptr_LU,
+                                                       rocsparse_int*            csr_col_ind_LU,
+                                                       rocsparse_mat_info        info)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_symbolic",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              lfil,
+              (const void*&)descr_LU,
+              (const void*&)csr_row_ptr_LU,
+              (const void*&)csr_col_ind_LU,
+              (const void*&)info);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check level of fill
+    if(lfil < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || descr_LU == nullptr
+       || csr_row_ptr_LU == nullptr || csr_col_ind_LU == nullptr || info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       || descr_LU->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check for the ILU(k) pattern of csriluk_nnz
+    if(info->csriluk_nnz < 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Copy the column indices of the ILU(k) pattern
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind_LU,
+                                       info->csriluk_col_ind[info->csriluk_slot],
+                                       sizeof(rocsparse_int) * info->csriluk_nnz,
+                                       hipMemcpyDeviceToDevice,
+                                       handle->stream));
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             nnz_LU,
+                                               const rocsparse_mat_descr descr_LU,
+                                               float*                    csr_val_LU,
+                                               const rocsparse_int*      csr_row_ptr_LU,
+                                               const rocsparse_int*      csr_col_ind_LU,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    if(info != nullptr && info->use_double_prec_tol)
+    {
+        return rocsparse_csriluk_template<float, double>(handle,
+                                                         m,
+                                                         nnz,
+                                                         descr,
+                                                         csr_val,
+                                                         csr_row_ptr,
+                                                         csr_col_ind,
+                                                         nnz_LU,
+                                                         descr_LU,
+                                                         csr_val_LU,
+                                                         csr_row_ptr_LU,
+                                                         csr_col_ind_LU,
+                                                         info,
+                                                         policy,
+                                                         temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csriluk_template<float, float>(handle,
+                                                        m,
+                                                        nnz,
+                                                        descr,
+                                                        csr_val,
+                                                        csr_row_ptr,
+                                                        csr_col_ind,
+                                                        nnz_LU,
+                                                        descr_LU,
+                                                        csr_val_LU,
+                                                        csr_row_ptr_LU,
+                                                        csr_col_ind_LU,
+                                                        info,
+                                                        policy,
+                                                        temp_buffer);
+    }
+}
+
+extern "C" rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             nnz_LU,
+                                               const rocsparse_mat_descr descr_LU,
+                                               double*                   csr_val_LU,
+                                               const rocsparse_int*      csr_row_ptr_LU,
+                                               const rocsparse_int*      csr_col_ind_LU,
+                                               rocsparse_mat_info        info,
+                                               rocsparse_solve_policy    policy,
+                                               void*                     temp_buffer)
+{
+    return rocsparse_csriluk_template<double, double>(handle,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      csr_val,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      nnz_LU,
+                                                      descr_LU,
+                                                      csr_val_LU,
+                                                      csr_row_ptr_LU,
+                                                      csr_col_ind_LU,
+                                                      info,
+                                                      policy,
+                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_ccsriluk(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_int                  nnz_LU,
+                                               const rocsparse_mat_descr      descr_LU,
+                                               rocsparse_float_complex*       csr_val_LU,
+                                               const rocsparse_int*           csr_row_ptr_LU,
+                                               const rocsparse_int*           csr_col_ind_LU,
+                                               rocsparse_mat_info             info,
+                                               rocsparse_solve_policy         policy,
+                                               void*                          temp_buffer)
+{
+    if(info != nullptr && info->use_double_prec_tol)
+    {
+        return rocsparse_csriluk_template<rocsparse_float_complex, double>(handle,
+                                                                           m,
+                                                                           nnz,
+                                                                           descr,
+                                                                           csr_val,
+                                                                           csr_row_ptr,
+                                                                           csr_col_ind,
+                                                                           nnz_LU,
+                                                                           descr_LU,
+                                                                           csr_val_LU,
+                                                                           csr_row_ptr_LU,
+                                                                           csr_col_ind_LU,
+                                                                           info,
+                                                                           policy,
+                                                                           temp_buffer);
+    }
+    else
+    {
+        return rocsparse_csriluk_template<rocsparse_float_complex, float>(handle,
+                                                                          m,
+                                                                          nnz,
+                                                                          descr,
+                                                                          csr_val,
+                                                                          csr_row_ptr,
+                                                                          csr_col_ind,
+                                                                          nnz_LU,
+                                                                          descr_LU,
+                                                                          csr_val_LU,
+                                                                          csr_row_ptr_LU,
+                                                                          csr_col_ind_LU,
+                                                                          info,
+                                                                          policy,
+                                                                          temp_buffer);
+    }
+}
+
+extern "C" rocsparse_status rocsparse_zcsriluk(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_int                   nnz_LU,
+                                               const rocsparse_mat_descr       descr_LU,
+                                               rocsparse_double_complex*       csr_val_LU,
+                                               const rocsparse_int*            csr_row_ptr_LU,
+                                               const rocsparse_int*            csr_col_ind_LU,
+                                               rocsparse_mat_info              info,
+                                               rocsparse_solve_policy          policy,
+                                               void*                           temp_buffer)
+{
+    return rocsparse_csriluk_template<rocsparse_double_complex, double>(handle,
+                                                                        m,
+                                                                        nnz,
+                                                                        descr,
+                                                                        csr_val,
+                                                                        csr_row_ptr,
+                                                                        csr_col_ind,
+                                                                        nnz_LU,
+                                                                        descr_LU,
+                                                                        csr_val_LU,
+                                                                        csr_row_ptr_LU,
+                                                                        csr_col_ind_LU,
+                                                                        info,
+                                                                        policy,
+                                                                        temp_buffer);
+}
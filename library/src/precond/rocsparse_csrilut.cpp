@@ -0,0 +1,895 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "../extra/csrgemm_device.h"
+#include "csrilut_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+// Size of the shared memory hash table that holds the working row. At most half of the
+// table is populated, such that probing remains short.
+#define CSRILUT_HASHSIZE 1024
+
+template <unsigned int BLOCKSIZE, unsigned int HASHSIZE, typename T, typename U, typename V>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrilut_factorize(rocsparse_int      m,
+                           rocsparse_int      max_fill,
+                           floating_data_t<T> tol,
+                           const rocsparse_int* __restrict__ csr_row_ptr,
+                           const rocsparse_int* __restrict__ csr_col_ind,
+                           const T* __restrict__ csr_val,
+                           int* __restrict__ done,
+                           rocsparse_int* __restrict__ ilut_col_ind,
+                           T* __restrict__ ilut_val,
+                           rocsparse_int* __restrict__ ilut_diag_ind,
+                           rocsparse_int* __restrict__ ilut_row_nnz,
+                           rocsparse_int* __restrict__ zero_pivot,
+                           rocsparse_index_base idx_base,
+                           int                  enable_boost,
+                           U                    boost_tol_device_host,
+                           V                    boost_val_device_host)
+{
+    auto boost_tol = (enable_boost) ? load_scalar_device_host(boost_tol_device_host)
+                                    : zero_scalar_device_host(boost_tol_device_host);
+
+    auto boost_val = (enable_boost) ? load_scalar_device_host(boost_val_device_host)
+                                    : zero_scalar_device_host(boost_val_device_host);
+
+    csrilut_factorize_device<BLOCKSIZE, HASHSIZE>(m,
+                                                  max_fill,
+                                                  tol,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  csr_val,
+                                                  done,
+                                                  ilut_col_ind,
+                                                  ilut_val,
+                                                  ilut_diag_ind,
+                                                  ilut_row_nnz,
+                                                  zero_pivot,
+                                                  idx_base,
+                                                  enable_boost,
+                                                  boost_tol,
+                                                  boost_val);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrilut_gather(rocsparse_int m,
+                        rocsparse_int max_fill,
+                        const rocsparse_int* __restrict__ ilut_col_ind,
+                        const T* __restrict__ ilut_val,
+                        const rocsparse_int* __restrict__ csr_row_ptr_LU,
+                        rocsparse_int* __restrict__ csr_col_ind_LU,
+                        T* __restrict__ csr_val_LU,
+                        rocsparse_index_base idx_base_LU)
+{
+    csrilut_gather_device<BLOCKSIZE, WFSIZE>(m,
+                                             max_fill,
+                                             ilut_col_ind,
+                                             ilut_val,
+                                             csr_row_ptr_LU,
+                                             csr_col_ind_LU,
+                                             csr_val_LU,
+                                             idx_base_LU);
+}
+
+// Each part of a row cannot hold more entries than the working row, or than the matrix
+// has columns. Thus, the fill limit is clamped, to bound the padded factorization.
+static inline rocsparse_int rocsparse_csrilut_max_fill(rocsparse_int m, rocsparse_int max_fill)
+{
+    return std::min(max_fill, std::min(m, static_cast<rocsparse_int>(CSRILUT_HASHSIZE / 2)));
+}
+
+// Temporary storage layout, where the padded factorization is kept between
+// rocsparse_csrilut_nnz and rocsparse_csrilut
+template <typename T>
+static void rocsparse_csrilut_buffer_layout(rocsparse_int   m,
+                                            rocsparse_int   max_fill,
+                                            void*           temp_buffer,
+                                            int**           done,
+                                            rocsparse_int** ilut_diag_ind,
+                                            rocsparse_int** ilut_col_ind,
+                                            T**             ilut_val,
+                                            void**          rocprim_buffer)
+{
+    // Row stride of the padded factorization
+    size_t stride = 2 * max_fill + 1;
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    *done = reinterpret_cast<int*>(ptr);
+    ptr += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    *ilut_diag_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    *ilut_col_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((stride * m - 1) / 256 + 1) * 256;
+
+    *ilut_val = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((stride * m - 1) / 256 + 1) * 256;
+
+    *rocprim_buffer = reinterpret_cast<void*>(ptr);
+}
+
+// Factorize, where the number of entries of each row is written to csr_row_ptr_LU
+template <typename T, typename U, typename V>
+static rocsparse_status csrilut_factorize_dispatch(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   floating_data_t<T>        tol,
+                                                   rocsparse_int             max_fill,
+                                                   rocsparse_int*            csr_row_ptr_LU,
+                                                   rocsparse_mat_info        info,
+                                                   int*                      done,
+                                                   rocsparse_int*            ilut_diag_ind,
+                                                   rocsparse_int*            ilut_col_ind,
+                                                   T*                        ilut_val,
+                                                   U                         boost_tol_device_host,
+                                                   V                         boost_val_device_host)
+{
+#define CSRILUT_DIM 256
+    hipLaunchKernelGGL((csrilut_factorize<CSRILUT_DIM, CSRILUT_HASHSIZE>),
+                       dim3(m),
+                       dim3(CSRILUT_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       max_fill,
+                       tol,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       done,
+                       ilut_col_ind,
+                       ilut_val,
+                       ilut_diag_ind,
+                       csr_row_ptr_LU,
+                       (rocsparse_int*)info->zero_pivot,
+                       descr->base,
+                       info->boost_enable,
+                       boost_tol_device_host,
+                       boost_val_device_host);
+#undef CSRILUT_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_numeric_boost_template(rocsparse_handle          handle,
+                                                          rocsparse_mat_info        info,
+                                                          int                       enable_boost,
+                                                          const floating_data_t<T>* boost_tol,
+                                                          const T*                  boost_val)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_numeric_boost"),
+              (const void*&)info,
+              enable_boost,
+              (const void*&)boost_tol,
+              (const void*&)boost_val);
+
+    // Reset boost
+    info->boost_enable        = 0;
+    info->use_double_prec_tol = 0;
+
+    // Numeric boost
+    if(enable_boost)
+    {
+        // Check pointer arguments
+        if(boost_tol == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(boost_val == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        info->boost_enable = enable_boost;
+        info->boost_tol    = reinterpret_cast<const void*>(boost_tol);
+        info->boost_val    = reinterpret_cast<const void*>(boost_val);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_int             max_fill,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              max_fill,
+              (const void*&)buffer_size);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0 || max_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Do not return 0 as buffer size
+    *buffer_size = 4;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    max_fill = rocsparse_csrilut_max_fill(m, max_fill);
+
+    // Row stride of the padded factorization
+    size_t stride = 2 * max_fill + 1;
+
+    // done array
+    *buffer_size = sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    // Diagonal index of each row
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Padded column indices and values
+    *buffer_size += sizeof(rocsparse_int) * ((stride * m - 1) / 256 + 1) * 256;
+    *buffer_size += sizeof(T) * ((stride * m - 1) / 256 + 1) * 256;
+
+    // rocprim buffer for the row pointers of LU
+    size_t         rocprim_size;
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                ptr,
+                                                ptr,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                handle->stream));
+
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_nnz_template(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                const floating_data_t<T>* tol,
+                                                rocsparse_int             max_fill,
+                                                const rocsparse_mat_descr descr_LU,
+                                                rocsparse_int*            csr_row_ptr_LU,
+                                                rocsparse_int*            nnz_LU,
+                                                rocsparse_mat_info        info,
+                                                void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_nnz"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)tol,
+              max_fill,
+              (const void*&)descr_LU,
+              (const void*&)csr_row_ptr_LU,
+              (const void*&)nnz_LU,
+              (const void*&)info,
+              (const void*&)temp_buffer);
+
+    // Check valid sizes
+    if(m < 0 || nnz < 0 || max_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr == nullptr || csr_row_ptr == nullptr || tol == nullptr || descr_LU == nullptr
+       || csr_row_ptr_LU == nullptr || nnz_LU == nullptr || info == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check drop tolerance
+    if(*tol < static_cast<floating_data_t<T>>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       || descr_LU->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // The maximum number of entries per row of A is read back to the host, to verify
+    // that the rows of A fit into the working row. This cannot be captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_LU, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_LU = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    max_fill = rocsparse_csrilut_max_fill(m, max_fill);
+
+    // Buffer
+    int*           done;
+    rocsparse_int* ilut_diag_ind;
+    rocsparse_int* ilut_col_ind;
+    T*             ilut_val;
+    void*          rocprim_buffer;
+
+    rocsparse_csrilut_buffer_layout(
+        m, max_fill, temp_buffer, &done, &ilut_diag_ind, &ilut_col_ind, &ilut_val, &rocprim_buffer);
+
+    // Determine the maximum number of entries per row of A, using the diagonal index
+    // array as workspace
+#define CSRILUT_DIM 256
+    hipLaunchKernelGGL((csrgemm_max_row_nnz_part1<CSRILUT_DIM>),
+                       dim3(CSRILUT_DIM),
+                       dim3(CSRILUT_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       ilut_diag_ind);
+
+    hipLaunchKernelGGL((csrgemm_max_row_nnz_part2<CSRILUT_DIM>),
+                       dim3(1),
+                       dim3(CSRILUT_DIM),
+                       0,
+                       stream,
+                       ilut_diag_ind);
+#undef CSRILUT_DIM
+
+    rocsparse_int max_nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &max_nnz, ilut_diag_ind, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Allocate buffer to hold zero pivot
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Initialize zero pivot
+    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // All entries of a row of A are held in the working row, only fill-in can be dropped
+    if(max_nnz > CSRILUT_HASHSIZE / 2)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Initialize done array
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(int) * m, stream));
+
+    // Factorize, where the number of entries of each row is written to csr_row_ptr_LU
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrilut_factorize_dispatch(
+            handle,
+            m,
+            descr,
+            csr_val,
+            csr_row_ptr,
+            csr_col_ind,
+            *tol,
+            max_fill,
+            csr_row_ptr_LU,
+            info,
+            done,
+            ilut_diag_ind,
+            ilut_col_ind,
+            ilut_val,
+            reinterpret_cast<const floating_data_t<T>*>(info->boost_tol),
+            reinterpret_cast<const T*>(info->boost_val)));
+    }
+    else
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrilut_factorize_dispatch(
+            handle,
+            m,
+            descr,
+            csr_val,
+            csr_row_ptr,
+            csr_col_ind,
+            *tol,
+            max_fill,
+            csr_row_ptr_LU,
+            info,
+            done,
+            ilut_diag_ind,
+            ilut_col_ind,
+            ilut_val,
+            (info->boost_enable != 0)
+                ? *reinterpret_cast<const floating_data_t<T>*>(info->boost_tol)
+                : static_cast<floating_data_t<T>>(0),
+            (info->boost_enable != 0) ? *reinterpret_cast<const T*>(info->boost_val)
+                                      : static_cast<T>(0)));
+    }
+
+    // Exclusive sum to obtain row pointers of LU
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_LU,
+                                                csr_row_ptr_LU,
+                                                static_cast<rocsparse_int>(descr_LU->base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_LU,
+                                                csr_row_ptr_LU,
+                                                static_cast<rocsparse_int>(descr_LU->base),
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Store nnz of LU
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_LU,
+                                           csr_row_ptr_LU + m,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+
+        // Adjust nnz by index base
+        if(descr_LU->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_LU);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_LU, csr_row_ptr_LU + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust nnz by index base
+        *nnz_LU -= descr_LU->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             max_fill,
+                                            rocsparse_int             nnz_LU,
+                                            const rocsparse_mat_descr descr_LU,
+                                            T*                        csr_val_LU,
+                                            const rocsparse_int*      csr_row_ptr_LU,
+                                            rocsparse_int*            csr_col_ind_LU,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut"),
+              m,
+              max_fill,
+              nnz_LU,
+              (const void*&)descr_LU,
+              (const void*&)csr_val_LU,
+              (const void*&)csr_row_ptr_LU,
+              (const void*&)csr_col_ind_LU,
+              (const void*&)temp_buffer);
+
+    // Check valid sizes
+    if(m < 0 || max_fill < 0 || nnz_LU < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_LU == nullptr || csr_row_ptr_LU == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_LU != 0 && (csr_val_LU == nullptr || csr_col_ind_LU == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check matrix type
+    if(descr_LU->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_LU == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    max_fill = rocsparse_csrilut_max_fill(m, max_fill);
+
+    // Buffer
+    int*           done;
+    rocsparse_int* ilut_diag_ind;
+    rocsparse_int* ilut_col_ind;
+    T*             ilut_val;
+    void*          rocprim_buffer;
+
+    rocsparse_csrilut_buffer_layout(
+        m, max_fill, temp_buffer, &done, &ilut_diag_ind, &ilut_col_ind, &ilut_val, &rocprim_buffer);
+
+    // Copy the padded factorization into LU
+#define CSRILUT_DIM 256
+#define CSRILUT_SUB 16
+    hipLaunchKernelGGL((csrilut_gather<CSRILUT_DIM, CSRILUT_SUB>),
+                       dim3((CSRILUT_SUB * m - 1) / CSRILUT_DIM + 1),
+                       dim3(CSRILUT_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       max_fill,
+                       ilut_col_ind,
+                       ilut_val,
+                       csr_row_ptr_LU,
+                       csr_col_ind_LU,
+                       csr_val_LU,
+                       descr_LU->base);
+#undef CSRILUT_SUB
+#undef CSRILUT_DIM
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE, TYPE2)                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle   handle,       \
+                                     rocsparse_mat_info info,         \
+                                     int                enable_boost, \
+                                     const TYPE2*       boost_tol,    \
+                                     const TYPE*        boost_val)    \
+    {                                                                 \
+        return rocsparse_csrilut_numeric_boost_template(              \
+            handle, info, enable_boost, boost_tol, boost_val);        \
+    }
+
+C_IMPL(rocsparse_scsrilut_numeric_boost, float, float);
+C_IMPL(rocsparse_dcsrilut_numeric_boost, double, double);
+C_IMPL(rocsparse_ccsrilut_numeric_boost, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrilut_numeric_boost, rocsparse_double_complex, double);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_int             max_fill,    \
+                                     size_t*                   buffer_size) \
+    {                                                                       \
+        return rocsparse_csrilut_buffer_size_template(handle,               \
+                                                      m,                    \
+                                                      nnz,                  \
+                                                      descr,                \
+                                                      csr_val,              \
+                                                      csr_row_ptr,          \
+                                                      csr_col_ind,          \
+                                                      max_fill,             \
+                                                      buffer_size);         \
+    }
+
+C_IMPL(rocsparse_scsrilut_buffer_size, float);
+C_IMPL(rocsparse_dcsrilut_buffer_size, double);
+C_IMPL(rocsparse_ccsrilut_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrilut_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, TYPE2)                                              \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,         \
+                                     rocsparse_int             m,              \
+                                     rocsparse_int             nnz,            \
+                                     const rocsparse_mat_descr descr,          \
+                                     const TYPE*               csr_val,        \
+                                     const rocsparse_int*      csr_row_ptr,    \
+                                     const rocsparse_int*      csr_col_ind,    \
+                                     const TYPE2*              tol,            \
+                                     rocsparse_int             max_fill,       \
+                                     const rocsparse_mat_descr descr_LU,       \
+                                     rocsparse_int*            csr_row_ptr_LU, \
+                                     rocsparse_int*            nnz_LU,         \
+                                     rocsparse_mat_info        info,           \
+                                     void*                     temp_buffer)    \
+    {                                                                          \
+        return rocsparse_csrilut_nnz_template(handle,                          \
+                                              m,                               \
+                                              nnz,                             \
+                                              descr,                           \
+                                              csr_val,                         \
+                                              csr_row_ptr,                     \
+                                              csr_col_ind,                     \
+                                              tol,                             \
+                                              max_fill,                        \
+                                              descr_LU,                        \
+                                              csr_row_ptr_LU,                  \
+                                              nnz_LU,                          \
+                                              info,                            \
+                                              temp_buffer);                    \
+    }
+
+C_IMPL(rocsparse_scsrilut_nnz, float, float);
+C_IMPL(rocsparse_dcsrilut_nnz, double, double);
+C_IMPL(rocsparse_ccsrilut_nnz, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrilut_nnz, rocsparse_double_complex, double);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                     \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,         \
+                                     rocsparse_int             m,              \
+                                     rocsparse_int             max_fill,       \
+                                     rocsparse_int             nnz_LU,         \
+                                     const rocsparse_mat_descr descr_LU,       \
+                                     TYPE*                     csr_val_LU,     \
+                                     const rocsparse_int*      csr_row_ptr_LU, \
+                                     rocsparse_int*            csr_col_ind_LU, \
+                                     void*                     temp_buffer)    \
+    {                                                                          \
+        return rocsparse_csrilut_template(handle,                              \
+                                          m,                                   \
+                                          max_fill,                            \
+                                          nnz_LU,                              \
+                                          descr_LU,                            \
+                                          csr_val_LU,                          \
+                                          csr_row_ptr_LU,                      \
+                                          csr_col_ind_LU,                      \
+                                          temp_buffer);                        \
+    }
+
+C_IMPL(rocsparse_scsrilut, float);
+C_IMPL(rocsparse_dcsrilut, double);
+C_IMPL(rocsparse_ccsrilut, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrilut, rocsparse_double_complex);
+
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_csrilut_zero_pivot(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilut_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 it can happen, that the zero pivot has not been created.
+    // In this case, always return -1.
+    if(info->zero_pivot == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
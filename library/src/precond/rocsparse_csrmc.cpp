@@ -0,0 +1,1084 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "csrmc_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmc_inverse_map(rocsparse_int m,
+                           const rocsparse_int* __restrict__ row_map,
+                           rocsparse_int* __restrict__ row_pos)
+{
+    csrmc_inverse_map_device<BLOCKSIZE>(m, row_map, row_pos);
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmc_count_colors(rocsparse_int m,
+                            rocsparse_int ncolors,
+                            const rocsparse_int* __restrict__ coloring,
+                            rocsparse_int* __restrict__ color_count)
+{
+    csrmc_count_colors_device<BLOCKSIZE>(m, ncolors, coloring, color_count);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmc_sort_keys(rocsparse_int m,
+                         const rocsparse_int* __restrict__ csr_row_ptr,
+                         const rocsparse_int* __restrict__ csr_col_ind,
+                         const rocsparse_int* __restrict__ row_pos,
+                         unsigned long long* __restrict__ keys,
+                         rocsparse_int* __restrict__ entries,
+                         rocsparse_index_base idx_base)
+{
+    csrmc_sort_keys_device<BLOCKSIZE, WFSIZE>(
+        m, csr_row_ptr, csr_col_ind, row_pos, keys, entries, idx_base);
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmc_diag(rocsparse_int m,
+                    const rocsparse_int* __restrict__ csr_row_ptr,
+                    const rocsparse_int* __restrict__ csr_col_ind,
+                    const rocsparse_int* __restrict__ entry_map,
+                    rocsparse_int* __restrict__ diag_ind,
+                    rocsparse_int* __restrict__ zero_pivot,
+                    rocsparse_index_base idx_base)
+{
+    csrmc_diag_device<BLOCKSIZE>(
+        m, csr_row_ptr, csr_col_ind, entry_map, diag_ind, zero_pivot, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmcsor(rocsparse_int width,
+                  rocsparse_int offset,
+                  const rocsparse_int* __restrict__ row_map,
+                  const rocsparse_int* __restrict__ csr_row_ptr,
+                  const rocsparse_int* __restrict__ csr_col_ind,
+                  const T* __restrict__ csr_val,
+                  U omega_device_host,
+                  const T* __restrict__ b,
+                  T* __restrict__ x,
+                  rocsparse_int* __restrict__ zero_pivot,
+                  rocsparse_index_base idx_base)
+{
+    auto omega = load_scalar_device_host(omega_device_host);
+
+    csrmcsor_device<BLOCKSIZE, WFSIZE>(width,
+                                       offset,
+                                       row_map,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       csr_val,
+                                       omega,
+                                       b,
+                                       x,
+                                       zero_pivot,
+                                       idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmcilu0(rocsparse_int width,
+                   rocsparse_int offset,
+                   const rocsparse_int* __restrict__ row_map,
+                   const rocsparse_int* __restrict__ csr_row_ptr,
+                   const rocsparse_int* __restrict__ csr_col_ind,
+                   T* __restrict__ csr_val,
+                   const rocsparse_int* __restrict__ entry_map,
+                   const rocsparse_int* __restrict__ diag_ind,
+                   rocsparse_int* __restrict__ zero_pivot,
+                   rocsparse_index_base idx_base)
+{
+    csrmcilu0_device<BLOCKSIZE, WFSIZE>(width,
+                                        offset,
+                                        row_map,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        csr_val,
+                                        entry_map,
+                                        diag_ind,
+                                        zero_pivot,
+                                        idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrmcilu0_solve(rocsparse_int width,
+                         rocsparse_int offset,
+                         const rocsparse_int* __restrict__ row_map,
+                         const rocsparse_int* __restrict__ csr_row_ptr,
+                         const rocsparse_int* __restrict__ csr_col_ind,
+                         const T* __restrict__ csr_val,
+                         const rocsparse_int* __restrict__ entry_map,
+                         const rocsparse_int* __restrict__ diag_ind,
+                         const T* x,
+                         T*       y,
+                         rocsparse_int* __restrict__ zero_pivot,
+                         rocsparse_index_base idx_base,
+                         rocsparse_fill_mode  fill_mode)
+{
+    csrmcilu0_solve_device<BLOCKSIZE, WFSIZE>(width,
+                                              offset,
+                                              row_map,
+                                              csr_row_ptr,
+                                              csr_col_ind,
+                                              csr_val,
+                                              entry_map,
+                                              diag_ind,
+                                              x,
+                                              y,
+                                              zero_pivot,
+                                              idx_base,
+                                              fill_mode);
+}
+
+#define CSRMC_DIM 256
+
+// Launch a kernel for a single color, where the number of lanes per row depends on the
+// average number of entries per row
+#define LAUNCH_CSRMC_COLOR(kernel, ...)                                                          \
+    {                                                                                            \
+        rocsparse_int width                                                                      \
+            = static_cast<rocsparse_int>(csrmc->level_ptr[color + 1] - csrmc->level_ptr[color]); \
+        rocsparse_int offset = static_cast<rocsparse_int>(csrmc->level_ptr[color]);              \
+                                                                                                 \
+        if(width > 0)                                                                            \
+        {                                                                                        \
+            if(nnz_per_row <= 4)                                                                 \
+            {                                                                                    \
+                hipLaunchKernelGGL((kernel<CSRMC_DIM, 4>),                                       \
+                                   dim3((width - 1) / (CSRMC_DIM / 4) + 1),                      \
+                                   dim3(CSRMC_DIM),                                              \
+                                   0,                                                            \
+                                   stream,                                                       \
+                                   width,                                                        \
+                                   offset,                                                       \
+                                   __VA_ARGS__);                                                 \
+            }                                                                                    \
+            else if(nnz_per_row <= 8)                                                            \
+            {                                                                                    \
+                hipLaunchKernelGGL((kernel<CSRMC_DIM, 8>),                                       \
+                                   dim3((width - 1) / (CSRMC_DIM / 8) + 1),                      \
+                                   dim3(CSRMC_DIM),                                              \
+                                   0,                                                            \
+                                   stream,                                                       \
+                                   width,                                                        \
+                                   offset,                                                       \
+                                   __VA_ARGS__);                                                 \
+            }                                                                                    \
+            else if(nnz_per_row <= 16)                                                           \
+            {                                                                                    \
+                hipLaunchKernelGGL((kernel<CSRMC_DIM, 16>),                                      \
+                                   dim3((width - 1) / (CSRMC_DIM / 16) + 1),                     \
+                                   dim3(CSRMC_DIM),                                              \
+                                   0,                                                            \
+                                   stream,                                                       \
+                                   width,                                                        \
+                                   offset,                                                       \
+                                   __VA_ARGS__);                                                 \
+            }                                                                                    \
+            else if(nnz_per_row <= 32 || handle->wavefront_size == 32)                           \
+            {                                                                                    \
+                hipLaunchKernelGGL((kernel<CSRMC_DIM, 32>),                                      \
+                                   dim3((width - 1) / (CSRMC_DIM / 32) + 1),                     \
+                                   dim3(CSRMC_DIM),                                              \
+                                   0,                                                            \
+                                   stream,                                                       \
+                                   width,                                                        \
+                                   offset,                                                       \
+                                   __VA_ARGS__);                                                 \
+            }                                                                                    \
+            else                                                                                 \
+            {                                                                                    \
+                hipLaunchKernelGGL((kernel<CSRMC_DIM, 64>),                                      \
+                                   dim3((width - 1) / (CSRMC_DIM / 64) + 1),                     \
+                                   dim3(CSRMC_DIM),                                              \
+                                   0,                                                            \
+                                   stream,                                                       \
+                                   width,                                                        \
+                                   offset,                                                       \
+                                   __VA_ARGS__);                                                 \
+            }                                                                                    \
+        }                                                                                        \
+    }
+
+extern "C" rocsparse_status rocsparse_csrmc_analysis(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_int             ncolors,
+                                                     const rocsparse_int*      coloring,
+                                                     const rocsparse_int*      reordering,
+                                                     rocsparse_mat_info        info)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrmc_analysis",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              ncolors,
+              (const void*&)coloring,
+              (const void*&)reordering,
+              (const void*&)info);
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || ncolors < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Clear previous csrmc info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrmc_info));
+    info->csrmc_info = nullptr;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Each row has to be colored
+    if(ncolors == 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || coloring == nullptr || reordering == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Create csrmc info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_trm_info(&info->csrmc_info));
+
+    rocsparse_trm_info csrmc = info->csrmc_info;
+
+    // Allocate zero pivot, if not already done by a previous analysis
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Initialize zero pivot
+    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+    // Rows grouped by color, as obtained from csrcolor
+    RETURN_IF_HIP_ERROR(hipMalloc(&csrmc->row_map, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc(&csrmc->trm_diag_ind, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc(&csrmc->entry_map, sizeof(rocsparse_int) * std::max(nnz, 1)));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csrmc->row_map, reordering, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+
+    // Temporary storage
+    rocsparse_int*      row_pos;
+    rocsparse_int*      color_count;
+    unsigned long long* keys;
+    rocsparse_int*      entries;
+
+    RETURN_IF_HIP_ERROR(hipMalloc(&row_pos, sizeof(rocsparse_int) * m));
+    RETURN_IF_HIP_ERROR(hipMalloc(&color_count, sizeof(rocsparse_int) * ncolors));
+    RETURN_IF_HIP_ERROR(hipMalloc(&keys, sizeof(unsigned long long) * 2 * std::max(nnz, 1)));
+    RETURN_IF_HIP_ERROR(hipMalloc(&entries, sizeof(rocsparse_int) * std::max(nnz, 1)));
+
+    // Number of rows of each color
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(color_count, 0, sizeof(rocsparse_int) * ncolors, stream));
+
+    hipLaunchKernelGGL((csrmc_count_colors<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       ncolors,
+                       coloring,
+                       color_count);
+
+    std::vector<rocsparse_int> hcolor_count(ncolors);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcolor_count.data(),
+                                       color_count,
+                                       sizeof(rocsparse_int) * ncolors,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Position of each row in the reordering
+    hipLaunchKernelGGL((csrmc_inverse_map<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       reordering,
+                       row_pos);
+
+    // Sort the entries of each row by the position of their column in the reordering,
+    // such that the factorization and the triangular solves process the entries in the
+    // order of the reordered matrix without ever building it
+    if(nnz > 0)
+    {
+        hipLaunchKernelGGL((csrmc_sort_keys<CSRMC_DIM, 8>),
+                           dim3((m - 1) / (CSRMC_DIM / 8) + 1),
+                           dim3(CSRMC_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           row_pos,
+                           keys,
+                           entries,
+                           descr->base);
+
+        // Number of bits required to represent all keys
+        unsigned int             end_bit = 1;
+        const unsigned long long max_key = static_cast<unsigned long long>(m) * m;
+
+        while(end_bit < 64 && (1ULL << end_bit) < max_key)
+        {
+            ++end_bit;
+        }
+
+        rocsparse_int* entry_map = reinterpret_cast<rocsparse_int*>(csrmc->entry_map);
+
+        rocprim::double_buffer<unsigned long long> dkeys(keys, keys + nnz);
+        rocprim::double_buffer<rocsparse_int>      dvals(entries, entry_map);
+
+        size_t rocprim_size;
+        void*  rocprim_buffer = nullptr;
+
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            rocprim_buffer, rocprim_size, dkeys, dvals, nnz, 0, end_bit, stream));
+        RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            rocprim_buffer, rocprim_size, dkeys, dvals, nnz, 0, end_bit, stream));
+
+        if(dvals.current() != entry_map)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(entry_map,
+                                               dvals.current(),
+                                               sizeof(rocsparse_int) * nnz,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+        RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+    }
+
+    // Diagonal entry of each row within the sorted entries
+    hipLaunchKernelGGL((csrmc_diag<CSRMC_DIM>),
+                       dim3((m - 1) / CSRMC_DIM + 1),
+                       dim3(CSRMC_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       (const rocsparse_int*)csrmc->entry_map,
+                       (rocsparse_int*)csrmc->trm_diag_ind,
+                       (rocsparse_int*)info->zero_pivot,
+                       descr->base);
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    RETURN_IF_HIP_ERROR(hipFree(row_pos));
+    RETURN_IF_HIP_ERROR(hipFree(color_count));
+    RETURN_IF_HIP_ERROR(hipFree(keys));
+    RETURN_IF_HIP_ERROR(hipFree(entries));
+
+    // Each color forms a level, whose rows can be processed by a single launch
+    csrmc->nlevels   = ncolors;
+    csrmc->max_width = 0;
+    csrmc->level_ptr.resize(ncolors + 1);
+    csrmc->level_ptr[0] = 0;
+
+    for(rocsparse_int i = 0; i < ncolors; ++i)
+    {
+        csrmc->max_width        = std::max(csrmc->max_width, int64_t(hcolor_count[i]));
+        csrmc->level_ptr[i + 1] = csrmc->level_ptr[i] + hcolor_count[i];
+    }
+
+    // Coloring and reordering do not match, if colors are out of range
+    if(csrmc->level_ptr[ncolors] != m)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrmc_info));
+        info->csrmc_info = nullptr;
+
+        return rocsparse_status_invalid_value;
+    }
+
+    // Some data to verify correct execution
+    csrmc->m           = m;
+    csrmc->nnz         = nnz;
+    csrmc->descr       = descr;
+    csrmc->trm_row_ptr = csr_row_ptr;
+    csrmc->trm_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrmc_clear(rocsparse_handle handle, rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmc_clear", (const void*&)info);
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrmc_info));
+    info->csrmc_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+static rocsparse_status rocsparse_csrmcsor_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    rocsparse_sor_sweep       sweep,
+                                                    U                         omega_device_host,
+                                                    const T*                  b,
+                                                    T*                        x)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_trm_info csrmc = info->csrmc_info;
+
+    // Average nnz per row
+    rocsparse_int nnz_per_row = (nnz - 1) / m + 1;
+
+#define LAUNCH_CSRMCSOR()                                    \
+    LAUNCH_CSRMC_COLOR(csrmcsor,                             \
+                       (const rocsparse_int*)csrmc->row_map, \
+                       csr_row_ptr,                          \
+                       csr_col_ind,                          \
+                       csr_val,                              \
+                       omega_device_host,                    \
+                       b,                                    \
+                       x,                                    \
+                       (rocsparse_int*)info->zero_pivot,     \
+                       descr->base)
+
+    // Forward sweep, one launch per color
+    if(sweep != rocsparse_sor_sweep_backward)
+    {
+        for(int64_t color = 0; color < csrmc->nlevels; ++color)
+        {
+            LAUNCH_CSRMCSOR();
+        }
+    }
+
+    // Backward sweep, one launch per color
+    if(sweep != rocsparse_sor_sweep_forward)
+    {
+        for(int64_t color = csrmc->nlevels - 1; color >= 0; --color)
+        {
+            LAUNCH_CSRMCSOR();
+        }
+    }
+
+#undef LAUNCH_CSRMCSOR
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmcsor_template(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const T*                  csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_sor_sweep       sweep,
+                                             const T*                  omega,
+                                             const T*                  b,
+                                             T*                        x)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmcsor"),
+                  m,
+                  nnz,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  sweep,
+                  LOG_TRACE_SCALAR_VALUE(handle, omega),
+                  (const void*&)b,
+                  (const void*&)x);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmcsor"),
+                  m,
+                  nnz,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  sweep,
+                  (const void*&)omega,
+                  (const void*&)b,
+                  (const void*&)x);
+    }
+
+    log_bench(handle, "./rocsparse-bench -f csrmcsor -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check sweep
+    if(rocsparse_enum_utils::is_invalid(sweep))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || omega == nullptr || b == nullptr || x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrmc_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Differentiate between the pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmcsor_dispatch(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, sweep, omega, b, x);
+    }
+    else
+    {
+        return rocsparse_csrmcsor_dispatch(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, sweep, *omega, b, x);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmcilu0_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              T*                        csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmcilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info);
+
+    log_bench(handle, "./rocsparse-bench -f csrmcilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrmc_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_trm_info csrmc = info->csrmc_info;
+
+    // Average nnz per row
+    rocsparse_int nnz_per_row = (nnz - 1) / m + 1;
+
+    // Factorize the colors in ascending order, one launch per color
+    for(int64_t color = 0; color < csrmc->nlevels; ++color)
+    {
+        LAUNCH_CSRMC_COLOR(csrmcilu0,
+                           (const rocsparse_int*)csrmc->row_map,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           (const rocsparse_int*)csrmc->entry_map,
+                           (const rocsparse_int*)csrmc->trm_diag_ind,
+                           (rocsparse_int*)info->zero_pivot,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+
+template <typename T>
+rocsparse_status rocsparse_csrmcilu0_solve_template(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             nnz,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    const T*                  x,
+                                                    T*                        y)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrmcilu0_solve"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)x,
+              (const void*&)y);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrmc_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_trm_info csrmc = info->csrmc_info;
+
+    // Average nnz per row
+    rocsparse_int nnz_per_row = (nnz - 1) / m + 1;
+
+#define LAUNCH_CSRMCILU0_SOLVE(fill_mode)                         \
+    LAUNCH_CSRMC_COLOR(csrmcilu0_solve,                           \
+                       (const rocsparse_int*)csrmc->row_map,      \
+                       csr_row_ptr,                               \
+                       csr_col_ind,                               \
+                       csr_val,                                   \
+                       (const rocsparse_int*)csrmc->entry_map,    \
+                       (const rocsparse_int*)csrmc->trm_diag_ind, \
+                       x,                                         \
+                       y,                                         \
+                       (rocsparse_int*)info->zero_pivot,          \
+                       descr->base,                               \
+                       fill_mode)
+
+    // Solve L z = x, where the colors are processed in ascending order
+    for(int64_t color = 0; color < csrmc->nlevels; ++color)
+    {
+        LAUNCH_CSRMCILU0_SOLVE(rocsparse_fill_mode_lower);
+    }
+
+    // Solve U y = z in place, where the colors are processed in descending order
+    for(int64_t color = csrmc->nlevels - 1; color >= 0; --color)
+    {
+        LAUNCH_CSRMCILU0_SOLVE(rocsparse_fill_mode_upper);
+    }
+
+#undef LAUNCH_CSRMCILU0_SOLVE
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_CSRMC_COLOR
+#undef CSRMC_DIM
+
+extern "C" rocsparse_status rocsparse_csrmc_zero_pivot(rocsparse_handle   handle,
+                                                       rocsparse_mat_info info,
+                                                       rocsparse_int*     position)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrmc_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 it can happen, that info structure is not created.
+    // In this case, always return -1.
+    if(info->csrmc_info == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // In graph mode, resolve the zero pivot on the device without synchronizing
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        hipLaunchKernelGGL((zero_pivot_to_position<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           (const rocsparse_int*)info->zero_pivot,
+                           position);
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_sor_sweep       sweep,       \
+                                     const TYPE*               omega,       \
+                                     const TYPE*               b,           \
+                                     TYPE*                     x)           \
+    {                                                                       \
+        return rocsparse_csrmcsor_template(handle,                          \
+                                           m,                               \
+                                           nnz,                             \
+                                           descr,                           \
+                                           csr_val,                         \
+                                           csr_row_ptr,                     \
+                                           csr_col_ind,                     \
+                                           info,                            \
+                                           sweep,                           \
+                                           omega,                           \
+                                           b,                               \
+                                           x);                              \
+    }
+
+C_IMPL(rocsparse_scsrmcsor, float);
+C_IMPL(rocsparse_dcsrmcsor, double);
+C_IMPL(rocsparse_ccsrmcsor, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmcsor, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                   \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,       \
+                                     rocsparse_int             m,            \
+                                     rocsparse_int             nnz,          \
+                                     const rocsparse_mat_descr descr,        \
+                                     TYPE*                     csr_val,      \
+                                     const rocsparse_int*      csr_row_ptr,  \
+                                     const rocsparse_int*      csr_col_ind,  \
+                                     rocsparse_mat_info        info)         \
+    {                                                                        \
+        return rocsparse_csrmcilu0_template(                                 \
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info); \
+    }
+
+C_IMPL(rocsparse_scsrmcilu0, float);
+C_IMPL(rocsparse_dcsrmcilu0, double);
+C_IMPL(rocsparse_ccsrmcilu0, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmcilu0, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                         \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,             \
+                                     rocsparse_int             m,                  \
+                                     rocsparse_int             nnz,                \
+                                     const rocsparse_mat_descr descr,              \
+                                     const TYPE*               csr_val,            \
+                                     const rocsparse_int*      csr_row_ptr,        \
+                                     const rocsparse_int*      csr_col_ind,        \
+                                     rocsparse_mat_info        info,               \
+                                     const TYPE*               x,                  \
+                                     TYPE*                     y)                  \
+    {                                                                              \
+        return rocsparse_csrmcilu0_solve_template(                                 \
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, y); \
+    }
+
+C_IMPL(rocsparse_scsrmcilu0_solve, float);
+C_IMPL(rocsparse_dcsrmcilu0_solve, double);
+C_IMPL(rocsparse_ccsrmcilu0_solve, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrmcilu0_solve, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,552 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "utility.h"
+
+#include "../level2/rocsparse_csrmv.hpp"
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrpoly_scale(rocsparse_int m, T alpha, const T* __restrict__ x, T* __restrict__ y)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    y[row] = alpha * x[row];
+}
+
+// Output vector of step s out of degree steps. The last step writes to y, all other
+// steps alternate between y and the temporary vector, such that step s can overwrite
+// the output of step s - 2 in place.
+template <typename T>
+static inline T* csrpoly_output(rocsparse_int degree, rocsparse_int s, T* y, T* tmp)
+{
+    return ((degree - s) % 2 == 0) ? y : tmp;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrpoly_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrpoly_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_triangular)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Temporary vector to alternate with y
+    *buffer_size = sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrpoly_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int             degree,
+                                            const T*                  coeff,
+                                            const T*                  x,
+                                            T*                        y,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrpoly"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              degree,
+              (const void*&)coeff,
+              (const void*&)x,
+              (const void*&)y,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrpoly -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--sizek",
+              degree);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_triangular)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || degree < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || coeff == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The temporary vector is only required for more than a single SpMV
+    if(degree > 1 && temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Horner scheme, w_{degree} = c_{degree} * x and w_{i} = A * w_{i+1} + c_{i} * x.
+    // Each step is a single fused kernel, multiplying A with the previous w and adding
+    // c_{i} * x in the output stage, such that y = w_0.
+    if(degree == 0)
+    {
+#define CSRPOLY_DIM 256
+        hipLaunchKernelGGL((csrpoly_scale<CSRPOLY_DIM>),
+                           dim3((m - 1) / CSRPOLY_DIM + 1),
+                           dim3(CSRPOLY_DIM),
+                           0,
+                           stream,
+                           m,
+                           coeff[0],
+                           x,
+                           y);
+#undef CSRPOLY_DIM
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_csrmv_info csrmv_info = (info != nullptr) ? info->csrmv_info : nullptr;
+
+    T* tmp = reinterpret_cast<T*>(temp_buffer);
+
+    // First step multiplies A with x directly, w_{degree-1} = c_{degree} * A * x + c_{degree-1} * x
+    const T* v = x;
+
+    for(rocsparse_int s = 1; s <= degree; ++s)
+    {
+        T* w = csrpoly_output(degree, s, y, tmp);
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrmv_poly_step_template(handle,
+                                               m,
+                                               nnz,
+                                               descr,
+                                               csr_val,
+                                               csr_row_ptr,
+                                               csr_col_ind,
+                                               csrmv_info,
+                                               (s == 1) ? coeff[degree] : static_cast<T>(1),
+                                               v,
+                                               static_cast<T>(0),
+                                               coeff[degree - s],
+                                               static_cast<T>(0),
+                                               x,
+                                               w));
+
+        v = w;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrpoly_chebyshev_template(rocsparse_handle          handle,
+                                                      rocsparse_int             m,
+                                                      rocsparse_int             nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const T*                  csr_val,
+                                                      const rocsparse_int*      csr_row_ptr,
+                                                      const rocsparse_int*      csr_col_ind,
+                                                      rocsparse_mat_info        info,
+                                                      rocsparse_int             degree,
+                                                      floating_data_t<T>        lambda_min,
+                                                      floating_data_t<T>        lambda_max,
+                                                      const T*                  x,
+                                                      T*                        y,
+                                                      void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrpoly_chebyshev"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              degree,
+              lambda_min,
+              lambda_max,
+              (const void*&)x,
+              (const void*&)y,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrpoly -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--sizek",
+              degree);
+
+    // Check spectral bounds, the interval must not contain zero
+    if(!(lambda_min > static_cast<floating_data_t<T>>(0)) || !(lambda_max > lambda_min))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general
+       && descr->type != rocsparse_matrix_type_triangular)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0 || degree < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && (csr_val == nullptr || csr_col_ind == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The temporary vector is only required for more than a single SpMV
+    if(degree > 1 && temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Chebyshev iteration for A * z = x, starting with z_0 = 0 and z_1 = x / theta
+    floating_data_t<T> theta = (lambda_max + lambda_min) / 2;
+    floating_data_t<T> delta = (lambda_max - lambda_min) / 2;
+    floating_data_t<T> sigma = theta / delta;
+    floating_data_t<T> rho   = 1 / sigma;
+
+    if(degree == 0)
+    {
+#define CSRPOLY_DIM 256
+        hipLaunchKernelGGL((csrpoly_scale<CSRPOLY_DIM>),
+                           dim3((m - 1) / CSRPOLY_DIM + 1),
+                           dim3(CSRPOLY_DIM),
+                           0,
+                           stream,
+                           m,
+                           static_cast<T>(1 / theta),
+                           x,
+                           y);
+#undef CSRPOLY_DIM
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_csrmv_info csrmv_info = (info != nullptr) ? info->csrmv_info : nullptr;
+
+    T* tmp = reinterpret_cast<T*>(temp_buffer);
+
+    // The update d_k = rho_k * rho_{k-1} * d_{k-1} + 2 * rho_k / delta * (x - A * z_k) and
+    // z_{k+1} = z_k + d_k is written as three-term recurrence
+    //
+    //   z_{k+1} = (1 + rho_k * rho_{k-1}) * z_k - rho_k * rho_{k-1} * z_{k-1}
+    //           + 2 * rho_k / delta * (x - A * z_k)
+    //
+    // such that each step is a single fused kernel that overwrites z_{k-1} in place.
+    // z_1 = x / theta and z_0 = 0 are folded into the first two steps.
+    const T* v = x;
+
+    for(rocsparse_int s = 1; s <= degree; ++s)
+    {
+        floating_data_t<T> rho_new = 1 / (2 * sigma - rho);
+        floating_data_t<T> rr      = rho_new * rho;
+        floating_data_t<T> c       = 2 * rho_new / delta;
+
+        T alpha = static_cast<T>(-c);
+        T beta  = static_cast<T>(-rr);
+        T gamma = static_cast<T>(c);
+        T eta   = static_cast<T>(1 + rr);
+
+        if(s == 1)
+        {
+            // v = x, z_1 = x / theta
+            alpha = static_cast<T>(-c / theta);
+            beta  = static_cast<T>(0);
+            gamma = static_cast<T>((1 + rr) / theta + c);
+            eta   = static_cast<T>(0);
+        }
+        else if(s == 2)
+        {
+            // z_1 = x / theta is folded into the x term
+            beta  = static_cast<T>(0);
+            gamma = static_cast<T>(c - rr / theta);
+        }
+
+        T* z = csrpoly_output(degree, s, y, tmp);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_poly_step_template(handle,
+                                                                      m,
+                                                                      nnz,
+                                                                      descr,
+                                                                      csr_val,
+                                                                      csr_row_ptr,
+                                                                      csr_col_ind,
+                                                                      csrmv_info,
+                                                                      alpha,
+                                                                      v,
+                                                                      beta,
+                                                                      gamma,
+                                                                      eta,
+                                                                      x,
+                                                                      z));
+
+        v   = z;
+        rho = rho_new;
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                          \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,              \
+                                     rocsparse_int             m,                   \
+                                     rocsparse_int             nnz,                 \
+                                     const rocsparse_mat_descr descr,               \
+                                     const TYPE*               csr_val,             \
+                                     const rocsparse_int*      csr_row_ptr,         \
+                                     const rocsparse_int*      csr_col_ind,         \
+                                     size_t*                   buffer_size)         \
+    {                                                                               \
+        return rocsparse_csrpoly_buffer_size_template(                              \
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size); \
+    }
+
+C_IMPL(rocsparse_scsrpoly_buffer_size, float);
+C_IMPL(rocsparse_dcsrpoly_buffer_size, double);
+C_IMPL(rocsparse_ccsrpoly_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrpoly_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_int             degree,      \
+                                     const TYPE*               coeff,       \
+                                     const TYPE*               x,           \
+                                     TYPE*                     y,           \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrpoly_template(handle,                           \
+                                          m,                                \
+                                          nnz,                              \
+                                          descr,                            \
+                                          csr_val,                          \
+                                          csr_row_ptr,                      \
+                                          csr_col_ind,                      \
+                                          info,                             \
+                                          degree,                           \
+                                          coeff,                            \
+                                          x,                                \
+                                          y,                                \
+                                          temp_buffer);                     \
+    }
+
+C_IMPL(rocsparse_scsrpoly, float);
+C_IMPL(rocsparse_dcsrpoly, double);
+C_IMPL(rocsparse_ccsrpoly, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrpoly, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, REAL)                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_int             degree,      \
+                                     REAL                      lambda_min,  \
+                                     REAL                      lambda_max,  \
+                                     const TYPE*               x,           \
+                                     TYPE*                     y,           \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrpoly_chebyshev_template(handle,                 \
+                                                    m,                      \
+                                                    nnz,                    \
+                                                    descr,                  \
+                                                    csr_val,                \
+                                                    csr_row_ptr,            \
+                                                    csr_col_ind,            \
+                                                    info,                   \
+                                                    degree,                 \
+                                                    lambda_min,             \
+                                                    lambda_max,             \
+                                                    x,                      \
+                                                    y,                      \
+                                                    temp_buffer);           \
+    }
+
+C_IMPL(rocsparse_scsrpoly_chebyshev, float, float);
+C_IMPL(rocsparse_dcsrpoly_chebyshev, double, double);
+C_IMPL(rocsparse_ccsrpoly_chebyshev, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrpoly_chebyshev, rocsparse_double_complex, double);
+
+#undef C_IMPL
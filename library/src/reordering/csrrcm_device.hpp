@@ -0,0 +1,347 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#include "common.h"
+
+//
+// Vertices that have not been numbered yet carry the parent label m.
+// Numbered vertices carry the label of their parent in the BFS, which
+// is always smaller than their own label.
+//
+
+template <unsigned int BLOCKSIZE, typename I = rocsparse_int, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_init_kernel(J m,
+                            const I* __restrict__ csr_row_ptr,
+                            const J* __restrict__ csr_col_ind,
+                            rocsparse_index_base csr_base,
+                            J* __restrict__ degree,
+                            J* __restrict__ parent,
+                            J* __restrict__ mark,
+                            J* __restrict__ vertices)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    //
+    // Degree of the vertex, self loops are not counted
+    //
+    J       deg   = 0;
+    const I bound = csr_row_ptr[row + 1] - csr_base;
+    for(I j = csr_row_ptr[row] - csr_base; j < bound; ++j)
+    {
+        if(csr_col_ind[j] - csr_base != row)
+        {
+            ++deg;
+        }
+    }
+
+    degree[row]   = deg;
+    parent[row]   = m;
+    mark[row]     = -1;
+    vertices[row] = row;
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_gather_kernel(J size,
+                              const J* __restrict__ src,
+                              const J* __restrict__ ind,
+                              J* __restrict__ dst)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < size)
+    {
+        dst[gid] = src[ind[gid]];
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_isolated_kernel(J m,
+                                const J* __restrict__ degree,
+                                const J* __restrict__ sorted,
+                                J* __restrict__ parent,
+                                J* __restrict__ perm,
+                                J* __restrict__ workspace)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    //
+    // Vertices are sorted by degree, such that isolated vertices come first
+    // and are numbered in order
+    //
+    J vertex = sorted[gid];
+
+    if(degree[vertex] == 0)
+    {
+        parent[vertex] = gid;
+        perm[gid]      = vertex;
+
+        //
+        // Last isolated vertex stores the number of isolated vertices
+        //
+        if(gid == m - 1 || degree[sorted[gid + 1]] != 0)
+        {
+            workspace[0] = gid + 1;
+        }
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_find_unnumbered_kernel(J m,
+                                       J start,
+                                       const J* __restrict__ sorted,
+                                       const J* __restrict__ parent,
+                                       J* __restrict__ workspace)
+{
+    __shared__ J sdata[BLOCKSIZE];
+
+    //
+    // Search the vertices in order of increasing degree for the first
+    // vertex that has not been numbered yet
+    //
+    for(J i = start; i < m; i += BLOCKSIZE)
+    {
+        J idx = i + hipThreadIdx_x;
+
+        sdata[hipThreadIdx_x] = (idx < m && parent[sorted[idx]] == m) ? idx : m;
+
+        __syncthreads();
+        rocsparse_blockreduce_min<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+        J first = sdata[0];
+
+        if(first < m)
+        {
+            if(hipThreadIdx_x == 0)
+            {
+                workspace[0] = first;
+                workspace[1] = sorted[first];
+            }
+
+            return;
+        }
+
+        __syncthreads();
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_min_degree_kernel(J lo,
+                                  J hi,
+                                  const J* __restrict__ degree,
+                                  const J* __restrict__ level,
+                                  J* __restrict__ workspace)
+{
+    __shared__ J sdata[BLOCKSIZE];
+
+    //
+    // Minimum degree of the level
+    //
+    J mindeg = std::numeric_limits<J>::max();
+    for(J i = lo + hipThreadIdx_x; i < hi; i += BLOCKSIZE)
+    {
+        mindeg = min(mindeg, degree[level[i]]);
+    }
+
+    sdata[hipThreadIdx_x] = mindeg;
+
+    __syncthreads();
+    rocsparse_blockreduce_min<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+    mindeg = sdata[0];
+
+    __syncthreads();
+
+    //
+    // Smallest vertex of minimum degree, ties are broken by vertex index
+    //
+    J vertex = std::numeric_limits<J>::max();
+    for(J i = lo + hipThreadIdx_x; i < hi; i += BLOCKSIZE)
+    {
+        J v = level[i];
+        if(degree[v] == mindeg)
+        {
+            vertex = min(vertex, v);
+        }
+    }
+
+    sdata[hipThreadIdx_x] = vertex;
+
+    __syncthreads();
+    rocsparse_blockreduce_min<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        workspace[1] = sdata[0];
+    }
+}
+
+template <typename J = rocsparse_int>
+ROCSPARSE_KERNEL void csrrcm_root_kernel(
+    J root, J pos, J stamp, J* __restrict__ parent, J* __restrict__ mark, J* __restrict__ perm)
+{
+    perm[pos]  = root;
+    mark[root] = stamp;
+
+    //
+    // Root of the Cuthill-McKee traversal is numbered, roots of the
+    // pseudo-peripheral node search are only marked
+    //
+    if(parent != nullptr)
+    {
+        parent[root] = pos;
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I = rocsparse_int, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_bfs_level_kernel(J lo,
+                                 J hi,
+                                 J m,
+                                 J stamp,
+                                 const I* __restrict__ csr_row_ptr,
+                                 const J* __restrict__ csr_col_ind,
+                                 rocsparse_index_base csr_base,
+                                 const J* __restrict__ parent,
+                                 J* __restrict__ mark,
+                                 J* __restrict__ queue,
+                                 J* __restrict__ workspace)
+{
+    J gid = lo + hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= hi)
+    {
+        return;
+    }
+
+    //
+    // Each thread expands one vertex of the current level
+    //
+    J       row   = queue[gid];
+    const I bound = csr_row_ptr[row + 1] - csr_base;
+    for(I j = csr_row_ptr[row] - csr_base; j < bound; ++j)
+    {
+        J col = csr_col_ind[j] - csr_base;
+
+        //
+        // Skip visited neighbors
+        //
+        if(mark[col] == stamp)
+        {
+            continue;
+        }
+
+        //
+        // Skip neighbors that have already been numbered, this can only
+        // happen for non-symmetric patterns
+        //
+        if(parent[col] != m)
+        {
+            continue;
+        }
+
+        //
+        // The first thread to mark the neighbor appends it to the next level
+        //
+        if(atomicExch(&mark[col], stamp) != stamp)
+        {
+            queue[hi + atomicAdd(&workspace[0], 1)] = col;
+        }
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename I = rocsparse_int, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL
+    void csrrcm_cm_level_kernel(J lo,
+                                J hi,
+                                J m,
+                                const I* __restrict__ csr_row_ptr,
+                                const J* __restrict__ csr_col_ind,
+                                rocsparse_index_base csr_base,
+                                J* __restrict__ parent,
+                                J* __restrict__ perm,
+                                J* __restrict__ workspace)
+{
+    J label = lo + hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(label >= hi)
+    {
+        return;
+    }
+
+    //
+    // Each thread expands one vertex of the current level
+    //
+    J       row   = perm[label];
+    const I bound = csr_row_ptr[row + 1] - csr_base;
+    for(I j = csr_row_ptr[row] - csr_base; j < bound; ++j)
+    {
+        J col = csr_col_ind[j] - csr_base;
+
+        //
+        // Numbered vertices always have a parent label smaller than the
+        // current one. Unnumbered neighbors keep the smallest label of all
+        // their parents, as in the sequential Cuthill-McKee ordering.
+        //
+        if(parent[col] > label)
+        {
+            //
+            // The first thread to reach the neighbor appends it to the next level
+            //
+            if(atomicMin(&parent[col], label) == m)
+            {
+                perm[hi + atomicAdd(&workspace[0], 1)] = col;
+            }
+        }
+    }
+}
+
+template <unsigned int BLOCKSIZE, typename J = rocsparse_int>
+__launch_bounds__(BLOCKSIZE) ROCSPARSE_KERNEL void csrrcm_reverse_kernel(J m, J* __restrict__ perm)
+{
+    J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m / 2)
+    {
+        return;
+    }
+
+    J tmp             = perm[gid];
+    perm[gid]         = perm[m - 1 - gid];
+    perm[m - 1 - gid] = tmp;
+}
@@ -0,0 +1,627 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "csrrcm_device.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+#define CSRRCM_DIM 256
+
+// Number of vertices appended to the next level, stored in workspace[0]
+static rocsparse_status rocsparse_csrrcm_level_size(hipStream_t    stream,
+                                                    rocsparse_int* workspace,
+                                                    rocsparse_int* size)
+{
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(size, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+// Breadth first search from root, storing the levels consecutively in queue,
+// starting at position pos. Returns the range of the last level and the
+// height of the level structure.
+static rocsparse_status rocsparse_csrrcm_bfs(rocsparse_handle     handle,
+                                             rocsparse_int        m,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_index_base base,
+                                             rocsparse_int        root,
+                                             rocsparse_int        pos,
+                                             rocsparse_int        stamp,
+                                             const rocsparse_int* parent,
+                                             rocsparse_int*       mark,
+                                             rocsparse_int*       queue,
+                                             rocsparse_int*       workspace,
+                                             rocsparse_int*       last_lo,
+                                             rocsparse_int*       last_hi,
+                                             rocsparse_int*       height)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    hipLaunchKernelGGL((csrrcm_root_kernel<rocsparse_int>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       root,
+                       pos,
+                       stamp,
+                       (rocsparse_int*)nullptr,
+                       mark,
+                       queue);
+
+    rocsparse_int lo = pos;
+    rocsparse_int hi = pos + 1;
+
+    *height = 0;
+
+    while(true)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(workspace, 0, sizeof(rocsparse_int), stream));
+
+        hipLaunchKernelGGL((csrrcm_bfs_level_kernel<CSRRCM_DIM>),
+                           dim3((hi - lo - 1) / CSRRCM_DIM + 1),
+                           dim3(CSRRCM_DIM),
+                           0,
+                           stream,
+                           lo,
+                           hi,
+                           m,
+                           stamp,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           base,
+                           parent,
+                           mark,
+                           queue,
+                           workspace);
+
+        rocsparse_int size;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_level_size(stream, workspace, &size));
+
+        if(size == 0)
+        {
+            break;
+        }
+
+        lo = hi;
+        hi += size;
+
+        ++(*height);
+    }
+
+    *last_lo = lo;
+    *last_hi = hi;
+
+    return rocsparse_status_success;
+}
+
+// Sort the vertices of a level by the label of their parent, then by degree and
+// then by vertex index, using stable radix sorts from the least significant key
+static rocsparse_status rocsparse_csrrcm_sort_level(rocsparse_handle     handle,
+                                                    rocsparse_int        size,
+                                                    unsigned int         endbit,
+                                                    const rocsparse_int* degree,
+                                                    const rocsparse_int* parent,
+                                                    rocsparse_int*       level,
+                                                    rocsparse_int*       tmp_key,
+                                                    rocsparse_int*       tmp_key_alt,
+                                                    rocsparse_int*       tmp_val,
+                                                    void*                tmp_rocprim,
+                                                    size_t               rocprim_size)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 csrrcm_blocks((size - 1) / CSRRCM_DIM + 1);
+    dim3 csrrcm_threads(CSRRCM_DIM);
+
+    rocprim::double_buffer<rocsparse_int> keys(tmp_key, tmp_key_alt);
+    rocprim::double_buffer<rocsparse_int> vals(level, tmp_val);
+
+    // Vertex index
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_keys(tmp_rocprim, rocprim_size, vals, size, 0, endbit, stream));
+
+    // Degree
+    hipLaunchKernelGGL((csrrcm_gather_kernel<CSRRCM_DIM>),
+                       csrrcm_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       size,
+                       degree,
+                       vals.current(),
+                       keys.current());
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(tmp_rocprim, rocprim_size, keys, vals, size, 0, endbit, stream));
+
+    // Parent label
+    hipLaunchKernelGGL((csrrcm_gather_kernel<CSRRCM_DIM>),
+                       csrrcm_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       size,
+                       parent,
+                       vals.current(),
+                       keys.current());
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(tmp_rocprim, rocprim_size, keys, vals, size, 0, endbit, stream));
+
+    if(vals.current() != level)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(level,
+                                           vals.current(),
+                                           sizeof(rocsparse_int) * size,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm_buffer_size(rocsparse_handle     handle,
+                                                         rocsparse_int        m,
+                                                         rocsparse_int        nnz,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         size_t*              buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm_buffer_size",
+              m,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    unsigned int endbit = rocsparse_clz(m);
+    size_t       keys_size;
+    size_t       pairs_size;
+
+    rocsparse_int*                        ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_keys(nullptr, keys_size, dummy, m, 0, endbit, stream));
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, pairs_size, dummy, dummy, m, 0, endbit, stream));
+
+    *buffer_size = ((std::max(keys_size, pairs_size) - 1) / 256 + 1) * 256;
+
+    // degree, parent, mark and sorted vertices buffers
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 4;
+    // key, alternate key and value buffers for sorting
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 3;
+    // workspace
+    *buffer_size += sizeof(rocsparse_int) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int*            perm,
+                                             void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrrcm", "--mtx <matrix.mtx>");
+
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0 || nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr || perm == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz != 0 && csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The breadth first search reads the frontier size back to the host after each
+    // level. This cannot be captured in graph mode
+    if(handle->graph_mode == rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_index_base base   = descr->base;
+    unsigned int         endbit = rocsparse_clz(m);
+
+    // rocprim buffer size
+    size_t keys_size;
+    size_t pairs_size;
+
+    {
+        rocprim::double_buffer<rocsparse_int> dummy(perm, perm);
+
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_keys(nullptr, keys_size, dummy, m, 0, endbit, stream));
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(nullptr, pairs_size, dummy, dummy, m, 0, endbit, stream));
+    }
+
+    size_t rocprim_size = std::max(keys_size, pairs_size);
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // rocprim buffer
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+    ptr += ((rocprim_size - 1) / 256 + 1) * 256;
+
+    // degree buffer
+    rocsparse_int* degree = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // parent buffer
+    rocsparse_int* parent = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // mark buffer
+    rocsparse_int* mark = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // vertices sorted by degree buffer
+    rocsparse_int* sorted = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // sort buffers
+    rocsparse_int* tmp_key = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* tmp_key_alt = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* tmp_val = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // workspace
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(ptr);
+
+    dim3 csrrcm_blocks((m - 1) / CSRRCM_DIM + 1);
+    dim3 csrrcm_threads(CSRRCM_DIM);
+
+    // Compute vertex degrees and initialize all vertices as not numbered
+    hipLaunchKernelGGL((csrrcm_init_kernel<CSRRCM_DIM>),
+                       csrrcm_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       base,
+                       degree,
+                       parent,
+                       mark,
+                       sorted);
+
+    // Sort vertices by degree, ties are kept in order of the vertex index
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            tmp_key, degree, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+
+        rocprim::double_buffer<rocsparse_int> keys(tmp_key, tmp_key_alt);
+        rocprim::double_buffer<rocsparse_int> vals(sorted, tmp_val);
+
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(tmp_rocprim, rocprim_size, keys, vals, m, 0, endbit, stream));
+
+        if(vals.current() != sorted)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(sorted,
+                                               vals.current(),
+                                               sizeof(rocsparse_int) * m,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+    }
+
+    // Isolated vertices are numbered first
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(workspace, 0, sizeof(rocsparse_int), stream));
+
+    hipLaunchKernelGGL((csrrcm_isolated_kernel<CSRRCM_DIM>),
+                       csrrcm_blocks,
+                       csrrcm_threads,
+                       0,
+                       stream,
+                       m,
+                       degree,
+                       sorted,
+                       parent,
+                       perm,
+                       workspace);
+
+    // Number of vertices that have been numbered
+    rocsparse_int pos;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_level_size(stream, workspace, &pos));
+
+    // Position in the list of vertices sorted by degree to start the search
+    // for the root of the next connected component
+    rocsparse_int start = pos;
+
+    // Stamp of the current breadth first search
+    rocsparse_int stamp = 0;
+
+    // Number all remaining connected components
+    while(pos < m)
+    {
+        // Root candidate is the unnumbered vertex of minimum degree
+        hipLaunchKernelGGL((csrrcm_find_unnumbered_kernel<CSRRCM_DIM>),
+                           dim3(1),
+                           dim3(CSRRCM_DIM),
+                           0,
+                           stream,
+                           m,
+                           start,
+                           sorted,
+                           parent,
+                           workspace);
+
+        rocsparse_int first[2];
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            first, workspace, sizeof(rocsparse_int) * 2, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        start              = first[0];
+        rocsparse_int root = first[1];
+
+        // Pseudo-peripheral node search (George and Liu), the level structure
+        // is stored in the yet unused part of perm
+        rocsparse_int lo;
+        rocsparse_int hi;
+        rocsparse_int height;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_bfs(handle,
+                                                       m,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       base,
+                                                       root,
+                                                       pos,
+                                                       stamp++,
+                                                       parent,
+                                                       mark,
+                                                       perm,
+                                                       workspace,
+                                                       &lo,
+                                                       &hi,
+                                                       &height));
+
+        while(height > 0)
+        {
+            // Candidate is the vertex of minimum degree of the last level
+            hipLaunchKernelGGL((csrrcm_min_degree_kernel<CSRRCM_DIM>),
+                               dim3(1),
+                               dim3(CSRRCM_DIM),
+                               0,
+                               stream,
+                               lo,
+                               hi,
+                               degree,
+                               perm,
+                               workspace);
+
+            rocsparse_int candidate;
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &candidate, workspace + 1, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            rocsparse_int candidate_lo;
+            rocsparse_int candidate_hi;
+            rocsparse_int candidate_height;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_bfs(handle,
+                                                           m,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           base,
+                                                           candidate,
+                                                           pos,
+                                                           stamp++,
+                                                           parent,
+                                                           mark,
+                                                           perm,
+                                                           workspace,
+                                                           &candidate_lo,
+                                                           &candidate_hi,
+                                                           &candidate_height));
+
+            // Stop, if the eccentricity does not increase anymore
+            if(candidate_height <= height)
+            {
+                break;
+            }
+
+            root   = candidate;
+            lo     = candidate_lo;
+            hi     = candidate_hi;
+            height = candidate_height;
+        }
+
+        // Cuthill-McKee numbering of the connected component, level by level
+        hipLaunchKernelGGL((csrrcm_root_kernel<rocsparse_int>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           stream,
+                           root,
+                           pos,
+                           stamp,
+                           parent,
+                           mark,
+                           perm);
+
+        lo = pos;
+        hi = pos + 1;
+
+        while(lo < hi)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(workspace, 0, sizeof(rocsparse_int), stream));
+
+            hipLaunchKernelGGL((csrrcm_cm_level_kernel<CSRRCM_DIM>),
+                               dim3((hi - lo - 1) / CSRRCM_DIM + 1),
+                               dim3(CSRRCM_DIM),
+                               0,
+                               stream,
+                               lo,
+                               hi,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               base,
+                               parent,
+                               perm,
+                               workspace);
+
+            rocsparse_int size;
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_level_size(stream, workspace, &size));
+
+            // Order the next level as the sequential algorithm would do
+            if(size > 1)
+            {
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_sort_level(handle,
+                                                                      size,
+                                                                      endbit,
+                                                                      degree,
+                                                                      parent,
+                                                                      perm + hi,
+                                                                      tmp_key,
+                                                                      tmp_key_alt,
+                                                                      tmp_val,
+                                                                      tmp_rocprim,
+                                                                      rocprim_size));
+            }
+
+            lo = hi;
+            hi += size;
+        }
+
+        pos = hi;
+    }
+
+    // Reverse the Cuthill-McKee ordering
+    hipLaunchKernelGGL((csrrcm_reverse_kernel<CSRRCM_DIM>),
+                       dim3((m / 2) / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       m,
+                       perm);
+
+    return rocsparse_status_success;
+}
+
+#undef CSRRCM_DIM
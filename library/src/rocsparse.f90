@@ -93,6 +93,48 @@ module rocsparse
             integer(c_int) :: pointer_mode
         end function rocsparse_get_pointer_mode
 
+!       rocsparse_deterministic_mode
+        function rocsparse_set_deterministic_mode(handle, deterministic_mode) &
+                bind(c, name = 'rocsparse_set_deterministic_mode')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_deterministic_mode
+            type(c_ptr), value :: handle
+            integer(c_int), value :: deterministic_mode
+        end function rocsparse_set_deterministic_mode
+
+        function rocsparse_get_deterministic_mode(handle, deterministic_mode) &
+                bind(c, name = 'rocsparse_get_deterministic_mode')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_deterministic_mode
+            type(c_ptr), value :: handle
+            integer(c_int) :: deterministic_mode
+        end function rocsparse_get_deterministic_mode
+
+!       rocsparse_graph_mode
+        function rocsparse_set_graph_mode(handle, graph_mode) &
+                bind(c, name = 'rocsparse_set_graph_mode')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_graph_mode
+            type(c_ptr), value :: handle
+            integer(c_int), value :: graph_mode
+        end function rocsparse_set_graph_mode
+
+        function rocsparse_get_graph_mode(handle, graph_mode) &
+                bind(c, name = 'rocsparse_get_graph_mode')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_graph_mode
+            type(c_ptr), value :: handle
+            integer(c_int) :: graph_mode
+        end function rocsparse_get_graph_mode
+
 !       rocsparse_version
         function rocsparse_get_version(handle, version) &
                 bind(c, name = 'rocsparse_get_version')
@@ -242,6 +284,17 @@ module rocsparse
             type(c_ptr), value :: hyb
         end function rocsparse_destroy_hyb_mat
 
+        function rocsparse_get_hyb_mat_partition(hyb, ell_width, predicted_cost) &
+                bind(c, name = 'rocsparse_get_hyb_mat_partition')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_hyb_mat_partition
+            type(c_ptr), intent(in), value :: hyb
+            integer(c_int) :: ell_width
+            integer(c_int64_t) :: predicted_cost
+        end function rocsparse_get_hyb_mat_partition
+
 !       rocsparse_mat_info
         function rocsparse_create_mat_info(info) &
                 bind(c, name = 'rocsparse_create_mat_info')
@@ -261,6 +314,52 @@ module rocsparse
             type(c_ptr), value :: info
         end function rocsparse_destroy_mat_info
 
+!       rocsparse_spmat_strided_batch
+        function rocsparse_spmat_get_strided_batch(descr, batch_count, batch_stride) &
+                bind(c, name = 'rocsparse_spmat_get_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_spmat_get_strided_batch
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int) :: batch_count
+            integer(c_int64_t) :: batch_stride
+        end function rocsparse_spmat_get_strided_batch
+
+        function rocsparse_spmat_set_strided_batch(descr, batch_count, batch_stride) &
+                bind(c, name = 'rocsparse_spmat_set_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_spmat_set_strided_batch
+            type(c_ptr), value :: descr
+            integer(c_int), value :: batch_count
+            integer(c_int64_t), value :: batch_stride
+        end function rocsparse_spmat_set_strided_batch
+
+!       rocsparse_dnmat_strided_batch
+        function rocsparse_dnmat_get_strided_batch(descr, batch_count, batch_stride) &
+                bind(c, name = 'rocsparse_dnmat_get_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dnmat_get_strided_batch
+            type(c_ptr), intent(in), value :: descr
+            integer(c_int) :: batch_count
+            integer(c_int64_t) :: batch_stride
+        end function rocsparse_dnmat_get_strided_batch
+
+        function rocsparse_dnmat_set_strided_batch(descr, batch_count, batch_stride) &
+                bind(c, name = 'rocsparse_dnmat_set_strided_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dnmat_set_strided_batch
+            type(c_ptr), value :: descr
+            integer(c_int), value :: batch_count
+            integer(c_int64_t), value :: batch_stride
+        end function rocsparse_dnmat_set_strided_batch
+
 ! ===========================================================================
 !   level 1 SPARSE
 ! ===========================================================================
@@ -1490,6 +1589,23 @@ module rocsparse
             type(c_ptr), value :: info
         end function rocsparse_csrsv_clear
 
+!       rocsparse_csrsv_level_info
+        function rocsparse_csrsv_level_info(handle, trans, descr, info, nlevels, &
+                max_width, critical_path) &
+                bind(c, name = 'rocsparse_csrsv_level_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_level_info
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: info
+            integer(c_int64_t) :: nlevels
+            integer(c_int64_t) :: max_width
+            integer(c_int64_t) :: critical_path
+        end function rocsparse_csrsv_level_info
+
 !       rocsparse_csrsv_solve
         function rocsparse_scsrsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
@@ -1583,6 +1699,180 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zcsrsv_solve
 
+!       rocsparse_csritsv_buffer_size
+        function rocsparse_scsritsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsritsv_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsritsv_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsritsv_buffer_size
+
+        function rocsparse_dcsritsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsritsv_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsritsv_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsritsv_buffer_size
+
+        function rocsparse_ccsritsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsritsv_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsritsv_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsritsv_buffer_size
+
+        function rocsparse_zcsritsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsritsv_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsritsv_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsritsv_buffer_size
+
+!       rocsparse_csritsv_solve
+        function rocsparse_scsritsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, sweeps, tol, temp_buffer) &
+                bind(c, name = 'rocsparse_scsritsv_solve')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsritsv_solve
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: sweeps
+            type(c_ptr), intent(in), value :: tol
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsritsv_solve
+
+        function rocsparse_dcsritsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, sweeps, tol, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsritsv_solve')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsritsv_solve
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: sweeps
+            type(c_ptr), intent(in), value :: tol
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsritsv_solve
+
+        function rocsparse_ccsritsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, sweeps, tol, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsritsv_solve')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsritsv_solve
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: sweeps
+            type(c_ptr), intent(in), value :: tol
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsritsv_solve
+
+        function rocsparse_zcsritsv_solve(handle, trans, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, sweeps, tol, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsritsv_solve')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsritsv_solve
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: sweeps
+            type(c_ptr), intent(in), value :: tol
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsritsv_solve
+
 !       rocsparse_ellmv
         function rocsparse_sellmv(handle, trans, m, n, alpha, descr, ell_val, &
                 ell_col_ind, ell_width, x, beta, y) &
@@ -2985,586 +3275,3334 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zcsrgemm
 
-! ===========================================================================
-!   preconditioner SPARSE
-! ===========================================================================
-
-!       rocsparse_bsric0_zero_pivot
-        function rocsparse_bsric0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_bsric0_zero_pivot')
+!       rocsparse_csrgemm_masked_buffer_size
+        function rocsparse_scsrgemm_masked_buffer_size(handle, trans_A, trans_B, mask, &
+                alg, m, n, k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, &
+                csr_col_ind_M, buffer_size) &
+                bind(c, name = 'rocsparse_scsrgemm_masked_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_masked_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_bsric0_zero_pivot
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrgemm_masked_buffer_size
 
-!       rocsparse_bsric0_buffer_size
-        function rocsparse_sbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_sbsric0_buffer_size')
+        function rocsparse_dcsrgemm_masked_buffer_size(handle, trans_A, trans_B, mask, &
+                alg, m, n, k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, &
+                csr_col_ind_M, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrgemm_masked_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_masked_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
             type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsric0_buffer_size
+        end function rocsparse_dcsrgemm_masked_buffer_size
 
-        function rocsparse_dbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_dbsric0_buffer_size')
+        function rocsparse_ccsrgemm_masked_buffer_size(handle, trans_A, trans_B, mask, &
+                alg, m, n, k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, &
+                csr_col_ind_M, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrgemm_masked_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_masked_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsric0_buffer_size
-
-        function rocsparse_cbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_cbsric0_buffer_size')
-            use rocsparse_enums
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrgemm_masked_buffer_size
+
+        function rocsparse_zcsrgemm_masked_buffer_size(handle, trans_A, trans_B, mask, &
+                alg, m, n, k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, &
+                csr_col_ind_M, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrgemm_masked_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_masked_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrgemm_masked_buffer_size
+
+!       rocsparse_csrgemm_masked_nnz
+        function rocsparse_csrgemm_masked_nnz(handle, trans_A, trans_B, mask, m, n, k, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, &
+                csr_col_ind_M, descr_C, csr_row_ptr_C, nnz_C, temp_buffer) &
+                bind(c, name = 'rocsparse_csrgemm_masked_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_masked_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_masked_nnz
+
+!       rocsparse_csrgemm_masked
+        function rocsparse_scsrgemm_masked(handle, trans_A, trans_B, mask, alg, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, &
+                csr_row_ptr_M, csr_col_ind_M, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm_masked
+
+        function rocsparse_dcsrgemm_masked(handle, trans_A, trans_B, mask, alg, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, &
+                csr_row_ptr_M, csr_col_ind_M, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm_masked
+
+        function rocsparse_ccsrgemm_masked(handle, trans_A, trans_B, mask, alg, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, &
+                csr_row_ptr_M, csr_col_ind_M, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm_masked
+
+        function rocsparse_zcsrgemm_masked(handle, trans_A, trans_B, mask, alg, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, &
+                csr_row_ptr_M, csr_col_ind_M, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mask
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm_masked
+
+!       rocsparse_csrrap_buffer_size
+        function rocsparse_csrrap_buffer_size(handle, m, n, k, descr_R, nnz_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_row_ptr_P, csr_col_ind_P, buffer_size) &
+                bind(c, name = 'rocsparse_csrrap_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrap_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csrrap_buffer_size
+
+!       rocsparse_csrrap_nnz
+        function rocsparse_csrrap_nnz(handle, m, n, k, descr_R, nnz_R, csr_row_ptr_R, &
+                csr_col_ind_R, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_P, &
+                nnz_P, csr_row_ptr_P, csr_col_ind_P, descr_C, csr_row_ptr_C, nnz_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_csrrap_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrap_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrrap_nnz
+
+!       rocsparse_csrrap_symbolic
+        function rocsparse_csrrap_symbolic(handle, m, n, k, descr_R, nnz_R, csr_row_ptr_R, &
+                csr_col_ind_R, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_P, &
+                nnz_P, csr_row_ptr_P, csr_col_ind_P, descr_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_csrrap_symbolic')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrap_symbolic
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_csrrap_symbolic
+
+!       rocsparse_csrrap_numeric
+        function rocsparse_scsrrap_numeric(handle, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_scsrrap_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrrap_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+        end function rocsparse_scsrrap_numeric
+
+        function rocsparse_dcsrrap_numeric(handle, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_dcsrrap_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrrap_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+        end function rocsparse_dcsrrap_numeric
+
+        function rocsparse_ccsrrap_numeric(handle, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_ccsrrap_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrrap_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+        end function rocsparse_ccsrrap_numeric
+
+        function rocsparse_zcsrrap_numeric(handle, m, n, k, descr_R, nnz_R, csr_val_R, &
+                csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_P, nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, &
+                descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_zcsrrap_numeric')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrrap_numeric
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), intent(in), value :: csr_col_ind_C
+        end function rocsparse_zcsrrap_numeric
+
+!       rocsparse_bsrgeam_nnz
+        function rocsparse_bsrgeam_nnz(handle, dir, mb, nb, block_dim, descr_A, nnzb_A, &
+                bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, bsr_row_ptr_B, &
+                bsr_col_ind_B, descr_C, bsr_row_ptr_C, nnzb_C) &
+                bind(c, name = 'rocsparse_bsrgeam_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrgeam_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: nnzb_C
+        end function rocsparse_bsrgeam_nnz
+
+!       rocsparse_bsrgeam
+        function rocsparse_sbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_sbsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_sbsrgeam
+
+        function rocsparse_dbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_dbsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_dbsrgeam
+
+        function rocsparse_cbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_cbsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_cbsrgeam
+
+        function rocsparse_zbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_zbsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_zbsrgeam
+
+!       rocsparse_bsrgemm_nnz
+        function rocsparse_bsrgemm_nnz(handle, dir, mb, nb, kb, block_dim, descr_A, &
+                nnzb_A, bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, bsr_row_ptr_B, &
+                bsr_col_ind_B, descr_C, bsr_row_ptr_C, nnzb_C) &
+                bind(c, name = 'rocsparse_bsrgemm_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrgemm_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: nnzb_C
+        end function rocsparse_bsrgemm_nnz
+
+!       rocsparse_bsrgemm
+        function rocsparse_sbsrgemm(handle, dir, mb, nb, kb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_sbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_sbsrgemm
+
+        function rocsparse_dbsrgemm(handle, dir, mb, nb, kb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_dbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_dbsrgemm
+
+        function rocsparse_cbsrgemm(handle, dir, mb, nb, kb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_cbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_cbsrgemm
+
+        function rocsparse_zbsrgemm(handle, dir, mb, nb, kb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_zbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_zbsrgemm
+
+!       rocsparse_csrgemm_nnz_estimate
+        function rocsparse_scsrgemm_nnz_estimate(handle, trans_A, trans_B, m, n, k, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, sample_size, nnz_C, nnz_C_lower, &
+                nnz_C_upper, group_rows, group_nnz, group_workspace) &
+                bind(c, name = 'rocsparse_scsrgemm_nnz_estimate')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_nnz_estimate
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: nnz_C_lower
+            type(c_ptr), value :: nnz_C_upper
+            type(c_ptr), value :: group_rows
+            type(c_ptr), value :: group_nnz
+            type(c_ptr), value :: group_workspace
+        end function rocsparse_scsrgemm_nnz_estimate
+
+        function rocsparse_dcsrgemm_nnz_estimate(handle, trans_A, trans_B, m, n, k, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, sample_size, nnz_C, nnz_C_lower, &
+                nnz_C_upper, group_rows, group_nnz, group_workspace) &
+                bind(c, name = 'rocsparse_dcsrgemm_nnz_estimate')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_nnz_estimate
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: nnz_C_lower
+            type(c_ptr), value :: nnz_C_upper
+            type(c_ptr), value :: group_rows
+            type(c_ptr), value :: group_nnz
+            type(c_ptr), value :: group_workspace
+        end function rocsparse_dcsrgemm_nnz_estimate
+
+        function rocsparse_ccsrgemm_nnz_estimate(handle, trans_A, trans_B, m, n, k, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, sample_size, nnz_C, nnz_C_lower, &
+                nnz_C_upper, group_rows, group_nnz, group_workspace) &
+                bind(c, name = 'rocsparse_ccsrgemm_nnz_estimate')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_nnz_estimate
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: nnz_C_lower
+            type(c_ptr), value :: nnz_C_upper
+            type(c_ptr), value :: group_rows
+            type(c_ptr), value :: group_nnz
+            type(c_ptr), value :: group_workspace
+        end function rocsparse_ccsrgemm_nnz_estimate
+
+        function rocsparse_zcsrgemm_nnz_estimate(handle, trans_A, trans_B, m, n, k, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, &
+                csr_row_ptr_B, csr_col_ind_B, sample_size, nnz_C, nnz_C_lower, &
+                nnz_C_upper, group_rows, group_nnz, group_workspace) &
+                bind(c, name = 'rocsparse_zcsrgemm_nnz_estimate')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_nnz_estimate
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: nnz_C_lower
+            type(c_ptr), value :: nnz_C_upper
+            type(c_ptr), value :: group_rows
+            type(c_ptr), value :: group_nnz
+            type(c_ptr), value :: group_workspace
+        end function rocsparse_zcsrgemm_nnz_estimate
+
+! ===========================================================================
+!   preconditioner SPARSE
+! ===========================================================================
+
+!       rocsparse_bsric0_zero_pivot
+        function rocsparse_bsric0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsric0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsric0_zero_pivot
+
+!       rocsparse_bsric0_buffer_size
+        function rocsparse_sbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_sbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsric0_buffer_size
+
+        function rocsparse_dbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_dbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsric0_buffer_size
+
+        function rocsparse_cbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_cbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsric0_buffer_size
+
+        function rocsparse_zbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_zbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsric0_buffer_size
+
+!       rocsparse_bsric0_analysis
+        function rocsparse_sbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsric0_analysis
+
+        function rocsparse_dbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsric0_analysis
+
+        function rocsparse_cbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsric0_analysis
+
+        function rocsparse_zbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsric0_analysis
+
+!       rocsparse_bsric0_clear
+        function rocsparse_bsric0_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsric0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsric0_clear
+
+!       rocsparse_bsric0
+        function rocsparse_sbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsric0
+
+        function rocsparse_dbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsric0
+
+        function rocsparse_cbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsric0
+
+        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsric0
+
+!       rocsparse_bsrilu0_zero_pivot
+        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrilu0_zero_pivot
+
+!       rocsparse_bsrilu0_buffer_size
+        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsrilu0_buffer_size
+
+        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsrilu0_buffer_size
+
+        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsrilu0_buffer_size
+
+        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsrilu0_buffer_size
+
+!       rocsparse_bsrilu0_analysis
+        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0_analysis
+
+        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0_analysis
+
+        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0_analysis
+
+        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0_analysis
+
+!       rocsparse_bsrilu0_clear
+        function rocsparse_bsrilu0_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsrilu0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsrilu0_clear
+
+!       rocsparse_bsrilu0
+        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0
+
+        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0
+
+        function rocsparse_cbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0
+
+        function rocsparse_zbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0
+
+!       rocsparse_bsrdiag_inverse_zero_pivot
+        function rocsparse_bsrdiag_inverse_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsrdiag_inverse_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrdiag_inverse_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrdiag_inverse_zero_pivot
+
+!       rocsparse_bsrdiag_inverse
+        function rocsparse_sbsrdiag_inverse(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, alg, inv_val, inv_row_ptr, &
+                inv_col_ind) &
+                bind(c, name = 'rocsparse_sbsrdiag_inverse')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrdiag_inverse
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: alg
+            type(c_ptr), value :: inv_val
+            type(c_ptr), value :: inv_row_ptr
+            type(c_ptr), value :: inv_col_ind
+        end function rocsparse_sbsrdiag_inverse
+
+        function rocsparse_dbsrdiag_inverse(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, alg, inv_val, inv_row_ptr, &
+                inv_col_ind) &
+                bind(c, name = 'rocsparse_dbsrdiag_inverse')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrdiag_inverse
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: alg
+            type(c_ptr), value :: inv_val
+            type(c_ptr), value :: inv_row_ptr
+            type(c_ptr), value :: inv_col_ind
+        end function rocsparse_dbsrdiag_inverse
+
+        function rocsparse_cbsrdiag_inverse(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, alg, inv_val, inv_row_ptr, &
+                inv_col_ind) &
+                bind(c, name = 'rocsparse_cbsrdiag_inverse')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrdiag_inverse
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: alg
+            type(c_ptr), value :: inv_val
+            type(c_ptr), value :: inv_row_ptr
+            type(c_ptr), value :: inv_col_ind
+        end function rocsparse_cbsrdiag_inverse
+
+        function rocsparse_zbsrdiag_inverse(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, alg, inv_val, inv_row_ptr, &
+                inv_col_ind) &
+                bind(c, name = 'rocsparse_zbsrdiag_inverse')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrdiag_inverse
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: alg
+            type(c_ptr), value :: inv_val
+            type(c_ptr), value :: inv_row_ptr
+            type(c_ptr), value :: inv_col_ind
+        end function rocsparse_zbsrdiag_inverse
+
+!       rocsparse_bsrdiag_inverse_apply
+        function rocsparse_sbsrdiag_inverse_apply(handle, dir, mb, alpha, inv_val, &
+                block_dim, x, beta, y) &
+                bind(c, name = 'rocsparse_sbsrdiag_inverse_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrdiag_inverse_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: inv_val
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sbsrdiag_inverse_apply
+
+        function rocsparse_dbsrdiag_inverse_apply(handle, dir, mb, alpha, inv_val, &
+                block_dim, x, beta, y) &
+                bind(c, name = 'rocsparse_dbsrdiag_inverse_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrdiag_inverse_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: inv_val
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dbsrdiag_inverse_apply
+
+        function rocsparse_cbsrdiag_inverse_apply(handle, dir, mb, alpha, inv_val, &
+                block_dim, x, beta, y) &
+                bind(c, name = 'rocsparse_cbsrdiag_inverse_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrdiag_inverse_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: inv_val
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_cbsrdiag_inverse_apply
+
+        function rocsparse_zbsrdiag_inverse_apply(handle, dir, mb, alpha, inv_val, &
+                block_dim, x, beta, y) &
+                bind(c, name = 'rocsparse_zbsrdiag_inverse_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrdiag_inverse_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: inv_val
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zbsrdiag_inverse_apply
+
+!       rocsparse_csric0_zero_pivot
+        function rocsparse_csric0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csric0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csric0_zero_pivot
+
+!       rocsparse_csric0_buffer_size
+        function rocsparse_scsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsric0_buffer_size
+
+        function rocsparse_dcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsric0_buffer_size
+
+        function rocsparse_ccsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsric0_buffer_size
+
+        function rocsparse_zcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsric0_buffer_size
+
+!       rocsparse_csric0_analysis
+        function rocsparse_scsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_scsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsric0_analysis
+
+        function rocsparse_dcsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsric0_analysis
+
+        function rocsparse_ccsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsric0_analysis
+
+        function rocsparse_zcsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsric0_analysis
+
+!       rocsparse_csric0_clear
+        function rocsparse_csric0_clear(handle, info) &
+                bind(c, name = 'rocsparse_csric0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csric0_clear
+
+!       rocsparse_csric0
+        function rocsparse_scsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsric0
+
+        function rocsparse_dcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsric0
+
+        function rocsparse_ccsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsric0
+
+        function rocsparse_zcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsric0
+
+!       rocsparse_csric0_iterative_buffer_size
+        function rocsparse_scsric0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_scsric0_iterative_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_iterative_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsric0_iterative_buffer_size
+
+        function rocsparse_dcsric0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_dcsric0_iterative_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_iterative_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsric0_iterative_buffer_size
+
+        function rocsparse_ccsric0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_ccsric0_iterative_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_iterative_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsric0_iterative_buffer_size
+
+        function rocsparse_zcsric0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_zcsric0_iterative_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_iterative_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsric0_iterative_buffer_size
+
+!       rocsparse_csric0_iterative
+        function rocsparse_scsric0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_scsric0_iterative')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_iterative
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsric0_iterative
+
+        function rocsparse_dcsric0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsric0_iterative')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_iterative
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsric0_iterative
+
+        function rocsparse_ccsric0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsric0_iterative')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_iterative
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsric0_iterative
+
+        function rocsparse_zcsric0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsric0_iterative')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_iterative
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsric0_iterative
+
+!       rocsparse_csrilu0_zero_pivot
+        function rocsparse_csrilu0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrilu0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrilu0_zero_pivot
+
+!       rocsparse_csrilu0_buffer_size
+        function rocsparse_scsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrilu0_buffer_size
+
+        function rocsparse_dcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrilu0_buffer_size
+
+        function rocsparse_ccsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilu0_buffer_size
+
+        function rocsparse_zcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilu0_buffer_size
+
+!       rocsparse_csrilu0_analysis
+        function rocsparse_scsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilu0_analysis
+
+        function rocsparse_dcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilu0_analysis
+
+        function rocsparse_ccsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0_analysis
+
+        function rocsparse_zcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilu0_analysis
+
+!       rocsparse_csrilu0_clear
+        function rocsparse_csrilu0_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrilu0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrilu0_clear
+
+!       rocsparse_csrilu0_level_info
+        function rocsparse_csrilu0_level_info(handle, info, nlevels, max_width, &
+                critical_path) &
+                bind(c, name = 'rocsparse_csrilu0_level_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_level_info
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            integer(c_int64_t) :: nlevels
+            integer(c_int64_t) :: max_width
+            integer(c_int64_t) :: critical_path
+        end function rocsparse_csrilu0_level_info
+
+!       rocsparse_csrilu0
+        function rocsparse_scsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilu0
+
+        function rocsparse_dcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilu0
+
+        function rocsparse_ccsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0
+
+        function rocsparse_zcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilu0
+
+!       rocsparse_csriluk_buffer_size
+        function rocsparse_csriluk_buffer_size(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, lfil, buffer_size) &
+                bind(c, name = 'rocsparse_csriluk_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: lfil
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csriluk_buffer_size
+
+!       rocsparse_csriluk_nnz
+        function rocsparse_csriluk_nnz(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, lfil, descr_LU, csr_row_ptr_LU, nnz_LU, info, temp_buffer) &
+                bind(c, name = 'rocsparse_csriluk_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: lfil
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_row_ptr_LU
+            type(c_ptr), value :: nnz_LU
+            type(c_ptr), value :: info
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csriluk_nnz
+
+!       rocsparse_csriluk_symbolic
+        function rocsparse_csriluk_symbolic(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, lfil, descr_LU, csr_row_ptr_LU, csr_col_ind_LU, info) &
+                bind(c, name = 'rocsparse_csriluk_symbolic')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_symbolic
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: lfil
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), value :: csr_col_ind_LU
+            type(c_ptr), value :: info
+        end function rocsparse_csriluk_symbolic
+
+!       rocsparse_csriluk
+        function rocsparse_scsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_LU, descr_LU, csr_val_LU, csr_row_ptr_LU, &
+                csr_col_ind_LU, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), intent(in), value :: csr_col_ind_LU
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsriluk
+
+        function rocsparse_dcsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_LU, descr_LU, csr_val_LU, csr_row_ptr_LU, &
+                csr_col_ind_LU, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), intent(in), value :: csr_col_ind_LU
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsriluk
+
+        function rocsparse_ccsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_LU, descr_LU, csr_val_LU, csr_row_ptr_LU, &
+                csr_col_ind_LU, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), intent(in), value :: csr_col_ind_LU
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsriluk
+
+        function rocsparse_zcsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_LU, descr_LU, csr_val_LU, csr_row_ptr_LU, &
+                csr_col_ind_LU, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), intent(in), value :: csr_col_ind_LU
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsriluk
+
+!       rocsparse_csrilut_zero_pivot
+        function rocsparse_csrilut_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrilut_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilut_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrilut_zero_pivot
+
+!       rocsparse_csrilut_buffer_size
+        function rocsparse_scsrilut_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_scsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrilut_buffer_size
+
+        function rocsparse_dcsrilut_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrilut_buffer_size
+
+        function rocsparse_ccsrilut_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilut_buffer_size
+
+        function rocsparse_zcsrilut_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilut_buffer_size
+
+!       rocsparse_csrilut_nnz
+        function rocsparse_scsrilut_nnz(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, tol, max_fill, descr_LU, csr_row_ptr_LU, nnz_LU, &
+                info, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilut_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilut_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_row_ptr_LU
+            type(c_ptr), value :: nnz_LU
+            type(c_ptr), value :: info
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilut_nnz
+
+        function rocsparse_dcsrilut_nnz(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, tol, max_fill, descr_LU, csr_row_ptr_LU, nnz_LU, &
+                info, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilut_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilut_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_row_ptr_LU
+            type(c_ptr), value :: nnz_LU
+            type(c_ptr), value :: info
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilut_nnz
+
+        function rocsparse_ccsrilut_nnz(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, tol, max_fill, descr_LU, csr_row_ptr_LU, nnz_LU, &
+                info, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilut_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilut_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_row_ptr_LU
+            type(c_ptr), value :: nnz_LU
+            type(c_ptr), value :: info
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilut_nnz
+
+        function rocsparse_zcsrilut_nnz(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, tol, max_fill, descr_LU, csr_row_ptr_LU, nnz_LU, &
+                info, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilut_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilut_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_row_ptr_LU
+            type(c_ptr), value :: nnz_LU
+            type(c_ptr), value :: info
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilut_nnz
+
+!       rocsparse_csrilut
+        function rocsparse_scsrilut(handle, m, max_fill, nnz_LU, descr_LU, csr_val_LU, &
+                csr_row_ptr_LU, csr_col_ind_LU, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: max_fill
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), value :: csr_col_ind_LU
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilut
+
+        function rocsparse_dcsrilut(handle, m, max_fill, nnz_LU, descr_LU, csr_val_LU, &
+                csr_row_ptr_LU, csr_col_ind_LU, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: max_fill
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), value :: csr_col_ind_LU
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilut
+
+        function rocsparse_ccsrilut(handle, m, max_fill, nnz_LU, descr_LU, csr_val_LU, &
+                csr_row_ptr_LU, csr_col_ind_LU, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: max_fill
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), value :: csr_col_ind_LU
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilut
+
+        function rocsparse_zcsrilut(handle, m, max_fill, nnz_LU, descr_LU, csr_val_LU, &
+                csr_row_ptr_LU, csr_col_ind_LU, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilut')
+            use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilut
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: max_fill
+            integer(c_int), value :: nnz_LU
+            type(c_ptr), intent(in), value :: descr_LU
+            type(c_ptr), value :: csr_val_LU
+            type(c_ptr), intent(in), value :: csr_row_ptr_LU
+            type(c_ptr), value :: csr_col_ind_LU
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilut
+
+!       rocsparse_csrilu0_iterative_buffer_size
+        function rocsparse_scsrilu0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_scsrilu0_iterative_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_iterative_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsric0_buffer_size
+        end function rocsparse_scsrilu0_iterative_buffer_size
 
-        function rocsparse_zbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_zbsric0_buffer_size')
+        function rocsparse_dcsrilu0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrilu0_iterative_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_iterative_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsric0_buffer_size
+        end function rocsparse_dcsrilu0_iterative_buffer_size
 
-!       rocsparse_bsric0_analysis
-        function rocsparse_sbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsric0_analysis')
+        function rocsparse_ccsrilu0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrilu0_iterative_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_iterative_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsric0_analysis
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilu0_iterative_buffer_size
 
-        function rocsparse_dbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsric0_analysis')
+        function rocsparse_zcsrilu0_iterative_buffer_size(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrilu0_iterative_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_iterative_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsric0_analysis
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilu0_iterative_buffer_size
 
-        function rocsparse_cbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsric0_analysis')
+!       rocsparse_csrilu0_iterative
+        function rocsparse_scsrilu0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilu0_iterative')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_iterative
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsric0_analysis
+        end function rocsparse_scsrilu0_iterative
 
-        function rocsparse_zbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsric0_analysis')
+        function rocsparse_dcsrilu0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilu0_iterative')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_iterative
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsric0_analysis
+        end function rocsparse_dcsrilu0_iterative
 
-!       rocsparse_bsric0_clear
-        function rocsparse_bsric0_clear(handle, info) &
-                bind(c, name = 'rocsparse_bsric0_clear')
+        function rocsparse_ccsrilu0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilu0_iterative')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_iterative
             type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-        end function rocsparse_bsric0_clear
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0_iterative
 
-!       rocsparse_bsric0
-        function rocsparse_sbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsric0')
+        function rocsparse_zcsrilu0_iterative(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweeps, residual, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilu0_iterative')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_iterative
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            integer(c_int), value :: sweeps
+            type(c_ptr), value :: residual
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsric0
+        end function rocsparse_zcsrilu0_iterative
 
-        function rocsparse_dbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsric0')
+!       rocsparse_csrmc_analysis
+        function rocsparse_csrmc_analysis(handle, m, nnz, descr, csr_row_ptr, csr_col_ind, &
+                ncolors, coloring, reordering, info) &
+                bind(c, name = 'rocsparse_csrmc_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmc_analysis
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: ncolors
+            type(c_ptr), intent(in), value :: coloring
+            type(c_ptr), intent(in), value :: reordering
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsric0
+        end function rocsparse_csrmc_analysis
 
-        function rocsparse_cbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsric0')
+!       rocsparse_csrmc_zero_pivot
+        function rocsparse_csrmc_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrmc_zero_pivot')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmc_zero_pivot
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsric0
+            type(c_ptr), value :: position
+        end function rocsparse_csrmc_zero_pivot
 
-        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsric0')
+!       rocsparse_csrmc_clear
+        function rocsparse_csrmc_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrmc_clear')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrmc_clear
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            type(c_ptr), value :: info
+        end function rocsparse_csrmc_clear
+
+!       rocsparse_csrmcsor
+        function rocsparse_scsrmcsor(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweep, omega, b, x) &
+                bind(c, name = 'rocsparse_scsrmcsor')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmcsor
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsric0
+            integer(c_int), value :: sweep
+            type(c_ptr), intent(in), value :: omega
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_scsrmcsor
 
-!       rocsparse_bsrilu0_zero_pivot
-        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
+        function rocsparse_dcsrmcsor(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweep, omega, b, x) &
+                bind(c, name = 'rocsparse_dcsrmcsor')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmcsor
             type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_bsrilu0_zero_pivot
+            integer(c_int), value :: sweep
+            type(c_ptr), intent(in), value :: omega
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_dcsrmcsor
 
-!       rocsparse_bsrilu0_buffer_size
-        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+        function rocsparse_ccsrmcsor(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweep, omega, b, x) &
+                bind(c, name = 'rocsparse_ccsrmcsor')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmcsor
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsrilu0_buffer_size
+            integer(c_int), value :: sweep
+            type(c_ptr), intent(in), value :: omega
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_ccsrmcsor
 
-        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+        function rocsparse_zcsrmcsor(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, sweep, omega, b, x) &
+                bind(c, name = 'rocsparse_zcsrmcsor')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmcsor
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsrilu0_buffer_size
+            integer(c_int), value :: sweep
+            type(c_ptr), intent(in), value :: omega
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+        end function rocsparse_zcsrmcsor
 
-        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+!       rocsparse_csrmcilu0
+        function rocsparse_scsrmcilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info) &
+                bind(c, name = 'rocsparse_scsrmcilu0')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmcilu0
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsrilu0_buffer_size
+        end function rocsparse_scsrmcilu0
 
-        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+        function rocsparse_dcsrmcilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info) &
+                bind(c, name = 'rocsparse_dcsrmcilu0')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmcilu0
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsrilu0_buffer_size
+        end function rocsparse_dcsrmcilu0
 
-!       rocsparse_bsrilu0_analysis
-        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+        function rocsparse_ccsrmcilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info) &
+                bind(c, name = 'rocsparse_ccsrmcilu0')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmcilu0
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrilu0_analysis
+        end function rocsparse_ccsrmcilu0
 
-        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+        function rocsparse_zcsrmcilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info) &
+                bind(c, name = 'rocsparse_zcsrmcilu0')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmcilu0
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrilu0_analysis
+        end function rocsparse_zcsrmcilu0
 
-        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+!       rocsparse_csrmcilu0_solve
+        function rocsparse_scsrmcilu0_solve(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, x, y) &
+                bind(c, name = 'rocsparse_scsrmcilu0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrmcilu0_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrilu0_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+        end function rocsparse_scsrmcilu0_solve
 
-        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+        function rocsparse_dcsrmcilu0_solve(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, x, y) &
+                bind(c, name = 'rocsparse_dcsrmcilu0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrmcilu0_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrilu0_analysis
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+        end function rocsparse_dcsrmcilu0_solve
 
-!       rocsparse_bsrilu0_clear
-        function rocsparse_bsrilu0_clear(handle, info) &
-                bind(c, name = 'rocsparse_bsrilu0_clear')
+        function rocsparse_ccsrmcilu0_solve(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, x, y) &
+                bind(c, name = 'rocsparse_ccsrmcilu0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrmcilu0_solve
             type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-        end function rocsparse_bsrilu0_clear
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+        end function rocsparse_ccsrmcilu0_solve
 
-!       rocsparse_bsrilu0
-        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsrilu0')
+        function rocsparse_zcsrmcilu0_solve(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, x, y) &
+                bind(c, name = 'rocsparse_zcsrmcilu0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrmcilu0_solve
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrilu0
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+        end function rocsparse_zcsrmcilu0_solve
 
-        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsrilu0')
+!       rocsparse_csrpoly_buffer_size
+        function rocsparse_scsrpoly_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_scsrpoly_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrpoly_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrilu0
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrpoly_buffer_size
 
-        function rocsparse_cbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsrilu0')
+        function rocsparse_dcsrpoly_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrpoly_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrpoly_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrilu0
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrpoly_buffer_size
 
-        function rocsparse_zbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsrilu0')
+        function rocsparse_ccsrpoly_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrpoly_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrpoly_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrilu0
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrpoly_buffer_size
 
-!       rocsparse_csric0_zero_pivot
-        function rocsparse_csric0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_csric0_zero_pivot')
+        function rocsparse_zcsrpoly_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrpoly_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrpoly_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_csric0_zero_pivot
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrpoly_buffer_size
 
-!       rocsparse_csric0_buffer_size
-        function rocsparse_scsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_scsric0_buffer_size')
+!       rocsparse_csrpoly
+        function rocsparse_scsrpoly(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, coeff, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrpoly')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrpoly
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3573,16 +6611,20 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_scsric0_buffer_size
+            integer(c_int), value :: degree
+            type(c_ptr), intent(in), value :: coeff
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrpoly
 
-        function rocsparse_dcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_dcsric0_buffer_size')
+        function rocsparse_dcsrpoly(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, coeff, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrpoly')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrpoly
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3591,16 +6633,20 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsric0_buffer_size
+            integer(c_int), value :: degree
+            type(c_ptr), intent(in), value :: coeff
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrpoly
 
-        function rocsparse_ccsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_ccsric0_buffer_size')
+        function rocsparse_ccsrpoly(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, coeff, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrpoly')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrpoly
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3609,16 +6655,20 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsric0_buffer_size
+            integer(c_int), value :: degree
+            type(c_ptr), intent(in), value :: coeff
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrpoly
 
-        function rocsparse_zcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_zcsric0_buffer_size')
+        function rocsparse_zcsrpoly(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, coeff, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrpoly')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrpoly
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3627,17 +6677,21 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsric0_buffer_size
+            integer(c_int), value :: degree
+            type(c_ptr), intent(in), value :: coeff
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrpoly
 
-!       rocsparse_csric0_analysis
-        function rocsparse_scsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_scsric0_analysis')
+!       rocsparse_csrpoly_chebyshev
+        function rocsparse_scsrpoly_chebyshev(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, lambda_min, lambda_max, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrpoly_chebyshev')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrpoly_chebyshev
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3646,18 +6700,21 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: degree
+            real(c_float), value :: lambda_min
+            real(c_float), value :: lambda_max
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsric0_analysis
+        end function rocsparse_scsrpoly_chebyshev
 
-        function rocsparse_dcsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsric0_analysis')
+        function rocsparse_dcsrpoly_chebyshev(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, lambda_min, lambda_max, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrpoly_chebyshev')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrpoly_chebyshev
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3666,18 +6723,21 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: degree
+            real(c_double), value :: lambda_min
+            real(c_double), value :: lambda_max
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsric0_analysis
+        end function rocsparse_dcsrpoly_chebyshev
 
-        function rocsparse_ccsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsric0_analysis')
+        function rocsparse_ccsrpoly_chebyshev(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, lambda_min, lambda_max, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrpoly_chebyshev')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrpoly_chebyshev
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3686,18 +6746,21 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: degree
+            real(c_float), value :: lambda_min
+            real(c_float), value :: lambda_max
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsric0_analysis
+        end function rocsparse_ccsrpoly_chebyshev
 
-        function rocsparse_zcsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsric0_analysis')
+        function rocsparse_zcsrpoly_chebyshev(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, degree, lambda_min, lambda_max, x, y, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrpoly_chebyshev')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrpoly_chebyshev
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3706,119 +6769,171 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            integer(c_int), value :: degree
+            real(c_double), value :: lambda_min
+            real(c_double), value :: lambda_max
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsric0_analysis
+        end function rocsparse_zcsrpoly_chebyshev
 
-!       rocsparse_csric0_clear
-        function rocsparse_csric0_clear(handle, info) &
-                bind(c, name = 'rocsparse_csric0_clear')
+!       rocsparse_csrfsai_zero_pivot
+        function rocsparse_csrfsai_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrfsai_zero_pivot')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrfsai_zero_pivot
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
-        end function rocsparse_csric0_clear
+            type(c_ptr), value :: position
+        end function rocsparse_csrfsai_zero_pivot
 
-!       rocsparse_csric0
-        function rocsparse_scsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_scsric0')
+!       rocsparse_csrfsai_nnz
+        function rocsparse_csrfsai_nnz(handle, m, descr_S, nnz_S, csr_row_ptr_S, &
+                csr_col_ind_S, descr_G, csr_row_ptr_G, nnz_G, truncated_rows) &
+                bind(c, name = 'rocsparse_csrfsai_nnz')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrfsai_nnz
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: descr_S
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_row_ptr_G
+            type(c_ptr), value :: nnz_G
+            type(c_ptr), value :: truncated_rows
+        end function rocsparse_csrfsai_nnz
+
+!       rocsparse_csrfsai
+        function rocsparse_scsrfsai(handle, m, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_S, nnz_S, csr_row_ptr_S, csr_col_ind_S, info, &
+                descr_G, csr_val_G, csr_row_ptr_G, csr_col_ind_G) &
+                bind(c, name = 'rocsparse_scsrfsai')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrfsai
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_S
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsric0
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+        end function rocsparse_scsrfsai
 
-        function rocsparse_dcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsric0')
+        function rocsparse_dcsrfsai(handle, m, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_S, nnz_S, csr_row_ptr_S, csr_col_ind_S, info, &
+                descr_G, csr_val_G, csr_row_ptr_G, csr_col_ind_G) &
+                bind(c, name = 'rocsparse_dcsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrfsai
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_S
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsric0
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+        end function rocsparse_dcsrfsai
 
-        function rocsparse_ccsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsric0')
+        function rocsparse_ccsrfsai(handle, m, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_S, nnz_S, csr_row_ptr_S, csr_col_ind_S, info, &
+                descr_G, csr_val_G, csr_row_ptr_G, csr_col_ind_G) &
+                bind(c, name = 'rocsparse_ccsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrfsai
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_S
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsric0
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+        end function rocsparse_ccsrfsai
 
-        function rocsparse_zcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsric0')
+        function rocsparse_zcsrfsai(handle, m, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_S, nnz_S, csr_row_ptr_S, csr_col_ind_S, info, &
+                descr_G, csr_val_G, csr_row_ptr_G, csr_col_ind_G) &
+                bind(c, name = 'rocsparse_zcsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrfsai
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_S
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsric0
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+        end function rocsparse_zcsrfsai
 
-!       rocsparse_csrilu0_zero_pivot
-        function rocsparse_csrilu0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_csrilu0_zero_pivot')
+!       rocsparse_csrildl0_zero_pivot
+        function rocsparse_csrildl0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrildl0_zero_pivot')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrildl0_zero_pivot
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
             type(c_ptr), value :: position
-        end function rocsparse_csrilu0_zero_pivot
+        end function rocsparse_csrildl0_zero_pivot
 
-!       rocsparse_csrilu0_buffer_size
-        function rocsparse_scsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+!       rocsparse_csrildl0_buffer_size
+        function rocsparse_scsrildl0_buffer_size(handle, m, nnz, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_scsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_scsrildl0_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrildl0_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3828,15 +6943,15 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrilu0_buffer_size
+        end function rocsparse_scsrildl0_buffer_size
 
-        function rocsparse_dcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+        function rocsparse_dcsrildl0_buffer_size(handle, m, nnz, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_dcsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_dcsrildl0_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrildl0_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3846,15 +6961,15 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrilu0_buffer_size
+        end function rocsparse_dcsrildl0_buffer_size
 
-        function rocsparse_ccsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+        function rocsparse_ccsrildl0_buffer_size(handle, m, nnz, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_ccsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_ccsrildl0_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrildl0_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3864,15 +6979,15 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrilu0_buffer_size
+        end function rocsparse_ccsrildl0_buffer_size
 
-        function rocsparse_zcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+        function rocsparse_zcsrildl0_buffer_size(handle, m, nnz, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_zcsrilu0_buffer_size')
+                bind(c, name = 'rocsparse_zcsrildl0_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrildl0_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3882,16 +6997,16 @@ module rocsparse
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrilu0_buffer_size
+        end function rocsparse_zcsrildl0_buffer_size
 
-!       rocsparse_csrilu0_analysis
-        function rocsparse_scsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrilu0_analysis')
+!       rocsparse_csrildl0_analysis
+        function rocsparse_scsrildl0_analysis(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrildl0_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrildl0_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3903,15 +7018,15 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrilu0_analysis
+        end function rocsparse_scsrildl0_analysis
 
-        function rocsparse_dcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrilu0_analysis')
+        function rocsparse_dcsrildl0_analysis(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrildl0_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrildl0_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3923,15 +7038,15 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrilu0_analysis
+        end function rocsparse_dcsrildl0_analysis
 
-        function rocsparse_ccsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrilu0_analysis')
+        function rocsparse_ccsrildl0_analysis(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrildl0_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrildl0_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3943,15 +7058,15 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrilu0_analysis
+        end function rocsparse_ccsrildl0_analysis
 
-        function rocsparse_zcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrilu0_analysis')
+        function rocsparse_zcsrildl0_analysis(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrildl0_analysis')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrildl0_analysis
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
@@ -3963,95 +7078,184 @@ module rocsparse
             integer(c_int), value :: analysis
             integer(c_int), value :: solve
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrilu0_analysis
+        end function rocsparse_zcsrildl0_analysis
 
-!       rocsparse_csrilu0_clear
-        function rocsparse_csrilu0_clear(handle, info) &
-                bind(c, name = 'rocsparse_csrilu0_clear')
+!       rocsparse_csrildl0_clear
+        function rocsparse_csrildl0_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrildl0_clear')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrildl0_clear
             type(c_ptr), value :: handle
             type(c_ptr), value :: info
-        end function rocsparse_csrilu0_clear
+        end function rocsparse_csrildl0_clear
+
+!       rocsparse_csrildl0
+        function rocsparse_scsrildl0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrildl0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrildl0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrildl0
+
+        function rocsparse_dcsrildl0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrildl0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrildl0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrildl0
+
+        function rocsparse_ccsrildl0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrildl0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrildl0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrildl0
+
+        function rocsparse_zcsrildl0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrildl0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrildl0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrildl0
 
-!       rocsparse_csrilu0
-        function rocsparse_scsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrilu0')
+!       rocsparse_csrildl0_solve
+        function rocsparse_scsrildl0_solve(handle, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrildl0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrildl0_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrilu0
+        end function rocsparse_scsrildl0_solve
 
-        function rocsparse_dcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrilu0')
+        function rocsparse_dcsrildl0_solve(handle, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrildl0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrildl0_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrilu0
+        end function rocsparse_dcsrildl0_solve
 
-        function rocsparse_ccsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrilu0')
+        function rocsparse_ccsrildl0_solve(handle, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrildl0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrildl0_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrilu0
+        end function rocsparse_ccsrildl0_solve
 
-        function rocsparse_zcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrilu0')
+        function rocsparse_zcsrildl0_solve(handle, m, nnz, alpha, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, x, y, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrildl0_solve')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrildl0_solve
             type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr
             type(c_ptr), intent(in), value :: csr_val
             type(c_ptr), intent(in), value :: csr_row_ptr
             type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), value :: y
             integer(c_int), value :: policy
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrilu0
+        end function rocsparse_zcsrildl0_solve
 
 !       rocsparse_gtsv_buffer_size
         function rocsparse_sgtsv_buffer_size(handle, m, n, dl, d, du, &
@@ -4491,6 +7695,330 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_zgtsv_no_pivot_strided_batch
 
+!       rocsparse_gtsv_interleaved_batch_buffer_size
+        function rocsparse_sgtsv_interleaved_batch_buffer_size(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_sgtsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgtsv_interleaved_batch_buffer_size
+
+        function rocsparse_dgtsv_interleaved_batch_buffer_size(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_dgtsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgtsv_interleaved_batch_buffer_size
+
+        function rocsparse_cgtsv_interleaved_batch_buffer_size(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_cgtsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgtsv_interleaved_batch_buffer_size
+
+        function rocsparse_zgtsv_interleaved_batch_buffer_size(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_zgtsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgtsv_interleaved_batch_buffer_size
+
+!       rocsparse_gtsv_interleaved_batch
+        function rocsparse_sgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgtsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sgtsv_interleaved_batch
+
+        function rocsparse_dgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgtsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dgtsv_interleaved_batch
+
+        function rocsparse_cgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgtsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cgtsv_interleaved_batch
+
+        function rocsparse_zgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgtsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgtsv_interleaved_batch
+
+!       rocsparse_gpsv_interleaved_batch_buffer_size
+        function rocsparse_sgpsv_interleaved_batch_buffer_size(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_sgpsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgpsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgpsv_interleaved_batch_buffer_size
+
+        function rocsparse_dgpsv_interleaved_batch_buffer_size(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_dgpsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgpsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgpsv_interleaved_batch_buffer_size
+
+        function rocsparse_cgpsv_interleaved_batch_buffer_size(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_cgpsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgpsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgpsv_interleaved_batch_buffer_size
+
+        function rocsparse_zgpsv_interleaved_batch_buffer_size(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_zgpsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgpsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgpsv_interleaved_batch_buffer_size
+
+!       rocsparse_gpsv_interleaved_batch
+        function rocsparse_sgpsv_interleaved_batch(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgpsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgpsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: ds
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sgpsv_interleaved_batch
+
+        function rocsparse_dgpsv_interleaved_batch(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgpsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgpsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: ds
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dgpsv_interleaved_batch
+
+        function rocsparse_cgpsv_interleaved_batch(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgpsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgpsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: ds
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cgpsv_interleaved_batch
+
+        function rocsparse_zgpsv_interleaved_batch(handle, alg, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgpsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgpsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), value :: ds
+            type(c_ptr), value :: dl
+            type(c_ptr), value :: d
+            type(c_ptr), value :: du
+            type(c_ptr), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgpsv_interleaved_batch
+
 ! ===========================================================================
 !   conversion SPARSE
 ! ===========================================================================
@@ -7277,6 +10805,44 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_dprune_csr2csr_by_percentage
 
+! ===========================================================================
+!   reordering SPARSE
+! ===========================================================================
+
+!       rocsparse_csrrcm_buffer_size
+        function rocsparse_csrrcm_buffer_size(handle, m, nnz, csr_row_ptr, csr_col_ind, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_csrrcm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrcm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csrrcm_buffer_size
+
+!       rocsparse_csrrcm
+        function rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_csrrcm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrcm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: perm
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrrcm
+
     end interface
 
 end module rocsparse
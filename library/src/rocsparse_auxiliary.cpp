@@ -115,6 +115,95 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Indicates whether bitwise reproducible results are required.
+ * Set deterministic mode, can be disabled or enabled
+ *******************************************************************************/
+rocsparse_status rocsparse_set_deterministic_mode(rocsparse_handle             handle,
+                                                  rocsparse_deterministic_mode mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(mode != rocsparse_deterministic_mode_disabled
+       && mode != rocsparse_deterministic_mode_enabled)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    handle->deterministic_mode = mode;
+    log_trace(handle, "rocsparse_set_deterministic_mode", mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get deterministic mode, can be disabled or enabled.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_deterministic_mode(rocsparse_handle              handle,
+                                                  rocsparse_deterministic_mode* mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(mode == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *mode = handle->deterministic_mode;
+    log_trace(handle, "rocsparse_get_deterministic_mode", *mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Indicates whether only asynchronous work may be enqueued.
+ * Set graph mode, can be disabled or enabled
+ *******************************************************************************/
+rocsparse_status rocsparse_set_graph_mode(rocsparse_handle handle, rocsparse_graph_mode mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(mode != rocsparse_graph_mode_disabled && mode != rocsparse_graph_mode_enabled)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    handle->graph_mode = mode;
+    log_trace(handle, "rocsparse_set_graph_mode", mode);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get graph mode, can be disabled or enabled.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_graph_mode(rocsparse_handle handle, rocsparse_graph_mode* mode)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    if(mode == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *mode = handle->graph_mode;
+    log_trace(handle, "rocsparse_get_graph_mode", *mode);
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -449,6 +538,25 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Get the ELL width and the predicted hybmv cost of a HYB matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_hyb_mat_partition(const rocsparse_hyb_mat hyb,
+                                                 rocsparse_int*          ell_width,
+                                                 int64_t*                predicted_cost)
+{
+    // Check for valid pointers
+    if(hyb == nullptr || ell_width == nullptr || predicted_cost == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *ell_width      = hyb->ell_width;
+    *predicted_cost = hyb->predicted_cost;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_mat_info is a structure holding the matrix info data that is
  * gathered during the analysis routines. It must be initialized by calling
@@ -509,13 +617,15 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
 
     // Uncouple shared meta data
     if(info->csrsv_lower_info == info->csrilu0_info || info->csrsv_lower_info == info->csric0_info
+       || info->csrsv_lower_info == info->csrildl0_info
        || info->csrsv_lower_info == info->csrsm_lower_info)
     {
         info->csrsv_lower_info = nullptr;
     }
 
     // Uncouple shared meta data
-    if(info->csrsm_lower_info == info->csrilu0_info || info->csrsm_lower_info == info->csric0_info)
+    if(info->csrsm_lower_info == info->csrilu0_info || info->csrsm_lower_info == info->csric0_info
+       || info->csrsm_lower_info == info->csrildl0_info)
     {
         info->csrsm_lower_info = nullptr;
     }
@@ -526,6 +636,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         info->csrilu0_info = nullptr;
     }
 
+    // Uncouple shared meta data
+    if(info->csrildl0_info == info->csrilu0_info || info->csrildl0_info == info->csric0_info)
+    {
+        info->csrildl0_info = nullptr;
+    }
+
     // Uncouple shared meta data
     if(info->csrsv_upper_info == info->csrsm_upper_info)
     {
@@ -640,6 +756,12 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrilu0_info));
     }
 
+    // Clear csrildl0 info struct
+    if(info->csrildl0_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrildl0_info));
+    }
+
     // Clear bsrsv upper info struct
     if(info->bsrsv_upper_info != nullptr)
     {
@@ -688,12 +810,25 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->bsrsm_lower_info));
     }
 
+    // Clear csrmc info struct
+    if(info->csrmc_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_trm_info(info->csrmc_info));
+    }
+
     // Clear csrgemm info struct
     if(info->csrgemm_info != nullptr)
     {
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrgemm_info(info->csrgemm_info));
     }
 
+    // Clear csriluk pattern
+    for(int i = 0; i < 2; ++i)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->csriluk_col_ind[i]));
+        RETURN_IF_HIP_ERROR(hipFree(info->csriluk_lev[i]));
+    }
+
     // Clear zero pivot
     if(info->zero_pivot != nullptr)
     {
@@ -2173,6 +2308,64 @@ rocsparse_status rocsparse_spmat_set_values(rocsparse_spmat_descr descr, void* v
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_spmat_get_strided_batch returns the batch count and the
+ * batch stride of the sparse matrix values.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_get_strided_batch(const rocsparse_spmat_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+{
+    // Check for valid pointers
+    if(descr == nullptr || batch_count == nullptr || batch_stride == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *batch_count  = static_cast<int>(descr->batch_count);
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_spmat_set_strided_batch sets the batch count and the batch
+ * stride of the sparse matrix values.
+ *******************************************************************************/
+rocsparse_status rocsparse_spmat_set_strided_batch(rocsparse_spmat_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+{
+    // Check for valid pointer
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check batch count and stride
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_spmat_get_attribute gets the sparse matrix attribute.
  *******************************************************************************/
@@ -2587,6 +2780,64 @@ rocsparse_status rocsparse_dnmat_set_values(rocsparse_dnmat_descr descr, void* v
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief rocsparse_dnmat_get_strided_batch returns the batch count and the
+ * batch stride of the dense matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnmat_get_strided_batch(const rocsparse_dnmat_descr descr,
+                                                   int*                        batch_count,
+                                                   int64_t*                    batch_stride)
+{
+    // Check for valid pointers
+    if(descr == nullptr || batch_count == nullptr || batch_stride == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    *batch_count  = static_cast<int>(descr->batch_count);
+    *batch_stride = descr->batch_stride;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_dnmat_set_strided_batch sets the batch count and the batch
+ * stride of the dense matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_dnmat_set_strided_batch(rocsparse_dnmat_descr descr,
+                                                   int                   batch_count,
+                                                   int64_t               batch_stride)
+{
+    // Check for valid pointer
+    if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check if descriptor has been initialized
+    if(descr->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+
+    // Check batch count and stride
+    if(batch_count <= 0 || batch_stride < 0)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    descr->batch_count  = batch_count;
+    descr->batch_stride = batch_stride;
+
+    return rocsparse_status_success;
+}
+
 #ifdef __cplusplus
 }
 #endif
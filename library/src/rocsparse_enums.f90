@@ -78,6 +78,7 @@ module rocsparse_enums
         enumerator :: rocsparse_hyb_partition_auto = 0
         enumerator :: rocsparse_hyb_partition_user = 1
         enumerator :: rocsparse_hyb_partition_max = 2
+        enumerator :: rocsparse_hyb_partition_histogram = 3
     end enum
 
 !   rocsparse_analysis_policy
@@ -89,6 +90,28 @@ module rocsparse_enums
 !   rocsparse_solve_policy
     enum, bind(c)
         enumerator :: rocsparse_solve_policy_auto = 0
+        enumerator :: rocsparse_solve_policy_level_set = 1
+        enumerator :: rocsparse_solve_policy_sync_free = 2
+    end enum
+
+!   rocsparse_sor_sweep
+    enum, bind(c)
+        enumerator :: rocsparse_sor_sweep_forward = 0
+        enumerator :: rocsparse_sor_sweep_backward = 1
+        enumerator :: rocsparse_sor_sweep_symmetric = 2
+    end enum
+
+!   rocsparse_csrgemm_mask
+    enum, bind(c)
+        enumerator :: rocsparse_csrgemm_mask_keep = 0
+        enumerator :: rocsparse_csrgemm_mask_complement = 1
+    end enum
+
+!   rocsparse_csrgemm_masked_alg
+    enum, bind(c)
+        enumerator :: rocsparse_csrgemm_masked_alg_default = 0
+        enumerator :: rocsparse_csrgemm_masked_alg_dot = 1
+        enumerator :: rocsparse_csrgemm_masked_alg_row = 2
     end enum
 
 !   rocsparse_pointer_mode
@@ -97,6 +120,18 @@ module rocsparse_enums
         enumerator :: rocsparse_pointer_mode_device = 1
     end enum
 
+!   rocsparse_deterministic_mode
+    enum, bind(c)
+        enumerator :: rocsparse_deterministic_mode_disabled = 0
+        enumerator :: rocsparse_deterministic_mode_enabled = 1
+    end enum
+
+!   rocsparse_graph_mode
+    enum, bind(c)
+        enumerator :: rocsparse_graph_mode_disabled = 0
+        enumerator :: rocsparse_graph_mode_enabled = 1
+    end enum
+
 !   rocsparse_layer_mode
     enum, bind(c)
         enumerator :: rocsparse_layer_mode_none = 0